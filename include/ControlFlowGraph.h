@@ -0,0 +1,76 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef CONTROL_FLOW_GRAPH_20121017_H_
+#define CONTROL_FLOW_GRAPH_20121017_H_
+
+#include "API.h"
+#include "Types.h"
+
+#include <QVector>
+
+// the basic blocks of a function and the edges between them. blocks and edges
+// are kept in flat arrays and refer to each other by index: the successors of
+// a block are a run of edges(), and its predecessors a run of predecessors(),
+// which holds indexes into edges(). blocks are sorted by address
+class YAD64_EXPORT ControlFlowGraph {
+public:
+	enum EdgeKind {
+		EDGE_FALLTHROUGH, // into the next block, which starts where this one ends
+		EDGE_TAKEN,       // a conditional jump which is taken
+		EDGE_NOT_TAKEN,   // a conditional jump which is not taken
+		EDGE_JUMP,        // an unconditional jump
+		EDGE_TABLE        // one of the cases of a jump table
+	};
+
+	struct Block {
+		yad64::address_t start;
+		yad64::address_t end;              // one past the last byte
+		yad64::address_t last_instruction;
+		int              first_successor;
+		int              successor_count;
+		int              first_predecessor;
+		int              predecessor_count;
+	};
+
+	struct Edge {
+		int      from;
+		int      to;
+		EdgeKind kind;
+	};
+
+public:
+	ControlFlowGraph();
+
+	// only the addresses of the blocks are used, the rest is filled in here
+	ControlFlowGraph(const QVector<Block> &blocks, const QVector<Edge> &edges);
+
+public:
+	bool empty() const                        { return blocks_.empty(); }
+	const QVector<Block> &blocks() const      { return blocks_; }
+	const QVector<Edge> &edges() const        { return edges_; }
+	const QVector<int> &predecessors() const  { return predecessors_; }
+	int find_block(yad64::address_t address) const;
+
+private:
+	QVector<Block> blocks_;
+	QVector<Edge>  edges_;        // sorted by the block they leave
+	QVector<int>   predecessors_; // edges sorted by the block they enter
+};
+
+#endif
@@ -41,6 +41,7 @@ class IDebugEventHandler;
 class IDebuggerCore;
 class IPlugin;
 class ISessionFile;
+class Job;
 class ISymbolManager;
 class MemoryRegions;
 class State;
@@ -155,6 +156,9 @@ namespace yad64 {
         YAD64_EXPORT const QHash<QString, QObject *> &plugin_list();
         YAD64_EXPORT IPlugin *find_plugin_by_name(const QString &name);
 
+		// runs a long job on a worker thread, see Job.h
+        YAD64_EXPORT void submit_job(Job *job);
+
         YAD64_EXPORT void reload_symbols();
         YAD64_EXPORT void repaint_cpu_view();
 
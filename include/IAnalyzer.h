@@ -19,10 +19,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifndef IANALYZER_20080630_H_
 #define IANALYZER_20080630_H_
 
+#include "ControlFlowGraph.h"
+#include "XrefIndex.h"
+#include <QList>
 #include <QMap>
 #include <QSet>
+#include <QVector>
 #include "Types.h"
 
+class Job;
 class MemoryRegion;
 
 class IAnalyzer {
@@ -59,9 +64,35 @@ public:
 	virtual void analyze(const MemoryRegion &region) = 0;
 	virtual FunctionMap functions(const MemoryRegion &region) const = 0;
 	virtual AddressCategory category(yad64::address_t address) const = 0;
+	virtual QVector<AddressCategory> categories(yad64::address_t start, yad64::address_t end) const;
 	virtual void invalidate_analysis(const MemoryRegion &region) = 0;
 	virtual void invalidate_analysis() = 0;
 	virtual QSet<yad64::address_t> specified_functions() const { return QSet<yad64::address_t>(); }
+
+	// a job which analyzes the regions in the background, see Job.h. once it
+	// has finished functions() returns the new analysis
+	virtual Job *analysis_job(const QList<MemoryRegion> &regions) = 0;
+
+	// the basic blocks of the function containing address, empty if there is
+	// no analysis of it
+	virtual ControlFlowGraph control_flow_graph(yad64::address_t address) const = 0;
+
+	// everything the analyzed code refers to address from, sorted by where the
+	// reference is. only the regions which have been analyzed are searched
+	virtual QVector<XrefIndex::Xref> references_to(yad64::address_t address) const = 0;
 };
 
+//------------------------------------------------------------------------------
+// Name: categories(yad64::address_t start, yad64::address_t end) const
+// Desc: classifies every address in [start, end) in one go, analyzers with an
+//       index of their functions should do better than this
+//------------------------------------------------------------------------------
+inline QVector<IAnalyzer::AddressCategory> IAnalyzer::categories(yad64::address_t start, yad64::address_t end) const {
+	QVector<AddressCategory> ret;
+	for(yad64::address_t address = start; address < end; ++address) {
+		ret.push_back(category(address));
+	}
+	return ret;
+}
+
 #endif
@@ -31,6 +31,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 class DebugEvent;
 class IState;
+class QObject;
 class QString;
 class State;
 
@@ -63,6 +64,12 @@ public:
 	virtual yad64::tid_t active_thread() const     { return static_cast<yad64::tid_t>(-1); }
 	virtual void set_active_thread(yad64::tid_t)   {}
 
+public:
+	// event notification (optional), a core which returns an object here emits
+	// its debug_event_ready() signal whenever wait_debug_event has something
+	// to report, so callers can stop polling it
+	virtual QObject *event_notifier() { return 0; }
+
 public:
 	virtual bool attach(yad64::pid_t pid) = 0;
 	virtual bool open(const QString &path, const QString &cwd, const QList<QByteArray> &args) = 0;
@@ -88,6 +95,16 @@ public:
 public:
 	virtual QList<MemoryRegion> memory_regions() const = 0;
 
+	// returns false only if the core is sure that the memory map is the same
+	// as it was the last time this was called, so callers can skip re-reading
+	// it. cores which can't tell just always say it changed
+	virtual bool memory_map_changed() { return true; }
+
+	// hit/miss counts of the core's memory read cache, cores without one
+	// just report zeros
+	virtual quint64 memory_cache_hits() const   { return 0; }
+	virtual quint64 memory_cache_misses() const { return 0; }
+
 public:
 	// process properties
 	virtual QList<QByteArray> process_args(yad64::pid_t pid) const = 0;
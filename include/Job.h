@@ -0,0 +1,147 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef JOB_20121017_H_
+#define JOB_20121017_H_
+
+#include "API.h"
+#include "ResultStore.h"
+#include "Types.h"
+
+#include <QAtomicInt>
+#include <QList>
+#include <QObject>
+#include <QTime>
+#include <QVector>
+
+#ifdef USE_QT_CONCURRENT
+#include <QtConcurrentMap>
+#endif
+
+// a long running piece of work, like a scan of all of memory, which
+// yad64::v1::submit_job runs on a worker thread so that the GUI stays
+// responsive. cancel() may be called from any thread at any time, run() should
+// check cancelled() every so often and return early once it is set. the
+// signals are delivered to the GUI thread, and the job deletes itself after
+// finished has been emitted
+class YAD64_EXPORT Job : public QObject {
+	Q_OBJECT
+
+public:
+	Job();
+	virtual ~Job();
+
+public:
+	// a piece of a bulk read which one worker thread searches. bytes is the
+	// whole read and is shared by all of its chunks, bytes outside of
+	// [first, last) are only there so that matches can run over the edges
+	struct Chunk {
+		QVector<quint8>  bytes;
+		yad64::address_t base;   // where bytes[0] is mapped
+		std::size_t      first;
+		std::size_t      last;
+		int              tag;    // whatever the job needs, a region number say
+	};
+
+	// reads are split into chunks of this many bytes so that even a single
+	// large region is spread across all of the worker threads
+	static const std::size_t chunk_size = 0x100000;
+
+public:
+	virtual void run() = 0;
+
+public:
+	bool cancelled() const;
+	void execute(); // used by yad64::v1::submit_job
+
+public Q_SLOTS:
+	void cancel();
+
+protected:
+	// these are meant to be called from run()
+	void set_progress(int percent);
+	void report_results(const ResultStore &results);
+	void report_error(const QString &title, const QString &message);
+
+	// ptrace only answers to the thread which attached to the process, so
+	// debuggee memory is read by handing the request over to the GUI thread and
+	// waiting for it. a cancelled job stops waiting and the read fails
+	bool read_bytes(yad64::address_t address, void *buf, std::size_t len);
+	bool read_pages(yad64::address_t address, void *buf, std::size_t count);
+
+	// read_pages into a new buffer. a buffer too big to allocate is reported
+	// to the user, either way an empty buffer means nothing was read
+	QVector<quint8> read_buffer(yad64::address_t address, std::size_t page_count, std::size_t page_size);
+
+	// appends the chunks covering [first, last) of bytes
+	static void split_chunks(const QVector<quint8> &bytes, yad64::address_t base, std::size_t first, std::size_t last, int tag, QList<Chunk> &chunks, std::size_t size = chunk_size);
+
+	// calls f(chunk) for every chunk, on all threads when QtConcurrent is
+	// available. F needs a result_type typedef, the results are returned in
+	// the same order as the chunks
+	template <class F>
+	static QList<typename F::result_type> map_chunks(const QList<Chunk> &chunks, F f);
+
+	template <class F>
+	static QList<typename F::result_type> map_chunks(const QVector<quint8> &bytes, yad64::address_t base, F f);
+
+Q_SIGNALS:
+	void progress(int percent);
+	void results(const ResultStore &results);
+	void finished(bool cancelled);
+
+private:
+	bool read(yad64::address_t address, void *buf, std::size_t count, bool pages);
+
+private:
+	QAtomicInt cancelled_;
+	QTime      progress_time_;
+	int        progress_;
+};
+
+//------------------------------------------------------------------------------
+// Name: map_chunks(const QList<Chunk> &chunks, F f)
+// Desc:
+//------------------------------------------------------------------------------
+template <class F>
+QList<typename F::result_type> Job::map_chunks(const QList<Chunk> &chunks, F f) {
+#ifdef USE_QT_CONCURRENT
+	QFuture<typename F::result_type> future = QtConcurrent::mapped(chunks, f);
+	future.waitForFinished();
+	return future.results();
+#else
+	QList<typename F::result_type> results;
+	Q_FOREACH(const Chunk &chunk, chunks) {
+		results.append(f(chunk));
+	}
+	return results;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Name: map_chunks(const QVector<quint8> &bytes, yad64::address_t base, F f)
+// Desc: the common case, all of bytes is searched
+//------------------------------------------------------------------------------
+template <class F>
+QList<typename F::result_type> Job::map_chunks(const QVector<quint8> &bytes, yad64::address_t base, F f) {
+	QList<Chunk> chunks;
+	split_chunks(bytes, base, 0, bytes.size(), 0, chunks);
+	return map_chunks(chunks, f);
+}
+
+#endif
@@ -24,6 +24,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <QAbstractItemModel>
 #include <QList>
+#include <QVector>
 
 class YAD64_EXPORT MemoryRegions : public QAbstractItemModel {
 	Q_OBJECT
@@ -43,12 +44,32 @@ public:
 public:
 	bool find_region(yad64::address_t address) const;
 	bool find_region(yad64::address_t address, MemoryRegion &region) const;
+	const MemoryRegion *lookup(yad64::address_t address) const;
 	const QList<MemoryRegion> &regions() const { return regions_; }
 	void clear();
 	void sync();
 
 private:
+	void load_symbols(const MemoryRegion &region);
+	int find_index(yad64::address_t address) const;
+
+private:
+	// a flat copy of the region bounds in the same order as regions_, so
+	// lookups don't have to chase an IRegion pointer for every probe
+	struct span_t {
+		yad64::address_t start;
+		yad64::address_t end;
+	};
+
+	static span_t make_span(const MemoryRegion &region);
+
 	QList<MemoryRegion> regions_;
+	QVector<span_t>     spans_;
+
+	// like the rows themselves, the index and the hint belong to the GUI
+	// thread, which is the only one allowed to look things up. Jobs which
+	// need the map elsewhere take a copy of regions() before they start
+	mutable int         last_hit_;
 };
 
 #endif
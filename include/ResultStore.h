@@ -0,0 +1,67 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef RESULT_STORE_20121017_H_
+#define RESULT_STORE_20121017_H_
+
+#include "API.h"
+#include "Types.h"
+
+#include <QByteArray>
+#include <QMetaType>
+#include <QString>
+#include <QVector>
+
+// a compact list of search results. each result is an address, some flags the
+// search may use to tell kinds of results apart, how many bytes it covers and
+// a line of text. these are kept in columns with all of the text in one arena,
+// so a result costs a few dozen bytes instead of a list item. a search with
+// too many results to format as they are found leaves the text out and gives
+// the model a formatter instead. it has no QObject in it, so worker threads can
+// fill one in and hand it to a ResultsModel
+class YAD64_EXPORT ResultStore {
+public:
+	ResultStore();
+
+public:
+	void append(yad64::address_t address, const QString &text = QString(), quint32 flags = 0xffffffff, quint32 length = 0);
+	void append(const ResultStore &other);
+	void reserve(int count);
+	void clear();
+
+public:
+	int size() const                           { return addresses_.size(); }
+	bool empty() const                         { return addresses_.empty(); }
+	yad64::address_t address(int row) const    { return addresses_[row]; }
+	quint32 flags(int row) const               { return flags_[row]; }
+	quint32 length(int row) const              { return lengths_[row]; }
+	const char *text_data(int row) const       { return text_.constData() + offsets_[row]; }
+	int text_size(int row) const               { return offsets_[row + 1] - offsets_[row]; }
+	QString text(int row) const                { return QString::fromUtf8(text_data(row), text_size(row)); }
+
+private:
+	QVector<yad64::address_t> addresses_;
+	QVector<quint32>          flags_;
+	QVector<quint32>          lengths_;
+	QVector<quint32>          offsets_; // where the text of each row starts in text_, and one past the last
+	QByteArray                text_;
+};
+
+Q_DECLARE_METATYPE(ResultStore)
+
+#endif
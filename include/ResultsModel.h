@@ -0,0 +1,85 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef RESULTS_MODEL_20121017_H_
+#define RESULTS_MODEL_20121017_H_
+
+#include "API.h"
+#include "ResultStore.h"
+
+#include <QAbstractListModel>
+#include <QByteArray>
+#include <QVector>
+
+// shows a ResultStore. rows are only formatted when a view asks for them, and
+// sorting and filtering shuffle a list of row numbers rather than the results.
+// Qt::UserRole is the address of a row and Qt::UserRole + 1 its flags
+class YAD64_EXPORT ResultsModel : public QAbstractListModel {
+	Q_OBJECT
+
+public:
+	// makes the text of a row whose store has none, from its address, length
+	// and flags. it runs on the GUI thread, so it may read debuggee memory
+	typedef QString (*Formatter)(yad64::address_t address, quint32 length, quint32 flags);
+
+public:
+	enum SortKey {
+		SORT_NONE,    // the order the results were found in
+		SORT_ADDRESS,
+		SORT_TEXT
+	};
+
+public:
+	ResultsModel(QObject *parent = 0);
+	virtual ~ResultsModel();
+
+public:
+	virtual QVariant data(const QModelIndex &index, int role) const;
+	virtual int rowCount(const QModelIndex &parent = QModelIndex()) const;
+
+public:
+	void clear();
+	void set_sort(SortKey key);
+	void set_flag_mask(quint32 mask);
+	void set_formatter(Formatter formatter);
+	const ResultStore &results() const { return results_; }
+	yad64::address_t address(const QModelIndex &index) const;
+
+public Q_SLOTS:
+	void append(const ResultStore &results);
+	void set_filter(const QString &filter);
+
+private:
+	QString text(int row) const;
+	void format_keys();
+	bool accept(int row) const;
+	void sort_rows(int *first, int *last) const;
+	void refilter();
+	void remap_persistent_indexes(const QVector<int> &old_rows);
+
+private:
+	ResultStore          results_;
+	QVector<int>         rows_;      // the rows of results_ which are shown, in order
+	QByteArray           filter_;    // lower case
+	quint32              flag_mask_;
+	SortKey              sort_key_;
+	Formatter            formatter_;
+	QVector<QByteArray>  keys_;      // formatted rows, only made to filter or sort by text
+};
+
+#endif
@@ -0,0 +1,60 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef RESULTS_VIEW_20121017_H_
+#define RESULTS_VIEW_20121017_H_
+
+#include "API.h"
+
+#include <QWidget>
+
+class QComboBox;
+class QLabel;
+class QLineEdit;
+class QListView;
+class QModelIndex;
+class ResultsModel;
+
+// a list of search results with a filter box and a choice of sort order,
+// backed by a ResultsModel so that it copes with millions of results
+class YAD64_EXPORT ResultsView : public QWidget {
+	Q_OBJECT
+
+public:
+	ResultsView(QWidget *parent = 0);
+	virtual ~ResultsView();
+
+public:
+	ResultsModel *model() const { return model_; }
+
+Q_SIGNALS:
+	void doubleClicked(const QModelIndex &index);
+
+private Q_SLOTS:
+	void sort_changed(int index);
+	void update_count();
+
+private:
+	ResultsModel *model_;
+	QLineEdit *   filter_;
+	QComboBox *   sort_;
+	QLabel *      count_;
+	QListView *   list_;
+};
+
+#endif
@@ -0,0 +1,76 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef XREF_INDEX_20121017_H_
+#define XREF_INDEX_20121017_H_
+
+#include "API.h"
+#include "Types.h"
+
+#include <QVector>
+
+// the references a region's code makes to addresses, kept sorted by the
+// address referenced so that finding everything which references an address
+// is a binary search. each distinct target is stored once, and the places
+// referencing it are stored as 32 bit offsets into the region
+class YAD64_EXPORT XrefIndex {
+public:
+	enum Kind {
+		XREF_CALL,      // a direct call
+		XREF_JUMP,      // a direct jmp or jcc
+		XREF_DATA,      // a rip relative or absolute memory operand
+		XREF_IMMEDIATE  // an immediate which is an address in a mapped region
+	};
+
+	struct Xref {
+		yad64::address_t from;
+		yad64::address_t to;
+		Kind             kind;
+	};
+
+public:
+	XrefIndex();
+
+	// every from must be in [base, base + 4GB)
+	XrefIndex(yad64::address_t base, const QVector<Xref> &xrefs);
+
+	// the same, for when most of them are already sorted the way xrefs()
+	// returns them, which is the case when an index is updated
+	XrefIndex(yad64::address_t base, const QVector<Xref> &sorted, const QVector<Xref> &xrefs);
+
+public:
+	bool empty() const { return sources_.empty(); }
+	int size() const   { return sources_.size(); }
+	yad64::address_t base() const { return base_; }
+	QVector<Xref> references_to(yad64::address_t address) const;
+	QVector<Xref> references_to(yad64::address_t first, yad64::address_t last) const;
+	QVector<Xref> xrefs() const;
+
+private:
+	void append(int target, QVector<Xref> &xrefs) const;
+	void build(const QVector<Xref> &sorted);
+
+private:
+	yad64::address_t          base_;
+	QVector<yad64::address_t> targets_; // distinct, sorted
+	QVector<quint32>          first_;   // where each target's run of sources_ starts, and one past the last
+	QVector<quint32>          sources_; // offsets from base_, sorted within each run
+	QVector<quint8>           kinds_;
+};
+
+#endif
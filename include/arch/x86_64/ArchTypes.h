@@ -21,6 +21,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <QtGlobal>
 #include "Instruction.h"
+#include "InstructionLength.h"
 
 #define YAD64_MAX_HEX 16
 #define YAD64_X86_64
@@ -31,6 +32,7 @@ namespace yad64 {
 	typedef quint64                         address_t;
 	typedef Instruction<edisassm::x86_64>   Instruction;
 	typedef Instruction::operand_t          Operand;
+	typedef edisassm::length_info<edisassm::x86_64> InstructionLength;
 }
 
 #endif
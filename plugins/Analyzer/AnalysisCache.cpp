@@ -0,0 +1,494 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "AnalysisCache.h"
+#include "Configuration.h"
+#include "Debugger.h"
+#include "FastHash.h"
+#include "IDebuggerCore.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QtDebug>
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+// the file is a Header, followed by function_count FunctionRecords,
+// page_count page hashes, call_count CallRecords, graph_count GraphRecords,
+// block_count BlockRecords, edge_count EdgeRecords and xref_count
+// XrefRecords. everything is 8 byte aligned, so it is used right where it is
+// mapped
+const char    cache_magic[8] = { 'Y', 'A', 'D', '6', '4', 'F', 'N', 'C' };
+const quint32 cache_version  = 5;
+
+struct Header {
+	char    magic[8];
+	quint32 version;
+	quint32 fuzzy;
+	qint64  file_size;      // the file is taken to be the same while it has
+	quint64 file_modified;  // the same size and time, in seconds
+	quint64 region_offset;  // where in the file the region is mapped from
+	quint64 region_size;
+	quint64 function_count;
+	quint64 page_count;
+	quint64 call_count;
+	quint64 graph_count;
+	quint64 block_count;
+	quint64 edge_count;
+	quint64 xref_count;
+};
+
+// all addresses are offsets from the start of the region
+struct FunctionRecord {
+	quint64 entry_address;
+	quint64 end_address;
+	quint64 last_instruction;
+	qint32  reference_count;
+	qint32  type;
+};
+
+struct CallRecord {
+	quint64 caller;
+	quint64 callee;
+};
+
+// a graph's blocks and edges are a run of the ones which follow
+struct GraphRecord {
+	quint64 entry_address;
+	quint32 first_block;
+	quint32 block_count;
+	quint32 first_edge;
+	quint32 edge_count;
+};
+
+struct BlockRecord {
+	quint64 start;
+	quint64 end;
+	quint64 last_instruction;
+};
+
+// from and to are indexes into the graph's blocks
+struct EdgeRecord {
+	qint32 from;
+	qint32 to;
+	qint32 kind;
+	qint32 reserved;
+};
+
+// a reference's target is kept as an offset too, even when it is outside of
+// the region. the code of a file only refers to its own image without
+// relocations, and the parts of an image are always mapped the same distance
+// apart
+struct XrefRecord {
+	quint64 from;
+	quint64 to;
+	qint32  kind;
+	qint32  reserved;
+};
+
+//------------------------------------------------------------------------------
+// Name: cache_directory()
+// Desc:
+//------------------------------------------------------------------------------
+QString cache_directory() {
+	return QString("%1/analysis").arg(yad64::v1::config().session_path);
+}
+
+//------------------------------------------------------------------------------
+// Name: take(quint64 count, std::size_t record_size, quint64 &remaining)
+// Desc: accounts for count records of a cache file, false if there are fewer
+//       than that many bytes left in it
+//------------------------------------------------------------------------------
+bool take(quint64 count, std::size_t record_size, quint64 &remaining) {
+	if(count > remaining / record_size) {
+		return false;
+	}
+
+	remaining -= count * record_size;
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: file_matches(const MemoryRegion &region, yad64::address_t page_size, const QVector<quint64> &page_hashes)
+// Desc: hashes the pages of the file which the region maps, the same way the
+//       analysis hashes the live ones, and stops at the first one which
+//       differs. the part of the last page past the end of the file reads as
+//       zeros, just like it does in memory
+//------------------------------------------------------------------------------
+bool file_matches(const MemoryRegion &region, yad64::address_t page_size, const QVector<quint64> &page_hashes) {
+
+	if(page_size == 0 || region.size() / page_size != static_cast<yad64::address_t>(page_hashes.size())) {
+		return false;
+	}
+
+	QFile file(region.name());
+	if(!file.open(QIODevice::ReadOnly) || !file.seek(region.base())) {
+		return false;
+	}
+
+	QVector<char> page(page_size);
+
+	for(int i = 0; i < page_hashes.size(); ++i) {
+		std::memset(page.data(), 0, page_size);
+		if(file.read(page.data(), page_size) < 0 || fast_hash::hash(page.constData(), page_size) != page_hashes[i]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+}
+
+//------------------------------------------------------------------------------
+// Name: cacheable(const MemoryRegion &region)
+// Desc: only code which comes from a file will look the same next time
+//------------------------------------------------------------------------------
+bool AnalysisCache::cacheable(const MemoryRegion &region) {
+	return region.executable() && !region.writable() && !region.name().isEmpty() && QFileInfo(region.name()).isFile();
+}
+
+//------------------------------------------------------------------------------
+// Name: matches_file(const MemoryRegion &region, yad64::address_t page_size, const QVector<quint64> &page_hashes)
+// Desc: are the pages which were analyzed the ones in the region's file? they
+//       aren't if the code was patched, or relocated when it was loaded. the
+//       file is only read if the saved analysis doesn't already vouch for it
+//------------------------------------------------------------------------------
+bool AnalysisCache::matches_file(const MemoryRegion &region, yad64::address_t page_size, const QVector<quint64> &page_hashes) {
+	return !page_hashes.isEmpty() && (matches_saved(region, page_hashes) || file_matches(region, page_size, page_hashes));
+}
+
+//------------------------------------------------------------------------------
+// Name: matches_saved(const MemoryRegion &region, const QVector<quint64> &page_hashes)
+// Desc: only analyses of code which was the same as the file's are saved, so
+//       if the file still has the size and time it had then and the pages are
+//       the ones saved, they are the file's too. only the header and the page
+//       hashes of the saved analysis are read
+//------------------------------------------------------------------------------
+bool AnalysisCache::matches_saved(const MemoryRegion &region, const QVector<quint64> &page_hashes) {
+
+	QFile file(filename(region));
+
+	Header header;
+	if(!file.open(QIODevice::ReadOnly) || file.read(reinterpret_cast<char *>(&header), sizeof(Header)) != static_cast<qint64>(sizeof(Header))) {
+		return false;
+	}
+
+	const QFileInfo info(region.name());
+	quint64 remaining = file.size() - sizeof(Header);
+
+	const bool valid =
+		std::memcmp(header.magic, cache_magic, sizeof(cache_magic)) == 0 &&
+		header.version       == cache_version &&
+		header.region_offset == static_cast<quint64>(region.base()) &&
+		header.region_size   == static_cast<quint64>(region.size()) &&
+		header.file_size     == info.size() &&
+		header.file_modified == info.lastModified().toTime_t() &&
+		header.page_count    == static_cast<quint64>(page_hashes.size()) &&
+		take(header.function_count, sizeof(FunctionRecord), remaining) &&
+		take(header.page_count,     sizeof(quint64),        remaining);
+
+	if(!valid || !file.seek(sizeof(Header) + header.function_count * sizeof(FunctionRecord))) {
+		return false;
+	}
+
+	QVector<quint64> saved(page_hashes.size());
+	const qint64 bytes = saved.size() * sizeof(quint64);
+	return file.read(reinterpret_cast<char *>(saved.data()), bytes) == bytes && saved == page_hashes;
+}
+
+//------------------------------------------------------------------------------
+// Name: filename(const MemoryRegion &region)
+// Desc: named after where the file is, so looking for one needs nothing else
+//------------------------------------------------------------------------------
+QString AnalysisCache::filename(const MemoryRegion &region) {
+
+	const QByteArray path = region.name().toUtf8();
+
+	return QString("%1/%2-%3-%4.functions")
+		.arg(cache_directory())
+		.arg(yad64::v1::basename(region.name()))
+		.arg(fast_hash::hash(path.constData(), path.size()), 16, 16, QChar('0'))
+		.arg(static_cast<quint64>(region.base()), 0, 16);
+}
+
+//------------------------------------------------------------------------------
+// Name: load(const MemoryRegion &region, AnalysisResult &result)
+// Desc: returns false if there is no analysis of this region's file, or if the
+//       one there is doesn't fit it. the file is only read if it was touched
+//       since it was analyzed, and then only the part the region maps
+//------------------------------------------------------------------------------
+bool AnalysisCache::load(const MemoryRegion &region, AnalysisResult &result) {
+
+	if(!cacheable(region)) {
+		return false;
+	}
+
+	QFile file(filename(region));
+	if(!file.open(QIODevice::ReadOnly) || file.size() < static_cast<qint64>(sizeof(Header))) {
+		return false;
+	}
+
+	const uchar *const p = file.map(0, file.size());
+	if(!p) {
+		return false;
+	}
+
+	const Header *const header = reinterpret_cast<const Header *>(p);
+
+	// every count has to fit in what is left of the file, and together they
+	// have to account for all of it
+	quint64 remaining = file.size() - sizeof(Header);
+
+	bool valid =
+		std::memcmp(header->magic, cache_magic, sizeof(cache_magic)) == 0 &&
+		header->version       == cache_version &&
+		header->region_offset == static_cast<quint64>(region.base()) &&
+		header->region_size   == static_cast<quint64>(region.size()) &&
+		take(header->function_count, sizeof(FunctionRecord), remaining) &&
+		take(header->page_count,     sizeof(quint64),        remaining) &&
+		take(header->call_count,     sizeof(CallRecord),     remaining) &&
+		take(header->graph_count,    sizeof(GraphRecord),    remaining) &&
+		take(header->block_count,    sizeof(BlockRecord),    remaining) &&
+		take(header->edge_count,     sizeof(EdgeRecord),     remaining) &&
+		take(header->xref_count,     sizeof(XrefRecord),     remaining) &&
+		remaining == 0;
+
+	if(valid) {
+		const QFileInfo info(region.name());
+		if(header->file_size != info.size() || header->file_modified != info.lastModified().toTime_t()) {
+			const quint64 *const pages = reinterpret_cast<const quint64 *>(reinterpret_cast<const FunctionRecord *>(header + 1) + header->function_count);
+
+			QVector<quint64> page_hashes(header->page_count);
+			std::copy(pages, pages + header->page_count, page_hashes.begin());
+			valid = matches_file(region, yad64::v1::debugger_core->page_size(), page_hashes);
+		}
+	}
+
+	if(valid) {
+		const FunctionRecord *const functions = reinterpret_cast<const FunctionRecord *>(header + 1);
+		const quint64 *const        pages     = reinterpret_cast<const quint64 *>(functions + header->function_count);
+		const CallRecord *const     calls     = reinterpret_cast<const CallRecord *>(pages + header->page_count);
+		const GraphRecord *const    graphs    = reinterpret_cast<const GraphRecord *>(calls + header->call_count);
+		const BlockRecord *const    blocks    = reinterpret_cast<const BlockRecord *>(graphs + header->graph_count);
+		const EdgeRecord *const     edges     = reinterpret_cast<const EdgeRecord *>(blocks + header->block_count);
+		const XrefRecord *const     xrefs     = reinterpret_cast<const XrefRecord *>(edges + header->edge_count);
+
+		const yad64::address_t start = region.start();
+
+		result.region    = region;
+		result.fuzzy     = header->fuzzy != 0;
+		result.complete  = true;
+		result.unchanged = false;
+		result.from_file = true;
+
+		result.functions.clear();
+		for(quint64 i = 0; i < header->function_count; ++i) {
+			IAnalyzer::Function function;
+			function.entry_address    = start + functions[i].entry_address;
+			function.end_address      = start + functions[i].end_address;
+			function.last_instruction = start + functions[i].last_instruction;
+			function.reference_count  = functions[i].reference_count;
+			function.type             = static_cast<IAnalyzer::Function::Type>(functions[i].type);
+			result.functions.insert(function.entry_address, function);
+		}
+
+		result.page_hashes.resize(header->page_count);
+		if(header->page_count != 0) {
+			std::memcpy(result.page_hashes.data(), pages, header->page_count * sizeof(quint64));
+		}
+
+		result.calls.clear();
+		for(quint64 i = 0; i < header->call_count; ++i) {
+			result.calls[start + calls[i].caller].push_back(start + calls[i].callee);
+		}
+
+		result.graphs.clear();
+		for(quint64 i = 0; i < header->graph_count; ++i) {
+			const GraphRecord &graph = graphs[i];
+			if(static_cast<quint64>(graph.first_block) + graph.block_count > header->block_count || static_cast<quint64>(graph.first_edge) + graph.edge_count > header->edge_count) {
+				continue;
+			}
+
+			QVector<ControlFlowGraph::Block> graph_blocks(graph.block_count);
+			for(quint32 j = 0; j < graph.block_count; ++j) {
+				const BlockRecord &block = blocks[graph.first_block + j];
+				graph_blocks[j].start            = start + block.start;
+				graph_blocks[j].end              = start + block.end;
+				graph_blocks[j].last_instruction = start + block.last_instruction;
+			}
+
+			QVector<ControlFlowGraph::Edge> graph_edges;
+			graph_edges.reserve(graph.edge_count);
+			for(quint32 j = 0; j < graph.edge_count; ++j) {
+				const EdgeRecord &edge = edges[graph.first_edge + j];
+				if(edge.from >= 0 && edge.to >= 0 && static_cast<quint32>(edge.from) < graph.block_count && static_cast<quint32>(edge.to) < graph.block_count) {
+					const ControlFlowGraph::Edge e = { edge.from, edge.to, static_cast<ControlFlowGraph::EdgeKind>(edge.kind) };
+					graph_edges.push_back(e);
+				}
+			}
+
+			result.graphs.insert(start + graph.entry_address, ControlFlowGraph(graph_blocks, graph_edges));
+		}
+
+		QVector<XrefIndex::Xref> region_xrefs;
+		region_xrefs.reserve(header->xref_count);
+		for(quint64 i = 0; i < header->xref_count; ++i) {
+			const XrefIndex::Xref xref = { start + xrefs[i].from, start + xrefs[i].to, static_cast<XrefIndex::Kind>(xrefs[i].kind) };
+			region_xrefs.push_back(xref);
+		}
+
+		result.xrefs = XrefIndex(start, region_xrefs);
+
+		qDebug() << "[Analyzer] loaded" << header->function_count << "functions for" << region.name() << "from" << file.fileName();
+	}
+
+	file.unmap(const_cast<uchar *>(p));
+	return valid;
+}
+
+//------------------------------------------------------------------------------
+// Name: save(const AnalysisResult &result)
+// Desc: written to a temporary file first, so that a reader never sees half
+//       of one. an analysis of code which isn't the same as the file's isn't
+//       kept, it wouldn't fit the next time the file is mapped
+//------------------------------------------------------------------------------
+void AnalysisCache::save(const AnalysisResult &result) {
+
+	const MemoryRegion &region = result.region;
+	if(!result.from_file || !cacheable(region)) {
+		return;
+	}
+
+	const QString name = filename(region);
+	if(!QDir().mkpath(cache_directory())) {
+		return;
+	}
+
+	const QFileInfo info(region.name());
+
+	quint64 call_count = 0;
+	Q_FOREACH(const QVector<yad64::address_t> &callees, result.calls) {
+		call_count += callees.size();
+	}
+
+	const yad64::address_t start = region.start();
+
+	QVector<GraphRecord> graphs;
+	QVector<BlockRecord> blocks;
+	QVector<EdgeRecord>  edges;
+	graphs.reserve(result.graphs.size());
+	for(GraphMap::const_iterator it = result.graphs.begin(); it != result.graphs.end(); ++it) {
+		const ControlFlowGraph &graph = it.value();
+
+		const GraphRecord record = {
+			it.key() - start,
+			static_cast<quint32>(blocks.size()),
+			static_cast<quint32>(graph.blocks().size()),
+			static_cast<quint32>(edges.size()),
+			static_cast<quint32>(graph.edges().size())
+		};
+		graphs.push_back(record);
+
+		Q_FOREACH(const ControlFlowGraph::Block &block, graph.blocks()) {
+			const BlockRecord b = { block.start - start, block.end - start, block.last_instruction - start };
+			blocks.push_back(b);
+		}
+
+		Q_FOREACH(const ControlFlowGraph::Edge &edge, graph.edges()) {
+			const EdgeRecord e = { edge.from, edge.to, edge.kind, 0 };
+			edges.push_back(e);
+		}
+	}
+
+	Header header;
+	std::memcpy(header.magic, cache_magic, sizeof(cache_magic));
+	header.version        = cache_version;
+	header.fuzzy          = result.fuzzy;
+	header.file_size      = info.size();
+	header.file_modified  = info.lastModified().toTime_t();
+	header.region_offset  = region.base();
+	header.region_size    = region.size();
+	header.function_count = result.functions.size();
+	header.page_count     = result.page_hashes.size();
+	header.call_count     = call_count;
+	header.graph_count    = graphs.size();
+	header.block_count    = blocks.size();
+	header.edge_count     = edges.size();
+	header.xref_count     = result.xrefs.size();
+
+	QVector<FunctionRecord> functions;
+	functions.reserve(result.functions.size());
+	Q_FOREACH(const IAnalyzer::Function &function, result.functions) {
+		const FunctionRecord record = {
+			function.entry_address    - start,
+			function.end_address      - start,
+			function.last_instruction - start,
+			function.reference_count,
+			function.type
+		};
+		functions.push_back(record);
+	}
+
+	QVector<CallRecord> calls;
+	calls.reserve(call_count);
+	for(CallMap::const_iterator it = result.calls.begin(); it != result.calls.end(); ++it) {
+		Q_FOREACH(yad64::address_t callee, it.value()) {
+			const CallRecord record = { it.key() - start, callee - start };
+			calls.push_back(record);
+		}
+	}
+
+	QVector<XrefRecord> xrefs;
+	xrefs.reserve(result.xrefs.size());
+	Q_FOREACH(const XrefIndex::Xref &xref, result.xrefs.xrefs()) {
+		const XrefRecord record = { xref.from - start, xref.to - start, xref.kind, 0 };
+		xrefs.push_back(record);
+	}
+
+	const QString temp_name = name + ".tmp";
+	QFile file(temp_name);
+	if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+		return;
+	}
+
+	const bool written =
+		file.write(reinterpret_cast<const char *>(&header), sizeof(header)) == sizeof(header) &&
+		file.write(reinterpret_cast<const char *>(functions.constData()), functions.size() * sizeof(FunctionRecord)) == static_cast<qint64>(functions.size() * sizeof(FunctionRecord)) &&
+		file.write(reinterpret_cast<const char *>(result.page_hashes.constData()), result.page_hashes.size() * sizeof(quint64)) == static_cast<qint64>(result.page_hashes.size() * sizeof(quint64)) &&
+		file.write(reinterpret_cast<const char *>(calls.constData()), calls.size() * sizeof(CallRecord)) == static_cast<qint64>(calls.size() * sizeof(CallRecord)) &&
+		file.write(reinterpret_cast<const char *>(graphs.constData()), graphs.size() * sizeof(GraphRecord)) == static_cast<qint64>(graphs.size() * sizeof(GraphRecord)) &&
+		file.write(reinterpret_cast<const char *>(blocks.constData()), blocks.size() * sizeof(BlockRecord)) == static_cast<qint64>(blocks.size() * sizeof(BlockRecord)) &&
+		file.write(reinterpret_cast<const char *>(edges.constData()), edges.size() * sizeof(EdgeRecord)) == static_cast<qint64>(edges.size() * sizeof(EdgeRecord)) &&
+		file.write(reinterpret_cast<const char *>(xrefs.constData()), xrefs.size() * sizeof(XrefRecord)) == static_cast<qint64>(xrefs.size() * sizeof(XrefRecord));
+
+	file.close();
+
+	if(written) {
+		QFile::remove(name);
+		if(QFile::rename(temp_name, name)) {
+			return;
+		}
+	}
+
+	QFile::remove(temp_name);
+}
@@ -0,0 +1,47 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ANALYSIS_CACHE_20121017_H_
+#define ANALYSIS_CACHE_20121017_H_
+
+#include "RegionAnalysis.h"
+
+#include <QString>
+#include <QVector>
+
+// keeps the analysis of regions which are mapped from a file on disk, so that
+// the next time the same file is mapped (in this process or the next) its
+// functions are known right away. there is one file per mapping, named after
+// the module's path, and all addresses in it are offsets from the start of
+// the region so it doesn't matter where the module is loaded. only analyses
+// of code which is the same as in the file are kept
+class AnalysisCache {
+public:
+	static bool cacheable(const MemoryRegion &region);
+	static bool matches_file(const MemoryRegion &region, yad64::address_t page_size, const QVector<quint64> &page_hashes);
+
+public:
+	bool load(const MemoryRegion &region, AnalysisResult &result);
+	void save(const AnalysisResult &result);
+
+private:
+	static QString filename(const MemoryRegion &region);
+	static bool matches_saved(const MemoryRegion &region, const QVector<quint64> &page_hashes);
+};
+
+#endif
@@ -0,0 +1,172 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "AnalysisJob.h"
+#include "AnalysisCache.h"
+#include "ParallelFor.h"
+
+#include <QMutexLocker>
+#include <QTime>
+#include <QtDebug>
+
+#include <boost/bind.hpp>
+
+#include <functional>
+
+namespace {
+
+// regions are read until about batch_size bytes are pending, then that batch
+// is analyzed and its snapshots released before the next one is read, so
+// analyzing everything never needs a copy of all of it at once
+const std::size_t batch_size = 0x4000000;
+
+}
+
+//------------------------------------------------------------------------------
+// Name: AnalysisJob(const QList<AnalysisInput> &inputs, int generation)
+// Desc: generation is the analyzer's at the time the inputs were gathered, if
+//       it has changed since then the analyses are out of date
+//------------------------------------------------------------------------------
+AnalysisJob::AnalysisJob(const QList<AnalysisInput> &inputs, int generation) : inputs_(inputs), generation_(generation) {
+}
+
+//------------------------------------------------------------------------------
+// Name: run()
+// Desc: takes snapshots of the regions a batch at a time, and analyzes each
+//       batch before reading the next
+//------------------------------------------------------------------------------
+void AnalysisJob::run() {
+
+	QTime t;
+	t.start();
+
+	analyses_.resize(inputs_.size());
+	snapshots_.resize(inputs_.size());
+	data_snapshots_.resize(inputs_.size());
+	progress_.fill(0, inputs_.size());
+
+	int         first   = 0;
+	std::size_t pending = 0;
+
+	for(int i = 0; i < inputs_.size(); ++i) {
+
+		if(cancelled()) {
+			return;
+		}
+
+		const AnalysisInput &input = inputs_[i];
+		AnalysisResult &result     = analyses_[i];
+
+		result.region    = input.region;
+		result.fuzzy     = input.fuzzy;
+		result.complete  = false;
+		result.unchanged = false;
+		result.from_file = false;
+
+		// the reads have to go through the GUI thread, so they are done one
+		// after the other
+		snapshots_[i] = read_buffer(input.region.start(), input.region.size() / input.page_size, input.page_size);
+		pending += snapshots_[i].size();
+
+		Q_FOREACH(const MemoryRegion &region, input.data_regions) {
+			DataSnapshot data;
+			data.start = region.start();
+			data.bytes = read_buffer(region.start(), region.size() / input.page_size, input.page_size);
+			if(!data.bytes.isEmpty()) {
+				pending += data.bytes.size();
+				data_snapshots_[i].push_back(data);
+			}
+		}
+
+		if(pending >= batch_size || i + 1 == inputs_.size()) {
+			analyze_batch(first, i + 1);
+			first   = i + 1;
+			pending = 0;
+		}
+	}
+
+	snapshots_.clear();
+	data_snapshots_.clear();
+
+	qDebug("[Analyzer] elapsed: %d ms", t.elapsed());
+	set_progress(100);
+}
+
+//------------------------------------------------------------------------------
+// Name: analyze_batch(int first, int last)
+// Desc: each region is analyzed on its own, and each analysis spreads its
+//       passes over the same threads, so a single large region still uses all
+//       of them and a lot of small ones don't wait on each other
+//------------------------------------------------------------------------------
+void AnalysisJob::analyze_batch(int first, int last) {
+	parallel::parallel_for(last - first, boost::bind(&AnalysisJob::analyze_region, this, boost::bind(std::plus<int>(), first, _1)));
+}
+
+//------------------------------------------------------------------------------
+// Name: analyze_region(int i)
+// Desc: runs on any thread
+//------------------------------------------------------------------------------
+void AnalysisJob::analyze_region(int i) {
+
+	AnalysisResult &result = analyses_[i];
+
+	if(snapshots_[i].isEmpty() || cancelled()) {
+		return;
+	}
+
+	RegionAnalysis analysis(inputs_[i], snapshots_[i], data_snapshots_[i]);
+
+	// the snapshots are only needed by the analysis now
+	snapshots_[i]      = QVector<quint8>();
+	data_snapshots_[i] = QList<DataSnapshot>();
+
+	result.complete = analysis.run(
+		boost::bind(&AnalysisJob::region_progress, this, i, _1),
+		boost::bind(&Job::cancelled, this));
+
+	if(result.complete) {
+		result.unchanged = analysis.unchanged();
+		if(!result.unchanged) {
+			result.functions   = analysis.functions();
+			result.calls       = analysis.calls();
+			result.graphs      = analysis.graphs();
+			result.xrefs       = analysis.xrefs();
+			result.page_hashes = analysis.page_hashes();
+			result.from_file   = AnalysisCache::cacheable(result.region) && AnalysisCache::matches_file(result.region, inputs_[i].page_size, result.page_hashes);
+		}
+		qDebug("[Analyzer] complete");
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: region_progress(int i, int percent)
+// Desc: the job's progress is the average of all of the regions
+//------------------------------------------------------------------------------
+void AnalysisJob::region_progress(int i, int percent) {
+
+	QMutexLocker locker(&progress_mutex_);
+
+	progress_[i] = percent;
+
+	int total = 0;
+	Q_FOREACH(int p, progress_) {
+		total += p;
+	}
+
+	set_progress(total / progress_.size());
+}
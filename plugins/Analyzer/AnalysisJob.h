@@ -0,0 +1,58 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ANALYSIS_JOB_20121017_H_
+#define ANALYSIS_JOB_20121017_H_
+
+#include "Job.h"
+#include "RegionAnalysis.h"
+
+#include <QList>
+#include <QMutex>
+#include <QVector>
+
+// analyzes any number of regions on a worker thread, a batch of them at a
+// time. the inputs are gathered by the Analyzer on the GUI thread, and it takes the
+// analyses back once the job is finished
+class AnalysisJob : public Job {
+public:
+	AnalysisJob(const QList<AnalysisInput> &inputs, int generation);
+
+public:
+	virtual void run();
+
+public:
+	const QVector<AnalysisResult> &analyses() const { return analyses_; }
+	int generation() const                          { return generation_; }
+
+private:
+	void analyze_batch(int first, int last);
+	void analyze_region(int i);
+	void region_progress(int i, int percent);
+
+private:
+	const QList<AnalysisInput> inputs_;
+	const int                  generation_;
+	QVector<AnalysisResult>    analyses_;
+	QVector<QVector<quint8> >  snapshots_;
+	QVector<QList<DataSnapshot> > data_snapshots_;
+	QVector<int>               progress_;
+	QMutex                     progress_mutex_;
+};
+
+#endif
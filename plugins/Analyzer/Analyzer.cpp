@@ -17,13 +17,14 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "Analyzer.h"
+#include "AnalysisJob.h"
 #include "AnalyzerOptionsPage.h"
 #include "AnalyzerWidget.h"
 #include "IArchProcessor.h"
 #include "Debugger.h"
 #include "IDebuggerCore.h"
 #include "DialogSpecifiedFunctions.h"
-#include "Instruction.h"
+#include "DialogXrefs.h"
 #include "MemoryRegions.h"
 #include "State.h"
 #include "ISymbolManager.h"
@@ -37,37 +38,61 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <QMenu>
 #include <QMessageBox>
 #include <QProgressDialog>
+#include <QPushButton>
 #include <QSettings>
-#include <QStack>
 #include <QTime>
+#include <QtAlgorithms>
 #include <QtDebug>
 
-#include <boost/function.hpp>
 #include <boost/bind.hpp>
 
-#ifdef USE_QT_CONCURRENT
-#include <QtConcurrentMap>
-#endif
+#include <new>
 
-#include <cstring>
+namespace {
+	//------------------------------------------------------------------------------
+	// Name: never_cancelled()
+	// Desc:
+	//------------------------------------------------------------------------------
+	bool never_cancelled() {
+		return false;
+	}
 
-#define MIN_REFCOUNT 2
+	//------------------------------------------------------------------------------
+	// Name: entry_less(yad64::address_t address, const IAnalyzer::Function &function)
+	// Desc: ordering for qUpperBound over a list of functions sorted by entry
+	//------------------------------------------------------------------------------
+	bool entry_less(yad64::address_t address, const IAnalyzer::Function &function) {
+		return address < function.entry_address;
+	}
 
-namespace {
-#if defined(YAD64_X86)
-	const yad64::Operand::Register STACK_REG = yad64::Operand::REG_ESP;
-	const yad64::Operand::Register FRAME_REG = yad64::Operand::REG_EBP;
-#elif defined(YAD64_X86_64)
-	const yad64::Operand::Register STACK_REG = yad64::Operand::REG_RSP;
-	const yad64::Operand::Register FRAME_REG = yad64::Operand::REG_RBP;
-#endif
+	//------------------------------------------------------------------------------
+	// Name: from_less(const XrefIndex::Xref &lhs, const XrefIndex::Xref &rhs)
+	// Desc:
+	//------------------------------------------------------------------------------
+	bool from_less(const XrefIndex::Xref &lhs, const XrefIndex::Xref &rhs) {
+		return lhs.from < rhs.from;
+	}
+
+	//------------------------------------------------------------------------------
+	// Name: category_in(const IAnalyzer::Function &function, yad64::address_t address)
+	// Desc: classifies an address which is known to be inside of function
+	//------------------------------------------------------------------------------
+	IAnalyzer::AddressCategory category_in(const IAnalyzer::Function &function, yad64::address_t address) {
+		if(address == function.entry_address) {
+			return IAnalyzer::ADDRESS_FUNC_START;
+		} else if(address == function.end_address) {
+			return IAnalyzer::ADDRESS_FUNC_END;
+		} else {
+			return IAnalyzer::ADDRESS_FUNC_BODY;
+		}
+	}
 }
 
 //------------------------------------------------------------------------------
 // Name: Analyzer(
 // Desc:
 //------------------------------------------------------------------------------
-Analyzer::Analyzer() : menu_(0), analyzer_widget_(0) {
+Analyzer::Analyzer() : menu_(0), analyzer_widget_(0), generation_(0) {
 }
 
 //------------------------------------------------------------------------------
@@ -86,6 +111,7 @@ QMenu *Analyzer::menu(QWidget *parent) {
 	if(menu_ == 0) {
 		menu_ = new QMenu(tr("Analyzer"), parent);
 		menu_->addAction(tr("Show &Specified Functions"), this, SLOT(show_specified()));
+		menu_->addAction(tr("Find &References..."), this, SLOT(show_references()));
 #if defined(YAD64_X86)
 		menu_->addAction(tr("&Analyze EIP's Region"), this, SLOT(do_ip_analysis()), QKeySequence(tr("Ctrl+A")));
 #elif defined(YAD64_X86_64)
@@ -122,6 +148,38 @@ QMenu *Analyzer::menu(QWidget *parent) {
 //------------------------------------------------------------------------------
 void Analyzer::private_init() {
 	yad64::v1::set_analyzer(this);
+	connect(&yad64::v1::memory_regions(), SIGNAL(rowsInserted(const QModelIndex &, int, int)), this, SLOT(regions_added(const QModelIndex &, int, int)));
+}
+
+//------------------------------------------------------------------------------
+// Name: regions_added(const QModelIndex &parent, int first, int last)
+// Desc: modules which were analyzed before have their functions right away
+//------------------------------------------------------------------------------
+void Analyzer::regions_added(const QModelIndex &parent, int first, int last) {
+	Q_UNUSED(parent);
+
+	const QList<MemoryRegion> &regions = yad64::v1::memory_regions().regions();
+	for(int i = first; i <= last && i < regions.size(); ++i) {
+		load_cached_analysis(regions[i]);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: load_cached_analysis(const MemoryRegion &region)
+// Desc:
+//------------------------------------------------------------------------------
+void Analyzer::load_cached_analysis(const MemoryRegion &region) {
+
+	// nothing to do if there already is an analysis of this region
+	QHash<MemoryRegion, RegionInfo>::const_iterator it = analysis_info_.find(region);
+	if(it != analysis_info_.end() && !it->page_hashes.isEmpty()) {
+		return;
+	}
+
+	AnalysisResult result;
+	if(cache_.load(region, result)) {
+		install_analysis(result);
+	}
 }
 
 //------------------------------------------------------------------------------
@@ -133,6 +191,42 @@ void Analyzer::show_specified() {
 	dialog->show();
 }
 
+//------------------------------------------------------------------------------
+// Name: references_dialog()
+// Desc:
+//------------------------------------------------------------------------------
+DialogXrefs *Analyzer::references_dialog() {
+	static DialogXrefs *dialog = new DialogXrefs(yad64::v1::debugger_ui);
+	return dialog;
+}
+
+//------------------------------------------------------------------------------
+// Name: show_references()
+// Desc:
+//------------------------------------------------------------------------------
+void Analyzer::show_references() {
+	references_dialog()->show();
+}
+
+//------------------------------------------------------------------------------
+// Name: show_selected_references()
+// Desc: the references to the selected instruction, or to the start of the
+//       function it is in
+//------------------------------------------------------------------------------
+void Analyzer::show_selected_references() {
+
+	yad64::address_t address = yad64::v1::cpu_selected_address();
+
+	Function function;
+	if(find_containing_function(address, function)) {
+		address = function.entry_address;
+	}
+
+	DialogXrefs *const dialog = references_dialog();
+	dialog->find_references(address);
+	dialog->show();
+}
+
 //------------------------------------------------------------------------------
 // Name: do_ip_analysis()
 // Desc:
@@ -223,756 +317,402 @@ QList<QAction *> Analyzer::cpu_context_menu() {
 	QAction *const action_goto_function_start = new QAction(tr("Goto Function Start"), this);
 	QAction *const action_goto_function_end   = new QAction(tr("Goto Function End"), this);
 	QAction *const action_mark_function_start = new QAction(tr("Mark As Function Start"), this);
+	QAction *const action_find_references     = new QAction(tr("Find References"), this);
 
 	connect(action_find, SIGNAL(triggered()), this, SLOT(do_view_analysis()));
 	connect(action_goto_function_start, SIGNAL(triggered()), this, SLOT(goto_function_start()));
 	connect(action_goto_function_end, SIGNAL(triggered()),   this, SLOT(goto_function_end()));
 	connect(action_mark_function_start, SIGNAL(triggered()), this, SLOT(mark_function_start()));
-	ret << action_find << action_goto_function_start << action_goto_function_end << action_mark_function_start;
+	connect(action_find_references, SIGNAL(triggered()),     this, SLOT(show_selected_references()));
+	ret << action_find << action_goto_function_start << action_goto_function_end << action_mark_function_start << action_find_references;
 
 	return ret;
 }
 
 //------------------------------------------------------------------------------
 // Name: do_analysis(const MemoryRegion &region)
-// Desc:
+// Desc: analyzes the region in the background, the progress dialog can cancel it
 //------------------------------------------------------------------------------
 void Analyzer::do_analysis(const MemoryRegion &region) {
 	if(region.size() != 0) {
-		QProgressDialog progress(tr("Performing Analysis"), 0, 0, 100, yad64::v1::debugger_ui);
-		connect(this, SIGNAL(update_progress(int)), &progress, SLOT(setValue(int)));
-		progress.show();
-		progress.setValue(0);
-		analyze(region);
-		yad64::v1::repaint_cpu_view();
+		Job *const job = analysis_job(QList<MemoryRegion>() << region);
+
+		QProgressDialog *const progress = new QProgressDialog(tr("Performing Analysis"), tr("Cancel"), 0, 100, yad64::v1::debugger_ui);
+		progress->setMinimumDuration(0);
+		progress->setValue(0);
+
+		connect(progress, SIGNAL(canceled()), job, SLOT(cancel()));
+		connect(job, SIGNAL(progress(int)), progress, SLOT(setValue(int)));
+		connect(job, SIGNAL(finished(bool)), progress, SLOT(deleteLater()));
+
+		progress->show();
+		yad64::v1::submit_job(job);
 	}
 }
 
 //------------------------------------------------------------------------------
-// Name: find_function_calls(const MemoryRegion &region, FunctionMap &found_functions)
-// Desc:
+// Name: analysis_input(const MemoryRegion &region) const
+// Desc: looks up everything the analysis needs to know about the region which
+//       only the GUI thread can
 //------------------------------------------------------------------------------
-void Analyzer::find_function_calls(const MemoryRegion &region, FunctionMap &found_functions) {
-	static const yad64::address_t page_size = yad64::v1::debugger_core->page_size();
-
-	const yad64::address_t size_in_pages = region.size() / page_size;
-
-	try {
-		QVector<quint8> pages(size_in_pages * page_size);
-
-		if(yad64::v1::debugger_core->read_pages(region.start(), &pages[0], size_in_pages)) {
-			for(yad64::address_t i = 0; i < static_cast<yad64::address_t>(region.size()); ++i) {
+AnalysisInput Analyzer::analysis_input(const MemoryRegion &region_ref) const {
 
-				const yad64::Instruction insn(&pages[i], &pages[i] + region.size(), region.start() + i, std::nothrow);
+	// NOTE: through a series of craziness,
+	// yad64::v1::locate_main_function, calls
+	// yad64::v1::primary_code_region, which calls
+	// MemoryRegions::sync()
+	// which happens to invalidate the references to regions we are potentially passed..
+	// so just to be sure, we make a copy! wow, that was an annoying bug!
+	const MemoryRegion region(region_ref);
 
-				if(insn.valid() && insn.type() == yad64::Instruction::OP_CALL) {
+	QSettings settings;
 
-					const yad64::address_t ip = region.start() + i;
-					const yad64::Operand &op = insn.operand(0);
+	AnalysisInput input;
+	input.region    = region;
+	input.page_size = yad64::v1::debugger_core->page_size();
+	input.fuzzy     = settings.value("Analyzer/fuzzy_logic_functions.enabled", true).toBool();
 
-					if(op.general_type() == yad64::Operand::TYPE_REL) {
-						const yad64::address_t ea = op.relative_target();
+	// the entry point
+	if(yad64::address_t entry = module_entry_point(region)) {
 
-						// skip over ones which are : call <label>; label:
-						if(ea != ip + insn.size()) {
-							if(region.contains(ea)) {
-								// avoid calls which land in the middle of a function...
-								// this may or may not be the best approach
-								if(!is_inside_known(region, ea)) {
-									found_functions[ea].entry_address = ea;
-									found_functions[ea].end_address   = ea;
-									found_functions[ea].reference_count++;
-								}
-							}
-						}
-					}
+		// if the entry seems like a relative one (like for a library)
+		// then add the base of its image
+		if(entry < region.start()) {
+			entry += region.start();
+		}
 
-					emit update_progress(util::percentage(6, 10, i, region.size()));
-				}
-			}
+		qDebug("[Analyzer] found entry point: %p", reinterpret_cast<void*>(entry));
+		if(region.contains(entry)) {
+			input.known_functions.append(entry);
 		}
-	} catch(const std::bad_alloc &) {
-		QMessageBox::information(0, tr("Memroy Allocation Error"),
-			tr("Unable to satisfy memory allocation request for requested region."));
 	}
-}
-
-//------------------------------------------------------------------------------
-// Name: is_stack_frame(yad64::address_t addr)
-// Desc:
-//------------------------------------------------------------------------------
-bool Analyzer::is_stack_frame(yad64::address_t addr) const {
 
-	quint8 buf[yad64::Instruction::MAX_SIZE];
-
-	unsigned int i = 0;
-
-	while(i < 2) {
-		// gets the bytes for the instruction
-		int buf_size = sizeof(buf);
-		if(!yad64::v1::get_instruction_bytes(addr, buf, buf_size)) {
-			break;
+	// main
+	const QString s = yad64::v1::debugger_core->process_exe(yad64::v1::debugger_core->pid());
+	if(!s.isEmpty()) {
+		const yad64::address_t main = yad64::v1::locate_main_function();
+		if(main && region.contains(main)) {
+			input.known_functions.append(main);
 		}
+	}
 
-		// decode it
-		const yad64::Instruction insn(buf, buf + buf_size, addr, std::nothrow);
-		if(!insn.valid()) {
-			break;;
+	// marked functions
+	Q_FOREACH(yad64::address_t addr, specified_functions_) {
+		if(region.contains(addr)) {
+			qDebug("[Analyzer] adding: <%p>", reinterpret_cast<void *>(addr));
+			input.known_functions.append(addr);
 		}
+	}
 
-		// which part of the sequence are we looking at?
-		switch(i++) {
-		case 0:
-			// are we looking at a 'push rBP' ?
-			if(insn.type() == yad64::Instruction::OP_PUSH) {
-				Q_ASSERT(insn.operand_count() == 1);
-				const yad64::Operand &op = insn.operand(0);
-				if(op.complete_type() == yad64::Operand::TYPE_REGISTER) {
-					if(op.reg() == FRAME_REG) {
-						break;
-					}
-				}
-			// if it is an 'enter 0,0' instruction, then it's a stack frame right away
-			} else if(insn.type() == yad64::Instruction::OP_ENTER) {
-				Q_ASSERT(insn.operand_count() == 2);
-				const yad64::Operand &op0 = insn.operand(0);
-				const yad64::Operand &op1 = insn.operand(1);
-				if(op0.immediate() == 0 && op1.immediate() == 0) {
-					return true;
-				}
+	// functions with symbols, weak ones only count for functions found by the
+	// fuzzy passes
+	Q_FOREACH(const Symbol::pointer &sym, yad64::v1::symbol_manager().symbols()) {
+		const yad64::address_t addr = sym->address;
+		if(region.contains(addr)) {
+			if(sym->is_code()) {
+				qDebug("[Analyzer] adding: %s <%p>", qPrintable(sym->name), reinterpret_cast<void *>(addr));
+				input.known_functions.append(addr);
 			}
-			++i;
-			break;
-		case 1:
-			// are we looking at a 'mov rBP, rSP' ?
-			if(insn.type() == yad64::Instruction::OP_MOV) {
-				Q_ASSERT(insn.operand_count() == 2);
-				const yad64::Operand &op0 = insn.operand(0);
-				const yad64::Operand &op1 = insn.operand(1);
-				if(op0.complete_type() == yad64::Operand::TYPE_REGISTER && op1.complete_type() == yad64::Operand::TYPE_REGISTER) {
-					if(op0.reg() == FRAME_REG && op1.reg() == STACK_REG) {
-						return true;
-					}
-				}
+
+			if(sym->is_weak()) {
+				input.weak_symbols.insert(addr);
 			}
-			break;
-		default:
-			break;
 		}
-
-		addr += insn.size();
 	}
 
-	return false;
-}
+	// so that the walks can tell which operands point at something, and the
+	// module's read only data so that they can read its jump tables
+	Q_FOREACH(const MemoryRegion &r, yad64::v1::memory_regions().regions()) {
+		input.mapped_regions.push_back(r.start());
+		input.mapped_regions.push_back(r.end());
 
-//------------------------------------------------------------------------------
-// Name: bonus_stack_frames_helper(Function &info) const
-// Desc:
-//------------------------------------------------------------------------------
-void Analyzer::bonus_stack_frames_helper(Function &info) const {
-	if(is_stack_frame(info.entry_address)) {
-		info.reference_count++;
+		if(r != region && !region.name().isEmpty() && r.name() == region.name() && r.readable() && !r.writable() && !r.executable()) {
+			input.data_regions.push_back(r);
+		}
 	}
-}
-
-//------------------------------------------------------------------------------
-// Name: bonus_stack_frames(FunctionMap &results)
-// Desc: give bonus if we see a "push ebp; mov ebp, esp;"
-//------------------------------------------------------------------------------
-void Analyzer::bonus_stack_frames(FunctionMap &results) {
-#ifdef USE_QT_CONCURRENT
-	QtConcurrent::blockingMap(
-		results,
-		boost::bind(&Analyzer::bonus_stack_frames_helper, this, _1));
-#else
-	std::for_each(
-		results.begin(),
-		results.end(),
-		boost::bind(&Analyzer::bonus_stack_frames_helper, this, _1));
-#endif
-}
 
-//------------------------------------------------------------------------------
-// Name: update_results_entry(FunctionMap &results, yad64::address_t address) const
-// Desc:
-//------------------------------------------------------------------------------
-void Analyzer::update_results_entry(FunctionMap &results, yad64::address_t address) const {
-	results[address].entry_address = address;
-	results[address].end_address   = address;
-	
-	if(results[address].reference_count == 0) {
-		results[address].reference_count = MIN_REFCOUNT;
+	QHash<MemoryRegion, RegionInfo>::const_iterator it = analysis_info_.find(region);
+	if(it != analysis_info_.end()) {
+		input.previous_functions   = it->analysis;
+		input.previous_calls       = it->calls;
+		input.previous_graphs      = it->graphs;
+		input.previous_xrefs       = it->xrefs;
+		input.previous_page_hashes = it->page_hashes;
+		input.previous_fuzzy       = it->fuzzy;
 	} else {
-		results[address].reference_count++;
+		input.previous_fuzzy = false;
 	}
+
+	return input;
 }
 
 //------------------------------------------------------------------------------
-// Name: bonus_main(const MemoryRegion &region, FunctionMap &results)
-// Desc:
+// Name: commit_analysis(const AnalysisResult &result)
+// Desc: makes a finished analysis the one used to answer queries, and keeps it
+//       for the next time the region's file is mapped
 //------------------------------------------------------------------------------
-void Analyzer::bonus_main(const MemoryRegion &region, FunctionMap &results) const {
-	const QString s = yad64::v1::debugger_core->process_exe(yad64::v1::debugger_core->pid());
-	if(!s.isEmpty()) {
-		const yad64::address_t main = yad64::v1::locate_main_function();
+void Analyzer::commit_analysis(const AnalysisResult &result) {
 
-		if(main && region.contains(main)) {
-			// make sure we have an entry for this function
-			update_results_entry(results, main);
-		}
+	if(!result.complete || result.unchanged) {
+		return;
 	}
+
+	install_analysis(result);
+	cache_.save(result);
 }
 
 //------------------------------------------------------------------------------
-// Name: bonus_symbols_helper(const MemoryRegion &region, FunctionMap &results, const Symbol::pointer &sym)
+// Name: install_analysis(const AnalysisResult &result)
 // Desc:
 //------------------------------------------------------------------------------
-void Analyzer::bonus_symbols_helper(const MemoryRegion &region, FunctionMap &results, const Symbol::pointer &sym) {
-	const yad64::address_t addr = sym->address;
+void Analyzer::install_analysis(const AnalysisResult &result) {
 
-	if(region.contains(addr) && sym->is_code()) {
-		qDebug("[Analyzer] adding: %s <%p>", qPrintable(sym->name), reinterpret_cast<void *>(addr));
+	RegionInfo &region_info = analysis_info_[result.region];
+	region_info.analysis = result.functions;
 
-		// make sure we have an entry for this function
-		update_results_entry(results, addr);
+	// function lookups (one or more for every line the CPU view paints)
+	// binary search this instead of walking the map
+	region_info.index.clear();
+	region_info.index.reserve(region_info.analysis.size());
+	Q_FOREACH(const Function &function, region_info.analysis) {
+		region_info.index.push_back(function);
 	}
-}
 
+	region_info.calls       = result.calls;
+	region_info.graphs      = result.graphs;
+	region_info.xrefs       = result.xrefs;
+	region_info.page_hashes = result.page_hashes;
+	region_info.fuzzy       = result.fuzzy;
+}
 
 //------------------------------------------------------------------------------
-// Name: bonus_symbols(const MemoryRegion &region, FunctionMap &results)
-// Desc:
+// Name: analysis_job(const QList<MemoryRegion> &regions)
+// Desc: the analysis is taken in once the job is finished, unless the analysis
+//       was invalidated while it ran
 //------------------------------------------------------------------------------
-void Analyzer::bonus_symbols(const MemoryRegion &region, FunctionMap &results) {
+Job *Analyzer::analysis_job(const QList<MemoryRegion> &regions) {
 
-	// give bonus if we have a symbol for the address
-	const QList<Symbol::pointer> symbols = yad64::v1::symbol_manager().symbols();
+	QList<AnalysisInput> inputs;
+	Q_FOREACH(const MemoryRegion &region, regions) {
+		inputs.append(analysis_input(region));
+	}
 
-	std::for_each(
-		symbols.begin(),
-		symbols.end(),
-		boost::bind(&Analyzer::bonus_symbols_helper, this, region, boost::ref(results), _1));
+	Job *const job = new AnalysisJob(inputs, generation_);
+	connect(job, SIGNAL(finished(bool)), this, SLOT(analysis_finished()));
+	return job;
 }
 
 //------------------------------------------------------------------------------
-// Name: bonus_marked_functions(const MemoryRegion &region, FunctionMap &results)
-// Desc:
+// Name: analysis_finished()
+// Desc: a cancelled job still has the regions it did finish
 //------------------------------------------------------------------------------
-void Analyzer::bonus_marked_functions(const MemoryRegion &region, FunctionMap &results) {
-
-	Q_FOREACH(yad64::address_t addr, specified_functions_) {
-		if(region.contains(addr)) {
-
-			qDebug("[Analyzer] adding: <%p>", reinterpret_cast<void *>(addr));
+void Analyzer::analysis_finished() {
+	if(AnalysisJob *const job = dynamic_cast<AnalysisJob *>(sender())) {
+		if(job->generation() == generation_) {
+			Q_FOREACH(const AnalysisResult &result, job->analyses()) {
+				commit_analysis(result);
+			}
+		}
 
-			// make sure we have an entry for this function
-			update_results_entry(results, addr);
+		if(analyzer_widget_) {
+			analyzer_widget_->repaint();
 		}
+
+		yad64::v1::repaint_cpu_view();
 	}
 }
 
 //------------------------------------------------------------------------------
-// Name: walk_all_functions(FunctionMap &results, const MemoryRegion &region, QSet<yad64::address_t> &walked_functions)
-// Desc:
+// Name: analyze(const MemoryRegion &region)
+// Desc: analyzes the region before returning, on this thread
 //------------------------------------------------------------------------------
-int Analyzer::walk_all_functions(FunctionMap &results, const MemoryRegion &region, QSet<yad64::address_t> &walked_functions) {
-	int updates = 0;
-
-	QSet<yad64::address_t> found_functions;
-
-	FunctionMap::iterator it = results.begin();
-	while(it != results.end()) {
-		Function &function = it.value();
-
-		const FunctionMap::iterator next = ++it;
-
-		if(function.reference_count >= MIN_REFCOUNT) {
-			if(!walked_functions.contains(function.entry_address)) {
-
-				// the function's upper bound is either the entry point of the next function
-				// or the region's end which is the absolute max end this function can have
-				const yad64::address_t next_entry = (next != results.end()) ? next.value().entry_address : region.end();
-
-				// walk the function and collect some results
+void Analyzer::analyze(const MemoryRegion &region_ref) {
 
-				find_function_end(function, next_entry, found_functions, results);
-				walked_functions.insert(function.entry_address);
+	QTime t;
+	t.start();
 
-				// if the very last instruction happens to be a jmp, then this may
-				// be a call/ret -> jmp optimization. This isn't always the case
-				// but often enough that it's probably right
-				quint8 buf[yad64::Instruction::MAX_SIZE];
-				int buf_size = sizeof(buf);
-				if(yad64::v1::get_instruction_bytes(function.last_instruction, buf, buf_size)) {
-					const yad64::Instruction insn(buf, buf + buf_size, function.last_instruction, std::nothrow);
-					if(insn.valid() && insn.type() == yad64::Instruction::OP_JMP) {
+	const AnalysisInput input = analysis_input(region_ref);
+	const MemoryRegion &region = input.region;
 
-						Q_ASSERT(insn.operand_count() == 1);
-						const yad64::Operand &op = insn.operand(0);
+	const yad64::address_t size_in_pages = region.size() / input.page_size;
+	try {
+		QVector<quint8> pages(size_in_pages * input.page_size);
 
-						if(op.general_type() == yad64::Operand::TYPE_REL) {
-							const yad64::address_t target = op.relative_target();
+		if(size_in_pages != 0 && yad64::v1::debugger_core->read_pages(region.start(), &pages[0], size_in_pages)) {
 
-							Function func;
-							if(!find_containing_function(target, func)) {
-								found_functions.insert(target);
-							}
-						}
-					}
+			QList<DataSnapshot> data;
+			Q_FOREACH(const MemoryRegion &r, input.data_regions) {
+				DataSnapshot snapshot;
+				snapshot.start = r.start();
+				snapshot.bytes.resize((r.size() / input.page_size) * input.page_size);
+				if(!snapshot.bytes.isEmpty() && yad64::v1::debugger_core->read_pages(r.start(), &snapshot.bytes[0], r.size() / input.page_size)) {
+					data.push_back(snapshot);
 				}
 			}
-		}
-
-		it = next;
-	}
 
-	// add the newly found functions to the list and report the number of "updates"
-	Q_FOREACH(yad64::address_t func, found_functions) {
-		if(!results.contains(func)) {
-			results[func].entry_address   = func;
-			results[func].end_address     = func;
-			results[func].reference_count = MIN_REFCOUNT;
-			++updates;
+			RegionAnalysis analysis(input, pages, data);
+			analysis.run(boost::bind(&Analyzer::update_progress, this, _1), never_cancelled);
+
+			AnalysisResult result;
+			result.region      = region;
+			result.functions   = analysis.functions();
+			result.calls       = analysis.calls();
+			result.graphs      = analysis.graphs();
+			result.xrefs       = analysis.xrefs();
+			result.page_hashes = analysis.page_hashes();
+			result.fuzzy       = input.fuzzy;
+			result.complete    = true;
+			result.unchanged   = analysis.unchanged();
+			result.from_file   = !result.unchanged && AnalysisCache::cacheable(region) && AnalysisCache::matches_file(region, input.page_size, result.page_hashes);
+
+			commit_analysis(result);
+			qDebug("[Analyzer] complete");
+
+			if(analyzer_widget_) {
+				analyzer_widget_->repaint();
+			}
 		}
+	} catch(const std::bad_alloc &) {
+		QMessageBox::information(0, tr("Memroy Allocation Error"),
+			tr("Unable to satisfy memory allocation request for requested region."));
 	}
 
-	return updates;
+	emit update_progress(100);
+	qDebug("[Analyzer] elapsed: %d ms", t.elapsed());
 }
 
 //------------------------------------------------------------------------------
-// Name: fix_overlaps(FunctionMap &function_map)
-// Desc: ensures that no function overlaps another
+// Name: category(yad64::address_t address) const
+// Desc:
 //------------------------------------------------------------------------------
-void Analyzer::fix_overlaps(FunctionMap &function_map) {
-	for(FunctionMap::iterator it = function_map.begin(); it != function_map.end(); ) {
-		Function &func = *it++;
-		if(it != function_map.end()) {
-			const Function &next_func = *it;
-			if(next_func.entry_address <= func.end_address) {
-				func.end_address = next_func.entry_address - 1;
-			}
-		}
+IAnalyzer::AddressCategory Analyzer::category(yad64::address_t address) const {
+	if(const Function *const func = find_function(address)) {
+		return category_in(*func, address);
 	}
+	return ADDRESS_FUNC_UNKNOWN;
 }
 
 //------------------------------------------------------------------------------
-// Name: find_function_end(Function &function, yad64::address_t end_address, QSet<yad64::address_t> &found_functions, const FunctionMap &results)
-// Desc:
+// Name: categories(yad64::address_t start, yad64::address_t end) const
+// Desc: classifies every address in [start, end) with one search per region,
+//       after which the functions are simply walked in order
 //------------------------------------------------------------------------------
-void Analyzer::find_function_end(Function &function, yad64::address_t end_address, QSet<yad64::address_t> &found_functions, const FunctionMap &results) {
-
-	QStack<yad64::address_t>		jump_targets;
-	QHash<yad64::address_t, int>	visited_addresses;
+QVector<IAnalyzer::AddressCategory> Analyzer::categories(yad64::address_t start, yad64::address_t end) const {
 
-	// we start with the entry point of the function
-	jump_targets.push(function.entry_address);
+	QVector<AddressCategory> ret(end > start ? end - start : 0, ADDRESS_FUNC_UNKNOWN);
 
-	// while no more jump targets... (includes entry point)
-	while(!jump_targets.empty()) {
-	
-		yad64::address_t addr = jump_targets.pop();
-
-		// for certain forward jump scenarioes this is possible.
-		if(visited_addresses.contains(addr)) {
+	yad64::address_t address = start;
+	while(address < end) {
+		const MemoryRegion *const region = yad64::v1::memory_regions().lookup(address);
+		if(!region) {
+			++address;
 			continue;
 		}
 
-		// keep going until we go out of bounds
-		while(addr >= function.entry_address && addr < end_address) {
+		const yad64::address_t region_end = qMax(address + 1, qMin(end, region->end()));
 
-			quint8 buf[yad64::Instruction::MAX_SIZE];
-			int buf_size = sizeof(buf);
-			if(!yad64::v1::get_instruction_bytes(addr, buf, buf_size)) {
-				break;
-			}
+		if(const RegionInfo *const info = region_info(address)) {
+			const QVector<Function> &index = info->index;
 
-			// an invalid instruction ends this "block"
-			const yad64::Instruction insn(buf, buf + buf_size, addr, std::nothrow);
-			if(!insn.valid()) {
-				break;
+			QVector<Function>::const_iterator it = qUpperBound(index.begin(), index.end(), address, entry_less);
+			if(it != index.begin()) {
+				--it;
 			}
 
-			// ok, it was a valid instruction, let's add it to the
-			// list of possible 'code addresses'
-			visited_addresses.insert(addr, insn.size());
-
-			const yad64::Instruction::Type type = insn.type();
-
-			if(type == yad64::Instruction::OP_RET || type == yad64::Instruction::OP_HLT) {
-				// instructions that clearly terminate the current block...
-				break;
-				
-			} else if(type == yad64::Instruction::OP_JCC) {
-
-				// note if neccessary the Jcc target and move on, yes this can be fooled by "conditional"
-				// jumps which are always true or false, not much we can do about it at this level.
-				const yad64::Operand &op = insn.operand(0);
-				if(op.general_type() == yad64::Operand::TYPE_REL) {
-					const yad64::address_t ea = op.relative_target();
-
-					if(!visited_addresses.contains(ea) && !jump_targets.contains(ea)) {
-						jump_targets.push(ea);
-					}
-				}
-			} else if(type == yad64::Instruction::OP_CALL) {
-
-
-				// similar to above, note the destination and move on
-				// we special case simple things for speed.
-				// also this is an opportunity to find call tables.
-				const yad64::Operand &op = insn.operand(0);
-				if(op.general_type() == yad64::Operand::TYPE_REL) {
-					const yad64::address_t ea = op.relative_target();
-
-					// skip over ones which are: "call <label>; label:"
-					if(ea != addr + insn.size()) {
-						found_functions.insert(ea);
-					}
-				} else if(op.general_type() == yad64::Operand::TYPE_EXPRESSION) {
-					// looks like: "call [...]", if it is of the form, call [C + REG]
-					// then it may be a jump table using REG as an offset
-				}
-			} else if(type == yad64::Instruction::OP_JMP) {
-
-				const yad64::Operand &op = insn.operand(0);
-				if(op.general_type() == yad64::Operand::TYPE_REL) {
-					const yad64::address_t ea = op.relative_target();
-
-
-					// an absolute jump within this function
-					if(ea >= function.entry_address && ea < addr) {
-						addr += insn.size();
-						continue;
-					}
-
-
-					// is it a jump to another function's entry point?
-					// if so, this is a dead end, resume from other branches
-					// but give the target a bonus reference
-					FunctionMap::const_iterator it = results.find(ea);
-					if(it != results.end()) {
-						found_functions.insert(ea);
-						break;
-					}
-
-#if 0
-					// ok, it is a jmp to an address we haven't seen yet
-					// so just continue processing from there
-					if(!visited_addresses.contains(ea)) {
-						addr = ea;
-						continue;
-					} else {
-						break;
-					}
-#else
-					break;
-#endif
+			for(; it != index.end() && it->entry_address < region_end; ++it) {
+				const yad64::address_t first = qMax(it->entry_address, address);
+				const yad64::address_t last  = qMin(it->end_address, region_end - 1);
+				for(yad64::address_t a = first; a <= last; ++a) {
+					ret[a - start] = category_in(*it, a);
 				}
 			}
-
-			addr += insn.size();
 		}
-	}
-
-	function.last_instruction = function.entry_address;
-	function.end_address      = function.entry_address;
 
-	// get the last instruction and the last byte of the function
-	for(QHash<yad64::address_t, int>::const_iterator it = visited_addresses.begin(); it != visited_addresses.end(); ++it) {
-		function.end_address      = qMax(function.end_address,      it.key() + it.value() - 1);
-		function.last_instruction = qMax(function.last_instruction, it.key());
-	}
-}
-
-//------------------------------------------------------------------------------
-// Name: is_thunk(yad64::address_t address)
-// Desc: basically returns true if the first instruction of the function is a
-//       jmp
-//------------------------------------------------------------------------------
-bool Analyzer::is_thunk(yad64::address_t address) const {
-	quint8 buf[yad64::Instruction::MAX_SIZE];
-	int buf_size = sizeof(buf);
-	if(yad64::v1::get_instruction_bytes(address, buf, buf_size)) {
-		const yad64::Instruction insn(buf, buf + buf_size, address, std::nothrow);
-		return insn.valid() && insn.type() == yad64::Instruction::OP_JMP;
+		address = region_end;
 	}
 
-	return false;
-}
-
-//------------------------------------------------------------------------------
-// Name: set_function_types_helper(Function &info) const
-// Desc:
-//------------------------------------------------------------------------------
-void Analyzer::set_function_types_helper(Function &info) const {
-
-	if(is_thunk(info.entry_address)) {
-		info.type = Function::FUNCTION_THUNK;
-	} else {
-		info.type = Function::FUNCTION_STANDARD;
-	}
-}
-
-//------------------------------------------------------------------------------
-// Name: set_function_types(FunctionMap &results)
-// Desc:
-//------------------------------------------------------------------------------
-void Analyzer::set_function_types(FunctionMap &results) {
-	// give bonus if we have a symbol for the address
-#ifdef USE_QT_CONCURRENT
-	QtConcurrent::blockingMap(
-		results,
-		boost::bind(&Analyzer::set_function_types_helper, this, _1));
-#else
-	std::for_each(
-		results.begin(),
-		results.end(),
-		boost::bind(&Analyzer::set_function_types_helper, this, _1));
-#endif
-}
-
-//------------------------------------------------------------------------------
-// Name: is_inside_known(const MemoryRegion &region, yad64::address_t address)
-// Desc:
-//------------------------------------------------------------------------------
-bool Analyzer::is_inside_known(const MemoryRegion &region, yad64::address_t address) {
-
-	const FunctionMap &funcs = functions(region);
-	Q_FOREACH(const Function &func, funcs) {
-		if(address >= func.entry_address && address <= func.end_address) {
-			return true;
-		}
-	}
-
-	return false;
+	return ret;
 }
 
 //------------------------------------------------------------------------------
-// Name: find_calls_from_known(const MemoryRegion &region, FunctionMap &results, QSet<yad64::address_t> &walked_functions)
+// Name: functions(const MemoryRegion &region) const
 // Desc:
 //------------------------------------------------------------------------------
-void Analyzer::find_calls_from_known(const MemoryRegion &region, FunctionMap &results, QSet<yad64::address_t> &walked_functions) {
-	int updates;
-	do {
-		updates = walk_all_functions(results, region, walked_functions);
-		qDebug() << "[Analyzer] got" << updates << "updates";
-	} while(updates != 0);
+IAnalyzer::FunctionMap Analyzer::functions(const MemoryRegion &region) const {
+	return analysis_info_[region].analysis;
 }
 
 //------------------------------------------------------------------------------
-// Name: collect_high_ref_results(FunctionMap &function_map, FunctionMap &found_functions) const
-// Desc:
+// Name: control_flow_graph(yad64::address_t address) const
+// Desc: returns the graph of the function containing address, which is empty
+//       if there is no such function or it wasn't walked
 //------------------------------------------------------------------------------
-void Analyzer::collect_high_ref_results(FunctionMap &function_map, FunctionMap &found_functions) const {
-	for(FunctionMap::iterator it = found_functions.begin(); it != found_functions.end(); ) {
-		if(it->reference_count >= MIN_REFCOUNT) {
-			function_map[it->entry_address] = *it;
-			found_functions.erase(it++);
-		} else {
-			++it;
+ControlFlowGraph Analyzer::control_flow_graph(yad64::address_t address) const {
+	if(const Function *const function = find_function(address)) {
+		if(const RegionInfo *const info = region_info(address)) {
+			return info->graphs.value(function->entry_address);
 		}
 	}
+	return ControlFlowGraph();
 }
 
 //------------------------------------------------------------------------------
-// Name: 
-// Desc:
+// Name: references_to(yad64::address_t address) const
+// Desc: one binary search in each analyzed region
 //------------------------------------------------------------------------------
-void Analyzer::collect_low_ref_results(const MemoryRegion &region, FunctionMap &function_map, FunctionMap &found_functions) {
-	// promote weak symbols...
-	ISymbolManager &syms = yad64::v1::symbol_manager();
-	Q_FOREACH(const Function &func, found_functions) {
-		if(!is_inside_known(region, func.entry_address)) {
-			if(!function_map.contains(func.entry_address)) {
-				function_map[func.entry_address] = func;
-
-				const Symbol::pointer s = syms.find(func.entry_address);
-				if(s && s->is_weak()) {
-					function_map[func.entry_address].reference_count++;
-				}
+QVector<XrefIndex::Xref> Analyzer::references_to(yad64::address_t address) const {
 
-			}
-		}
+	QVector<XrefIndex::Xref> ret;
+	Q_FOREACH(const RegionInfo &info, analysis_info_) {
+		ret += info.xrefs.references_to(address);
 	}
-}
-
-//------------------------------------------------------------------------------
-// Name: 
-// Desc:
-//------------------------------------------------------------------------------
-void Analyzer::indent_header() {
 
+	qSort(ret.begin(), ret.end(), from_less);
+	return ret;
 }
 
 //------------------------------------------------------------------------------
-// Name: analyze(const MemoryRegion &region)
-// Desc:
-//------------------------------------------------------------------------------
-void Analyzer::analyze(const MemoryRegion &region_ref) {
-
-	QTime t;
-	t.start();
-
-	// NOTE: through a series of craziness,
-	// bonus_main, calls
-	// yad64::v1::locate_main_function, which calls
-	// yad64::v1::primary_code_region, which calls
-	// MemoryRegions::sync()
-	// which happens to invalidate the references to regions we are potentially passed..
-	// so just to be sure, we make a copy! wow, that was an annoying bug!
-	MemoryRegion region(region_ref);
-
-	RegionInfo &region_info = analysis_info_[region];
-
-	QSettings settings;
-	const bool fuzzy          = settings.value("Analyzer/fuzzy_logic_functions.enabled", true).toBool();
-	const QByteArray md5      = md5_region(region);
-	const QByteArray prev_md5 = region_info.md5;
-	
-	if(md5 != prev_md5 || fuzzy != region_info.fuzzy) {
-		FunctionMap &function_map = region_info.analysis;
-		function_map.clear();
-		
-		QSet<yad64::address_t> walked_functions;
-		FunctionMap          found_functions;
-		
-		const struct {
-			const char             *message;
-			boost::function<void()> function;
-		} analysis_steps[] = {
-			{ "identifying executable headers...",                       boost::bind(&Analyzer::indent_header,          this) },
-			{ "adding entry points to the list...", 					 boost::bind(&Analyzer::bonus_entry_point,      this, boost::cref(region), boost::ref(function_map)) },
-			{ "attempting to add 'main' to the list...",				 boost::bind(&Analyzer::bonus_main,             this, boost::cref(region), boost::ref(function_map)) },
-			{ "attempting to add marked functions to the list...",  	 boost::bind(&Analyzer::bonus_marked_functions, this, boost::cref(region), boost::ref(function_map)) },
-			{ "attempting to add functions with symbols to the list...", boost::bind(&Analyzer::bonus_symbols,          this, boost::cref(region), boost::ref(function_map)) },
-			{ "calculating function bounds... (pass 1)",                 boost::bind(&Analyzer::find_calls_from_known,  this, boost::cref(region), boost::ref(function_map), boost::ref(walked_functions)) },
-		};		
-		
-		const struct {
-			const char             *message;
-			boost::function<void()> function;
-		} fuzzy_analysis_steps[] = {
-			{ "finding possible function calls...",      boost::bind(&Analyzer::find_function_calls,      this, boost::cref(region), boost::ref(found_functions)) },
-			{ "bonusing stack frames...",                boost::bind(&Analyzer::bonus_stack_frames,       this, boost::ref(found_functions)) },
-			{ "collecting high reference answers...",    boost::bind(&Analyzer::collect_high_ref_results, this, boost::ref(function_map), boost::ref(found_functions)) },
-			{ "calculating function bounds... (pass 2)", boost::bind(&Analyzer::find_calls_from_known,    this, boost::cref(region), boost::ref(function_map), boost::ref(walked_functions)) },
-			{ "collecting low reference answers...",     boost::bind(&Analyzer::collect_low_ref_results,  this, boost::cref(region), boost::ref(function_map), boost::ref(found_functions)) },
-			{ "calculating function bounds... (pass 3)", boost::bind(&Analyzer::find_calls_from_known,    this, boost::cref(region), boost::ref(function_map), boost::ref(walked_functions)) },
-		};
-		
-		const int analysis_steps_count       = sizeof(analysis_steps) / sizeof(analysis_steps[0]);
-		const int fuzzy_analysis_steps_count = sizeof(fuzzy_analysis_steps) / sizeof(fuzzy_analysis_steps[0]);
-		const int total_steps = analysis_steps_count + fuzzy_analysis_steps_count + 1;
-		
-		emit update_progress(util::percentage(0, total_steps));
-		for(int i = 0; i < analysis_steps_count; ++i) {
-			qDebug("[Analyzer] %s", analysis_steps[i].message);
-			analysis_steps[i].function();
-			emit update_progress(util::percentage(i + 1, total_steps));
-		}
-		
-		fix_overlaps(function_map);
-
-		// ok, at this point, we've done the best we can with knowns
-		// we should have a full analysis of all functions which are
-		// reachable from known entry points in the code
-		// let's start looking for unknowns
-		if(fuzzy) {
-			for(int i = 0; i < fuzzy_analysis_steps_count; ++i) {
-				qDebug("[Analyzer] %s", fuzzy_analysis_steps[i].message);
-				fuzzy_analysis_steps[i].function();
-				emit update_progress(util::percentage(analysis_steps_count + i + 1, total_steps));
-			}
-		}
-
-		qDebug("[Analyzer] determining function types...");
-		set_function_types(function_map);
-
-		qDebug("[Analyzer] complete");
-		emit update_progress(100);
-		
-		if(analyzer_widget_) {
-			analyzer_widget_->repaint();
-		}
-
-		region_info.md5   = md5;
-		region_info.fuzzy = fuzzy;
-	} else {
-		qDebug("[Analyzer] region unchanged, using previous analysis");
-	}
-
-	qDebug("[Analyzer] elapsed: %d ms", t.elapsed());
-}
-
-//------------------------------------------------------------------------------
-// Name: category(yad64::address_t address) const
+// Name: find_containing_function(yad64::address_t address, IAnalyzer::Function &function) const
 // Desc:
 //------------------------------------------------------------------------------
-IAnalyzer::AddressCategory Analyzer::category(yad64::address_t address) const {
-
-	Function func;
-	if(find_containing_function(address, func)) {
-		if(address == func.entry_address) {
-			return ADDRESS_FUNC_START;
-		} else if(address == func.end_address) {
-			return ADDRESS_FUNC_END;
-		} else {
-			return ADDRESS_FUNC_BODY;
-		}
+bool Analyzer::find_containing_function(yad64::address_t address, IAnalyzer::Function &function) const {
+	if(const Function *const f = find_function(address)) {
+		function = *f;
+		return true;
 	}
-	return ADDRESS_FUNC_UNKNOWN;
-}
-
-//------------------------------------------------------------------------------
-// Name: functions(const MemoryRegion &region) const
-// Desc:
-//------------------------------------------------------------------------------
-IAnalyzer::FunctionMap Analyzer::functions(const MemoryRegion &region) const {
-	return analysis_info_[region].analysis;
+	return false;
 }
 
 //------------------------------------------------------------------------------
-// Name: find_containing_function(yad64::address_t address, IAnalyzer::Function &function) const
-// Desc:
+// Name: region_info(yad64::address_t address) const
+// Desc: returns the analysis of the region containing address, if there is one
 //------------------------------------------------------------------------------
-bool Analyzer::find_containing_function(yad64::address_t address, IAnalyzer::Function &function) const {
-
-	MemoryRegion region;
-	if(yad64::v1::memory_regions().find_region(address, region)) {
-		const FunctionMap &funcs = functions(region);
-		Q_FOREACH(const Function &f, funcs) {
-			if(address >= f.entry_address && address <= f.end_address) {
-				function = f;
-				return true;
-			}
+const Analyzer::RegionInfo *Analyzer::region_info(yad64::address_t address) const {
+	if(const MemoryRegion *const region = yad64::v1::memory_regions().lookup(address)) {
+		QHash<MemoryRegion, RegionInfo>::const_iterator it = analysis_info_.find(*region);
+		if(it != analysis_info_.end()) {
+			return &it.value();
 		}
 	}
-	return false;
+	return 0;
 }
 
 //------------------------------------------------------------------------------
-// Name: md5_region(const MemoryRegion &region) const
-// Desc: returns a byte array representing the MD5 of a region
+// Name: find_function(yad64::address_t address) const
+// Desc: returns the function containing address, or NULL
+// Note: fix_overlaps makes sure functions don't overlap, so the last one
+//       starting at or before address is the only one which can contain it
 //------------------------------------------------------------------------------
-QByteArray Analyzer::md5_region(const MemoryRegion &region) const{
-
-	static const yad64::address_t page_size = yad64::v1::debugger_core->page_size();
+const IAnalyzer::Function *Analyzer::find_function(yad64::address_t address) const {
+	if(const RegionInfo *const info = region_info(address)) {
+		const QVector<Function> &index = info->index;
 
-	const yad64::address_t size_in_pages = region.size() / page_size;
-	try {
-		QVector<quint8> pages(size_in_pages * page_size);
-
-		if(yad64::v1::debugger_core->read_pages(region.start(), &pages[0], size_in_pages)) {
-			return yad64::v1::get_md5(&pages[0], size_in_pages * page_size);
+		QVector<Function>::const_iterator it = qUpperBound(index.begin(), index.end(), address, entry_less);
+		if(it != index.begin() && address <= (--it)->end_address) {
+			return &*it;
 		}
-
-	} catch(const std::bad_alloc &) {
-		QMessageBox::information(0, tr("Memroy Allocation Error"),
-			tr("Unable to satisfy memory allocation request for requested region."));
 	}
-
-	return QByteArray();
+	return 0;
 }
 
 //------------------------------------------------------------------------------
@@ -991,29 +731,6 @@ yad64::address_t Analyzer::module_entry_point(const MemoryRegion &region) const
 }
 
 
-//------------------------------------------------------------------------------
-// Name: bonus_entry_point(const MemoryRegion &region, FunctionMap &results) const
-// Desc:
-//------------------------------------------------------------------------------
-void Analyzer::bonus_entry_point(const MemoryRegion &region, FunctionMap &results) const {
-
-	if(yad64::address_t entry = module_entry_point(region)) {
-
-		// if the entry seems like a relative one (like for a library)
-		// then add the base of its image
-		if(entry < region.start()) {
-			entry += region.start();
-		}
-		
-		qDebug("[Analyzer] found entry point: %p", reinterpret_cast<void*>(entry));
-
-		// make sure we have an entry for this function
-		if(region.contains(entry)) {
-			update_results_entry(results, entry);
-		}
-	}
-}
-
 //------------------------------------------------------------------------------
 // Name: invalidate_analysis(const MemoryRegion &region)
 // Desc:
@@ -1032,6 +749,7 @@ void Analyzer::invalidate_analysis(const MemoryRegion &region) {
 // Desc:
 //------------------------------------------------------------------------------
 void Analyzer::invalidate_dynamic_analysis(const MemoryRegion &region) {
+	++generation_;
 	analysis_info_[region] = RegionInfo();
 }
 
@@ -1040,8 +758,14 @@ void Analyzer::invalidate_dynamic_analysis(const MemoryRegion &region) {
 // Desc:
 //------------------------------------------------------------------------------
 void Analyzer::invalidate_analysis() {
+	++generation_;
 	analysis_info_.clear();
 	specified_functions_.clear();
+
+	// what was analyzed in an earlier process is still good for the same files
+	Q_FOREACH(const MemoryRegion &region, yad64::v1::memory_regions().regions()) {
+		load_cached_analysis(region);
+	}
 }
 
 Q_EXPORT_PLUGIN2(Analyzer, Analyzer)
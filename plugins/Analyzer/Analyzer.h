@@ -19,17 +19,21 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifndef ANALYZER_20080630_H_
 #define ANALYZER_20080630_H_
 
+#include "AnalysisCache.h"
 #include "IAnalyzer.h"
 #include "IPlugin.h"
 #include "MemoryRegion.h"
-#include "Symbol.h"
+#include "RegionAnalysis.h"
 #include "Types.h"
 #include <QSet>
 #include <QMap>
 #include <QHash>
+#include <QVector>
 
 class QMenu;
+class QModelIndex;
 class AnalyzerWidget;
+class DialogXrefs;
 
 class Analyzer : public QObject, public IAnalyzer, public IPlugin {
 	Q_OBJECT
@@ -52,38 +56,24 @@ public:
 	virtual void analyze(const MemoryRegion &region);
 	virtual FunctionMap functions(const MemoryRegion &region) const;
 	virtual AddressCategory category(yad64::address_t address) const;
+	virtual QVector<AddressCategory> categories(yad64::address_t start, yad64::address_t end) const;
 	virtual void invalidate_analysis(const MemoryRegion &region);
 	virtual void invalidate_analysis();
 	virtual QSet<yad64::address_t> specified_functions() const { return specified_functions_; }
+	virtual Job *analysis_job(const QList<MemoryRegion> &regions);
+	virtual ControlFlowGraph control_flow_graph(yad64::address_t address) const;
+	virtual QVector<XrefIndex::Xref> references_to(yad64::address_t address) const;
 
 private:
-	void indent_header();
-	void bonus_stack_frames_helper(Function &info) const;
-	void bonus_stack_frames(FunctionMap &results);
-	void bonus_marked_functions(const MemoryRegion &region, FunctionMap &results);
-	void bonus_symbols(const MemoryRegion &region, FunctionMap &results);
-	void bonus_symbols_helper(const MemoryRegion &region, FunctionMap &results, const Symbol::pointer &sym);
-	void bonus_entry_point(const MemoryRegion &region, FunctionMap &results) const;
-	void bonus_main(const MemoryRegion &region, FunctionMap &results) const;
-
-private:
-	QByteArray md5_region(const MemoryRegion &region) const;
+	AnalysisInput analysis_input(const MemoryRegion &region) const;
+	void commit_analysis(const AnalysisResult &result);
+	void install_analysis(const AnalysisResult &result);
+	void load_cached_analysis(const MemoryRegion &region);
 	bool find_containing_function(yad64::address_t address, Function &function) const;
-	bool is_inside_known(const MemoryRegion &region, yad64::address_t address);
-	bool is_stack_frame(yad64::address_t address) const;
-	bool is_thunk(yad64::address_t address) const;
+	const Function *find_function(yad64::address_t address) const;
 	yad64::address_t module_entry_point(const MemoryRegion &region) const;
-	int walk_all_functions(FunctionMap &results, const MemoryRegion &region, QSet<yad64::address_t> &walked_functions);
-	void find_calls_from_known(const MemoryRegion &region, FunctionMap &results, QSet<yad64::address_t> &walked_functions);
-	void find_function_calls(const MemoryRegion &region, FunctionMap &results);
-	void find_function_end(Function &function, yad64::address_t end_address, QSet<yad64::address_t> &found_functions, const FunctionMap &results);
-	void fix_overlaps(FunctionMap &function_map);
 	void invalidate_dynamic_analysis(const MemoryRegion &region);
-	void set_function_types(FunctionMap &results);
-	void set_function_types_helper(Function &info) const;
-	void update_results_entry(FunctionMap &results, yad64::address_t address) const;
-	void collect_high_ref_results(FunctionMap &function_map, FunctionMap &found_functions) const;
-	void collect_low_ref_results(const MemoryRegion &region, FunctionMap &function_map, FunctionMap &found_functions);
+	DialogXrefs *references_dialog();
 
 Q_SIGNALS:
 	void update_progress(int);
@@ -95,21 +85,35 @@ public Q_SLOTS:
 	void goto_function_end();
 	void mark_function_start();
 	void show_specified();
+	void show_references();
+	void show_selected_references();
+
+private Q_SLOTS:
+	void analysis_finished();
+	void regions_added(const QModelIndex &parent, int first, int last);
 
 private:
 	void do_analysis(const MemoryRegion &region);
 
 private:
 	struct RegionInfo {
-		FunctionMap analysis;
-		QByteArray  md5;
-		bool        fuzzy;
+		FunctionMap       analysis;
+		QVector<Function> index;       // analysis, flattened and sorted by entry address
+		CallMap           calls;
+		GraphMap          graphs;
+		XrefIndex         xrefs;
+		QVector<quint64>  page_hashes; // of the bytes analyzed, to see what changed since
+		bool              fuzzy;
 	};
 
+	const RegionInfo *region_info(yad64::address_t address) const;
+
 	QMenu *                      menu_;
 	QHash<MemoryRegion, RegionInfo> analysis_info_;
+	AnalysisCache                  cache_;
 	QSet<yad64::address_t>         specified_functions_;
 	AnalyzerWidget *             analyzer_widget_;
+	int                          generation_; // bumped whenever an analysis is thrown away
 };
 
 #endif
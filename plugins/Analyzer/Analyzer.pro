@@ -1,8 +1,10 @@
 
 include(../plugins.pri)
 
+DEFINES += USE_QT_CONCURRENT
+
 # Input
-HEADERS += Analyzer.h AnalyzerWidget.h AnalyzerOptionsPage.h DialogSpecifiedFunctions.h
-FORMS += analyzer_options_page.ui dialogspecified.ui
-SOURCES += Analyzer.cpp AnalyzerWidget.cpp AnalyzerOptionsPage.cpp DialogSpecifiedFunctions.cpp
+HEADERS += AnalysisCache.h AnalysisJob.h Analyzer.h AnalyzerWidget.h AnalyzerOptionsPage.h DialogSpecifiedFunctions.h DialogXrefs.h FastHash.h ParallelFor.h RegionAnalysis.h
+FORMS += analyzer_options_page.ui dialogspecified.ui dialogxrefs.ui
+SOURCES += AnalysisCache.cpp AnalysisJob.cpp Analyzer.cpp AnalyzerWidget.cpp AnalyzerOptionsPage.cpp DialogSpecifiedFunctions.cpp DialogXrefs.cpp RegionAnalysis.cpp
 
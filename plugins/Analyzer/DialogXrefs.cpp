@@ -0,0 +1,108 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "DialogXrefs.h"
+#include "Debugger.h"
+#include "IAnalyzer.h"
+#include "ResultsModel.h"
+#include "ResultsView.h"
+
+#include "ui_dialogxrefs.h"
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Name: kind_name(XrefIndex::Kind kind)
+// Desc:
+//------------------------------------------------------------------------------
+QString kind_name(XrefIndex::Kind kind) {
+	switch(kind) {
+	case XrefIndex::XREF_CALL:      return DialogXrefs::tr("call");
+	case XrefIndex::XREF_JUMP:      return DialogXrefs::tr("jump");
+	case XrefIndex::XREF_DATA:      return DialogXrefs::tr("data");
+	case XrefIndex::XREF_IMMEDIATE: return DialogXrefs::tr("immediate");
+	default:
+		return QString();
+	}
+}
+
+}
+
+//------------------------------------------------------------------------------
+// Name: DialogXrefs(QWidget *parent)
+// Desc: constructor
+//------------------------------------------------------------------------------
+DialogXrefs::DialogXrefs(QWidget *parent) : QDialog(parent), ui(new Ui::DialogXrefs) {
+	ui->setupUi(this);
+}
+
+//------------------------------------------------------------------------------
+// Name: ~DialogXrefs()
+// Desc:
+//------------------------------------------------------------------------------
+DialogXrefs::~DialogXrefs() {
+	delete ui;
+}
+
+//------------------------------------------------------------------------------
+// Name: find_references(yad64::address_t address)
+// Desc: the references come from the analyzer's index, so this doesn't have to
+//       read any memory
+//------------------------------------------------------------------------------
+void DialogXrefs::find_references(yad64::address_t address) {
+
+	ui->txtAddress->setText(yad64::v1::format_pointer(address));
+	ui->results->model()->clear();
+
+	IAnalyzer *const analyzer = yad64::v1::analyzer();
+	if(!analyzer) {
+		return;
+	}
+
+	ResultStore found;
+	Q_FOREACH(const XrefIndex::Xref &xref, analyzer->references_to(address)) {
+		const QString text = QString("%1 %2")
+			.arg(kind_name(xref.kind), -9)
+			.arg(yad64::v1::find_function_symbol(xref.from, yad64::v1::format_pointer(xref.from)));
+
+		found.append(xref.from, text, 1u << xref.kind);
+	}
+
+	ui->results->model()->append(found);
+}
+
+//------------------------------------------------------------------------------
+// Name: on_btnFind_clicked()
+// Desc: find button event handler
+//------------------------------------------------------------------------------
+void DialogXrefs::on_btnFind_clicked() {
+
+	// a bad expression has already been reported
+	yad64::address_t address;
+	if(yad64::v1::eval_expression(ui->txtAddress->text(), address)) {
+		find_references(address);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: on_results_doubleClicked(const QModelIndex &index)
+// Desc: follows the found item in the cpu view
+//------------------------------------------------------------------------------
+void DialogXrefs::on_results_doubleClicked(const QModelIndex &index) {
+	yad64::v1::jump_to_address(ui->results->model()->address(index));
+}
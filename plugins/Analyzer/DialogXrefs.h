@@ -0,0 +1,47 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef DIALOGXREFS_20121017_H_
+#define DIALOGXREFS_20121017_H_
+
+#include "Types.h"
+#include <QDialog>
+
+class QModelIndex;
+
+namespace Ui { class DialogXrefs; }
+
+class DialogXrefs : public QDialog {
+	Q_OBJECT
+
+public:
+	DialogXrefs(QWidget *parent = 0);
+	virtual ~DialogXrefs();
+
+public:
+	void find_references(yad64::address_t address);
+
+public Q_SLOTS:
+	void on_btnFind_clicked();
+	void on_results_doubleClicked(const QModelIndex &index);
+
+private:
+	 Ui::DialogXrefs *const ui;
+};
+
+#endif
@@ -0,0 +1,67 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef FAST_HASH_20121017_H_
+#define FAST_HASH_20121017_H_
+
+#include <QtGlobal>
+#include <cstring>
+
+namespace fast_hash {
+
+//------------------------------------------------------------------------------
+// Name: rotate(quint64 x, int n)
+// Desc:
+//------------------------------------------------------------------------------
+inline quint64 rotate(quint64 x, int n) {
+	return (x << n) | (x >> (64 - n));
+}
+
+//------------------------------------------------------------------------------
+// Name: hash(const void *data, std::size_t n)
+// Desc: a fast non-cryptographic hash, all it has to do is notice that some
+//       bytes changed. it works on four independent lanes of 8 bytes so that
+//       the multiplies don't wait on each other
+//------------------------------------------------------------------------------
+inline quint64 hash(const void *data, std::size_t n) {
+	const quint8 *const p = static_cast<const quint8 *>(data);
+	const quint64       k = Q_UINT64_C(0x9e3779b97f4a7c15);
+
+	quint64 h[4] = { n, k, ~quint64(n), ~k };
+
+	std::size_t i = 0;
+	for(; i + 32 <= n; i += 32) {
+		for(int lane = 0; lane < 4; ++lane) {
+			quint64 w;
+			std::memcpy(&w, p + i + lane * 8, sizeof(w));
+			h[lane] = (h[lane] ^ w) * k;
+			h[lane] ^= h[lane] >> 29;
+		}
+	}
+
+	quint64 r = h[0] ^ rotate(h[1], 17) ^ rotate(h[2], 31) ^ rotate(h[3], 47);
+	for(; i < n; ++i) {
+		r = (r ^ p[i]) * k;
+	}
+
+	return r ^ (r >> 32);
+}
+
+}
+
+#endif
@@ -0,0 +1,113 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PARALLEL_FOR_20121017_H_
+#define PARALLEL_FOR_20121017_H_
+
+#include <QAtomicInt>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QRunnable>
+#include <QSharedPointer>
+#include <QThread>
+#include <QThreadPool>
+#include <QWaitCondition>
+
+namespace parallel {
+
+// a list of count items which any number of threads take items from, one at a
+// time, until there are none left
+struct WorkList {
+	explicit WorkList(int count) : count(count), next(0), remaining(count) {
+	}
+
+	const int      count;
+	QAtomicInt     next;
+	QAtomicInt     remaining; // items which are not done yet
+	QMutex         mutex;
+	QWaitCondition done;
+};
+
+//------------------------------------------------------------------------------
+// Name: drain(const QSharedPointer<WorkList> &work, F fn)
+// Desc: calls fn(i) for items of the work list until it is empty
+//------------------------------------------------------------------------------
+template <class F>
+void drain(const QSharedPointer<WorkList> &work, F fn) {
+	int i;
+	while((i = work->next.fetchAndAddOrdered(1)) < work->count) {
+		fn(i);
+		if(!work->remaining.deref()) {
+			QMutexLocker locker(&work->mutex);
+			work->done.wakeAll();
+		}
+	}
+}
+
+template <class F>
+class Helper : public QRunnable {
+public:
+	Helper(const QSharedPointer<WorkList> &work, F fn) : work_(work), fn_(fn) {
+	}
+
+public:
+	virtual void run() {
+		drain(work_, fn_);
+	}
+
+private:
+	QSharedPointer<WorkList> work_;
+	F                        fn_;
+};
+
+//------------------------------------------------------------------------------
+// Name: parallel_for(int count, F fn)
+// Desc: calls fn(i) for every i in [0, count) using all of the threads, and
+//       returns once all of them are done. threads take the next item from a
+//       shared list as soon as they are done with one, so a thread which got
+//       cheap items simply does more of them. the calling thread helps, and
+//       only waits for items which are already being worked on, so this may be
+//       nested (and called from a pool thread) without tying up the pool
+//------------------------------------------------------------------------------
+template <class F>
+void parallel_for(int count, F fn) {
+
+	if(count <= 0) {
+		return;
+	}
+
+	const QSharedPointer<WorkList> work(new WorkList(count));
+
+#ifdef USE_QT_CONCURRENT
+	const int helpers = qMin(count, QThread::idealThreadCount()) - 1;
+	for(int i = 0; i < helpers; ++i) {
+		QThreadPool::globalInstance()->start(new Helper<F>(work, fn));
+	}
+#endif
+
+	drain(work, fn);
+
+	QMutexLocker locker(&work->mutex);
+	while(work->remaining != 0) {
+		work->done.wait(&work->mutex);
+	}
+}
+
+}
+
+#endif
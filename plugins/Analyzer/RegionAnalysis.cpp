@@ -0,0 +1,1702 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "RegionAnalysis.h"
+#include "FastHash.h"
+#include "Instruction.h"
+#include "ParallelFor.h"
+#include "Util.h"
+
+#include <QHash>
+#include <QStack>
+#include <QtAlgorithms>
+#include <QtDebug>
+
+#include <boost/bind.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+#define MIN_REFCOUNT 2
+
+namespace {
+#if defined(YAD64_X86)
+	const yad64::Operand::Register STACK_REG = yad64::Operand::REG_ESP;
+	const yad64::Operand::Register FRAME_REG = yad64::Operand::REG_EBP;
+#elif defined(YAD64_X86_64)
+	const yad64::Operand::Register STACK_REG = yad64::Operand::REG_RSP;
+	const yad64::Operand::Register FRAME_REG = yad64::Operand::REG_RBP;
+#endif
+
+	// the region is searched for calls in chunks of this many bytes so that
+	// it is split across all of the threads
+	const std::size_t chunk_size = 0x40000;
+
+	// pages are hashed this many at a time
+	const int hash_chunk_pages = 64;
+
+	// a bound larger than this is more likely a mistake than a switch
+	const quint64 max_table_entries = 0x1000;
+
+	//------------------------------------------------------------------------------
+	// Name: register_family(yad64::Operand::Register reg)
+	// Desc: the general purpose register which reg is all or part of, as 0-15,
+	//       or -1 if it isn't one
+	//------------------------------------------------------------------------------
+	int register_family(yad64::Operand::Register reg) {
+		if(reg >= yad64::Operand::REG_RAX && reg <= yad64::Operand::REG_R15) {
+			return reg - yad64::Operand::REG_RAX;
+		} else if(reg >= yad64::Operand::REG_EAX && reg <= yad64::Operand::REG_R15D) {
+			return reg - yad64::Operand::REG_EAX;
+		} else if(reg >= yad64::Operand::REG_AX && reg <= yad64::Operand::REG_R15W) {
+			return reg - yad64::Operand::REG_AX;
+		} else if(reg >= yad64::Operand::REG_AL && reg <= yad64::Operand::REG_BL) {
+			return reg - yad64::Operand::REG_AL;
+		} else if(reg >= yad64::Operand::REG_AH && reg <= yad64::Operand::REG_BH) {
+			return reg - yad64::Operand::REG_AH;
+		} else if(reg >= yad64::Operand::REG_R8B && reg <= yad64::Operand::REG_R15B) {
+			return reg - yad64::Operand::REG_R8B + 8;
+		} else if(reg >= yad64::Operand::REG_SPL && reg <= yad64::Operand::REG_DIL) {
+			return reg - yad64::Operand::REG_SPL + 4;
+		}
+		return -1;
+	}
+
+	//------------------------------------------------------------------------------
+	// Name: register_mask(yad64::Operand::Register reg)
+	// Desc: the bits of a value which fit in reg
+	//------------------------------------------------------------------------------
+	quint64 register_mask(yad64::Operand::Register reg) {
+		if(reg >= yad64::Operand::REG_EAX && reg <= yad64::Operand::REG_R15D) {
+			return Q_UINT64_C(0xffffffff);
+		} else if(reg >= yad64::Operand::REG_AX && reg <= yad64::Operand::REG_R15W) {
+			return 0xffff;
+		} else if(reg >= yad64::Operand::REG_AL && reg <= yad64::Operand::REG_DIL) {
+			return 0xff;
+		}
+		return ~Q_UINT64_C(0);
+	}
+
+	//------------------------------------------------------------------------------
+	// Name: range_end_less(std::size_t offset, const Range &range)
+	// Desc: ordering for qUpperBound over a sorted list of ranges
+	//------------------------------------------------------------------------------
+	template <class Range>
+	bool range_end_less(std::size_t offset, const Range &range) {
+		return offset < range.last;
+	}
+
+	//------------------------------------------------------------------------------
+	// Name: update_results_entry(IAnalyzer::FunctionMap &results, yad64::address_t address)
+	// Desc:
+	//------------------------------------------------------------------------------
+	void update_results_entry(IAnalyzer::FunctionMap &results, yad64::address_t address) {
+		results[address].entry_address = address;
+		results[address].end_address   = address;
+
+		if(results[address].reference_count == 0) {
+			results[address].reference_count = MIN_REFCOUNT;
+		} else {
+			results[address].reference_count++;
+		}
+	}
+
+	// what a walk saw of an instruction, enough to build the function's graph
+	struct WalkInstruction {
+		enum Flow {
+			FLOW_NEXT,   // on to the next instruction
+			FLOW_BRANCH, // to the target or the next instruction
+			FLOW_JUMP,   // to the target
+			FLOW_TABLE,  // to one of the cases
+			FLOW_STOP    // somewhere we can't tell, or nowhere
+		};
+
+		yad64::address_t          address;
+		int                       size;
+		Flow                      flow;
+		yad64::address_t          target;
+		QVector<yad64::address_t> cases;  // of a jump table, distinct
+	};
+
+	//------------------------------------------------------------------------------
+	// Name: walk_instruction(const yad64::Instruction &insn)
+	// Desc:
+	//------------------------------------------------------------------------------
+	WalkInstruction walk_instruction(const yad64::Instruction &insn) {
+		WalkInstruction record = { insn.rva(), insn.size(), WalkInstruction::FLOW_NEXT, 0 };
+
+		switch(insn.type()) {
+		case yad64::Instruction::OP_RET:
+		case yad64::Instruction::OP_HLT:
+			record.flow = WalkInstruction::FLOW_STOP;
+			break;
+		case yad64::Instruction::OP_JCC:
+		case yad64::Instruction::OP_JMP:
+			if(insn.operand(0).general_type() == yad64::Operand::TYPE_REL) {
+				record.flow   = (insn.type() == yad64::Instruction::OP_JCC) ? WalkInstruction::FLOW_BRANCH : WalkInstruction::FLOW_JUMP;
+				record.target = insn.operand(0).relative_target();
+			} else {
+				record.flow = WalkInstruction::FLOW_STOP;
+			}
+			break;
+		default:
+			break;
+		}
+
+		return record;
+	}
+
+	//------------------------------------------------------------------------------
+	// Name: address_less(const WalkInstruction &lhs, const WalkInstruction &rhs)
+	// Desc:
+	//------------------------------------------------------------------------------
+	bool address_less(const WalkInstruction &lhs, const WalkInstruction &rhs) {
+		return lhs.address < rhs.address;
+	}
+
+	//------------------------------------------------------------------------------
+	// Name: instruction_less(const WalkInstruction &lhs, yad64::address_t address)
+	// Desc: ordering for qLowerBound over the instructions
+	//------------------------------------------------------------------------------
+	bool instruction_less(const WalkInstruction &lhs, yad64::address_t address) {
+		return lhs.address < address;
+	}
+
+	//------------------------------------------------------------------------------
+	// Name: find_instruction(const QVector<WalkInstruction> &instructions, yad64::address_t address)
+	// Desc: returns the index of the instruction starting at address, or -1
+	//------------------------------------------------------------------------------
+	int find_instruction(const QVector<WalkInstruction> &instructions, yad64::address_t address) {
+		QVector<WalkInstruction>::const_iterator it = qLowerBound(instructions.begin(), instructions.end(), address, instruction_less);
+		return (it != instructions.end() && it->address == address) ? it - instructions.begin() : -1;
+	}
+
+	//------------------------------------------------------------------------------
+	// Name: build_graph(QVector<WalkInstruction> &instructions, yad64::address_t entry)
+	// Desc: splits the instructions a walk visited into basic blocks. a block
+	//       starts at the entry point, at the target of a jump, after anything
+	//       which isn't simply followed by the next instruction, and wherever
+	//       the instructions aren't contiguous
+	//------------------------------------------------------------------------------
+	ControlFlowGraph build_graph(QVector<WalkInstruction> &instructions, yad64::address_t entry) {
+
+		qSort(instructions.begin(), instructions.end(), address_less);
+
+		const int n = instructions.size();
+		if(n == 0) {
+			return ControlFlowGraph();
+		}
+
+		QVector<int> target(n, -1);
+		QVector<bool> leader(n, false);
+
+		for(int i = 0; i < n; ++i) {
+			const WalkInstruction &insn = instructions[i];
+
+			if(i == 0 || insn.address == entry) {
+				leader[i] = true;
+			} else {
+				const WalkInstruction &prev = instructions[i - 1];
+				if(prev.address + prev.size != insn.address || prev.flow != WalkInstruction::FLOW_NEXT) {
+					leader[i] = true;
+				}
+			}
+
+			if(insn.flow == WalkInstruction::FLOW_BRANCH || insn.flow == WalkInstruction::FLOW_JUMP) {
+				if((target[i] = find_instruction(instructions, insn.target)) != -1) {
+					leader[target[i]] = true;
+				}
+			}
+
+			Q_FOREACH(yad64::address_t address, insn.cases) {
+				const int n = find_instruction(instructions, address);
+				if(n != -1) {
+					leader[n] = true;
+				}
+			}
+		}
+
+		QVector<ControlFlowGraph::Block> blocks;
+		QVector<int>                     block_of(n);
+
+		for(int i = 0; i < n; ++i) {
+			if(leader[i]) {
+				const ControlFlowGraph::Block block = { instructions[i].address, 0, 0, 0, 0, 0, 0 };
+				blocks.push_back(block);
+			}
+
+			blocks.back().end              = instructions[i].address + instructions[i].size;
+			blocks.back().last_instruction = instructions[i].address;
+			block_of[i] = blocks.size() - 1;
+		}
+
+		QVector<ControlFlowGraph::Edge> edges;
+
+		for(int i = 0; i < n; ++i) {
+			if(i + 1 < n && !leader[i + 1]) {
+				continue;
+			}
+
+			// the last instruction of a block
+			const WalkInstruction &insn = instructions[i];
+			const int  from       = block_of[i];
+			const bool contiguous = i + 1 < n && instructions[i + 1].address == insn.address + insn.size;
+
+			switch(insn.flow) {
+			case WalkInstruction::FLOW_NEXT:
+				if(contiguous) {
+					const ControlFlowGraph::Edge edge = { from, from + 1, ControlFlowGraph::EDGE_FALLTHROUGH };
+					edges.push_back(edge);
+				}
+				break;
+			case WalkInstruction::FLOW_BRANCH:
+				if(target[i] != -1) {
+					const ControlFlowGraph::Edge edge = { from, block_of[target[i]], ControlFlowGraph::EDGE_TAKEN };
+					edges.push_back(edge);
+				}
+				if(contiguous) {
+					const ControlFlowGraph::Edge edge = { from, from + 1, ControlFlowGraph::EDGE_NOT_TAKEN };
+					edges.push_back(edge);
+				}
+				break;
+			case WalkInstruction::FLOW_JUMP:
+				if(target[i] != -1) {
+					const ControlFlowGraph::Edge edge = { from, block_of[target[i]], ControlFlowGraph::EDGE_JUMP };
+					edges.push_back(edge);
+				}
+				break;
+			case WalkInstruction::FLOW_TABLE:
+				Q_FOREACH(yad64::address_t address, insn.cases) {
+					const int n = find_instruction(instructions, address);
+					if(n != -1) {
+						const ControlFlowGraph::Edge edge = { from, block_of[n], ControlFlowGraph::EDGE_TABLE };
+						edges.push_back(edge);
+					}
+				}
+				break;
+			case WalkInstruction::FLOW_STOP:
+				break;
+			}
+		}
+
+		return ControlFlowGraph(blocks, edges);
+	}
+}
+
+// answers whether an address is inside of any of a set of functions with a
+// binary search. the functions may overlap, so along with each entry point it
+// keeps the furthest any function starting at or before it reaches
+class RegionAnalysis::FunctionIndex {
+public:
+	explicit FunctionIndex(const FunctionMap &functions) {
+		entries_.reserve(functions.size());
+		reach_.reserve(functions.size());
+
+		Q_FOREACH(const Function &function, functions) {
+			entries_.push_back(function.entry_address);
+			reach_.push_back(reach_.empty() ? function.end_address : qMax(reach_.back(), function.end_address));
+		}
+	}
+
+public:
+	bool contains(yad64::address_t address) const {
+		const QVector<yad64::address_t>::const_iterator it = qUpperBound(entries_.begin(), entries_.end(), address);
+		return it != entries_.begin() && reach_[(it - entries_.begin()) - 1] >= address;
+	}
+
+private:
+	QVector<yad64::address_t> entries_;
+	QVector<yad64::address_t> reach_;
+};
+
+// follows the registers along a straight run of instructions, looking for
+// the code a compiler emits for a switch. the index is bounded by a cmp and ja
+// (or jae), and then either used to index a table of addresses:
+//
+//     cmp edi, 5 / ja default / jmp [rdi*8 + table]
+//
+// or a table of offsets from the table, found with a rip relative lea:
+//
+//     cmp edi, 5 / ja default / lea rdx, [rip + table] /
+//     movsxd rax, [rdx + rdi*4] / add rax, rdx / jmp rax
+//
+// anything else which writes to a register forgets what was known about it
+class RegionAnalysis::SwitchTracker {
+public:
+	SwitchTracker() {
+		reset();
+	}
+
+public:
+	//------------------------------------------------------------------------------
+	// Name: reset()
+	// Desc:
+	//------------------------------------------------------------------------------
+	void reset() {
+		cmp_pending_  = false;
+		index_regs_   = 0;
+		count_        = 0;
+		table_regs_   = 0;
+		entry_reg_    = -1;
+		target_reg_   = -1;
+	}
+
+	//------------------------------------------------------------------------------
+	// Name: update(const yad64::Instruction &insn)
+	// Desc: called with every instruction of the run, in order
+	//------------------------------------------------------------------------------
+	void update(const yad64::Instruction &insn) {
+
+		const bool cmp_pending = cmp_pending_;
+		cmp_pending_ = false;
+
+		if(insn.operand_count() == 0) {
+			return;
+		}
+
+		const yad64::Operand &op0 = insn.operand(0);
+		const int dest = (op0.general_type() == yad64::Operand::TYPE_REGISTER) ? register_family(op0.reg()) : -1;
+
+		switch(insn.type()) {
+		case yad64::Instruction::OP_CALL:
+		case yad64::Instruction::OP_JMP:
+			// neither is followed by the next instruction with the same registers
+			reset();
+			return;
+
+		case yad64::Instruction::OP_PUSH:
+		case yad64::Instruction::OP_TEST:
+			return;
+
+		case yad64::Instruction::OP_CMP:
+			if(dest != -1 && insn.operand(1).general_type() == yad64::Operand::TYPE_IMMEDIATE) {
+				cmp_pending_ = true;
+				cmp_reg_     = dest;
+				cmp_value_   = static_cast<quint64>(insn.operand(1).immediate()) & register_mask(op0.reg());
+			}
+			return;
+
+		case yad64::Instruction::OP_JCC:
+			// the next instruction only runs if the index is at most (ja) or
+			// below (jae) the value it was compared to
+			if(cmp_pending) {
+				const char *const mnemonic = insn.mnemonic_c_str();
+				if(std::strcmp(mnemonic, "jnbe") == 0 && cmp_value_ < max_table_entries) {
+					index_regs_ = 1u << cmp_reg_;
+					count_      = cmp_value_ + 1;
+				} else if(std::strcmp(mnemonic, "jnb") == 0 && cmp_value_ <= max_table_entries) {
+					index_regs_ = 1u << cmp_reg_;
+					count_      = cmp_value_;
+				}
+			}
+			return;
+
+		case yad64::Instruction::OP_MOV:
+		case yad64::Instruction::OP_MOVZX:
+			// copies of the index or the table
+			if(dest != -1 && insn.operand(1).general_type() == yad64::Operand::TYPE_REGISTER) {
+				const int src = register_family(insn.operand(1).reg());
+				if(src == dest) {
+					// gcc zero extends the index with mov edi, edi between the
+					// ja and the jmp. dropping upper bits leaves an index which
+					// the cmp bounded as it was, but not a table's address
+					if(register_mask(op0.reg()) != register_mask(yad64::Operand::REG_RAX)) {
+						table_regs_ &= ~(1u << dest);
+					}
+					return;
+				}
+
+				if(src != -1) {
+					clobber(dest);
+					index_regs_ |= ((index_regs_ >> src) & 1u) << dest;
+					if(table_regs_ & (1u << src)) {
+						table_regs_ |= 1u << dest;
+						table_[dest] = table_[src];
+					}
+					return;
+				}
+			}
+			break;
+
+		case yad64::Instruction::OP_LEA:
+			if(dest != -1) {
+				const yad64::Operand &op1 = insn.operand(1);
+				if(op1.expression().base == yad64::Operand::REG_RIP && op1.expression().index == yad64::Operand::REG_NULL) {
+					clobber(dest);
+					table_regs_ |= 1u << dest;
+					table_[dest] = insn.rva() + insn.size() + op1.displacement();
+					return;
+				}
+			}
+			break;
+
+		case yad64::Instruction::OP_MOVSXD:
+			if(dest != -1 && count_ != 0) {
+				const yad64::Operand &op1 = insn.operand(1);
+				const int base  = register_family(op1.expression().base);
+				const int index = register_family(op1.expression().index);
+				if(base != -1 && index != -1 && (table_regs_ & (1u << base)) && (index_regs_ & (1u << index)) && op1.expression().scale == 4 && op1.displacement() == 0) {
+					const yad64::address_t table = table_[base];
+					clobber(dest);
+					entry_reg_   = dest;
+					entry_table_ = table;
+					entry_count_ = count_;
+					return;
+				}
+			}
+			break;
+
+		case yad64::Instruction::OP_ADD:
+			if(dest != -1 && dest == entry_reg_ && insn.operand(1).general_type() == yad64::Operand::TYPE_REGISTER) {
+				const int src = register_family(insn.operand(1).reg());
+				if(src != -1 && (table_regs_ & (1u << src)) && table_[src] == entry_table_) {
+					target_reg_   = dest;
+					target_table_ = entry_table_;
+					target_count_ = entry_count_;
+					entry_reg_    = -1;
+					return;
+				}
+			}
+			break;
+
+		default:
+			break;
+		}
+
+		if(dest != -1) {
+			clobber(dest);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	// Name: table(const yad64::Instruction &insn, JumpTable &table) const
+	// Desc: is the indirect jmp or call insn going through a table we know the
+	//       size of?
+	//------------------------------------------------------------------------------
+	bool table(const yad64::Instruction &insn, JumpTable &table) const {
+
+		if(insn.operand_count() == 0) {
+			return false;
+		}
+
+		const yad64::Operand &op = insn.operand(0);
+
+		switch(op.general_type()) {
+		case yad64::Operand::TYPE_REGISTER:
+			if(target_reg_ != -1 && register_family(op.reg()) == target_reg_) {
+				table.address  = target_table_;
+				table.count    = target_count_;
+				table.relative = true;
+				return true;
+			}
+			break;
+
+		case yad64::Operand::TYPE_EXPRESSION:
+			if(count_ != 0 && op.expression().scale == sizeof(yad64::address_t)) {
+				const int index = register_family(op.expression().index);
+				const int base  = register_family(op.expression().base);
+				if(index == -1 || !(index_regs_ & (1u << index))) {
+					break;
+				}
+
+				if(op.expression().base == yad64::Operand::REG_NULL) {
+					table.address = static_cast<yad64::address_t>(op.displacement());
+				} else if(base != -1 && (table_regs_ & (1u << base))) {
+					table.address = table_[base] + op.displacement();
+				} else {
+					break;
+				}
+
+				table.count    = count_;
+				table.relative = false;
+				return true;
+			}
+			break;
+
+		default:
+			break;
+		}
+
+		return false;
+	}
+
+private:
+	//------------------------------------------------------------------------------
+	// Name: clobber(int reg)
+	// Desc: reg was written to
+	//------------------------------------------------------------------------------
+	void clobber(int reg) {
+		index_regs_ &= ~(1u << reg);
+		table_regs_ &= ~(1u << reg);
+		if(entry_reg_ == reg) {
+			entry_reg_ = -1;
+		}
+		if(target_reg_ == reg) {
+			target_reg_ = -1;
+		}
+	}
+
+private:
+	bool             cmp_pending_;  // was the last instruction a cmp reg, imm?
+	int              cmp_reg_;
+	quint64          cmp_value_;
+	quint32          index_regs_;   // a bit for each register holding the index
+	quint64          count_;        // the index is below this
+	quint32          table_regs_;   // a bit for each register holding a table's address
+	yad64::address_t table_[16];
+	int              entry_reg_;    // holds an entry of entry_table_
+	yad64::address_t entry_table_;
+	quint64          entry_count_;
+	int              target_reg_;   // holds an entry of target_table_, plus the table
+	yad64::address_t target_table_;
+	quint64          target_count_;
+};
+
+//------------------------------------------------------------------------------
+// Name: RegionAnalysis(const AnalysisInput &input, const QVector<quint8> &bytes, const QList<DataSnapshot> &data)
+// Desc: bytes is the contents of the region, and data the contents of the
+//       input's data regions
+//------------------------------------------------------------------------------
+RegionAnalysis::RegionAnalysis(const AnalysisInput &input, const QVector<quint8> &bytes, const QList<DataSnapshot> &data) : input_(input), bytes_(bytes), data_(data), incremental_(false), unchanged_(false) {
+}
+
+//------------------------------------------------------------------------------
+// Name: hash_pages(int chunk)
+// Desc:
+//------------------------------------------------------------------------------
+void RegionAnalysis::hash_pages(int chunk) {
+	const std::size_t page_size = input_.page_size;
+	const int first = chunk * hash_chunk_pages;
+	const int last  = qMin(first + hash_chunk_pages, page_hashes_.size());
+
+	for(int i = first; i < last; ++i) {
+		page_hashes_[i] = fast_hash::hash(bytes_.constData() + i * page_size, page_size);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: find_dirty_pages()
+// Desc: hashes every page, and compares them to the previous analysis' to
+//       decide if all of the region has to be analyzed or only some of it
+//------------------------------------------------------------------------------
+void RegionAnalysis::find_dirty_pages() {
+
+	const int page_count = input_.page_size ? bytes_.size() / input_.page_size : 0;
+
+	page_hashes_.resize(page_count);
+	parallel::parallel_for((page_count + hash_chunk_pages - 1) / hash_chunk_pages, boost::bind(&RegionAnalysis::hash_pages, this, _1));
+
+	dirty_.clear();
+	incremental_ = false;
+
+	const QVector<quint64> &previous = input_.previous_page_hashes;
+	if(previous.isEmpty() || previous.size() != page_count || input_.fuzzy != input_.previous_fuzzy) {
+		return;
+	}
+
+	for(int i = 0; i < page_count; ++i) {
+		if(page_hashes_[i] != previous[i]) {
+			const std::size_t first = i * input_.page_size;
+			if(!dirty_.isEmpty() && dirty_.back().last == first) {
+				dirty_.back().last += input_.page_size;
+			} else {
+				const Range range = { first, first + input_.page_size };
+				dirty_.push_back(range);
+			}
+		}
+	}
+
+	unchanged_ = dirty_.isEmpty();
+
+	// what the fuzzy passes find depends on the calls in all of the region and
+	// on which functions the known ones lead to, so a change anywhere may add
+	// or drop a function anywhere else. those analyses are done in full
+	incremental_ = !unchanged_ && !input_.fuzzy;
+}
+
+//------------------------------------------------------------------------------
+// Name: is_dirty(std::size_t first, std::size_t last) const
+// Desc: does [first, last) overlap a page which changed?
+//------------------------------------------------------------------------------
+bool RegionAnalysis::is_dirty(std::size_t first, std::size_t last) const {
+	const QVector<Range>::const_iterator it = qUpperBound(dirty_.constBegin(), dirty_.constEnd(), first, range_end_less<Range>);
+	return it != dirty_.constEnd() && it->first < last;
+}
+
+//------------------------------------------------------------------------------
+// Name: invalidate_dirty_functions()
+// Desc: starts from the previous analysis, without the functions which have to
+//       be looked at again. those are the ones on a changed page, and the ones
+//       they call or are called by. functions which only the changed code led
+//       to are dropped, the walks find them again if they are still called
+//------------------------------------------------------------------------------
+void RegionAnalysis::invalidate_dirty_functions() {
+
+	const yad64::address_t base = input_.region.start();
+
+	function_map_ = input_.previous_functions;
+	calls_        = input_.previous_calls;
+	graphs_       = input_.previous_graphs;
+
+	// the functions which overlap a changed page
+	QSet<yad64::address_t> dirty_functions;
+	Q_FOREACH(const Function &function, function_map_) {
+		const std::size_t first = function.entry_address - base;
+		const std::size_t last  = function.end_address - base;
+
+		const QVector<Range>::const_iterator it = qUpperBound(dirty_.constBegin(), dirty_.constEnd(), first, range_end_less<Range>);
+		if(it != dirty_.constEnd() && it->first <= last) {
+			dirty_functions.insert(function.entry_address);
+		}
+	}
+
+	// the functions calling them, and the ones they call
+	QSet<yad64::address_t> callers;
+	QHash<yad64::address_t, int> outside_callers;
+	for(CallMap::const_iterator it = calls_.constBegin(); it != calls_.constEnd(); ++it) {
+		const bool dirty_caller = dirty_functions.contains(it.key());
+		Q_FOREACH(yad64::address_t callee, it.value()) {
+			if(dirty_functions.contains(callee)) {
+				callers.insert(it.key());
+			}
+
+			if(!dirty_caller) {
+				++outside_callers[callee];
+			}
+		}
+	}
+
+	QSet<yad64::address_t> callees;
+	Q_FOREACH(yad64::address_t function, dirty_functions) {
+		Q_FOREACH(yad64::address_t callee, calls_.value(function)) {
+			callees.insert(callee);
+		}
+	}
+
+	// drop the functions which may not be there any more: the ones starting on
+	// a changed page, and the ones which only the changed functions led to
+	const QSet<yad64::address_t> known = input_.known_functions.toSet();
+
+	QSet<yad64::address_t> removed;
+	Q_FOREACH(yad64::address_t address, dirty_functions + callees) {
+		if(known.contains(address)) {
+			continue;
+		}
+
+		const std::size_t offset = address - base;
+		const QVector<Range>::const_iterator it = qUpperBound(dirty_.constBegin(), dirty_.constEnd(), offset, range_end_less<Range>);
+		const bool on_dirty_page = it != dirty_.constEnd() && it->first <= offset;
+
+		const FunctionMap::const_iterator f = function_map_.constFind(address);
+		const bool only_walked = f != function_map_.constEnd() && f->reference_count == MIN_REFCOUNT && !outside_callers.contains(address);
+
+		if(on_dirty_page || (callees.contains(address) && only_walked)) {
+			removed.insert(address);
+		}
+	}
+
+	// the rest are walked again, along with the function before any which was
+	// dropped, since it may now reach further
+	QSet<yad64::address_t> rewalk = (dirty_functions + callers + callees) - removed;
+	rewalk += functions_before(removed);
+
+	walked_functions_ = function_map_.keys().toSet();
+	kept_xrefs_       = input_.previous_xrefs.xrefs();
+	forget_functions(removed, rewalk);
+
+	// a function's type only depends on its first instruction
+	Q_FOREACH(const Function &function, function_map_) {
+		const std::size_t offset = function.entry_address - base;
+		if(!is_dirty(offset, offset + yad64::Instruction::MAX_SIZE)) {
+			typed_functions_.insert(function.entry_address);
+		}
+	}
+
+	qDebug() << "[Analyzer]" << dirty_.size() << "changed ranges," << rewalk.size() << "functions to walk again," << removed.size() << "dropped";
+}
+
+//------------------------------------------------------------------------------
+// Name: functions_before(const QSet<yad64::address_t> &functions) const
+// Desc: the function before each of these, unless it is one of them too
+//------------------------------------------------------------------------------
+QSet<yad64::address_t> RegionAnalysis::functions_before(const QSet<yad64::address_t> &functions) const {
+
+	QSet<yad64::address_t> before;
+	Q_FOREACH(yad64::address_t address, functions) {
+		const FunctionMap::const_iterator it = function_map_.constFind(address);
+		if(it != function_map_.constBegin() && it != function_map_.constEnd()) {
+			const yad64::address_t previous = (it - 1).key();
+			if(!functions.contains(previous)) {
+				before.insert(previous);
+			}
+		}
+	}
+
+	return before;
+}
+
+//------------------------------------------------------------------------------
+// Name: forget_functions(const QSet<yad64::address_t> &removed, const QSet<yad64::address_t> &rewalk)
+// Desc: drops the removed functions and resets the ones to walk again. the
+//       walks find the references either of them made again, and only their
+//       old bounds say which ones those were, so the references go first
+//------------------------------------------------------------------------------
+void RegionAnalysis::forget_functions(const QSet<yad64::address_t> &removed, const QSet<yad64::address_t> &rewalk) {
+
+	const yad64::address_t base = input_.region.start();
+
+	QVector<Range> stale;
+	for(FunctionMap::const_iterator it = function_map_.constBegin(); it != function_map_.constEnd(); ++it) {
+		if(removed.contains(it.key()) || rewalk.contains(it.key())) {
+			const std::size_t first = it->entry_address - base;
+			const std::size_t last  = it->end_address - base + 1;
+			if(!stale.isEmpty() && stale.back().last >= first) {
+				stale.back().last = qMax(stale.back().last, last);
+			} else {
+				const Range range = { first, last };
+				stale.push_back(range);
+			}
+		}
+	}
+
+	// the ones kept from the previous analysis stay sorted
+	QVector<XrefIndex::Xref> *const lists[] = { &kept_xrefs_, &xrefs_ };
+	for(std::size_t i = 0; i < sizeof(lists) / sizeof(lists[0]); ++i) {
+		QVector<XrefIndex::Xref> &xrefs = *lists[i];
+
+		QVector<XrefIndex::Xref>::iterator out = xrefs.begin();
+		for(QVector<XrefIndex::Xref>::iterator it = xrefs.begin(); it != xrefs.end(); ++it) {
+			const std::size_t offset = it->from - base;
+			const QVector<Range>::const_iterator r = qUpperBound(stale.constBegin(), stale.constEnd(), offset, range_end_less<Range>);
+			if(r == stale.constEnd() || r->first > offset) {
+				*out++ = *it;
+			}
+		}
+		xrefs.erase(out, xrefs.end());
+	}
+
+	Q_FOREACH(yad64::address_t address, removed) {
+		function_map_.remove(address);
+		calls_.remove(address);
+		graphs_.remove(address);
+		walked_functions_.remove(address);
+		typed_functions_.remove(address);
+	}
+
+	Q_FOREACH(yad64::address_t address, rewalk) {
+		FunctionMap::iterator it = function_map_.find(address);
+		if(it != function_map_.end()) {
+			it->end_address      = address;
+			it->last_instruction = address;
+			walked_functions_.remove(address);
+			calls_.remove(address);
+			graphs_.remove(address);
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: drop_unreachable_functions()
+// Desc: a function which only the changed code called is still there after
+//       the walks, along with anything only it led to. whatever the known
+//       functions no longer lead to is dropped, and the functions before those
+//       are walked again, until nothing else goes
+//------------------------------------------------------------------------------
+void RegionAnalysis::drop_unreachable_functions() {
+
+	while(incremental_ && !cancelled_()) {
+
+		QSet<yad64::address_t>    reachable;
+		QVector<yad64::address_t> pending;
+
+		Q_FOREACH(yad64::address_t address, input_.known_functions) {
+			if(function_map_.contains(address) && !reachable.contains(address)) {
+				reachable.insert(address);
+				pending.push_back(address);
+			}
+		}
+
+		while(!pending.isEmpty()) {
+			const yad64::address_t address = pending.back();
+			pending.pop_back();
+
+			Q_FOREACH(yad64::address_t callee, calls_.value(address)) {
+				if(function_map_.contains(callee) && !reachable.contains(callee)) {
+					reachable.insert(callee);
+					pending.push_back(callee);
+				}
+			}
+		}
+
+		QSet<yad64::address_t> unreachable;
+		Q_FOREACH(const Function &function, function_map_) {
+			if(!reachable.contains(function.entry_address)) {
+				unreachable.insert(function.entry_address);
+			}
+		}
+
+		if(unreachable.isEmpty()) {
+			break;
+		}
+
+		qDebug() << "[Analyzer]" << unreachable.size() << "functions are no longer called";
+
+		forget_functions(unreachable, functions_before(unreachable));
+		find_calls_from_known();
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: is_mapped(yad64::address_t address) const
+// Desc: mapped_regions is a sorted list of starts and ends, so an address is
+//       in a region when the first one above it is an end
+//------------------------------------------------------------------------------
+bool RegionAnalysis::is_mapped(yad64::address_t address) const {
+	const QVector<yad64::address_t> &regions = input_.mapped_regions;
+	return (qUpperBound(regions.begin(), regions.end(), address) - regions.begin()) % 2 == 1;
+}
+
+//------------------------------------------------------------------------------
+// Name: jump_table_bytes(yad64::address_t address, std::size_t size) const
+// Desc: the bytes of [address, address + size), from the snapshot of the region
+//       or of one of its module's data regions. null if none of them has all
+//       of it
+//------------------------------------------------------------------------------
+const quint8 *RegionAnalysis::jump_table_bytes(yad64::address_t address, std::size_t size) const {
+
+	const yad64::address_t base = input_.region.start();
+	if(address >= base && address - base < static_cast<yad64::address_t>(bytes_.size())) {
+		const std::size_t offset = address - base;
+		return (static_cast<std::size_t>(bytes_.size()) - offset >= size) ? bytes_.constData() + offset : 0;
+	}
+
+	for(QList<DataSnapshot>::const_iterator it = data_.constBegin(); it != data_.constEnd(); ++it) {
+		const DataSnapshot &data = *it;
+		if(address >= data.start && address - data.start < static_cast<yad64::address_t>(data.bytes.size())) {
+			const std::size_t offset = address - data.start;
+			return (static_cast<std::size_t>(data.bytes.size()) - offset >= size) ? data.bytes.constData() + offset : 0;
+		}
+	}
+
+	return 0;
+}
+
+//------------------------------------------------------------------------------
+// Name: read_jump_table(const JumpTable &table) const
+// Desc: the targets in a table. nothing is returned for a table which isn't
+//       all in one of the snapshots
+//------------------------------------------------------------------------------
+QVector<yad64::address_t> RegionAnalysis::read_jump_table(const JumpTable &table) const {
+
+	QVector<yad64::address_t> targets;
+
+	const std::size_t entry_size = table.relative ? sizeof(qint32) : sizeof(yad64::address_t);
+
+	if(table.count == 0 || table.count > max_table_entries) {
+		return targets;
+	}
+
+	const quint8 *p = jump_table_bytes(table.address, table.count * entry_size);
+	if(!p) {
+		return targets;
+	}
+
+	for(quint64 i = 0; i < table.count; ++i, p += entry_size) {
+		if(table.relative) {
+			qint32 entry;
+			std::memcpy(&entry, p, sizeof(entry));
+			targets.push_back(table.address + entry);
+		} else {
+			yad64::address_t entry;
+			std::memcpy(&entry, p, sizeof(entry));
+			targets.push_back(entry);
+		}
+	}
+
+	return targets;
+}
+
+//------------------------------------------------------------------------------
+// Name: instruction_bytes(yad64::address_t address, const quint8 *&first, const quint8 *&last) const
+// Desc: the bytes of the instruction at address, as far as the snapshot goes
+//------------------------------------------------------------------------------
+bool RegionAnalysis::instruction_bytes(yad64::address_t address, const quint8 *&first, const quint8 *&last) const {
+
+	const yad64::address_t base = input_.region.start();
+	if(address < base || address - base >= static_cast<yad64::address_t>(bytes_.size())) {
+		return false;
+	}
+
+	const std::size_t offset = address - base;
+	first = bytes_.constData() + offset;
+	last  = first + qMin<std::size_t>(yad64::Instruction::MAX_SIZE, bytes_.size() - offset);
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: is_stack_frame(yad64::address_t addr) const
+// Desc:
+//------------------------------------------------------------------------------
+bool RegionAnalysis::is_stack_frame(yad64::address_t addr) const {
+
+	unsigned int i = 0;
+
+	while(i < 2) {
+		// gets the bytes for the instruction
+		const quint8 *first;
+		const quint8 *last;
+		if(!instruction_bytes(addr, first, last)) {
+			break;
+		}
+
+		// decode it
+		const yad64::Instruction insn(first, last, addr, std::nothrow);
+		if(!insn.valid()) {
+			break;
+		}
+
+		// which part of the sequence are we looking at?
+		switch(i++) {
+		case 0:
+			// are we looking at a 'push rBP' ?
+			if(insn.type() == yad64::Instruction::OP_PUSH) {
+				Q_ASSERT(insn.operand_count() == 1);
+				const yad64::Operand &op = insn.operand(0);
+				if(op.complete_type() == yad64::Operand::TYPE_REGISTER) {
+					if(op.reg() == FRAME_REG) {
+						break;
+					}
+				}
+			// if it is an 'enter 0,0' instruction, then it's a stack frame right away
+			} else if(insn.type() == yad64::Instruction::OP_ENTER) {
+				Q_ASSERT(insn.operand_count() == 2);
+				const yad64::Operand &op0 = insn.operand(0);
+				const yad64::Operand &op1 = insn.operand(1);
+				if(op0.immediate() == 0 && op1.immediate() == 0) {
+					return true;
+				}
+			}
+			++i;
+			break;
+		case 1:
+			// are we looking at a 'mov rBP, rSP' ?
+			if(insn.type() == yad64::Instruction::OP_MOV) {
+				Q_ASSERT(insn.operand_count() == 2);
+				const yad64::Operand &op0 = insn.operand(0);
+				const yad64::Operand &op1 = insn.operand(1);
+				if(op0.complete_type() == yad64::Operand::TYPE_REGISTER && op1.complete_type() == yad64::Operand::TYPE_REGISTER) {
+					if(op0.reg() == FRAME_REG && op1.reg() == STACK_REG) {
+						return true;
+					}
+				}
+			}
+			break;
+		default:
+			break;
+		}
+
+		addr += insn.size();
+	}
+
+	return false;
+}
+
+//------------------------------------------------------------------------------
+// Name: is_thunk(yad64::address_t address) const
+// Desc: basically returns true if the first instruction of the function is a
+//       jmp
+//------------------------------------------------------------------------------
+bool RegionAnalysis::is_thunk(yad64::address_t address) const {
+	const quint8 *first;
+	const quint8 *last;
+	if(instruction_bytes(address, first, last)) {
+		const yad64::Instruction insn(first, last, address, std::nothrow);
+		return insn.valid() && insn.type() == yad64::Instruction::OP_JMP;
+	}
+
+	return false;
+}
+
+//------------------------------------------------------------------------------
+// Name: add_known_functions()
+// Desc: the entry point, main, marked functions and symbols
+//------------------------------------------------------------------------------
+void RegionAnalysis::add_known_functions() {
+
+	// the ones which are still there from the previous analysis keep their count
+	const FunctionMap existing(function_map_);
+
+	Q_FOREACH(yad64::address_t address, input_.known_functions) {
+		if(input_.region.contains(address) && !existing.contains(address)) {
+			update_results_entry(function_map_, address);
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: add_xrefs(const yad64::Instruction &insn, QVector<XrefIndex::Xref> &xrefs) const
+// Desc: the addresses an instruction refers to. memory operands and immediates
+//       only count if they point into a mapped region, anything else is far
+//       more likely to be a number than an address
+//------------------------------------------------------------------------------
+void RegionAnalysis::add_xrefs(const yad64::Instruction &insn, QVector<XrefIndex::Xref> &xrefs) const {
+
+	for(std::size_t i = 0; i < insn.operand_count(); ++i) {
+		const yad64::Operand &op = insn.operand(i);
+
+		XrefIndex::Xref xref = { insn.rva(), 0, XrefIndex::XREF_DATA };
+
+		switch(op.general_type()) {
+		case yad64::Operand::TYPE_REL:
+			xref.to   = op.relative_target();
+			xref.kind = (insn.type() == yad64::Instruction::OP_CALL) ? XrefIndex::XREF_CALL : XrefIndex::XREF_JUMP;
+			xrefs.push_back(xref);
+			break;
+		case yad64::Operand::TYPE_EXPRESSION:
+			// fs and gs relative ones are offsets into thread local storage
+			if(insn.prefix() & (yad64::Instruction::PREFIX_FS | yad64::Instruction::PREFIX_GS)) {
+				break;
+			}
+
+			if(op.expression().index != yad64::Operand::REG_NULL) {
+				break;
+			}
+
+			if(op.expression().base == yad64::Operand::REG_RIP) {
+				xref.to = insn.rva() + insn.size() + op.displacement();
+			} else if(op.expression().base == yad64::Operand::REG_NULL) {
+				xref.to = static_cast<yad64::address_t>(op.displacement());
+			} else {
+				break;
+			}
+
+			if(is_mapped(xref.to)) {
+				xrefs.push_back(xref);
+			}
+			break;
+		case yad64::Operand::TYPE_IMMEDIATE:
+			xref.to   = static_cast<yad64::address_t>(op.immediate());
+			xref.kind = XrefIndex::XREF_IMMEDIATE;
+			if(is_mapped(xref.to)) {
+				xrefs.push_back(xref);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: bonus_stack_frame(Function *const *functions, int i) const
+// Desc:
+//------------------------------------------------------------------------------
+void RegionAnalysis::bonus_stack_frame(Function *const *functions, int i) const {
+	if(is_stack_frame(functions[i]->entry_address)) {
+		functions[i]->reference_count++;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: bonus_stack_frames(FunctionMap &found_functions)
+// Desc: give bonus if we see a "push ebp; mov ebp, esp;"
+//------------------------------------------------------------------------------
+void RegionAnalysis::bonus_stack_frames(FunctionMap &found_functions) {
+
+	QVector<Function *> functions;
+	functions.reserve(found_functions.size());
+	for(FunctionMap::iterator it = found_functions.begin(); it != found_functions.end(); ++it) {
+		functions.push_back(&it.value());
+	}
+
+	parallel::parallel_for(functions.size(), boost::bind(&RegionAnalysis::bonus_stack_frame, this, functions.constData(), _1));
+}
+
+//------------------------------------------------------------------------------
+// Name: find_calls_in_chunk(const FunctionIndex *known, const Range *chunks, QVector<yad64::address_t> *targets, int i) const
+// Desc: collects the targets of the direct calls in one chunk of the region
+//------------------------------------------------------------------------------
+void RegionAnalysis::find_calls_in_chunk(const FunctionIndex *known, const Range *chunks, QVector<yad64::address_t> *targets, int i) const {
+
+	const MemoryRegion &region = input_.region;
+	const std::size_t size = qMin<std::size_t>(region.size(), bytes_.size());
+
+	for(std::size_t offset = chunks[i].first; offset < chunks[i].last; ++offset) {
+
+		// only direct calls matter here, so there is no need to decode operands
+		yad64::InstructionLength info;
+		edisassm::decode_length(&bytes_[offset], size - offset, region.start() + offset, info);
+
+		if(info.valid && info.flow == edisassm::FLOW_CALL && info.has_target) {
+
+			const yad64::address_t ip = region.start() + offset;
+			const yad64::address_t ea = info.target;
+
+			// skip over ones which are : call <label>; label:
+			if(ea != ip + info.size) {
+				if(region.contains(ea)) {
+					// avoid calls which land in the middle of a function...
+					// this may or may not be the best approach
+					if(!known->contains(ea)) {
+						targets[i].push_back(ea);
+					}
+				}
+			}
+		}
+
+		if((offset & 0xfff) == 0 && cancelled_()) {
+			break;
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: find_function_calls(FunctionMap &found_functions)
+// Desc: looks at all of the region, or only at what changed since the previous
+//       analysis. any call found anywhere else was found back then
+//------------------------------------------------------------------------------
+void RegionAnalysis::find_function_calls(FunctionMap &found_functions) {
+
+	const std::size_t size = qMin<std::size_t>(input_.region.size(), bytes_.size());
+
+	QVector<Range> ranges;
+	if(incremental_) {
+		// an instruction which starts just before a changed page may run into it
+		Q_FOREACH(const Range &range, dirty_) {
+			const std::size_t back = yad64::Instruction::MAX_SIZE - 1;
+			const Range r = { range.first > back ? range.first - back : 0, qMin(range.last, size) };
+			ranges.push_back(r);
+		}
+	} else {
+		const Range r = { 0, size };
+		ranges.push_back(r);
+	}
+
+	QVector<Range> chunks;
+	Q_FOREACH(const Range &range, ranges) {
+		for(std::size_t first = range.first; first < range.last; first += chunk_size) {
+			const Range chunk = { first, qMin(first + chunk_size, range.last) };
+			chunks.push_back(chunk);
+		}
+	}
+
+	const FunctionIndex known(function_map_);
+
+	QVector<QVector<yad64::address_t> > targets(chunks.size());
+	parallel::parallel_for(chunks.size(), boost::bind(&RegionAnalysis::find_calls_in_chunk, this, &known, chunks.constData(), targets.data(), _1));
+
+	// the chunks are merged in order, so this is exactly what one pass over
+	// the region would have found
+	Q_FOREACH(const QVector<yad64::address_t> &chunk, targets) {
+		Q_FOREACH(yad64::address_t ea, chunk) {
+			found_functions[ea].entry_address = ea;
+			found_functions[ea].end_address   = ea;
+			found_functions[ea].reference_count++;
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: walk_function(Walk *walks, int i) const
+// Desc:
+//------------------------------------------------------------------------------
+void RegionAnalysis::walk_function(Walk *walks, int i) const {
+	if(!cancelled_()) {
+		find_function_end(walks[i]);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: walk_all_functions()
+// Desc: walks every function which hasn't been yet, all at once, and adds the
+//       functions they lead to. returns how many new ones there are
+//------------------------------------------------------------------------------
+int RegionAnalysis::walk_all_functions() {
+	int updates = 0;
+
+	QVector<Walk> walks;
+
+	FunctionMap::iterator it = function_map_.begin();
+	while(it != function_map_.end()) {
+		Function &function = it.value();
+
+		const FunctionMap::iterator next = ++it;
+
+		if(function.reference_count >= MIN_REFCOUNT) {
+			if(!walked_functions_.contains(function.entry_address)) {
+
+				// the function's upper bound is either the entry point of the next function
+				// or the region's end which is the absolute max end this function can have
+				Walk walk;
+				walk.function    = &function;
+				walk.end_address = (next != function_map_.end()) ? next.value().entry_address : input_.region.end();
+				walk.tail_jump   = false;
+				walk.tail_target = 0;
+				walks.push_back(walk);
+
+				walked_functions_.insert(function.entry_address);
+			}
+		}
+
+		it = next;
+	}
+
+	// the walks only write to their own function and Walk, and only look up
+	// the entry points of the others, so they can all run at once
+	parallel::parallel_for(walks.size(), boost::bind(&RegionAnalysis::walk_function, this, walks.data(), _1));
+
+	QSet<yad64::address_t> found_functions;
+	Q_FOREACH(const Walk &walk, walks) {
+		Q_FOREACH(yad64::address_t address, walk.calls) {
+			found_functions.insert(address);
+		}
+	}
+
+	// remembered so that the next analysis knows which functions depend on
+	// which when some of them change
+	Q_FOREACH(const Walk &walk, walks) {
+		QVector<yad64::address_t> calls = walk.calls;
+		if(walk.tail_jump) {
+			calls.push_back(walk.tail_target);
+		}
+
+		std::sort(calls.begin(), calls.end());
+		calls.erase(std::unique(calls.begin(), calls.end()), calls.end());
+
+		if(!calls.isEmpty()) {
+			calls_.insert(walk.function->entry_address, calls);
+		}
+
+		graphs_.insert(walk.function->entry_address, walk.graph);
+		xrefs_ += walk.xrefs;
+	}
+
+	// if the very last instruction happens to be a jmp, then this may
+	// be a call/ret -> jmp optimization. This isn't always the case
+	// but often enough that it's probably right. this is checked once all of
+	// the bounds are known, so that the order of the walks doesn't matter
+	const FunctionIndex known(function_map_);
+	Q_FOREACH(const Walk &walk, walks) {
+		if(walk.tail_jump && !known.contains(walk.tail_target)) {
+			found_functions.insert(walk.tail_target);
+		}
+	}
+
+	// add the newly found functions to the list and report the number of "updates"
+	Q_FOREACH(yad64::address_t func, found_functions) {
+		if(!function_map_.contains(func)) {
+			function_map_[func].entry_address   = func;
+			function_map_[func].end_address     = func;
+			function_map_[func].reference_count = MIN_REFCOUNT;
+			++updates;
+		}
+	}
+
+	return updates;
+}
+
+//------------------------------------------------------------------------------
+// Name: fix_overlaps()
+// Desc: ensures that no function overlaps another
+//------------------------------------------------------------------------------
+void RegionAnalysis::fix_overlaps() {
+	for(FunctionMap::iterator it = function_map_.begin(); it != function_map_.end(); ) {
+		Function &func = *it++;
+		if(it != function_map_.end()) {
+			const Function &next_func = *it;
+			if(next_func.entry_address <= func.end_address) {
+				func.end_address = next_func.entry_address - 1;
+			}
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: find_function_end(Walk &walk) const
+// Desc: runs on any thread, so it may only change walk and its function
+//------------------------------------------------------------------------------
+void RegionAnalysis::find_function_end(Walk &walk) const {
+
+	Function &function                 = *walk.function;
+	const yad64::address_t end_address = walk.end_address;
+
+	QStack<yad64::address_t>     jump_targets;
+	QHash<yad64::address_t, int> visited_addresses;
+	QVector<WalkInstruction>     instructions;
+	QHash<yad64::address_t, QVector<yad64::address_t> > jump_tables; // the cases of each jmp through one
+
+	// we start with the entry point of the function
+	jump_targets.push(function.entry_address);
+
+	// while no more jump targets... (includes entry point)
+	while(!jump_targets.empty()) {
+
+		yad64::address_t addr = jump_targets.pop();
+
+		// for certain forward jump scenarioes this is possible.
+		if(visited_addresses.contains(addr)) {
+			continue;
+		}
+
+		SwitchTracker tracker;
+
+		// keep going until we go out of bounds
+		while(addr >= function.entry_address && addr < end_address) {
+
+			const quint8 *first;
+			const quint8 *last;
+			if(!instruction_bytes(addr, first, last)) {
+				break;
+			}
+
+			// an invalid instruction ends this "block"
+			const yad64::Instruction insn(first, last, addr, std::nothrow);
+			if(!insn.valid()) {
+				break;
+			}
+
+			// ok, it was a valid instruction, let's add it to the
+			// list of possible 'code addresses'
+			if(!visited_addresses.contains(addr)) {
+				instructions.push_back(walk_instruction(insn));
+				add_xrefs(insn, walk.xrefs);
+			}
+			visited_addresses.insert(addr, insn.size());
+
+			const yad64::Instruction::Type type = insn.type();
+
+			if(type == yad64::Instruction::OP_RET || type == yad64::Instruction::OP_HLT) {
+				// instructions that clearly terminate the current block...
+				break;
+
+			} else if(type == yad64::Instruction::OP_JCC) {
+
+				// note if neccessary the Jcc target and move on, yes this can be fooled by "conditional"
+				// jumps which are always true or false, not much we can do about it at this level.
+				const yad64::Operand &op = insn.operand(0);
+				if(op.general_type() == yad64::Operand::TYPE_REL) {
+					const yad64::address_t ea = op.relative_target();
+
+					if(!visited_addresses.contains(ea) && !jump_targets.contains(ea)) {
+						jump_targets.push(ea);
+					}
+				}
+			} else if(type == yad64::Instruction::OP_CALL) {
+
+				// similar to above, note the destination and move on
+				// we special case simple things for speed.
+				// also this is an opportunity to find call tables.
+				const yad64::Operand &op = insn.operand(0);
+				if(op.general_type() == yad64::Operand::TYPE_REL) {
+					const yad64::address_t ea = op.relative_target();
+
+					// skip over ones which are: "call <label>; label:"
+					if(ea != addr + insn.size()) {
+						walk.calls.push_back(ea);
+					}
+				} else if(op.general_type() == yad64::Operand::TYPE_EXPRESSION) {
+					// looks like: "call [...]", if it is of the form, call [C + REG]
+					// then it may be a table of functions using REG as an index
+					JumpTable table;
+					if(tracker.table(insn, table)) {
+						Q_FOREACH(yad64::address_t ea, read_jump_table(table)) {
+							if(input_.region.contains(ea)) {
+								const XrefIndex::Xref xref = { addr, ea, XrefIndex::XREF_CALL };
+								walk.calls.push_back(ea);
+								walk.xrefs.push_back(xref);
+							}
+						}
+					}
+				}
+			} else if(type == yad64::Instruction::OP_JMP) {
+
+				const yad64::Operand &op = insn.operand(0);
+				if(op.general_type() == yad64::Operand::TYPE_REL) {
+					const yad64::address_t ea = op.relative_target();
+
+					// an absolute jump within this function
+					if(ea >= function.entry_address && ea < addr) {
+						tracker.reset();
+						addr += insn.size();
+						continue;
+					}
+
+					// is it a jump to another function's entry point?
+					// if so, this is a dead end, resume from other branches
+					// but give the target a bonus reference
+					if(function_map_.constFind(ea) != function_map_.constEnd()) {
+						walk.calls.push_back(ea);
+						break;
+					}
+
+					break;
+				}
+
+				// a jump table, each case is somewhere in this function
+				if(jump_tables.contains(addr)) {
+					break;
+				}
+
+				JumpTable table;
+				if(tracker.table(insn, table)) {
+					QVector<yad64::address_t> cases;
+					Q_FOREACH(yad64::address_t ea, read_jump_table(table)) {
+						if(ea >= function.entry_address && ea < end_address) {
+							cases.push_back(ea);
+						}
+					}
+
+					std::sort(cases.begin(), cases.end());
+					cases.erase(std::unique(cases.begin(), cases.end()), cases.end());
+
+					if(!cases.isEmpty()) {
+						Q_FOREACH(yad64::address_t ea, cases) {
+							const XrefIndex::Xref xref = { addr, ea, XrefIndex::XREF_JUMP };
+							walk.xrefs.push_back(xref);
+
+							if(!visited_addresses.contains(ea) && !jump_targets.contains(ea)) {
+								jump_targets.push(ea);
+							}
+						}
+
+						jump_tables.insert(addr, cases);
+						break;
+					}
+				}
+			}
+
+			tracker.update(insn);
+			addr += insn.size();
+		}
+	}
+
+	for(int i = 0; i < instructions.size(); ++i) {
+		const QHash<yad64::address_t, QVector<yad64::address_t> >::const_iterator it = jump_tables.find(instructions[i].address);
+		if(it != jump_tables.end()) {
+			instructions[i].flow  = WalkInstruction::FLOW_TABLE;
+			instructions[i].cases = it.value();
+		}
+	}
+
+	walk.graph = build_graph(instructions, function.entry_address);
+
+	function.last_instruction = function.entry_address;
+	function.end_address      = function.entry_address;
+
+	// get the last instruction and the last byte of the function
+	for(QHash<yad64::address_t, int>::const_iterator it = visited_addresses.begin(); it != visited_addresses.end(); ++it) {
+		function.end_address      = qMax(function.end_address,      it.key() + it.value() - 1);
+		function.last_instruction = qMax(function.last_instruction, it.key());
+	}
+
+	const quint8 *first;
+	const quint8 *last;
+	if(instruction_bytes(function.last_instruction, first, last)) {
+		const yad64::Instruction insn(first, last, function.last_instruction, std::nothrow);
+		if(insn.valid() && insn.type() == yad64::Instruction::OP_JMP) {
+
+			Q_ASSERT(insn.operand_count() == 1);
+			const yad64::Operand &op = insn.operand(0);
+
+			if(op.general_type() == yad64::Operand::TYPE_REL) {
+				walk.tail_jump   = true;
+				walk.tail_target = op.relative_target();
+			}
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: set_function_type(Function *const *functions, int i) const
+// Desc:
+//------------------------------------------------------------------------------
+void RegionAnalysis::set_function_type(Function *const *functions, int i) const {
+
+	if(is_thunk(functions[i]->entry_address)) {
+		functions[i]->type = Function::FUNCTION_THUNK;
+	} else {
+		functions[i]->type = Function::FUNCTION_STANDARD;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: set_function_types()
+// Desc: the functions kept from the previous analysis with their first
+//       instruction unchanged already have theirs
+//------------------------------------------------------------------------------
+void RegionAnalysis::set_function_types() {
+
+	QVector<Function *> functions;
+	for(FunctionMap::iterator it = function_map_.begin(); it != function_map_.end(); ++it) {
+		if(!typed_functions_.contains(it.key())) {
+			functions.push_back(&it.value());
+		}
+	}
+
+	parallel::parallel_for(functions.size(), boost::bind(&RegionAnalysis::set_function_type, this, functions.constData(), _1));
+}
+
+//------------------------------------------------------------------------------
+// Name: find_calls_from_known()
+// Desc:
+//------------------------------------------------------------------------------
+void RegionAnalysis::find_calls_from_known() {
+	int updates;
+	do {
+		updates = walk_all_functions();
+		qDebug() << "[Analyzer] got" << updates << "updates";
+	} while(updates != 0 && !cancelled_());
+}
+
+//------------------------------------------------------------------------------
+// Name: collect_high_ref_results(FunctionMap &found_functions)
+// Desc:
+//------------------------------------------------------------------------------
+void RegionAnalysis::collect_high_ref_results(FunctionMap &found_functions) {
+	for(FunctionMap::iterator it = found_functions.begin(); it != found_functions.end(); ) {
+		if(it->reference_count >= MIN_REFCOUNT) {
+			function_map_[it->entry_address] = *it;
+			found_functions.erase(it++);
+		} else {
+			++it;
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: collect_low_ref_results(FunctionMap &found_functions)
+// Desc:
+//------------------------------------------------------------------------------
+void RegionAnalysis::collect_low_ref_results(FunctionMap &found_functions) {
+
+	// the functions added here start and end at the same address, so they
+	// never contain one of the others and the index stays good
+	const FunctionIndex known(function_map_);
+
+	// promote weak symbols...
+	Q_FOREACH(const Function &func, found_functions) {
+		if(!known.contains(func.entry_address)) {
+			if(!function_map_.contains(func.entry_address)) {
+				function_map_[func.entry_address] = func;
+
+				if(input_.weak_symbols.contains(func.entry_address)) {
+					function_map_[func.entry_address].reference_count++;
+				}
+			}
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: run(const ProgressFunction &progress, const CancelledFunction &cancelled)
+// Desc:
+//------------------------------------------------------------------------------
+bool RegionAnalysis::run(const ProgressFunction &progress, const CancelledFunction &cancelled) {
+
+	cancelled_ = cancelled;
+	unchanged_ = false;
+
+	function_map_.clear();
+	calls_.clear();
+	graphs_.clear();
+	xrefs_.clear();
+	kept_xrefs_.clear();
+	walked_functions_.clear();
+	typed_functions_.clear();
+
+	qDebug("[Analyzer] looking for changed pages...");
+	find_dirty_pages();
+
+	if(unchanged_) {
+		qDebug("[Analyzer] region unchanged, using previous analysis");
+		function_map_ = input_.previous_functions;
+		calls_        = input_.previous_calls;
+		graphs_       = input_.previous_graphs;
+		xref_index_   = input_.previous_xrefs;
+		progress(100);
+		return true;
+	}
+
+	// everything after this only looks at what isn't already known, so when
+	// starting from the previous analysis that is what changed
+	if(incremental_) {
+		invalidate_dirty_functions();
+	}
+
+	FunctionMap found_functions;
+
+	const struct {
+		const char             *message;
+		boost::function<void()> function;
+	} analysis_steps[] = {
+		{ "adding known functions to the list...",   boost::bind(&RegionAnalysis::add_known_functions,   this) },
+		{ "calculating function bounds... (pass 1)", boost::bind(&RegionAnalysis::find_calls_from_known, this) },
+		{ "dropping functions no longer called...",  boost::bind(&RegionAnalysis::drop_unreachable_functions, this) },
+		{ "fixing overlapping functions...",         boost::bind(&RegionAnalysis::fix_overlaps,          this) },
+	};
+
+	const struct {
+		const char             *message;
+		boost::function<void()> function;
+	} fuzzy_analysis_steps[] = {
+		{ "finding possible function calls...",      boost::bind(&RegionAnalysis::find_function_calls,      this, boost::ref(found_functions)) },
+		{ "bonusing stack frames...",                boost::bind(&RegionAnalysis::bonus_stack_frames,       this, boost::ref(found_functions)) },
+		{ "collecting high reference answers...",    boost::bind(&RegionAnalysis::collect_high_ref_results, this, boost::ref(found_functions)) },
+		{ "calculating function bounds... (pass 2)", boost::bind(&RegionAnalysis::find_calls_from_known,    this) },
+		{ "collecting low reference answers...",     boost::bind(&RegionAnalysis::collect_low_ref_results,  this, boost::ref(found_functions)) },
+		{ "calculating function bounds... (pass 3)", boost::bind(&RegionAnalysis::find_calls_from_known,    this) },
+	};
+
+	const int analysis_steps_count       = sizeof(analysis_steps) / sizeof(analysis_steps[0]);
+	const int fuzzy_analysis_steps_count = input_.fuzzy ? sizeof(fuzzy_analysis_steps) / sizeof(fuzzy_analysis_steps[0]) : 0;
+	const int total_steps = analysis_steps_count + fuzzy_analysis_steps_count + 1;
+
+	progress(util::percentage(0, total_steps));
+	for(int i = 0; i < analysis_steps_count; ++i) {
+		qDebug("[Analyzer] %s", analysis_steps[i].message);
+		analysis_steps[i].function();
+		if(cancelled_()) {
+			return false;
+		}
+		progress(util::percentage(i + 1, total_steps));
+	}
+
+	// ok, at this point, we've done the best we can with knowns
+	// we should have a full analysis of all functions which are
+	// reachable from known entry points in the code
+	// let's start looking for unknowns
+	for(int i = 0; i < fuzzy_analysis_steps_count; ++i) {
+		qDebug("[Analyzer] %s", fuzzy_analysis_steps[i].message);
+		fuzzy_analysis_steps[i].function();
+		if(cancelled_()) {
+			return false;
+		}
+		progress(util::percentage(analysis_steps_count + i + 1, total_steps));
+	}
+
+	qDebug("[Analyzer] determining function types...");
+	set_function_types();
+
+	qDebug("[Analyzer] indexing references...");
+	xref_index_ = XrefIndex(input_.region.start(), kept_xrefs_, xrefs_);
+	xrefs_.clear();
+	kept_xrefs_.clear();
+	progress(100);
+
+	return !cancelled_();
+}
@@ -0,0 +1,188 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef REGION_ANALYSIS_20121017_H_
+#define REGION_ANALYSIS_20121017_H_
+
+#include "ControlFlowGraph.h"
+#include "IAnalyzer.h"
+#include "MemoryRegion.h"
+#include "Types.h"
+#include "XrefIndex.h"
+
+#include <QHash>
+#include <QList>
+#include <QSet>
+#include <QVector>
+
+#include <boost/function.hpp>
+
+// for every function, the functions it calls or jumps to
+typedef QHash<yad64::address_t, QVector<yad64::address_t> > CallMap;
+
+// the graphs of the functions which were walked, by entry point
+typedef QHash<yad64::address_t, ControlFlowGraph> GraphMap;
+
+// a snapshot of a read only region of the same module as the one analyzed,
+// which is where the jump tables of its code usually are
+struct DataSnapshot {
+	yad64::address_t start;
+	QVector<quint8>  bytes;
+};
+
+// everything about a region that has to be looked up on the GUI thread,
+// gathered before an analysis starts
+struct AnalysisInput {
+	MemoryRegion            region;
+	yad64::address_t        page_size;
+	QList<yad64::address_t> known_functions; // the entry point, main, marked functions and code symbols, each one is a reference
+	QSet<yad64::address_t>  weak_symbols;
+	QVector<yad64::address_t> mapped_regions;  // the start and end of every mapped region, in order
+	QList<MemoryRegion>     data_regions;    // the module's read only regions, read along with the region itself
+	bool                    fuzzy;
+
+	// the last analysis, if there was one
+	IAnalyzer::FunctionMap  previous_functions;
+	CallMap                 previous_calls;
+	GraphMap                previous_graphs;
+	XrefIndex               previous_xrefs;
+	QVector<quint64>        previous_page_hashes;
+	bool                    previous_fuzzy;
+};
+
+struct AnalysisResult {
+	MemoryRegion           region;
+	IAnalyzer::FunctionMap functions;
+	CallMap                calls;
+	GraphMap               graphs;
+	XrefIndex              xrefs;
+	QVector<quint64>       page_hashes;
+	bool                   fuzzy;
+	bool                   complete;  // false if it was cancelled
+	bool                   unchanged; // the previous analysis still holds
+	bool                   from_file; // the code analyzed is the same as in the region's file
+};
+
+// analyzes a single region from a snapshot of its bytes. nothing in here
+// touches the debugger or the analyzer, so any number of these may run at
+// once, and each one spreads the walking of functions over all threads.
+// every page of the snapshot is hashed, and if there is a previous analysis
+// only the functions on pages which changed (and the ones calling them or
+// called by them) are looked at again. fuzzy analyses are only reused when
+// nothing changed
+class RegionAnalysis {
+public:
+	typedef IAnalyzer::Function        Function;
+	typedef IAnalyzer::FunctionMap     FunctionMap;
+	typedef boost::function<void(int)> ProgressFunction;
+	typedef boost::function<bool()>    CancelledFunction;
+
+public:
+	RegionAnalysis(const AnalysisInput &input, const QVector<quint8> &bytes, const QList<DataSnapshot> &data);
+
+public:
+	// progress is called on the thread calling run, which returns false if it
+	// was cancelled
+	bool run(const ProgressFunction &progress, const CancelledFunction &cancelled);
+	const FunctionMap &functions() const        { return function_map_; }
+	const CallMap &calls() const                { return calls_; }
+	const GraphMap &graphs() const              { return graphs_; }
+	const XrefIndex &xrefs() const              { return xref_index_; }
+	const QVector<quint64> &page_hashes() const { return page_hashes_; }
+	bool unchanged() const                      { return unchanged_; }
+
+private:
+	// what walking a function found, each walk is done on its own and they
+	// are only merged once all of them are done
+	struct Walk {
+		Function *                function;
+		yad64::address_t          end_address;
+		QVector<yad64::address_t> calls;       // functions called or jumped to
+		bool                      tail_jump;   // does the function end with a jmp?
+		yad64::address_t          tail_target;
+		ControlFlowGraph          graph;
+		QVector<XrefIndex::Xref>  xrefs;       // the references made by the instructions walked
+	};
+
+	// [first, last) offsets into the region
+	struct Range {
+		std::size_t first;
+		std::size_t last;
+	};
+
+	// the targets of an indirect jmp or call, indexed by a register which a
+	// cmp and ja before it bound
+	struct JumpTable {
+		yad64::address_t address;
+		quint64          count;
+		bool             relative; // 32 bit offsets from address rather than addresses
+	};
+
+	class FunctionIndex;
+	class SwitchTracker;
+
+private:
+	bool is_dirty(std::size_t first, std::size_t last) const;
+	bool is_mapped(yad64::address_t address) const;
+	bool instruction_bytes(yad64::address_t address, const quint8 *&first, const quint8 *&last) const;
+	bool is_stack_frame(yad64::address_t address) const;
+	bool is_thunk(yad64::address_t address) const;
+	void add_known_functions();
+	void add_xrefs(const yad64::Instruction &insn, QVector<XrefIndex::Xref> &xrefs) const;
+	void bonus_stack_frame(Function *const *functions, int i) const;
+	void bonus_stack_frames(FunctionMap &found_functions);
+	void collect_high_ref_results(FunctionMap &found_functions);
+	void collect_low_ref_results(FunctionMap &found_functions);
+	void drop_unreachable_functions();
+	void find_calls_from_known();
+	void find_calls_in_chunk(const FunctionIndex *known, const Range *chunks, QVector<yad64::address_t> *targets, int i) const;
+	void find_function_calls(FunctionMap &found_functions);
+	void find_function_end(Walk &walk) const;
+	void find_dirty_pages();
+	void fix_overlaps();
+	void forget_functions(const QSet<yad64::address_t> &removed, const QSet<yad64::address_t> &rewalk);
+	QSet<yad64::address_t> functions_before(const QSet<yad64::address_t> &functions) const;
+	void hash_pages(int chunk);
+	void invalidate_dirty_functions();
+	const quint8 *jump_table_bytes(yad64::address_t address, std::size_t size) const;
+	QVector<yad64::address_t> read_jump_table(const JumpTable &table) const;
+	void set_function_type(Function *const *functions, int i) const;
+	void set_function_types();
+	void walk_function(Walk *walks, int i) const;
+	int walk_all_functions();
+
+private:
+	const AnalysisInput    input_;
+	const QVector<quint8>  bytes_;
+	const QList<DataSnapshot> data_;
+	FunctionMap            function_map_;
+	CallMap                calls_;
+	GraphMap               graphs_;
+	QVector<XrefIndex::Xref> xrefs_;   // the references made by the functions walked so far
+	QVector<XrefIndex::Xref> kept_xrefs_; // the ones kept from the previous analysis, sorted
+	XrefIndex              xref_index_;
+	QSet<yad64::address_t> walked_functions_;
+	QSet<yad64::address_t> typed_functions_; // the ones whose type is still right
+	QVector<quint64>       page_hashes_;
+	QVector<Range>         dirty_;     // pages which changed since the previous analysis, merged
+	bool                   incremental_;
+	bool                   unchanged_;
+	CancelledFunction      cancelled_;
+};
+
+#endif
@@ -0,0 +1,538 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "RegionAnalysis.h"
+#include "MemoryRegion.h"
+#include "TestUtil.h"
+#include <cstring>
+#include <iostream>
+
+// checks that analyzing a region again after some of its pages changed,
+// starting from the previous analysis, gives the same result as analyzing it
+// from scratch. the code is made up of small functions, one in each slot of
+// the region, which call each other and reference some data. every round
+// rewrites a few of them. none of them run into the next slot, since where a
+// walk which does stops depends on the order the functions were found in.
+// before that, it checks that the cases of a switch as gcc emits it are found,
+// through a table of either absolute addresses or offsets from the table,
+// in the region or in a data region of its own, and that none are found when
+// the index is overwritten between the bounds check and the jump
+
+namespace {
+
+const yad64::address_t base        = 0x400000;
+const std::size_t      slot_size   = 0x40;
+const int              slot_count  = 16;
+const int              data_slot   = slot_count - 1;
+const std::size_t      region_size = slot_size * slot_count;
+
+using test::next_random;
+
+// the analysis only needs the bounds of its region, so MemoryRegion gets a
+// plain implementation here rather than one from a debugger core
+class TestRegion : public IRegion {
+public:
+	TestRegion(yad64::address_t start, yad64::address_t end) : start_(start), end_(end) {
+	}
+
+public:
+	virtual IRegion *clone() const                       { return new TestRegion(start_, end_); }
+	virtual bool accessible() const                      { return true; }
+	virtual bool readable() const                        { return true; }
+	virtual bool writable() const                        { return false; }
+	virtual bool executable() const                      { return true; }
+	virtual yad64::address_t size() const                { return end_ - start_; }
+	virtual void set_permissions(bool, bool, bool)       {}
+	virtual yad64::address_t start() const               { return start_; }
+	virtual yad64::address_t end() const                 { return end_; }
+	virtual yad64::address_t base() const                { return start_; }
+	virtual QString name() const                         { return QString(); }
+	virtual permissions_t permissions() const            { return 0; }
+
+private:
+	yad64::address_t start_;
+	yad64::address_t end_;
+};
+
+}
+
+// src/MemoryRegion.cpp asks the debugger core for the implementation, which
+// the test doesn't have
+MemoryRegion::MemoryRegion(yad64::address_t start, yad64::address_t end, yad64::address_t, const QString &, IRegion::permissions_t) : impl_(new TestRegion(start, end)) {
+}
+
+MemoryRegion::MemoryRegion() : impl_(0) {
+}
+
+MemoryRegion::~MemoryRegion() {
+	delete impl_;
+}
+
+MemoryRegion::MemoryRegion(const MemoryRegion &other) : impl_(other.impl_ ? other.impl_->clone() : 0) {
+}
+
+MemoryRegion &MemoryRegion::operator=(const MemoryRegion &other) {
+	if(this != &other) {
+		MemoryRegion(other).swap(*this);
+	}
+	return *this;
+}
+
+void MemoryRegion::swap(MemoryRegion &other) {
+	qSwap(impl_, other.impl_);
+}
+
+yad64::address_t MemoryRegion::start() const {
+	return impl_ ? impl_->start() : 0;
+}
+
+yad64::address_t MemoryRegion::end() const {
+	return impl_ ? impl_->end() : 0;
+}
+
+yad64::address_t MemoryRegion::size() const {
+	return impl_ ? impl_->size() : 0;
+}
+
+bool MemoryRegion::contains(yad64::address_t address) const {
+	return impl_ && address >= impl_->start() && address <= impl_->end();
+}
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Name: put_rel32(QVector<quint8> &bytes, std::size_t &offset, quint8 opcode, std::size_t target)
+// Desc: a call or jmp to the target offset
+//------------------------------------------------------------------------------
+void put_rel32(QVector<quint8> &bytes, std::size_t &offset, quint8 opcode, std::size_t target) {
+	const qint32 rel = static_cast<qint32>(target - (offset + 5));
+	bytes[offset++] = opcode;
+	std::memcpy(&bytes[offset], &rel, sizeof(rel));
+	offset += sizeof(rel);
+}
+
+//------------------------------------------------------------------------------
+// Name: put_function(QVector<quint8> &bytes, int slot)
+// Desc: a random function which fits in its slot: maybe a frame, some calls,
+//       maybe a load of data, maybe a call which is jumped over, and then a
+//       ret or a tail jump
+//------------------------------------------------------------------------------
+void put_function(QVector<quint8> &bytes, int slot) {
+
+	std::size_t offset = slot * slot_size;
+	std::memset(&bytes[offset], 0xcc, slot_size);
+
+	const bool frame = next_random() & 1;
+	if(frame) {
+		static const quint8 prologue[] = { 0x55, 0x48, 0x89, 0xe5 }; // push rbp; mov rbp, rsp
+		std::memcpy(&bytes[offset], prologue, sizeof(prologue));
+		offset += sizeof(prologue);
+	}
+
+	for(quint32 calls = next_random() % 4; calls != 0; --calls) {
+		put_rel32(bytes, offset, 0xe8, (next_random() % data_slot) * slot_size);
+	}
+
+	if(next_random() & 1) {
+		// mov eax, [rip + disp32]
+		const qint32 disp = static_cast<qint32>(data_slot * slot_size + (next_random() % slot_size) - (offset + 6));
+		bytes[offset++] = 0x8b;
+		bytes[offset++] = 0x05;
+		std::memcpy(&bytes[offset], &disp, sizeof(disp));
+		offset += sizeof(disp);
+	}
+
+	if(next_random() & 1) {
+		// je over a call
+		bytes[offset++] = 0x74;
+		bytes[offset++] = 0x05;
+		put_rel32(bytes, offset, 0xe8, (next_random() % data_slot) * slot_size);
+	}
+
+	// a jmp back to the entry point is taken as a loop, and the walk would go
+	// on into the next slot
+	const int tail = next_random() % data_slot;
+	if(tail != slot && next_random() % 4 == 0) {
+		put_rel32(bytes, offset, 0xe9, tail * slot_size);
+	} else {
+		if(frame) {
+			bytes[offset++] = 0x5d; // pop rbp
+		}
+		bytes[offset++] = 0xc3;
+	}
+}
+
+void progress(int) {
+}
+
+bool not_cancelled() {
+	return false;
+}
+
+//------------------------------------------------------------------------------
+// Name: make_input(const QList<yad64::address_t> &known, yad64::address_t page_size, bool fuzzy)
+// Desc:
+//------------------------------------------------------------------------------
+AnalysisInput make_input(const QList<yad64::address_t> &known, yad64::address_t page_size, bool fuzzy) {
+	AnalysisInput input;
+	input.region          = MemoryRegion(base, base + region_size, base, QString(), 0);
+	input.page_size       = page_size;
+	input.known_functions = known;
+	input.mapped_regions.push_back(base);
+	input.mapped_regions.push_back(base + region_size);
+	input.fuzzy           = fuzzy;
+	input.previous_fuzzy  = fuzzy;
+	return input;
+}
+
+//------------------------------------------------------------------------------
+// Name: analyze(const AnalysisInput &input, const QVector<quint8> &bytes)
+// Desc:
+//------------------------------------------------------------------------------
+AnalysisResult analyze(const AnalysisInput &input, const QVector<quint8> &bytes) {
+
+	RegionAnalysis analysis(input, bytes, QList<DataSnapshot>());
+
+	AnalysisResult result;
+	result.region   = input.region;
+	result.fuzzy    = input.fuzzy;
+	result.complete = analysis.run(progress, not_cancelled);
+	result.unchanged   = analysis.unchanged();
+	result.functions   = analysis.functions();
+	result.calls       = analysis.calls();
+	result.graphs      = analysis.graphs();
+	result.xrefs       = analysis.xrefs();
+	result.page_hashes = analysis.page_hashes();
+	return result;
+}
+
+//------------------------------------------------------------------------------
+// Name: same_functions(const IAnalyzer::FunctionMap &a, const IAnalyzer::FunctionMap &b)
+// Desc:
+//------------------------------------------------------------------------------
+bool same_functions(const IAnalyzer::FunctionMap &a, const IAnalyzer::FunctionMap &b) {
+	if(a.size() != b.size()) {
+		return false;
+	}
+
+	for(IAnalyzer::FunctionMap::const_iterator i = a.begin(), j = b.begin(); i != a.end(); ++i, ++j) {
+		if(i->entry_address != j->entry_address || i->end_address != j->end_address || i->last_instruction != j->last_instruction || i->reference_count != j->reference_count || i->type != j->type) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: same_calls(const CallMap &a, const CallMap &b)
+// Desc:
+//------------------------------------------------------------------------------
+bool same_calls(const CallMap &a, const CallMap &b) {
+	if(a.size() != b.size()) {
+		return false;
+	}
+
+	for(CallMap::const_iterator it = a.begin(); it != a.end(); ++it) {
+		if(!b.contains(it.key()) || b.value(it.key()) != it.value()) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: same_graphs(const GraphMap &a, const GraphMap &b)
+// Desc:
+//------------------------------------------------------------------------------
+bool same_graphs(const GraphMap &a, const GraphMap &b) {
+	if(a.size() != b.size()) {
+		return false;
+	}
+
+	for(GraphMap::const_iterator it = a.begin(); it != a.end(); ++it) {
+		if(!b.contains(it.key())) {
+			return false;
+		}
+
+		const ControlFlowGraph &x = it.value();
+		const ControlFlowGraph y  = b.value(it.key());
+		if(x.blocks().size() != y.blocks().size() || x.edges().size() != y.edges().size()) {
+			return false;
+		}
+
+		for(int i = 0; i < x.blocks().size(); ++i) {
+			if(x.blocks()[i].start != y.blocks()[i].start || x.blocks()[i].end != y.blocks()[i].end || x.blocks()[i].last_instruction != y.blocks()[i].last_instruction) {
+				return false;
+			}
+		}
+
+		for(int i = 0; i < x.edges().size(); ++i) {
+			if(x.edges()[i].from != y.edges()[i].from || x.edges()[i].to != y.edges()[i].to || x.edges()[i].kind != y.edges()[i].kind) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: same_xrefs(const XrefIndex &a, const XrefIndex &b)
+// Desc:
+//------------------------------------------------------------------------------
+bool same_xrefs(const XrefIndex &a, const XrefIndex &b) {
+	const QVector<XrefIndex::Xref> x = a.xrefs();
+	const QVector<XrefIndex::Xref> y = b.xrefs();
+	if(x.size() != y.size()) {
+		return false;
+	}
+
+	for(int i = 0; i < x.size(); ++i) {
+		if(x[i].from != y[i].from || x[i].to != y[i].to || x[i].kind != y[i].kind) {
+			return false;
+		}
+	}
+	return true;
+}
+
+enum SwitchForm {
+	SWITCH_ABSOLUTE,
+	SWITCH_RELATIVE
+};
+
+//------------------------------------------------------------------------------
+// Name: check_switch(SwitchForm form, bool rodata, bool clobbered)
+// Desc: cmp edi, 3 / ja default / mov edi, edi, followed by either
+//       jmp [rdi*8 + table], or lea rdx, [rip + table] /
+//       movsxd rax, [rdx + rdi*4] / add rax, rdx / jmp rax, with the table
+//       after the code, or in a data region mapped after the region. when
+//       clobbered, the mov is mov edi, esi instead, so the index is no longer
+//       bounded by the cmp and no case may be taken from the table
+//------------------------------------------------------------------------------
+bool check_switch(SwitchForm form, bool rodata, bool clobbered) {
+
+	static const quint8 bound[] = {
+		0x83, 0xff, 0x03  // cmp edi, 3
+	};
+
+	static const quint8 absolute_dispatch[] = {
+		0xff, 0x24, 0xfd  // jmp [rdi*8 + disp32]
+	};
+
+	static const quint8 relative_dispatch[] = {
+		0x48, 0x63, 0x04, 0xba, // movsxd rax, [rdx + rdi*4]
+		0x48, 0x01, 0xd0,       // add rax, rdx
+		0xff, 0xe0              // jmp rax
+	};
+
+	const int              case_count  = 4;
+	const std::size_t      case_offset = 0x20;
+	const std::size_t      entry_size  = (form == SWITCH_RELATIVE) ? sizeof(qint32) : sizeof(yad64::address_t);
+	const yad64::address_t data_base   = base + 0x1000;
+	const yad64::address_t table       = rodata ? data_base : base + 0x100;
+
+	QVector<quint8> bytes(region_size);
+	std::memset(&bytes[0], 0xcc, region_size);
+
+	std::size_t offset = 0;
+	std::memcpy(&bytes[offset], bound, sizeof(bound));
+	offset += sizeof(bound);
+
+	// ja default, patched once the default is known
+	bytes[offset++] = 0x77;
+	const std::size_t ja_offset = offset++;
+
+	bytes[offset++] = 0x89;
+	bytes[offset++] = clobbered ? 0xf7 : 0xff; // mov edi, esi / mov edi, edi
+
+	if(form == SWITCH_RELATIVE) {
+		// lea rdx, [rip + disp32]
+		bytes[offset++] = 0x48;
+		bytes[offset++] = 0x8d;
+		bytes[offset++] = 0x15;
+		const qint32 disp = static_cast<qint32>(table - (base + offset + sizeof(qint32)));
+		std::memcpy(&bytes[offset], &disp, sizeof(disp));
+		offset += sizeof(disp);
+
+		std::memcpy(&bytes[offset], relative_dispatch, sizeof(relative_dispatch));
+		offset += sizeof(relative_dispatch);
+	} else {
+		std::memcpy(&bytes[offset], absolute_dispatch, sizeof(absolute_dispatch));
+		offset += sizeof(absolute_dispatch);
+
+		const qint32 disp = static_cast<qint32>(table);
+		std::memcpy(&bytes[offset], &disp, sizeof(disp));
+		offset += sizeof(disp);
+	}
+
+	bytes[ja_offset] = static_cast<quint8>(offset - (ja_offset + 1));
+	bytes[offset++] = 0xc3; // default: ret
+
+	// each case is xor eax, eax / ret
+	QVector<quint8> entries(case_count * entry_size);
+	for(int i = 0; i < case_count; ++i) {
+		const std::size_t case_start = case_offset + i * 4;
+		bytes[case_start + 0] = 0x31;
+		bytes[case_start + 1] = 0xc0;
+		bytes[case_start + 2] = 0xc3;
+
+		if(form == SWITCH_RELATIVE) {
+			const qint32 entry = static_cast<qint32>(base + case_start - table);
+			std::memcpy(&entries[i * entry_size], &entry, entry_size);
+		} else {
+			const yad64::address_t entry = base + case_start;
+			std::memcpy(&entries[i * entry_size], &entry, entry_size);
+		}
+	}
+
+	QList<yad64::address_t> known;
+	known.push_back(base);
+
+	AnalysisInput input = make_input(known, slot_size, false);
+	QList<DataSnapshot> data;
+	if(rodata) {
+		DataSnapshot snapshot;
+		snapshot.start = data_base;
+		snapshot.bytes = entries;
+		snapshot.bytes.resize(slot_size);
+		data.push_back(snapshot);
+
+		input.mapped_regions.push_back(data_base);
+		input.mapped_regions.push_back(data_base + slot_size);
+	} else {
+		std::memcpy(&bytes[table - base], entries.constData(), entries.size());
+	}
+
+	RegionAnalysis analysis(input, bytes, data);
+	if(!analysis.run(progress, not_cancelled) || !analysis.graphs().contains(base)) {
+		return false;
+	}
+
+	const ControlFlowGraph graph = analysis.graphs().value(base);
+
+	// with the index clobbered, the table bounds nothing, so it must be ignored
+	if(clobbered) {
+		Q_FOREACH(const ControlFlowGraph::Edge &edge, graph.edges()) {
+			if(edge.kind == ControlFlowGraph::EDGE_TABLE) {
+				return false;
+			}
+		}
+
+		return graph.find_block(base + case_offset) == -1;
+	}
+
+	// every case is a block the dispatch jumps to through the table
+	for(int i = 0; i < case_count; ++i) {
+		const int block = graph.find_block(base + case_offset + i * 4);
+		if(block == -1 || graph.blocks()[block].start != base + case_offset + i * 4) {
+			return false;
+		}
+
+		bool found = false;
+		Q_FOREACH(const ControlFlowGraph::Edge &edge, graph.edges()) {
+			if(edge.to == block && edge.kind == ControlFlowGraph::EDGE_TABLE) {
+				found = true;
+			}
+		}
+
+		if(!found) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+}
+
+int main() {
+
+	for(int form = SWITCH_ABSOLUTE; form <= SWITCH_RELATIVE; ++form) {
+		for(int rodata = 0; rodata < 2; ++rodata) {
+			for(int clobbered = 0; clobbered < 2; ++clobbered) {
+				test::performing() << (form == SWITCH_RELATIVE ? "relative" : "absolute") << " switch with its table " << (rodata ? "in a data region" : "in the region") << (clobbered ? ", index clobbered" : "") << test::ellipsis;
+				if(!check_switch(static_cast<SwitchForm>(form), rodata, clobbered)) {
+					test::failure() << (clobbered ? "cases were taken from the table" : "the cases were not found") << std::endl;
+					return test::fail();
+				}
+				test::ok() << std::endl;
+			}
+		}
+	}
+
+	static const yad64::address_t page_sizes[] = { slot_size / 2, slot_size, slot_size * 2 };
+
+	for(int round = 0; round < 256; ++round) {
+
+		const yad64::address_t page_size = page_sizes[round % 3];
+		const bool             fuzzy     = (round / 3) % 2;
+
+		QList<yad64::address_t> known;
+		known.push_back(base);
+		if(next_random() & 1) {
+			known.push_back(base + (next_random() % data_slot) * slot_size);
+		}
+
+		QVector<quint8> bytes(region_size);
+		for(int slot = 0; slot < data_slot; ++slot) {
+			put_function(bytes, slot);
+		}
+		std::memset(&bytes[data_slot * slot_size], 0, slot_size);
+
+		AnalysisResult previous = analyze(make_input(known, page_size, fuzzy), bytes);
+
+		for(int change = 0; change < 8; ++change) {
+
+			test::performing() << "round " << round << " change " << change << " (page size " << page_size << (fuzzy ? ", fuzzy" : "") << ")" << test::ellipsis;
+
+			for(quint32 n = 1 + next_random() % 3; n != 0; --n) {
+				put_function(bytes, next_random() % data_slot);
+			}
+
+			AnalysisInput input = make_input(known, page_size, fuzzy);
+			input.previous_functions   = previous.functions;
+			input.previous_calls       = previous.calls;
+			input.previous_graphs      = previous.graphs;
+			input.previous_xrefs       = previous.xrefs;
+			input.previous_page_hashes = previous.page_hashes;
+
+			const AnalysisResult incremental = analyze(input, bytes);
+			const AnalysisResult full        = analyze(make_input(known, page_size, fuzzy), bytes);
+
+			if(!incremental.complete || !full.complete) {
+				test::failure() << "the analysis did not finish" << std::endl;
+				return test::fail();
+			}
+
+			const bool functions = same_functions(incremental.functions, full.functions);
+			const bool calls     = same_calls(incremental.calls, full.calls);
+			const bool graphs    = same_graphs(incremental.graphs, full.graphs);
+			const bool xrefs     = same_xrefs(incremental.xrefs, full.xrefs);
+
+			if(!functions || !calls || !graphs || !xrefs) {
+				test::failure() << "functions: " << incremental.functions.size() << " vs " << full.functions.size() << (functions ? "" : " DIFFERENT") << std::endl;
+				std::cout << "calls:     " << incremental.calls.size() << " vs " << full.calls.size() << (calls ? "" : " DIFFERENT") << std::endl;
+				std::cout << "graphs:    " << incremental.graphs.size() << " vs " << full.graphs.size() << (graphs ? "" : " DIFFERENT") << std::endl;
+				std::cout << "xrefs:     " << incremental.xrefs.size() << " vs " << full.xrefs.size() << (xrefs ? "" : " DIFFERENT") << std::endl;
+				return test::fail();
+			}
+
+			test::ok() << std::endl;
+			previous = incremental;
+		}
+	}
+}
@@ -19,6 +19,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "BinarySearcher.h"
 #include "DialogBinaryString.h"
 #include "DialogASCIIString.h"
+#include "DialogRegexSearch.h"
 #include "Debugger.h"
 #include <QMenu>
 
@@ -44,6 +45,7 @@ QMenu *BinarySearcher::menu(QWidget *parent) {
 	if(menu_ == 0) {
 		menu_ = new QMenu(tr("BinarySearcher"), parent);
 		menu_->addAction(tr("&Binary String Search"), this, SLOT(show_menu()), QKeySequence(tr("Ctrl+F")));
+		menu_->addAction(tr("&Regular Expression Search"), this, SLOT(show_regex()));
 	}
 
 	return menu_;
@@ -73,6 +75,15 @@ void BinarySearcher::show_menu() {
 	dialog->show();
 }
 
+//------------------------------------------------------------------------------
+// Name: show_regex()
+// Desc:
+//------------------------------------------------------------------------------
+void BinarySearcher::show_regex() {
+	static QDialog *const dialog = new DialogRegexSearch(yad64::v1::debugger_ui);
+	dialog->show();
+}
+
 //------------------------------------------------------------------------------
 // Name: mnuStackFindASCII()
 // Desc:
@@ -40,6 +40,7 @@ public:
 
 public Q_SLOTS:
 	void show_menu();
+	void show_regex();
 	void mnuStackFindASCII();
 
 private:
@@ -1,7 +1,9 @@
 
 include(../plugins.pri)
 
+DEFINES += USE_QT_CONCURRENT
+
 # Input
-HEADERS += BinarySearcher.h DialogBinaryString.h DialogASCIIString.h
-FORMS += dialogbinarystring.ui dialogasciistring.ui
-SOURCES += BinarySearcher.cpp DialogBinaryString.cpp DialogASCIIString.cpp
+HEADERS += BinarySearcher.h DialogBinaryString.h DialogASCIIString.h PatternSearcher.h DialogRegexSearch.h RegexSearcher.h
+FORMS += dialogbinarystring.ui dialogasciistring.ui dialogregexsearch.ui
+SOURCES += BinarySearcher.cpp DialogBinaryString.cpp DialogASCIIString.cpp PatternSearcher.cpp DialogRegexSearch.cpp RegexSearcher.cpp
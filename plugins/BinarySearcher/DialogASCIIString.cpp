@@ -18,6 +18,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "DialogASCIIString.h"
 #include "IDebuggerCore.h"
+#include "Job.h"
 #include "MemoryRegions.h"
 #include "Debugger.h"
 #include "Util.h"
@@ -25,11 +26,76 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "Debugger.h"
 
 #include <QVector>
-#include <QMessageBox>
 #include <cstring>
 
 #include "ui_dialogasciistring.h"
 
+namespace {
+
+class SearchJob : public Job {
+public:
+	SearchJob(const QByteArray &string, const MemoryRegion &region, yad64::address_t stack_ptr);
+
+public:
+	virtual void run();
+
+private:
+	const QByteArray       string_;
+	const yad64::address_t stack_ptr_;
+	const yad64::address_t stack_end_;
+};
+
+//------------------------------------------------------------------------------
+// Name: SearchJob(...)
+// Desc:
+//------------------------------------------------------------------------------
+SearchJob::SearchJob(const QByteArray &string, const MemoryRegion &region, yad64::address_t stack_ptr) :
+		string_(string),
+		stack_ptr_(stack_ptr),
+		stack_end_(region.end()) {
+}
+
+//------------------------------------------------------------------------------
+// Name: run()
+// Desc: looks for stack entries which point to the string
+//------------------------------------------------------------------------------
+void SearchJob::run() {
+
+	const int sz = string_.size();
+	const std::size_t count = (stack_end_ - stack_ptr_) / sizeof(yad64::address_t);
+
+	try {
+		// the stack itself is read in one go, only what it points to is read
+		// one value at a time
+		QVector<yad64::address_t> stack(count);
+		QVector<quint8>           chars(sz);
+
+		if(count == 0 || !read_bytes(stack_ptr_, &stack[0], count * sizeof(yad64::address_t))) {
+			return;
+		}
+
+		ResultStore found;
+		for(std::size_t i = 0; i < count && !cancelled(); ++i) {
+			if(read_bytes(stack[i], &chars[0], sz)) {
+				if(std::memcmp(&chars[0], string_.constData(), sz) == 0) {
+					found.append(stack_ptr_ + i * sizeof(yad64::address_t));
+				}
+			}
+			set_progress(util::percentage(i, count));
+		}
+
+		report_results(found);
+	} catch(const std::bad_alloc &) {
+		report_error(
+			DialogASCIIString::tr("Memroy Allocation Error"),
+			DialogASCIIString::tr("Unable to satisfy memory allocation request for search string."));
+	}
+
+	set_progress(100);
+}
+
+}
+
 //------------------------------------------------------------------------------
 // Name: DialogASCIIString(QWidget *parent)
 // Desc: constructor
@@ -45,68 +111,70 @@ DialogASCIIString::DialogASCIIString(QWidget *parent) : QDialog(parent), ui(new
 // Desc:
 //------------------------------------------------------------------------------
 DialogASCIIString::~DialogASCIIString() {
+	if(job_) {
+		job_->cancel();
+	}
 	delete ui;
 }
 
 //------------------------------------------------------------------------------
-// Name: do_find()
-// Desc:
+// Name: on_btnFind_clicked()
+// Desc: find button event handler, while a search runs it cancels it instead
 //------------------------------------------------------------------------------
-void DialogASCIIString::do_find() {
+void DialogASCIIString::on_btnFind_clicked() {
+
+	if(job_) {
+		job_->cancel();
+		return;
+	}
 
 	const QByteArray b = ui->txtASCII->text().toAscii();
 	ui->listWidget->clear();
 
-	const int sz = b.size();
-	if(sz != 0) {
-
-		yad64::v1::memory_regions().sync();
-
-		MemoryRegion region;
-		
-		State state;
-		yad64::v1::debugger_core->get_state(state);
-		yad64::address_t stack_ptr = state.stack_pointer();
-
-		if(yad64::v1::memory_regions().find_region(stack_ptr, region)) {
-			std::size_t count = (region.end() - stack_ptr) / sizeof(yad64::address_t);
-
-			try {
-				QVector<quint8> chars(sz);
-
-				int i = 0;
-				while(stack_ptr < region.end()) {
-					// get the value from the stack
-					yad64::address_t value;
-					if(yad64::v1::debugger_core->read_bytes(stack_ptr, &value, sizeof(yad64::address_t))) {
-						if(yad64::v1::debugger_core->read_bytes(value, &chars[0], sz)) {
-							if(std::memcmp(&chars[0], b.constData(), sz) == 0) {
-								ui->listWidget->addItem(yad64::v1::format_pointer(stack_ptr));
-							}
-						}
-					}
-					ui->progressBar->setValue(util::percentage(i++, count));
-					stack_ptr += sizeof(yad64::address_t);
-				}
-			} catch(const std::bad_alloc &) {
-				QMessageBox::information(0, tr("Memroy Allocation Error"),
-					tr("Unable to satisfy memory allocation request for search string."));
-			}
-		}
+	if(b.isEmpty()) {
+		return;
+	}
+
+	yad64::v1::memory_regions().sync();
+
+	State state;
+	yad64::v1::debugger_core->get_state(state);
+	const yad64::address_t stack_ptr = state.stack_pointer();
+
+	MemoryRegion region;
+	if(yad64::v1::memory_regions().find_region(stack_ptr, region)) {
+		job_ = new SearchJob(b, region, stack_ptr);
+
+		connect(job_, SIGNAL(progress(int)), ui->progressBar, SLOT(setValue(int)));
+		connect(job_, SIGNAL(results(const ResultStore &)), this, SLOT(add_results(const ResultStore &)));
+		connect(job_, SIGNAL(finished(bool)), this, SLOT(job_finished(bool)));
+
+		ui->progressBar->setValue(0);
+		ui->btnFind->setText(tr("&Cancel"));
+		yad64::v1::submit_job(job_);
 	}
 }
 
 //------------------------------------------------------------------------------
-// Name: on_btnFind_clicked()
-// Desc: find button event handler
+// Name: add_results(const ResultStore &results)
+// Desc:
 //------------------------------------------------------------------------------
-void DialogASCIIString::on_btnFind_clicked() {
+void DialogASCIIString::add_results(const ResultStore &results) {
+	for(int i = 0; i < results.size(); ++i) {
+		ui->listWidget->addItem(yad64::v1::format_pointer(results.address(i)));
+	}
+}
 
-	ui->btnFind->setEnabled(false);
-	ui->progressBar->setValue(0);
-	do_find();
-	ui->progressBar->setValue(100);
-	ui->btnFind->setEnabled(true);
+//------------------------------------------------------------------------------
+// Name: job_finished(bool cancelled)
+// Desc:
+//------------------------------------------------------------------------------
+void DialogASCIIString::job_finished(bool cancelled) {
+	job_ = 0;
+	if(!cancelled) {
+		ui->progressBar->setValue(100);
+	}
+	ui->btnFind->setText(tr("&Find"));
 }
 
 //------------------------------------------------------------------------------
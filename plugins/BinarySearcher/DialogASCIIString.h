@@ -20,8 +20,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define DIALOGASCIISTRING_20082201_H_
 
 #include <QDialog>
+#include <QPointer>
 
+class Job;
 class QListWidgetItem;
+class ResultStore;
 
 namespace Ui { class DialogASCIIString; }
 
@@ -36,11 +39,13 @@ public Q_SLOTS:
 	void on_btnFind_clicked();
 	void on_listWidget_itemDoubleClicked(QListWidgetItem *);
 
-private:
-	void do_find();
+private Q_SLOTS:
+	void add_results(const ResultStore &results);
+	void job_finished(bool cancelled);
 
 private:
 	 Ui::DialogASCIIString *const ui;
+	 QPointer<Job>                job_;
 };
 
 #endif
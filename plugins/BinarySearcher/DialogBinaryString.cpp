@@ -18,18 +18,109 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "DialogBinaryString.h"
 #include "IDebuggerCore.h"
+#include "Job.h"
 #include "MemoryRegions.h"
 #include "Debugger.h"
-#include "ByteShiftArray.h"
+#include "PatternSearcher.h"
+#include "ResultsModel.h"
+#include "ResultsView.h"
 #include "Util.h"
-#include "Debugger.h"
 
 #include <QVector>
 #include <QMessageBox>
-#include <cstring>
+#include <QStringList>
 
 #include "ui_dialogbinarystring.h"
 
+namespace {
+
+// searches one chunk of a region, for Job::map_chunks
+class SearchChunk {
+public:
+	typedef PatternMatches result_type;
+
+public:
+	explicit SearchChunk(const PatternSearcher &searcher) : searcher_(&searcher) {
+	}
+
+public:
+	PatternMatches operator()(const Job::Chunk &chunk) const {
+		PatternMatches matches;
+		searcher_->search(chunk.bytes.constData(), chunk.bytes.size(), chunk.base, chunk.first, chunk.last, matches);
+		return matches;
+	}
+
+private:
+	const PatternSearcher *searcher_;
+};
+
+class SearchJob : public Job {
+public:
+	SearchJob(const QList<BinaryPattern> &patterns, const QStringList &names, unsigned int alignment, bool skip_no_access);
+
+public:
+	virtual void run();
+
+private:
+	const PatternSearcher     searcher_;
+	const QStringList         names_;
+	const QList<MemoryRegion> regions_;
+	const yad64::address_t    page_size_;
+	const bool                skip_no_access_;
+};
+
+//------------------------------------------------------------------------------
+// Name: SearchJob(...)
+// Desc: the regions are taken here, on the GUI thread
+//------------------------------------------------------------------------------
+SearchJob::SearchJob(const QList<BinaryPattern> &patterns, const QStringList &names, unsigned int alignment, bool skip_no_access) :
+		searcher_(patterns, alignment),
+		names_(names),
+		regions_(yad64::v1::memory_regions().regions()),
+		page_size_(yad64::v1::debugger_core->page_size()),
+		skip_no_access_(skip_no_access) {
+}
+
+//------------------------------------------------------------------------------
+// Name: run()
+// Desc: reads one region at a time in bulk and searches it on all threads
+//------------------------------------------------------------------------------
+void SearchJob::run() {
+
+	int i = 0;
+	Q_FOREACH(const MemoryRegion &region, regions_) {
+
+		if(cancelled()) {
+			return;
+		}
+
+		set_progress(util::percentage(i++, regions_.size()));
+
+		// a short circut for speading things up
+		if(skip_no_access_ && !region.accessible()) {
+			continue;
+		}
+
+		const QVector<quint8> pages = read_buffer(region.start(), region.size() / page_size_, page_size_);
+		if(!pages.isEmpty()) {
+			const QList<PatternMatches> results = map_chunks(pages, region.start(), SearchChunk(searcher_));
+
+			ResultStore found;
+			Q_FOREACH(const PatternMatches &matches, results) {
+				Q_FOREACH(const PatternMatch &match, matches) {
+					found.append(match.address, names_[match.pattern]);
+				}
+			}
+
+			report_results(found);
+		}
+	}
+
+	set_progress(100);
+}
+
+}
+
 //------------------------------------------------------------------------------
 // Name: DialogBinaryString(QWidget *parent)
 // Desc: constructor
@@ -37,7 +128,6 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 DialogBinaryString::DialogBinaryString(QWidget *parent) : QDialog(parent), ui(new Ui::DialogBinaryString) {
 	ui->setupUi(this);
 	ui->progressBar->setValue(0);
-	ui->listWidget->clear();
 }
 
 //------------------------------------------------------------------------------
@@ -45,96 +135,95 @@ DialogBinaryString::DialogBinaryString(QWidget *parent) : QDialog(parent), ui(ne
 // Desc:
 //------------------------------------------------------------------------------
 DialogBinaryString::~DialogBinaryString() {
+	if(job_) {
+		job_->cancel();
+	}
 	delete ui;
 }
 
 //------------------------------------------------------------------------------
-// Name: do_find()
-// Desc:
+// Name: patterns(QList<BinaryPattern> &patterns, QStringList &names)
+// Desc: collects the binary string and any extra (possibly wildcarded)
+//       patterns, returns false if one of them could not be parsed
 //------------------------------------------------------------------------------
-void DialogBinaryString::do_find() {
+bool DialogBinaryString::patterns(QList<BinaryPattern> &patterns, QStringList &names) {
 
 	const QByteArray b = ui->binaryString->value();
-	ui->listWidget->clear();
+	if(!b.isEmpty()) {
+		patterns.append(PatternSearcher::make_pattern(b));
+		names.append(QString());
+	}
 
-	const int sz = b.size();
-	if(sz != 0) {
-		ByteShiftArray bsa(sz);
+	Q_FOREACH(const QString &s, ui->txtPatterns->text().split(';', QString::SkipEmptyParts)) {
+		if(s.trimmed().isEmpty()) {
+			continue;
+		}
 
-		yad64::v1::memory_regions().sync();
-		const QList<MemoryRegion> regions = yad64::v1::memory_regions().regions();
-		const yad64::address_t page_size = yad64::v1::debugger_core->page_size();
+		BinaryPattern pattern;
+		if(!PatternSearcher::parse_pattern(s, pattern)) {
+			QMessageBox::information(
+				this,
+				tr("Invalid Pattern"),
+				tr("\"%1\" is not a valid pattern. Patterns are hex bytes, ?? matches any byte.").arg(s.trimmed()));
+			return false;
+		}
 
-		int i = 0;
-		Q_FOREACH(const MemoryRegion &region, regions) {
+		patterns.append(pattern);
+		names.append(s.simplified());
+	}
 
-			bsa.clear();
+	return true;
+}
 
-			// a short circut for speading things up
-			if(ui->chkSkipNoAccess->isChecked() && !region.accessible()) {
-				ui->progressBar->setValue(util::percentage(++i, regions.size()));
-				continue;
-			}
+//------------------------------------------------------------------------------
+// Name: on_btnFind_clicked()
+// Desc: find button event handler, while a search runs it cancels it instead
+//------------------------------------------------------------------------------
+void DialogBinaryString::on_btnFind_clicked() {
 
-			const yad64::address_t size_in_pages = region.size() / page_size;
-			try {
-				QVector<quint8> pages(size_in_pages * page_size);
-				const quint8 *const pages_end = &pages[0] + region.size();
+	if(job_) {
+		job_->cancel();
+		return;
+	}
 
-				if(yad64::v1::debugger_core->read_pages(region.start(), &pages[0], size_in_pages)) {
-					const quint8 *p = &pages[0];
-					QString temp;
-					while(p != pages_end) {
-						// shift in the next byte
-						bsa << *p;
+	ui->results->model()->clear();
 
-						// compare values..
-						if(std::memcmp(bsa.data(), b.constData(), sz) == 0) {
-							const yad64::address_t addr = (p - &pages[0] + region.start()) - sz + 1;
-							const yad64::address_t align = 1 << (ui->cmbAlignment->currentIndex() + 1);
+	QList<BinaryPattern> search_patterns;
+	QStringList          names;
+	if(!patterns(search_patterns, names) || search_patterns.isEmpty()) {
+		return;
+	}
 
-							if(!ui->chkAlignment->isChecked() || (addr % align) == 0) {
-								ui->listWidget->addItem(yad64::v1::format_pointer(addr));
-							}
-						}
+	const unsigned int alignment = ui->chkAlignment->isChecked() ? 1 << (ui->cmbAlignment->currentIndex() + 1) : 1;
 
-						ui->progressBar->setValue(util::percentage(i, regions.size(), p - &pages[0], region.size()));
+	yad64::v1::memory_regions().sync();
+	job_ = new SearchJob(search_patterns, names, alignment, ui->chkSkipNoAccess->isChecked());
 
-						++p;
-					}
-				}
-				++i;
-			} catch(const std::bad_alloc &) {
-				QMessageBox::information(
-					0,
-					tr("Memroy Allocation Error"),
-					tr("Unable to satisfy memory allocation request for requested region."));
-			}
-		}
-	}
+	connect(job_, SIGNAL(progress(int)), ui->progressBar, SLOT(setValue(int)));
+	connect(job_, SIGNAL(results(const ResultStore &)), ui->results->model(), SLOT(append(const ResultStore &)));
+	connect(job_, SIGNAL(finished(bool)), this, SLOT(job_finished(bool)));
+
+	ui->progressBar->setValue(0);
+	ui->btnFind->setText(tr("&Cancel"));
+	yad64::v1::submit_job(job_);
 }
 
 //------------------------------------------------------------------------------
-// Name: on_btnFind_clicked()
-// Desc: find button event handler
+// Name: job_finished(bool cancelled)
+// Desc:
 //------------------------------------------------------------------------------
-void DialogBinaryString::on_btnFind_clicked() {
-
-	ui->btnFind->setEnabled(false);
-	ui->progressBar->setValue(0);
-	do_find();
-	ui->progressBar->setValue(100);
-	ui->btnFind->setEnabled(true);
+void DialogBinaryString::job_finished(bool cancelled) {
+	job_ = 0;
+	if(!cancelled) {
+		ui->progressBar->setValue(100);
+	}
+	ui->btnFind->setText(tr("&Find"));
 }
 
 //------------------------------------------------------------------------------
-// Name: on_listWidget_itemDoubleClicked(QListWidgetItem *item)
+// Name: on_results_doubleClicked(const QModelIndex &index)
 // Desc: follows the found item in the data view
 //------------------------------------------------------------------------------
-void DialogBinaryString::on_listWidget_itemDoubleClicked(QListWidgetItem *item) {
-	bool ok;
-	const yad64::address_t addr = yad64::v1::string_to_address(item->text(), ok);
-	if(ok) {
-		yad64::v1::dump_data(addr, false);
-	}
+void DialogBinaryString::on_results_doubleClicked(const QModelIndex &index) {
+	yad64::v1::dump_data(ui->results->model()->address(index), false);
 }
@@ -20,8 +20,13 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define DIALOGBINARYSTRING_20061101_H_
 
 #include <QDialog>
+#include <QList>
+#include <QPointer>
 
-class QListWidgetItem;
+class Job;
+class QModelIndex;
+class QStringList;
+struct BinaryPattern;
 
 namespace Ui { class DialogBinaryString; }
 
@@ -34,13 +39,17 @@ public:
 
 public Q_SLOTS:
 	void on_btnFind_clicked();
-	void on_listWidget_itemDoubleClicked(QListWidgetItem *);
+	void on_results_doubleClicked(const QModelIndex &index);
+
+private Q_SLOTS:
+	void job_finished(bool cancelled);
 
 private:
-	void do_find();
+	bool patterns(QList<BinaryPattern> &patterns, QStringList &names);
 
 private:
 	 Ui::DialogBinaryString *const ui;
+	 QPointer<Job>                 job_;
 };
 
 #endif
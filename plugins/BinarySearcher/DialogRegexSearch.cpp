@@ -0,0 +1,364 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "DialogRegexSearch.h"
+#include "IDebuggerCore.h"
+#include "Job.h"
+#include "MemoryRegions.h"
+#include "Debugger.h"
+#include "RegexSearcher.h"
+#include "ResultsModel.h"
+#include "ResultsView.h"
+#include "Util.h"
+
+#include <QVector>
+#include <QMessageBox>
+
+#include <algorithm>
+
+#include "ui_dialogregexsearch.h"
+
+namespace {
+
+// how much of each match is shown in the results
+const int preview_length = 48;
+
+// how far a rule is searched again at a time when a match of the previous
+// chunk ran on into the chunk, until it finds what the chunk found
+const std::size_t rescan_length = RegexSearcher::MAX_MATCH_LENGTH * 4;
+
+// searches one chunk of a region, for Job::map_chunks
+class SearchChunk {
+public:
+	typedef RegexMatches result_type;
+
+public:
+	explicit SearchChunk(const RegexSearcher &searcher) : searcher_(&searcher) {
+	}
+
+public:
+	RegexMatches operator()(const Job::Chunk &chunk) const {
+		RegexMatches matches;
+		searcher_->search(chunk.bytes.constData(), chunk.bytes.size(), chunk.base, chunk.first, chunk.last, matches);
+		return matches;
+	}
+
+private:
+	const RegexSearcher *searcher_;
+};
+
+//------------------------------------------------------------------------------
+// Name: preview(const quint8 *data, std::size_t size)
+// Desc: the start of a match, with anything unprintable escaped
+//------------------------------------------------------------------------------
+QString preview(const quint8 *data, std::size_t size) {
+
+	QString text;
+	for(std::size_t i = 0; i < qMin<std::size_t>(size, preview_length); ++i) {
+		if(data[i] >= 0x20 && data[i] < 0x7f && data[i] != '\\') {
+			text.append(QChar(data[i]));
+		} else {
+			text.append(QString("\\x%1").arg(data[i], 2, 16, QChar('0')));
+		}
+	}
+
+	if(size > static_cast<std::size_t>(preview_length)) {
+		text.append("...");
+	}
+
+	return text;
+}
+
+//------------------------------------------------------------------------------
+// Name: match_less_than(const RegexMatch &a, const RegexMatch &b)
+// Desc:
+//------------------------------------------------------------------------------
+bool match_less_than(const RegexMatch &a, const RegexMatch &b) {
+	if(a.address != b.address) {
+		return a.address < b.address;
+	}
+	return a.rule < b.rule;
+}
+
+//------------------------------------------------------------------------------
+// Name: merge_chunk(const RegexSearcher &searcher, const Job::Chunk &chunk, const RegexMatches &matches, QVector<std::size_t> &rule_end, RegexMatches &merged)
+// Desc: appends the matches of a chunk to those of the chunks before it.
+//       rule_end is where the last match of each rule so far ends
+// Note: a chunk is searched without knowing where the previous chunk's matches
+//       end. when one runs on into the chunk, the chunk's own matches of that
+//       rule are wrong up to the first one which a search resuming at its end
+//       finds as well, so that stretch is searched again here. dropping the
+//       matches which overlap afterwards isn't enough, the chunk's search has
+//       already resumed past them
+//------------------------------------------------------------------------------
+void merge_chunk(const RegexSearcher &searcher, const Job::Chunk &chunk, const RegexMatches &matches, QVector<std::size_t> &rule_end, RegexMatches &merged) {
+
+	const int found = merged.size();
+
+	QVector<bool> overlapped(rule_end.size());
+	for(int rule = 0; rule < rule_end.size(); ++rule) {
+		overlapped[rule] = rule_end[rule] > chunk.first;
+	}
+
+	Q_FOREACH(const RegexMatch &match, matches) {
+		if(!overlapped[match.rule]) {
+			merged.push_back(match);
+			rule_end[match.rule] = match.address - chunk.base + match.length;
+		}
+	}
+
+	for(int rule = 0; rule < rule_end.size(); ++rule) {
+
+		if(!overlapped[rule]) {
+			continue;
+		}
+
+		RegexMatches own;
+		Q_FOREACH(const RegexMatch &match, matches) {
+			if(match.rule == rule) {
+				own.push_back(match);
+			}
+		}
+
+		std::size_t resume = rule_end[rule];
+		int         i      = 0;
+		bool        synced = false;
+
+		while(!synced && resume < chunk.last) {
+			const std::size_t last = qMin(chunk.last, resume + rescan_length);
+
+			RegexMatches rescanned;
+			searcher.search(chunk.bytes.constData(), chunk.bytes.size(), chunk.base, resume, last, rescanned);
+
+			Q_FOREACH(const RegexMatch &match, rescanned) {
+				if(match.rule != rule) {
+					continue;
+				}
+
+				while(i < own.size() && own[i].address < match.address) {
+					++i;
+				}
+
+				// from here on the chunk found the same matches
+				if(i < own.size() && own[i].address == match.address && own[i].length == match.length) {
+					synced = true;
+					break;
+				}
+
+				merged.push_back(match);
+				resume = match.address - chunk.base + match.length;
+			}
+
+			resume = qMax(resume, last);
+		}
+
+		if(!synced) {
+			i = own.size();
+		}
+
+		for(; i < own.size(); ++i) {
+			merged.push_back(own[i]);
+			resume = own[i].address - chunk.base + own[i].length;
+		}
+
+		rule_end[rule] = resume;
+	}
+
+	std::sort(merged.begin() + found, merged.end(), match_less_than);
+}
+
+class SearchJob : public Job {
+public:
+	SearchJob(const RegexSearcher &searcher, const QList<RegexRule> &rules, bool skip_no_access);
+
+public:
+	virtual void run();
+
+private:
+	const RegexSearcher       searcher_;
+	const QList<RegexRule>    rules_;
+	const QList<MemoryRegion> regions_;
+	const yad64::address_t    page_size_;
+	const bool                skip_no_access_;
+};
+
+//------------------------------------------------------------------------------
+// Name: SearchJob(...)
+// Desc: the regions are taken here, on the GUI thread
+//------------------------------------------------------------------------------
+SearchJob::SearchJob(const RegexSearcher &searcher, const QList<RegexRule> &rules, bool skip_no_access) :
+		searcher_(searcher),
+		rules_(rules),
+		regions_(yad64::v1::memory_regions().regions()),
+		page_size_(yad64::v1::debugger_core->page_size()),
+		skip_no_access_(skip_no_access) {
+}
+
+//------------------------------------------------------------------------------
+// Name: run()
+// Desc: reads one region at a time in bulk and searches it on all threads
+//------------------------------------------------------------------------------
+void SearchJob::run() {
+
+	int i = 0;
+	Q_FOREACH(const MemoryRegion &region, regions_) {
+
+		if(cancelled()) {
+			return;
+		}
+
+		set_progress(util::percentage(i++, regions_.size()));
+
+		// a short circut for speading things up
+		if(skip_no_access_ && !region.accessible()) {
+			continue;
+		}
+
+		const QVector<quint8> pages = read_buffer(region.start(), region.size() / page_size_, page_size_);
+		if(!pages.isEmpty()) {
+			QList<Chunk> chunks;
+			split_chunks(pages, region.start(), 0, pages.size(), 0, chunks);
+
+			const QList<RegexMatches> results = map_chunks(chunks, SearchChunk(searcher_));
+
+			const QString region_name = region.name().isEmpty() ? yad64::v1::format_pointer(region.start()) : region.name();
+
+			QVector<std::size_t> rule_end(rules_.size(), 0);
+
+			RegexMatches matches;
+			for(int j = 0; j < chunks.size(); ++j) {
+				merge_chunk(searcher_, chunks[j], results[j], rule_end, matches);
+			}
+
+			ResultStore found;
+			Q_FOREACH(const RegexMatch &match, matches) {
+				const std::size_t offset = match.address - region.start();
+				const QString text = QString("%1+%2 [%3] %4")
+					.arg(region_name)
+					.arg(offset, 0, 16)
+					.arg(rules_[match.rule].name)
+					.arg(preview(&pages[offset], match.length));
+
+				found.append(match.address, text);
+			}
+
+			report_results(found);
+		}
+	}
+
+	set_progress(100);
+}
+
+}
+
+//------------------------------------------------------------------------------
+// Name: DialogRegexSearch(QWidget *parent)
+// Desc: constructor
+//------------------------------------------------------------------------------
+DialogRegexSearch::DialogRegexSearch(QWidget *parent) : QDialog(parent), ui(new Ui::DialogRegexSearch) {
+	ui->setupUi(this);
+	ui->progressBar->setValue(0);
+}
+
+//------------------------------------------------------------------------------
+// Name: ~DialogRegexSearch()
+// Desc:
+//------------------------------------------------------------------------------
+DialogRegexSearch::~DialogRegexSearch() {
+	if(job_) {
+		job_->cancel();
+	}
+	delete ui;
+}
+
+//------------------------------------------------------------------------------
+// Name: rules(QList<RegexRule> &rules)
+// Desc: parses the rules, returns false if one of them is invalid
+//------------------------------------------------------------------------------
+bool DialogRegexSearch::rules(QList<RegexRule> &rules) {
+
+	QString error;
+	if(!RegexSearcher::parse_rules(ui->txtRules->toPlainText(), rules, error)) {
+		QMessageBox::information(this, tr("Invalid Rule"), error);
+		return false;
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: on_btnFind_clicked()
+// Desc: find button event handler, while a search runs it cancels it instead
+//------------------------------------------------------------------------------
+void DialogRegexSearch::on_btnFind_clicked() {
+
+	if(job_) {
+		job_->cancel();
+		return;
+	}
+
+	ui->results->model()->clear();
+
+	QList<RegexRule> search_rules;
+	if(!rules(search_rules)) {
+		return;
+	}
+
+	RegexSearcher searcher;
+
+	QString error;
+	if(!searcher.compile(search_rules, ui->chkCaseSensitive->isChecked(), error)) {
+		QMessageBox::information(this, tr("Invalid Rule"), error);
+		return;
+	}
+
+	if(searcher.empty()) {
+		return;
+	}
+
+	yad64::v1::memory_regions().sync();
+	job_ = new SearchJob(searcher, search_rules, ui->chkSkipNoAccess->isChecked());
+
+	connect(job_, SIGNAL(progress(int)), ui->progressBar, SLOT(setValue(int)));
+	connect(job_, SIGNAL(results(const ResultStore &)), ui->results->model(), SLOT(append(const ResultStore &)));
+	connect(job_, SIGNAL(finished(bool)), this, SLOT(job_finished(bool)));
+
+	ui->progressBar->setValue(0);
+	ui->btnFind->setText(tr("&Cancel"));
+	yad64::v1::submit_job(job_);
+}
+
+//------------------------------------------------------------------------------
+// Name: job_finished(bool cancelled)
+// Desc:
+//------------------------------------------------------------------------------
+void DialogRegexSearch::job_finished(bool cancelled) {
+	job_ = 0;
+	if(!cancelled) {
+		ui->progressBar->setValue(100);
+	}
+	ui->btnFind->setText(tr("&Find"));
+}
+
+//------------------------------------------------------------------------------
+// Name: on_results_doubleClicked(const QModelIndex &index)
+// Desc: follows the found item in the data view
+//------------------------------------------------------------------------------
+void DialogRegexSearch::on_results_doubleClicked(const QModelIndex &index) {
+	yad64::v1::dump_data(ui->results->model()->address(index), false);
+}
@@ -0,0 +1,54 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef DIALOGREGEXSEARCH_20121017_H_
+#define DIALOGREGEXSEARCH_20121017_H_
+
+#include <QDialog>
+#include <QList>
+#include <QPointer>
+
+class Job;
+class QModelIndex;
+struct RegexRule;
+
+namespace Ui { class DialogRegexSearch; }
+
+class DialogRegexSearch : public QDialog {
+	Q_OBJECT
+
+public:
+	DialogRegexSearch(QWidget *parent = 0);
+	virtual ~DialogRegexSearch();
+
+public Q_SLOTS:
+	void on_btnFind_clicked();
+	void on_results_doubleClicked(const QModelIndex &index);
+
+private Q_SLOTS:
+	void job_finished(bool cancelled);
+
+private:
+	bool rules(QList<RegexRule> &rules);
+
+private:
+	 Ui::DialogRegexSearch *const ui;
+	 QPointer<Job>                job_;
+};
+
+#endif
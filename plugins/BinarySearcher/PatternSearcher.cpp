@@ -0,0 +1,286 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PatternSearcher.h"
+
+#include <QStringList>
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// patterns at least this long with no wildcard near their end are searched
+// with a skip table, shorter ones are faster with the first/last byte filter
+const std::size_t horspool_min_length = 16;
+const std::size_t horspool_min_shift  = 8;
+
+bool match_less_than(const PatternMatch &a, const PatternMatch &b) {
+	if(a.address != b.address) {
+		return a.address < b.address;
+	}
+	return a.pattern < b.pattern;
+}
+
+}
+
+//------------------------------------------------------------------------------
+// Name: PatternSearcher(const QList<BinaryPattern> &patterns, unsigned int alignment)
+// Desc: patterns which are empty, or which consist only of wildcards, are
+//       ignored. alignment must be a power of two no larger than 16
+//------------------------------------------------------------------------------
+PatternSearcher::PatternSearcher(const QList<BinaryPattern> &patterns, unsigned int alignment) : alignment_(alignment ? alignment : 1) {
+
+	Q_ASSERT((alignment_ & (alignment_ - 1)) == 0 && alignment_ <= 16);
+
+	for(int id = 0; id < patterns.size(); ++id) {
+		const BinaryPattern &pattern = patterns[id];
+		const std::size_t length = pattern.bytes.size();
+
+		CompiledPattern compiled;
+		compiled.bytes       = pattern.bytes;
+		compiled.mask        = pattern.mask;
+		compiled.id          = id;
+		compiled.first_fixed = length;
+		compiled.last_fixed  = 0;
+		compiled.wildcards   = false;
+
+		for(std::size_t i = 0; i < length; ++i) {
+			if(pattern.mask[i]) {
+				compiled.first_fixed = std::min(compiled.first_fixed, i);
+				compiled.last_fixed  = i;
+			} else {
+				compiled.wildcards = true;
+			}
+		}
+
+		if(compiled.first_fixed == length) {
+			continue;
+		}
+
+		// a wildcard matches every byte, so no shift may skip past one
+		std::size_t default_shift = length;
+		for(std::size_t i = 0; i + 1 < length; ++i) {
+			if(!pattern.mask[i]) {
+				default_shift = length - 1 - i;
+			}
+		}
+
+		std::fill(compiled.shift, compiled.shift + 256, default_shift);
+		for(std::size_t i = 0; i + 1 < length; ++i) {
+			if(pattern.mask[i]) {
+				const quint8 ch = pattern.bytes[i];
+				compiled.shift[ch] = std::min(compiled.shift[ch], length - 1 - i);
+			}
+		}
+
+		compiled.horspool = length >= horspool_min_length && default_shift >= horspool_min_shift && pattern.mask[length - 1];
+
+		patterns_.push_back(compiled);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: parse_pattern(const QString &s, BinaryPattern &pattern)
+// Desc: parses hex bytes such as "48 8b ?? 24", spaces are optional and "??"
+//       is a wildcard
+//------------------------------------------------------------------------------
+bool PatternSearcher::parse_pattern(const QString &s, BinaryPattern &pattern) {
+
+	const QString digits = s.simplified().remove(' ');
+	if(digits.isEmpty() || (digits.size() & 1)) {
+		return false;
+	}
+
+	QByteArray bytes;
+	QByteArray mask;
+
+	for(int i = 0; i < digits.size(); i += 2) {
+		const QString byte = digits.mid(i, 2);
+		if(byte == "??") {
+			bytes.append('\0');
+			mask.append('\0');
+		} else {
+			bool ok;
+			const uint value = byte.toUInt(&ok, 16);
+			if(!ok) {
+				return false;
+			}
+			bytes.append(static_cast<char>(value));
+			mask.append('\xff');
+		}
+	}
+
+	pattern.bytes = bytes;
+	pattern.mask  = mask;
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: make_pattern(const QByteArray &bytes)
+// Desc: a pattern with no wildcards
+//------------------------------------------------------------------------------
+BinaryPattern PatternSearcher::make_pattern(const QByteArray &bytes) {
+	BinaryPattern pattern;
+	pattern.bytes = bytes;
+	pattern.mask  = QByteArray(bytes.size(), '\xff');
+	return pattern;
+}
+
+//------------------------------------------------------------------------------
+// Name: max_length() const
+// Desc: the length of the longest pattern
+//------------------------------------------------------------------------------
+int PatternSearcher::max_length() const {
+	int length = 0;
+	Q_FOREACH(const CompiledPattern &pattern, patterns_) {
+		length = qMax(length, pattern.bytes.size());
+	}
+	return length;
+}
+
+//------------------------------------------------------------------------------
+// Name: align_up(yad64::address_t base, std::size_t offset) const
+// Desc: the first offset at or after offset whose address is aligned
+//------------------------------------------------------------------------------
+std::size_t PatternSearcher::align_up(yad64::address_t base, std::size_t offset) const {
+	const std::size_t misalignment = (base + offset) & (alignment_ - 1);
+	return misalignment ? offset + (alignment_ - misalignment) : offset;
+}
+
+//------------------------------------------------------------------------------
+// Name: matches_at(const CompiledPattern &pattern, const quint8 *p) const
+//------------------------------------------------------------------------------
+bool PatternSearcher::matches_at(const CompiledPattern &pattern, const quint8 *p) const {
+
+	const quint8 *const bytes = reinterpret_cast<const quint8 *>(pattern.bytes.constData());
+	const std::size_t length  = pattern.bytes.size();
+
+	if(!pattern.wildcards) {
+		return std::memcmp(p, bytes, length) == 0;
+	}
+
+	const quint8 *const mask = reinterpret_cast<const quint8 *>(pattern.mask.constData());
+	for(std::size_t i = 0; i < length; ++i) {
+		if((p[i] ^ bytes[i]) & mask[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: search_filter(const CompiledPattern &pattern, const quint8 *data, std::size_t first, std::size_t last, yad64::address_t base, PatternMatches &matches) const
+// Desc: only offsets where both the first and the last fixed byte of the
+//       pattern match are compared in full
+//------------------------------------------------------------------------------
+void PatternSearcher::search_filter(const CompiledPattern &pattern, const quint8 *data, std::size_t first, std::size_t last, yad64::address_t base, PatternMatches &matches) const {
+
+	const quint8 first_byte = pattern.bytes[static_cast<int>(pattern.first_fixed)];
+	const quint8 last_byte  = pattern.bytes[static_cast<int>(pattern.last_fixed)];
+
+	std::size_t i = align_up(base, first);
+
+#if defined(__SSE2__)
+	// since the step is a multiple of the alignment, the same lanes are aligned
+	// in every block
+	static const unsigned int lane_masks[] = { 0xffff, 0x5555, 0, 0x1111, 0, 0, 0, 0x0101, 0, 0, 0, 0, 0, 0, 0, 0x0001 };
+	const unsigned int lanes = lane_masks[alignment_ - 1];
+
+	const __m128i first_vector = _mm_set1_epi8(static_cast<char>(first_byte));
+	const __m128i last_vector  = _mm_set1_epi8(static_cast<char>(last_byte));
+
+	for(; i + 16 <= last; i += 16) {
+		const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i + pattern.first_fixed));
+		const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i + pattern.last_fixed));
+
+		unsigned int bits = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, first_vector), _mm_cmpeq_epi8(b, last_vector))) & lanes;
+		while(bits) {
+			const std::size_t offset = i + __builtin_ctz(bits);
+			bits &= bits - 1;
+
+			if(matches_at(pattern, data + offset)) {
+				const PatternMatch match = { base + offset, pattern.id };
+				matches.push_back(match);
+			}
+		}
+	}
+#endif
+
+	for(; i < last; i += alignment_) {
+		if(data[i + pattern.first_fixed] == first_byte && data[i + pattern.last_fixed] == last_byte && matches_at(pattern, data + i)) {
+			const PatternMatch match = { base + i, pattern.id };
+			matches.push_back(match);
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: search_horspool(const CompiledPattern &pattern, const quint8 *data, std::size_t first, std::size_t last, yad64::address_t base, PatternMatches &matches) const
+// Desc: Boyer-Moore-Horspool, skipping ahead by the shift for the byte under
+//       the end of the pattern (rounded up to the next aligned offset)
+//------------------------------------------------------------------------------
+void PatternSearcher::search_horspool(const CompiledPattern &pattern, const quint8 *data, std::size_t first, std::size_t last, yad64::address_t base, PatternMatches &matches) const {
+
+	const std::size_t length = pattern.bytes.size();
+
+	std::size_t i = align_up(base, first);
+	while(i < last) {
+		if(matches_at(pattern, data + i)) {
+			const PatternMatch match = { base + i, pattern.id };
+			matches.push_back(match);
+		}
+
+		i = align_up(base, i + pattern.shift[data[i + length - 1]]);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: search(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t first, std::size_t last, PatternMatches &matches) const
+// Desc: matches are sorted by address
+//------------------------------------------------------------------------------
+void PatternSearcher::search(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t first, std::size_t last, PatternMatches &matches) const {
+
+	const int existing = matches.size();
+
+	Q_FOREACH(const CompiledPattern &pattern, patterns_) {
+		const std::size_t length = pattern.bytes.size();
+		if(length > size) {
+			continue;
+		}
+
+		// no match may run past the end of the buffer
+		const std::size_t end = std::min(last, size - length + 1);
+		if(first >= end) {
+			continue;
+		}
+
+		if(pattern.horspool) {
+			search_horspool(pattern, data, first, end, base, matches);
+		} else {
+			search_filter(pattern, data, first, end, base, matches);
+		}
+	}
+
+	if(patterns_.size() > 1) {
+		std::sort(matches.begin() + existing, matches.end(), match_less_than);
+	}
+}
@@ -0,0 +1,86 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PATTERN_SEARCHER_20121017_H_
+#define PATTERN_SEARCHER_20121017_H_
+
+#include "Types.h"
+
+#include <QByteArray>
+#include <QList>
+#include <QString>
+#include <QVector>
+
+// a byte pattern, bytes whose mask is zero match anything
+struct BinaryPattern {
+	QByteArray bytes;
+	QByteArray mask;
+};
+
+struct PatternMatch {
+	yad64::address_t address;
+	int              pattern;
+};
+
+typedef QVector<PatternMatch> PatternMatches;
+
+// searches a buffer for any number of patterns at once. each pattern is
+// compiled up front into either a first/last byte filter (compared 16 bytes
+// at a time with SSE2 where available) or, for long needles, a Boyer-Moore-
+// Horspool skip table. alignment is applied while generating candidates so
+// misaligned offsets are never compared at all
+class PatternSearcher {
+public:
+	PatternSearcher(const QList<BinaryPattern> &patterns, unsigned int alignment);
+
+public:
+	static bool parse_pattern(const QString &s, BinaryPattern &pattern);
+	static BinaryPattern make_pattern(const QByteArray &bytes);
+
+public:
+	bool empty() const { return patterns_.empty(); }
+	int max_length() const;
+
+	// finds every match which starts in [first, last), bytes past last are
+	// only used to complete matches. data is assumed to be mapped at base
+	void search(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t first, std::size_t last, PatternMatches &matches) const;
+
+private:
+	struct CompiledPattern {
+		QByteArray   bytes;
+		QByteArray   mask;
+		int          id;
+		std::size_t  first_fixed; // offset of the first non-wildcard byte
+		std::size_t  last_fixed;  // offset of the last non-wildcard byte
+		bool         wildcards;
+		bool         horspool;
+		std::size_t  shift[256];
+	};
+
+private:
+	bool matches_at(const CompiledPattern &pattern, const quint8 *p) const;
+	void search_filter(const CompiledPattern &pattern, const quint8 *data, std::size_t first, std::size_t last, yad64::address_t base, PatternMatches &matches) const;
+	void search_horspool(const CompiledPattern &pattern, const quint8 *data, std::size_t first, std::size_t last, yad64::address_t base, PatternMatches &matches) const;
+	std::size_t align_up(yad64::address_t base, std::size_t offset) const;
+
+private:
+	QVector<CompiledPattern> patterns_;
+	unsigned int             alignment_;
+};
+
+#endif
@@ -0,0 +1,1473 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "RegexSearcher.h"
+
+#include <QObject>
+#include <QRegExp>
+#include <QScopedPointer>
+#include <QStringList>
+
+#include <algorithm>
+#include <bitset>
+#include <map>
+#include <vector>
+
+namespace {
+
+typedef std::bitset<256> ByteSet;
+
+// limits which keep a hostile or careless rule from eating all memory
+const int max_repeat     = 1000;
+const int max_nfa_states = 200000;
+const int max_dfa_states = 10000;
+
+struct Node {
+	enum Type {
+		SET,
+		CONCAT,
+		ALTERNATE,
+		REPEAT
+	};
+
+	Type             type;
+	int              set;
+	int              min;
+	int              max; // -1 when unbounded
+	std::vector<int> children;
+};
+
+// the parsed rules, nodes refer to each other and to sets by index
+struct Ast {
+	std::vector<Node>    nodes;
+	std::vector<ByteSet> sets;
+
+	int add(Node::Type type) {
+		Node node;
+		node.type = type;
+		node.set  = -1;
+		node.min  = 0;
+		node.max  = 0;
+		nodes.push_back(node);
+		return nodes.size() - 1;
+	}
+
+	int add_set(const ByteSet &set) {
+		const int n = add(Node::SET);
+		nodes[n].set = sets.size();
+		sets.push_back(set);
+		return n;
+	}
+
+	void add_child(int parent, int child) {
+		nodes[parent].children.push_back(child);
+	}
+};
+
+inline bool is_alpha(int ch) {
+	return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+}
+
+inline int hex_value(int ch) {
+	if(ch >= '0' && ch <= '9') return ch - '0';
+	if(ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+	if(ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+	return -1;
+}
+
+// a recursive descent parser for the three kinds of rule, all of which are
+// turned into the same tree of byte sets
+class Parser {
+public:
+	Parser(const QByteArray &pattern, bool nocase, bool wide, Ast &ast) : pattern_(pattern), pos_(0), nocase_(nocase), wide_(wide), ast_(ast) {
+	}
+
+public:
+	int parse_text();
+	int parse_hex();
+	int parse_regex();
+	const QString &error() const { return error_; }
+
+private:
+	bool at_end() const   { return pos_ >= pattern_.size(); }
+	int peek() const      { return static_cast<quint8>(pattern_[pos_]); }
+	int peek(int n) const { return (pos_ + n < pattern_.size()) ? static_cast<quint8>(pattern_[pos_ + n]) : -1; }
+	int next()            { return static_cast<quint8>(pattern_[pos_++]); }
+
+	int fail(const QString &message) {
+		if(error_.isEmpty()) {
+			error_ = message;
+		}
+		return -1;
+	}
+
+private:
+	void add_char(ByteSet &set, int ch) const;
+	int literal(int ch);
+	int atom_of(const ByteSet &set);
+	bool escape(ByteSet &set, int &ch);
+	bool number(int &value);
+	void skip_space();
+
+	int alternation();
+	int concatenation();
+	int repetition();
+	int atom();
+	int char_class();
+
+	int hex_sequence();
+	int hex_token();
+
+private:
+	QByteArray pattern_;
+	int        pos_;
+	bool       nocase_;
+	bool       wide_;
+	Ast &      ast_;
+	QString    error_;
+};
+
+//------------------------------------------------------------------------------
+// Name: add_char(ByteSet &set, int ch) const
+// Desc: adds ch, and when ignoring case the other case of it
+//------------------------------------------------------------------------------
+void Parser::add_char(ByteSet &set, int ch) const {
+	set.set(ch);
+	if(nocase_ && is_alpha(ch)) {
+		set.set(ch ^ 0x20);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: literal(int ch)
+// Desc:
+//------------------------------------------------------------------------------
+int Parser::literal(int ch) {
+	ByteSet set;
+	add_char(set, ch);
+	return atom_of(set);
+}
+
+//------------------------------------------------------------------------------
+// Name: atom_of(const ByteSet &set)
+// Desc: a single character, which is followed by a zero byte when wide
+//------------------------------------------------------------------------------
+int Parser::atom_of(const ByteSet &set) {
+	const int n = ast_.add_set(set);
+	if(!wide_) {
+		return n;
+	}
+
+	ByteSet zero;
+	zero.set(0);
+
+	const int concat = ast_.add(Node::CONCAT);
+	ast_.add_child(concat, n);
+	ast_.add_child(concat, ast_.add_set(zero));
+	return concat;
+}
+
+//------------------------------------------------------------------------------
+// Name: escape(ByteSet &set, int &ch)
+// Desc: the character after a backslash. ch is the character it stands for,
+//       or -1 for the classes (\d \w \s and their complements) in which case
+//       set holds them
+//------------------------------------------------------------------------------
+bool Parser::escape(ByteSet &set, int &ch) {
+
+	if(at_end()) {
+		return fail(QObject::tr("trailing backslash")) >= 0;
+	}
+
+	set.reset();
+	ch = -1;
+
+	const int c = next();
+	switch(c) {
+	case 'x':
+		if(hex_value(peek(0)) < 0 || hex_value(peek(1)) < 0) {
+			return fail(QObject::tr("\\x needs two hex digits")) >= 0;
+		}
+		ch = hex_value(next()) << 4;
+		ch |= hex_value(next());
+		break;
+	case 'n': ch = '\n'; break;
+	case 'r': ch = '\r'; break;
+	case 't': ch = '\t'; break;
+	case 'f': ch = '\f'; break;
+	case 'v': ch = '\v'; break;
+	case 'a': ch = '\a'; break;
+	case 'e': ch = 0x1b; break;
+	case '0': ch = 0;    break;
+	case 'd':
+	case 'D':
+		for(int i = '0'; i <= '9'; ++i) set.set(i);
+		break;
+	case 'w':
+	case 'W':
+		for(int i = '0'; i <= '9'; ++i) set.set(i);
+		for(int i = 'a'; i <= 'z'; ++i) set.set(i);
+		for(int i = 'A'; i <= 'Z'; ++i) set.set(i);
+		set.set('_');
+		break;
+	case 's':
+	case 'S':
+		set.set(' ');
+		for(int i = '\t'; i <= '\r'; ++i) set.set(i);
+		break;
+	default:
+		ch = c;
+		break;
+	}
+
+	if(c == 'D' || c == 'W' || c == 'S') {
+		set.flip();
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: number(int &value)
+// Desc: a decimal number, no larger than max_repeat
+//------------------------------------------------------------------------------
+bool Parser::number(int &value) {
+
+	if(at_end() || peek() < '0' || peek() > '9') {
+		return fail(QObject::tr("expected a number")) >= 0;
+	}
+
+	value = 0;
+	while(!at_end() && peek() >= '0' && peek() <= '9') {
+		value = value * 10 + (next() - '0');
+		if(value > max_repeat) {
+			return fail(QObject::tr("repeat counts may be at most %1").arg(max_repeat)) >= 0;
+		}
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: skip_space()
+// Desc:
+//------------------------------------------------------------------------------
+void Parser::skip_space() {
+	while(!at_end() && (peek() == ' ' || peek() == '\t')) {
+		++pos_;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: parse_text()
+// Desc: a literal string with C style escapes
+//------------------------------------------------------------------------------
+int Parser::parse_text() {
+
+	const int concat = ast_.add(Node::CONCAT);
+
+	while(!at_end()) {
+		int ch = next();
+		if(ch == '\\') {
+			ByteSet set;
+			if(!escape(set, ch)) {
+				return -1;
+			}
+
+			if(ch < 0) {
+				return fail(QObject::tr("character classes can only be used in regular expressions"));
+			}
+		}
+
+		ast_.add_child(concat, literal(ch));
+	}
+
+	if(ast_.nodes[concat].children.empty()) {
+		return fail(QObject::tr("empty string"));
+	}
+
+	return concat;
+}
+
+//------------------------------------------------------------------------------
+// Name: parse_hex()
+// Desc:
+//------------------------------------------------------------------------------
+int Parser::parse_hex() {
+	const int root = hex_sequence();
+	if(root >= 0 && !at_end()) {
+		return fail(QObject::tr("unexpected '%1'").arg(QChar(peek())));
+	}
+	return root;
+}
+
+//------------------------------------------------------------------------------
+// Name: hex_sequence()
+// Desc:
+//------------------------------------------------------------------------------
+int Parser::hex_sequence() {
+
+	const int concat = ast_.add(Node::CONCAT);
+
+	for(;;) {
+		skip_space();
+		if(at_end() || peek() == ')' || peek() == '|') {
+			break;
+		}
+
+		const int token = hex_token();
+		if(token < 0) {
+			return -1;
+		}
+
+		ast_.add_child(concat, token);
+	}
+
+	return concat;
+}
+
+//------------------------------------------------------------------------------
+// Name: hex_token()
+// Desc: a byte (either nibble may be ?), a [n-m] jump or ( .. | .. )
+//------------------------------------------------------------------------------
+int Parser::hex_token() {
+
+	if(peek() == '[') {
+		next();
+
+		int min;
+		int max;
+		skip_space();
+		if(!number(min)) {
+			return -1;
+		}
+
+		max = min;
+		skip_space();
+		if(!at_end() && peek() == '-') {
+			next();
+			skip_space();
+			max = -1;
+			if(!at_end() && peek() != ']' && !number(max)) {
+				return -1;
+			}
+		}
+
+		skip_space();
+		if(at_end() || next() != ']') {
+			return fail(QObject::tr("missing ]"));
+		}
+
+		if(max != -1 && max < min) {
+			return fail(QObject::tr("bad jump [%1-%2]").arg(min).arg(max));
+		}
+
+		ByteSet any;
+		any.set();
+
+		const int repeat = ast_.add(Node::REPEAT);
+		ast_.nodes[repeat].min = min;
+		ast_.nodes[repeat].max = max;
+		ast_.add_child(repeat, ast_.add_set(any));
+		return repeat;
+	}
+
+	if(peek() == '(') {
+		next();
+
+		const int alternate = ast_.add(Node::ALTERNATE);
+		for(;;) {
+			const int sequence = hex_sequence();
+			if(sequence < 0) {
+				return -1;
+			}
+
+			ast_.add_child(alternate, sequence);
+
+			if(at_end()) {
+				return fail(QObject::tr("missing )"));
+			} else if(next() == ')') {
+				break;
+			}
+		}
+		return alternate;
+	}
+
+	const int high = next();
+	const int low  = at_end() ? -1 : next();
+
+	if((high != '?' && hex_value(high) < 0) || (low != '?' && hex_value(low) < 0)) {
+		return fail(QObject::tr("bad hex byte"));
+	}
+
+	ByteSet set;
+	for(int i = 0; i < 256; ++i) {
+		if((high == '?' || hex_value(high) == (i >> 4)) && (low == '?' || hex_value(low) == (i & 0x0f))) {
+			set.set(i);
+		}
+	}
+
+	return ast_.add_set(set);
+}
+
+//------------------------------------------------------------------------------
+// Name: parse_regex()
+// Desc:
+//------------------------------------------------------------------------------
+int Parser::parse_regex() {
+	const int root = alternation();
+	if(root >= 0 && !at_end()) {
+		return fail(QObject::tr("unmatched )"));
+	}
+	return root;
+}
+
+//------------------------------------------------------------------------------
+// Name: alternation()
+// Desc:
+//------------------------------------------------------------------------------
+int Parser::alternation() {
+
+	const int first = concatenation();
+	if(first < 0 || at_end() || peek() != '|') {
+		return first;
+	}
+
+	const int alternate = ast_.add(Node::ALTERNATE);
+	ast_.add_child(alternate, first);
+
+	while(!at_end() && peek() == '|') {
+		next();
+
+		const int n = concatenation();
+		if(n < 0) {
+			return -1;
+		}
+
+		ast_.add_child(alternate, n);
+	}
+
+	return alternate;
+}
+
+//------------------------------------------------------------------------------
+// Name: concatenation()
+// Desc:
+//------------------------------------------------------------------------------
+int Parser::concatenation() {
+
+	const int concat = ast_.add(Node::CONCAT);
+
+	while(!at_end() && peek() != '|' && peek() != ')') {
+		const int n = repetition();
+		if(n < 0) {
+			return -1;
+		}
+
+		ast_.add_child(concat, n);
+	}
+
+	return concat;
+}
+
+//------------------------------------------------------------------------------
+// Name: repetition()
+// Desc: an atom followed by any number of *, +, ?, {n}, {n,} or {n,m}
+//------------------------------------------------------------------------------
+int Parser::repetition() {
+
+	int n = atom();
+
+	while(n >= 0 && !at_end()) {
+
+		int min;
+		int max;
+
+		switch(peek()) {
+		case '*': next(); min = 0; max = -1; break;
+		case '+': next(); min = 1; max = -1; break;
+		case '?': next(); min = 0; max = 1;  break;
+		case '{':
+			next();
+			if(!number(min)) {
+				return -1;
+			}
+
+			max = min;
+			if(!at_end() && peek() == ',') {
+				next();
+				max = -1;
+				if(!at_end() && peek() != '}' && !number(max)) {
+					return -1;
+				}
+			}
+
+			if(at_end() || next() != '}') {
+				return fail(QObject::tr("missing }"));
+			}
+
+			if(max != -1 && max < min) {
+				return fail(QObject::tr("bad repeat {%1,%2}").arg(min).arg(max));
+			}
+			break;
+		default:
+			return n;
+		}
+
+		const int repeat = ast_.add(Node::REPEAT);
+		ast_.nodes[repeat].min = min;
+		ast_.nodes[repeat].max = max;
+		ast_.add_child(repeat, n);
+		n = repeat;
+	}
+
+	return n;
+}
+
+//------------------------------------------------------------------------------
+// Name: atom()
+// Desc:
+//------------------------------------------------------------------------------
+int Parser::atom() {
+
+	const int c = next();
+
+	switch(c) {
+	case '(':
+		if(peek(0) == '?' && peek(1) == ':') {
+			pos_ += 2;
+		} else if(peek(0) == '?') {
+			return fail(QObject::tr("only (?: ) groups are supported"));
+		}
+
+		do {
+			const int n = alternation();
+			if(n < 0) {
+				return -1;
+			}
+
+			if(at_end() || next() != ')') {
+				return fail(QObject::tr("missing )"));
+			}
+
+			return n;
+		} while(0);
+	case '[':
+		return char_class();
+	case '.':
+		do {
+			ByteSet any;
+			any.set();
+			return atom_of(any);
+		} while(0);
+	case '\\':
+		do {
+			ByteSet set;
+			int ch;
+			if(!escape(set, ch)) {
+				return -1;
+			}
+			return (ch >= 0) ? literal(ch) : atom_of(set);
+		} while(0);
+	case '^':
+	case '$':
+		return fail(QObject::tr("anchors are not supported"));
+	case '*':
+	case '+':
+	case '?':
+	case '{':
+		return fail(QObject::tr("nothing to repeat"));
+	default:
+		return literal(c);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: char_class()
+// Desc: [...] and [^...], the opening bracket has been read
+//------------------------------------------------------------------------------
+int Parser::char_class() {
+
+	ByteSet set;
+	bool negate = false;
+	bool first  = true;
+
+	if(!at_end() && peek() == '^') {
+		next();
+		negate = true;
+	}
+
+	for(;;) {
+		if(at_end()) {
+			return fail(QObject::tr("missing ]"));
+		}
+
+		int low = next();
+		if(low == ']' && !first) {
+			break;
+		}
+
+		first = false;
+
+		if(low == '\\') {
+			ByteSet escaped;
+			if(!escape(escaped, low)) {
+				return -1;
+			}
+
+			if(low < 0) {
+				set |= escaped;
+				continue;
+			}
+		}
+
+		int high = low;
+		if(!at_end() && peek() == '-' && peek(1) != ']' && peek(1) != -1) {
+			next();
+			high = next();
+			if(high == '\\') {
+				ByteSet escaped;
+				if(!escape(escaped, high)) {
+					return -1;
+				}
+			}
+
+			if(high < low) {
+				return fail(QObject::tr("bad range in character class"));
+			}
+		}
+
+		for(int ch = low; ch <= high; ++ch) {
+			add_char(set, ch);
+		}
+	}
+
+	if(negate) {
+		set.flip();
+	}
+
+	return atom_of(set);
+}
+
+struct NfaState {
+	std::vector<int> epsilon;
+	int              set;    // the byte transition to next, -1 if there isn't one
+	int              next;
+	int              accept; // the rule accepted here, -1 if none
+};
+
+// a Thompson construction. when reverse is true every concatenation is built
+// back to front, giving an NFA for the reversed language
+class NfaBuilder {
+public:
+	NfaBuilder(const Ast &ast, bool reverse) : ast_(ast), reverse_(reverse) {
+	}
+
+public:
+	int state() {
+		NfaState s;
+		s.set    = -1;
+		s.next   = -1;
+		s.accept = -1;
+		states.push_back(s);
+		return states.size() - 1;
+	}
+
+	void link(int from, int to) {
+		states[from].epsilon.push_back(to);
+	}
+
+	int build(int n, int from);
+
+public:
+	std::vector<NfaState> states;
+
+private:
+	const Ast &ast_;
+	bool       reverse_;
+};
+
+//------------------------------------------------------------------------------
+// Name: build(int n, int from)
+// Desc: adds node n, entered from the state from, and returns its exit state.
+//       nothing ever links back to from, so it is safe to share between the
+//       branches of an alternation. returns -1 if the NFA gets too big
+//------------------------------------------------------------------------------
+int NfaBuilder::build(int n, int from) {
+
+	if(from < 0 || static_cast<int>(states.size()) > max_nfa_states) {
+		return -1;
+	}
+
+	const Node &node = ast_.nodes[n];
+
+	switch(node.type) {
+	case Node::SET:
+		do {
+			const int s = state();
+			const int t = state();
+			link(from, s);
+			states[s].set  = node.set;
+			states[s].next = t;
+			return t;
+		} while(0);
+	case Node::CONCAT:
+		do {
+			const std::size_t count = node.children.size();
+			int current = from;
+			for(std::size_t i = 0; i < count; ++i) {
+				current = build(node.children[reverse_ ? count - 1 - i : i], current);
+			}
+			return current;
+		} while(0);
+	case Node::ALTERNATE:
+		do {
+			const int exit = state();
+			for(std::size_t i = 0; i < node.children.size(); ++i) {
+				const int e = build(node.children[i], from);
+				if(e < 0) {
+					return -1;
+				}
+				link(e, exit);
+			}
+			return exit;
+		} while(0);
+	case Node::REPEAT:
+		do {
+			const int child = node.children[0];
+			int current = from;
+
+			for(int i = 0; i < node.min; ++i) {
+				current = build(child, current);
+			}
+
+			if(current < 0) {
+				return -1;
+			}
+
+			if(node.max < 0) {
+				const int head = state();
+				link(current, head);
+				const int e = build(child, head);
+				if(e < 0) {
+					return -1;
+				}
+				link(e, head);
+				return head;
+			}
+
+			for(int i = node.min; i < node.max; ++i) {
+				const int exit = state();
+				link(current, exit);
+				const int e = build(child, current);
+				if(e < 0) {
+					return -1;
+				}
+				link(e, exit);
+				current = exit;
+			}
+			return current;
+		} while(0);
+	}
+
+	return -1;
+}
+
+//------------------------------------------------------------------------------
+// Name: build_nfa(const Ast &ast, const std::vector<int> &roots, int first_rule, bool reverse, std::vector<NfaState> &states)
+// Desc: one NFA for all of roots, the exit of each leads to a state which
+//       accepts its rule. returns the start state, or -1 if it is too big
+//------------------------------------------------------------------------------
+int build_nfa(const Ast &ast, const std::vector<int> &roots, int first_rule, bool reverse, std::vector<NfaState> &states) {
+
+	NfaBuilder builder(ast, reverse);
+	const int start = builder.state();
+
+	for(std::size_t i = 0; i < roots.size(); ++i) {
+		const int e = builder.build(roots[i], start);
+		if(e < 0) {
+			return -1;
+		}
+
+		const int accept = builder.state();
+		builder.states[accept].accept = first_rule + i;
+		builder.link(e, accept);
+	}
+
+	states.swap(builder.states);
+	return start;
+}
+
+//------------------------------------------------------------------------------
+// Name: closure(const std::vector<NfaState> &nfa, std::vector<int> &set, std::vector<int> &stamp, int &generation)
+// Desc: replaces set with the states reachable from it without reading a
+//       byte. only states which read a byte or accept are kept, the others
+//       make no difference to what the set does next
+//------------------------------------------------------------------------------
+void closure(const std::vector<NfaState> &nfa, std::vector<int> &set, std::vector<int> &stamp, int &generation) {
+
+	++generation;
+
+	std::vector<int> stack;
+	stack.swap(set);
+
+	while(!stack.empty()) {
+		const int s = stack.back();
+		stack.pop_back();
+
+		if(stamp[s] == generation) {
+			continue;
+		}
+
+		stamp[s] = generation;
+
+		if(nfa[s].set >= 0 || nfa[s].accept >= 0) {
+			set.push_back(s);
+		}
+
+		for(std::size_t i = 0; i < nfa[s].epsilon.size(); ++i) {
+			if(stamp[nfa[s].epsilon[i]] != generation) {
+				stack.push_back(nfa[s].epsilon[i]);
+			}
+		}
+	}
+
+	std::sort(set.begin(), set.end());
+}
+
+//------------------------------------------------------------------------------
+// Name: build_dfa(...)
+// Desc: the subset construction over byte classes for an anchored DFA. states
+//       are numbered by their offset into next and the accepting ones are
+//       numbered last. returns false if there would be too many states
+//------------------------------------------------------------------------------
+bool build_dfa(const std::vector<NfaState> &nfa, int start, const std::vector<ByteSet> &sets, const quint8 *representatives, int class_count, QVector<int> &next, QVector<QVector<int> > &accepts, int &first_state, int &accepting) {
+
+	std::vector<int> stamp(nfa.size(), 0);
+	int generation = 0;
+
+	std::vector<int> start_set(1, start);
+	closure(nfa, start_set, stamp, generation);
+
+	std::map<std::vector<int>, int> ids;
+	std::vector<std::vector<int> >  subsets;
+	std::vector<int>                moves;
+
+	ids.insert(std::make_pair(start_set, 0));
+	subsets.push_back(start_set);
+
+	for(std::size_t i = 0; i < subsets.size(); ++i) {
+
+		const std::vector<int> subset = subsets[i];
+
+		for(int c = 0; c < class_count; ++c) {
+
+			std::vector<int> target;
+			for(std::size_t j = 0; j < subset.size(); ++j) {
+				const NfaState &state = nfa[subset[j]];
+				if(state.set >= 0 && sets[state.set].test(representatives[c])) {
+					target.push_back(state.next);
+				}
+			}
+
+			if(target.empty()) {
+				moves.push_back(-1);
+				continue;
+			}
+
+			closure(nfa, target, stamp, generation);
+
+			std::map<std::vector<int>, int>::const_iterator it = ids.find(target);
+			if(it == ids.end()) {
+				if(static_cast<int>(subsets.size()) >= max_dfa_states) {
+					return false;
+				}
+
+				it = ids.insert(std::make_pair(target, static_cast<int>(subsets.size()))).first;
+				subsets.push_back(target);
+			}
+
+			moves.push_back(it->second);
+		}
+	}
+
+	// renumber so that the accepting states come last
+	const int count = subsets.size();
+	std::vector<std::vector<int> > rules(count);
+	std::vector<int> order;
+	std::vector<int> renumbered(count);
+
+	for(int i = 0; i < count; ++i) {
+		for(std::size_t j = 0; j < subsets[i].size(); ++j) {
+			if(nfa[subsets[i][j]].accept >= 0) {
+				rules[i].push_back(nfa[subsets[i][j]].accept);
+			}
+		}
+
+		if(rules[i].empty()) {
+			order.push_back(i);
+		}
+	}
+
+	const int first_accepting = order.size();
+	for(int i = 0; i < count; ++i) {
+		if(!rules[i].empty()) {
+			std::sort(rules[i].begin(), rules[i].end());
+			rules[i].erase(std::unique(rules[i].begin(), rules[i].end()), rules[i].end());
+			order.push_back(i);
+		}
+	}
+
+	for(int i = 0; i < count; ++i) {
+		renumbered[order[i]] = i;
+	}
+
+	next.resize(count * class_count);
+	accepts.clear();
+
+	for(int i = 0; i < count; ++i) {
+		const int old = order[i];
+		for(int c = 0; c < class_count; ++c) {
+			const int target = moves[old * class_count + c];
+			next[i * class_count + c] = (target < 0) ? -1 : renumbered[target] * class_count;
+		}
+
+		if(i >= first_accepting) {
+			accepts.append(QVector<int>::fromStdVector(rules[old]));
+		}
+	}
+
+	first_state = renumbered[0] * class_count;
+	accepting   = first_accepting * class_count;
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: byte_classes(const std::vector<ByteSet> &sets, quint8 *classes, quint8 *representatives)
+// Desc: splits the bytes into classes which no set tells apart, so the DFAs
+//       only need a column per class instead of one per byte
+//------------------------------------------------------------------------------
+int byte_classes(const std::vector<ByteSet> &sets, quint8 *classes, quint8 *representatives) {
+
+	std::vector<int> current(256, 0);
+	int count = 1;
+
+	for(std::size_t i = 0; i < sets.size(); ++i) {
+		std::map<std::pair<int, bool>, int> split;
+		std::vector<int> refined(256);
+
+		for(int b = 0; b < 256; ++b) {
+			const std::pair<int, bool> key(current[b], sets[i].test(b));
+
+			std::map<std::pair<int, bool>, int>::const_iterator it = split.find(key);
+			if(it == split.end()) {
+				it = split.insert(std::make_pair(key, static_cast<int>(split.size()))).first;
+			}
+
+			refined[b] = it->second;
+		}
+
+		current.swap(refined);
+		count = split.size();
+	}
+
+	for(int b = 255; b >= 0; --b) {
+		classes[b] = current[b];
+		representatives[current[b]] = b;
+	}
+
+	return count;
+}
+
+bool match_less_than(const RegexMatch &a, const RegexMatch &b) {
+	if(a.address != b.address) {
+		return a.address < b.address;
+	}
+	return a.rule < b.rule;
+}
+
+}
+
+// the NFA for all of the rules together
+class RegexNfa {
+public:
+	std::vector<NfaState> states;
+	std::vector<ByteSet>  sets;
+	quint8                representatives[256];
+	int                   class_count;
+	int                   start;
+};
+
+// the unanchored DFA which finds where matches end. transitions hold the
+// offset of the next state, or -(offset + 2) when that state accepts, or -1
+// when the transition hasn't been worked out yet
+class RegexSearchDfa {
+public:
+	RegexSearchDfa(const RegexNfa *nfa, bool lazy);
+
+public:
+	bool explore();
+	bool complete() const                         { return complete_; }
+	const int *table() const                      { return &next_[0]; }
+	const std::vector<int> &accepts(int state) const { return accepts_[state / nfa_->class_count]; }
+	int step(int state, int c);
+
+private:
+	int find(const std::vector<int> &subset);
+	int add(const std::vector<int> &subset);
+	void reset();
+
+private:
+	const RegexNfa *               nfa_;
+	bool                           lazy_;
+	bool                           complete_;
+	std::vector<int>               next_;
+	std::vector<std::vector<int> > subsets_;
+	std::vector<std::vector<int> > accepts_;
+	std::map<std::vector<int>, int> ids_;
+	std::vector<int>               stamp_;
+	int                            generation_;
+};
+
+//------------------------------------------------------------------------------
+// Name: RegexSearchDfa(const RegexNfa *nfa, bool lazy)
+// Desc: a lazy DFA throws its states away and starts over when it has too
+//       many, rather than failing
+//------------------------------------------------------------------------------
+RegexSearchDfa::RegexSearchDfa(const RegexNfa *nfa, bool lazy) : nfa_(nfa), lazy_(lazy), complete_(false), stamp_(nfa->states.size(), 0), generation_(0) {
+	reset();
+}
+
+//------------------------------------------------------------------------------
+// Name: reset()
+// Desc: forgets every state but the start state, which is always at offset 0
+//------------------------------------------------------------------------------
+void RegexSearchDfa::reset() {
+	next_.clear();
+	subsets_.clear();
+	accepts_.clear();
+	ids_.clear();
+
+	std::vector<int> start(1, nfa_->start);
+	closure(nfa_->states, start, stamp_, generation_);
+	add(start);
+}
+
+//------------------------------------------------------------------------------
+// Name: find(const std::vector<int> &subset)
+// Desc: the encoded state for subset, -1 if it isn't known
+//------------------------------------------------------------------------------
+int RegexSearchDfa::find(const std::vector<int> &subset) {
+	std::map<std::vector<int>, int>::const_iterator it = ids_.find(subset);
+	if(it == ids_.end()) {
+		return -1;
+	}
+
+	const int offset = it->second * nfa_->class_count;
+	return accepts_[it->second].empty() ? offset : -offset - 2;
+}
+
+//------------------------------------------------------------------------------
+// Name: add(const std::vector<int> &subset)
+// Desc: returns the encoded state
+//------------------------------------------------------------------------------
+int RegexSearchDfa::add(const std::vector<int> &subset) {
+
+	const int index = subsets_.size();
+
+	std::vector<int> rules;
+	for(std::size_t i = 0; i < subset.size(); ++i) {
+		if(nfa_->states[subset[i]].accept >= 0) {
+			rules.push_back(nfa_->states[subset[i]].accept);
+		}
+	}
+
+	std::sort(rules.begin(), rules.end());
+	rules.erase(std::unique(rules.begin(), rules.end()), rules.end());
+
+	ids_.insert(std::make_pair(subset, index));
+	subsets_.push_back(subset);
+	accepts_.push_back(rules);
+	next_.resize(next_.size() + nfa_->class_count, -1);
+
+	const int offset = index * nfa_->class_count;
+	return rules.empty() ? offset : -offset - 2;
+}
+
+//------------------------------------------------------------------------------
+// Name: step(int state, int c)
+// Desc: works out the transition from state on byte class c. returns -1 if
+//       that needs a new state and there is no room left for one
+//------------------------------------------------------------------------------
+int RegexSearchDfa::step(int state, int c) {
+
+	const std::vector<int> &subset = subsets_[state / nfa_->class_count];
+	const quint8 byte = nfa_->representatives[c];
+
+	std::vector<int> target;
+	for(std::size_t i = 0; i < subset.size(); ++i) {
+		const NfaState &s = nfa_->states[subset[i]];
+		if(s.set >= 0 && nfa_->sets[s.set].test(byte)) {
+			target.push_back(s.next);
+		}
+	}
+
+	target.push_back(nfa_->start);
+	closure(nfa_->states, target, stamp_, generation_);
+
+	int encoded = find(target);
+	if(encoded == -1) {
+		if(static_cast<int>(subsets_.size()) >= max_dfa_states) {
+			if(!lazy_) {
+				return -1;
+			}
+
+			// the state we came from is gone, so the transition isn't kept
+			reset();
+			return add(target);
+		}
+
+		encoded = add(target);
+	}
+
+	next_[state + c] = encoded;
+	return encoded;
+}
+
+//------------------------------------------------------------------------------
+// Name: explore()
+// Desc: builds every state up front, false if there are too many
+//------------------------------------------------------------------------------
+bool RegexSearchDfa::explore() {
+
+	for(std::size_t i = 0; i < subsets_.size(); ++i) {
+		for(int c = 0; c < nfa_->class_count; ++c) {
+			const int state = i * nfa_->class_count;
+			if(next_[state + c] == -1 && step(state, c) == -1) {
+				return false;
+			}
+		}
+	}
+
+	complete_ = true;
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: RegexSearcher()
+// Desc:
+//------------------------------------------------------------------------------
+RegexSearcher::RegexSearcher() : class_count_(0) {
+	std::fill(classes_, classes_ + 256, 0);
+}
+
+//------------------------------------------------------------------------------
+// Name: parse_rules(const QString &text, QList<RegexRule> &rules, QString &error)
+// Desc: one rule per line, blank lines and lines starting with // are ignored.
+//       returns false and describes the problem in error if a line is invalid
+//------------------------------------------------------------------------------
+bool RegexSearcher::parse_rules(const QString &text, QList<RegexRule> &rules, QString &error) {
+
+	QRegExp named("^\\$(\\w*)\\s*=\\s*(.*)$");
+
+	int line_number = 0;
+	Q_FOREACH(const QString &line, text.split('\n')) {
+
+		++line_number;
+
+		const QString s = line.trimmed();
+		if(s.isEmpty() || s.startsWith("//")) {
+			continue;
+		}
+
+		RegexRule rule;
+		rule.type   = RegexRule::TYPE_REGEX;
+		rule.nocase = false;
+		rule.wide   = false;
+
+		if(!named.exactMatch(s)) {
+			rule.name    = s;
+			rule.pattern = s;
+			rules.append(rule);
+			continue;
+		}
+
+		rule.name = named.cap(1).isEmpty() ? QString("$%1").arg(rules.size() + 1) : "$" + named.cap(1);
+
+		const QString body = named.cap(2);
+		int close = -1;
+
+		if(body.startsWith('"')) {
+			for(int i = 1; i < body.size(); ++i) {
+				if(body[i] == '\\') {
+					++i;
+				} else if(body[i] == '"') {
+					close = i;
+					break;
+				}
+			}
+			rule.type = RegexRule::TYPE_TEXT;
+		} else if(body.startsWith('{')) {
+			close = body.lastIndexOf('}');
+			rule.type = RegexRule::TYPE_HEX;
+		} else if(body.startsWith('/')) {
+			close = body.lastIndexOf('/');
+			rule.type = RegexRule::TYPE_REGEX;
+		}
+
+		if(close <= 0) {
+			error = QObject::tr("line %1: expected \"text\", { hex } or /regex/").arg(line_number);
+			return false;
+		}
+
+		rule.pattern = body.mid(1, close - 1);
+
+		QString modifiers = body.mid(close + 1);
+		if(rule.type == RegexRule::TYPE_REGEX && modifiers.startsWith('i')) {
+			rule.nocase = true;
+			modifiers.remove(0, 1);
+		}
+
+		Q_FOREACH(const QString &modifier, modifiers.split(QRegExp("\\s+"), QString::SkipEmptyParts)) {
+			if(modifier == "nocase" && rule.type != RegexRule::TYPE_HEX) {
+				rule.nocase = true;
+			} else if(modifier == "wide" && rule.type != RegexRule::TYPE_HEX) {
+				rule.wide = true;
+			} else {
+				error = QObject::tr("line %1: unexpected '%2'").arg(line_number).arg(modifier);
+				return false;
+			}
+		}
+
+		rules.append(rule);
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: compile(const QList<RegexRule> &rules, bool case_sensitive, QString &error)
+// Desc: returns false and describes the problem in error if a rule can't be
+//       compiled, the searcher is left empty in that case
+//------------------------------------------------------------------------------
+bool RegexSearcher::compile(const QList<RegexRule> &rules, bool case_sensitive, QString &error) {
+
+	nfa_.clear();
+	search_.clear();
+	forward_.clear();
+	reverse_.clear();
+	class_count_ = 0;
+
+	Ast ast;
+	std::vector<int> roots;
+
+	Q_FOREACH(const RegexRule &rule, rules) {
+		Parser parser(rule.pattern.toUtf8(), rule.nocase || !case_sensitive, rule.wide, ast);
+
+		int root = -1;
+		switch(rule.type) {
+		case RegexRule::TYPE_TEXT:  root = parser.parse_text();  break;
+		case RegexRule::TYPE_HEX:   root = parser.parse_hex();   break;
+		case RegexRule::TYPE_REGEX: root = parser.parse_regex(); break;
+		}
+
+		if(root < 0) {
+			error = QObject::tr("%1: %2").arg(rule.name).arg(parser.error());
+			return false;
+		}
+
+		roots.push_back(root);
+	}
+
+	if(roots.empty()) {
+		return true;
+	}
+
+	QSharedPointer<RegexNfa> nfa(new RegexNfa);
+	nfa->class_count = class_count_ = byte_classes(ast.sets, classes_, nfa->representatives);
+	nfa->start       = build_nfa(ast, roots, 0, false, nfa->states);
+	nfa->sets        = ast.sets;
+
+	if(nfa->start < 0) {
+		error = QObject::tr("The rules are too complex to search for together.");
+		return false;
+	}
+
+	std::vector<NfaState> states;
+	for(int i = 0; i < rules.size(); ++i) {
+		const std::vector<int> root(1, roots[i]);
+
+		Dfa forward;
+		int start = build_nfa(ast, root, i, false, states);
+		if(start < 0 || !build_dfa(states, start, ast.sets, nfa->representatives, class_count_, forward.next, forward.accepts, forward.start, forward.accepting)) {
+			error = QObject::tr("%1: too complex").arg(rules[i].name);
+			return false;
+		}
+
+		if(forward.start >= forward.accepting) {
+			error = QObject::tr("%1: matches an empty string").arg(rules[i].name);
+			return false;
+		}
+
+		Dfa reverse;
+		start = build_nfa(ast, root, i, true, states);
+		if(start < 0 || !build_dfa(states, start, ast.sets, nfa->representatives, class_count_, reverse.next, reverse.accepts, reverse.start, reverse.accepting)) {
+			error = QObject::tr("%1: too complex").arg(rules[i].name);
+			return false;
+		}
+
+		forward_.append(forward);
+		reverse_.append(reverse);
+	}
+
+	// when this fails, search() builds the states it needs as it goes instead
+	QSharedPointer<RegexSearchDfa> search(new RegexSearchDfa(nfa.data(), false));
+	search->explore();
+
+	nfa_    = nfa;
+	search_ = search;
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: find_start(int rule, const quint8 *data, std::size_t lowest, std::size_t end, std::size_t &start) const
+// Desc: runs the reversed rule back from end, start is the earliest offset
+//       (no lower than lowest) at which a match ending at end can begin
+//------------------------------------------------------------------------------
+bool RegexSearcher::find_start(int rule, const quint8 *data, std::size_t lowest, std::size_t end, std::size_t &start) const {
+
+	const Dfa &dfa = reverse_[rule];
+	const int *const next = dfa.next.constData();
+
+	if(end - lowest > MAX_MATCH_LENGTH) {
+		lowest = end - MAX_MATCH_LENGTH;
+	}
+
+	bool found = false;
+	int state  = dfa.start;
+
+	for(std::size_t p = end; p > lowest; ) {
+		state = next[state + classes_[data[--p]]];
+		if(state < 0) {
+			break;
+		}
+
+		if(state >= dfa.accepting) {
+			start = p;
+			found = true;
+		}
+	}
+
+	return found;
+}
+
+//------------------------------------------------------------------------------
+// Name: find_end(int rule, const quint8 *data, std::size_t size, std::size_t start) const
+// Desc: the end of the longest match starting at start, there must be one
+//------------------------------------------------------------------------------
+std::size_t RegexSearcher::find_end(int rule, const quint8 *data, std::size_t size, std::size_t start) const {
+
+	const Dfa &dfa = forward_[rule];
+	const int *const next = dfa.next.constData();
+
+	const std::size_t limit = qMin<std::size_t>(size, start + MAX_MATCH_LENGTH);
+
+	std::size_t end = start;
+	int state       = dfa.start;
+
+	for(std::size_t p = start; p < limit; ) {
+		state = next[state + classes_[data[p++]]];
+		if(state < 0) {
+			break;
+		}
+
+		if(state >= dfa.accepting) {
+			end = p;
+		}
+	}
+
+	return end;
+}
+
+//------------------------------------------------------------------------------
+// Name: search(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t first, std::size_t last, RegexMatches &matches) const
+// Desc: matches are found at the earliest place one can end, then widened to
+//       the leftmost start and longest end for that rule. no match is longer
+//       than MAX_MATCH_LENGTH
+//------------------------------------------------------------------------------
+void RegexSearcher::search(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t first, std::size_t last, RegexMatches &matches) const {
+
+	last = qMin(last, size);
+	if(empty() || first >= last) {
+		return;
+	}
+
+	const int found = matches.size();
+
+	// where the next match of each rule may start
+	QVector<std::size_t> resume(forward_.size(), first);
+
+	// the shared DFA is only read, a search that needs more states than it has
+	// builds its own
+	QScopedPointer<RegexSearchDfa> lazy;
+	const RegexSearchDfa *dfa = search_.data();
+	if(!dfa->complete()) {
+		lazy.reset(new RegexSearchDfa(nfa_.data(), true));
+		dfa = lazy.data();
+	}
+
+	const int *next         = dfa->table();
+	const std::size_t limit = qMin<std::size_t>(size, last + MAX_MATCH_LENGTH);
+
+	int state = 0;
+
+	for(std::size_t p = first; p < limit; ) {
+		const int c = classes_[data[p++]];
+		int t = next[state + c];
+
+		if(t == -1) {
+			t = lazy->step(state, c);
+			next = dfa->table();
+		}
+
+		if(t >= 0) {
+			state = t;
+			continue;
+		}
+
+		state = -t - 2;
+
+		const std::vector<int> &rules = dfa->accepts(state);
+		for(std::size_t i = 0; i < rules.size(); ++i) {
+			const int rule = rules[i];
+
+			std::size_t start;
+			if(p <= resume[rule] || !find_start(rule, data, resume[rule], p, start) || start >= last) {
+				continue;
+			}
+
+			const std::size_t end = find_end(rule, data, size, start);
+
+			const RegexMatch match = { base + start, static_cast<quint32>(end - start), rule };
+			matches.append(match);
+			resume[rule] = end;
+		}
+	}
+
+	std::sort(matches.begin() + found, matches.end(), match_less_than);
+}
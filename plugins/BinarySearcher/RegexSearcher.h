@@ -0,0 +1,110 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef REGEX_SEARCHER_20121017_H_
+#define REGEX_SEARCHER_20121017_H_
+
+#include "Types.h"
+
+#include <QList>
+#include <QSharedPointer>
+#include <QString>
+#include <QVector>
+
+class RegexNfa;
+class RegexSearchDfa;
+
+// one search rule, written the way YARA writes strings:
+//   $name = "text"          a literal, with C style escapes
+//   $name = { 4d 5a ?? }    hex bytes, ?? and nibble wildcards, [n-m] jumps
+//                           and ( .. | .. ) alternatives
+//   $name = /regex/         a regular expression over bytes
+// text and regexes may be followed by nocase and/or wide (UTF-16LE), a regex
+// may also end in /i. a line without a $name is taken as a bare regex
+struct RegexRule {
+	enum Type {
+		TYPE_TEXT,
+		TYPE_HEX,
+		TYPE_REGEX
+	};
+
+	QString name;
+	QString pattern;
+	Type    type;
+	bool    nocase;
+	bool    wide;
+};
+
+struct RegexMatch {
+	yad64::address_t address;
+	quint32          length;
+	int              rule;
+};
+
+typedef QVector<RegexMatch> RegexMatches;
+
+// searches a buffer for any number of rules at once. the rules are compiled
+// into a single unanchored DFA over byte classes which is run once over the
+// data, costing one table lookup per byte no matter how many rules there are.
+// when it reports the end of a match, a reversed DFA for that rule finds where
+// the match starts and an anchored one extends it as far as it goes. if the
+// combined DFA is too big to build up front, each search builds the states it
+// visits as it goes
+class RegexSearcher {
+public:
+	enum { MAX_MATCH_LENGTH = 0x1000 };
+
+public:
+	RegexSearcher();
+
+public:
+	static bool parse_rules(const QString &text, QList<RegexRule> &rules, QString &error);
+
+public:
+	bool compile(const QList<RegexRule> &rules, bool case_sensitive, QString &error);
+	bool empty() const { return search_.isNull(); }
+
+	// finds every match which starts in [first, last), bytes past last are
+	// only used to complete matches. data is assumed to be mapped at base.
+	// matches of a rule don't overlap and are sorted by address
+	void search(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t first, std::size_t last, RegexMatches &matches) const;
+
+private:
+	// an anchored DFA for one rule, states are numbered by their offset into
+	// next and the accepting ones are numbered last
+	struct Dfa {
+		QVector<int>           next;      // -1 is the dead state
+		QVector<QVector<int> > accepts;   // the rules each accepting state accepts
+		int                    start;
+		int                    accepting; // the first accepting state
+	};
+
+private:
+	bool find_start(int rule, const quint8 *data, std::size_t lowest, std::size_t end, std::size_t &start) const;
+	std::size_t find_end(int rule, const quint8 *data, std::size_t size, std::size_t start) const;
+
+private:
+	quint8                         classes_[256];
+	int                            class_count_;
+	QSharedPointer<RegexNfa>       nfa_;
+	QSharedPointer<RegexSearchDfa> search_;
+	QVector<Dfa>                   forward_;
+	QVector<Dfa>                   reverse_;
+};
+
+#endif
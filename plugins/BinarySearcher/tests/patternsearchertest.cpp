@@ -0,0 +1,198 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PatternSearcher.h"
+#include "TestUtil.h"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+// compares PatternSearcher against a masked compare at every aligned offset,
+// for each alignment, with wildcards at the start, middle and end of the
+// patterns and with patterns long enough to get a skip table
+
+namespace {
+
+
+const std::size_t max_pattern_length = 40;
+
+using test::bytes_t;
+using test::next_random;
+
+enum Wildcards {
+	WILDCARDS_NONE,
+	WILDCARDS_START,
+	WILDCARDS_MIDDLE,
+	WILDCARDS_END,
+	WILDCARDS_SCATTERED,
+	WILDCARDS_KINDS
+};
+
+//------------------------------------------------------------------------------
+// Name: make_data(std::size_t size)
+// Desc: mostly a handful of byte values, so that short patterns match often
+//       and long ones sometimes
+//------------------------------------------------------------------------------
+bytes_t make_data(std::size_t size) {
+	static const quint8 common[] = { 0x00, 0x41, 0x42, 0x90, 0xff };
+
+	bytes_t data(size);
+	for(std::size_t i = 0; i < size; ++i) {
+		const quint32 r = next_random();
+		data[i] = (r % 8 == 0) ? static_cast<quint8>(next_random()) : common[r % sizeof(common)];
+	}
+	return data;
+}
+
+//------------------------------------------------------------------------------
+// Name: make_pattern(const bytes_t &data, std::size_t length, Wildcards wildcards)
+// Desc: length bytes copied from somewhere in data, with some of them made
+//       into wildcards
+//------------------------------------------------------------------------------
+BinaryPattern make_pattern(const bytes_t &data, std::size_t length, Wildcards wildcards) {
+
+	const std::size_t offset = next_random() % (data.size() - length + 1);
+
+	BinaryPattern pattern;
+	pattern.bytes = QByteArray(reinterpret_cast<const char *>(&data[offset]), length);
+	pattern.mask  = QByteArray(length, '\xff');
+
+	// never more than length - 1 wildcards, so something is left to compare
+	const std::size_t count = (length > 1) ? 1 + next_random() % std::min<std::size_t>(length - 1, 4) : 0;
+
+	for(std::size_t i = 0; i < count; ++i) {
+		std::size_t position = 0;
+		switch(wildcards) {
+		case WILDCARDS_NONE:      return pattern;
+		case WILDCARDS_START:     position = i; break;
+		case WILDCARDS_MIDDLE:    position = (length - count) / 2 + i; break;
+		case WILDCARDS_END:       position = length - 1 - i; break;
+		default:                  position = next_random() % (length - 1); break;
+		}
+
+		pattern.bytes[static_cast<int>(position)] = static_cast<char>(next_random());
+		pattern.mask[static_cast<int>(position)]  = '\0';
+	}
+
+	return pattern;
+}
+
+bool match_less_than(const PatternMatch &a, const PatternMatch &b) {
+	if(a.address != b.address) {
+		return a.address < b.address;
+	}
+	return a.pattern < b.pattern;
+}
+
+//------------------------------------------------------------------------------
+// Name: reference(...)
+// Desc: every aligned offset in [first, last) at which a pattern fits in the
+//       buffer and matches byte for byte
+//------------------------------------------------------------------------------
+std::vector<PatternMatch> reference(const bytes_t &data, yad64::address_t base, std::size_t first, std::size_t last, const QList<BinaryPattern> &patterns, unsigned int alignment) {
+
+	std::vector<PatternMatch> matches;
+
+	for(int id = 0; id < patterns.size(); ++id) {
+		const BinaryPattern &pattern = patterns[id];
+		const std::size_t length = pattern.bytes.size();
+
+		if(pattern.mask.count('\0') == pattern.mask.size()) {
+			continue;
+		}
+
+		for(std::size_t i = first; i < last && i + length <= data.size(); ++i) {
+			if((base + i) % alignment != 0) {
+				continue;
+			}
+
+			bool found = true;
+			for(std::size_t j = 0; j < length && found; ++j) {
+				found = !pattern.mask[static_cast<int>(j)] || data[i + j] == static_cast<quint8>(pattern.bytes[static_cast<int>(j)]);
+			}
+
+			if(found) {
+				const PatternMatch match = { base + i, id };
+				matches.push_back(match);
+			}
+		}
+	}
+
+	std::sort(matches.begin(), matches.end(), match_less_than);
+	return matches;
+}
+
+bool same(const std::vector<PatternMatch> &a, const PatternMatches &b) {
+	if(a.size() != static_cast<std::size_t>(b.size())) {
+		return false;
+	}
+
+	for(std::size_t i = 0; i < a.size(); ++i) {
+		if(a[i].address != b[i].address || a[i].pattern != b[i].pattern) {
+			return false;
+		}
+	}
+	return true;
+}
+
+}
+
+int main() {
+	static const unsigned int alignments[] = { 1, 2, 4, 8, 16 };
+
+	for(int round = 0; round < 200; ++round) {
+		const bytes_t data = make_data(max_pattern_length + next_random() % 4096);
+
+		// one pattern on its own, so that it is known which way it is searched,
+		// and a few together
+		QList<BinaryPattern> patterns;
+		const int count = (round & 1) ? 1 : 2 + next_random() % 6;
+		for(int i = 0; i < count; ++i) {
+			const std::size_t length = (next_random() & 1) ? 16 + next_random() % (max_pattern_length - 15) : 1 + next_random() % 15;
+			patterns.append(make_pattern(data, length, static_cast<Wildcards>(next_random() % WILDCARDS_KINDS)));
+		}
+
+		for(std::size_t a = 0; a < sizeof(alignments) / sizeof(alignments[0]); ++a) {
+
+			test::performing() << "round " << round << " (" << count << " patterns, alignment " << alignments[a] << ")" << test::ellipsis;
+
+			const yad64::address_t base = 0x400000 + next_random() % 32;
+			const PatternSearcher searcher(patterns, alignments[a]);
+
+			const std::size_t first = (next_random() & 1) ? 0 : next_random() % data.size();
+			const std::size_t last  = (next_random() & 1) ? data.size() : first + next_random() % (data.size() - first + 1);
+
+			const std::vector<PatternMatch> expected_whole = reference(data, base, 0, data.size(), patterns, alignments[a]);
+			const std::vector<PatternMatch> expected_range = reference(data, base, first, last, patterns, alignments[a]);
+
+			PatternMatches whole;
+			searcher.search(&data[0], data.size(), base, 0, data.size(), whole);
+
+			PatternMatches range;
+			searcher.search(&data[0], data.size(), base, first, last, range);
+
+			if(!same(expected_whole, whole) || !same(expected_range, range)) {
+				test::failure() << "expected " << expected_whole.size() << " matches, found " << whole.size() << std::endl;
+				std::cout << "expected " << expected_range.size() << " matches in [" << first << ", " << last << "), found " << range.size() << std::endl;
+				return test::fail();
+			}
+
+			test::ok() << " (" << expected_whole.size() << " matches)" << std::endl;
+		}
+	}
+}
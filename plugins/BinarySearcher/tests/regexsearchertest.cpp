@@ -0,0 +1,764 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "RegexSearcher.h"
+#include "TestUtil.h"
+#include <algorithm>
+#include <bitset>
+#include <iostream>
+#include <vector>
+
+// compares RegexSearcher against a brute-force matcher. each round makes a
+// few random rules as trees, writes them out as text, hex or regex rules for
+// the searcher, and works out from the trees every place each rule can end
+// from every start. the searcher's way of picking matches (the earliest end
+// after the previous match, then the leftmost start for it and the longest
+// end from there) is then applied to those by hand. a last round uses a rule
+// whose search DFA has far more than max_dfa_states states, so the lazy DFA
+// has to start over many times
+
+namespace {
+
+typedef std::vector<int>       positions_t;
+typedef std::bitset<256>       byte_set_t;
+
+using test::bytes_t;
+using test::next_random;
+
+// the bytes the data and the literals are mostly made of, letters of both
+// cases so that nocase makes a difference and zeros so that wide does
+const quint8 alphabet[] = { 'a', 'b', 'A', 'B', '0', '1', 0x00, 0xff, '\n', '$' };
+
+quint8 random_byte() {
+	return alphabet[next_random() % sizeof(alphabet)];
+}
+
+struct TestNode {
+	enum Type {
+		LITERAL,   // the byte a, which is also b
+		RANGE,     // a class of the bytes a to b, or all but those
+		NIBBLES,   // a hex byte, a is the high nibble and b the low one, -1 for ?
+		ANY,
+		DIGIT,
+		CONCAT,
+		ALTERNATE,
+		REPEAT     // min to max of children[0], max is -1 when unbounded
+	};
+
+	Type             type;
+	int              a;
+	int              b;
+	bool             negate;
+	int              min;
+	int              max;
+	std::vector<int> children;
+};
+
+class TestRule {
+public:
+	TestRule(RegexRule::Type type, bool nocase, bool wide) : type_(type), nocase_(nocase), wide_(wide), root_(-1) {
+	}
+
+public:
+	int add(TestNode::Type type, int a = 0, int b = 0) {
+		TestNode node;
+		node.type   = type;
+		node.a      = a;
+		node.b      = b;
+		node.negate = false;
+		node.min    = 0;
+		node.max    = 0;
+		nodes_.push_back(node);
+		return nodes_.size() - 1;
+	}
+
+	int add_repeat(int child, int min, int max) {
+		const int n = add(TestNode::REPEAT);
+		nodes_[n].min = min;
+		nodes_[n].max = max;
+		nodes_[n].children.push_back(child);
+		return n;
+	}
+
+	void add_child(int parent, int child) { nodes_[parent].children.push_back(child); }
+	void set_negate(int n)                 { nodes_[n].negate = true; }
+	void set_nocase()                      { nocase_ = true; }
+	void set_root(int n)                   { root_ = n; }
+
+public:
+	RegexRule rule() const;
+	positions_t ends(const bytes_t &data, int start) const { return apply(root_, data, positions_t(1, start)); }
+	int max_length() const { return max_length(root_); }
+
+private:
+	positions_t apply(int n, const bytes_t &data, const positions_t &from) const;
+	byte_set_t leaf_set(const TestNode &node, bool case_folds) const;
+	int max_length(int n) const;
+	QString render(int n) const;
+	QString render_atom(int n) const;
+
+private:
+	std::vector<TestNode> nodes_;
+	RegexRule::Type       type_;
+	bool                  nocase_;
+	bool                  wide_;
+	int                   root_;
+};
+
+QString byte_text(int ch) {
+	if((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9')) {
+		return QString(QChar(ch));
+	}
+	return QString("\\x%1").arg(ch, 2, 16, QChar('0'));
+}
+
+QString nibble_text(int nibble) {
+	return (nibble < 0) ? QString("?") : QString::number(nibble, 16);
+}
+
+//------------------------------------------------------------------------------
+// Name: rule() const
+// Desc: the rule as the searcher takes it
+//------------------------------------------------------------------------------
+RegexRule TestRule::rule() const {
+	RegexRule rule;
+	rule.name    = "$test";
+	rule.pattern = render(root_);
+	rule.type    = type_;
+	rule.nocase  = nocase_;
+	rule.wide    = wide_;
+	return rule;
+}
+
+//------------------------------------------------------------------------------
+// Name: render(int n) const
+// Desc:
+//------------------------------------------------------------------------------
+QString TestRule::render(int n) const {
+
+	const TestNode &node = nodes_[n];
+
+	if(type_ == RegexRule::TYPE_HEX) {
+		switch(node.type) {
+		case TestNode::NIBBLES:
+			return nibble_text(node.a) + nibble_text(node.b) + " ";
+		case TestNode::REPEAT:
+			if(node.max < 0) {
+				return QString("[%1-] ").arg(node.min);
+			} else if(node.max == node.min && (next_random() & 1)) {
+				return QString("[%1] ").arg(node.min);
+			}
+			return QString("[%1-%2] ").arg(node.min).arg(node.max);
+		case TestNode::ALTERNATE:
+			do {
+				QString s = "( ";
+				for(std::size_t i = 0; i < node.children.size(); ++i) {
+					s += (i ? "| " : "") + render(node.children[i]);
+				}
+				return s + ") ";
+			} while(0);
+		default:
+			break;
+		}
+	}
+
+	switch(node.type) {
+	case TestNode::LITERAL:
+		return byte_text(node.a);
+	case TestNode::RANGE:
+		return QString("[%1%2-%3]").arg(node.negate ? "^" : "").arg(byte_text(node.a)).arg(byte_text(node.b));
+	case TestNode::ANY:
+		return ".";
+	case TestNode::DIGIT:
+		return "\\d";
+	case TestNode::CONCAT:
+		do {
+			QString s;
+			for(std::size_t i = 0; i < node.children.size(); ++i) {
+				s += render(node.children[i]);
+			}
+			return s;
+		} while(0);
+	case TestNode::ALTERNATE:
+		do {
+			QString s = (next_random() & 1) ? "(" : "(?:";
+			for(std::size_t i = 0; i < node.children.size(); ++i) {
+				s += (i ? "|" : "") + render(node.children[i]);
+			}
+			return s + ")";
+		} while(0);
+	case TestNode::REPEAT:
+		do {
+			const QString atom = render_atom(node.children[0]);
+			if(node.min == 0 && node.max == -1) return atom + "*";
+			if(node.min == 1 && node.max == -1) return atom + "+";
+			if(node.min == 0 && node.max == 1)  return atom + "?";
+			if(node.max == -1)                  return atom + QString("{%1,}").arg(node.min);
+			if(node.max == node.min)            return atom + QString("{%1}").arg(node.min);
+			return atom + QString("{%1,%2}").arg(node.min).arg(node.max);
+		} while(0);
+	default:
+		return QString();
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: render_atom(int n) const
+// Desc: node n as something a repeat can follow
+//------------------------------------------------------------------------------
+QString TestRule::render_atom(int n) const {
+	switch(nodes_[n].type) {
+	case TestNode::CONCAT:
+	case TestNode::REPEAT:
+		return "(?:" + render(n) + ")";
+	default:
+		return render(n);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: leaf_set(const TestNode &node, bool case_folds) const
+// Desc: the bytes a leaf matches. the case of letters is only ignored in the
+//       literals and ranges of text and regex rules
+//------------------------------------------------------------------------------
+byte_set_t TestRule::leaf_set(const TestNode &node, bool case_folds) const {
+
+	byte_set_t set;
+
+	switch(node.type) {
+	case TestNode::LITERAL:
+	case TestNode::RANGE:
+		for(int ch = node.a; ch <= node.b; ++ch) {
+			set.set(ch);
+			if(case_folds && ((ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z'))) {
+				set.set(ch ^ 0x20);
+			}
+		}
+		if(node.negate) {
+			set.flip();
+		}
+		break;
+	case TestNode::NIBBLES:
+		for(int ch = 0; ch < 256; ++ch) {
+			set.set(ch, (node.a < 0 || node.a == (ch >> 4)) && (node.b < 0 || node.b == (ch & 0x0f)));
+		}
+		break;
+	case TestNode::ANY:
+		set.set();
+		break;
+	case TestNode::DIGIT:
+		for(int ch = '0'; ch <= '9'; ++ch) {
+			set.set(ch);
+		}
+		break;
+	default:
+		break;
+	}
+
+	return set;
+}
+
+//------------------------------------------------------------------------------
+// Name: apply(int n, const bytes_t &data, const positions_t &from) const
+// Desc: every offset node n can end at starting from any of from, sorted.
+//       wide leaves also take the zero byte after their character
+//------------------------------------------------------------------------------
+positions_t TestRule::apply(int n, const bytes_t &data, const positions_t &from) const {
+
+	const TestNode &node = nodes_[n];
+	positions_t to;
+
+	switch(node.type) {
+	case TestNode::CONCAT:
+		to = from;
+		for(std::size_t i = 0; i < node.children.size() && !to.empty(); ++i) {
+			to = apply(node.children[i], data, to);
+		}
+		return to;
+	case TestNode::ALTERNATE:
+		for(std::size_t i = 0; i < node.children.size(); ++i) {
+			const positions_t ends = apply(node.children[i], data, from);
+			to.insert(to.end(), ends.begin(), ends.end());
+		}
+		break;
+	case TestNode::REPEAT:
+		do {
+			positions_t current = from;
+			for(int i = 0; i < node.min && !current.empty(); ++i) {
+				current = apply(node.children[0], data, current);
+			}
+
+			std::vector<bool> seen(data.size() + 1);
+			for(std::size_t i = 0; i < current.size(); ++i) {
+				seen[current[i]] = true;
+			}
+
+			// only positions not seen before are taken round again, so an
+			// unbounded repeat stops once it stops finding new ones
+			to = current;
+			for(int i = node.min; (node.max < 0 || i < node.max) && !current.empty(); ++i) {
+				const positions_t next = apply(node.children[0], data, current);
+				current.clear();
+				for(std::size_t j = 0; j < next.size(); ++j) {
+					if(!seen[next[j]]) {
+						seen[next[j]] = true;
+						current.push_back(next[j]);
+						to.push_back(next[j]);
+					}
+				}
+			}
+		} while(0);
+		break;
+	default:
+		do {
+			const byte_set_t set = leaf_set(node, nocase_ && type_ != RegexRule::TYPE_HEX);
+			const std::size_t width = wide_ ? 2 : 1;
+			for(std::size_t i = 0; i < from.size(); ++i) {
+				const std::size_t p = from[i];
+				if(p + width <= data.size() && set.test(data[p]) && (!wide_ || data[p + 1] == 0)) {
+					to.push_back(p + width);
+				}
+			}
+		} while(0);
+		break;
+	}
+
+	std::sort(to.begin(), to.end());
+	to.erase(std::unique(to.begin(), to.end()), to.end());
+	return to;
+}
+
+//------------------------------------------------------------------------------
+// Name: max_length(int n) const
+// Desc: the longest match of node n, -1 if there is no limit
+//------------------------------------------------------------------------------
+int TestRule::max_length(int n) const {
+
+	const TestNode &node = nodes_[n];
+	int length = 0;
+
+	switch(node.type) {
+	case TestNode::CONCAT:
+		for(std::size_t i = 0; i < node.children.size(); ++i) {
+			const int child = max_length(node.children[i]);
+			if(child < 0) {
+				return -1;
+			}
+			length += child;
+		}
+		return length;
+	case TestNode::ALTERNATE:
+		for(std::size_t i = 0; i < node.children.size(); ++i) {
+			const int child = max_length(node.children[i]);
+			if(child < 0) {
+				return -1;
+			}
+			length = std::max(length, child);
+		}
+		return length;
+	case TestNode::REPEAT:
+		length = max_length(node.children[0]);
+		return (length < 0 || node.max < 0) ? -1 : length * node.max;
+	default:
+		return wide_ ? 2 : 1;
+	}
+}
+
+int add_literal(TestRule &rule, int ch) {
+	return rule.add(TestNode::LITERAL, ch, ch);
+}
+
+//------------------------------------------------------------------------------
+// Name: random_leaf(TestRule &rule)
+// Desc: a literal mostly, sometimes a class, . or \d
+//------------------------------------------------------------------------------
+int random_leaf(TestRule &rule) {
+	switch(next_random() % 8) {
+	case 0:
+		do {
+			int low  = random_byte();
+			int high = random_byte();
+			if(low > high) {
+				std::swap(low, high);
+			}
+
+			const int n = rule.add(TestNode::RANGE, low, high);
+			if(next_random() & 1) {
+				rule.set_negate(n);
+			}
+			return n;
+		} while(0);
+	case 1:
+		return rule.add(TestNode::ANY);
+	case 2:
+		return rule.add(TestNode::DIGIT);
+	default:
+		return add_literal(rule, random_byte());
+	}
+}
+
+int random_nibbles(TestRule &rule) {
+	const int byte = random_byte();
+	const int high = (next_random() % 4 == 0) ? -1 : (byte >> 4);
+	const int low  = (next_random() % 4 == 0) ? -1 : (byte & 0x0f);
+	return rule.add(TestNode::NIBBLES, high, low);
+}
+
+//------------------------------------------------------------------------------
+// Name: random_repeat(TestRule &rule, int child)
+// Desc: child with one of *, +, ?, {n}, {n,} or {n,m} after it
+//------------------------------------------------------------------------------
+int random_repeat(TestRule &rule, int child) {
+	switch(next_random() % 6) {
+	case 0:  return rule.add_repeat(child, 0, -1);
+	case 1:  return rule.add_repeat(child, 1, -1);
+	case 2:  return rule.add_repeat(child, 0, 1);
+	case 3:  do { const int n = next_random() % 4; return rule.add_repeat(child, n, n); } while(0);
+	case 4:  return rule.add_repeat(child, next_random() % 3, -1);
+	default: do { const int n = next_random() % 3; return rule.add_repeat(child, n, n + 1 + next_random() % 3); } while(0);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: random_regex(TestRule &rule, int depth)
+// Desc: a concatenation which starts with a plain leaf, so that it never
+//       matches the empty string
+//------------------------------------------------------------------------------
+int random_regex(TestRule &rule, int depth) {
+
+	const int concat = rule.add(TestNode::CONCAT);
+	rule.add_child(concat, random_leaf(rule));
+
+	const int count = next_random() % 4;
+	for(int i = 0; i < count; ++i) {
+		int item;
+		if(depth > 0 && next_random() % 4 == 0) {
+			item = rule.add(TestNode::ALTERNATE);
+			const int alternatives = 2 + next_random() % 2;
+			for(int j = 0; j < alternatives; ++j) {
+				rule.add_child(item, random_regex(rule, depth - 1));
+			}
+		} else {
+			item = random_leaf(rule);
+		}
+
+		if(next_random() % 3 == 0) {
+			item = random_repeat(rule, item);
+		}
+
+		rule.add_child(concat, item);
+	}
+
+	return concat;
+}
+
+//------------------------------------------------------------------------------
+// Name: random_hex(TestRule &rule, bool nested)
+// Desc: bytes with nibble wildcards, [n-m] jumps and a ( .. | .. ) group.
+//       there is at most one group and one unbounded jump, more than that
+//       quickly gets too complex to compile
+//------------------------------------------------------------------------------
+int random_hex(TestRule &rule, bool nested) {
+
+	const int concat = rule.add(TestNode::CONCAT);
+	rule.add_child(concat, random_nibbles(rule));
+
+	bool group     = nested;
+	bool unbounded = nested;
+
+	const int count = next_random() % 5;
+	for(int i = 0; i < count; ++i) {
+		switch(next_random() % 4) {
+		case 0:
+			do {
+				const int min = next_random() % 4;
+				const int max = (!unbounded && next_random() % 4 == 0) ? -1 : min + next_random() % 3;
+				unbounded = unbounded || max < 0;
+				rule.add_child(concat, rule.add_repeat(rule.add(TestNode::ANY), min, max));
+			} while(0);
+			break;
+		case 1:
+			if(!group) {
+				const int alternate    = rule.add(TestNode::ALTERNATE);
+				const int alternatives = 2 + next_random() % 2;
+				for(int j = 0; j < alternatives; ++j) {
+					rule.add_child(alternate, random_hex(rule, true));
+				}
+				rule.add_child(concat, alternate);
+				group = true;
+				break;
+			}
+			// fall through
+		default:
+			rule.add_child(concat, random_nibbles(rule));
+			break;
+		}
+	}
+
+	return concat;
+}
+
+TestRule random_tree() {
+	const bool nocase = (next_random() % 3 == 0);
+	const bool wide   = (next_random() % 4 == 0);
+
+	switch(next_random() % 3) {
+	case 0:
+		do {
+			TestRule rule(RegexRule::TYPE_TEXT, nocase, wide);
+			const int concat = rule.add(TestNode::CONCAT);
+			const int count  = 1 + next_random() % 5;
+			for(int i = 0; i < count; ++i) {
+				rule.add_child(concat, add_literal(rule, random_byte()));
+			}
+			rule.set_root(concat);
+			return rule;
+		} while(0);
+	case 1:
+		do {
+			TestRule rule(RegexRule::TYPE_HEX, false, false);
+			rule.set_root(random_hex(rule, false));
+			return rule;
+		} while(0);
+	default:
+		do {
+			TestRule rule(RegexRule::TYPE_REGEX, nocase, wide);
+			rule.set_root(random_regex(rule, 2));
+			return rule;
+		} while(0);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: random_rule()
+// Desc: nested repeats and jumps can make a rule too complex to compile, those
+//       are simply drawn again
+//------------------------------------------------------------------------------
+TestRule random_rule() {
+	for(;;) {
+		const TestRule rule = random_tree();
+
+		QList<RegexRule> list;
+		list.append(rule.rule());
+
+		RegexSearcher searcher;
+		QString error;
+		if(searcher.compile(list, true, error)) {
+			return rule;
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: make_data(std::size_t size)
+// Desc: bytes from the alphabet, with some of it as UTF-16LE
+//------------------------------------------------------------------------------
+bytes_t make_data(std::size_t size) {
+	bytes_t data;
+	while(data.size() < size) {
+		const std::size_t n = 1 + next_random() % 16;
+		const bool wide     = (next_random() % 4 == 0);
+		for(std::size_t i = 0; i < n; ++i) {
+			data.push_back(random_byte());
+			if(wide) {
+				data.push_back(0);
+			}
+		}
+	}
+
+	data.resize(size);
+	return data;
+}
+
+bool match_less_than(const RegexMatch &a, const RegexMatch &b) {
+	if(a.address != b.address) {
+		return a.address < b.address;
+	}
+	return a.rule < b.rule;
+}
+
+//------------------------------------------------------------------------------
+// Name: reference(...)
+// Desc: for each rule, walks the ends after the previous match in order. the
+//       first one any match starting at or after the previous match reaches
+//       is taken, with the leftmost such start and the longest end from it
+//------------------------------------------------------------------------------
+std::vector<RegexMatch> reference(const bytes_t &data, yad64::address_t base, std::size_t first, std::size_t last, const std::vector<TestRule> &rules, bool case_sensitive) {
+
+	const std::size_t max_match = RegexSearcher::MAX_MATCH_LENGTH;
+	const std::size_t size      = data.size();
+	const std::size_t limit     = std::min(size, std::min(last, size) + max_match);
+
+	std::vector<RegexMatch> matches;
+	if(first >= std::min(last, size)) {
+		return matches;
+	}
+
+	for(std::size_t r = 0; r < rules.size(); ++r) {
+
+		TestRule rule = rules[r];
+		if(!case_sensitive) {
+			rule.set_nocase();
+		}
+
+		const int longest        = rule.max_length();
+		const std::size_t window = (longest < 0) ? max_match : std::min<std::size_t>(max_match, longest);
+
+		std::vector<positions_t> ends(size);
+		for(std::size_t s = first; s < size; ++s) {
+			ends[s] = rule.ends(data, s);
+		}
+
+		std::size_t resume = first;
+		for(std::size_t e = first + 1; e <= limit; ++e) {
+			if(e <= resume) {
+				continue;
+			}
+
+			std::size_t start = (e - resume > window) ? e - window : resume;
+			while(start < e && !std::binary_search(ends[start].begin(), ends[start].end(), static_cast<int>(e))) {
+				++start;
+			}
+
+			if(start == e || start >= last) {
+				continue;
+			}
+
+			std::size_t end = e;
+			for(std::size_t i = 0; i < ends[start].size(); ++i) {
+				if(static_cast<std::size_t>(ends[start][i]) <= std::min(size, start + max_match)) {
+					end = std::max<std::size_t>(end, ends[start][i]);
+				}
+			}
+
+			const RegexMatch match = { base + start, static_cast<quint32>(end - start), static_cast<int>(r) };
+			matches.push_back(match);
+			resume = end;
+		}
+	}
+
+	std::sort(matches.begin(), matches.end(), match_less_than);
+	return matches;
+}
+
+bool same(const std::vector<RegexMatch> &a, const RegexMatches &b) {
+	if(a.size() != static_cast<std::size_t>(b.size())) {
+		return false;
+	}
+
+	for(std::size_t i = 0; i < a.size(); ++i) {
+		if(a[i].address != b[i].address || a[i].length != b[i].length || a[i].rule != b[i].rule) {
+			return false;
+		}
+	}
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: check(...)
+// Desc: searches [first, last) and compares the result, printing the rules
+//       when they differ
+//------------------------------------------------------------------------------
+bool check(const bytes_t &data, std::size_t first, std::size_t last, const std::vector<TestRule> &rules, bool case_sensitive) {
+
+	const yad64::address_t base = 0x400000;
+
+	QList<RegexRule> list;
+	for(std::size_t i = 0; i < rules.size(); ++i) {
+		list.append(rules[i].rule());
+	}
+
+	RegexSearcher searcher;
+	QString error;
+	if(!searcher.compile(list, case_sensitive, error)) {
+		test::failure() << "failed to compile: " << qPrintable(error) << std::endl;
+		return false;
+	}
+
+	const std::vector<RegexMatch> expected = reference(data, base, first, last, rules, case_sensitive);
+
+	RegexMatches found;
+	searcher.search(&data[0], data.size(), base, first, last, found);
+
+	if(!same(expected, found)) {
+		test::failure() << "expected " << expected.size() << " matches in [" << first << ", " << last << "), found " << found.size() << std::endl;
+		for(int i = 0; i < list.size(); ++i) {
+			std::cout << "rule " << i << ": " << qPrintable(list[i].pattern) << (list[i].nocase ? " nocase" : "") << (list[i].wide ? " wide" : "") << std::endl;
+		}
+		return false;
+	}
+
+	test::ok() << " (" << expected.size() << " matches)" << std::endl;
+	return true;
+}
+
+}
+
+int main() {
+
+	for(int round = 0; round < 300; ++round) {
+
+		std::vector<TestRule> rules;
+		const int count = 1 + next_random() % 4;
+		for(int i = 0; i < count; ++i) {
+			rules.push_back(random_rule());
+		}
+
+		const bytes_t data        = make_data(1 + next_random() % 600);
+		const bool case_sensitive = (next_random() % 4 != 0);
+
+		// the whole buffer, and a range with one edge or both inside it
+		const std::size_t first = (next_random() & 1) ? 0 : next_random() % data.size();
+		const std::size_t last  = (next_random() & 1) ? data.size() : first + next_random() % (data.size() - first + 1);
+
+		test::performing() << "round " << round << " (" << count << " rules)" << test::ellipsis;
+		if(!check(data, 0, data.size(), rules, case_sensitive) || !check(data, first, last, rules, case_sensitive)) {
+			return test::fail();
+		}
+	}
+
+	// an 'a' 16 bytes before a 'b'. the search DFA has a state for each set of
+	// places an 'a' was seen in the last 17 bytes, which is many more than
+	// max_dfa_states, while the per rule DFAs stay small
+	std::vector<TestRule> rules;
+
+	TestRule jump(RegexRule::TYPE_REGEX, false, false);
+	const int concat = jump.add(TestNode::CONCAT);
+	jump.add_child(concat, add_literal(jump, 'a'));
+	jump.add_child(concat, jump.add_repeat(jump.add(TestNode::ANY), 16, 16));
+	jump.add_child(concat, add_literal(jump, 'b'));
+	jump.set_root(concat);
+	rules.push_back(jump);
+
+	TestRule text(RegexRule::TYPE_TEXT, true, false);
+	const int literal = text.add(TestNode::CONCAT);
+	text.add_child(literal, add_literal(text, 'b'));
+	text.add_child(literal, add_literal(text, 'a'));
+	text.set_root(literal);
+	rules.push_back(text);
+
+	bytes_t data(0x10000);
+	for(std::size_t i = 0; i < data.size(); ++i) {
+		data[i] = "abc"[next_random() % 3];
+	}
+
+	test::performing() << "lazy DFA round" << test::ellipsis;
+	if(!check(data, 0, data.size(), rules, true) || !check(data, 0x1234, 0xf000, rules, true)) {
+		return test::fail();
+	}
+}
@@ -11,6 +11,9 @@ unix {
 	linux-* {
 		DEPENDPATH  += unix/linux
 		INCLUDEPATH += unix/linux
+
+		SOURCES += DebugEventThread.cpp
+		HEADERS += DebugEventThread.h
 	}
 
 	openbsd-* {
@@ -34,5 +37,5 @@ win32 {
 	INCLUDEPATH += win32 .
 }
 
-HEADERS += PlatformState.h   PlatformRegion.h   DebuggerCoreBase.h   DebuggerCore.h   X86Breakpoint.h
-SOURCES += PlatformState.cpp PlatformRegion.cpp DebuggerCoreBase.cpp DebuggerCore.cpp X86Breakpoint.cpp
+HEADERS += PlatformState.h   PlatformRegion.h   DebuggerCoreBase.h   DebuggerCore.h   X86Breakpoint.h   PageCache.h
+SOURCES += PlatformState.cpp PlatformRegion.cpp DebuggerCoreBase.cpp DebuggerCore.cpp X86Breakpoint.cpp PageCache.cpp
@@ -0,0 +1,122 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PageCache.h"
+#include <cstring>
+
+//------------------------------------------------------------------------------
+// Name: PageCache(yad64::address_t page_size, int max_pages)
+// Desc: constructor
+//------------------------------------------------------------------------------
+PageCache::PageCache(yad64::address_t page_size, int max_pages) : page_size_(page_size), max_pages_(max_pages), hits_(0), misses_(0) {
+}
+
+//------------------------------------------------------------------------------
+// Name: find(yad64::address_t page)
+// Desc: returns the cached contents of the page starting at <page>, or NULL if
+//       it isn't cached
+//------------------------------------------------------------------------------
+const quint8 *PageCache::find(yad64::address_t page) {
+
+	Q_ASSERT((page & (page_size_ - 1)) == 0);
+
+	const QHash<yad64::address_t, QByteArray>::const_iterator it = pages_.find(page);
+	if(it != pages_.end()) {
+		++hits_;
+		return reinterpret_cast<const quint8 *>(it->constData());
+	}
+
+	++misses_;
+	return 0;
+}
+
+//------------------------------------------------------------------------------
+// Name: insert(yad64::address_t page)
+// Desc: makes room for the page starting at <page> and returns a buffer of
+//       page_size() bytes for the caller to fill in
+// Note: when the cache is full, it is simply emptied. Between two stops we
+//       generally look at a small working set, so this rarely happens
+//------------------------------------------------------------------------------
+quint8 *PageCache::insert(yad64::address_t page) {
+
+	Q_ASSERT((page & (page_size_ - 1)) == 0);
+
+	if(pages_.size() >= max_pages_) {
+		pages_.clear();
+	}
+
+	QByteArray &bytes = pages_[page];
+	bytes.resize(page_size_);
+	return reinterpret_cast<quint8 *>(bytes.data());
+}
+
+//------------------------------------------------------------------------------
+// Name: remove(yad64::address_t page)
+// Desc:
+//------------------------------------------------------------------------------
+void PageCache::remove(yad64::address_t page) {
+	pages_.remove(page);
+}
+
+//------------------------------------------------------------------------------
+// Name: invalidate(yad64::address_t address, std::size_t len)
+// Desc: drops every page which overlaps [address, address + len)
+//------------------------------------------------------------------------------
+void PageCache::invalidate(yad64::address_t address, std::size_t len) {
+
+	if(len != 0) {
+		const yad64::address_t first = address & ~(page_size_ - 1);
+		const yad64::address_t last  = (address + len - 1) & ~(page_size_ - 1);
+
+		for(yad64::address_t page = first; page <= last; page += page_size_) {
+			pages_.remove(page);
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: update(yad64::address_t address, const void *buf, std::size_t len)
+// Desc: copies freshly written bytes into any cached pages they overlap
+//------------------------------------------------------------------------------
+void PageCache::update(yad64::address_t address, const void *buf, std::size_t len) {
+
+	const quint8 *ptr = reinterpret_cast<const quint8 *>(buf);
+
+	while(len != 0) {
+		const yad64::address_t page   = address & ~(page_size_ - 1);
+		const std::size_t      offset = address - page;
+		const std::size_t      n      = qMin<std::size_t>(page_size_ - offset, len);
+
+		const QHash<yad64::address_t, QByteArray>::iterator it = pages_.find(page);
+		if(it != pages_.end()) {
+			std::memcpy(it->data() + offset, ptr, n);
+		}
+
+		address += n;
+		ptr     += n;
+		len     -= n;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: clear()
+// Desc: forgets every cached page, the hit/miss counters are kept
+//------------------------------------------------------------------------------
+void PageCache::clear() {
+	pages_.clear();
+}
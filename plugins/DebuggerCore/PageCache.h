@@ -0,0 +1,54 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef PAGE_CACHE_20121010_H_
+#define PAGE_CACHE_20121010_H_
+
+#include "Types.h"
+#include <QByteArray>
+#include <QHash>
+
+// a read-through cache of debuggee pages, it is only valid for as long as the
+// debuggee is stopped, so the core must clear it before letting anything run
+class PageCache {
+public:
+	PageCache(yad64::address_t page_size, int max_pages);
+
+public:
+	const quint8 *find(yad64::address_t page);
+	quint8 *insert(yad64::address_t page);
+	void remove(yad64::address_t page);
+	void invalidate(yad64::address_t address, std::size_t len);
+	void update(yad64::address_t address, const void *buf, std::size_t len);
+	void clear();
+
+public:
+	yad64::address_t page_size() const { return page_size_; }
+	quint64 hits() const               { return hits_; }
+	quint64 misses() const             { return misses_; }
+
+private:
+	QHash<yad64::address_t, QByteArray> pages_;
+	yad64::address_t                    page_size_;
+	int                                 max_pages_;
+	quint64                             hits_;
+	quint64                             misses_;
+};
+
+#endif
+
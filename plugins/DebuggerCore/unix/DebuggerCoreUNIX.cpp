@@ -151,6 +151,15 @@ bool native::wait_for_sigchld(int msecs) {
 	return false;
 }
 
+//------------------------------------------------------------------------------
+// Name: sigchld_fd()
+// Desc: returns the read end of the SIGCHLD self-pipe, for code which wants to
+//       multiplex it with other descriptors instead of using wait_for_sigchld
+//------------------------------------------------------------------------------
+int native::sigchld_fd() {
+	return selfpipe[0];
+}
+
 //------------------------------------------------------------------------------
 // Name: waitpid_timeout(pid_t pid, int *status, int options, int msecs, bool &timeout)
 // Desc:
@@ -347,16 +356,40 @@ bool DebuggerCoreUNIX::read_pages(yad64::address_t address, void *buf, std::size
 			}
 		}
 
-		// TODO: handle if breakponts have a size more than 1!
+		// show the original bytes in the buffer..
+		restore_breakpoint_bytes(orig_address, orig_ptr, end_address - orig_address);
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: restore_breakpoint_bytes(yad64::address_t address, void *buf, std::size_t len) const
+// Desc: replaces any breakpoint bytes which fall inside of [address, address + len)
+//       in <buf> with the original bytes they replaced
+// Note: walks whichever is smaller, the range or the breakpoint list
+//------------------------------------------------------------------------------
+void DebuggerCoreUNIX::restore_breakpoint_bytes(yad64::address_t address, void *buf, std::size_t len) const {
+
+	Q_ASSERT(buf);
+
+	quint8 *const ptr = reinterpret_cast<quint8 *>(buf);
+
+	// TODO: handle if breakponts have a size more than 1!
+	if(len < static_cast<std::size_t>(breakpoints_.size())) {
+		for(std::size_t i = 0; i < len; ++i) {
+			const BreakpointState::const_iterator it = breakpoints_.find(address + i);
+			if(it != breakpoints_.end()) {
+				ptr[i] = it.value()->original_bytes()[0];
+			}
+		}
+	} else {
 		Q_FOREACH(const IBreakpoint::pointer &bp, breakpoints_) {
-			if(bp->address() >= orig_address && bp->address() < end_address) {
-				// show the original bytes in the buffer..
-				orig_ptr[bp->address() - orig_address] = bp->original_bytes()[0];
+			if(bp->address() >= address && bp->address() - address < len) {
+				ptr[bp->address() - address] = bp->original_bytes()[0];
 			}
 		}
 	}
-
-	return true;
 }
 
 //------------------------------------------------------------------------------
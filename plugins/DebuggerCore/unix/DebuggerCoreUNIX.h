@@ -34,6 +34,7 @@ namespace native {
 	ssize_t read(int fd, void *buf, size_t count);
 	ssize_t write(int fd, const void *buf, size_t count);
 	bool wait_for_sigchld(int msecs);
+	int sigchld_fd();
 }
 
 class DebuggerCoreUNIX : public DebuggerCoreBase {
@@ -47,6 +48,7 @@ protected:
 	void execute_process(const QString &path, const QString &cwd, const QList<QByteArray> &args);
 	void write_byte(yad64::address_t address, quint8 value, bool &ok);
 	void write_byte_base(yad64::address_t address, quint8 value, bool &ok);
+	void restore_breakpoint_bytes(yad64::address_t address, void *buf, std::size_t len) const;
 
 public:
 	virtual bool read_pages(yad64::address_t address, void *buf, std::size_t count);
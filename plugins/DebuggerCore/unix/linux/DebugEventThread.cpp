@@ -0,0 +1,342 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "DebugEventThread.h"
+#include "DebuggerCoreUNIX.h"
+
+#include <QMutexLocker>
+
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+enum reap_result_t {
+	REAP_NOTHING,
+	REAP_EVENT,
+	REAP_FOREIGN
+};
+
+//------------------------------------------------------------------------------
+// Name: now_usecs()
+// Desc: monotonic time in microseconds
+//------------------------------------------------------------------------------
+quint64 now_usecs() {
+	timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<quint64>(ts.tv_sec) * 1000000 + ts.tv_nsec / 1000;
+}
+
+//------------------------------------------------------------------------------
+// Name: drain(int fd)
+// Desc: empties a non-blocking pipe
+//------------------------------------------------------------------------------
+void drain(int fd) {
+	char buf[64];
+	while(native::read(fd, buf, sizeof(buf)) > 0) {
+	}
+}
+
+}
+
+//------------------------------------------------------------------------------
+// Name: DebugEventThread(yad64::pid_t pid, const QList<yad64::tid_t> &threads, QObject *parent)
+// Desc: threads are the ones which have already been waited on by the core,
+//       we need to know them to recognize their exit events
+//------------------------------------------------------------------------------
+DebugEventThread::DebugEventThread(yad64::pid_t pid, const QList<yad64::tid_t> &threads, QObject *parent) : QThread(parent),
+		pid_(pid), stopping_(false), known_threads_(threads.toSet()), event_count_(0), total_latency_(0), worst_latency_(0) {
+
+	wake_pipe_[0] = -1;
+	wake_pipe_[1] = -1;
+
+	if(::pipe(wake_pipe_) == 0) {
+		::fcntl(wake_pipe_[0], F_SETFL, ::fcntl(wake_pipe_[0], F_GETFL) | O_NONBLOCK);
+		::fcntl(wake_pipe_[1], F_SETFL, ::fcntl(wake_pipe_[1], F_GETFL) | O_NONBLOCK);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: ~DebugEventThread()
+// Desc:
+//------------------------------------------------------------------------------
+DebugEventThread::~DebugEventThread() {
+	stop();
+
+	if(wake_pipe_[0] != -1) {
+		::close(wake_pipe_[0]);
+		::close(wake_pipe_[1]);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: stop()
+// Desc: asks the thread to finish and waits for it, any events which were
+//       reaped but never collected are discarded
+//------------------------------------------------------------------------------
+void DebugEventThread::stop() {
+	if(isRunning()) {
+		stopping_ = true;
+		native::write(wake_pipe_[1], " ", sizeof(char));
+		wait();
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: is_debuggee(yad64::tid_t tid) const
+// Desc: returns true if tid is one of the threads of the process we debug
+// Note: a signal 0 tgkill is how we recognize threads we have not seen yet, it
+//       only works while they are alive, so exits rely on known_threads_
+//------------------------------------------------------------------------------
+bool DebugEventThread::is_debuggee(yad64::tid_t tid) const {
+	return tid == pid_ || known_threads_.contains(tid) || syscall(SYS_tgkill, pid_, tid, 0) == 0;
+}
+
+//------------------------------------------------------------------------------
+// Name: queue_event(yad64::tid_t tid, int status)
+// Desc: records a reaped state change and tells whoever is listening
+//------------------------------------------------------------------------------
+void DebugEventThread::queue_event(yad64::tid_t tid, int status) {
+
+	if(WIFEXITED(status) || WIFSIGNALED(status)) {
+		known_threads_.remove(tid);
+	} else {
+		known_threads_.insert(tid);
+	}
+
+	event_t e;
+	e.tid       = tid;
+	e.status    = status;
+	e.timestamp = now_usecs();
+
+	{
+		QMutexLocker locker(&mutex_);
+		events_.append(e);
+		cond_.wakeAll();
+	}
+
+	Q_EMIT event_ready();
+}
+
+//------------------------------------------------------------------------------
+// Name: reap_known()
+// Desc: waits on each of the debuggee's threads we know of by tid, returns how
+//       many events were queued
+// Note: this is the fallback for when a foreign child sits at the head of the
+//       wait queue, a P_ALL peek would keep returning that child and the
+//       debuggee would starve until its owner got around to reaping it. A
+//       thread we haven't heard from yet is reported by its parent's clone
+//       event first, and the core then asks for it through wait_for
+//------------------------------------------------------------------------------
+int DebugEventThread::reap_known() {
+
+	QSet<yad64::tid_t> tids = known_threads_;
+	tids.insert(pid_);
+
+	int count = 0;
+	Q_FOREACH(const yad64::tid_t tid, tids) {
+		int status;
+		if(tid > 0 && native::waitpid(tid, &status, __WALL | WNOHANG) > 0) {
+			queue_event(tid, status);
+			++count;
+		}
+	}
+
+	return count;
+}
+
+//------------------------------------------------------------------------------
+// Name: reap_one()
+// Desc: collects at most one state change of the debuggee and queues it
+// Note: we peek with WNOWAIT first so that we never steal the exit status of
+//       a child which belongs to someone else
+//------------------------------------------------------------------------------
+int DebugEventThread::reap_one() {
+
+	siginfo_t info;
+	std::memset(&info, 0, sizeof(info));
+
+	if(::waitid(P_ALL, 0, &info, WEXITED | WSTOPPED | WNOHANG | WNOWAIT | __WALL) == -1 || info.si_pid == 0) {
+		return REAP_NOTHING;
+	}
+
+	const yad64::tid_t tid = info.si_pid;
+	if(!is_debuggee(tid)) {
+		return reap_known() ? REAP_EVENT : REAP_FOREIGN;
+	}
+
+	int status;
+	if(native::waitpid(tid, &status, __WALL | WNOHANG) <= 0) {
+		return REAP_NOTHING;
+	}
+
+	queue_event(tid, status);
+	return REAP_EVENT;
+}
+
+//------------------------------------------------------------------------------
+// Name: run()
+// Desc: sleeps on SIGCHLD, and each time it fires collects everything which is
+//       ready. This costs a constant number of syscalls per event no matter
+//       how many threads the debuggee has, unless a foreign child is waiting
+//       to be reaped, then it is one waitpid per known thread. Either way
+//       nothing is done until a child changes state or wait_for asks for a
+//       thread
+//------------------------------------------------------------------------------
+void DebugEventThread::run() {
+
+	pollfd fds[2];
+	fds[0].fd     = native::sigchld_fd();
+	fds[0].events = POLLIN;
+	fds[1].fd     = wake_pipe_[0];
+	fds[1].events = POLLIN;
+
+	while(!stopping_) {
+
+		// drain first, a SIGCHLD arriving after this point leaves a byte in the
+		// pipe and the poll below returns right away
+		drain(fds[0].fd);
+		drain(fds[1].fd);
+
+		{
+			QMutexLocker locker(&mutex_);
+			known_threads_.unite(watched_threads_);
+			watched_threads_.clear();
+		}
+
+		while(!stopping_ && reap_one() == REAP_EVENT) {
+		}
+
+		if(!stopping_ && ::poll(fds, 2, -1) == -1 && errno != EINTR) {
+			qDebug("[DebugEventThread] poll failed: %s", strerror(errno));
+			break;
+		}
+	}
+
+	drain(wake_pipe_[0]);
+
+	// let anyone blocked in wait_for know that nothing more is coming
+	QMutexLocker locker(&mutex_);
+	stopping_ = true;
+	cond_.wakeAll();
+}
+
+//------------------------------------------------------------------------------
+// Name: next_event(yad64::tid_t &tid, int &status)
+// Desc: takes the oldest queued event, returns false if there is none
+// Note: never blocks, event_ready() is emitted once for every queued event
+//------------------------------------------------------------------------------
+bool DebugEventThread::next_event(yad64::tid_t &tid, int &status) {
+
+	QMutexLocker locker(&mutex_);
+
+	if(events_.isEmpty()) {
+		return false;
+	}
+
+	const event_t e = events_.takeFirst();
+	tid    = e.tid;
+	status = e.status;
+
+	record_latency(e.timestamp);
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: wait_for(yad64::tid_t tid, int &status)
+// Desc: blocks until the given thread has something to report, this is what
+//       the core uses instead of waitpid(tid) while this thread is running
+// Note: the thread may be new to us, so it is handed to the event thread to
+//       be known from then on, and the event thread is woken in case its
+//       SIGCHLD has already been drained
+//------------------------------------------------------------------------------
+bool DebugEventThread::wait_for(yad64::tid_t tid, int &status) {
+
+	QMutexLocker locker(&mutex_);
+
+	bool watched = false;
+	Q_FOREVER {
+		for(QList<event_t>::iterator it = events_.begin(); it != events_.end(); ++it) {
+			if(it->tid == tid) {
+				status = it->status;
+				events_.erase(it);
+				return true;
+			}
+		}
+
+		if(stopping_) {
+			return false;
+		}
+
+		if(!watched) {
+			watched_threads_.insert(tid);
+			native::write(wake_pipe_[1], " ", sizeof(char));
+			watched = true;
+		}
+
+		cond_.wait(&mutex_);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: record_latency(quint64 timestamp)
+// Desc: the time between the kernel handing us the event and the core picking
+//       it up, which is dominated by the trip through the GUI event loop
+// Note: mutex_ must be held
+//------------------------------------------------------------------------------
+void DebugEventThread::record_latency(quint64 timestamp) {
+	const quint64 latency = now_usecs() - timestamp;
+
+	++event_count_;
+	total_latency_ += latency;
+	worst_latency_  = qMax(worst_latency_, latency);
+}
+
+//------------------------------------------------------------------------------
+// Name: event_count() const
+// Desc: how many events have been collected through next_event
+//------------------------------------------------------------------------------
+quint64 DebugEventThread::event_count() const {
+	QMutexLocker locker(&mutex_);
+	return event_count_;
+}
+
+//------------------------------------------------------------------------------
+// Name: average_latency() const
+// Desc: in microseconds
+//------------------------------------------------------------------------------
+quint64 DebugEventThread::average_latency() const {
+	QMutexLocker locker(&mutex_);
+	return event_count_ ? total_latency_ / event_count_ : 0;
+}
+
+//------------------------------------------------------------------------------
+// Name: worst_latency() const
+// Desc: in microseconds
+//------------------------------------------------------------------------------
+quint64 DebugEventThread::worst_latency() const {
+	QMutexLocker locker(&mutex_);
+	return worst_latency_;
+}
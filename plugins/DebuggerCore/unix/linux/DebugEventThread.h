@@ -0,0 +1,84 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef DEBUG_EVENT_THREAD_20121012_H_
+#define DEBUG_EVENT_THREAD_20121012_H_
+
+#include "Types.h"
+#include <QList>
+#include <QMutex>
+#include <QSet>
+#include <QThread>
+#include <QWaitCondition>
+
+// sits in the kernel waiting for the debuggee to change state so that the GUI
+// doesn't have to poll. Every state change is reaped exactly once, here, and
+// handed to whoever asks for it through next_event or wait_for. Nothing in
+// this thread touches ptrace, that has to happen on the thread which attached
+class DebugEventThread : public QThread {
+	Q_OBJECT
+
+public:
+	DebugEventThread(yad64::pid_t pid, const QList<yad64::tid_t> &threads, QObject *parent = 0);
+	virtual ~DebugEventThread();
+
+public:
+	bool next_event(yad64::tid_t &tid, int &status);
+	bool wait_for(yad64::tid_t tid, int &status);
+	void stop();
+
+public:
+	quint64 event_count() const;
+	quint64 average_latency() const;
+	quint64 worst_latency() const;
+
+Q_SIGNALS:
+	void event_ready();
+
+protected:
+	virtual void run();
+
+private:
+	bool is_debuggee(yad64::tid_t tid) const;
+	int reap_known();
+	int reap_one();
+	void queue_event(yad64::tid_t tid, int status);
+	void record_latency(quint64 timestamp);
+
+private:
+	struct event_t {
+		yad64::tid_t tid;
+		int          status;
+		quint64      timestamp;
+	};
+
+	const yad64::pid_t    pid_;
+	int                   wake_pipe_[2];
+	volatile bool         stopping_;
+	QSet<yad64::tid_t>    known_threads_;
+
+	mutable QMutex        mutex_;
+	QWaitCondition        cond_;
+	QList<event_t>        events_;
+	QSet<yad64::tid_t>    watched_threads_;
+	quint64               event_count_;
+	quint64               total_latency_;
+	quint64               worst_latency_;
+};
+
+#endif
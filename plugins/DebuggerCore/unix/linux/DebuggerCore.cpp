@@ -18,6 +18,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "DebuggerCore.h"
 #include "DebugEvent.h"
+#include "DebugEventThread.h"
 #include "Debugger.h"
 #include "PlatformRegion.h"
 #include "PlatformState.h"
@@ -35,10 +36,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #endif
 
 #include <asm/ldt.h>
+#include <fcntl.h>
 #include <pwd.h>
 #include <sys/mman.h>
 #include <sys/ptrace.h>
 #include <sys/syscall.h>   /* For SYS_xxx definitions */
+#include <sys/uio.h>
 #include <sys/user.h>
 #include <sys/wait.h>
 #include <unistd.h>
@@ -57,6 +60,65 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 namespace {
 
+// the most pages we will ask the kernel for in a single process_vm_readv call
+const int max_iovecs = 256;
+
+// how many pages we are willing to keep around between two stops, and the
+// largest read which is allowed to go through the cache. Bigger reads are
+// bulk scans (analysis, searches) which would just evict the working set
+const int max_cached_pages      = 1024;
+const int max_cached_read_pages = 16;
+
+//------------------------------------------------------------------------------
+// Name: system_page_size()
+// Desc:
+//------------------------------------------------------------------------------
+yad64::address_t system_page_size() {
+#if defined(_SC_PAGESIZE)
+	return sysconf(_SC_PAGESIZE);
+#elif defined(_SC_PAGE_SIZE)
+	return sysconf(_SC_PAGE_SIZE);
+#else
+	return PAGE_SIZE;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Name: vm_readv(pid_t pid, const iovec *local_iov, unsigned long liovcnt, const iovec *remote_iov, unsigned long riovcnt)
+// Desc: process_vm_readv, but doesn't depend on libc having a wrapper for it
+//------------------------------------------------------------------------------
+ssize_t vm_readv(pid_t pid, const iovec *local_iov, unsigned long liovcnt, const iovec *remote_iov, unsigned long riovcnt) {
+#if defined(SYS_process_vm_readv)
+	return syscall(SYS_process_vm_readv, pid, local_iov, liovcnt, remote_iov, riovcnt, 0UL);
+#else
+	Q_UNUSED(pid);
+	Q_UNUSED(local_iov);
+	Q_UNUSED(liovcnt);
+	Q_UNUSED(remote_iov);
+	Q_UNUSED(riovcnt);
+	errno = ENOSYS;
+	return -1;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Name: vm_writev(pid_t pid, const iovec *local_iov, unsigned long liovcnt, const iovec *remote_iov, unsigned long riovcnt)
+// Desc: process_vm_writev, but doesn't depend on libc having a wrapper for it
+//------------------------------------------------------------------------------
+ssize_t vm_writev(pid_t pid, const iovec *local_iov, unsigned long liovcnt, const iovec *remote_iov, unsigned long riovcnt) {
+#if defined(SYS_process_vm_writev)
+	return syscall(SYS_process_vm_writev, pid, local_iov, liovcnt, remote_iov, riovcnt, 0UL);
+#else
+	Q_UNUSED(pid);
+	Q_UNUSED(local_iov);
+	Q_UNUSED(liovcnt);
+	Q_UNUSED(remote_iov);
+	Q_UNUSED(riovcnt);
+	errno = ENOSYS;
+	return -1;
+#endif
+}
+
 //------------------------------------------------------------------------------
 // Name: is_numeric(const QString &s)
 // Desc: returns true if the string only contains decimal digits
@@ -156,14 +218,7 @@ bool process_map_line(const QString &line, MemoryRegion *region) {
 // Name: DebuggerCore()
 // Desc: constructor
 //------------------------------------------------------------------------------
-DebuggerCore::DebuggerCore() {
-#if defined(_SC_PAGESIZE)
-	page_size_ = sysconf(_SC_PAGESIZE);
-#elif defined(_SC_PAGE_SIZE)
-	page_size_ = sysconf(_SC_PAGE_SIZE);
-#else
-	page_size_ = PAGE_SIZE;
-#endif
+DebuggerCore::DebuggerCore() : page_size_(system_page_size()), event_thread_(0), mem_fd_(-1), have_process_vm_(true), page_cache_(system_page_size(), max_cached_pages), event_waiter_(0) {
 }
 
 //------------------------------------------------------------------------------
@@ -270,9 +325,13 @@ bool DebuggerCore::handle_event(DebugEvent &event, yad64::tid_t tid, int status)
 
 			threads_.insert(new_tid, thread_info(0));
 
+			// the new thread may have announced itself before its parent did
 			int thread_status = 0;
-			if(!waited_threads_.contains(new_tid)) {
-				if(native::waitpid(new_tid, &thread_status, __WALL) > 0) {
+			if(early_threads_.contains(new_tid)) {
+				thread_status = early_threads_.take(new_tid);
+				waited_threads_.insert(new_tid);
+			} else if(!waited_threads_.contains(new_tid)) {
+				if(wait_for_thread(new_tid, &thread_status)) {
 					waited_threads_.insert(new_tid);
 				}
 			}
@@ -290,7 +349,9 @@ bool DebuggerCore::handle_event(DebugEvent &event, yad64::tid_t tid, int status)
 		return false;
 	}
 
-	// normal event
+	// normal event, anything we cached before is stale now
+	page_cache_.clear();
+
 	event                = DebugEvent(status, pid(), tid);
 	active_thread_       = tid;
 	event_thread_        = tid;
@@ -312,7 +373,7 @@ void DebuggerCore::stop_threads() {
 			tgkill(pid(), tid, SIGSTOP);
 
 			int thread_status;
-			if(native::waitpid(tid, &thread_status, __WALL) > 0) {
+			if(wait_for_thread(tid, &thread_status)) {
 				waited_threads_.insert(tid);
 				it->status = thread_status;
 
@@ -324,13 +385,83 @@ void DebuggerCore::stop_threads() {
 	}
 }
 
+//------------------------------------------------------------------------------
+// Name: wait_for_thread(yad64::tid_t tid, int *status)
+// Desc: blocking waitpid on a single thread, while the event thread is running
+//       it is the only one allowed to reap, so we ask it instead
+//------------------------------------------------------------------------------
+bool DebuggerCore::wait_for_thread(yad64::tid_t tid, int *status) {
+	if(event_waiter_) {
+		return event_waiter_->wait_for(tid, *status);
+	}
+
+	return native::waitpid(tid, status, __WALL) > 0;
+}
+
+//------------------------------------------------------------------------------
+// Name: start_event_thread()
+// Desc: from here on debug events are pushed to us, debug_event_ready() is
+//       emitted (on our thread) every time one is ready to be collected
+//------------------------------------------------------------------------------
+void DebuggerCore::start_event_thread() {
+	Q_ASSERT(!event_waiter_);
+
+	event_waiter_ = new DebugEventThread(pid(), thread_ids(), this);
+	connect(event_waiter_, SIGNAL(event_ready()), this, SIGNAL(debug_event_ready()), Qt::QueuedConnection);
+	event_waiter_->start();
+}
+
+//------------------------------------------------------------------------------
+// Name: stop_event_thread()
+// Desc:
+//------------------------------------------------------------------------------
+void DebuggerCore::stop_event_thread() {
+	if(event_waiter_) {
+		event_waiter_->stop();
+
+		if(const quint64 count = event_waiter_->event_count()) {
+			qDebug("[DebuggerCore] %llu debug events, dispatch latency: average %llu us, worst %llu us",
+				count, event_waiter_->average_latency(), event_waiter_->worst_latency());
+		}
+
+		delete event_waiter_;
+		event_waiter_ = 0;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: event_notifier()
+// Desc:
+//------------------------------------------------------------------------------
+QObject *DebuggerCore::event_notifier() {
+	return this;
+}
+
 //------------------------------------------------------------------------------
 // Name: wait_debug_event(DebugEvent &event, int msecs)
 // Desc: waits for a debug event, msecs is a timeout
 //      it will return false if an error or timeout occurs
+// Note: while the event thread is running this never blocks, it just collects
+//       what the thread has already reaped
 //------------------------------------------------------------------------------
 bool DebuggerCore::wait_debug_event(DebugEvent &event, int msecs) {
 
+	if(attached() && event_waiter_) {
+		yad64::tid_t tid;
+		int status;
+		if(event_waiter_->next_event(tid, status)) {
+			// a brand new thread whose parent hasn't told us about it yet,
+			// keep it for when the clone event shows up
+			if(!threads_.contains(tid)) {
+				early_threads_.insert(tid, status);
+				return false;
+			}
+
+			return handle_event(event, tid, status);
+		}
+		return false;
+	}
+
 	if(attached()) {
 		if(!native::wait_for_sigchld(msecs)) {
 			Q_FOREACH(yad64::tid_t thread, thread_ids()) {
@@ -358,6 +489,383 @@ long DebuggerCore::read_data(yad64::address_t address, bool &ok) {
 	return v;
 }
 
+//------------------------------------------------------------------------------
+// Name: read_vm(yad64::address_t address, quint8 *buf, std::size_t len)
+// Desc: reads as much of the front of [address, address + len) as it can using
+//       process_vm_readv, returns the number of bytes read
+// Note: each page gets its own remote iovec, the kernel never splits an iovec
+//       on a partial transfer, so a short read ends exactly at the first page
+//       which could not be read
+//------------------------------------------------------------------------------
+std::size_t DebuggerCore::read_vm(yad64::address_t address, quint8 *buf, std::size_t len) {
+
+	iovec remote[max_iovecs];
+	iovec local;
+
+	std::size_t total = 0;
+	int count         = 0;
+	while(count < max_iovecs && total < len) {
+		const std::size_t n = qMin<std::size_t>(page_size() - ((address + total) & (page_size() - 1)), len - total);
+		remote[count].iov_base = reinterpret_cast<void *>(address + total);
+		remote[count].iov_len  = n;
+		total += n;
+		++count;
+	}
+
+	local.iov_base = buf;
+	local.iov_len  = total;
+
+	const ssize_t ret = vm_readv(pid(), &local, 1, remote, count);
+	if(ret == -1) {
+		if(errno == ENOSYS) {
+			qDebug("[DebuggerCore] process_vm_readv/writev are not supported, falling back to /proc/%d/mem", pid());
+			have_process_vm_ = false;
+		}
+		return 0;
+	}
+
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// Name: read_proc_mem(yad64::address_t address, quint8 *buf, std::size_t len)
+// Desc: reads as much of the front of [address, address + len) as it can using
+//       /proc/<pid>/mem, returns the number of bytes read
+// Note: unlike process_vm_readv, this can read pages which are not PROT_READ
+//------------------------------------------------------------------------------
+std::size_t DebuggerCore::read_proc_mem(yad64::address_t address, quint8 *buf, std::size_t len) {
+
+	if(mem_fd_ == -1) {
+		return 0;
+	}
+
+	ssize_t ret;
+	do {
+		ret = ::pread(mem_fd_, buf, len, static_cast<off_t>(address));
+	} while(ret == -1 && errno == EINTR);
+
+	return (ret > 0) ? ret : 0;
+}
+
+//------------------------------------------------------------------------------
+// Name: read_memory(yad64::address_t address, void *buf, std::size_t len)
+// Desc: reads [address, address + len) in bulk, any page which cannot be read
+//       is filled with 0xff bytes. returns true if every byte was read
+// Note: this does not restore breakpoint bytes, callers must do that
+//------------------------------------------------------------------------------
+bool DebuggerCore::read_memory(yad64::address_t address, void *buf, std::size_t len) {
+
+	quint8 *ptr = reinterpret_cast<quint8 *>(buf);
+	bool ok     = true;
+
+	while(len != 0) {
+		std::size_t n = 0;
+
+		if(have_process_vm_) {
+			n = read_vm(address, ptr, len);
+		}
+
+		if(n == 0) {
+			n = read_proc_mem(address, ptr, len);
+		}
+
+		if(n == 0) {
+			// neither bulk method could read the page at <address>, so try
+			// the old fashioned way before giving up on just this page
+			n = qMin<std::size_t>(page_size() - (address & (page_size() - 1)), len);
+
+			bool page_ok = true;
+			for(std::size_t i = 0; i < n && page_ok; ++i) {
+				ptr[i] = read_byte_base(address + i, page_ok);
+			}
+
+			if(!page_ok) {
+				std::memset(ptr, 0xff, n);
+				ok = false;
+			}
+		}
+
+		address += n;
+		ptr     += n;
+		len     -= n;
+	}
+
+	return ok;
+}
+
+//------------------------------------------------------------------------------
+// Name: read_cached(yad64::address_t address, void *buf, std::size_t len)
+// Desc: like read_memory, but small reads are satisfied from (and fill) the
+//       page cache, so repeated reads of the same page between two stops only
+//       cost a single trip to the kernel
+//------------------------------------------------------------------------------
+bool DebuggerCore::read_cached(yad64::address_t address, void *buf, std::size_t len) {
+
+	if(len > page_size() * max_cached_read_pages) {
+		return read_memory(address, buf, len);
+	}
+
+	quint8 *ptr = reinterpret_cast<quint8 *>(buf);
+	bool ok     = true;
+
+	while(len != 0) {
+		const yad64::address_t page   = address & ~(page_size() - 1);
+		const std::size_t      offset = address - page;
+		const std::size_t      n      = qMin<std::size_t>(page_size() - offset, len);
+
+		const quint8 *data = page_cache_.find(page);
+		if(!data) {
+			quint8 *const entry = page_cache_.insert(page);
+			if(read_memory(page, entry, page_size())) {
+				data = entry;
+			} else {
+				// don't remember failures, the page may show up later
+				page_cache_.remove(page);
+			}
+		}
+
+		if(data) {
+			std::memcpy(ptr, data + offset, n);
+		} else {
+			ok = read_memory(address, ptr, n) && ok;
+		}
+
+		address += n;
+		ptr     += n;
+		len     -= n;
+	}
+
+	return ok;
+}
+
+//------------------------------------------------------------------------------
+// Name: read_pages(yad64::address_t address, void *buf, std::size_t count)
+// Desc: reads <count> pages from the process starting at <address>
+// Note: buf's size must be >= count * page_size()
+// Note: address should be page aligned.
+//------------------------------------------------------------------------------
+bool DebuggerCore::read_pages(yad64::address_t address, void *buf, std::size_t count) {
+
+	Q_ASSERT(buf);
+
+	if(!attached()) {
+		return false;
+	}
+
+	if((address & (page_size() - 1)) == 0) {
+		const std::size_t len = page_size() * count;
+
+		if(!read_cached(address, buf, len)) {
+			return false;
+		}
+
+		// show the original bytes in the buffer..
+		restore_breakpoint_bytes(address, buf, len);
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: read_bytes(yad64::address_t address, void *buf, std::size_t len)
+// Desc: reads <len> bytes into <buf> starting at <address>
+// Note: if the read failed, the pages of the buffer that could not be read will
+//       be filled with 0xff bytes
+//------------------------------------------------------------------------------
+bool DebuggerCore::read_bytes(yad64::address_t address, void *buf, std::size_t len) {
+
+	Q_ASSERT(buf);
+
+	if(!attached()) {
+		return false;
+	}
+
+	if(len != 0) {
+		read_cached(address, buf, len);
+		restore_breakpoint_bytes(address, buf, len);
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: write_vm(yad64::address_t address, const quint8 *buf, std::size_t len)
+// Desc: writes as much of the front of [address, address + len) as it can using
+//       process_vm_writev, returns the number of bytes written
+// Note: this only succeeds for pages which are writable in the debuggee, like
+//       read_vm, a short write ends exactly at the first page which failed
+//------------------------------------------------------------------------------
+std::size_t DebuggerCore::write_vm(yad64::address_t address, const quint8 *buf, std::size_t len) {
+
+	iovec remote[max_iovecs];
+	iovec local;
+
+	std::size_t total = 0;
+	int count         = 0;
+	while(count < max_iovecs && total < len) {
+		const std::size_t n = qMin<std::size_t>(page_size() - ((address + total) & (page_size() - 1)), len - total);
+		remote[count].iov_base = reinterpret_cast<void *>(address + total);
+		remote[count].iov_len  = n;
+		total += n;
+		++count;
+	}
+
+	local.iov_base = const_cast<quint8 *>(buf);
+	local.iov_len  = total;
+
+	const ssize_t ret = vm_writev(pid(), &local, 1, remote, count);
+	if(ret == -1) {
+		if(errno == ENOSYS) {
+			qDebug("[DebuggerCore] process_vm_readv/writev are not supported, falling back to /proc/%d/mem", pid());
+			have_process_vm_ = false;
+		}
+		return 0;
+	}
+
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// Name: write_proc_mem(yad64::address_t address, const quint8 *buf, std::size_t len)
+// Desc: writes as much of the front of [address, address + len) as it can using
+//       /proc/<pid>/mem, returns the number of bytes written
+// Note: this is how we patch read-only pages such as .text
+//------------------------------------------------------------------------------
+std::size_t DebuggerCore::write_proc_mem(yad64::address_t address, const quint8 *buf, std::size_t len) {
+
+	if(mem_fd_ == -1) {
+		return 0;
+	}
+
+	ssize_t ret;
+	do {
+		ret = ::pwrite(mem_fd_, buf, len, static_cast<off_t>(address));
+	} while(ret == -1 && errno == EINTR);
+
+	return (ret > 0) ? ret : 0;
+}
+
+//------------------------------------------------------------------------------
+// Name: write_ptrace(yad64::address_t address, const quint8 *buf, std::size_t len)
+// Desc: writes [address, address + len) a word at a time using ptrace, only the
+//       partial words at either end need to be read back first
+// Note: the words are aligned, so they never straddle a page boundary
+//------------------------------------------------------------------------------
+bool DebuggerCore::write_ptrace(yad64::address_t address, const quint8 *buf, std::size_t len) {
+
+	while(len != 0) {
+		const yad64::address_t aligned = address & ~static_cast<yad64::address_t>(YAD64_WORDSIZE - 1);
+		const std::size_t offset       = address - aligned;
+		const std::size_t n            = qMin<std::size_t>(YAD64_WORDSIZE - offset, len);
+
+		long word = 0;
+		if(n != YAD64_WORDSIZE) {
+			bool ok;
+			word = read_data(aligned, ok);
+			if(!ok) {
+				return false;
+			}
+		}
+
+		std::memcpy(reinterpret_cast<quint8 *>(&word) + offset, buf, n);
+
+		if(!write_data(aligned, word)) {
+			return false;
+		}
+
+		address += n;
+		buf     += n;
+		len     -= n;
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: write_memory(yad64::address_t address, const void *buf, std::size_t len)
+// Desc: writes [address, address + len) in bulk, stops at the first page which
+//       cannot be written by any method. returns true if every byte was written
+//------------------------------------------------------------------------------
+bool DebuggerCore::write_memory(yad64::address_t address, const void *buf, std::size_t len) {
+
+	const quint8 *ptr = reinterpret_cast<const quint8 *>(buf);
+
+	while(len != 0) {
+		std::size_t n = 0;
+
+		if(have_process_vm_) {
+			n = write_vm(address, ptr, len);
+		}
+
+		if(n == 0) {
+			n = write_proc_mem(address, ptr, len);
+		}
+
+		if(n == 0) {
+			// neither bulk method could write the page at <address>, so
+			// fall back to poking it a word at a time
+			n = qMin<std::size_t>(page_size() - (address & (page_size() - 1)), len);
+			if(!write_ptrace(address, ptr, n)) {
+				return false;
+			}
+		}
+
+		address += n;
+		ptr     += n;
+		len     -= n;
+	}
+
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: write_bytes(yad64::address_t address, const void *buf, std::size_t len)
+// Desc: writes <len> bytes from <buf> starting at <address>
+// Note: assumes the this will not trample any breakpoints, must be handled
+//       in calling code!
+//------------------------------------------------------------------------------
+bool DebuggerCore::write_bytes(yad64::address_t address, const void *buf, std::size_t len) {
+
+	Q_ASSERT(buf);
+
+	// writing nothing has always counted as a failure
+	if(!attached() || len == 0) {
+		return false;
+	}
+
+	// keep the page cache coherent with what is really there
+	if(!write_memory(address, buf, len)) {
+		page_cache_.invalidate(address, len);
+		return false;
+	}
+
+	page_cache_.update(address, buf, len);
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: open_memory_file()
+// Desc: opens /proc/<pid>/mem for the bulk read/write fallback paths
+//------------------------------------------------------------------------------
+void DebuggerCore::open_memory_file() {
+
+	if(mem_fd_ != -1) {
+		::close(mem_fd_);
+	}
+
+	const QByteArray filename = QString("/proc/%1/mem").arg(pid()).toLocal8Bit();
+
+	// we'd like to be able to write through it too, but reading is better than nothing
+	mem_fd_ = ::open(filename.constData(), O_RDWR | O_CLOEXEC);
+	if(mem_fd_ == -1) {
+		mem_fd_ = ::open(filename.constData(), O_RDONLY | O_CLOEXEC);
+	}
+
+	if(mem_fd_ == -1) {
+		qDebug("[DebuggerCore] failed to open /proc/%d/mem: %s", pid(), strerror(errno));
+	}
+}
+
 //------------------------------------------------------------------------------
 // Name: write_data(yad64::address_t address, long value)
 // Desc:
@@ -414,6 +922,8 @@ bool DebuggerCore::attach(yad64::pid_t pid) {
 		pid_            = pid;
 		active_thread_  = pid;
 		event_thread_   = pid;
+		open_memory_file();
+		start_event_thread();
 		return true;
 	}
 
@@ -430,6 +940,8 @@ void DebuggerCore::detach() {
 		stop_threads();
 	
 		clear_breakpoints();
+
+		stop_event_thread();
 		
 		Q_FOREACH(yad64::tid_t thread, thread_ids()) {
 			if(ptrace(PTRACE_DETACH, thread, 0, 0) == 0) {
@@ -449,6 +961,8 @@ void DebuggerCore::kill() {
 	if(attached()) {
 		clear_breakpoints();
 
+		stop_event_thread();
+
 		ptrace(PTRACE_KILL, pid(), 0, 0);
 
 		// TODO: do i need to actually do this wait?
@@ -482,6 +996,8 @@ void DebuggerCore::resume(yad64::EVENT_STATUS status) {
 
 	if(attached()) {
 		if(status != yad64::DEBUG_STOP) {
+			page_cache_.clear();
+
 			const yad64::tid_t tid = active_thread();
 			const int code = (status == yad64::DEBUG_EXCEPTION_NOT_HANDLED) ? resume_code(threads_[tid].status) : 0;
 			ptrace_continue(tid, code);
@@ -505,6 +1021,8 @@ void DebuggerCore::step(yad64::EVENT_STATUS status) {
 
 	if(attached()) {
 		if(status != yad64::DEBUG_STOP) {
+			page_cache_.clear();
+
 			const yad64::tid_t tid = active_thread();
 			const int code = (status == yad64::DEBUG_EXCEPTION_NOT_HANDLED) ? resume_code(threads_[tid].status) : 0;
 			ptrace_step(tid, code);
@@ -653,6 +1171,8 @@ bool DebuggerCore::open(const QString &path, const QString &cwd, const QList<QBy
 			pid_            = pid;
 			active_thread_  = pid;
 			event_thread_   = pid;
+			open_memory_file();
+			start_event_thread();
 
 			return true;
 		} while(0);
@@ -681,8 +1201,18 @@ void DebuggerCore::set_active_thread(yad64::tid_t tid) {
 // Desc:
 //------------------------------------------------------------------------------
 void DebuggerCore::reset() {
+	stop_event_thread();
+
+	if(mem_fd_ != -1) {
+		::close(mem_fd_);
+		mem_fd_ = -1;
+	}
+
+	page_cache_.clear();
 	threads_.clear();
 	waited_threads_.clear();
+	early_threads_.clear();
+	last_maps_.clear();
 	active_thread_ = 0;
 	pid_           = 0;
 	event_thread_  = 0;
@@ -826,6 +1356,42 @@ QList<MemoryRegion> DebuggerCore::memory_regions() const {
 	return regions;
 }
 
+//------------------------------------------------------------------------------
+// Name: memory_map_changed()
+// Desc: compares the raw contents of /proc/<pid>/maps with what we saw last
+//       time. Generating the text is cheap compared to parsing it into regions
+//       and then loading symbols and rebuilding the views for each of them
+// Note: a plain read loop, QFile reports a size of 0 for proc files
+//------------------------------------------------------------------------------
+bool DebuggerCore::memory_map_changed() {
+
+	if(pid_ == 0) {
+		last_maps_.clear();
+		return true;
+	}
+
+	const QByteArray filename = QString("/proc/%1/maps").arg(pid_).toLocal8Bit();
+	const int fd = ::open(filename.constData(), O_RDONLY | O_CLOEXEC);
+	if(fd == -1) {
+		return true;
+	}
+
+	QByteArray maps;
+	char buf[4096];
+	ssize_t n;
+	while((n = native::read(fd, buf, sizeof(buf))) > 0) {
+		maps.append(buf, n);
+	}
+	::close(fd);
+
+	if(n == -1 || maps != last_maps_) {
+		last_maps_ = maps;
+		return true;
+	}
+
+	return false;
+}
+
 //------------------------------------------------------------------------------
 // Name: 
 // Desc:
@@ -20,9 +20,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define DEBUGGERCORE_20090529_H_
 
 #include "DebuggerCoreUNIX.h"
+#include "PageCache.h"
 #include <QHash>
 #include <QSet>
 
+class DebugEventThread;
+
 class DebuggerCore : public DebuggerCoreUNIX {
 	Q_OBJECT
 	Q_INTERFACES(IDebuggerCore)
@@ -37,6 +40,7 @@ public:
 	virtual yad64::address_t page_size() const;
 	virtual bool has_extension(quint64 ext) const;
 	virtual bool wait_debug_event(DebugEvent &event, int msecs);
+	virtual QObject *event_notifier();
 	virtual bool attach(yad64::pid_t pid);
 	virtual void detach();
 	virtual void kill();
@@ -47,6 +51,16 @@ public:
 	virtual void set_state(const State &state);
 	virtual bool open(const QString &path, const QString &cwd, const QList<QByteArray> &args, const QString &tty);
 
+public:
+	virtual bool read_pages(yad64::address_t address, void *buf, std::size_t count);
+	virtual bool read_bytes(yad64::address_t address, void *buf, std::size_t len);
+	virtual bool write_bytes(yad64::address_t address, const void *buf, std::size_t len);
+
+public:
+	// statistics for the per-stop page cache
+	virtual quint64 memory_cache_hits() const   { return page_cache_.hits(); }
+	virtual quint64 memory_cache_misses() const { return page_cache_.misses(); }
+
 public:
 	// thread support stuff (optional)
 	virtual QList<yad64::tid_t> thread_ids() const { return threads_.keys(); }
@@ -55,6 +69,7 @@ public:
 
 public:
 	virtual QList<MemoryRegion> memory_regions() const;
+	virtual bool memory_map_changed();
 
 public:
 	virtual IState *create_state() const;
@@ -81,11 +96,28 @@ private:
 	long ptrace_get_event_message(yad64::tid_t tid, unsigned long *message);
 	long ptrace_traceme();
 
+private:
+	bool read_cached(yad64::address_t address, void *buf, std::size_t len);
+	bool read_memory(yad64::address_t address, void *buf, std::size_t len);
+	std::size_t read_proc_mem(yad64::address_t address, quint8 *buf, std::size_t len);
+	std::size_t read_vm(yad64::address_t address, quint8 *buf, std::size_t len);
+	bool write_memory(yad64::address_t address, const void *buf, std::size_t len);
+	bool write_ptrace(yad64::address_t address, const quint8 *buf, std::size_t len);
+	std::size_t write_proc_mem(yad64::address_t address, const quint8 *buf, std::size_t len);
+	std::size_t write_vm(yad64::address_t address, const quint8 *buf, std::size_t len);
+	void open_memory_file();
+
 private:
 	void reset();
 	void stop_threads();
 	bool handle_event(DebugEvent &event, yad64::tid_t tid, int status);
 	bool attach_thread(yad64::tid_t tid);
+	bool wait_for_thread(yad64::tid_t tid, int *status);
+	void start_event_thread();
+	void stop_event_thread();
+
+Q_SIGNALS:
+	void debug_event_ready();
 
 private:
 	struct thread_info {
@@ -100,6 +132,12 @@ private:
 	threadmap_t      threads_;
 	QSet<yad64::tid_t> waited_threads_;
 	yad64::tid_t       event_thread_;
+	int              mem_fd_;
+	bool             have_process_vm_;
+	PageCache        page_cache_;
+	DebugEventThread *event_waiter_;
+	QHash<yad64::tid_t, int> early_threads_;
+	QByteArray       last_maps_;
 };
 
 #endif
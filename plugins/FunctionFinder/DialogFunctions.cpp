@@ -20,6 +20,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "Debugger.h"
 #include "MemoryRegions.h"
 #include "IAnalyzer.h"
+#include "Job.h"
 
 #include <QDialog>
 #include <QHeaderView>
@@ -48,6 +49,9 @@ DialogFunctions::DialogFunctions(QWidget *parent) : QDialog(parent), ui(new Ui::
 // Desc:
 //------------------------------------------------------------------------------
 DialogFunctions::~DialogFunctions() {
+	if(job_) {
+		job_->cancel();
+	}
 	delete ui;
 }
 
@@ -78,7 +82,7 @@ void DialogFunctions::showEvent(QShowEvent *) {
 
 //------------------------------------------------------------------------------
 // Name: do_find()
-// Desc:
+// Desc: starts the analysis of the selected regions
 //------------------------------------------------------------------------------
 void DialogFunctions::do_find() {
 
@@ -91,79 +95,101 @@ void DialogFunctions::do_find() {
 			return;
 		}
 
-		QObject *const analyzer_object = dynamic_cast<QObject *>(analyzer);
-
-		if(analyzer_object) {
-			connect(analyzer_object, SIGNAL(update_progress(int)), ui->progressBar, SLOT(setValue(int)));
-		}
-
 		ui->tableWidget->setRowCount(0);
-		ui->tableWidget->setSortingEnabled(false);
 
+		regions_.clear();
 		Q_FOREACH(const QModelIndex &selected_item, sel) {
 
 			const QModelIndex index = filter_model_->mapToSource(selected_item);
 
-			// do the search for this region!
 			if(const MemoryRegion *const region_ptr = reinterpret_cast<const MemoryRegion *>(index.internalPointer())) {
+				// NOTE: see Analyzer::analysis_input for an explanation for this copy...
+				regions_.append(*region_ptr);
+			}
+		}
+
+		// all of the regions are analyzed at once
+		job_ = analyzer->analysis_job(regions_);
+
+		connect(job_, SIGNAL(progress(int)), ui->progressBar, SLOT(setValue(int)));
+		connect(job_, SIGNAL(finished(bool)), this, SLOT(job_finished(bool)));
+
+		ui->progressBar->setValue(0);
+		ui->btnFind->setText(tr("&Cancel"));
+		yad64::v1::submit_job(job_);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: job_finished(bool cancelled)
+// Desc: lists the functions of the regions, by now the analyzer has them
+//------------------------------------------------------------------------------
+void DialogFunctions::job_finished(bool cancelled) {
 
-				// NOTE: see Analyzer::analyze for an explanation for this copy...
-				MemoryRegion region(*region_ptr);
+	job_ = 0;
+	if(!cancelled) {
+		ui->progressBar->setValue(100);
+	}
+	ui->btnFind->setText(tr("&Find"));
 
-				analyzer->analyze(region);
+	IAnalyzer *const analyzer = yad64::v1::analyzer();
+	if(!analyzer) {
+		return;
+	}
 
-				const IAnalyzer::FunctionMap &results = analyzer->functions(region);
+	ui->tableWidget->setSortingEnabled(false);
 
-				Q_FOREACH(const IAnalyzer::Function &info, results) {
+	Q_FOREACH(const MemoryRegion &region, regions_) {
 
-					const int row = ui->tableWidget->rowCount();
-					ui->tableWidget->insertRow(row);
+		const IAnalyzer::FunctionMap results = analyzer->functions(region);
 
-					// entry point
-					QTableWidgetItem *const p = new QTableWidgetItem(yad64::v1::format_pointer(info.entry_address));
-					p->setData(Qt::UserRole, info.entry_address);
-					ui->tableWidget->setItem(row, 0, p);
+		Q_FOREACH(const IAnalyzer::Function &info, results) {
 
-					// upper bound of the function
-					if(info.reference_count >= MIN_REFCOUNT) {
-						ui->tableWidget->setItem(row, 1, new QTableWidgetItem(yad64::v1::format_pointer(info.end_address)));
+			const int row = ui->tableWidget->rowCount();
+			ui->tableWidget->insertRow(row);
 
-						QTableWidgetItem *const size_item = new QTableWidgetItem;
-						size_item->setData(Qt::DisplayRole, info.end_address - info.entry_address + 1);
+			// entry point
+			QTableWidgetItem *const p = new QTableWidgetItem(yad64::v1::format_pointer(info.entry_address));
+			p->setData(Qt::UserRole, info.entry_address);
+			ui->tableWidget->setItem(row, 0, p);
 
-						ui->tableWidget->setItem(row, 2, size_item);
-					}
+			// upper bound of the function
+			if(info.reference_count >= MIN_REFCOUNT) {
+				ui->tableWidget->setItem(row, 1, new QTableWidgetItem(yad64::v1::format_pointer(info.end_address)));
 
-					// reference count
-					QTableWidgetItem *const itemCount = new QTableWidgetItem;
-					itemCount->setData(Qt::DisplayRole, info.reference_count);
-					ui->tableWidget->setItem(row, 3, itemCount);
+				QTableWidgetItem *const size_item = new QTableWidgetItem;
+				size_item->setData(Qt::DisplayRole, info.end_address - info.entry_address + 1);
 
-					// type
-					if(info.type == IAnalyzer::Function::FUNCTION_THUNK) {
-						ui->tableWidget->setItem(row, 4, new QTableWidgetItem(tr("Thunk")));
-					} else {
-						ui->tableWidget->setItem(row, 4, new QTableWidgetItem(tr("Standard Function")));
-					}
-				}
+				ui->tableWidget->setItem(row, 2, size_item);
 			}
-		}
-		ui->tableWidget->setSortingEnabled(true);
 
-		if(analyzer_object) {
-			disconnect(analyzer_object, SIGNAL(update_progress(int)), ui->progressBar, SLOT(setValue(int)));
+			// reference count
+			QTableWidgetItem *const itemCount = new QTableWidgetItem;
+			itemCount->setData(Qt::DisplayRole, info.reference_count);
+			ui->tableWidget->setItem(row, 3, itemCount);
+
+			// type
+			if(info.type == IAnalyzer::Function::FUNCTION_THUNK) {
+				ui->tableWidget->setItem(row, 4, new QTableWidgetItem(tr("Thunk")));
+			} else {
+				ui->tableWidget->setItem(row, 4, new QTableWidgetItem(tr("Standard Function")));
+			}
 		}
 	}
+
+	ui->tableWidget->setSortingEnabled(true);
 }
 
 //------------------------------------------------------------------------------
 // Name: on_btnFind_clicked()
-// Desc:
+// Desc: find button event handler, while an analysis runs it cancels it instead
 //------------------------------------------------------------------------------
 void DialogFunctions::on_btnFind_clicked() {
-	ui->btnFind->setEnabled(false);
-	ui->progressBar->setValue(0);
+
+	if(job_) {
+		job_->cancel();
+		return;
+	}
+
 	do_find();
-	ui->progressBar->setValue(100);
-	ui->btnFind->setEnabled(true);
 }
@@ -19,11 +19,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifndef DIALOGFUNCTIONS_20061101_H_
 #define DIALOGFUNCTIONS_20061101_H_
 
+#include "MemoryRegion.h"
 #include "Types.h"
 #include <QDialog>
+#include <QList>
+#include <QPointer>
 
 class QSortFilterProxyModel;
 class IAnalyzer;
+class Job;
 
 namespace Ui { class DialogFunctions; }
 
@@ -38,6 +42,9 @@ public Q_SLOTS:
 	void on_btnFind_clicked();
 	void on_tableWidget_cellDoubleClicked (int row, int column);
 
+private Q_SLOTS:
+	void job_finished(bool cancelled);
+
 private:
 	virtual void showEvent(QShowEvent *event);
 
@@ -47,6 +54,8 @@ private:
 private:
 	Ui::DialogFunctions *const ui;
 	QSortFilterProxyModel *    filter_model_;
+	QPointer<Job>              job_;
+	QList<MemoryRegion>        regions_;
 };
 
 #endif
@@ -18,15 +18,19 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "DialogOpcodes.h"
 #include "IDebuggerCore.h"
+#include "Instruction.h"
+#include "Job.h"
 #include "Debugger.h"
 #include "MemoryRegions.h"
 #include "ByteShiftArray.h"
+#include "ResultsModel.h"
+#include "ResultsView.h"
 #include "Util.h"
 
 #include <QHeaderView>
 #include <QMessageBox>
 #include <QSortFilterProxyModel>
-#include <QListWidgetItem>
+#include <QVector>
 #include <QDebug>
 
 #include "ui_dialogopcodes.h"
@@ -37,6 +41,38 @@ namespace {
 #elif defined(YAD64_X86_64)
 	const yad64::Operand::Register STACK_REG = yad64::Operand::REG_RSP;
 #endif
+
+class OpcodeJob : public Job {
+public:
+	OpcodeJob(const QList<MemoryRegion> &regions, int classtype);
+
+public:
+	virtual void run();
+
+private:
+	// we currently only support opcodes sequences up to 8 bytes big
+	union OpcodeData {
+		quint32 dword;
+		quint64 qword;
+		quint8  data[sizeof(quint64)];
+	};
+
+	void test_esp_add_0(const OpcodeData &data, yad64::address_t start_address);
+	void test_esp_add_regx1(const OpcodeData &data, yad64::address_t start_address);
+	void test_esp_add_regx2(const OpcodeData &data, yad64::address_t start_address);
+	void test_esp_sub_regx1(const OpcodeData &data, yad64::address_t start_address);
+	void add_result(QList<yad64::Instruction> instructions, yad64::address_t rva);
+
+	template <yad64::Operand::Register REG>
+	void test_reg_to_ip(const OpcodeData &data, yad64::address_t start_address);
+
+private:
+	const QList<MemoryRegion> regions_;
+	const int                 classtype_;
+	const yad64::address_t    page_size_;
+	ResultStore               found_; // results not yet reported
+};
+
 }
 
 //------------------------------------------------------------------------------
@@ -95,19 +131,18 @@ DialogOpcodes::DialogOpcodes(QWidget *parent) : QDialog(parent), ui(new Ui::Dial
 // Desc:
 //------------------------------------------------------------------------------
 DialogOpcodes::~DialogOpcodes() {
+	if(job_) {
+		job_->cancel();
+	}
 	delete ui;
 }
 
 //------------------------------------------------------------------------------
-// Name: on_listWidget_itemDoubleClicked(QListWidgetItem *item)
+// Name: on_results_doubleClicked(const QModelIndex &index)
 // Desc: follows the found item in the data view
 //------------------------------------------------------------------------------
-void DialogOpcodes::on_listWidget_itemDoubleClicked(QListWidgetItem *item) {
-	bool ok;
-	const yad64::address_t addr = item->data(Qt::UserRole).toULongLong(&ok);
-	if(ok) {
-		yad64::v1::jump_to_address(addr);
-	}
+void DialogOpcodes::on_results_doubleClicked(const QModelIndex &index) {
+	yad64::v1::jump_to_address(ui->results->model()->address(index));
 }
 
 //------------------------------------------------------------------------------
@@ -119,39 +154,48 @@ void DialogOpcodes::showEvent(QShowEvent *) {
 	filter_model_->setSourceModel(&yad64::v1::memory_regions());
 	ui->tableView->setModel(filter_model_);
 	ui->progressBar->setValue(0);
-	ui->listWidget->clear();
+	ui->results->model()->clear();
+}
+
+//------------------------------------------------------------------------------
+// Name: OpcodeJob(const QList<MemoryRegion> &regions, int classtype)
+// Desc:
+//------------------------------------------------------------------------------
+OpcodeJob::OpcodeJob(const QList<MemoryRegion> &regions, int classtype) :
+		regions_(regions),
+		classtype_(classtype),
+		page_size_(yad64::v1::debugger_core->page_size()) {
 }
 
 //------------------------------------------------------------------------------
 // Name: add_result(QList<yad64::Instruction> instructions, yad64::address_t rva)
 // Desc:
 //------------------------------------------------------------------------------
-void DialogOpcodes::add_result(QList<yad64::Instruction> instructions, yad64::address_t rva) {
+void OpcodeJob::add_result(QList<yad64::Instruction> instructions, yad64::address_t rva) {
 	if(!instructions.isEmpty()) {
 		const yad64::Instruction insn1 = instructions.takeFirst();
 
-		QString instruction_string = QString("%1: %2").arg(
-			yad64::v1::format_pointer(rva),
-			QString::fromStdString(edisassm::to_string(insn1)));
+		char buffer[edisassm::FORMAT_BUFFER_SIZE];
+		edisassm::format(insn1, buffer, sizeof(buffer), edisassm::syntax_intel());
 
+		QString instruction_string = QLatin1String(buffer);
 
 		Q_FOREACH(const yad64::Instruction &instruction, instructions) {
-			instruction_string.append(QString("; %1").arg(QString::fromStdString(edisassm::to_string(instruction))));
+			edisassm::format(instruction, buffer, sizeof(buffer), edisassm::syntax_intel());
+			instruction_string.append(QLatin1String("; "));
+			instruction_string.append(QLatin1String(buffer));
 		}
 
-		QListWidgetItem *const item = new QListWidgetItem(instruction_string);
-
-		item->setData(Qt::UserRole, rva);
-		ui->listWidget->addItem(item);
+		found_.append(rva, instruction_string);
 	}
 }
 
 //------------------------------------------------------------------------------
-// Name: test_reg_to_ip(const DialogOpcodes::OpcodeData &data, yad64::address_t start_address)
+// Name: test_reg_to_ip(const OpcodeJob::OpcodeData &data, yad64::address_t start_address)
 // Desc:
 //------------------------------------------------------------------------------
 template <yad64::Operand::Register REG>
-void DialogOpcodes::test_reg_to_ip(const DialogOpcodes::OpcodeData &data, yad64::address_t start_address) {
+void OpcodeJob::test_reg_to_ip(const OpcodeJob::OpcodeData &data, yad64::address_t start_address) {
 
 	const quint8 *p = data.data;
 	const quint8 *last = p + sizeof(data);
@@ -219,7 +263,7 @@ void DialogOpcodes::test_reg_to_ip(const DialogOpcodes::OpcodeData &data, yad64:
 // Name: test_esp_add_0(const OpcodeData &data, yad64::address_t start_address)
 // Desc:
 //------------------------------------------------------------------------------
-void DialogOpcodes::test_esp_add_0(const OpcodeData &data, yad64::address_t start_address) {
+void OpcodeJob::test_esp_add_0(const OpcodeData &data, yad64::address_t start_address) {
 
 	const quint8 *p = data.data;
 	const quint8 *last = p + sizeof(data);
@@ -286,7 +330,7 @@ void DialogOpcodes::test_esp_add_0(const OpcodeData &data, yad64::address_t star
 // Name: test_esp_add_regx1(const OpcodeData &data, yad64::address_t start_address)
 // Desc:
 //------------------------------------------------------------------------------
-void DialogOpcodes::test_esp_add_regx1(const OpcodeData &data, yad64::address_t start_address) {
+void OpcodeJob::test_esp_add_regx1(const OpcodeData &data, yad64::address_t start_address) {
 
 	const quint8 *p = data.data;
 	const quint8 *last = p + sizeof(data);
@@ -371,7 +415,7 @@ void DialogOpcodes::test_esp_add_regx1(const OpcodeData &data, yad64::address_t
 // Name: test_esp_add_regx2(const OpcodeData &data, yad64::address_t start_address)
 // Desc:
 //------------------------------------------------------------------------------
-void DialogOpcodes::test_esp_add_regx2(const OpcodeData &data, yad64::address_t start_address) {
+void OpcodeJob::test_esp_add_regx2(const OpcodeData &data, yad64::address_t start_address) {
 
 
 	const quint8 *p = data.data;
@@ -472,7 +516,7 @@ void DialogOpcodes::test_esp_add_regx2(const OpcodeData &data, yad64::address_t
 // Name: test_esp_sub_regx1(const OpcodeData &data, yad64::address_t start_address)
 // Desc:
 //------------------------------------------------------------------------------
-void DialogOpcodes::test_esp_sub_regx1(const OpcodeData &data, yad64::address_t start_address) {
+void OpcodeJob::test_esp_sub_regx1(const OpcodeData &data, yad64::address_t start_address) {
 
 	const quint8 *p = data.data;
 	const quint8 *last = p + sizeof(data);
@@ -542,35 +586,28 @@ void DialogOpcodes::test_esp_sub_regx1(const OpcodeData &data, yad64::address_t
 }
 
 //------------------------------------------------------------------------------
-// Name: do_find()
-// Desc:
+// Name: run()
+// Desc: reads each region in bulk and tests the opcodes at every address
 //------------------------------------------------------------------------------
-void DialogOpcodes::do_find() {
+void OpcodeJob::run() {
 
-	const int classtype = ui->comboBox->itemData(ui->comboBox->currentIndex()).toInt();
+	Q_FOREACH(const MemoryRegion &region, regions_) {
 
-	const QItemSelectionModel *const selModel = ui->tableView->selectionModel();
-	const QModelIndexList sel = selModel->selectedRows();
+		yad64::address_t start_address     = region.start();
+		const yad64::address_t end_address = region.end();
+		const yad64::address_t orig_start  = start_address;
+		ByteShiftArray bsa(sizeof(OpcodeData));
 
-	if(sel.size() == 0) {
-		QMessageBox::information(
-			this,
-			tr("No Region Selected"),
-			tr("You must select a region which is to be scanned for the desired opcode."));
-	} else {
-
-		Q_FOREACH(const QModelIndex &selected_item, sel) {
-
-			const QModelIndex index = filter_model_->mapToSource(selected_item);
-			const MemoryRegion *const region = reinterpret_cast<const MemoryRegion *>(index.internalPointer());
+		// create a reference to the bsa's data so we can pass it to the testXXXX functions
+		const OpcodeData &opcode = *reinterpret_cast<const OpcodeData *>(bsa.data());
 
-			yad64::address_t start_address     = region->start();
-			const yad64::address_t end_address = region->end();
-			const yad64::address_t orig_start  = start_address;
-			ByteShiftArray bsa(sizeof(OpcodeData));
+		const yad64::address_t size_in_pages = region.size() / page_size_;
+		try {
+			QVector<quint8> pages(size_in_pages * page_size_);
 
-			// create a reference to the bsa's data so we can pass it to the testXXXX functions
-			const OpcodeData &opcode = *reinterpret_cast<const OpcodeData *>(bsa.data());
+			if(!read_pages(region.start(), &pages[0], size_in_pages)) {
+				continue;
+			}
 
 			// do the search for this region!
 			// we intentionally look slightly past the end of the region
@@ -583,11 +620,11 @@ void DialogOpcodes::do_find() {
 				if(start_address >= end_address) {
 					byte = 0x00;
 				} else {
-					yad64::v1::debugger_core->read_bytes(start_address, &byte, 1);
+					byte = pages[start_address - orig_start];
 				}
 				bsa <<  byte;
 
-				switch(classtype) {
+				switch(classtype_) {
 			#if defined(YAD64_X86)
 				case 1: test_reg_to_ip<yad64::Operand::REG_EAX>(opcode, start_address - (sizeof(OpcodeData) - 1)); break;
 				case 2: test_reg_to_ip<yad64::Operand::REG_EBX>(opcode, start_address - (sizeof(OpcodeData) - 1)); break;
@@ -663,22 +700,77 @@ void DialogOpcodes::do_find() {
 					break;
 				}
 
-				ui->progressBar->setValue(util::percentage(start_address - orig_start, region->size()));
+				if(((start_address - orig_start) & 0xfff) == 0) {
+					if(cancelled()) {
+						return;
+					}
+					set_progress(util::percentage(start_address - orig_start, region.size()));
+				}
 				++start_address;
 			}
+		} catch(const std::bad_alloc &) {
+			report_error(
+				DialogOpcodes::tr("Memroy Allocation Error"),
+				DialogOpcodes::tr("Unable to satisfy memory allocation request for requested region."));
 		}
+
+		report_results(found_);
+		found_.clear();
 	}
+
+	set_progress(100);
 }
 
 //------------------------------------------------------------------------------
 // Name: on_btnFind_clicked()
-// Desc:
+// Desc: find button event handler, while a search runs it cancels it instead
 //------------------------------------------------------------------------------
 void DialogOpcodes::on_btnFind_clicked() {
-	ui->btnFind->setEnabled(false);
-	ui->listWidget->clear();
+
+	if(job_) {
+		job_->cancel();
+		return;
+	}
+
+	ui->results->model()->clear();
+
+	const QItemSelectionModel *const selModel = ui->tableView->selectionModel();
+	const QModelIndexList sel = selModel->selectedRows();
+
+	if(sel.size() == 0) {
+		QMessageBox::information(
+			this,
+			tr("No Region Selected"),
+			tr("You must select a region which is to be scanned for the desired opcode."));
+		return;
+	}
+
+	QList<MemoryRegion> regions;
+	Q_FOREACH(const QModelIndex &selected_item, sel) {
+		const QModelIndex index = filter_model_->mapToSource(selected_item);
+		regions.append(*reinterpret_cast<const MemoryRegion *>(index.internalPointer()));
+	}
+
+	const int classtype = ui->comboBox->itemData(ui->comboBox->currentIndex()).toInt();
+	job_ = new OpcodeJob(regions, classtype);
+
+	connect(job_, SIGNAL(progress(int)), ui->progressBar, SLOT(setValue(int)));
+	connect(job_, SIGNAL(results(const ResultStore &)), ui->results->model(), SLOT(append(const ResultStore &)));
+	connect(job_, SIGNAL(finished(bool)), this, SLOT(job_finished(bool)));
+
 	ui->progressBar->setValue(0);
-	do_find();
-	ui->progressBar->setValue(100);
-	ui->btnFind->setEnabled(true);
+	ui->btnFind->setText(tr("&Cancel"));
+	yad64::v1::submit_job(job_);
+}
+
+//------------------------------------------------------------------------------
+// Name: job_finished(bool cancelled)
+// Desc:
+//------------------------------------------------------------------------------
+void DialogOpcodes::job_finished(bool cancelled) {
+	job_ = 0;
+	if(!cancelled) {
+		ui->progressBar->setValue(100);
+	}
+	ui->btnFind->setText(tr("&Find"));
 }
@@ -20,13 +20,13 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define DIALOGOPCODES_20061101_H_
 
 #include "Types.h"
-#include "Instruction.h"
 
 #include <QDialog>
-#include <QList>
+#include <QPointer>
 
+class Job;
 class QSortFilterProxyModel;
-class QListWidgetItem;
+class QModelIndex;
 
 namespace Ui { class DialogOpcodes; }
 
@@ -39,25 +39,10 @@ public:
 
 public Q_SLOTS:
 	void on_btnFind_clicked();
-	void on_listWidget_itemDoubleClicked(QListWidgetItem *);
+	void on_results_doubleClicked(const QModelIndex &index);
 
-private:
-	// we currently only support opcodes sequences up to 8 bytes big
-	union OpcodeData {
-		quint32 dword;
-		quint64 qword;
-		quint8  data[sizeof(quint64)];
-	};
-
-	void test_esp_add_0(const OpcodeData &data, yad64::address_t start_address);
-	void test_esp_add_regx1(const OpcodeData &data, yad64::address_t start_address);
-	void test_esp_add_regx2(const OpcodeData &data, yad64::address_t start_address);
-	void test_esp_sub_regx1(const OpcodeData &data, yad64::address_t start_address);
-	void do_find();
-	void add_result(QList<yad64::Instruction> instructions, yad64::address_t rva);
-
-	template <yad64::Operand::Register REG>
-	void test_reg_to_ip(const OpcodeData &data, yad64::address_t start_address);
+private Q_SLOTS:
+	void job_finished(bool cancelled);
 
 private:
 	virtual void showEvent(QShowEvent *event);
@@ -65,6 +50,7 @@ private:
 private:
 	Ui::DialogOpcodes *const ui;
 	QSortFilterProxyModel *  filter_model_;
+	QPointer<Job>            job_;
 };
 
 #endif
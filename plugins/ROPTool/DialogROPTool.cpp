@@ -17,53 +17,158 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "DialogROPTool.h"
+#include "GadgetFinder.h"
+#include "GadgetIndex.h"
 #include "IDebuggerCore.h"
 #include "Debugger.h"
+#include "Job.h"
+#include "MemoryRegion.h"
 #include "MemoryRegions.h"
-#include "ByteShiftArray.h"
+#include "ResultsModel.h"
+#include "ResultsView.h"
 #include "Util.h"
 
-#include <QDebug>
 #include <QHeaderView>
 #include <QMessageBox>
+#include <QSet>
 #include <QSortFilterProxyModel>
-#include <QStandardItemModel>
 #include <QModelIndex>
 
 #include "ui_dialogrop.h"
 
 namespace {
-	bool is_nop(const yad64::Instruction &insn) {
-		if(insn.valid()) {
-			if(insn.type() == yad64::Instruction::OP_NOP) {
-				return true;
+
+// regions are split into chunks of this many bytes, smaller than usual since
+// looking for gadgets is slow
+const std::size_t gadget_chunk_size = 0x10000;
+
+bool region_start_less_than(const MemoryRegion &a, const MemoryRegion &b) {
+	return a.start() < b.start();
+}
+
+// searches one chunk of a region for gadgets, for Job::map_chunks
+class FindGadgets {
+public:
+	typedef rop::GadgetList result_type;
+
+public:
+	explicit FindGadgets(int depth) : depth_(depth) {
+	}
+
+public:
+	rop::GadgetList operator()(const Job::Chunk &chunk) const {
+		rop::GadgetChunk gadget_chunk;
+		gadget_chunk.bytes = chunk.bytes;
+		gadget_chunk.base  = chunk.base;
+		gadget_chunk.first = static_cast<int>(chunk.first);
+		gadget_chunk.last  = static_cast<int>(chunk.last);
+		gadget_chunk.depth = depth_;
+		return rop::find_gadgets(gadget_chunk);
+	}
+
+private:
+	int depth_;
+};
+
+class GadgetJob : public Job {
+public:
+	GadgetJob(const QList<MemoryRegion> &regions, int depth, bool unique);
+
+public:
+	virtual void run();
+
+private:
+	void add_gadgets(const rop::GadgetList &gadgets, ResultStore &found);
+
+private:
+	QList<MemoryRegion>    regions_;
+	const int              depth_;
+	const bool             unique_;
+	const yad64::address_t page_size_;
+	QSet<QString>          seen_;
+};
+
+//------------------------------------------------------------------------------
+// Name: GadgetJob(const QList<MemoryRegion> &regions, int depth, bool unique)
+// Desc: regions are visited by address, so with unique set the gadget which
+//       is kept for a given text is always the one with the lowest address
+//------------------------------------------------------------------------------
+GadgetJob::GadgetJob(const QList<MemoryRegion> &regions, int depth, bool unique) :
+		regions_(regions),
+		depth_(depth),
+		unique_(unique),
+		page_size_(yad64::v1::debugger_core->page_size()) {
+
+	qSort(regions_.begin(), regions_.end(), region_start_less_than);
+}
+
+//------------------------------------------------------------------------------
+// Name: add_gadgets(const rop::GadgetList &gadgets, ResultStore &found)
+// Desc:
+//------------------------------------------------------------------------------
+void GadgetJob::add_gadgets(const rop::GadgetList &gadgets, ResultStore &found) {
+	Q_FOREACH(const rop::Gadget &gadget, gadgets) {
+		if(!unique_ || !seen_.contains(gadget.text)) {
+			seen_.insert(gadget.text);
+			found.append(gadget.address, gadget.text, gadget.role);
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: run()
+// Desc: reads one region at a time in bulk. Modules which were searched
+//       before are loaded from their index as long as the bytes are still the
+//       same, the rest are searched on all threads and indexed
+//------------------------------------------------------------------------------
+void GadgetJob::run() {
+
+	int i = 0;
+	Q_FOREACH(const MemoryRegion &region, regions_) {
+
+		if(cancelled()) {
+			return;
+		}
+
+		set_progress(util::percentage(i++, regions_.size()));
+
+		const QVector<quint8> pages = read_buffer(region.start(), region.size() / page_size_, page_size_);
+		if(pages.isEmpty()) {
+			continue;
+		}
+
+		const QString    index_file = rop::index_filename(region);
+		const QByteArray md5        = index_file.isEmpty() ? QByteArray() : yad64::v1::get_md5(pages.constData(), pages.size());
+
+		rop::GadgetList gadgets;
+		if(index_file.isEmpty() || !rop::load_index(index_file, region, md5, depth_, gadgets)) {
+
+			QList<Chunk> chunks;
+			split_chunks(pages, region.start(), 0, pages.size(), 0, chunks, gadget_chunk_size);
+
+			Q_FOREACH(const rop::GadgetList &chunk_gadgets, map_chunks(chunks, FindGadgets(depth_))) {
+				gadgets.append(chunk_gadgets);
 			}
-			
-			// TODO: does this effect flags?
-			if(insn.type() == yad64::Instruction::OP_MOV && insn.operand_count() == 2) {
-				if(insn.operand(0).general_type() == yad64::Operand::TYPE_REGISTER && insn.operand(1).general_type() == yad64::Operand::TYPE_REGISTER) {
-					if(insn.operand(0).reg() == insn.operand(1).reg()) {
-						return true;
-					}
-				}
-			
+
+			if(cancelled()) {
+				return;
 			}
-			
-			// TODO: does this effect flags?
-			if(insn.type() == yad64::Instruction::OP_XCHG && insn.operand_count() == 2) {
-				if(insn.operand(0).general_type() == yad64::Operand::TYPE_REGISTER && insn.operand(1).general_type() == yad64::Operand::TYPE_REGISTER) {
-					if(insn.operand(0).reg() == insn.operand(1).reg()) {
-						return true;
-					}
-				}
-			
+
+			qSort(gadgets.begin(), gadgets.end(), rop::gadget_address_less_than);
+
+			if(!index_file.isEmpty()) {
+				rop::save_index(index_file, region, md5, depth_, gadgets);
 			}
-			
-			// TODO: support LEA reg, [reg]
-			
 		}
-		return false;
+
+		ResultStore found;
+		add_gadgets(gadgets, found);
+		report_results(found);
 	}
+
+	set_progress(100);
+}
+
 }
 
 //------------------------------------------------------------------------------
@@ -77,12 +182,6 @@ DialogROPTool::DialogROPTool(QWidget *parent) : QDialog(parent), ui(new Ui::Dial
 
 	filter_model_ = new QSortFilterProxyModel(this);
 	connect(ui->txtSearch, SIGNAL(textChanged(const QString &)), filter_model_, SLOT(setFilterFixedString(const QString &)));
-
-
-	result_model_ = new QStandardItemModel(this);
-	result_filter_ = new ResultFilterProxy(this);
-	result_filter_->setSourceModel(result_model_);
-	ui->listView->setModel(result_filter_);
 }
 
 //------------------------------------------------------------------------------
@@ -90,19 +189,18 @@ DialogROPTool::DialogROPTool(QWidget *parent) : QDialog(parent), ui(new Ui::Dial
 // Desc:
 //------------------------------------------------------------------------------
 DialogROPTool::~DialogROPTool() {
+	if(job_) {
+		job_->cancel();
+	}
 	delete ui;
 }
 
 //------------------------------------------------------------------------------
-// Name: on_listView_itemDoubleClicked(QListViewItem *item)
+// Name: on_results_doubleClicked(const QModelIndex &index)
 // Desc: follows the found item in the data view
 //------------------------------------------------------------------------------
-void DialogROPTool::on_listView_doubleClicked(const QModelIndex &index) {
-	bool ok;
-	const yad64::address_t addr = index.data(Qt::UserRole).toULongLong(&ok);
-	if(ok) {
-		yad64::v1::jump_to_address(addr);
-	}
+void DialogROPTool::on_results_doubleClicked(const QModelIndex &index) {
+	yad64::v1::jump_to_address(ui->results->model()->address(index));
 }
 
 //------------------------------------------------------------------------------
@@ -115,311 +213,117 @@ void DialogROPTool::showEvent(QShowEvent *) {
 	ui->tableView->setModel(filter_model_);
 	ui->progressBar->setValue(0);
 
-	result_filter_->set_mask_bit(0x01, ui->chkShowALU->isChecked());
-	result_filter_->set_mask_bit(0x02, ui->chkShowStack->isChecked());
-	result_filter_->set_mask_bit(0x04, ui->chkShowLogic->isChecked());
-	result_filter_->set_mask_bit(0x08, ui->chkShowData->isChecked());
-	result_filter_->set_mask_bit(0x10, ui->chkShowOther->isChecked());
+	update_role_mask();
 
-	result_model_->clear();
+	ui->results->model()->clear();
 }
 
 //------------------------------------------------------------------------------
-// Name: on_chkShowALU_stateChanged(int state)
-// Desc:
+// Name: update_role_mask()
+// Desc: only shows the gadgets whose roles are checked
 //------------------------------------------------------------------------------
-void DialogROPTool::on_chkShowALU_stateChanged(int state) {
-	result_filter_->set_mask_bit(0x01, state);
+void DialogROPTool::update_role_mask() {
+	quint32 mask = 0;
+	if(ui->chkShowALU->isChecked())   mask |= rop::ROLE_ALU;
+	if(ui->chkShowStack->isChecked()) mask |= rop::ROLE_STACK;
+	if(ui->chkShowLogic->isChecked()) mask |= rop::ROLE_LOGIC;
+	if(ui->chkShowData->isChecked())  mask |= rop::ROLE_DATA;
+	if(ui->chkShowOther->isChecked()) mask |= rop::ROLE_OTHER;
+
+	ui->results->model()->set_flag_mask(mask);
 }
 
 //------------------------------------------------------------------------------
-// Name: on_chkShowStack_stateChanged(int state)
+// Name: on_chkShowALU_stateChanged(int)
 // Desc:
 //------------------------------------------------------------------------------
-void DialogROPTool::on_chkShowStack_stateChanged(int state) {
-	result_filter_->set_mask_bit(0x02, state);
+void DialogROPTool::on_chkShowALU_stateChanged(int) {
+	update_role_mask();
 }
 
 //------------------------------------------------------------------------------
-// Name: on_chkShowLogic_stateChanged(int state)
+// Name: on_chkShowStack_stateChanged(int)
 // Desc:
 //------------------------------------------------------------------------------
-void DialogROPTool::on_chkShowLogic_stateChanged(int state) {
-	result_filter_->set_mask_bit(0x04, state);
+void DialogROPTool::on_chkShowStack_stateChanged(int) {
+	update_role_mask();
 }
 
 //------------------------------------------------------------------------------
-// Name: on_chkShowData_stateChanged(int state)
+// Name: on_chkShowLogic_stateChanged(int)
 // Desc:
 //------------------------------------------------------------------------------
-void DialogROPTool::on_chkShowData_stateChanged(int state) {
-	result_filter_->set_mask_bit(0x08, state);
+void DialogROPTool::on_chkShowLogic_stateChanged(int) {
+	update_role_mask();
 }
 
 //------------------------------------------------------------------------------
-// Name: on_chkShowOther_stateChanged(int state)
+// Name: on_chkShowData_stateChanged(int)
 // Desc:
 //------------------------------------------------------------------------------
-void DialogROPTool::on_chkShowOther_stateChanged(int state) {
-	result_filter_->set_mask_bit(0x10, state);
+void DialogROPTool::on_chkShowData_stateChanged(int) {
+	update_role_mask();
 }
 
 //------------------------------------------------------------------------------
-// Name: set_gadget_role(QStandardItem *item, const yad64::Instruction &insn1)
+// Name: on_chkShowOther_stateChanged(int)
 // Desc:
 //------------------------------------------------------------------------------
-void DialogROPTool::set_gadget_role(QStandardItem *item, const yad64::Instruction &insn1) {
-
-	switch(insn1.type()) {
-	case yad64::Instruction::OP_ADD:
-	case yad64::Instruction::OP_ADC:
-	case yad64::Instruction::OP_SUB:
-	case yad64::Instruction::OP_SBB:
-	case yad64::Instruction::OP_IMUL:
-	case yad64::Instruction::OP_MUL:
-	case yad64::Instruction::OP_IDIV:
-	case yad64::Instruction::OP_DIV:
-	case yad64::Instruction::OP_INC:
-	case yad64::Instruction::OP_DEC:
-	case yad64::Instruction::OP_NEG:
-	case yad64::Instruction::OP_CMP:
-	case yad64::Instruction::OP_DAA:
-	case yad64::Instruction::OP_DAS:
-	case yad64::Instruction::OP_AAA:
-	case yad64::Instruction::OP_AAS:
-	case yad64::Instruction::OP_AAM:
-	case yad64::Instruction::OP_AAD:
-		// ALU ops
-		item->setData(0x01, Qt::UserRole + 1);
-		break;
-	case yad64::Instruction::OP_PUSH:
-	case yad64::Instruction::OP_PUSHA:
-	case yad64::Instruction::OP_POP:
-	case yad64::Instruction::OP_POPA:
-		// stack ops
-		item->setData(0x02, Qt::UserRole + 1);
-		break;
-	case yad64::Instruction::OP_AND:
-	case yad64::Instruction::OP_OR:
-	case yad64::Instruction::OP_XOR:
-	case yad64::Instruction::OP_NOT:
-	case yad64::Instruction::OP_SAR:
-	case yad64::Instruction::OP_SAL:
-	case yad64::Instruction::OP_SHR:
-	case yad64::Instruction::OP_SHL:
-	case yad64::Instruction::OP_SHRD:
-	case yad64::Instruction::OP_SHLD:
-	case yad64::Instruction::OP_ROR:
-	case yad64::Instruction::OP_ROL:
-	case yad64::Instruction::OP_RCR:
-	case yad64::Instruction::OP_RCL:
-	case yad64::Instruction::OP_BT:
-	case yad64::Instruction::OP_BTS:
-	case yad64::Instruction::OP_BTR:
-	case yad64::Instruction::OP_BTC:
-	case yad64::Instruction::OP_BSF:
-	case yad64::Instruction::OP_BSR:
-		// logic ops
-		item->setData(0x04, Qt::UserRole + 1);
-		break;
-	case yad64::Instruction::OP_MOV:
-	case yad64::Instruction::OP_CMOVCC:
-	case yad64::Instruction::OP_XCHG:
-	case yad64::Instruction::OP_BSWAP:
-	case yad64::Instruction::OP_XADD:
-	case yad64::Instruction::OP_CMPXCHG:
-	case yad64::Instruction::OP_CWD:
-	case yad64::Instruction::OP_CDQ:
-	case yad64::Instruction::OP_CQO:
-	case yad64::Instruction::OP_CDQE:
-	case yad64::Instruction::OP_CBW:
-	case yad64::Instruction::OP_CWDE:
-	case yad64::Instruction::OP_MOVSX:
-	case yad64::Instruction::OP_MOVZX:
-	case yad64::Instruction::OP_MOVSXD:
-	case yad64::Instruction::OP_MOVBE:
-	case yad64::Instruction::OP_MOVS:
-	case yad64::Instruction::OP_CMPS:
-	case yad64::Instruction::OP_CMPSW:
-	case yad64::Instruction::OP_SCAS:
-	case yad64::Instruction::OP_LODS:
-	case yad64::Instruction::OP_STOS:
-	case yad64::Instruction::OP_CMPXCHG8B:
-	case yad64::Instruction::OP_CMPXCHG16B:
-		// data ops
-		item->setData(0x08, Qt::UserRole + 1);
-		break;
-	default:
-		// other ops
-		item->setData(0x10, Qt::UserRole + 1);
-		break;
-
-	}
+void DialogROPTool::on_chkShowOther_stateChanged(int) {
+	update_role_mask();
 }
 
 //------------------------------------------------------------------------------
-// Name: add_gadget(QList<yad64::Instruction> instructions)
-// Desc:
+// Name: on_btnFind_clicked()
+// Desc: while a search runs the button cancels it instead
 //------------------------------------------------------------------------------
-void DialogROPTool::add_gadget(QList<yad64::Instruction> instructions) {
-
-	if(!instructions.isEmpty()) {
-		const yad64::Instruction insn1 = instructions.takeFirst();
-
-		QString instruction_string = QString("%1").arg(QString::fromStdString(edisassm::to_string(insn1)));
-		Q_FOREACH(const yad64::Instruction &instruction, instructions) {
-			instruction_string.append(QString("; %1").arg(QString::fromStdString(edisassm::to_string(instruction))));
-		}
-
-		if(!ui->checkUnique->isChecked() || !unique_results_.contains(instruction_string)) {
-			unique_results_.insert(instruction_string);
-
-			// found a gadget
-			QStandardItem *const item = new QStandardItem(
-				QString("%1: %2").arg(yad64::v1::format_pointer(insn1.rva()), instruction_string));
-
-			item->setData(static_cast<qulonglong>(insn1.rva()), Qt::UserRole);
-			
-			// TODO: make this look for 1st non-NOP
-			set_gadget_role(item, insn1);
+void DialogROPTool::on_btnFind_clicked() {
 
-			result_model_->insertRow(result_model_->rowCount(), item);
-		}
+	if(job_) {
+		job_->cancel();
+		return;
 	}
-}
 
-//------------------------------------------------------------------------------
-// Name: do_find()
-// Desc:
-//------------------------------------------------------------------------------
-void DialogROPTool::do_find() {
+	ui->results->model()->clear();
 
-	const QItemSelectionModel *const selModel = ui->tableView->selectionModel();
-	const QModelIndexList sel = selModel->selectedRows();
+	const QItemSelectionModel *const selection_model = ui->tableView->selectionModel();
+	const QModelIndexList sel = selection_model->selectedRows();
 
 	if(sel.size() == 0) {
 		QMessageBox::information(
 			this,
 			tr("No Region Selected"),
 			tr("You must select a region which is to be scanned for gadgets."));
-	} else {
-
-		unique_results_.clear();
-
-		Q_FOREACH(const QModelIndex &selected_item, sel) {
-
-			const QModelIndex index = filter_model_->mapToSource(selected_item);
-			const MemoryRegion *const region = reinterpret_cast<const MemoryRegion *>(index.internalPointer());
-
-			yad64::address_t start_address     = region->start();
-			const yad64::address_t end_address = region->end();
-			const yad64::address_t orig_start  = start_address;
-
-			ByteShiftArray bsa(32);
-
-			while(start_address < end_address) {
-				
-				// read in the next byte
-				quint8 byte;
-				if(yad64::v1::debugger_core->read_bytes(start_address, &byte, 1)) {
-					bsa << byte;
-
-					const quint8       *p = bsa.data();
-					const quint8 *const l = p + bsa.size();
-					yad64::address_t    rva = start_address - bsa.size() + 1;
-																			
-					QList<yad64::Instruction> instruction_list;
-					
-					// eat up any NOPs in front...
-					Q_FOREVER {
-						yad64::Instruction insn(p, l, rva, std::nothrow);
-						if(!is_nop(insn)) {
-							break;
-						}
-
-						instruction_list << insn;
-						p += insn.size();
-						rva += insn.size();
-					}
-					
-					
-					yad64::Instruction insn1(p, l, rva, std::nothrow);
-					if(insn1.valid()) {
-						instruction_list << insn1;
-					
-						if(insn1.type() == yad64::Instruction::OP_INT && insn1.operand(0).general_type() == yad64::Operand::TYPE_IMMEDIATE && (insn1.operand(0).immediate() & 0xff) == 0x80) {
-							add_gadget(instruction_list);
-						} else if(insn1.type() == yad64::Instruction::OP_SYSENTER) {
-							add_gadget(instruction_list);
-						} else if(insn1.type() == yad64::Instruction::OP_SYSCALL) {
-							add_gadget(instruction_list);
-						} else if(insn1.type() == yad64::Instruction::OP_RET) {
-							ui->progressBar->setValue(util::percentage(start_address - orig_start, region->size()));
-							++start_address;
-							continue;
-						} else {
-						
-							p += insn1.size();
-							rva += insn1.size();
-							
-							// eat up any NOPs in between...
-							Q_FOREVER {
-								yad64::Instruction insn(p, l, rva, std::nothrow);
-								if(!is_nop(insn)) {
-									break;
-								}
-
-								instruction_list << insn;
-								p += insn.size();
-								rva += insn.size();
-							}
-							
-							yad64::Instruction insn2(p, l, rva, std::nothrow);
-							if(insn2.valid() && insn2.type() == yad64::Instruction::OP_RET) {
-								instruction_list << insn2;
-								add_gadget(instruction_list);
-							} else if(insn2.valid() && insn2.type() == yad64::Instruction::OP_POP) {
-								instruction_list << insn2;
-								p += insn2.size();
-								rva += insn2.size();
-								
-								yad64::Instruction insn3(p, l, rva, std::nothrow);
-								if(insn3.valid() && insn3.type() == yad64::Instruction::OP_JMP) {
-								
-									instruction_list << insn3;
-
-									if(insn2.operand_count() == 1 && insn2.operand(0).general_type() == yad64::Operand::TYPE_REGISTER) {
-										if(insn3.operand_count() == 1 && insn3.operand(0).general_type() == yad64::Operand::TYPE_REGISTER) {
-											if(insn2.operand(0).reg() == insn3.operand(0).reg()) {
-												add_gadget(instruction_list);
-											}
-										}
-									}
-								}
-							}
-						}
-
-						// TODO: catch things like "add rsp, 8; jmp [rsp - 8]" and similar, it's rare,
-						// but could happen
-					}
-				}
-
-				ui->progressBar->setValue(util::percentage(start_address - orig_start, region->size()));
-				++start_address;
-			}
+		return;
+	}
+
+	QList<MemoryRegion> regions;
+	Q_FOREACH(const QModelIndex &selected_item, sel) {
+		const QModelIndex index = filter_model_->mapToSource(selected_item);
+		if(const MemoryRegion *const region = reinterpret_cast<const MemoryRegion *>(index.internalPointer())) {
+			regions.append(*region);
 		}
 	}
+
+	job_ = new GadgetJob(regions, ui->spinDepth->value(), ui->checkUnique->isChecked());
+
+	connect(job_, SIGNAL(progress(int)), ui->progressBar, SLOT(setValue(int)));
+	connect(job_, SIGNAL(results(const ResultStore &)), ui->results->model(), SLOT(append(const ResultStore &)));
+	connect(job_, SIGNAL(finished(bool)), this, SLOT(job_finished(bool)));
+
+	ui->progressBar->setValue(0);
+	ui->btnFind->setText(tr("&Cancel"));
+	yad64::v1::submit_job(job_);
 }
 
 //------------------------------------------------------------------------------
-// Name: on_btnFind_clicked()
+// Name: job_finished(bool cancelled)
 // Desc:
 //------------------------------------------------------------------------------
-void DialogROPTool::on_btnFind_clicked() {
-	ui->btnFind->setEnabled(false);
-	ui->progressBar->setValue(0);
-	result_model_->clear();
-	do_find();
-	ui->progressBar->setValue(100);
-	ui->btnFind->setEnabled(true);
+void DialogROPTool::job_finished(bool cancelled) {
+	job_ = 0;
+	if(!cancelled) {
+		ui->progressBar->setValue(100);
+	}
+	ui->btnFind->setText(tr("&Find"));
 }
@@ -20,51 +20,16 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define DIALOG_ROPTOOL_20100817_H_
 
 #include "Types.h"
-#include "Instruction.h"
 
 #include <QDialog>
-#include <QSet>
-#include <QList>
-#include <QSortFilterProxyModel>
+#include <QPointer>
 
-class QListWidgetItem;
+class Job;
 class QModelIndex;
 class QSortFilterProxyModel;
-class QStandardItem;
-class QStandardItemModel;
-
-class ResultFilterProxy;
 
 namespace Ui { class DialogROPTool; }
 
-class ResultFilterProxy : public QSortFilterProxyModel {
-public:
-	ResultFilterProxy(QObject *parent = 0) : QSortFilterProxyModel(parent), mask_(0) {
-	}
-
-public:
-	void set_mask_bit(quint32 mask, bool value) {
-		if(value) {
-			mask_ |= mask;
-		} else {
-			mask_ &= ~mask;
-		}
-		reset();
-	}
-
-protected:
-	bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const {
-		QModelIndex index = sourceModel()->index(sourceRow, 0, sourceParent);
-		if(index.data(Qt::UserRole + 1).toUInt() & mask_) {
-			return true;
-		}
-		return false;
-	}
-
-private:
-	quint32 mask_;
-};
-
 class DialogROPTool : public QDialog {
 	Q_OBJECT
 
@@ -74,17 +39,18 @@ public:
 
 public Q_SLOTS:
 	void on_btnFind_clicked();
-	void on_listView_doubleClicked(const QModelIndex &index);
+	void on_results_doubleClicked(const QModelIndex &index);
 	void on_chkShowALU_stateChanged(int state);
 	void on_chkShowStack_stateChanged(int state);
 	void on_chkShowLogic_stateChanged(int state);
 	void on_chkShowData_stateChanged(int state);
 	void on_chkShowOther_stateChanged(int state);
 
+private Q_SLOTS:
+	void job_finished(bool cancelled);
+
 private:
-	void do_find();
-	void add_gadget(QList<yad64::Instruction> instructions);
-	void set_gadget_role(QStandardItem *item, const yad64::Instruction &insn1);
+	void update_role_mask();
 
 private:
 	virtual void showEvent(QShowEvent *event);
@@ -92,9 +58,7 @@ private:
 private:
 	Ui::DialogROPTool *const ui;
 	QSortFilterProxyModel *  filter_model_;
-	QStandardItemModel *     result_model_;
-	ResultFilterProxy *      result_filter_;
-	QSet<QString>            unique_results_;
+	QPointer<Job>            job_;
 };
 
 #endif
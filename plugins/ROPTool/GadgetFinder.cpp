@@ -0,0 +1,335 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "GadgetFinder.h"
+
+#include <QtAlgorithms>
+
+namespace rop {
+namespace {
+
+// the search is interested in near returns, system calls and indirect jumps
+// through a register. a quick look at the opcode byte (and the byte following
+// it) rules out almost every offset before any decoding is done
+bool maybe_terminator(const quint8 *p, const quint8 *last) {
+	switch(p[0]) {
+	case 0xc2:
+	case 0xc3:
+		return true;
+	case 0x0f:
+		return p + 1 != last && (p[1] == 0x05 || p[1] == 0x34);
+	case 0xcd:
+		return p + 1 != last && p[1] == 0x80;
+	case 0xff:
+		return p + 1 != last && (p[1] & 0xf8) == 0xe0;
+	default:
+		return false;
+	}
+}
+
+class GadgetWalker {
+public:
+	GadgetWalker(const GadgetChunk &chunk, GadgetList &results) : chunk_(chunk), results_(results), data_(chunk.bytes.constData()) {
+	}
+
+public:
+	//------------------------------------------------------------------------------
+	// Name: walk(int end, int depth)
+	// Desc: every instruction which ends exactly at end (and does not change
+	//       the flow of control) extends the current gadget by one
+	//------------------------------------------------------------------------------
+	void walk(int end, int depth) {
+
+		const int lowest = qMax(0, end - static_cast<int>(yad64::Instruction::MAX_SIZE));
+
+		for(int start = end - 1; start >= lowest; --start) {
+
+			yad64::InstructionLength info;
+			if(!edisassm::decode_length(data_ + start, end - start, chunk_.base + start, info)) {
+				continue;
+			}
+
+			if(info.size != static_cast<unsigned int>(end - start) || info.flow != edisassm::FLOW_NONE) {
+				continue;
+			}
+
+			const yad64::Instruction insn(data_ + start, end - start, chunk_.base + start, std::nothrow);
+			if(!insn.valid() || is_terminator(insn)) {
+				continue;
+			}
+
+			instructions_.prepend(insn);
+			emit_gadget();
+
+			if(depth > 1) {
+				walk(start, depth - 1);
+			}
+
+			instructions_.removeFirst();
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	// Name: run()
+	//------------------------------------------------------------------------------
+	void run() {
+		const quint8 *const last = data_ + chunk_.bytes.size();
+
+		for(int i = chunk_.first; i < chunk_.last; ++i) {
+			if(!maybe_terminator(data_ + i, last)) {
+				continue;
+			}
+
+			const yad64::Instruction terminator(data_ + i, last - (data_ + i), chunk_.base + i, std::nothrow);
+			if(!terminator.valid() || !is_terminator(terminator)) {
+				continue;
+			}
+
+			const int end = i + terminator.size();
+			add_terminator(terminator, i);
+
+			// the same terminator may carry prefixes (rep ret, or a REX prefix
+			// selecting r8-r15 for an indirect jmp), those make for different
+			// gadgets so they are walked as well
+			for(int start = i - 1; start >= qMax(0, i - 4); --start) {
+				const yad64::Instruction insn(data_ + start, end - start, chunk_.base + start, std::nothrow);
+				if(insn.valid() && insn.size() == static_cast<unsigned int>(end - start) && is_terminator(insn)) {
+					add_terminator(insn, start);
+				}
+			}
+		}
+
+		qSort(results_.begin(), results_.end(), gadget_address_less_than);
+	}
+
+private:
+	//------------------------------------------------------------------------------
+	// Name: add_terminator(const yad64::Instruction &terminator, int start)
+	//------------------------------------------------------------------------------
+	void add_terminator(const yad64::Instruction &terminator, int start) {
+		instructions_.clear();
+		instructions_.append(terminator);
+
+		// a lone system call is useful by itself, a lone ret or jmp is not
+		if(terminator.type() != yad64::Instruction::OP_RET && terminator.type() != yad64::Instruction::OP_JMP) {
+			emit_gadget();
+		}
+
+		if(chunk_.depth > 0) {
+			walk(start, chunk_.depth);
+		}
+	}
+
+	//------------------------------------------------------------------------------
+	// Name: emit_gadget()
+	//------------------------------------------------------------------------------
+	void emit_gadget() {
+
+		char buffer[edisassm::FORMAT_BUFFER_SIZE];
+
+		Gadget gadget;
+		gadget.address = instructions_.first().rva();
+		gadget.role    = ROLE_OTHER;
+		gadget.depth   = instructions_.size() - 1;
+
+		bool found_role = false;
+		Q_FOREACH(const yad64::Instruction &insn, instructions_) {
+			if(!gadget.text.isEmpty()) {
+				gadget.text.append(QLatin1String("; "));
+			}
+
+			edisassm::format(insn, buffer, sizeof(buffer), edisassm::syntax_intel());
+			gadget.text.append(QLatin1String(buffer));
+
+			// the gadget is categorized by what its first real instruction does
+			if(!found_role && !is_nop(insn)) {
+				gadget.role = gadget_role(insn);
+				found_role  = true;
+			}
+		}
+
+		results_.append(gadget);
+	}
+
+private:
+	const GadgetChunk &       chunk_;
+	GadgetList &              results_;
+	const quint8 *const       data_;
+	QList<yad64::Instruction> instructions_;
+};
+
+}
+
+//------------------------------------------------------------------------------
+// Name: gadget_address_less_than(const Gadget &a, const Gadget &b)
+// Desc:
+//------------------------------------------------------------------------------
+bool gadget_address_less_than(const Gadget &a, const Gadget &b) {
+	return a.address < b.address;
+}
+
+//------------------------------------------------------------------------------
+// Name: is_nop(const yad64::Instruction &insn)
+// Desc:
+//------------------------------------------------------------------------------
+bool is_nop(const yad64::Instruction &insn) {
+	if(insn.valid()) {
+		if(insn.type() == yad64::Instruction::OP_NOP) {
+			return true;
+		}
+		
+		// TODO: does this effect flags?
+		if(insn.type() == yad64::Instruction::OP_MOV && insn.operand_count() == 2) {
+			if(insn.operand(0).general_type() == yad64::Operand::TYPE_REGISTER && insn.operand(1).general_type() == yad64::Operand::TYPE_REGISTER) {
+				if(insn.operand(0).reg() == insn.operand(1).reg()) {
+					return true;
+				}
+			}
+		
+		}
+		
+		// TODO: does this effect flags?
+		if(insn.type() == yad64::Instruction::OP_XCHG && insn.operand_count() == 2) {
+			if(insn.operand(0).general_type() == yad64::Operand::TYPE_REGISTER && insn.operand(1).general_type() == yad64::Operand::TYPE_REGISTER) {
+				if(insn.operand(0).reg() == insn.operand(1).reg()) {
+					return true;
+				}
+			}
+		
+		}
+		
+		// TODO: support LEA reg, [reg]
+		
+	}
+	return false;
+}
+
+//------------------------------------------------------------------------------
+// Name: is_terminator(const yad64::Instruction &insn)
+// Desc: returns true if insn can end a gadget
+//------------------------------------------------------------------------------
+bool is_terminator(const yad64::Instruction &insn) {
+	switch(insn.type()) {
+	case yad64::Instruction::OP_RET:
+	case yad64::Instruction::OP_SYSCALL:
+	case yad64::Instruction::OP_SYSENTER:
+		return true;
+	case yad64::Instruction::OP_INT:
+		return insn.operand(0).general_type() == yad64::Operand::TYPE_IMMEDIATE && (insn.operand(0).immediate() & 0xff) == 0x80;
+	case yad64::Instruction::OP_JMP:
+		return insn.operand_count() == 1 && insn.operand(0).general_type() == yad64::Operand::TYPE_REGISTER;
+	default:
+		return false;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: gadget_role(const yad64::Instruction &insn)
+// Desc:
+//------------------------------------------------------------------------------
+quint32 gadget_role(const yad64::Instruction &insn) {
+
+	switch(insn.type()) {
+	case yad64::Instruction::OP_ADD:
+	case yad64::Instruction::OP_ADC:
+	case yad64::Instruction::OP_SUB:
+	case yad64::Instruction::OP_SBB:
+	case yad64::Instruction::OP_IMUL:
+	case yad64::Instruction::OP_MUL:
+	case yad64::Instruction::OP_IDIV:
+	case yad64::Instruction::OP_DIV:
+	case yad64::Instruction::OP_INC:
+	case yad64::Instruction::OP_DEC:
+	case yad64::Instruction::OP_NEG:
+	case yad64::Instruction::OP_CMP:
+	case yad64::Instruction::OP_DAA:
+	case yad64::Instruction::OP_DAS:
+	case yad64::Instruction::OP_AAA:
+	case yad64::Instruction::OP_AAS:
+	case yad64::Instruction::OP_AAM:
+	case yad64::Instruction::OP_AAD:
+		return ROLE_ALU;
+	case yad64::Instruction::OP_PUSH:
+	case yad64::Instruction::OP_PUSHA:
+	case yad64::Instruction::OP_POP:
+	case yad64::Instruction::OP_POPA:
+		return ROLE_STACK;
+	case yad64::Instruction::OP_AND:
+	case yad64::Instruction::OP_OR:
+	case yad64::Instruction::OP_XOR:
+	case yad64::Instruction::OP_NOT:
+	case yad64::Instruction::OP_SAR:
+	case yad64::Instruction::OP_SAL:
+	case yad64::Instruction::OP_SHR:
+	case yad64::Instruction::OP_SHL:
+	case yad64::Instruction::OP_SHRD:
+	case yad64::Instruction::OP_SHLD:
+	case yad64::Instruction::OP_ROR:
+	case yad64::Instruction::OP_ROL:
+	case yad64::Instruction::OP_RCR:
+	case yad64::Instruction::OP_RCL:
+	case yad64::Instruction::OP_BT:
+	case yad64::Instruction::OP_BTS:
+	case yad64::Instruction::OP_BTR:
+	case yad64::Instruction::OP_BTC:
+	case yad64::Instruction::OP_BSF:
+	case yad64::Instruction::OP_BSR:
+		return ROLE_LOGIC;
+	case yad64::Instruction::OP_MOV:
+	case yad64::Instruction::OP_CMOVCC:
+	case yad64::Instruction::OP_XCHG:
+	case yad64::Instruction::OP_BSWAP:
+	case yad64::Instruction::OP_XADD:
+	case yad64::Instruction::OP_CMPXCHG:
+	case yad64::Instruction::OP_CWD:
+	case yad64::Instruction::OP_CDQ:
+	case yad64::Instruction::OP_CQO:
+	case yad64::Instruction::OP_CDQE:
+	case yad64::Instruction::OP_CBW:
+	case yad64::Instruction::OP_CWDE:
+	case yad64::Instruction::OP_MOVSX:
+	case yad64::Instruction::OP_MOVZX:
+	case yad64::Instruction::OP_MOVSXD:
+	case yad64::Instruction::OP_MOVBE:
+	case yad64::Instruction::OP_MOVS:
+	case yad64::Instruction::OP_CMPS:
+	case yad64::Instruction::OP_CMPSW:
+	case yad64::Instruction::OP_SCAS:
+	case yad64::Instruction::OP_LODS:
+	case yad64::Instruction::OP_STOS:
+	case yad64::Instruction::OP_CMPXCHG8B:
+	case yad64::Instruction::OP_CMPXCHG16B:
+		return ROLE_DATA;
+	default:
+		return ROLE_OTHER;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: find_gadgets(const GadgetChunk &chunk)
+// Desc: locates every terminator in the chunk and walks backwards from each
+//       one, collecting all instruction sequences of up to chunk.depth
+//       instructions which run into it. results are sorted by address
+//------------------------------------------------------------------------------
+GadgetList find_gadgets(const GadgetChunk &chunk) {
+	GadgetList results;
+	GadgetWalker(chunk, results).run();
+	return results;
+}
+
+}
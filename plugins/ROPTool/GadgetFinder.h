@@ -0,0 +1,66 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GADGET_FINDER_20121017_H_
+#define GADGET_FINDER_20121017_H_
+
+#include "Types.h"
+#include "Instruction.h"
+
+#include <QList>
+#include <QString>
+#include <QVector>
+
+namespace rop {
+
+	enum {
+		ROLE_ALU   = 0x01,
+		ROLE_STACK = 0x02,
+		ROLE_LOGIC = 0x04,
+		ROLE_DATA  = 0x08,
+		ROLE_OTHER = 0x10
+	};
+
+	struct Gadget {
+		yad64::address_t address;
+		QString          text;
+		quint32          role;
+		int              depth; // instructions before the terminator
+	};
+
+	typedef QList<Gadget> GadgetList;
+
+	// a slice of a region to be searched. bytes holds the whole region (it is
+	// implicitly shared between all the chunks of that region) so that gadgets
+	// may start before first, only terminators are restricted to [first, last)
+	struct GadgetChunk {
+		QVector<quint8>  bytes;
+		yad64::address_t base;
+		int              first;
+		int              last;
+		int              depth;
+	};
+
+	GadgetList find_gadgets(const GadgetChunk &chunk);
+	bool gadget_address_less_than(const Gadget &a, const Gadget &b);
+	quint32 gadget_role(const yad64::Instruction &insn);
+	bool is_nop(const yad64::Instruction &insn);
+	bool is_terminator(const yad64::Instruction &insn);
+}
+
+#endif
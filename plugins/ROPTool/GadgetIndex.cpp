@@ -0,0 +1,166 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "GadgetIndex.h"
+#include "Configuration.h"
+#include "Debugger.h"
+#include "MemoryRegion.h"
+
+#include <QDataStream>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+namespace rop {
+namespace {
+
+const quint32 index_magic   = 0x524f5049; // "ROPI"
+const quint32 index_version = 2;
+
+}
+
+//------------------------------------------------------------------------------
+// Name: index_filename(const MemoryRegion &region)
+// Desc: returns the name of the index for region, or an empty string if the
+//       region is not something which can be indexed
+//------------------------------------------------------------------------------
+QString index_filename(const MemoryRegion &region) {
+
+	// the contents of writable regions are not what is in the file
+	if(region.writable()) {
+		return QString();
+	}
+
+	const QString name = region.name();
+	if(name.isEmpty() || !QFileInfo(name).isFile()) {
+		return QString();
+	}
+
+	const QByteArray md5 = yad64::v1::get_file_md5(name);
+	if(md5.isEmpty()) {
+		return QString();
+	}
+
+	return QString("%1/%2.%3.%4.gadgets").arg(
+		yad64::v1::config().symbol_path,
+		yad64::v1::basename(name),
+		QString::fromLatin1(md5.toHex()),
+		QString::number(region.base(), 16));
+}
+
+//------------------------------------------------------------------------------
+// Name: load_index(const QString &filename, const MemoryRegion &region, const QByteArray &region_md5, int depth, GadgetList &gadgets)
+// Desc: reads the gadgets of up to depth instructions from the index, relocated
+//       to where region is mapped. fails if the index was built for a smaller
+//       depth, for a region of a different size or from different bytes (the
+//       debuggee may have patched its code, or the loader relocated it)
+//------------------------------------------------------------------------------
+bool load_index(const QString &filename, const MemoryRegion &region, const QByteArray &region_md5, int depth, GadgetList &gadgets) {
+
+	QFile file(filename);
+	if(!file.open(QIODevice::ReadOnly)) {
+		return false;
+	}
+
+	QDataStream stream(&file);
+	stream.setVersion(QDataStream::Qt_4_6);
+
+	quint32    magic;
+	quint32    version;
+	quint64    region_size;
+	QByteArray index_md5;
+	qint32     index_depth;
+	quint32    count;
+
+	stream >> magic >> version;
+
+	if(stream.status() != QDataStream::Ok || magic != index_magic || version != index_version) {
+		qDebug() << "[ROPTool] ignoring invalid gadget index:" << filename;
+		return false;
+	}
+
+	stream >> region_size >> index_md5 >> index_depth >> count;
+
+	if(stream.status() != QDataStream::Ok || region_size != region.size() || index_md5 != region_md5 || index_depth < depth) {
+		return false;
+	}
+
+	GadgetList results;
+	for(quint32 i = 0; i < count; ++i) {
+		quint64 offset;
+		qint32  gadget_depth;
+		Gadget  gadget;
+
+		stream >> offset >> gadget_depth >> gadget.role >> gadget.text;
+
+		if(stream.status() != QDataStream::Ok || offset >= region_size) {
+			qDebug() << "[ROPTool] ignoring truncated gadget index:" << filename;
+			return false;
+		}
+
+		if(gadget_depth <= depth) {
+			gadget.address = region.start() + offset;
+			gadget.depth   = gadget_depth;
+			results.append(gadget);
+		}
+	}
+
+	gadgets.append(results);
+	return true;
+}
+
+//------------------------------------------------------------------------------
+// Name: save_index(const QString &filename, const MemoryRegion &region, const QByteArray &region_md5, int depth, const GadgetList &gadgets)
+// Desc: writes every gadget found in region by a search of the given depth
+//------------------------------------------------------------------------------
+bool save_index(const QString &filename, const MemoryRegion &region, const QByteArray &region_md5, int depth, const GadgetList &gadgets) {
+
+	QDir().mkpath(QFileInfo(filename).absolutePath());
+
+	// write to a temporary and rename it in place, so that an interrupted save
+	// never leaves a truncated index behind
+	const QString temp_filename = filename + ".tmp";
+
+	QFile file(temp_filename);
+	if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+		qDebug() << "[ROPTool] unable to write gadget index:" << filename;
+		return false;
+	}
+
+	QDataStream stream(&file);
+	stream.setVersion(QDataStream::Qt_4_6);
+
+	stream << index_magic << index_version << static_cast<quint64>(region.size()) << region_md5 << static_cast<qint32>(depth) << static_cast<quint32>(gadgets.size());
+
+	Q_FOREACH(const Gadget &gadget, gadgets) {
+		stream << static_cast<quint64>(gadget.address - region.start()) << static_cast<qint32>(gadget.depth) << gadget.role << gadget.text;
+	}
+
+	file.close();
+
+	if(stream.status() != QDataStream::Ok || file.error() != QFile::NoError) {
+		QFile::remove(temp_filename);
+		return false;
+	}
+
+	QFile::remove(filename);
+	return QFile::rename(temp_filename, filename);
+}
+
+}
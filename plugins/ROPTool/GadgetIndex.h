@@ -0,0 +1,40 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef GADGET_INDEX_20121017_H_
+#define GADGET_INDEX_20121017_H_
+
+#include "GadgetFinder.h"
+
+class MemoryRegion;
+
+namespace rop {
+
+	// gadgets found in a read only, file backed region are kept on disk (next to
+	// the symbol files) so that the next search of the same module does not need
+	// to touch the debuggee at all. indexes are keyed by the MD5 of the file and
+	// the file offset of the region, and store addresses relative to the start
+	// of the region so that they can be relocated wherever it is mapped. The
+	// MD5 of the region's bytes is stored too, an index is only used while the
+	// live region still holds exactly the bytes it was built from
+	QString index_filename(const MemoryRegion &region);
+	bool load_index(const QString &filename, const MemoryRegion &region, const QByteArray &region_md5, int depth, GadgetList &gadgets);
+	bool save_index(const QString &filename, const MemoryRegion &region, const QByteArray &region_md5, int depth, const GadgetList &gadgets);
+}
+
+#endif
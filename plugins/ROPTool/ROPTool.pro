@@ -1,8 +1,10 @@
 
 include(../plugins.pri)
 
+DEFINES += USE_QT_CONCURRENT
+
 # Input
-HEADERS += ROPTool.h DialogROPTool.h
+HEADERS += ROPTool.h DialogROPTool.h GadgetFinder.h GadgetIndex.h
 FORMS += dialogrop.ui
-SOURCES += ROPTool.cpp DialogROPTool.cpp
+SOURCES += ROPTool.cpp DialogROPTool.cpp GadgetFinder.cpp GadgetIndex.cpp
 
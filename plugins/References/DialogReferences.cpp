@@ -18,23 +18,155 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "DialogReferences.h"
 #include "IDebuggerCore.h"
+#include "Job.h"
 #include "Debugger.h"
 #include "Util.h"
 #include "MemoryRegions.h"
-#include "Debugger.h"
+#include "ReferenceScanner.h"
+#include "ResultsModel.h"
+#include "ResultsView.h"
 
 #include <QVector>
 #include <QMessageBox>
+#include <QRegExp>
+#include <QStringList>
+
+#include <algorithm>
 
 #include "ui_dialogreferences.h"
 
+namespace {
+
+// regions are read until about batch_size bytes are pending so that small
+// ones are scanned together
+const std::size_t batch_size = 0x4000000;
+
+bool match_less_than(const ReferenceMatch &a, const ReferenceMatch &b) {
+	if(a.address != b.address) {
+		return a.address < b.address;
+	}
+	return a.type < b.type;
+}
+
+// scans one chunk of a region, for Job::map_chunks. the tag of a chunk is
+// non-zero if its region is executable, which is when code is looked at too
+class ScanChunk {
+public:
+	typedef ReferenceMatches result_type;
+
+public:
+	explicit ScanChunk(const ReferenceScanner &scanner) : scanner_(&scanner) {
+	}
+
+public:
+	ReferenceMatches operator()(const Job::Chunk &chunk) const {
+		ReferenceMatches matches;
+		scanner_->scan_data(chunk.bytes.constData(), chunk.bytes.size(), chunk.base, chunk.first, chunk.last, matches);
+		if(chunk.tag) {
+			scanner_->scan_code(chunk.bytes.constData(), chunk.bytes.size(), chunk.base, chunk.first, chunk.last, matches);
+		}
+
+		std::sort(matches.begin(), matches.end(), match_less_than);
+		return matches;
+	}
+
+private:
+	const ReferenceScanner *scanner_;
+};
+
+//------------------------------------------------------------------------------
+// Name: make_results(const QList<ReferenceMatches> &results, bool show_target)
+// Desc:
+//------------------------------------------------------------------------------
+ResultStore make_results(const QList<ReferenceMatches> &results, bool show_target) {
+
+	ResultStore found;
+	Q_FOREACH(const ReferenceMatches &matches, results) {
+		Q_FOREACH(const ReferenceMatch &match, matches) {
+			found.append(match.address, show_target ? QString("-> %1").arg(yad64::v1::format_pointer(match.target)) : QString(), match.type);
+		}
+	}
+
+	return found;
+}
+
+class ScanJob : public Job {
+public:
+	ScanJob(const QList<ReferenceTarget> &targets, bool aligned, bool skip_no_access);
+
+public:
+	virtual void run();
+
+private:
+	const ReferenceScanner    scanner_;
+	const QList<MemoryRegion> regions_;
+	const yad64::address_t    page_size_;
+	const bool                skip_no_access_;
+	bool                      show_target_;
+};
+
+//------------------------------------------------------------------------------
+// Name: ScanJob(...)
+// Desc: the regions are taken here, on the GUI thread
+//------------------------------------------------------------------------------
+ScanJob::ScanJob(const QList<ReferenceTarget> &targets, bool aligned, bool skip_no_access) :
+		scanner_(targets, aligned),
+		regions_(yad64::v1::memory_regions().regions()),
+		page_size_(yad64::v1::debugger_core->page_size()),
+		skip_no_access_(skip_no_access) {
+
+	// with a single address every result refers to it, so there is no need
+	// to say which target each one hit
+	show_target_ = targets.size() != 1 || targets[0].last - targets[0].first != 1;
+}
+
+//------------------------------------------------------------------------------
+// Name: run()
+// Desc: reads regions in bulk and scans them for references on all threads
+//------------------------------------------------------------------------------
+void ScanJob::run() {
+
+	QList<Chunk> chunks;
+	std::size_t pending = 0;
+
+	int i = 0;
+	Q_FOREACH(const MemoryRegion &region, regions_) {
+		++i;
+
+		if(cancelled()) {
+			return;
+		}
+
+		// a short circut for speading things up
+		if(region.accessible() || !skip_no_access_) {
+			const QVector<quint8> pages = read_buffer(region.start(), region.size() / page_size_, page_size_);
+			if(!pages.isEmpty()) {
+				split_chunks(pages, region.start(), 0, pages.size(), region.executable(), chunks);
+				pending += pages.size();
+			}
+		}
+
+		if(pending >= batch_size) {
+			report_results(make_results(map_chunks(chunks, ScanChunk(scanner_)), show_target_));
+			chunks.clear();
+			pending = 0;
+		}
+
+		set_progress(util::percentage(i, regions_.size()));
+	}
+
+	report_results(make_results(map_chunks(chunks, ScanChunk(scanner_)), show_target_));
+	set_progress(100);
+}
+
+}
+
 //------------------------------------------------------------------------------
 // Name: DialogReferences(QWidget *parent)
 // Desc: constructor
 //------------------------------------------------------------------------------
 DialogReferences::DialogReferences(QWidget *parent) : QDialog(parent), ui(new Ui::DialogReferences) {
 	ui->setupUi(this);
-	connect(this, SIGNAL(updateProgress(int)), ui->progressBar, SLOT(setValue(int)));
 }
 
 //------------------------------------------------------------------------------
@@ -42,6 +174,9 @@ DialogReferences::DialogReferences(QWidget *parent) : QDialog(parent), ui(new Ui
 // Desc:
 //------------------------------------------------------------------------------
 DialogReferences::~DialogReferences() {
+	if(job_) {
+		job_->cancel();
+	}
 	delete ui;
 }
 
@@ -50,117 +185,103 @@ DialogReferences::~DialogReferences() {
 // Desc:
 //------------------------------------------------------------------------------
 void DialogReferences::showEvent(QShowEvent *) {
-	ui->listWidget->clear();
+	ui->results->model()->clear();
 	ui->progressBar->setValue(0);
 }
 
 //------------------------------------------------------------------------------
-// Name: do_find()
-// Desc:
+// Name: targets(QList<ReferenceTarget> &targets)
+// Desc: parses the list of addresses to search for. each entry is either an
+//       address, start-end (end is exclusive) or start+size, all in hex.
+//       returns false if one of them could not be parsed
 //------------------------------------------------------------------------------
-void DialogReferences::do_find() {
-	bool ok;
-	const yad64::address_t address   = yad64::v1::string_to_address(ui->txtAddress->text(), ok);
-	const yad64::address_t page_size = yad64::v1::debugger_core->page_size();
-
-	if(ok) {
-		yad64::v1::memory_regions().sync();
-		const QList<MemoryRegion> regions = yad64::v1::memory_regions().regions();
-
-		int i = 0;
-		Q_FOREACH(const MemoryRegion &region, regions) {
-			// a short circut for speading things up
-			if(region.accessible() || !ui->chkSkipNoAccess->isChecked()) {
-
-				const yad64::address_t size_in_pages = region.size() / page_size;
-
-				try {
-
-					QVector<quint8> pages(size_in_pages * page_size);
-					const quint8 *const pages_end = &pages[0] + region.size();
-
-					if(yad64::v1::debugger_core->read_pages(region.start(), &pages[0], size_in_pages)) {
-						const quint8 *p = &pages[0];
-						while(p != pages_end) {
-
-							if(static_cast<std::size_t>(pages_end - p) < sizeof(yad64::address_t)) {
-								break;
-							}
-
-							const yad64::address_t addr = p - &pages[0] + region.start();
-
-							yad64::address_t test_address;
-							memcpy(&test_address, p, sizeof(yad64::address_t));
-
-							if(test_address == address) {
-
-								QListWidgetItem *const item = new QListWidgetItem(yad64::v1::format_pointer(addr));
-								item->setData(Qt::UserRole, 'D');
-								ui->listWidget->addItem(item);
-							}
-
-							yad64::Instruction insn(p, pages_end, addr, std::nothrow);
-							if(insn.valid()) {
-								switch(insn.type()) {
-								case yad64::Instruction::OP_JMP:
-								case yad64::Instruction::OP_CALL:
-								case yad64::Instruction::OP_JCC:
-									if(insn.operand(0).general_type() == yad64::Operand::TYPE_REL) {
-										if(insn.operand(0).relative_target() == address) {
-											QListWidgetItem *const item = new QListWidgetItem(yad64::v1::format_pointer(addr));
-											item->setData(Qt::UserRole, 'C');
-											ui->listWidget->addItem(item);
-										}
-									}
-									break;
-								default:
-									break;
-								}
-							}
-
-							emit updateProgress(util::percentage(i, regions.size(), p - &pages[0], region.size()));
-							++p;
-						}
-					}
-				} catch(const std::bad_alloc &) {
-					QMessageBox::information(
-						0,
-						tr("Memroy Allocation Error"),
-						tr("Unable to satisfy memory allocation request for requested region."));
-				}
-			} else {
-				emit updateProgress(util::percentage(i, regions.size()));
-			}
-			++i;
+bool DialogReferences::targets(QList<ReferenceTarget> &targets) {
+
+	Q_FOREACH(const QString &s, ui->txtAddress->text().split(QRegExp("[;,\\s]+"), QString::SkipEmptyParts)) {
+
+		bool ok_first = false;
+		bool ok_last  = true;
+		ReferenceTarget target;
+
+		const int plus  = s.indexOf('+');
+		const int minus = s.indexOf('-');
+
+		if(plus != -1) {
+			target.first = yad64::v1::string_to_address(s.left(plus), ok_first);
+			target.last  = target.first + s.mid(plus + 1).toULongLong(&ok_last, 16);
+		} else if(minus != -1) {
+			target.first = yad64::v1::string_to_address(s.left(minus), ok_first);
+			target.last  = yad64::v1::string_to_address(s.mid(minus + 1), ok_last);
+		} else {
+			target.first = yad64::v1::string_to_address(s, ok_first);
+			target.last  = target.first + 1;
 		}
+
+		if(!ok_first || !ok_last || target.last <= target.first) {
+			QMessageBox::information(
+				this,
+				tr("Invalid Address"),
+				tr("\"%1\" is not a valid address or range. Use an address, start-end or start+size.").arg(s));
+			return false;
+		}
+
+		targets.append(target);
 	}
+
+	return true;
 }
 
 //------------------------------------------------------------------------------
 // Name: on_btnFind_clicked()
-// Desc: find button event handler
+// Desc: find button event handler, while a scan runs it cancels it instead
 //------------------------------------------------------------------------------
 void DialogReferences::on_btnFind_clicked() {
-	ui->btnFind->setEnabled(false);
+
+	if(job_) {
+		job_->cancel();
+		return;
+	}
+
+	ui->results->model()->clear();
+
+	QList<ReferenceTarget> search_targets;
+	if(!targets(search_targets) || search_targets.isEmpty()) {
+		return;
+	}
+
+	yad64::v1::memory_regions().sync();
+	job_ = new ScanJob(search_targets, ui->chkAligned->isChecked(), ui->chkSkipNoAccess->isChecked());
+
+	connect(job_, SIGNAL(progress(int)), ui->progressBar, SLOT(setValue(int)));
+	connect(job_, SIGNAL(results(const ResultStore &)), ui->results->model(), SLOT(append(const ResultStore &)));
+	connect(job_, SIGNAL(finished(bool)), this, SLOT(job_finished(bool)));
+
 	ui->progressBar->setValue(0);
-	ui->listWidget->clear();
-	do_find();
-	ui->progressBar->setValue(100);
-	ui->btnFind->setEnabled(true);
+	ui->btnFind->setText(tr("&Cancel"));
+	yad64::v1::submit_job(job_);
 }
 
 //------------------------------------------------------------------------------
-// Name: on_listWidget_itemDoubleClicked(QListWidgetItem *item)
-// Desc: follows the foudn item in the data view
+// Name: job_finished(bool cancelled)
+// Desc:
 //------------------------------------------------------------------------------
-void DialogReferences::on_listWidget_itemDoubleClicked(QListWidgetItem *item) {
-	bool ok;
-	const yad64::address_t addr = yad64::v1::string_to_address(item->text(), ok);
-	if(ok) {
-		if(item->data(Qt::UserRole).toChar() == 'D') {
-			yad64::v1::dump_data(addr, false);
-		} else {
-			yad64::v1::jump_to_address(addr);
-		}
+void DialogReferences::job_finished(bool cancelled) {
+	job_ = 0;
+	if(!cancelled) {
+		ui->progressBar->setValue(100);
+	}
+	ui->btnFind->setText(tr("&Find"));
+}
+
+//------------------------------------------------------------------------------
+// Name: on_results_doubleClicked(const QModelIndex &index)
+// Desc: follows the found item in the data view
+//------------------------------------------------------------------------------
+void DialogReferences::on_results_doubleClicked(const QModelIndex &index) {
+	const yad64::address_t addr = ui->results->model()->address(index);
+	if(index.data(Qt::UserRole + 1).toUInt() == 'D') {
+		yad64::v1::dump_data(addr, false);
+	} else {
+		yad64::v1::jump_to_address(addr);
 	}
 }
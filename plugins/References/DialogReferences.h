@@ -20,10 +20,13 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define DIALOGREFERENCES_20061101_H_
 
 #include <QDialog>
+#include <QPointer>
 #include "Types.h"
+#include "ReferenceScanner.h"
 
+class Job;
 class MemoryRegion;
-class QListWidgetItem;
+class QModelIndex;
 
 namespace Ui { class DialogReferences; }
 
@@ -36,19 +39,20 @@ public:
 
 public Q_SLOTS:
 	void on_btnFind_clicked();
-	void on_listWidget_itemDoubleClicked(QListWidgetItem *item);
+	void on_results_doubleClicked(const QModelIndex &index);
 
-Q_SIGNALS:
-	void updateProgress(int);
+private Q_SLOTS:
+	void job_finished(bool cancelled);
 
 private:
 	virtual void showEvent(QShowEvent *event);
 
 private:
-	void do_find();
+	bool targets(QList<ReferenceTarget> &targets);
 
 private:
 	 Ui::DialogReferences *const ui;
+	 QPointer<Job>               job_;
 };
 
 #endif
@@ -0,0 +1,347 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ReferenceScanner.h"
+#include "Instruction.h"
+#include "edisassm_length.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// targets closer together than this share a cluster, and no more than
+// max_clusters are range checked per word no matter how many targets there are
+const yad64::address_t cluster_gap  = 0x10000;
+const int              max_clusters = 4;
+
+// unaligned data is scanned in blocks of this many bytes so that the passes
+// for each byte offset stay in the cache
+const std::size_t block_size = 0x1000;
+
+// a relative branch or RIP relative operand lands at most this many bytes past
+// the end of its displacement, the size of the largest trailing immediate
+const yad64::address_t max_displacement_tail = 4;
+
+bool target_less_than(const ReferenceTarget &a, const ReferenceTarget &b) {
+	return a.first < b.first;
+}
+
+bool target_before(yad64::address_t address, const ReferenceTarget &target) {
+	return address < target.first;
+}
+
+bool match_less_than(const ReferenceMatch &a, const ReferenceMatch &b) {
+	return a.address < b.address;
+}
+
+bool match_equal(const ReferenceMatch &a, const ReferenceMatch &b) {
+	return a.address == b.address;
+}
+
+#if defined(__SSE2__)
+//------------------------------------------------------------------------------
+// Name: below_mask(__m128i value, __m128i limit)
+// Desc: one bit per 64-bit lane which is set when value < limit (unsigned).
+//       SSE2 only compares signed 32-bit lanes, so the halves are biased into
+//       signed order and the high half decides unless it is equal
+//------------------------------------------------------------------------------
+inline int below_mask(__m128i value, __m128i limit) {
+	const __m128i bias  = _mm_set1_epi32(0x80000000);
+	const __m128i less  = _mm_cmplt_epi32(_mm_xor_si128(value, bias), _mm_xor_si128(limit, bias));
+	const __m128i equal = _mm_cmpeq_epi32(value, limit);
+	const __m128i below = _mm_or_si128(less, _mm_and_si128(equal, _mm_slli_epi64(less, 32)));
+	return _mm_movemask_pd(_mm_castsi128_pd(below));
+}
+#endif
+
+}
+
+//------------------------------------------------------------------------------
+// Name: ReferenceScanner(const QList<ReferenceTarget> &targets, bool aligned)
+// Desc: empty targets are ignored. when aligned is true only pointer aligned
+//       words are considered data references
+//------------------------------------------------------------------------------
+ReferenceScanner::ReferenceScanner(const QList<ReferenceTarget> &targets, bool aligned) : aligned_(aligned) {
+
+	QVector<ReferenceTarget> sorted;
+	Q_FOREACH(const ReferenceTarget &target, targets) {
+		if(target.first < target.last) {
+			sorted.append(target);
+		}
+	}
+
+	std::sort(sorted.begin(), sorted.end(), target_less_than);
+
+	Q_FOREACH(const ReferenceTarget &target, sorted) {
+		if(!targets_.empty() && target.first <= targets_.back().last) {
+			targets_.back().last = qMax(targets_.back().last, target.last);
+		} else {
+			targets_.append(target);
+		}
+	}
+
+	// group the targets, then keep joining the closest neighbours until
+	// there are few enough clusters to check them all for every word
+	Q_FOREACH(const ReferenceTarget &target, targets_) {
+		if(!clusters_.empty() && target.first - (clusters_.back().lowest + clusters_.back().span) < cluster_gap) {
+			clusters_.back().span = target.last - clusters_.back().lowest;
+		} else {
+			const Cluster cluster = { target.first, target.last - target.first };
+			clusters_.append(cluster);
+		}
+	}
+
+	while(clusters_.size() > max_clusters) {
+		int closest = 0;
+		for(int i = 1; i + 1 < clusters_.size(); ++i) {
+			const yad64::address_t gap         = clusters_[i + 1].lowest - (clusters_[i].lowest + clusters_[i].span);
+			const yad64::address_t closest_gap = clusters_[closest + 1].lowest - (clusters_[closest].lowest + clusters_[closest].span);
+			if(gap < closest_gap) {
+				closest = i;
+			}
+		}
+
+		clusters_[closest].span = clusters_[closest + 1].lowest + clusters_[closest + 1].span - clusters_[closest].lowest;
+		clusters_.remove(closest + 1);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: contains(yad64::address_t address) const
+// Desc: returns true if address falls in one of the targets
+//------------------------------------------------------------------------------
+bool ReferenceScanner::contains(yad64::address_t address) const {
+	QVector<ReferenceTarget>::const_iterator it = std::upper_bound(targets_.begin(), targets_.end(), address, target_before);
+	if(it == targets_.begin()) {
+		return false;
+	}
+
+	--it;
+	return address < it->last;
+}
+
+//------------------------------------------------------------------------------
+// Name: near_cluster(yad64::address_t address, yad64::address_t slack) const
+// Desc: returns true if address is in a cluster or at most slack bytes before
+//       one, this is only a filter, contains has the final say
+//------------------------------------------------------------------------------
+bool ReferenceScanner::near_cluster(yad64::address_t address, yad64::address_t slack) const {
+	for(int i = 0; i < clusters_.size(); ++i) {
+		if(address + slack - clusters_[i].lowest < clusters_[i].span + slack) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//------------------------------------------------------------------------------
+// Name: scan_words(const quint8 *p, std::size_t count, std::size_t stride, yad64::address_t address, ReferenceMatches &matches) const
+// Desc: checks count pointer sized words, stride bytes apart, the first of
+//       which is at p and mapped at address
+//------------------------------------------------------------------------------
+void ReferenceScanner::scan_words(const quint8 *p, std::size_t count, std::size_t stride, yad64::address_t address, ReferenceMatches &matches) const {
+
+	std::size_t i = 0;
+
+#if defined(__SSE2__)
+	if(sizeof(yad64::address_t) == 8 && stride == 8) {
+
+		__m128i lowest[max_clusters];
+		__m128i span[max_clusters];
+		const int cluster_count = clusters_.size();
+
+		for(int c = 0; c < cluster_count; ++c) {
+			lowest[c] = _mm_set1_epi64x(clusters_[c].lowest);
+			span[c]   = _mm_set1_epi64x(clusters_[c].span);
+		}
+
+		for(; i + 2 <= count; i += 2) {
+			const __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i * 8));
+
+			int mask = 0;
+			for(int c = 0; c < cluster_count; ++c) {
+				mask |= below_mask(_mm_sub_epi64(words, lowest[c]), span[c]);
+			}
+
+			while(mask) {
+				const int lane = (mask & 1) ? 0 : 1;
+				mask &= mask - 1;
+
+				yad64::address_t value;
+				std::memcpy(&value, p + (i + lane) * 8, sizeof(value));
+				if(contains(value)) {
+					const ReferenceMatch match = { address + (i + lane) * 8, value, 'D' };
+					matches.append(match);
+				}
+			}
+		}
+	}
+#endif
+
+	for(; i < count; ++i) {
+		yad64::address_t value;
+		std::memcpy(&value, p + i * stride, sizeof(value));
+		if(near_cluster(value, 0) && contains(value)) {
+			const ReferenceMatch match = { address + i * stride, value, 'D' };
+			matches.append(match);
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: scan_data(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t first, std::size_t last, ReferenceMatches &matches) const
+// Desc: appends every stored pointer to a target, in no particular order
+//------------------------------------------------------------------------------
+void ReferenceScanner::scan_data(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t first, std::size_t last, ReferenceMatches &matches) const {
+
+	const std::size_t word = sizeof(yad64::address_t);
+
+	if(empty() || size < word) {
+		return;
+	}
+
+	last = qMin(last, size - word + 1);
+
+	if(aligned_) {
+		const std::size_t start = first + ((word - (base + first) % word) % word);
+		if(start < last) {
+			scan_words(data + start, (last - start + word - 1) / word, word, base + start, matches);
+		}
+	} else {
+		for(std::size_t block = first; block < last; block += block_size) {
+			const std::size_t block_last = qMin(block + block_size, last);
+			for(std::size_t k = 0; k < word && block + k < block_last; ++k) {
+				scan_words(data + block + k, (block_last - block - k + word - 1) / word, word, base + block + k, matches);
+			}
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: check_instruction(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t offset, ReferenceMatches &matches) const
+// Desc: appends the instruction at offset if it branches to or addresses a
+//       target
+//------------------------------------------------------------------------------
+void ReferenceScanner::check_instruction(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t offset, ReferenceMatches &matches) const {
+
+	yad64::InstructionLength info;
+	if(!edisassm::decode_length(data + offset, size - offset, base + offset, info)) {
+		return;
+	}
+
+	if(info.has_target && contains(info.target)) {
+		const ReferenceMatch match = { base + offset, info.target, 'C' };
+		matches.append(match);
+	} else if(info.has_memory_target && contains(info.memory_target)) {
+		const ReferenceMatch match = { base + offset, info.memory_target, 'C' };
+		matches.append(match);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: scan_code(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t first, std::size_t last, ReferenceMatches &matches) const
+// Desc: appends every instruction which refers to a target, sorted by address.
+//       like the disassembly view this considers every byte offset, not just
+//       the ones a linear sweep would reach
+//------------------------------------------------------------------------------
+void ReferenceScanner::scan_code(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t first, std::size_t last, ReferenceMatches &matches) const {
+
+	const std::size_t max_size = yad64::Instruction::MAX_SIZE;
+
+	if(empty() || first >= last || size < 4) {
+		return;
+	}
+
+	last = qMin(last, size);
+
+	const int found = matches.size();
+
+	// 32-bit displacements, both rel32 branches and RIP relative operands.
+	// a displacement at j belongs to an instruction starting somewhere in the
+	// few bytes before it, so only those starts are decoded
+	const std::size_t j_last = qMin(last + max_size - 4, size - 3);
+	for(std::size_t j = first + 1; j < j_last; ++j) {
+
+		qint32 displacement;
+		std::memcpy(&displacement, data + j, sizeof(displacement));
+
+		const yad64::address_t next = base + j + 4 + static_cast<yad64::address_t>(static_cast<qint64>(displacement));
+		if(!near_cluster(next, max_displacement_tail)) {
+			continue;
+		}
+
+		const std::size_t lowest = (j > first + (max_size - 4)) ? j - (max_size - 4) : first;
+		for(std::size_t start = qMin(j, last); start-- > lowest; ) {
+			check_instruction(data, size, base, start, matches);
+		}
+	}
+
+	// rel16 branches, an operand size prefix on call, jmp or jcc. their target
+	// is truncated to 16 bits, so only targets below 0x10000 can be reached
+	if(targets_.front().first < 0x10000) {
+		const std::size_t k_last = qMin(last + max_size - 2, size - 1);
+		for(std::size_t j = first + 1; j < k_last; ++j) {
+
+			qint16 displacement;
+			std::memcpy(&displacement, data + j, sizeof(displacement));
+
+			const yad64::address_t target = (base + j + 2 + static_cast<yad64::address_t>(static_cast<qint64>(displacement))) & 0xffff;
+			if(!contains(target)) {
+				continue;
+			}
+
+			const std::size_t lowest = (j > first + (max_size - 2)) ? j - (max_size - 2) : first;
+			for(std::size_t start = qMin(j, last); start-- > lowest; ) {
+				check_instruction(data, size, base, start, matches);
+			}
+		}
+	}
+
+	// rel8 branches can only reach a target from just around it, so the
+	// bytes near each target are simply all decoded. the windows stop at the
+	// top of the address space rather than wrapping
+	const yad64::address_t highest = ~static_cast<yad64::address_t>(0);
+
+	std::size_t next_offset = first;
+	Q_FOREACH(const ReferenceTarget &target, targets_) {
+
+		const yad64::address_t window_first = (target.first > max_size + 0x80) ? target.first - (max_size + 0x80) : 0;
+		const yad64::address_t window_last  = (target.last < highest - 0x80) ? target.last + 0x80 : highest;
+
+		if(window_last <= base + next_offset || window_first >= base + last) {
+			continue;
+		}
+
+		std::size_t offset     = qMax(next_offset, static_cast<std::size_t>(qMax(window_first, base) - base));
+		const std::size_t stop = static_cast<std::size_t>(qMin(window_last, base + last) - base);
+
+		for(; offset < stop; ++offset) {
+			check_instruction(data, size, base, offset, matches);
+		}
+
+		next_offset = stop;
+	}
+
+	std::sort(matches.begin() + found, matches.end(), match_less_than);
+	matches.erase(std::unique(matches.begin() + found, matches.end(), match_equal), matches.end());
+}
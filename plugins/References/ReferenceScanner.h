@@ -0,0 +1,78 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef REFERENCE_SCANNER_20121017_H_
+#define REFERENCE_SCANNER_20121017_H_
+
+#include "Types.h"
+
+#include <QList>
+#include <QVector>
+
+// a half open range of addresses [first, last) to look for references to
+struct ReferenceTarget {
+	yad64::address_t first;
+	yad64::address_t last;
+};
+
+struct ReferenceMatch {
+	yad64::address_t address;
+	yad64::address_t target;
+	char             type;    // 'D' for a stored pointer, 'C' for code
+};
+
+typedef QVector<ReferenceMatch> ReferenceMatches;
+
+// finds everything which refers to any of a set of address ranges. data
+// references are pointer sized words whose value falls in a target, they are
+// range checked two words at a time with SSE2 where available. code references
+// are relative branches and RIP relative operands, candidates are found by
+// looking for displacements which could land in a target and then confirmed
+// with the length decoder
+class ReferenceScanner {
+public:
+	ReferenceScanner(const QList<ReferenceTarget> &targets, bool aligned);
+
+public:
+	bool empty() const { return targets_.empty(); }
+	bool contains(yad64::address_t address) const;
+
+	// both find every reference which starts in [first, last), bytes past last
+	// are only used to complete them. data is assumed to be mapped at base
+	void scan_data(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t first, std::size_t last, ReferenceMatches &matches) const;
+	void scan_code(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t first, std::size_t last, ReferenceMatches &matches) const;
+
+private:
+	// a group of nearby targets, lowest + span is one past the highest
+	struct Cluster {
+		yad64::address_t lowest;
+		yad64::address_t span;
+	};
+
+private:
+	bool near_cluster(yad64::address_t address, yad64::address_t slack) const;
+	void scan_words(const quint8 *p, std::size_t count, std::size_t stride, yad64::address_t address, ReferenceMatches &matches) const;
+	void check_instruction(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t offset, ReferenceMatches &matches) const;
+
+private:
+	QVector<ReferenceTarget> targets_;  // sorted and merged
+	QVector<Cluster>         clusters_;
+	bool                     aligned_;
+};
+
+#endif
@@ -1,7 +1,9 @@
 
 include(../plugins.pri)
 
+DEFINES += USE_QT_CONCURRENT
+
 # Input
-HEADERS += References.h DialogReferences.h
+HEADERS += References.h DialogReferences.h ReferenceScanner.h
 FORMS += dialogreferences.ui
-SOURCES += References.cpp DialogReferences.cpp
+SOURCES += References.cpp DialogReferences.cpp ReferenceScanner.cpp
@@ -0,0 +1,327 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ReferenceScanner.h"
+#include "TestUtil.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+// compares ReferenceScanner against checking every word and decoding every
+// offset. the targets are spread over more clusters than the scanner range
+// checks at once, and some of them sit just below 2^63 and 2^64 where the
+// SSE2 compare and the displacement arithmetic wrap. the buffer is filled
+// with pointers to the targets and with instructions which branch to or
+// address them
+
+namespace {
+
+typedef std::vector<ReferenceTarget> targets_t;
+
+const yad64::address_t top = ~static_cast<yad64::address_t>(0);
+
+using test::bytes_t;
+using test::next_random;
+using test::next_random64;
+
+bool in_targets(const targets_t &targets, yad64::address_t address) {
+	for(std::size_t i = 0; i < targets.size(); ++i) {
+		if(address >= targets[i].first && address < targets[i].last) {
+			return true;
+		}
+	}
+	return false;
+}
+
+//------------------------------------------------------------------------------
+// Name: make_targets(yad64::address_t base, std::size_t size)
+// Desc: targets in and just past the buffer, near 0 (in reach of 16-bit
+//       branches), just below 2^63 and 2^64 and anywhere at all. some overlap
+//       each other and some are empty
+//------------------------------------------------------------------------------
+targets_t make_targets(yad64::address_t base, std::size_t size) {
+
+	targets_t targets;
+
+	const int count = 1 + next_random() % 12;
+	for(int i = 0; i < count; ++i) {
+		yad64::address_t first;
+		switch(next_random() % 6) {
+		case 0:  first = base + next_random() % size; break;
+		case 1:  first = base + size + next_random() % 0x1000; break;
+		case 2:  first = next_random() % 0x10000; break;
+		case 3:  first = (static_cast<yad64::address_t>(1) << 63) - 0x800 + next_random() % 0x1000; break;
+		case 4:  first = top - next_random() % 0x1000; break;
+		default: first = next_random64(); break;
+		}
+
+		const yad64::address_t length = (next_random() % 8 == 0) ? 0 : 1 + next_random() % 0x100;
+		const ReferenceTarget target = { first, (first > top - length) ? top : first + length };
+		targets.push_back(target);
+
+		if(next_random() % 4 == 0) {
+			const ReferenceTarget overlap = { target.first + length / 2, target.last + next_random() % 0x40 };
+			if(overlap.last >= target.last) {
+				targets.push_back(overlap);
+			}
+		}
+	}
+
+	return targets;
+}
+
+//------------------------------------------------------------------------------
+// Name: pick_address(const targets_t &targets)
+// Desc: an address in or just outside one of the targets
+//------------------------------------------------------------------------------
+yad64::address_t pick_address(const targets_t &targets) {
+	const ReferenceTarget &target = targets[next_random() % targets.size()];
+	switch(next_random() % 4) {
+	case 0:  return target.first - 1;
+	case 1:  return target.last;
+	case 2:  return target.last - 1;
+	default: return target.first + next_random() % (target.last - target.first + 1);
+	}
+}
+
+void append(bytes_t &data, yad64::address_t value, std::size_t size) {
+	for(std::size_t i = 0; i < size; ++i) {
+		data.push_back(static_cast<quint8>(value >> (i * 8)));
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: make_data(yad64::address_t base, std::size_t size, const targets_t &targets)
+// Desc: noise with stored pointers, rel32 branches, RIP relative operands
+//       (with immediates after the displacement), rel8 and rel16 branches in
+//       it, the pointers and displacements aimed at or next to the targets
+//------------------------------------------------------------------------------
+bytes_t make_data(yad64::address_t base, std::size_t size, const targets_t &targets) {
+
+	// opcode bytes up to the displacement, and how many immediate bytes follow
+	static const struct {
+		quint8      bytes[4];
+		std::size_t length;
+		std::size_t immediate;
+	} rel32[] = {
+		{ { 0xe8 },                   1, 0 }, // call rel32
+		{ { 0xe9 },                   1, 0 }, // jmp rel32
+		{ { 0x0f, 0x84 },             2, 0 }, // je rel32
+		{ { 0x48, 0x8b, 0x05 },       3, 0 }, // mov rax, [rip + disp32]
+		{ { 0x48, 0x8d, 0x0d },       3, 0 }, // lea rcx, [rip + disp32]
+		{ { 0xff, 0x15 },             2, 0 }, // call [rip + disp32]
+		{ { 0x80, 0x3d },             2, 1 }, // cmp byte [rip + disp32], imm8
+		{ { 0x66, 0xc7, 0x05 },       3, 2 }, // mov word [rip + disp32], imm16
+		{ { 0x48, 0xc7, 0x05 },       3, 4 }  // mov qword [rip + disp32], imm32
+	};
+
+	static const struct {
+		quint8      bytes[3];
+		std::size_t length;
+	} rel16[] = {
+		{ { 0x66, 0xe8 },       2 }, // call rel16
+		{ { 0x66, 0xe9 },       2 }, // jmp rel16
+		{ { 0x66, 0x0f, 0x85 }, 3 }  // jne rel16
+	};
+
+	bytes_t data;
+	while(data.size() < size) {
+		const std::size_t n = 1 + next_random() % 24;
+
+		switch(next_random() % 8) {
+		case 0:
+		case 1:
+			for(std::size_t i = 0; i < n; ++i) {
+				data.push_back(static_cast<quint8>(next_random()));
+			}
+			break;
+		case 2:
+			append(data, pick_address(targets), 8);
+			break;
+		case 3:
+		case 4:
+			do {
+				const std::size_t k = next_random() % (sizeof(rel32) / sizeof(rel32[0]));
+				data.insert(data.end(), rel32[k].bytes, rel32[k].bytes + rel32[k].length);
+
+				const yad64::address_t next = base + data.size() + 4 + rel32[k].immediate;
+				append(data, pick_address(targets) - next, 4);
+				append(data, next_random(), rel32[k].immediate);
+			} while(0);
+			break;
+		case 5:
+			do {
+				const std::size_t k = next_random() % (sizeof(rel16) / sizeof(rel16[0]));
+				data.insert(data.end(), rel16[k].bytes, rel16[k].bytes + rel16[k].length);
+
+				const yad64::address_t next = base + data.size() + 2;
+				append(data, pick_address(targets) - next, 2);
+			} while(0);
+			break;
+		case 6:
+			// jmp rel8 or a jcc rel8
+			data.push_back((next_random() & 1) ? 0xeb : static_cast<quint8>(0x70 + next_random() % 16));
+			data.push_back(static_cast<quint8>(next_random()));
+			break;
+		default:
+			data.insert(data.end(), n, 0);
+			break;
+		}
+	}
+
+	data.resize(size);
+	return data;
+}
+
+bool match_less_than(const ReferenceMatch &a, const ReferenceMatch &b) {
+	return a.address < b.address;
+}
+
+//------------------------------------------------------------------------------
+// Name: reference_data(...)
+// Desc: every word in [first, last) which fits in the buffer and holds an
+//       address in a target, only the pointer aligned ones when aligned
+//------------------------------------------------------------------------------
+std::vector<ReferenceMatch> reference_data(const bytes_t &data, yad64::address_t base, std::size_t first, std::size_t last, const targets_t &targets, bool aligned) {
+
+	const std::size_t word = sizeof(yad64::address_t);
+
+	std::vector<ReferenceMatch> matches;
+	for(std::size_t i = first; i < last && i + word <= data.size(); ++i) {
+		if(aligned && (base + i) % word != 0) {
+			continue;
+		}
+
+		yad64::address_t value;
+		std::memcpy(&value, &data[i], sizeof(value));
+		if(in_targets(targets, value)) {
+			const ReferenceMatch match = { base + i, value, 'D' };
+			matches.push_back(match);
+		}
+	}
+	return matches;
+}
+
+//------------------------------------------------------------------------------
+// Name: reference_code(...)
+// Desc: decodes at every offset in [first, last) and keeps the instructions
+//       whose branch target, or failing that RIP relative operand, is in a
+//       target
+//------------------------------------------------------------------------------
+std::vector<ReferenceMatch> reference_code(const bytes_t &data, yad64::address_t base, std::size_t first, std::size_t last, const targets_t &targets) {
+
+	std::vector<ReferenceMatch> matches;
+	for(std::size_t i = first; i < last && i < data.size(); ++i) {
+
+		yad64::InstructionLength info;
+		if(!edisassm::decode_length(&data[i], data.size() - i, base + i, info)) {
+			continue;
+		}
+
+		if(info.has_target && in_targets(targets, info.target)) {
+			const ReferenceMatch match = { base + i, info.target, 'C' };
+			matches.push_back(match);
+		} else if(info.has_memory_target && in_targets(targets, info.memory_target)) {
+			const ReferenceMatch match = { base + i, info.memory_target, 'C' };
+			matches.push_back(match);
+		}
+	}
+	return matches;
+}
+
+bool same(const std::vector<ReferenceMatch> &a, ReferenceMatches b) {
+	if(a.size() != static_cast<std::size_t>(b.size())) {
+		return false;
+	}
+
+	// data references come out in no particular order
+	std::sort(b.begin(), b.end(), match_less_than);
+
+	for(std::size_t i = 0; i < a.size(); ++i) {
+		if(a[i].address != b[i].address || a[i].target != b[i].target || a[i].type != b[i].type) {
+			return false;
+		}
+	}
+	return true;
+}
+
+}
+
+int main() {
+
+	for(int round = 0; round < 400; ++round) {
+
+		const std::size_t size = 16 + next_random() % 4096;
+
+		// in the low half, just below 2^63 and ending just below 2^64, so that
+		// displacements reach the targets around 0, 2^63 and 2^64 from each of
+		// them and rel8 branches reach the ones at the very top
+		yad64::address_t base;
+		switch(round % 4) {
+		case 0:  base = 0x1000; break;
+		case 1:  base = 0x400000; break;
+		case 2:  base = (static_cast<yad64::address_t>(1) << 63) - 0x10000; break;
+		default: base = top - size - 0x100; break;
+		}
+
+		base += next_random() % 16;
+
+		const targets_t targets = make_targets(base, size);
+		const bytes_t data      = make_data(base, size, targets);
+
+		QList<ReferenceTarget> list;
+		for(std::size_t i = 0; i < targets.size(); ++i) {
+			list.append(targets[i]);
+		}
+
+		const std::size_t first = (next_random() & 1) ? 0 : next_random() % size;
+		const std::size_t last  = (next_random() & 1) ? size : first + next_random() % (size - first + 1);
+
+		for(int aligned = 0; aligned < 2; ++aligned) {
+
+			test::performing() << "round " << round << " (" << targets.size() << " targets, " << (aligned ? "aligned" : "unaligned") << ")" << test::ellipsis;
+
+			const ReferenceScanner scanner(list, aligned);
+
+			ReferenceMatches data_whole;
+			ReferenceMatches data_range;
+			ReferenceMatches code_whole;
+			ReferenceMatches code_range;
+			scanner.scan_data(&data[0], size, base, 0, size, data_whole);
+			scanner.scan_data(&data[0], size, base, first, last, data_range);
+			scanner.scan_code(&data[0], size, base, 0, size, code_whole);
+			scanner.scan_code(&data[0], size, base, first, last, code_range);
+
+			const std::vector<ReferenceMatch> expected_data_whole = reference_data(data, base, 0, size, targets, aligned);
+			const std::vector<ReferenceMatch> expected_data_range = reference_data(data, base, first, last, targets, aligned);
+			const std::vector<ReferenceMatch> expected_code_whole = reference_code(data, base, 0, size, targets);
+			const std::vector<ReferenceMatch> expected_code_range = reference_code(data, base, first, last, targets);
+
+			if(!same(expected_data_whole, data_whole) || !same(expected_data_range, data_range) || !same(expected_code_whole, code_whole) || !same(expected_code_range, code_range)) {
+				test::failure() << "expected " << expected_data_whole.size() << " data references, found " << data_whole.size() << std::endl;
+				std::cout << "expected " << expected_data_range.size() << " data references in [" << first << ", " << last << "), found " << data_range.size() << std::endl;
+				std::cout << "expected " << expected_code_whole.size() << " code references, found " << code_whole.size() << std::endl;
+				std::cout << "expected " << expected_code_range.size() << " code references in [" << first << ", " << last << "), found " << code_range.size() << std::endl;
+				return test::fail();
+			}
+
+			test::ok() << " (" << expected_data_whole.size() << " data, " << expected_code_whole.size() << " code)" << std::endl;
+		}
+	}
+}
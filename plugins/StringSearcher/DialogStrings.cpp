@@ -17,23 +17,176 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "DialogStrings.h"
+#include "IDebuggerCore.h"
+#include "Job.h"
 #include "Debugger.h"
 #include "MemoryRegions.h"
+#include "StringExtractor.h"
+#include "ResultsModel.h"
+#include "ResultsView.h"
 #include "Util.h"
 #include "Configuration.h"
 
 #include <QHeaderView>
 #include <QMessageBox>
 #include <QSortFilterProxyModel>
+#include <QVector>
 
 #include "ui_dialogstrings.h"
 
+namespace {
+
+// regions are read a slice at a time so that searching a huge heap doesn't
+// need a copy of all of it
+const std::size_t slice_size    = 0x4000000;
+
+// how far past the end of a slice a string which starts in it may run, longer
+// ones are cut short there
+const std::size_t slice_overlap = 0x10000;
+
+// only this much of each string is shown
+const int max_display_length = 256;
+
+//------------------------------------------------------------------------------
+// Name: string_text(yad64::address_t address, quint32 length, quint32 flags)
+// Desc: the start of a string as it is shown in the results. the results only
+//       keep where each string is, so this reads it back when it is shown
+//------------------------------------------------------------------------------
+QString string_text(yad64::address_t address, quint32 length, quint32 flags) {
+
+	const StringEncoding encoding =
+		(flags & (1 << ENCODING_UTF16)) ? ENCODING_UTF16 :
+		(flags & (1 << ENCODING_UTF8))  ? ENCODING_UTF8  :
+		ENCODING_ASCII;
+
+	// a UTF-8 character is at most 4 bytes, a UTF-16 one is always 2
+	std::size_t size = length;
+	switch(encoding) {
+	case ENCODING_UTF16: size = qMin<std::size_t>(size, max_display_length * 2); break;
+	case ENCODING_UTF8:  size = qMin<std::size_t>(size, max_display_length * 4); break;
+	default:             size = qMin<std::size_t>(size, max_display_length);     break;
+	}
+
+	quint8 data[max_display_length * 4];
+	if(!yad64::v1::debugger_core || !yad64::v1::debugger_core->read_bytes(address, data, size)) {
+		return QString();
+	}
+
+	QString s = StringExtractor::decode(data, size, encoding);
+	if(length > size) {
+		s.append("...");
+	}
+
+	switch(encoding) {
+	case ENCODING_UTF16: return QString("[UTF16] %1").arg(s);
+	case ENCODING_UTF8:  return QString("[UTF8] %1").arg(s);
+	default:             return s;
+	}
+}
+
+// extracts the strings of one chunk of a slice, for Job::map_chunks
+class ExtractChunk {
+public:
+	typedef FoundStrings result_type;
+
+public:
+	explicit ExtractChunk(const StringExtractor &extractor) : extractor_(&extractor) {
+	}
+
+public:
+	FoundStrings operator()(const Job::Chunk &chunk) const {
+		FoundStrings strings;
+		extractor_->extract(chunk.bytes.constData(), chunk.bytes.size(), chunk.base, chunk.first, chunk.last, strings);
+		return strings;
+	}
+
+private:
+	const StringExtractor *extractor_;
+};
+
+class ExtractJob : public Job {
+public:
+	ExtractJob(const QList<MemoryRegion> &regions, int min_string_length, unsigned int options);
+
+public:
+	virtual void run();
+
+private:
+	const QList<MemoryRegion> regions_;
+	const StringExtractor     extractor_;
+	const yad64::address_t    page_size_;
+};
+
+//------------------------------------------------------------------------------
+// Name: ExtractJob(...)
+// Desc:
+//------------------------------------------------------------------------------
+ExtractJob::ExtractJob(const QList<MemoryRegion> &regions, int min_string_length, unsigned int options) :
+		regions_(regions),
+		extractor_(min_string_length, options),
+		page_size_(yad64::v1::debugger_core->page_size()) {
+}
+
+//------------------------------------------------------------------------------
+// Name: run()
+// Desc: reads the regions in bulk and extracts their strings on all threads
+//------------------------------------------------------------------------------
+void ExtractJob::run() {
+
+	int i = 0;
+	Q_FOREACH(const MemoryRegion &region, regions_) {
+
+		const std::size_t region_size = region.size();
+
+		for(std::size_t slice = 0; slice < region_size; slice += slice_size) {
+
+			if(cancelled()) {
+				return;
+			}
+
+			// start a page early so that a string running in from the
+			// previous slice is recognized as such
+			const std::size_t read_first = slice ? slice - page_size_ : 0;
+			const std::size_t read_last  = qMin(region_size, slice + slice_size + slice_overlap);
+			const std::size_t slice_last = qMin(region_size, slice + slice_size) - read_first;
+
+			const yad64::address_t base  = region.start() + read_first;
+			const QVector<quint8>  pages = read_buffer(base, (read_last - read_first) / page_size_, page_size_);
+
+			if(!pages.isEmpty()) {
+				QList<Chunk> chunks;
+				split_chunks(pages, base, slice - read_first, slice_last, 0, chunks);
+
+				const QList<FoundStrings> results = map_chunks(chunks, ExtractChunk(extractor_));
+
+				ResultStore found;
+				Q_FOREACH(const FoundStrings &strings, results) {
+					Q_FOREACH(const FoundString &string, strings) {
+						found.append(string.address, QString(), 1 << string.encoding, string.length);
+					}
+				}
+
+				report_results(found);
+			}
+
+			set_progress(util::percentage(i, regions_.size(), qMin(region_size, slice + slice_size) / page_size_, region_size / page_size_));
+		}
+
+		++i;
+	}
+
+	set_progress(100);
+}
+
+}
+
 //------------------------------------------------------------------------------
 // Name: DialogStrings(QWidget *parent)
 // Desc:
 //------------------------------------------------------------------------------
 DialogStrings::DialogStrings(QWidget *parent) : QDialog(parent), ui(new Ui::DialogStrings) {
 	ui->setupUi(this);
+	ui->results->model()->set_formatter(string_text);
 	ui->tableView->verticalHeader()->hide();
 	ui->tableView->horizontalHeader()->setResizeMode(QHeaderView::ResizeToContents);
 
@@ -46,19 +199,18 @@ DialogStrings::DialogStrings(QWidget *parent) : QDialog(parent), ui(new Ui::Dial
 // Desc:
 //------------------------------------------------------------------------------
 DialogStrings::~DialogStrings() {
+	if(job_) {
+		job_->cancel();
+	}
 	delete ui;
 }
 
 //------------------------------------------------------------------------------
-// Name: on_listWidget_itemDoubleClicked(QListWidgetItem *item)
+// Name: on_results_doubleClicked(const QModelIndex &index)
 // Desc: follows the found item in the data view
 //------------------------------------------------------------------------------
-void DialogStrings::on_listWidget_itemDoubleClicked(QListWidgetItem *item) {
-	bool ok;
-	const yad64::address_t addr = item->data(Qt::UserRole).toULongLong(&ok);
-	if(ok) {
-		yad64::v1::dump_data(addr, false);
-	}
+void DialogStrings::on_results_doubleClicked(const QModelIndex &index) {
+	yad64::v1::dump_data(ui->results->model()->address(index), false);
 }
 
 //------------------------------------------------------------------------------
@@ -71,82 +223,69 @@ void DialogStrings::showEvent(QShowEvent *) {
 	ui->tableView->setModel(filter_model_);
 
 	ui->progressBar->setValue(0);
-	ui->listWidget->clear();
+	ui->results->model()->clear();
 }
 
 //------------------------------------------------------------------------------
-// Name: do_find()
-// Desc:
+// Name: on_btnFind_clicked()
+// Desc: find button event handler, while a search runs it cancels it instead
 //------------------------------------------------------------------------------
-void DialogStrings::do_find() {
+void DialogStrings::on_btnFind_clicked() {
+
+	if(job_) {
+		job_->cancel();
+		return;
+	}
 
-	const int min_string_length = yad64::v1::config().min_string_length;
+	ui->results->model()->clear();
 
 	const QItemSelectionModel *const selection_model = ui->tableView->selectionModel();
 	const QModelIndexList sel = selection_model->selectedRows();
 
-	QString str;
-
 	if(sel.size() == 0) {
 		QMessageBox::information(
 			this,
 			tr("No Region Selected"),
 			tr("You must select a region which is to be scanned for strings."));
+		return;
 	}
 
+	QList<MemoryRegion> regions;
 	Q_FOREACH(const QModelIndex &selected_item, sel) {
-
 		const QModelIndex index = filter_model_->mapToSource(selected_item);
-
 		if(const MemoryRegion *const region = reinterpret_cast<const MemoryRegion *>(index.internalPointer())) {
+			regions.append(*region);
+		}
+	}
 
-			yad64::address_t start_address     = region->start();
-			const yad64::address_t end_address = region->end();
-			const yad64::address_t orig_start  = start_address;
-
-			// do the search for this region!
-			while(start_address < end_address) {
-
-				int string_length = 0;
-				bool ok = yad64::v1::get_ascii_string_at_address(start_address, str, min_string_length, 256, string_length);
-				if(ok) {
-					QListWidgetItem *const item = new QListWidgetItem(QString("%1: [ASCII] %2").arg(yad64::v1::format_pointer(start_address)).arg(str));
-					item->setData(Qt::UserRole, start_address);
-					ui->listWidget->addItem(item);
-				} else {
-				
-					if(ui->search_unicode->isChecked()) {
-						string_length = 0;
-						ok = yad64::v1::get_utf16_string_at_address(start_address, str, min_string_length, 256, string_length);
-						if(ok) {
-							QListWidgetItem *const item = new QListWidgetItem(QString("%1: [UTF16] %2").arg(yad64::v1::format_pointer(start_address)).arg(str));
-							item->setData(Qt::UserRole, start_address);
-							ui->listWidget->addItem(item);
-						}
-					}
-				}
-
-				ui->progressBar->setValue(util::percentage((start_address - orig_start), region->size()));
+	unsigned int options = 0;
+	if(ui->search_unicode->isChecked()) {
+		options |= StringExtractor::FIND_UTF16;
+	}
 
-				if(ok) {
-					start_address += string_length;
-				} else {
-					++start_address;
-				}
-			}
-		}
+	if(ui->search_utf8->isChecked()) {
+		options |= StringExtractor::FIND_UTF8;
 	}
+
+	job_ = new ExtractJob(regions, yad64::v1::config().min_string_length, options);
+
+	connect(job_, SIGNAL(progress(int)), ui->progressBar, SLOT(setValue(int)));
+	connect(job_, SIGNAL(results(const ResultStore &)), ui->results->model(), SLOT(append(const ResultStore &)));
+	connect(job_, SIGNAL(finished(bool)), this, SLOT(job_finished(bool)));
+
+	ui->progressBar->setValue(0);
+	ui->btnFind->setText(tr("&Cancel"));
+	yad64::v1::submit_job(job_);
 }
 
 //------------------------------------------------------------------------------
-// Name: on_btnFind_clicked()
+// Name: job_finished(bool cancelled)
 // Desc:
 //------------------------------------------------------------------------------
-void DialogStrings::on_btnFind_clicked() {
-	ui->btnFind->setEnabled(false);
-	ui->listWidget->clear();
-	ui->progressBar->setValue(0);
-	do_find();
-	ui->progressBar->setValue(100);
-	ui->btnFind->setEnabled(true);
+void DialogStrings::job_finished(bool cancelled) {
+	job_ = 0;
+	if(!cancelled) {
+		ui->progressBar->setValue(100);
+	}
+	ui->btnFind->setText(tr("&Find"));
 }
@@ -20,9 +20,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define DIALOGSTRINGS_20061101_H_
 
 #include <QDialog>
+#include <QPointer>
 #include "Types.h"
+class Job;
+class QModelIndex;
 class QSortFilterProxyModel;
-class QListWidgetItem;
 
 namespace Ui { class DialogStrings; }
 
@@ -35,17 +37,18 @@ public:
 
 public Q_SLOTS:
 	void on_btnFind_clicked();
-	void on_listWidget_itemDoubleClicked(QListWidgetItem *);
+	void on_results_doubleClicked(const QModelIndex &index);
 
-private:
-	virtual void showEvent(QShowEvent *event);
+private Q_SLOTS:
+	void job_finished(bool cancelled);
 
 private:
-	void do_find();
+	virtual void showEvent(QShowEvent *event);
 
 private:
 	 Ui::DialogStrings *const ui;
 	 QSortFilterProxyModel *  filter_model_;
+	 QPointer<Job>            job_;
 };
 
 #endif
@@ -0,0 +1,432 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "StringExtractor.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+
+// the start of a run which is not open, and of one which started before the
+// bytes being searched (or after them) and so is not reported
+const std::size_t run_closed  = static_cast<std::size_t>(-1);
+const std::size_t run_skipped = static_cast<std::size_t>(-2);
+
+struct Masks {
+	quint64 printable;
+	quint64 high;
+	quint64 zero;
+};
+
+//------------------------------------------------------------------------------
+// Name: is_printable(quint8 ch)
+// Desc: printable characters and whitespace
+//------------------------------------------------------------------------------
+inline bool is_printable(quint8 ch) {
+	return (ch >= 0x20 && ch < 0x7f) || (ch >= 0x09 && ch <= 0x0d);
+}
+
+//------------------------------------------------------------------------------
+// Name: is_unit(const quint8 *data, std::size_t size, std::size_t i)
+// Desc: returns true if there is a printable UTF-16LE code unit at i
+//------------------------------------------------------------------------------
+inline bool is_unit(const quint8 *data, std::size_t size, std::size_t i) {
+	return i + 1 < size && is_printable(data[i]) && data[i + 1] == 0;
+}
+
+inline bool is_open(std::size_t start) {
+	return start != run_closed && start != run_skipped;
+}
+
+inline quint64 low_bits(unsigned int n) {
+	return n ? (~Q_UINT64_C(0) >> (64 - n)) : 0;
+}
+
+//------------------------------------------------------------------------------
+// Name: lowest_bit(quint64 x)
+// Desc: index of the lowest set bit, x must not be 0
+//------------------------------------------------------------------------------
+inline unsigned int lowest_bit(quint64 x) {
+#if defined(__GNUC__)
+	return __builtin_ctzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanForward64(&index, x);
+	return index;
+#elif defined(_MSC_VER)
+	unsigned long index;
+	if(_BitScanForward(&index, static_cast<unsigned long>(x))) {
+		return index;
+	}
+	_BitScanForward(&index, static_cast<unsigned long>(x >> 32));
+	return index + 32;
+#else
+	unsigned int index = 0;
+	while(!(x & 1)) {
+		x >>= 1;
+		++index;
+	}
+	return index;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Name: highest_bit(quint64 x)
+// Desc: index of the highest set bit, x must not be 0
+//------------------------------------------------------------------------------
+inline unsigned int highest_bit(quint64 x) {
+#if defined(__GNUC__)
+	return 63 - __builtin_clzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanReverse64(&index, x);
+	return index;
+#elif defined(_MSC_VER)
+	unsigned long index;
+	if(_BitScanReverse(&index, static_cast<unsigned long>(x >> 32))) {
+		return index + 32;
+	}
+	_BitScanReverse(&index, static_cast<unsigned long>(x));
+	return index;
+#else
+	unsigned int index = 63;
+	while(!(x & (Q_UINT64_C(1) << 63))) {
+		x <<= 1;
+		--index;
+	}
+	return index;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Name: utf8_sequence(const quint8 *p, std::size_t size)
+// Desc: returns the size of the printable UTF-8 sequence at p, or 0 if there
+//       isn't one. overlong forms, surrogates and C1 controls are rejected
+//------------------------------------------------------------------------------
+std::size_t utf8_sequence(const quint8 *p, std::size_t size) {
+
+	const quint8 lead = p[0];
+
+	if(lead < 0x80) {
+		return is_printable(lead) ? 1 : 0;
+	}
+
+	std::size_t length;
+	quint8 lowest  = 0x80;
+	quint8 highest = 0xbf;
+
+	if(lead < 0xc2) {
+		return 0;
+	} else if(lead < 0xe0) {
+		length = 2;
+		if(lead == 0xc2) {
+			lowest = 0xa0;
+		}
+	} else if(lead < 0xf0) {
+		length = 3;
+		if(lead == 0xe0) {
+			lowest = 0xa0;
+		} else if(lead == 0xed) {
+			highest = 0x9f;
+		}
+	} else if(lead < 0xf5) {
+		length = 4;
+		if(lead == 0xf0) {
+			lowest = 0x90;
+		} else if(lead == 0xf4) {
+			highest = 0x8f;
+		}
+	} else {
+		return 0;
+	}
+
+	if(size < length || p[1] < lowest || p[1] > highest) {
+		return 0;
+	}
+
+	for(std::size_t i = 2; i < length; ++i) {
+		if((p[i] & 0xc0) != 0x80) {
+			return 0;
+		}
+	}
+
+	return length;
+}
+
+//------------------------------------------------------------------------------
+// Name: classify(const quint8 *p, std::size_t n, Masks &masks)
+// Desc: one bit per byte for up to 64 bytes, bits past n are clear
+//------------------------------------------------------------------------------
+void classify(const quint8 *p, std::size_t n, Masks &masks) {
+
+	masks.printable = 0;
+	masks.high      = 0;
+	masks.zero      = 0;
+
+#if defined(__SSE2__)
+	if(n == 64) {
+		// SSE2 only has signed byte compares, so bias everything by 0x80
+		const __m128i bias     = _mm_set1_epi8(static_cast<char>(0x80));
+		const __m128i print_lo = _mm_set1_epi8(static_cast<char>(0x1f ^ 0x80));
+		const __m128i print_hi = _mm_set1_epi8(static_cast<char>(0x7f ^ 0x80));
+		const __m128i space_lo = _mm_set1_epi8(static_cast<char>(0x08 ^ 0x80));
+		const __m128i space_hi = _mm_set1_epi8(static_cast<char>(0x0e ^ 0x80));
+		const __m128i zero     = _mm_setzero_si128();
+
+		for(int i = 0; i < 4; ++i) {
+			const __m128i bytes     = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i * 16));
+			const __m128i biased    = _mm_xor_si128(bytes, bias);
+			const __m128i printable = _mm_or_si128(
+				_mm_and_si128(_mm_cmpgt_epi8(biased, print_lo), _mm_cmplt_epi8(biased, print_hi)),
+				_mm_and_si128(_mm_cmpgt_epi8(biased, space_lo), _mm_cmplt_epi8(biased, space_hi)));
+
+			masks.printable |= static_cast<quint64>(static_cast<quint16>(_mm_movemask_epi8(printable))) << (i * 16);
+			masks.high      |= static_cast<quint64>(static_cast<quint16>(_mm_movemask_epi8(bytes))) << (i * 16);
+			masks.zero      |= static_cast<quint64>(static_cast<quint16>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, zero)))) << (i * 16);
+		}
+		return;
+	}
+#endif
+
+	for(std::size_t i = 0; i < n; ++i) {
+		const quint64 bit = Q_UINT64_C(1) << i;
+		if(is_printable(p[i])) {
+			masks.printable |= bit;
+		} else if(p[i] >= 0x80) {
+			masks.high |= bit;
+		} else if(p[i] == 0) {
+			masks.zero |= bit;
+		}
+	}
+}
+
+bool string_less_than(const FoundString &a, const FoundString &b) {
+	if(a.address != b.address) {
+		return a.address < b.address;
+	}
+	return a.encoding < b.encoding;
+}
+
+}
+
+//------------------------------------------------------------------------------
+// Name: StringExtractor(int min_length, unsigned int options)
+// Desc: ASCII strings are always found, options says which others to find
+//------------------------------------------------------------------------------
+StringExtractor::StringExtractor(int min_length, unsigned int options) : min_length_(qMax(min_length, 1)), options_(options) {
+}
+
+//------------------------------------------------------------------------------
+// Name: decode(const quint8 *data, std::size_t size, StringEncoding encoding)
+// Desc: converts a string found by extract for display, with the characters
+//       which need an escape char escaped
+//------------------------------------------------------------------------------
+QString StringExtractor::decode(const quint8 *data, std::size_t size, StringEncoding encoding) {
+
+	QString s;
+
+	switch(encoding) {
+	case ENCODING_UTF16:
+		do {
+			QVector<ushort> units(size / 2);
+			if(!units.empty()) {
+				std::memcpy(&units[0], data, units.size() * sizeof(ushort));
+			}
+			s = QString::fromUtf16(units.constData(), units.size());
+		} while(0);
+		break;
+	case ENCODING_UTF8:
+		s = QString::fromUtf8(reinterpret_cast<const char *>(data), size);
+		break;
+	default:
+		s = QString::fromLatin1(reinterpret_cast<const char *>(data), size);
+		break;
+	}
+
+	s.replace("\r", "\\r");
+	s.replace("\n", "\\n");
+	s.replace("\t", "\\t");
+	s.replace("\v", "\\v");
+	s.replace("\"", "\\\"");
+	return s;
+}
+
+//------------------------------------------------------------------------------
+// Name: add_string(std::size_t first, std::size_t last, std::size_t length, StringEncoding encoding, yad64::address_t base, FoundStrings &strings) const
+// Desc: adds the string in [first, last) if it has enough characters
+//------------------------------------------------------------------------------
+void StringExtractor::add_string(std::size_t first, std::size_t last, std::size_t length, StringEncoding encoding, yad64::address_t base, FoundStrings &strings) const {
+	if(length >= min_length_) {
+		const FoundString string = { base + first, static_cast<quint32>(last - first), encoding };
+		strings.append(string);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: add_text(const quint8 *data, std::size_t first, std::size_t last, bool high, yad64::address_t base, FoundStrings &strings) const
+// Desc: adds a run of text bytes. a run with no bytes above 0x7f is ASCII,
+//       otherwise it is split at every byte which isn't part of valid UTF-8
+//       and each piece is UTF-8 if it has a multibyte character in it
+//------------------------------------------------------------------------------
+void StringExtractor::add_text(const quint8 *data, std::size_t first, std::size_t last, bool high, yad64::address_t base, FoundStrings &strings) const {
+
+	if(!high) {
+		add_string(first, last, last - first, ENCODING_ASCII, base, strings);
+		return;
+	}
+
+	std::size_t start     = first;
+	std::size_t length    = 0;
+	bool        multibyte = false;
+
+	for(std::size_t i = first; i < last; ) {
+		const std::size_t n = utf8_sequence(data + i, last - i);
+		if(n == 0) {
+			add_string(start, i, length, multibyte ? ENCODING_UTF8 : ENCODING_ASCII, base, strings);
+			start     = ++i;
+			length    = 0;
+			multibyte = false;
+		} else {
+			multibyte = multibyte || n > 1;
+			++length;
+			i += n;
+		}
+	}
+
+	add_string(start, last, length, multibyte ? ENCODING_UTF8 : ENCODING_ASCII, base, strings);
+}
+
+//------------------------------------------------------------------------------
+// Name: extract(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t first, std::size_t last, FoundStrings &strings) const
+// Desc: a run of text bytes (printable ASCII, plus anything above 0x7f when
+//       looking for UTF-8) starts where a text bit follows a clear one and
+//       stops at the next clear bit. UTF-16 runs are the same, but over the
+//       printable-followed-by-zero bits and two bytes apart, so each byte
+//       parity has a run of its own
+//------------------------------------------------------------------------------
+void StringExtractor::extract(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t first, std::size_t last, FoundStrings &strings) const {
+
+	last = qMin(last, size);
+	if(first >= last) {
+		return;
+	}
+
+	const bool utf8  = options_ & FIND_UTF8;
+	const bool utf16 = options_ & FIND_UTF16;
+	const int  found = strings.size();
+
+	// runs which are already open at first belong to whoever searches the
+	// bytes before it
+	const bool text_before = first > 0 && (is_printable(data[first - 1]) || (utf8 && data[first - 1] >= 0x80));
+
+	quint64     text_carry = text_before ? 1 : 0;
+	std::size_t text_start = text_before ? run_skipped : run_closed;
+	std::size_t last_high  = run_closed;
+
+	quint64     unit_carry    = 0;
+	std::size_t unit_start[2] = { run_closed, run_closed };
+
+	if(utf16) {
+		if(first >= 2 && is_unit(data, size, first - 2)) {
+			unit_carry |= 1;
+			unit_start[first & 1] = run_skipped;
+		}
+
+		if(first >= 1 && is_unit(data, size, first - 1)) {
+			unit_carry |= 2;
+			unit_start[(first - 1) & 1] = run_skipped;
+		}
+	}
+
+	for(std::size_t offset = first; ; offset += 64) {
+
+		const std::size_t n = (offset < size) ? qMin<std::size_t>(64, size - offset) : 0;
+
+		Masks masks;
+		classify(data + offset, n, masks);
+
+		const quint64 high = utf8 ? masks.high : 0;
+		const quint64 text = masks.printable | high;
+
+		quint64 events = text ^ ((text << 1) | text_carry);
+		while(events) {
+			const unsigned int bit = lowest_bit(events);
+			const std::size_t  pos = offset + bit;
+			events &= events - 1;
+
+			if(text & (Q_UINT64_C(1) << bit)) {
+				text_start = (pos < last) ? pos : run_skipped;
+			} else {
+				if(text_start != run_skipped) {
+					const bool has_high = (high & low_bits(bit)) || (last_high != run_closed && last_high >= text_start);
+					add_text(data, text_start, pos, has_high, base, strings);
+				}
+				text_start = run_closed;
+			}
+		}
+
+		if(high) {
+			last_high = offset + highest_bit(high);
+		}
+
+		text_carry = text >> 63;
+
+		if(utf16) {
+			const bool    next_zero = n == 64 && offset + 64 < size && data[offset + 64] == 0;
+			const quint64 unit      = masks.printable & ((masks.zero >> 1) | (next_zero ? Q_UINT64_C(1) << 63 : 0));
+
+			quint64 events = unit ^ ((unit << 2) | unit_carry);
+			while(events) {
+				const unsigned int bit    = lowest_bit(events);
+				const std::size_t  pos    = offset + bit;
+				const int          parity = pos & 1;
+				events &= events - 1;
+
+				if(unit & (Q_UINT64_C(1) << bit)) {
+					unit_start[parity] = (pos < last) ? pos : run_skipped;
+				} else {
+					if(unit_start[parity] != run_skipped) {
+						add_string(unit_start[parity], pos, (pos - unit_start[parity]) / 2, ENCODING_UTF16, base, strings);
+					}
+					unit_start[parity] = run_closed;
+				}
+			}
+
+			unit_carry = unit >> 62;
+		}
+
+		if(n < 64) {
+			break;
+		}
+
+		if(offset + 64 >= last && !is_open(text_start) && !is_open(unit_start[0]) && !is_open(unit_start[1])) {
+			break;
+		}
+	}
+
+	std::sort(strings.begin() + found, strings.end(), string_less_than);
+}
@@ -0,0 +1,73 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef STRING_EXTRACTOR_20121017_H_
+#define STRING_EXTRACTOR_20121017_H_
+
+#include "Types.h"
+
+#include <QString>
+#include <QVector>
+
+enum StringEncoding {
+	ENCODING_ASCII,
+	ENCODING_UTF16,
+	ENCODING_UTF8
+};
+
+struct FoundString {
+	yad64::address_t address;
+	quint32          length;   // in bytes
+	quint32          encoding; // a StringEncoding
+};
+
+typedef QVector<FoundString> FoundStrings;
+
+// finds ASCII, UTF-16LE and UTF-8 strings in a single pass over a buffer.
+// bytes are classified 64 at a time (16 at a time with SSE2) into bit masks
+// and strings are read off the boundaries of the runs in those masks, so the
+// common case of data which is not text costs a few instructions per byte
+class StringExtractor {
+public:
+	enum {
+		FIND_UTF16 = 0x01,
+		FIND_UTF8  = 0x02
+	};
+
+public:
+	StringExtractor(int min_length, unsigned int options);
+
+public:
+	static QString decode(const quint8 *data, std::size_t size, StringEncoding encoding);
+
+public:
+	// finds every string of at least min_length characters which starts in
+	// [first, last), bytes past last are only used to complete them. data is
+	// assumed to be mapped at base. strings are appended sorted by address
+	void extract(const quint8 *data, std::size_t size, yad64::address_t base, std::size_t first, std::size_t last, FoundStrings &strings) const;
+
+private:
+	void add_text(const quint8 *data, std::size_t first, std::size_t last, bool high, yad64::address_t base, FoundStrings &strings) const;
+	void add_string(std::size_t first, std::size_t last, std::size_t length, StringEncoding encoding, yad64::address_t base, FoundStrings &strings) const;
+
+private:
+	std::size_t  min_length_;
+	unsigned int options_;
+};
+
+#endif
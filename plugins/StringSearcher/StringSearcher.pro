@@ -1,7 +1,9 @@
 
 include(../plugins.pri)
 
+DEFINES += USE_QT_CONCURRENT
+
 # Input
-HEADERS += StringSearcher.h DialogStrings.h
+HEADERS += StringSearcher.h DialogStrings.h StringExtractor.h
 FORMS += dialogstrings.ui
-SOURCES += StringSearcher.cpp DialogStrings.cpp
+SOURCES += StringSearcher.cpp DialogStrings.cpp StringExtractor.cpp
@@ -0,0 +1,277 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "StringExtractor.h"
+#include "TestUtil.h"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+// compares StringExtractor against a byte at a time reference, over the whole
+// buffer at once and over random chunkings of it
+
+namespace {
+
+
+using test::bytes_t;
+using test::next_random;
+
+bool is_printable(quint8 ch) {
+	return (ch >= 0x20 && ch < 0x7f) || (ch >= 0x09 && ch <= 0x0d);
+}
+
+//------------------------------------------------------------------------------
+// Name: utf8_length(const quint8 *p, std::size_t size)
+// Desc: decodes the code point at p the long way, returns the size of its
+//       sequence if it is valid, shortest form, not a surrogate and not a C0
+//       or C1 control (whitespace aside), otherwise 0
+//------------------------------------------------------------------------------
+std::size_t utf8_length(const quint8 *p, std::size_t size) {
+
+	if(p[0] < 0x80) {
+		return is_printable(p[0]) ? 1 : 0;
+	}
+
+	std::size_t length;
+	quint32 cp;
+	quint32 minimum;
+
+	if((p[0] & 0xe0) == 0xc0) {
+		length = 2; cp = p[0] & 0x1f; minimum = 0x80;
+	} else if((p[0] & 0xf0) == 0xe0) {
+		length = 3; cp = p[0] & 0x0f; minimum = 0x800;
+	} else if((p[0] & 0xf8) == 0xf0) {
+		length = 4; cp = p[0] & 0x07; minimum = 0x10000;
+	} else {
+		return 0;
+	}
+
+	if(size < length) {
+		return 0;
+	}
+
+	for(std::size_t i = 1; i < length; ++i) {
+		if((p[i] & 0xc0) != 0x80) {
+			return 0;
+		}
+		cp = (cp << 6) | (p[i] & 0x3f);
+	}
+
+	if(cp < minimum || cp > 0x10ffff || (cp >= 0xd800 && cp <= 0xdfff) || cp < 0xa0) {
+		return 0;
+	}
+
+	return length;
+}
+
+void add(std::vector<FoundString> &strings, std::size_t first, std::size_t last, std::size_t length, StringEncoding encoding, int min_length) {
+	if(length >= static_cast<std::size_t>(std::max(min_length, 1))) {
+		const FoundString string = { first, static_cast<quint32>(last - first), encoding };
+		strings.push_back(string);
+	}
+}
+
+bool string_less_than(const FoundString &a, const FoundString &b) {
+	if(a.address != b.address) {
+		return a.address < b.address;
+	}
+	return a.encoding < b.encoding;
+}
+
+//------------------------------------------------------------------------------
+// Name: reference(const bytes_t &data, int min_length, unsigned int options)
+// Desc: every maximal run of text bytes, split at bytes which aren't valid
+//       UTF-8 if it has high bytes in it, and every maximal run of printable
+//       UTF-16LE units at each byte parity
+//------------------------------------------------------------------------------
+std::vector<FoundString> reference(const bytes_t &data, int min_length, unsigned int options) {
+
+	const bool utf8  = options & StringExtractor::FIND_UTF8;
+	const bool utf16 = options & StringExtractor::FIND_UTF16;
+
+	std::vector<FoundString> strings;
+
+	for(std::size_t i = 0; i < data.size(); ) {
+		if(!is_printable(data[i]) && !(utf8 && data[i] >= 0x80)) {
+			++i;
+			continue;
+		}
+
+		std::size_t end  = i;
+		bool        high = false;
+		while(end < data.size() && (is_printable(data[end]) || (utf8 && data[end] >= 0x80))) {
+			high = high || data[end] >= 0x80;
+			++end;
+		}
+
+		if(!high) {
+			add(strings, i, end, end - i, ENCODING_ASCII, min_length);
+		} else {
+			std::size_t start     = i;
+			std::size_t length    = 0;
+			bool        multibyte = false;
+			for(std::size_t j = i; j < end; ) {
+				const std::size_t n = utf8_length(&data[j], end - j);
+				if(n == 0) {
+					add(strings, start, j, length, multibyte ? ENCODING_UTF8 : ENCODING_ASCII, min_length);
+					start     = ++j;
+					length    = 0;
+					multibyte = false;
+				} else {
+					multibyte = multibyte || n > 1;
+					++length;
+					j += n;
+				}
+			}
+			add(strings, start, end, length, multibyte ? ENCODING_UTF8 : ENCODING_ASCII, min_length);
+		}
+
+		i = end;
+	}
+
+	if(utf16) {
+		for(std::size_t parity = 0; parity < 2; ++parity) {
+			for(std::size_t i = parity; i + 1 < data.size(); ) {
+				std::size_t end = i;
+				while(end + 1 < data.size() && is_printable(data[end]) && data[end + 1] == 0) {
+					end += 2;
+				}
+
+				if(end != i) {
+					add(strings, i, end, (end - i) / 2, ENCODING_UTF16, min_length);
+					i = end;
+				} else {
+					i += 2;
+				}
+			}
+		}
+	}
+
+	std::sort(strings.begin(), strings.end(), string_less_than);
+	return strings;
+}
+
+//------------------------------------------------------------------------------
+// Name: make_data(std::size_t size)
+// Desc: something like a heap, binary noise with ASCII, UTF-8 and UTF-16
+//       strings and runs of zeros in it
+//------------------------------------------------------------------------------
+bytes_t make_data(std::size_t size) {
+	static const char *const utf8_samples[] = {
+		"\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80", "\xc2\x85", "\xed\xa0\x80", "\xe0\x80\xaf", "\xf4\x90\x80\x80", "\xc2\xa0"
+	};
+
+	bytes_t data;
+	while(data.size() < size) {
+		const quint32 r     = next_random();
+		const std::size_t n = 1 + next_random() % 40;
+
+		switch(r % 6) {
+		case 0:
+			for(std::size_t i = 0; i < n; ++i) {
+				data.push_back(static_cast<quint8>(next_random()));
+			}
+			break;
+		case 1:
+			for(std::size_t i = 0; i < n; ++i) {
+				data.push_back(static_cast<quint8>(0x20 + next_random() % 0x5f));
+			}
+			break;
+		case 2:
+			for(std::size_t i = 0; i < n; ++i) {
+				data.push_back(static_cast<quint8>(0x20 + next_random() % 0x5f));
+				data.push_back(0);
+			}
+			break;
+		case 3:
+			for(std::size_t i = 0; i < n; ++i) {
+				const char *const p = utf8_samples[next_random() % (sizeof(utf8_samples) / sizeof(utf8_samples[0]))];
+				data.insert(data.end(), p, p + std::char_traits<char>::length(p));
+				if(next_random() & 1) {
+					data.push_back(static_cast<quint8>('a' + next_random() % 26));
+				}
+			}
+			break;
+		case 4:
+			data.insert(data.end(), n, 0);
+			break;
+		default:
+			data.push_back(static_cast<quint8>("\t\n\r \x7f\x80\xff"[next_random() % 7]));
+			break;
+		}
+	}
+
+	data.resize(size);
+	return data;
+}
+
+bool same(const std::vector<FoundString> &a, const FoundStrings &b) {
+	if(a.size() != static_cast<std::size_t>(b.size())) {
+		return false;
+	}
+
+	for(std::size_t i = 0; i < a.size(); ++i) {
+		if(a[i].address != b[i].address || a[i].length != b[i].length || a[i].encoding != b[i].encoding) {
+			return false;
+		}
+	}
+	return true;
+}
+
+}
+
+int main() {
+	static const unsigned int options[] = {
+		0,
+		StringExtractor::FIND_UTF16,
+		StringExtractor::FIND_UTF8,
+		StringExtractor::FIND_UTF16 | StringExtractor::FIND_UTF8
+	};
+
+	for(int round = 0; round < 64; ++round) {
+		const bytes_t data = make_data(1 + next_random() % 8192);
+
+		for(std::size_t o = 0; o < sizeof(options) / sizeof(options[0]); ++o) {
+			for(int min_length = 1; min_length <= 6; ++min_length) {
+
+				test::performing() << "round " << round << " (options " << options[o] << ", min length " << min_length << ")" << test::ellipsis;
+
+				const std::vector<FoundString> expected = reference(data, min_length, options[o]);
+				const StringExtractor extractor(min_length, options[o]);
+
+				FoundStrings whole;
+				extractor.extract(&data[0], data.size(), 0, 0, data.size(), whole);
+
+				// chunk boundaries anywhere, including inside strings
+				FoundStrings chunked;
+				for(std::size_t first = 0; first < data.size(); ) {
+					const std::size_t last = std::min(data.size(), first + 1 + next_random() % 300);
+					extractor.extract(&data[0], data.size(), 0, first, last, chunked);
+					first = last;
+				}
+
+				if(!same(expected, whole) || !same(expected, chunked)) {
+					test::failure() << "expected " << expected.size() << " strings, found " << whole.size() << " in one go and " << chunked.size() << " in chunks" << std::endl;
+					return test::fail();
+				}
+
+				test::ok() << std::endl;
+			}
+		}
+	}
+}
@@ -0,0 +1,101 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ControlFlowGraph.h"
+
+#include <QtAlgorithms>
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Name: start_less(yad64::address_t address, const ControlFlowGraph::Block &block)
+// Desc: ordering for qUpperBound over the blocks
+//------------------------------------------------------------------------------
+bool start_less(yad64::address_t address, const ControlFlowGraph::Block &block) {
+	return address < block.start;
+}
+
+//------------------------------------------------------------------------------
+// Name: from_less(const ControlFlowGraph::Edge &lhs, const ControlFlowGraph::Edge &rhs)
+// Desc:
+//------------------------------------------------------------------------------
+bool from_less(const ControlFlowGraph::Edge &lhs, const ControlFlowGraph::Edge &rhs) {
+	return lhs.from < rhs.from;
+}
+
+}
+
+//------------------------------------------------------------------------------
+// Name: ControlFlowGraph()
+// Desc:
+//------------------------------------------------------------------------------
+ControlFlowGraph::ControlFlowGraph() {
+}
+
+//------------------------------------------------------------------------------
+// Name: ControlFlowGraph(const QVector<Block> &blocks, const QVector<Edge> &edges)
+// Desc: the blocks must be sorted by address
+//------------------------------------------------------------------------------
+ControlFlowGraph::ControlFlowGraph(const QVector<Block> &blocks, const QVector<Edge> &edges) : blocks_(blocks), edges_(edges) {
+
+	qStableSort(edges_.begin(), edges_.end(), from_less);
+
+	for(int i = 0; i < blocks_.size(); ++i) {
+		blocks_[i].first_successor   = 0;
+		blocks_[i].successor_count   = 0;
+		blocks_[i].first_predecessor = 0;
+		blocks_[i].predecessor_count = 0;
+	}
+
+	for(int i = 0; i < edges_.size(); ++i) {
+		Block &from = blocks_[edges_[i].from];
+		if(from.successor_count++ == 0) {
+			from.first_successor = i;
+		}
+		++blocks_[edges_[i].to].predecessor_count;
+	}
+
+	// a counting sort of the edges by the block they enter
+	int first = 0;
+	for(int i = 0; i < blocks_.size(); ++i) {
+		blocks_[i].first_predecessor = first;
+		first += blocks_[i].predecessor_count;
+	}
+
+	QVector<int> next(blocks_.size());
+	for(int i = 0; i < blocks_.size(); ++i) {
+		next[i] = blocks_[i].first_predecessor;
+	}
+
+	predecessors_.resize(edges_.size());
+	for(int i = 0; i < edges_.size(); ++i) {
+		predecessors_[next[edges_[i].to]++] = i;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: find_block(yad64::address_t address) const
+// Desc: returns the index of the block containing address, or -1
+//------------------------------------------------------------------------------
+int ControlFlowGraph::find_block(yad64::address_t address) const {
+	QVector<Block>::const_iterator it = qUpperBound(blocks_.begin(), blocks_.end(), address, start_less);
+	if(it != blocks_.begin() && address < (--it)->end) {
+		return it - blocks_.begin();
+	}
+	return -1;
+}
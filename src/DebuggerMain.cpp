@@ -48,6 +48,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <QFileInfo>
 #include <QHBoxLayout>
 #include <QInputDialog>
+#include <QLabel>
 #include <QMessageBox>
 #include <QSettings>
 #include <QShortcut>
@@ -192,6 +193,7 @@ private:
 // Desc: constructor
 //------------------------------------------------------------------------------
 DebuggerMain::DebuggerMain(QWidget *parent) : DebuggerUI(parent),
+		cache_label_(new QLabel(this)),
 		arguments_dialog_(new DialogArguments),
 		timer_(new QTimer(this)),
 		recent_file_manager_(new RecentFileManager(this)),
@@ -219,6 +221,9 @@ DebuggerMain::DebuggerMain(QWidget *parent) : DebuggerUI(parent),
 	list_model_ = new QStringListModel(this);
 	ui->listView->setModel(list_model_);
 
+	// memory cache statistics live permanently on the right of the status bar
+	ui->statusbar->addPermanentWidget(cache_label_);
+
 	// setup the recent file manager
 	ui->action_Recent_Files->setMenu(recent_file_manager_->create_menu());
 	connect(recent_file_manager_, SIGNAL(file_selected(const QString &)), SLOT(open_file(const QString &)));
@@ -1560,10 +1565,26 @@ void DebuggerMain::update_gui() {
 		update_cpu_view(state, region);
 		update_data_views();
 		update_stack_view(state);
+		update_cache_status();
 		yad64::v1::arch_processor().update_register_view(region.name());
 	}
 }
 
+//------------------------------------------------------------------------------
+// Name: update_cache_status()
+// Desc: shows the debugger core's memory cache hit/miss counts in the status bar
+//------------------------------------------------------------------------------
+void DebuggerMain::update_cache_status() {
+	const quint64 hits   = yad64::v1::debugger_core->memory_cache_hits();
+	const quint64 misses = yad64::v1::debugger_core->memory_cache_misses();
+
+	if(hits + misses != 0) {
+		cache_label_->setText(tr("Memory Cache: %1 hits / %2 misses").arg(hits).arg(misses));
+	} else {
+		cache_label_->clear();
+	}
+}
+
 //------------------------------------------------------------------------------
 // Name: resume_status(bool pass_exception)
 // Desc:
@@ -1711,6 +1732,10 @@ void DebuggerMain::cleanup_debugger() {
 
 	timer_->stop();
 
+	if(QObject *const notifier = yad64::v1::debugger_core ? yad64::v1::debugger_core->event_notifier() : 0) {
+		disconnect(notifier, SIGNAL(debug_event_ready()), this, SLOT(next_debug_event()));
+	}
+
 	yad64::v1::memory_regions().clear();
 	yad64::v1::symbol_manager().clear();
 	yad64::v1::arch_processor().reset();
@@ -1772,7 +1797,13 @@ void DebuggerMain::detach_from_process(DETACH_ACTION kill) {
 void DebuggerMain::set_initial_debugger_state() {
 
 	update_menu_state(PAUSED);
-	timer_->start(0);
+
+	// if the core can tell us when something happens, there is no need to poll
+	if(QObject *const notifier = yad64::v1::debugger_core->event_notifier()) {
+		connect(notifier, SIGNAL(debug_event_ready()), this, SLOT(next_debug_event()), Qt::UniqueConnection);
+	} else {
+		timer_->start(0);
+	}
 
 	yad64::v1::symbol_manager().load_symbols(yad64::v1::config().symbol_path);
 	yad64::v1::memory_regions().sync();
@@ -2264,9 +2295,11 @@ void DebuggerMain::next_debug_event() {
 	
 		last_event_ = e;
 
-		// TODO: figure out a way to do this less often, if they map an obscene 
-		// number of regions, this really slows things down
-		yad64::v1::memory_regions().sync();
+		// if they map an obscene number of regions, re-reading the map slows
+		// things down a lot, so only do it if the core thinks it changed
+		if(yad64::v1::debugger_core->memory_map_changed()) {
+			yad64::v1::memory_regions().sync();
+		}
 
 		// TODO: make the system use this information, this is huge! it will 
 		// allow us to have restorable breakpoints...even in libraries!
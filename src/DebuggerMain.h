@@ -33,6 +33,7 @@ class IPlugin;
 class DialogArguments;
 class RecentFileManager;
 
+class QLabel;
 class QStringListModel;
 class QTimer;
 class QToolButton;
@@ -197,6 +198,7 @@ private:
 	void test_native_binary();
 	void update_cpu_view(const State &state, MemoryRegion &region);
 	void update_data_views();
+	void update_cache_status();
 	void update_disassembly(yad64::address_t address, const MemoryRegion &r);
 	void update_stack_view(const State &state);
 	void update_tab_caption(const QSharedPointer<QHexView> &view, yad64::address_t start, yad64::address_t end);
@@ -227,6 +229,7 @@ private:
 private:
 	QSharedPointer<QHexView>                         stack_view_;
 	QStringListModel *                               list_model_;
+	QLabel *                                         cache_label_;
 	DialogArguments *                                arguments_dialog_;
 	QTimer *                                         timer_;
 	RecentFileManager *                              recent_file_manager_;
@@ -0,0 +1,342 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Job.h"
+#include "Debugger.h"
+#include "IDebuggerCore.h"
+
+#include <QCoreApplication>
+#include <QEvent>
+#include <QMessageBox>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QRunnable>
+#include <QSharedPointer>
+#include <QThread>
+#include <QThreadPool>
+#include <QWaitCondition>
+
+#include <new>
+
+namespace {
+
+// progress is reported at most this often (in milliseconds), about 30 times a
+// second, no matter how often a job updates it
+const int progress_interval = 33;
+
+// how long a job waits for a read before looking to see if it was cancelled
+const unsigned long read_poll_interval = 50;
+
+const QEvent::Type read_event_type  = static_cast<QEvent::Type>(QEvent::registerEventType());
+const QEvent::Type error_event_type = static_cast<QEvent::Type>(QEvent::registerEventType());
+
+enum ReadState {
+	READ_PENDING,
+	READ_RUNNING,
+	READ_DONE,
+	READ_ABANDONED
+};
+
+// the job owns buf, so it may only be written to while the job waits for the
+// read, a pending read which is abandoned is never started
+struct ReadRequest {
+	yad64::address_t address;
+	void *           buf;
+	std::size_t      count;
+	bool             pages;
+	bool             ok;
+	ReadState        state;
+};
+
+QMutex         read_mutex;
+QWaitCondition read_finished;
+
+class ReadEvent : public QEvent {
+public:
+	explicit ReadEvent(const QSharedPointer<ReadRequest> &request) : QEvent(read_event_type), request(request) {
+	}
+
+public:
+	QSharedPointer<ReadRequest> request;
+};
+
+class ErrorEvent : public QEvent {
+public:
+	ErrorEvent(const QString &title, const QString &message) : QEvent(error_event_type), title(title), message(message) {
+	}
+
+public:
+	QString title;
+	QString message;
+};
+
+// lives on the GUI thread, which is the one that attached to the process, and
+// does the things for a job which it may not do on its own thread
+class JobServer : public QObject {
+public:
+	JobServer() {
+		moveToThread(QCoreApplication::instance()->thread());
+	}
+
+public:
+	virtual bool event(QEvent *e) {
+		if(e->type() == read_event_type) {
+			ReadRequest *const request = static_cast<ReadEvent *>(e)->request.data();
+
+			{
+				QMutexLocker locker(&read_mutex);
+				if(request->state == READ_ABANDONED) {
+					return true;
+				}
+				request->state = READ_RUNNING;
+			}
+
+			bool ok = false;
+			if(IDebuggerCore *const core = yad64::v1::debugger_core) {
+				if(request->pages) {
+					ok = core->read_pages(request->address, request->buf, request->count);
+				} else {
+					ok = core->read_bytes(request->address, request->buf, request->count);
+				}
+			}
+
+			QMutexLocker locker(&read_mutex);
+			request->ok    = ok;
+			request->state = READ_DONE;
+			read_finished.wakeAll();
+			return true;
+		}
+
+		if(e->type() == error_event_type) {
+			const ErrorEvent *const error = static_cast<ErrorEvent *>(e);
+			QMessageBox::information(0, error->title, error->message);
+			return true;
+		}
+
+		return QObject::event(e);
+	}
+};
+
+Q_GLOBAL_STATIC(JobServer, job_server)
+Q_GLOBAL_STATIC(QThreadPool, job_pool)
+
+class JobRunner : public QRunnable {
+public:
+	explicit JobRunner(Job *job) : job_(job) {
+	}
+
+public:
+	virtual void run() {
+		job_->execute();
+	}
+
+private:
+	Job *const job_;
+};
+
+}
+
+const std::size_t Job::chunk_size;
+
+//------------------------------------------------------------------------------
+// Name: Job()
+// Desc: constructor
+//------------------------------------------------------------------------------
+Job::Job() : cancelled_(0), progress_(-1) {
+	qRegisterMetaType<ResultStore>("ResultStore");
+}
+
+//------------------------------------------------------------------------------
+// Name: ~Job()
+// Desc:
+//------------------------------------------------------------------------------
+Job::~Job() {
+}
+
+//------------------------------------------------------------------------------
+// Name: cancelled()
+// Desc:
+//------------------------------------------------------------------------------
+bool Job::cancelled() const {
+	return cancelled_ != 0;
+}
+
+//------------------------------------------------------------------------------
+// Name: cancel()
+// Desc: asks the job to stop, it finishes as soon as run() notices
+//------------------------------------------------------------------------------
+void Job::cancel() {
+	cancelled_.fetchAndStoreOrdered(1);
+}
+
+//------------------------------------------------------------------------------
+// Name: execute()
+// Desc: runs the job on the current (worker) thread
+//------------------------------------------------------------------------------
+void Job::execute() {
+	progress_time_.start();
+	run();
+	Q_EMIT finished(cancelled());
+	deleteLater();
+}
+
+//------------------------------------------------------------------------------
+// Name: set_progress(int percent)
+// Desc: updates are dropped if the last one was too recent, except for the
+//       last one, so a job may call this as often as it likes
+//------------------------------------------------------------------------------
+void Job::set_progress(int percent) {
+	if(percent != progress_ && (percent >= 100 || progress_time_.elapsed() >= progress_interval)) {
+		progress_ = percent;
+		progress_time_.restart();
+		Q_EMIT progress(percent);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: report_results(const ResultStore &found)
+// Desc:
+//------------------------------------------------------------------------------
+void Job::report_results(const ResultStore &found) {
+	if(!found.empty()) {
+		Q_EMIT results(found);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: report_error(const QString &title, const QString &message)
+// Desc: shows a message box on the GUI thread, the job carries on
+//------------------------------------------------------------------------------
+void Job::report_error(const QString &title, const QString &message) {
+	QCoreApplication::postEvent(job_server(), new ErrorEvent(title, message));
+}
+
+//------------------------------------------------------------------------------
+// Name: read_bytes(yad64::address_t address, void *buf, std::size_t len)
+// Desc:
+//------------------------------------------------------------------------------
+bool Job::read_bytes(yad64::address_t address, void *buf, std::size_t len) {
+	return read(address, buf, len, false);
+}
+
+//------------------------------------------------------------------------------
+// Name: read_pages(yad64::address_t address, void *buf, std::size_t count)
+// Desc:
+//------------------------------------------------------------------------------
+bool Job::read_pages(yad64::address_t address, void *buf, std::size_t count) {
+	return read(address, buf, count, true);
+}
+
+//------------------------------------------------------------------------------
+// Name: read_buffer(yad64::address_t address, std::size_t page_count, std::size_t page_size)
+// Desc:
+//------------------------------------------------------------------------------
+QVector<quint8> Job::read_buffer(yad64::address_t address, std::size_t page_count, std::size_t page_size) {
+
+	if(page_count == 0) {
+		return QVector<quint8>();
+	}
+
+	try {
+		QVector<quint8> pages(page_count * page_size);
+		if(read_pages(address, &pages[0], page_count)) {
+			return pages;
+		}
+	} catch(const std::bad_alloc &) {
+		report_error(
+			tr("Memroy Allocation Error"),
+			tr("Unable to satisfy memory allocation request for requested region."));
+	}
+
+	return QVector<quint8>();
+}
+
+//------------------------------------------------------------------------------
+// Name: split_chunks(const QVector<quint8> &bytes, yad64::address_t base, std::size_t first, std::size_t last, int tag, QList<Chunk> &chunks, std::size_t size)
+// Desc:
+//------------------------------------------------------------------------------
+void Job::split_chunks(const QVector<quint8> &bytes, yad64::address_t base, std::size_t first, std::size_t last, int tag, QList<Chunk> &chunks, std::size_t size) {
+	for(std::size_t offset = first; offset < last; offset += size) {
+		const Chunk chunk = {
+			bytes,
+			base,
+			offset,
+			qMin(offset + size, last),
+			tag
+		};
+		chunks.append(chunk);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: read(yad64::address_t address, void *buf, std::size_t count, bool pages)
+// Desc:
+//------------------------------------------------------------------------------
+bool Job::read(yad64::address_t address, void *buf, std::size_t count, bool pages) {
+
+	if(cancelled()) {
+		return false;
+	}
+
+	JobServer *const server = job_server();
+
+	// nothing to hand over if this is already the right thread
+	if(QThread::currentThread() == server->thread()) {
+		if(IDebuggerCore *const core = yad64::v1::debugger_core) {
+			return pages ? core->read_pages(address, buf, count) : core->read_bytes(address, buf, count);
+		}
+		return false;
+	}
+
+	const QSharedPointer<ReadRequest> request(new ReadRequest);
+	request->address = address;
+	request->buf     = buf;
+	request->count   = count;
+	request->pages   = pages;
+	request->ok      = false;
+	request->state   = READ_PENDING;
+
+	QCoreApplication::postEvent(server, new ReadEvent(request));
+
+	QMutexLocker locker(&read_mutex);
+	while(request->state != READ_DONE) {
+
+		// once the read has started it has to be waited for, buf is in use
+		if(request->state == READ_PENDING && cancelled()) {
+			request->state = READ_ABANDONED;
+			return false;
+		}
+
+		read_finished.wait(&read_mutex, read_poll_interval);
+	}
+
+	return request->ok;
+}
+
+//------------------------------------------------------------------------------
+// Name: submit_job(Job *job)
+// Desc: the job is started on the job thread pool and deletes itself once it
+//       is finished
+//------------------------------------------------------------------------------
+void yad64::v1::submit_job(Job *job) {
+	Q_ASSERT(job);
+
+	// make sure the server is created here, on the GUI thread
+	job_server();
+	job_pool()->start(new JobRunner(job));
+}
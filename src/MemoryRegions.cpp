@@ -26,7 +26,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 // Name: MemoryRegions()
 // Desc: constructor
 //------------------------------------------------------------------------------
-MemoryRegions::MemoryRegions() : QAbstractItemModel(0) {
+MemoryRegions::MemoryRegions() : QAbstractItemModel(0), last_hit_(-1) {
 }
 
 //------------------------------------------------------------------------------
@@ -41,12 +41,49 @@ MemoryRegions::~MemoryRegions() {
 // Desc:
 //------------------------------------------------------------------------------
 void MemoryRegions::clear() {
-	regions_.clear();
+	if(!regions_.isEmpty()) {
+		beginRemoveRows(QModelIndex(), 0, regions_.size() - 1);
+		regions_.clear();
+		spans_.clear();
+		last_hit_ = -1;
+		endRemoveRows();
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: make_span(const MemoryRegion &region)
+// Desc:
+//------------------------------------------------------------------------------
+MemoryRegions::span_t MemoryRegions::make_span(const MemoryRegion &region) {
+	span_t span;
+	span.start = region.start();
+	span.end   = region.end();
+	return span;
+}
+
+//------------------------------------------------------------------------------
+// Name: load_symbols(const MemoryRegion &region)
+// Desc: if the region has a name, is mapped starting at the beginning of the
+//       file, and is executable, sounds like a module mapping!
+//------------------------------------------------------------------------------
+void MemoryRegions::load_symbols(const MemoryRegion &region) {
+	if(!region.name().isEmpty()) {
+		if(region.base() == 0) {
+			if(region.executable()) {
+				yad64::v1::symbol_manager().load_symbol_file(region.name(), region.start());
+			}
+		}
+	}
 }
 
 //------------------------------------------------------------------------------
 // Name: sync()
 // Desc: reads a memory map file line by line
+// Note: the new map is merged into the old one (both are sorted by address)
+//       so that views only hear about the rows which really changed, and we
+//       only go looking for symbols for regions we haven't seen before.
+//       spans_ is edited right along with regions_, views react to the end*
+//       signals by looking things up and have to see the new index
 //------------------------------------------------------------------------------
 void MemoryRegions::sync() {
 
@@ -54,27 +91,63 @@ void MemoryRegions::sync() {
 	
 	if(yad64::v1::debugger_core) {
 		regions = yad64::v1::debugger_core->memory_regions();
-		Q_FOREACH(const MemoryRegion &region, regions) {
-			// if the region has a name, is mapped starting
-			// at the beginning of the file, and is executable, sounds
-			// like a module mapping!
-			if(!region.name().isEmpty()) {
-				if(region.base() == 0) {
-					if(region.executable()) {
-						yad64::v1::symbol_manager().load_symbol_file(region.name(), region.start());
-					}
-				}
-			}
-		}
-		
 		if(regions.isEmpty()) {
 			qDebug() << "[MemoryRegions] warning: empty memory map";
 		}
 	}
 
+	int row = 0;
+	int i   = 0;
+
+	while(row < regions_.size() || i < regions.size()) {
+
+		// a run of regions which are gone
+		int removed = 0;
+		while(row + removed < regions_.size() && (i == regions.size() || regions_[row + removed].start() < regions[i].start())) {
+			++removed;
+		}
+
+		if(removed != 0) {
+			beginRemoveRows(QModelIndex(), row, row + removed - 1);
+			regions_.erase(regions_.begin() + row, regions_.begin() + row + removed);
+			spans_.remove(row, removed);
+			last_hit_ = -1;
+			endRemoveRows();
+			continue;
+		}
 
-	qSwap(regions_, regions);
-	reset();
+		// a run of regions which are new
+		int added = 0;
+		while(i + added < regions.size() && (row == regions_.size() || regions[i + added].start() < regions_[row].start())) {
+			++added;
+		}
+
+		if(added != 0) {
+			beginInsertRows(QModelIndex(), row, row + added - 1);
+			for(int j = 0; j < added; ++j) {
+				regions_.insert(row + j, regions[i + j]);
+				spans_.insert(row + j, make_span(regions[i + j]));
+				load_symbols(regions[i + j]);
+			}
+			last_hit_ = -1;
+			endInsertRows();
+			row += added;
+			i   += added;
+			continue;
+		}
+
+		// same start address, it either didn't change at all or got resized,
+		// remapped or had its permissions changed
+		if(regions_[row] != regions[i]) {
+			regions_[row] = regions[i];
+			spans_[row]   = make_span(regions[i]);
+			load_symbols(regions[i]);
+			Q_EMIT dataChanged(index(row, 0), index(row, columnCount() - 1));
+		}
+
+		++row;
+		++i;
+	}
 }
 
 //------------------------------------------------------------------------------
@@ -82,12 +155,7 @@ void MemoryRegions::sync() {
 // Desc:
 //------------------------------------------------------------------------------
 bool MemoryRegions::find_region(yad64::address_t address) const {
-	Q_FOREACH(const MemoryRegion &i, regions_) {
-		if(i.contains(address)) {
-			return true;
-		}
-	}
-	return false;
+	return find_index(address) != -1;
 }
 
 //------------------------------------------------------------------------------
@@ -95,15 +163,68 @@ bool MemoryRegions::find_region(yad64::address_t address) const {
 // Desc:
 //------------------------------------------------------------------------------
 bool MemoryRegions::find_region(yad64::address_t address, MemoryRegion &region) const {
-	Q_FOREACH(const MemoryRegion &i, regions_) {
-		if(i.contains(address)) {
-			region = i;
-			return true;
-		}
+	const int i = find_index(address);
+	if(i != -1) {
+		region = regions_[i];
+		return true;
 	}
 	return false;
 }
 
+//------------------------------------------------------------------------------
+// Name: lookup(yad64::address_t address) const
+// Desc: like find_region, but doesn't copy the region, returns NULL if there
+//       is no region containing address
+// Note: the pointer is only good until the next sync() or clear()
+//------------------------------------------------------------------------------
+const MemoryRegion *MemoryRegions::lookup(yad64::address_t address) const {
+	const int i = find_index(address);
+	return (i != -1) ? &regions_[i] : 0;
+}
+
+//------------------------------------------------------------------------------
+// Name: find_index(yad64::address_t address) const
+// Desc: returns the index of the first region containing address, or -1
+// Note: consecutive lookups tend to land in the same region (painting a view,
+//       walking a function) so the last hit is checked before searching.
+//       MemoryRegion::contains treats end as inclusive, so a region ending
+//       exactly where the next one starts wins, like it did with a linear scan.
+//       GUI thread only, sync() edits spans_ in place
+//------------------------------------------------------------------------------
+int MemoryRegions::find_index(yad64::address_t address) const {
+
+	if(last_hit_ != -1 && last_hit_ < spans_.size()) {
+		const span_t &span = spans_[last_hit_];
+		if(address > span.start && address < span.end) {
+			return last_hit_;
+		}
+	}
+
+	// find the last region which starts at or before address
+	int lo = 0;
+	int hi = spans_.size();
+	while(lo < hi) {
+		const int mid = lo + (hi - lo) / 2;
+		if(spans_[mid].start <= address) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	int i = lo - 1;
+	if(i < 0 || address > spans_[i].end) {
+		return -1;
+	}
+
+	if(i > 0 && address == spans_[i].start && address <= spans_[i - 1].end) {
+		--i;
+	}
+
+	last_hit_ = i;
+	return i;
+}
+
 //------------------------------------------------------------------------------
 // Name: data(const QModelIndex &index, int role) const
 // Desc:
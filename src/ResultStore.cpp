@@ -0,0 +1,81 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ResultStore.h"
+
+//------------------------------------------------------------------------------
+// Name: ResultStore()
+// Desc:
+//------------------------------------------------------------------------------
+ResultStore::ResultStore() : offsets_(1, 0) {
+}
+
+//------------------------------------------------------------------------------
+// Name: append(yad64::address_t address, const QString &text, quint32 flags, quint32 length)
+// Desc:
+//------------------------------------------------------------------------------
+void ResultStore::append(yad64::address_t address, const QString &text, quint32 flags, quint32 length) {
+	addresses_.append(address);
+	flags_.append(flags);
+	lengths_.append(length);
+	text_.append(text.toUtf8());
+	offsets_.append(text_.size());
+}
+
+//------------------------------------------------------------------------------
+// Name: append(const ResultStore &other)
+// Desc:
+//------------------------------------------------------------------------------
+void ResultStore::append(const ResultStore &other) {
+
+	const quint32 base = text_.size();
+
+	addresses_ += other.addresses_;
+	flags_     += other.flags_;
+	lengths_   += other.lengths_;
+	text_.append(other.text_);
+
+	offsets_.reserve(offsets_.size() + other.size());
+	for(int i = 1; i < other.offsets_.size(); ++i) {
+		offsets_.append(base + other.offsets_[i]);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: reserve(int count)
+// Desc:
+//------------------------------------------------------------------------------
+void ResultStore::reserve(int count) {
+	addresses_.reserve(count);
+	flags_.reserve(count);
+	lengths_.reserve(count);
+	offsets_.reserve(count + 1);
+}
+
+//------------------------------------------------------------------------------
+// Name: clear()
+// Desc:
+//------------------------------------------------------------------------------
+void ResultStore::clear() {
+	addresses_.clear();
+	flags_.clear();
+	lengths_.clear();
+	offsets_.clear();
+	offsets_.append(0);
+	text_.clear();
+}
@@ -0,0 +1,398 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ResultsModel.h"
+#include "Debugger.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Name: to_lower(char ch)
+// Desc: only ASCII is folded, which is enough for hex and identifiers
+//------------------------------------------------------------------------------
+inline char to_lower(char ch) {
+	return (ch >= 'A' && ch <= 'Z') ? ch + ('a' - 'A') : ch;
+}
+
+//------------------------------------------------------------------------------
+// Name: contains(const char *text, int size, const QByteArray &needle)
+// Desc: needle must already be lower case
+//------------------------------------------------------------------------------
+bool contains(const char *text, int size, const QByteArray &needle) {
+
+	const int n = needle.size();
+	const char *const p = needle.constData();
+
+	for(int i = 0; i + n <= size; ++i) {
+		if(to_lower(text[i]) == p[0]) {
+			int j = 1;
+			while(j < n && to_lower(text[i + j]) == p[j]) {
+				++j;
+			}
+
+			if(j == n) {
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+struct address_less_than {
+	explicit address_less_than(const ResultStore &results) : results(results) {
+	}
+
+	bool operator()(int a, int b) const {
+		return results.address(a) < results.address(b);
+	}
+
+	const ResultStore &results;
+};
+
+// keys holds the text of every row when the store has none
+struct text_less_than {
+	text_less_than(const ResultStore &results, const QVector<QByteArray> &keys) : results(results), keys(keys) {
+	}
+
+	const char *text_data(int row) const {
+		return keys.isEmpty() ? results.text_data(row) : keys[row].constData();
+	}
+
+	int text_size(int row) const {
+		return keys.isEmpty() ? results.text_size(row) : keys[row].size();
+	}
+
+	bool operator()(int a, int b) const {
+		const int size_a = text_size(a);
+		const int size_b = text_size(b);
+		const int n = std::memcmp(text_data(a), text_data(b), qMin(size_a, size_b));
+		if(n != 0) {
+			return n < 0;
+		}
+
+		if(size_a != size_b) {
+			return size_a < size_b;
+		}
+
+		return results.address(a) < results.address(b);
+	}
+
+	const ResultStore &        results;
+	const QVector<QByteArray> &keys;
+};
+
+}
+
+//------------------------------------------------------------------------------
+// Name: ResultsModel(QObject *parent)
+// Desc:
+//------------------------------------------------------------------------------
+ResultsModel::ResultsModel(QObject *parent) : QAbstractListModel(parent), flag_mask_(0xffffffff), sort_key_(SORT_NONE), formatter_(0) {
+}
+
+//------------------------------------------------------------------------------
+// Name: ~ResultsModel()
+// Desc:
+//------------------------------------------------------------------------------
+ResultsModel::~ResultsModel() {
+}
+
+//------------------------------------------------------------------------------
+// Name: data(const QModelIndex &index, int role) const
+// Desc:
+//------------------------------------------------------------------------------
+QVariant ResultsModel::data(const QModelIndex &index, int role) const {
+
+	if(!index.isValid() || index.row() >= rows_.size()) {
+		return QVariant();
+	}
+
+	const int row = rows_[index.row()];
+
+	switch(role) {
+	case Qt::DisplayRole:
+		{
+			const QString s = text(row);
+			if(s.isEmpty()) {
+				return yad64::v1::format_pointer(results_.address(row));
+			}
+			return QString("%1: %2").arg(yad64::v1::format_pointer(results_.address(row)), s);
+		}
+	case Qt::UserRole:
+		return static_cast<qulonglong>(results_.address(row));
+	case Qt::UserRole + 1:
+		return results_.flags(row);
+	default:
+		return QVariant();
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: rowCount(const QModelIndex &parent) const
+// Desc:
+//------------------------------------------------------------------------------
+int ResultsModel::rowCount(const QModelIndex &parent) const {
+	return parent.isValid() ? 0 : rows_.size();
+}
+
+//------------------------------------------------------------------------------
+// Name: address(const QModelIndex &index) const
+// Desc:
+//------------------------------------------------------------------------------
+yad64::address_t ResultsModel::address(const QModelIndex &index) const {
+	return results_.address(rows_[index.row()]);
+}
+
+//------------------------------------------------------------------------------
+// Name: text(int row) const
+// Desc: the text of a row of results_, made by the formatter if there is one
+//------------------------------------------------------------------------------
+QString ResultsModel::text(int row) const {
+	return formatter_ ? formatter_(results_.address(row), results_.length(row), results_.flags(row)) : results_.text(row);
+}
+
+//------------------------------------------------------------------------------
+// Name: format_keys()
+// Desc: filtering and sorting by text need the text of every row, so when it
+//       is only made on demand, the rows which haven't been yet are made now
+//------------------------------------------------------------------------------
+void ResultsModel::format_keys() {
+	if(formatter_ && (sort_key_ == SORT_TEXT || !filter_.isEmpty())) {
+		keys_.reserve(results_.size());
+		for(int row = keys_.size(); row < results_.size(); ++row) {
+			keys_.append(text(row).toUtf8());
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: accept(int row) const
+// Desc: true if the row passes the flag mask and the filter, which is matched
+//       against both the text and the address in hex
+//------------------------------------------------------------------------------
+bool ResultsModel::accept(int row) const {
+
+	if(!(results_.flags(row) & flag_mask_)) {
+		return false;
+	}
+
+	if(filter_.isEmpty()) {
+		return true;
+	}
+
+	if(keys_.isEmpty() ? contains(results_.text_data(row), results_.text_size(row), filter_) : contains(keys_[row].constData(), keys_[row].size(), filter_)) {
+		return true;
+	}
+
+	char address[sizeof(yad64::address_t) * 2];
+	yad64::address_t value = results_.address(row);
+	for(int i = sizeof(address) - 1; i >= 0; --i) {
+		address[i] = "0123456789abcdef"[value & 0x0f];
+		value >>= 4;
+	}
+
+	return contains(address, sizeof(address), filter_);
+}
+
+//------------------------------------------------------------------------------
+// Name: sort_rows(int *first, int *last) const
+// Desc:
+//------------------------------------------------------------------------------
+void ResultsModel::sort_rows(int *first, int *last) const {
+	switch(sort_key_) {
+	case SORT_ADDRESS:
+		std::stable_sort(first, last, address_less_than(results_));
+		break;
+	case SORT_TEXT:
+		std::sort(first, last, text_less_than(results_, keys_));
+		break;
+	case SORT_NONE:
+		std::sort(first, last);
+		break;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: remap_persistent_indexes(const QVector<int> &old_rows)
+// Desc: moves the persistent indexes (selection, current item) along with the
+//       results they pointed at, old_rows is rows_ from before the change.
+//       must be called between layoutAboutToBeChanged and layoutChanged
+//------------------------------------------------------------------------------
+void ResultsModel::remap_persistent_indexes(const QVector<int> &old_rows) {
+
+	const QModelIndexList from = persistentIndexList();
+	if(from.isEmpty()) {
+		return;
+	}
+
+	QVector<int> position(results_.size(), -1);
+	for(int i = 0; i < rows_.size(); ++i) {
+		position[rows_[i]] = i;
+	}
+
+	QModelIndexList to;
+	Q_FOREACH(const QModelIndex &index, from) {
+		const int row = (index.row() < old_rows.size()) ? position[old_rows[index.row()]] : -1;
+		to.append(row != -1 ? createIndex(row, index.column()) : QModelIndex());
+	}
+
+	changePersistentIndexList(from, to);
+}
+
+//------------------------------------------------------------------------------
+// Name: append(const ResultStore &results)
+// Desc: new rows go at the end unless the model is sorted, then they are
+//       merged in
+//------------------------------------------------------------------------------
+void ResultsModel::append(const ResultStore &results) {
+
+	if(results.empty()) {
+		return;
+	}
+
+	const int first = results_.size();
+	results_.append(results);
+	format_keys();
+
+	QVector<int> added;
+	for(int row = first; row < results_.size(); ++row) {
+		if(accept(row)) {
+			added.append(row);
+		}
+	}
+
+	if(added.isEmpty()) {
+		return;
+	}
+
+	if(sort_key_ == SORT_NONE) {
+		beginInsertRows(QModelIndex(), rows_.size(), rows_.size() + added.size() - 1);
+		rows_ += added;
+		endInsertRows();
+		return;
+	}
+
+	sort_rows(added.begin(), added.end());
+
+	Q_EMIT layoutAboutToBeChanged();
+	const QVector<int> old_rows = rows_;
+	const int middle = rows_.size();
+	rows_ += added;
+	if(sort_key_ == SORT_ADDRESS) {
+		std::inplace_merge(rows_.begin(), rows_.begin() + middle, rows_.end(), address_less_than(results_));
+	} else {
+		std::inplace_merge(rows_.begin(), rows_.begin() + middle, rows_.end(), text_less_than(results_, keys_));
+	}
+	remap_persistent_indexes(old_rows);
+	Q_EMIT layoutChanged();
+}
+
+//------------------------------------------------------------------------------
+// Name: clear()
+// Desc:
+//------------------------------------------------------------------------------
+void ResultsModel::clear() {
+	beginResetModel();
+	results_.clear();
+	rows_.clear();
+	keys_.clear();
+	endResetModel();
+}
+
+//------------------------------------------------------------------------------
+// Name: refilter()
+// Desc:
+//------------------------------------------------------------------------------
+void ResultsModel::refilter() {
+	beginResetModel();
+	format_keys();
+
+	rows_.clear();
+	for(int row = 0; row < results_.size(); ++row) {
+		if(accept(row)) {
+			rows_.append(row);
+		}
+	}
+
+	if(sort_key_ != SORT_NONE) {
+		sort_rows(rows_.begin(), rows_.end());
+	}
+
+	endResetModel();
+}
+
+//------------------------------------------------------------------------------
+// Name: set_sort(SortKey key)
+// Desc:
+//------------------------------------------------------------------------------
+void ResultsModel::set_sort(SortKey key) {
+	if(key != sort_key_) {
+		sort_key_ = key;
+		format_keys();
+
+		Q_EMIT layoutAboutToBeChanged();
+		const QVector<int> old_rows = rows_;
+		sort_rows(rows_.begin(), rows_.end());
+		remap_persistent_indexes(old_rows);
+		Q_EMIT layoutChanged();
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: set_flag_mask(quint32 mask)
+// Desc: only rows with at least one of these flags are shown
+//------------------------------------------------------------------------------
+void ResultsModel::set_flag_mask(quint32 mask) {
+	if(mask != flag_mask_) {
+		flag_mask_ = mask;
+		refilter();
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: set_formatter(Formatter formatter)
+// Desc: rows are formatted by this instead of taking their text from the store
+//------------------------------------------------------------------------------
+void ResultsModel::set_formatter(Formatter formatter) {
+	if(formatter != formatter_) {
+		formatter_ = formatter;
+		keys_.clear();
+		refilter();
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: set_filter(const QString &filter)
+// Desc: only rows containing this text are shown, case is ignored
+//------------------------------------------------------------------------------
+void ResultsModel::set_filter(const QString &filter) {
+
+	QByteArray lower = filter.toUtf8();
+	for(int i = 0; i < lower.size(); ++i) {
+		lower[i] = to_lower(lower[i]);
+	}
+
+	if(lower != filter_) {
+		filter_ = lower;
+		refilter();
+	}
+}
@@ -0,0 +1,105 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ResultsView.h"
+#include "ResultsModel.h"
+
+#include <QComboBox>
+#include <QHBoxLayout>
+#include <QLabel>
+#include <QLineEdit>
+#include <QListView>
+#include <QVBoxLayout>
+
+//------------------------------------------------------------------------------
+// Name: ResultsView(QWidget *parent)
+// Desc:
+//------------------------------------------------------------------------------
+ResultsView::ResultsView(QWidget *parent) : QWidget(parent), model_(new ResultsModel(this)) {
+
+	filter_ = new QLineEdit(this);
+	filter_->setToolTip(tr("Only show results containing this text or address"));
+
+	sort_ = new QComboBox(this);
+	sort_->addItem(tr("Order Found"));
+	sort_->addItem(tr("Sort By Address"));
+	sort_->addItem(tr("Sort By Text"));
+
+	count_ = new QLabel(this);
+
+	list_ = new QListView(this);
+	list_->setModel(model_);
+	list_->setUniformItemSizes(true);
+	list_->setAlternatingRowColors(true);
+	list_->setEditTriggers(QAbstractItemView::NoEditTriggers);
+	list_->setFont(QFont("Monospace"));
+
+	QHBoxLayout *const controls = new QHBoxLayout;
+	controls->addWidget(new QLabel(tr("Filter:"), this));
+	controls->addWidget(filter_, 1);
+	controls->addWidget(sort_);
+	controls->addWidget(count_);
+
+	QVBoxLayout *const layout = new QVBoxLayout(this);
+	layout->setContentsMargins(0, 0, 0, 0);
+	layout->addLayout(controls);
+	layout->addWidget(list_);
+
+	connect(filter_, SIGNAL(textChanged(const QString &)), model_, SLOT(set_filter(const QString &)));
+	connect(sort_, SIGNAL(currentIndexChanged(int)), this, SLOT(sort_changed(int)));
+	connect(list_, SIGNAL(doubleClicked(const QModelIndex &)), this, SIGNAL(doubleClicked(const QModelIndex &)));
+	connect(model_, SIGNAL(rowsInserted(const QModelIndex &, int, int)), this, SLOT(update_count()));
+	connect(model_, SIGNAL(modelReset()), this, SLOT(update_count()));
+	connect(model_, SIGNAL(layoutChanged()), this, SLOT(update_count()));
+
+	update_count();
+}
+
+//------------------------------------------------------------------------------
+// Name: ~ResultsView()
+// Desc:
+//------------------------------------------------------------------------------
+ResultsView::~ResultsView() {
+}
+
+//------------------------------------------------------------------------------
+// Name: sort_changed(int index)
+// Desc:
+//------------------------------------------------------------------------------
+void ResultsView::sort_changed(int index) {
+	switch(index) {
+	case 1:  model_->set_sort(ResultsModel::SORT_ADDRESS); break;
+	case 2:  model_->set_sort(ResultsModel::SORT_TEXT);    break;
+	default: model_->set_sort(ResultsModel::SORT_NONE);    break;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: update_count()
+// Desc:
+//------------------------------------------------------------------------------
+void ResultsView::update_count() {
+	const int shown = model_->rowCount();
+	const int total = model_->results().size();
+
+	if(shown == total) {
+		count_->setText(tr("%1 results").arg(total));
+	} else {
+		count_->setText(tr("%1 of %2 results").arg(shown).arg(total));
+	}
+}
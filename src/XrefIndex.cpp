@@ -0,0 +1,169 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "XrefIndex.h"
+
+#include <QtAlgorithms>
+
+#include <algorithm>
+
+namespace {
+
+//------------------------------------------------------------------------------
+// Name: xref_less(const XrefIndex::Xref &lhs, const XrefIndex::Xref &rhs)
+// Desc: by target, then by source
+//------------------------------------------------------------------------------
+bool xref_less(const XrefIndex::Xref &lhs, const XrefIndex::Xref &rhs) {
+	if(lhs.to != rhs.to) {
+		return lhs.to < rhs.to;
+	}
+	if(lhs.from != rhs.from) {
+		return lhs.from < rhs.from;
+	}
+	return lhs.kind < rhs.kind;
+}
+
+//------------------------------------------------------------------------------
+// Name: xref_equal(const XrefIndex::Xref &lhs, const XrefIndex::Xref &rhs)
+// Desc:
+//------------------------------------------------------------------------------
+bool xref_equal(const XrefIndex::Xref &lhs, const XrefIndex::Xref &rhs) {
+	return lhs.to == rhs.to && lhs.from == rhs.from && lhs.kind == rhs.kind;
+}
+
+}
+
+//------------------------------------------------------------------------------
+// Name: XrefIndex()
+// Desc:
+//------------------------------------------------------------------------------
+XrefIndex::XrefIndex() : base_(0) {
+}
+
+//------------------------------------------------------------------------------
+// Name: XrefIndex(yad64::address_t base, const QVector<Xref> &xrefs)
+// Desc: xrefs may be in any order and have duplicates
+//------------------------------------------------------------------------------
+XrefIndex::XrefIndex(yad64::address_t base, const QVector<Xref> &xrefs) : base_(base) {
+
+	QVector<Xref> sorted(xrefs);
+	std::sort(sorted.begin(), sorted.end(), xref_less);
+	build(sorted);
+}
+
+//------------------------------------------------------------------------------
+// Name: XrefIndex(yad64::address_t base, const QVector<Xref> &sorted, const QVector<Xref> &xrefs)
+// Desc: sorted has to be in the order xrefs() returns, xrefs may be in any
+//       order, and both may have duplicates. only xrefs is sorted, then the
+//       two are merged
+//------------------------------------------------------------------------------
+XrefIndex::XrefIndex(yad64::address_t base, const QVector<Xref> &sorted, const QVector<Xref> &xrefs) : base_(base) {
+
+	QVector<Xref> added(xrefs);
+	std::sort(added.begin(), added.end(), xref_less);
+
+	QVector<Xref> merged(sorted.size() + added.size());
+	std::merge(sorted.begin(), sorted.end(), added.begin(), added.end(), merged.begin(), xref_less);
+	build(merged);
+}
+
+//------------------------------------------------------------------------------
+// Name: build(const QVector<Xref> &sorted)
+// Desc: sorted is by target, then by source, and may have duplicates
+//------------------------------------------------------------------------------
+void XrefIndex::build(const QVector<Xref> &sorted) {
+
+	sources_.reserve(sorted.size());
+	kinds_.reserve(sorted.size());
+
+	for(QVector<Xref>::const_iterator it = sorted.begin(); it != sorted.end(); ++it) {
+		if(it != sorted.begin() && xref_equal(*it, *(it - 1))) {
+			continue;
+		}
+
+		const Xref &xref = *it;
+		if(targets_.isEmpty() || targets_.back() != xref.to) {
+			targets_.push_back(xref.to);
+			first_.push_back(sources_.size());
+		}
+
+		sources_.push_back(static_cast<quint32>(xref.from - base_));
+		kinds_.push_back(static_cast<quint8>(xref.kind));
+	}
+
+	first_.push_back(sources_.size());
+}
+
+//------------------------------------------------------------------------------
+// Name: append(int target, QVector<Xref> &xrefs) const
+// Desc: expands the references to the target at index target
+//------------------------------------------------------------------------------
+void XrefIndex::append(int target, QVector<Xref> &xrefs) const {
+	for(quint32 i = first_[target]; i < first_[target + 1]; ++i) {
+		const Xref xref = { base_ + sources_[i], targets_[target], static_cast<Kind>(kinds_[i]) };
+		xrefs.push_back(xref);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: references_to(yad64::address_t address) const
+// Desc:
+//------------------------------------------------------------------------------
+QVector<XrefIndex::Xref> XrefIndex::references_to(yad64::address_t address) const {
+
+	QVector<Xref> ret;
+
+	const QVector<yad64::address_t>::const_iterator it = qBinaryFind(targets_.begin(), targets_.end(), address);
+	if(it != targets_.end()) {
+		append(it - targets_.begin(), ret);
+	}
+
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// Name: references_to(yad64::address_t first, yad64::address_t last) const
+// Desc: the references to anything in [first, last), such as a whole function
+//------------------------------------------------------------------------------
+QVector<XrefIndex::Xref> XrefIndex::references_to(yad64::address_t first, yad64::address_t last) const {
+
+	QVector<Xref> ret;
+
+	QVector<yad64::address_t>::const_iterator it = qLowerBound(targets_.begin(), targets_.end(), first);
+	for(; it != targets_.end() && *it < last; ++it) {
+		append(it - targets_.begin(), ret);
+	}
+
+	return ret;
+}
+
+//------------------------------------------------------------------------------
+// Name: xrefs() const
+// Desc: all of them, sorted by target
+//------------------------------------------------------------------------------
+QVector<XrefIndex::Xref> XrefIndex::xrefs() const {
+
+	QVector<Xref> ret;
+	ret.reserve(sources_.size());
+
+	for(int i = 0; i < targets_.size(); ++i) {
+		append(i, ret);
+	}
+
+	return ret;
+}
@@ -68,43 +68,13 @@ namespace {
 
 template <class M>
 class EDB_EXPORT Instruction {
-private:
-	class stream_base {
-	public:
-		virtual ~stream_base() {}
-		virtual uint8_t next() = 0;
-		virtual uint8_t peek() const = 0;
-		virtual bool empty() const = 0;
-		virtual stream_base *clone() = 0;
-	};
-	
-	template <class In>
-	class stream_iterator : public stream_base {
-	public:
-		stream_iterator(In first, In last) : first_(first), last_(last) {
-		}
-		
-	private:
-		stream_iterator(const stream_iterator &);
-		stream_iterator &operator=(const stream_iterator &);
-		
-	public:
-		virtual uint8_t next()       { return *first_++; }
-		virtual uint8_t peek() const { return *first_; }
-		virtual bool empty() const   { return first_ == last_; }
-		virtual stream_base *clone() { return new stream_iterator(first_, last_); }
-		
-	private:
-		In first_;
-		In last_;
-	};
-	
 public:
 	static const int MAX_OPERANDS = M::MAX_OPERANDS;
 	static const int MAX_SIZE     = M::MAX_SIZE;
 	static const int BITS         = M::BITS;
 
 public:
+	typedef M                     model_t;
 	typedef Operand<M>            operand_t;
 	typedef typename M::address_t address_t;
 	typedef Instruction<M>        instruction_t;
@@ -115,31 +85,39 @@ public:
 public:
 	template <class In>
 	Instruction(In first, In last, address_t rva, const std::nothrow_t&) throw() :
-			byte_stream_(new stream_iterator<In>(first, last)), byte_index_(0), byte1_(0x00), byte2_(0x00), byte3_(0x00), 
+			byte_index_(0), byte_count_(0), byte1_(0x00), byte2_(0x00), byte3_(0x00), 
 			modrm_byte_(0x00), sib_byte_(0x00), rex_byte_(0x00), rva_(rva), 
 			opcode_(&Opcode_invalid), prefix_(0x00000000), mandatory_prefix_(0x00000000),
 			operand_count_(0), modrm_size_(0), sib_size_(0), disp_size_(0), prefix_size_(0),
-			immediate_size_(0), rex_size_(0) {
+			immediate_size_(0), rex_size_(0), error_(ERROR_NONE), error_index_(0) {
 
-		try {
-			initialize();
-		} catch(const edisassm::invalid_instruction &) {
-			opcode_ = &Opcode_invalid;
-			//throw;
+		while(first != last && byte_count_ != sizeof(bytes_)) {
+			bytes_[byte_count_++] = *first++;
 		}
-	}
 
+		initialize();
+	}
 
 	template <class In>
 	Instruction(In first, In last, address_t rva) :
-			byte_stream_(new stream_iterator<In>(first, last)), byte_index_(0), byte1_(0x00), byte2_(0x00), byte3_(0x00), 
+			byte_index_(0), byte_count_(0), byte1_(0x00), byte2_(0x00), byte3_(0x00), 
 			modrm_byte_(0x00), sib_byte_(0x00), rex_byte_(0x00), rva_(rva), 
 			opcode_(&Opcode_invalid), prefix_(0x00000000), mandatory_prefix_(0x00000000),
 			operand_count_(0), modrm_size_(0), sib_size_(0), disp_size_(0), prefix_size_(0),
-			immediate_size_(0), rex_size_(0) {
+			immediate_size_(0), rex_size_(0), error_(ERROR_NONE), error_index_(0) {
+
+		while(first != last && byte_count_ != sizeof(bytes_)) {
+			bytes_[byte_count_++] = *first++;
+		}
 
 		initialize();
+		throw_error();
 	}
+
+	// the fast path: decodes straight out of a caller supplied buffer without
+	// touching the heap and without throwing, invalid encodings simply yield
+	// an instruction where valid() is false
+	Instruction(const uint8_t *buffer, std::size_t size, address_t rva, const std::nothrow_t&) throw();
 	
 	~Instruction();
 
@@ -791,20 +769,31 @@ private:
 	void process_prefixes();
 	operand_t &next_operand();
 	uint8_t next_byte();
+	void set_error(uint8_t error);
+	void throw_error() const;
+
+	bool stream_empty() const { return byte_index_ == byte_count_; }
+	uint8_t stream_peek() const { return stream_empty() ? 0x00 : bytes_[byte_index_]; }
 
 private:
 	// convenience binders,
 	template <decoder_t F1, decoder_t F2, decoder_t F3>
 	void decode3() {
 		(this->*F1)();
-		(this->*F2)();
-		(this->*F3)();
+		if(error_ == ERROR_NONE) {
+			(this->*F2)();
+			if(error_ == ERROR_NONE) {
+				(this->*F3)();
+			}
+		}
 	}
 
 	template <decoder_t F1, decoder_t F2>
 	void decode2() {
 		(this->*F1)();
-		(this->*F2)();
+		if(error_ == ERROR_NONE) {
+			(this->*F2)();
+		}
 	}
 
 	template <decoder_t F1>
@@ -1324,6 +1313,7 @@ public:
 	const uint8_t *bytes() const                      { return bytes_; }
 	operator void *() const                           { return reinterpret_cast<void *>(valid()); }
 	std::string mnemonic() const                      { return opcode_->mnemonic; }
+	const char *mnemonic_c_str() const                { return opcode_->mnemonic; }
 	uint32_t prefix() const                           { return prefix_; }
 	uint32_t mandatory_prefix() const                 { return mandatory_prefix_; }
 	unsigned int operand_count() const                { return operand_count_; }
@@ -1407,11 +1397,24 @@ private:
 	static const opcode_entry Opcode_invalid;
 
 private:
-	stream_base        *byte_stream_;
+	enum Error {
+		ERROR_NONE,
+		ERROR_INVALID_INSTRUCTION,
+		ERROR_INSTRUCTION_TOO_BIG,
+		ERROR_INVALID_OPERAND,
+		ERROR_TOO_MANY_OPERANDS,
+		ERROR_MULTIPLE_DISPLACEMENTS
+	};
 
+private:
 	operand_t           operands_[MAX_OPERANDS];
-	uint8_t             bytes_[MAX_SIZE];
+	operand_t           scratch_operand_;
+	
+	// one byte of look ahead past MAX_SIZE so that running out of room is
+	// reported the same way regardless of how the bytes were supplied
+	uint8_t             bytes_[MAX_SIZE + 1];
 	uint8_t             byte_index_;
+	uint8_t             byte_count_;
 	
 	uint8_t             byte1_;
 	uint8_t             byte2_;
@@ -1433,6 +1436,8 @@ private:
 	uint8_t             prefix_size_;
 	uint8_t             immediate_size_;
 	uint8_t             rex_size_;
+	uint8_t             error_;
+	uint8_t             error_index_;
 };
 
 #endif
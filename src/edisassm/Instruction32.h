@@ -20,6 +20,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define INSTRUCTION_20080314_TCC_
 
 #include <iostream>
+#include <algorithm>
 
 #include "OPTable_FPU.tcc"
 #include "OPTable_1byte.tcc"
@@ -345,7 +346,8 @@ template <class M>
 int8_t Instruction<M>::get_displacement_s8() {
 	// there should only every be one displacement value!
 	if(disp_size_ != 0) {
-		throw edisassm::multiple_displacements(byte_index_);
+		set_error(ERROR_MULTIPLE_DISPLACEMENTS);
+		return 0;
 	}
 	
 	int8_t ret = next_byte();
@@ -360,7 +362,8 @@ template <class M>
 int16_t Instruction<M>::get_displacement_s16() {
 	// there should only every be one displacement value!
 	if(disp_size_ != 0) {
-		throw edisassm::multiple_displacements(byte_index_);
+		set_error(ERROR_MULTIPLE_DISPLACEMENTS);
+		return 0;
 	}
 	
 	int16_t ret = 0;
@@ -378,7 +381,8 @@ template <class M>
 int32_t Instruction<M>::get_displacement_s32() {
 	// there should only every be one displacement value!
 	if(disp_size_ != 0) {
-		throw edisassm::multiple_displacements(byte_index_);
+		set_error(ERROR_MULTIPLE_DISPLACEMENTS);
+		return 0;
 	}
 	
 	int32_t ret = 0;
@@ -399,7 +403,8 @@ int64_t Instruction<M>::get_displacement_s64() {
 
 	// there should only every be one displacement value!
 	if(disp_size_ != 0) {
-		throw edisassm::multiple_displacements(byte_index_);
+		set_error(ERROR_MULTIPLE_DISPLACEMENTS);
+		return 0;
 	}
 	
 	int64_t ret = 0;
@@ -791,7 +796,7 @@ template <typename Operand<M>::Type TYPE, typename Operand<M>::Register (*REG_DE
 void Instruction<M>::decode_ModRM_Invalid(uint8_t modrm_byte, operand_t &operand) {
 	UNUSED(modrm_byte);
 	UNUSED(operand);
-	throw edisassm::invalid_operand(byte_index_);
+	set_error(ERROR_INVALID_OPERAND);
 }
 
 //------------------------------------------------------------------------------
@@ -861,7 +866,21 @@ void Instruction<M>::decode_Ex() {
 //------------------------------------------------------------------------------
 template <class M>
 Instruction<M>::~Instruction() {
-	delete byte_stream_;
+}
+
+//------------------------------------------------------------------------------
+// Name: Instruction(const uint8_t *buffer, std::size_t size, address_t rva, const std::nothrow_t&)
+//------------------------------------------------------------------------------
+template <class M>
+Instruction<M>::Instruction(const uint8_t *buffer, std::size_t size, address_t rva, const std::nothrow_t&) throw() :
+		byte_index_(0), byte_count_(static_cast<uint8_t>(std::min(size, sizeof(bytes_)))), byte1_(0x00), byte2_(0x00), byte3_(0x00), 
+		modrm_byte_(0x00), sib_byte_(0x00), rex_byte_(0x00), rva_(rva), 
+		opcode_(&Opcode_invalid), prefix_(0x00000000), mandatory_prefix_(0x00000000),
+		operand_count_(0), modrm_size_(0), sib_size_(0), disp_size_(0), prefix_size_(0),
+		immediate_size_(0), rex_size_(0), error_(ERROR_NONE), error_index_(0) {
+
+	std::copy(buffer, buffer + byte_count_, bytes_);
+	initialize();
 }
 
 //------------------------------------------------------------------------------
@@ -879,11 +898,49 @@ void Instruction<M>::initialize() {
 	// get the first byte of the actual opcode
 	byte1_ = next_byte();
 	
-	// find the entry in the table
-	opcode_ = &Opcodes[byte1_];
+	if(error_ == ERROR_NONE) {
+		// find the entry in the table
+		opcode_ = &Opcodes[byte1_];
 
-	// decode it
-	(this->*(opcode_->decoder))();
+		// decode it
+		(this->*(opcode_->decoder))();
+	}
+	
+	// decoding stops dead at the first problem, whatever state the decoders
+	// left behind past that point is meaningless
+	if(error_ != ERROR_NONE) {
+		opcode_ = &Opcode_invalid;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: set_error(uint8_t error)
+// Desc: records the first decoding error, once set, next_byte and next_operand
+//       stop consuming input so the remaining decoders unwind harmlessly
+//------------------------------------------------------------------------------
+template <class M>
+void Instruction<M>::set_error(uint8_t error) {
+	if(error_ == ERROR_NONE) {
+		error_       = error;
+		error_index_ = byte_index_;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: throw_error()
+// Desc: reports a recorded decoding error using the historical exception types
+//------------------------------------------------------------------------------
+template <class M>
+void Instruction<M>::throw_error() const {
+	switch(error_) {
+	case ERROR_INVALID_INSTRUCTION:    throw edisassm::invalid_instruction(error_index_);
+	case ERROR_INSTRUCTION_TOO_BIG:    throw edisassm::instruction_too_big(error_index_);
+	case ERROR_INVALID_OPERAND:        throw edisassm::invalid_operand(error_index_);
+	case ERROR_TOO_MANY_OPERANDS:      throw edisassm::too_many_operands(error_index_);
+	case ERROR_MULTIPLE_DISPLACEMENTS: throw edisassm::multiple_displacements(error_index_);
+	default:
+		break;
+	}
 }
 
 //------------------------------------------------------------------------------
@@ -891,7 +948,7 @@ void Instruction<M>::initialize() {
 //------------------------------------------------------------------------------
 template <class M>
 Instruction<M>::Instruction(const Instruction &other) : 
-	byte_stream_(other.byte_stream_->clone()), byte_index_(other.byte_index_), byte1_(other.byte1_), byte2_(other.byte2_), 
+	byte_index_(other.byte_index_), byte_count_(other.byte_count_), byte1_(other.byte1_), byte2_(other.byte2_), 
 	byte3_(other.byte3_), modrm_byte_(other.modrm_byte_), 
 	sib_byte_(other.sib_byte_), rex_byte_(other.rex_byte_), rva_(other.rva_), 
 	opcode_(other.opcode_), prefix_(other.prefix_), 
@@ -899,7 +956,7 @@ Instruction<M>::Instruction(const Instruction &other) :
 	operand_count_(other.operand_count_), modrm_size_(other.modrm_size_),
 	sib_size_(other.sib_size_), disp_size_(other.disp_size_), 
 	prefix_size_(other.prefix_size_), immediate_size_(other.immediate_size_),
-	rex_size_(other.rex_size_) {
+	rex_size_(other.rex_size_), error_(other.error_), error_index_(other.error_index_) {
 
 	for(int i = 0; i < M::MAX_OPERANDS; ++i) {
 		operands_[i] = other.operands_[i];
@@ -931,15 +988,15 @@ void Instruction<M>::swap(Instruction &other) {
 		operands_[i].swap(other.operands_[i]);
 	}
 	
-	for(int i = 0; i < MAX_SIZE; ++i) {
+	for(std::size_t i = 0; i < sizeof(bytes_); ++i) {
 		swap(bytes_[i], other.bytes_[i]);
 	}
 
-	swap(byte_stream_,      other.byte_stream_);
 	swap(byte1_,            other.byte1_);
 	swap(byte2_,            other.byte2_);
 	swap(byte3_,            other.byte3_);
 	swap(byte_index_,       other.byte_index_);
+	swap(byte_count_,       other.byte_count_);
 	swap(disp_size_,        other.disp_size_);
 	swap(immediate_size_,   other.immediate_size_);
 	swap(mandatory_prefix_, other.mandatory_prefix_);
@@ -954,6 +1011,8 @@ void Instruction<M>::swap(Instruction &other) {
 	swap(rva_,              other.rva_);
 	swap(sib_byte_,         other.sib_byte_);
 	swap(sib_size_,         other.sib_size_);
+	swap(error_,            other.error_);
+	swap(error_index_,      other.error_index_);
 
 }
 
@@ -969,11 +1028,11 @@ void Instruction<M>::process_prefixes() {
 	// currently, the last one from a given group in the stream
 	// will take precedence
 	do {
-		if(byte_stream_->empty()) {
+		if(stream_empty()) {
 			break;
 		}
 
-		switch(byte_stream_->peek()) {
+		switch(stream_peek()) {
 		// group1
 		case 0xf0:
 			prefix_ = (prefix_ & 0xffffff00) | PREFIX_LOCK;
@@ -1028,12 +1087,15 @@ void Instruction<M>::process_prefixes() {
 		// is smart
 		if(!done) {
 			next_byte();
+			if(error_ != ERROR_NONE) {
+				return;
+			}
 			++prefix_size_;
 		}
 	} while(!done);
 
 	if(BITS == 64) {
-		if(!byte_stream_->empty() && rex::is_rex(byte_stream_->peek())) {
+		if(!stream_empty() && rex::is_rex(stream_peek())) {
 			rex_byte_ = next_byte();
 			++rex_size_;
 		}
@@ -1047,7 +1109,14 @@ template <class M>
 typename Instruction<M>::operand_t &Instruction<M>::next_operand() {
 
 	if(operand_count_ >= MAX_OPERANDS) {
-		throw edisassm::too_many_operands(byte_index_);
+		set_error(ERROR_TOO_MANY_OPERANDS);
+	}
+	
+	// once decoding has failed, hand out a throw away operand so the
+	// decoders can finish without disturbing what was already decoded
+	if(error_ != ERROR_NONE) {
+		scratch_operand_.invalidate();
+		return scratch_operand_;
 	}
 
 	operand_t &ret = operands_[operand_count_++];
@@ -1056,22 +1125,21 @@ typename Instruction<M>::operand_t &Instruction<M>::next_operand() {
 }
 
 //------------------------------------------------------------------------------
-// Name: next_operand()
+// Name: next_byte()
 //------------------------------------------------------------------------------
 template <class M>
 uint8_t Instruction<M>::next_byte() {
 
-	if(byte_index_ == MAX_SIZE) {
-		throw edisassm::instruction_too_big(byte_index_);
+	if(error_ != ERROR_NONE) {
+		return 0x00;
 	}
-	
-	if(byte_stream_->empty()) {
-		throw edisassm::instruction_too_big(byte_index_);
+
+	if(byte_index_ == MAX_SIZE || stream_empty()) {
+		set_error(ERROR_INSTRUCTION_TOO_BIG);
+		return 0x00;
 	}
 
-	const uint8_t x = byte_stream_->next();
-	bytes_[byte_index_++] = x;
-	return x;
+	return bytes_[byte_index_++];
 }
 
 //------------------------------------------------------------------------------
@@ -1079,7 +1147,7 @@ uint8_t Instruction<M>::next_byte() {
 //------------------------------------------------------------------------------
 template <class M>
 void Instruction<M>::decode_invalid() {
-	throw edisassm::invalid_instruction(byte_index_);
+	set_error(ERROR_INVALID_INSTRUCTION);
 }
 
 template <class M> void Instruction<M>::decode_cbw_cwde_cdqe()                { decode_size_sensitive(Opcodes_cbw_cwde_cdqe); }
@@ -1134,14 +1202,14 @@ void Instruction<M>::wait_or_wait_prefix() {
 	
 	opcode_ = &Opcodes_wait[0];
 	
-	if(!byte_stream_->empty()) {
-		switch(byte_stream_->peek()) {
+	if(!stream_empty()) {
+		switch(stream_peek()) {
 		case 0xd9:
 			{
 				// consume the 0xd9
 				next_byte();
 
-				switch(modrm::reg(byte_stream_->peek())) {
+				switch(modrm::reg(stream_peek())) {
 				case 0x06:
 					opcode_ = &Opcodes_wait_prefix_d9[0];
 					break;
@@ -1156,7 +1224,7 @@ void Instruction<M>::wait_or_wait_prefix() {
 				// consume the 0xdb
 				next_byte();
 
-				switch(byte_stream_->peek()) {
+				switch(stream_peek()) {
 				case 0xe0:
 					opcode_ = &Opcodes_wait_prefix_db[0];
 					next_byte();
@@ -1185,7 +1253,7 @@ void Instruction<M>::wait_or_wait_prefix() {
 				// consume the 0xdd
 				next_byte();
 
-				switch(modrm::reg(byte_stream_->peek())) {
+				switch(modrm::reg(stream_peek())) {
 				case 0x06:
 					opcode_ = &Opcodes_wait_prefix_dd[0];
 					break;
@@ -1200,7 +1268,7 @@ void Instruction<M>::wait_or_wait_prefix() {
 				// consume the 0xdf
 				next_byte();
 
-				switch(byte_stream_->peek()) {
+				switch(stream_peek()) {
 				case 0xe0:
 					opcode_ = &Opcodes_wait_prefix_df[0];
 					next_byte();
@@ -1792,7 +1860,7 @@ void Instruction<M>::decode_Ov() {
 	switch(operand_size()) {
 	case 16: decode_Ow(); break;
 	case 32: decode_Od(); break;
-	case 64: throw edisassm::invalid_instruction(byte_index_); break;
+	case 64: set_error(ERROR_INVALID_INSTRUCTION); break;
 	}
 }
 
@@ -0,0 +1,494 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef EDISASSM_LENGTH_20260417_H_
+#define EDISASSM_LENGTH_20260417_H_
+
+#include "Instruction.h"
+#include "ModRM.h"
+#include "REX.h"
+#include "SIB.h"
+#include <cstddef>
+
+// A length and control flow classifier for code which only needs to know how
+// big an instruction is, whether (and where) it branches and what a RIP
+// relative memory operand points at. Common opcodes
+// are sized straight from a table without decoding any operands, everything
+// else is handed to the full decoder so that the answers always agree with
+// Instruction<M>.
+
+namespace edisassm {
+
+enum flow_type {
+	FLOW_NONE,
+	FLOW_JMP,
+	FLOW_JCC,
+	FLOW_LOOP,
+	FLOW_CALL,
+	FLOW_RET,
+	FLOW_RETF,
+	FLOW_INT,
+	FLOW_HLT
+};
+
+template <class M>
+struct length_info {
+	typedef typename M::address_t address_t;
+
+	unsigned int size;        // only meaningful when valid
+	flow_type    flow;
+	bool         valid;
+	bool         has_target;  // true for relative branches
+	address_t    target;
+	bool         has_memory_target; // true for RIP relative memory operands
+	address_t    memory_target;
+};
+
+namespace length_detail {
+
+	enum Kind {
+		K_FULL,        // needs the full decoder
+		K_NONE,        // no operand bytes
+		K_MODRM,       // ModRM (+ SIB + displacement)
+		K_MODRM_IB,    // ModRM, imm8
+		K_MODRM_IZ,    // ModRM, imm16/32
+		K_IB,          // imm8
+		K_IW,          // imm16
+		K_IZ,          // imm16/32
+		K_IV,          // imm16/32/64
+		K_JB,          // rel8
+		K_JZ,          // rel16/32
+		K_MOV_IMM,     // 0xc6/0xc7, only ModRM.reg == 0 is valid
+		K_GROUP3,      // 0xf6/0xf7, depends on ModRM.reg
+		K_GROUP5       // 0xff, depends on ModRM.reg
+	};
+
+	enum {
+		KIND_MASK  = 0x0f,
+		FLOW_SHIFT = 4
+	};
+
+	#define EDL_E(kind, flow) static_cast<uint8_t>((kind) | ((flow) << FLOW_SHIFT))
+	#define EDL_X             EDL_E(K_FULL, FLOW_NONE)
+	#define EDL_N             EDL_E(K_NONE, FLOW_NONE)
+	#define EDL_M             EDL_E(K_MODRM, FLOW_NONE)
+	#define EDL_MB            EDL_E(K_MODRM_IB, FLOW_NONE)
+	#define EDL_MZ            EDL_E(K_MODRM_IZ, FLOW_NONE)
+	#define EDL_B             EDL_E(K_IB, FLOW_NONE)
+	#define EDL_Z             EDL_E(K_IZ, FLOW_NONE)
+
+	//------------------------------------------------------------------------------
+	// Name: one_byte_table()
+	// Desc: one entry per primary opcode, see Kind
+	//------------------------------------------------------------------------------
+	inline const uint8_t *one_byte_table() {
+		static const uint8_t table[0x100] = {
+			/* 0x00 */ EDL_M, EDL_M, EDL_M, EDL_M, EDL_B, EDL_Z, EDL_X, EDL_X, EDL_M, EDL_M, EDL_M, EDL_M, EDL_B, EDL_Z, EDL_X, EDL_X,
+			/* 0x10 */ EDL_M, EDL_M, EDL_M, EDL_M, EDL_B, EDL_Z, EDL_X, EDL_X, EDL_M, EDL_M, EDL_M, EDL_M, EDL_B, EDL_Z, EDL_X, EDL_X,
+			/* 0x20 */ EDL_M, EDL_M, EDL_M, EDL_M, EDL_B, EDL_Z, EDL_X, EDL_X, EDL_M, EDL_M, EDL_M, EDL_M, EDL_B, EDL_Z, EDL_X, EDL_X,
+			/* 0x30 */ EDL_M, EDL_M, EDL_M, EDL_M, EDL_B, EDL_Z, EDL_X, EDL_X, EDL_M, EDL_M, EDL_M, EDL_M, EDL_B, EDL_Z, EDL_X, EDL_X,
+			/* 0x40 */ EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N,
+			/* 0x50 */ EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N,
+			/* 0x60 */ EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_Z, EDL_MZ, EDL_B, EDL_MB, EDL_N, EDL_X, EDL_N, EDL_X,
+			/* 0x70 */ EDL_E(K_JB, FLOW_JCC), EDL_E(K_JB, FLOW_JCC), EDL_E(K_JB, FLOW_JCC), EDL_E(K_JB, FLOW_JCC),
+			           EDL_E(K_JB, FLOW_JCC), EDL_E(K_JB, FLOW_JCC), EDL_E(K_JB, FLOW_JCC), EDL_E(K_JB, FLOW_JCC),
+			           EDL_E(K_JB, FLOW_JCC), EDL_E(K_JB, FLOW_JCC), EDL_E(K_JB, FLOW_JCC), EDL_E(K_JB, FLOW_JCC),
+			           EDL_E(K_JB, FLOW_JCC), EDL_E(K_JB, FLOW_JCC), EDL_E(K_JB, FLOW_JCC), EDL_E(K_JB, FLOW_JCC),
+			/* 0x80 */ EDL_MB, EDL_MZ, EDL_X, EDL_MB, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_X, EDL_M, EDL_X, EDL_X,
+			/* 0x90 */ EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_X, EDL_X, EDL_N, EDL_N, EDL_N, EDL_N,
+			/* 0xa0 */ EDL_X, EDL_X, EDL_X, EDL_X, EDL_N, EDL_N, EDL_N, EDL_N, EDL_B, EDL_Z, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N,
+			/* 0xb0 */ EDL_B, EDL_B, EDL_B, EDL_B, EDL_B, EDL_B, EDL_B, EDL_B,
+			           EDL_E(K_IV, FLOW_NONE), EDL_E(K_IV, FLOW_NONE), EDL_E(K_IV, FLOW_NONE), EDL_E(K_IV, FLOW_NONE),
+			           EDL_E(K_IV, FLOW_NONE), EDL_E(K_IV, FLOW_NONE), EDL_E(K_IV, FLOW_NONE), EDL_E(K_IV, FLOW_NONE),
+			/* 0xc0 */ EDL_MB, EDL_MB, EDL_E(K_IW, FLOW_RET), EDL_E(K_NONE, FLOW_RET), EDL_X, EDL_X, EDL_E(K_MOV_IMM, FLOW_NONE), EDL_E(K_MOV_IMM, FLOW_NONE),
+			           EDL_X, EDL_N, EDL_E(K_IW, FLOW_RETF), EDL_E(K_NONE, FLOW_RETF), EDL_E(K_NONE, FLOW_INT), EDL_E(K_IB, FLOW_INT), EDL_X, EDL_X,
+			/* 0xd0 */ EDL_M, EDL_M, EDL_M, EDL_M, EDL_X, EDL_X, EDL_X, EDL_N, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X,
+			/* 0xe0 */ EDL_E(K_JB, FLOW_LOOP), EDL_E(K_JB, FLOW_LOOP), EDL_E(K_JB, FLOW_LOOP), EDL_E(K_JB, FLOW_JCC), EDL_B, EDL_B, EDL_B, EDL_B,
+			           EDL_E(K_JZ, FLOW_CALL), EDL_E(K_JZ, FLOW_JMP), EDL_X, EDL_E(K_JB, FLOW_JMP), EDL_N, EDL_N, EDL_N, EDL_N,
+			/* 0xf0 */ EDL_X, EDL_X, EDL_X, EDL_X, EDL_E(K_NONE, FLOW_HLT), EDL_N, EDL_E(K_GROUP3, FLOW_NONE), EDL_E(K_GROUP3, FLOW_NONE),
+			           EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_X, EDL_E(K_GROUP5, FLOW_NONE)
+		};
+		return table;
+	}
+
+	//------------------------------------------------------------------------------
+	// Name: two_byte_table()
+	// Desc: one entry per 0x0f escaped opcode, only used without a 66/f2/f3 prefix
+	//       since those select different tables
+	//------------------------------------------------------------------------------
+	inline const uint8_t *two_byte_table() {
+		static const uint8_t table[0x100] = {
+			/* 0x00 */ EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_N, EDL_X, EDL_X, EDL_X, EDL_X,
+			/* 0x10 */ EDL_M, EDL_M, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_M,
+			/* 0x20 */ EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_M, EDL_M, EDL_X, EDL_X, EDL_X, EDL_X, EDL_M, EDL_M,
+			/* 0x30 */ EDL_X, EDL_N, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X,
+			/* 0x40 */ EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M,
+			/* 0x50 */ EDL_X, EDL_M, EDL_X, EDL_X, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_X, EDL_X, EDL_M, EDL_M, EDL_M, EDL_M,
+			/* 0x60 */ EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X,
+			/* 0x70 */ EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X,
+			/* 0x80 */ EDL_E(K_JZ, FLOW_JCC), EDL_E(K_JZ, FLOW_JCC), EDL_E(K_JZ, FLOW_JCC), EDL_E(K_JZ, FLOW_JCC),
+			           EDL_E(K_JZ, FLOW_JCC), EDL_E(K_JZ, FLOW_JCC), EDL_E(K_JZ, FLOW_JCC), EDL_E(K_JZ, FLOW_JCC),
+			           EDL_E(K_JZ, FLOW_JCC), EDL_E(K_JZ, FLOW_JCC), EDL_E(K_JZ, FLOW_JCC), EDL_E(K_JZ, FLOW_JCC),
+			           EDL_E(K_JZ, FLOW_JCC), EDL_E(K_JZ, FLOW_JCC), EDL_E(K_JZ, FLOW_JCC), EDL_E(K_JZ, FLOW_JCC),
+			/* 0x90 */ EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M,
+			/* 0xa0 */ EDL_X, EDL_X, EDL_N, EDL_M, EDL_MB, EDL_M, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_M, EDL_MB, EDL_M, EDL_X, EDL_M,
+			/* 0xb0 */ EDL_M, EDL_M, EDL_X, EDL_M, EDL_X, EDL_X, EDL_M, EDL_M, EDL_X, EDL_X, EDL_X, EDL_M, EDL_M, EDL_M, EDL_M, EDL_M,
+			/* 0xc0 */ EDL_M, EDL_M, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N, EDL_N,
+			/* 0xd0 */ EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X,
+			/* 0xe0 */ EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X,
+			/* 0xf0 */ EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X, EDL_X
+		};
+		return table;
+	}
+
+	#undef EDL_Z
+	#undef EDL_B
+	#undef EDL_MZ
+	#undef EDL_MB
+	#undef EDL_M
+	#undef EDL_N
+	#undef EDL_X
+	#undef EDL_E
+
+	//------------------------------------------------------------------------------
+	// Name: modrm_length(const uint8_t *p, const uint8_t *last, bool addr16, unsigned int &length)
+	// Desc: size of the ModRM byte and everything it implies (SIB, displacement),
+	//       returns false if it runs past last
+	//------------------------------------------------------------------------------
+	inline bool modrm_length(const uint8_t *p, const uint8_t *last, bool addr16, unsigned int &length) {
+		if(p == last) {
+			return false;
+		}
+
+		const uint8_t modrm_byte = *p;
+		const uint8_t mod        = modrm::mod(modrm_byte);
+		const uint8_t rm         = modrm::rm(modrm_byte);
+
+		length = 1;
+
+		if(mod == 0x03) {
+			return true;
+		}
+
+		if(addr16) {
+			switch(mod) {
+			case 0x00: length += (rm == 0x06) ? 2 : 0; break;
+			case 0x01: length += 1; break;
+			case 0x02: length += 2; break;
+			}
+		} else {
+			if(rm == 0x04) {
+				if(p + 1 == last) {
+					return false;
+				}
+
+				++length;
+				if(mod == 0x00 && sib::base(p[1]) == 0x05) {
+					length += 4;
+				}
+			} else if(mod == 0x00 && rm == 0x05) {
+				length += 4;
+			}
+
+			switch(mod) {
+			case 0x01: length += 1; break;
+			case 0x02: length += 4; break;
+			}
+		}
+
+		return static_cast<std::size_t>(last - p) >= length;
+	}
+
+	//------------------------------------------------------------------------------
+	// Name: read_relative(const uint8_t *p, unsigned int size)
+	//------------------------------------------------------------------------------
+	inline int32_t read_relative(const uint8_t *p, unsigned int size) {
+		switch(size) {
+		case 1:
+			return static_cast<int8_t>(p[0]);
+		case 2:
+			return static_cast<int16_t>(p[0] | (p[1] << 8));
+		default:
+			return static_cast<int32_t>(p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24));
+		}
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: flow_of(const Instruction<M> &insn)
+// Desc: the coarse control flow class of a fully decoded instruction
+//------------------------------------------------------------------------------
+template <class M>
+flow_type flow_of(const Instruction<M> &insn) {
+	switch(insn.type()) {
+	case Instruction<M>::OP_JMP:    return FLOW_JMP;
+	case Instruction<M>::OP_JCC:    return FLOW_JCC;
+	case Instruction<M>::OP_LOOP:
+	case Instruction<M>::OP_LOOPE:
+	case Instruction<M>::OP_LOOPNE: return FLOW_LOOP;
+	case Instruction<M>::OP_CALL:   return FLOW_CALL;
+	case Instruction<M>::OP_RET:    return FLOW_RET;
+	case Instruction<M>::OP_RETF:   return FLOW_RETF;
+	case Instruction<M>::OP_INT:
+	case Instruction<M>::OP_INT3:
+	case Instruction<M>::OP_INTO:   return FLOW_INT;
+	case Instruction<M>::OP_HLT:    return FLOW_HLT;
+	default:
+		return FLOW_NONE;
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: decode_length(const uint8_t *buffer, std::size_t size, address_t rva, length_info<M> &info)
+// Desc: fills in info for the instruction at buffer, returns info.valid
+//------------------------------------------------------------------------------
+template <class M>
+bool decode_length(const uint8_t *buffer, std::size_t size, typename M::address_t rva, length_info<M> &info) {
+
+	using namespace length_detail;
+
+	typedef typename M::address_t address_t;
+
+	info.size       = 0;
+	info.flow       = FLOW_NONE;
+	info.valid      = false;
+	info.has_target        = false;
+	info.target            = 0;
+	info.has_memory_target = false;
+	info.memory_target     = 0;
+
+	if(size > static_cast<std::size_t>(Instruction<M>::MAX_SIZE)) {
+		size = Instruction<M>::MAX_SIZE;
+	}
+
+	const uint8_t *const first = buffer;
+	const uint8_t *const last  = buffer + size;
+	const uint8_t *p           = first;
+
+	// legacy prefixes, the same way Instruction<M>::process_prefixes sees them
+	bool opsize16 = false;
+	bool addr16   = false;
+	bool repeat   = false;
+	bool rex_w    = false;
+	bool addr32   = false;
+
+	for(; p != last; ++p) {
+		switch(*p) {
+		case 0xf2: case 0xf3:
+			repeat = true;
+			continue;
+		case 0xf0:
+		case 0x2e: case 0x36: case 0x3e: case 0x26: case 0x64: case 0x65:
+			continue;
+		case 0x66:
+			opsize16 = true;
+			continue;
+		case 0x67:
+			addr16 = true;
+			continue;
+		}
+		break;
+	}
+
+	if(M::BITS == 64 && p != last && rex::is_rex(*p)) {
+		rex_w = rex::w(*p);
+		++p;
+	}
+
+	// in 64-bit mode an address size prefix selects 32-bit addressing
+	if(M::BITS == 64) {
+		addr32 = addr16;
+		addr16 = false;
+	}
+
+	if(p == last) {
+		return false;
+	}
+
+	const uint8_t opcode = *p++;
+	uint8_t entry        = one_byte_table()[opcode];
+	flow_type flow       = static_cast<flow_type>(entry >> FLOW_SHIFT);
+	unsigned int modrm   = 0;
+	unsigned int imm     = 0;
+	int rel              = 0;
+	const uint8_t *modrm_byte = 0;
+
+	// inc/dec in 32-bit mode, a misplaced REX prefix in 64-bit mode
+	if(M::BITS == 64 && rex::is_rex(opcode)) {
+		entry = K_FULL;
+	}
+
+	if(opcode == 0x0f) {
+		if(p == last || opsize16 || repeat) {
+			entry = K_FULL;
+		} else {
+			entry = two_byte_table()[*p++];
+			flow  = static_cast<flow_type>(entry >> FLOW_SHIFT);
+		}
+	}
+
+	switch(entry & KIND_MASK) {
+	case K_NONE:
+		break;
+	case K_MODRM:
+	case K_MODRM_IB:
+	case K_MODRM_IZ:
+		modrm_byte = p;
+		if(!modrm_length(p, last, addr16, modrm)) {
+			return false;
+		}
+
+		if((entry & KIND_MASK) == K_MODRM_IB) {
+			imm = 1;
+		} else if((entry & KIND_MASK) == K_MODRM_IZ) {
+			imm = opsize16 ? 2 : 4;
+		}
+		break;
+	case K_MOV_IMM:
+	case K_GROUP3:
+		if(p == last) {
+			return false;
+		}
+
+		switch(modrm::reg(*p)) {
+		case 0x00:
+			// mov/test with an immediate sized by the opcode
+			imm = (opcode & 1) ? (opsize16 ? 2 : 4) : 1;
+			break;
+		case 0x01:
+			goto full_decode;
+		default:
+			if((entry & KIND_MASK) == K_MOV_IMM) {
+				goto full_decode;
+			}
+			break;
+		}
+
+		modrm_byte = p;
+		if(!modrm_length(p, last, addr16, modrm)) {
+			return false;
+		}
+		break;
+	case K_GROUP5:
+		if(p == last) {
+			return false;
+		}
+
+		switch(modrm::reg(*p)) {
+		case 0x02: flow = FLOW_CALL; break;
+		case 0x04: flow = FLOW_JMP;  break;
+		case 0x03:
+		case 0x05:
+		case 0x07:
+			// far forms and the invalid slot have their own rules
+			goto full_decode;
+		}
+
+		modrm_byte = p;
+		if(!modrm_length(p, last, addr16, modrm)) {
+			return false;
+		}
+		break;
+	case K_IB:
+		imm = 1;
+		break;
+	case K_IW:
+		imm = 2;
+		break;
+	case K_IZ:
+		imm = opsize16 ? 2 : 4;
+		break;
+	case K_IV:
+		imm = rex_w ? 8 : opsize16 ? 2 : 4;
+		break;
+	case K_JB:
+		rel = 1;
+		break;
+	case K_JZ:
+		rel = opsize16 ? 2 : 4;
+		break;
+	default:
+		goto full_decode;
+	}
+
+	{
+		const std::size_t length = (p - first) + modrm + imm + rel;
+		if(length > size) {
+			return false;
+		}
+
+		info.size  = static_cast<unsigned int>(length);
+		info.flow  = flow;
+		info.valid = true;
+
+		// mod 00, r/m 101 is RIP relative in 64-bit mode, the displacement
+		// follows the ModRM byte and is relative to the next instruction
+		if(M::BITS == 64 && modrm_byte && (*modrm_byte & 0xc7) == 0x05) {
+			if(addr32) {
+				goto full_decode;
+			}
+
+			info.has_memory_target = true;
+			info.memory_target     = static_cast<address_t>(rva + length + read_relative(modrm_byte + 1, 4));
+		}
+
+		if(rel != 0) {
+			const address_t next = static_cast<address_t>(rva + length);
+			const int32_t offset = read_relative(p, rel);
+
+			info.has_target = true;
+			if(rel == 2) {
+				// NOTE: intel truncates EIP to 16-bit here
+				info.target = static_cast<address_t>((next + offset) & 0xffff);
+			} else {
+				info.target = static_cast<address_t>(next + offset);
+			}
+		}
+
+		return true;
+	}
+
+full_decode:
+	{
+		const Instruction<M> insn(first, size, rva, std::nothrow);
+		if(insn.valid()) {
+			info.size  = insn.size();
+			info.flow  = flow_of(insn);
+			info.valid = true;
+
+			if(insn.operand_count() != 0 && insn.operand(0).general_type() == Operand<M>::TYPE_REL) {
+				info.has_target = true;
+				info.target     = insn.operand(0).relative_target();
+			}
+
+			for(unsigned int i = 0; i < insn.operand_count(); ++i) {
+				const Operand<M> &op = insn.operand(i);
+				if(op.general_type() == Operand<M>::TYPE_EXPRESSION && op.expression().base == Operand<M>::REG_RIP) {
+					info.has_memory_target = true;
+					info.memory_target     = static_cast<address_t>(rva + insn.size() + op.displacement());
+					break;
+				}
+			}
+		}
+		return info.valid;
+	}
+}
+
+}
+
+#endif
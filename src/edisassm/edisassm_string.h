@@ -19,6 +19,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifndef EDISASSM_STRING_20110422_H_
 #define EDISASSM_STRING_20110422_H_
 
+#include <cstddef>
 #include <string>
 
 template <class M>
@@ -36,6 +37,40 @@ namespace edisassm {
 	
 	typedef syntax_intel_lcase syntax_intel;
 	
+	// large enough for any formatted instruction or byte string
+	enum { FORMAT_BUFFER_SIZE = 256 };
+
+	//------------------------------------------------------------------------------
+	// Name: format(const Instruction<M> &insn, char *buffer, std::size_t size, const T &)
+	// Desc: writes the given instruction into a caller supplied buffer without
+	//       allocating. The output is truncated to fit and is always NUL terminated
+	//       returns the number of characters written (excluding the terminator)
+	//------------------------------------------------------------------------------
+	template <class M, class T>
+	std::size_t format(const Instruction<M> &insn, char *buffer, std::size_t size, const T &);
+
+	//------------------------------------------------------------------------------
+	// Name: format(const Operand<M> &operand, char *buffer, std::size_t size, const T &)
+	// Desc: writes the given operand into a caller supplied buffer
+	//------------------------------------------------------------------------------
+	template <class M, class T>
+	std::size_t format(const Operand<M> &operand, char *buffer, std::size_t size, const T &);
+
+	//------------------------------------------------------------------------------
+	// Name: format(const Instruction<M> &insn, std::string &s, const T &)
+	// Desc: replaces the contents of s with the given instruction, reusing its
+	//       capacity when formatting many instructions in a row
+	//------------------------------------------------------------------------------
+	template <class M, class T>
+	std::string &format(const Instruction<M> &insn, std::string &s, const T &);
+
+	//------------------------------------------------------------------------------
+	// Name: format_bytes(const Instruction<M> &insn, char *buffer, std::size_t size, const T &)
+	// Desc: writes the bytes of the given instruction into a caller supplied buffer
+	//------------------------------------------------------------------------------
+	template <class M, class T>
+	std::size_t format_bytes(const Instruction<M> &insn, char *buffer, std::size_t size, const T &);
+
 	//------------------------------------------------------------------------------
 	// Name: to_string(const Instruction<M> &insn, const T &)
 	// Desc: creates a std::string which represents the given instruction, in uppercase
@@ -20,81 +20,322 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define EDISASSM_STRING_20110816_TCC_
 
 #include <cassert>
-#include <iomanip>
+#include <cctype>
 #include <limits>
-#include <sstream>
 #include "edisassm_util.h"
 
 namespace edisassm {
 namespace {
 
 //------------------------------------------------------------------------------
-// Name: 
+// Name: format_buffer
+// Desc: appends characters to a caller supplied fixed size buffer, silently
+//       truncating once it is full. The result is always NUL terminated
+//       (unless the buffer has no room at all)
 //------------------------------------------------------------------------------
-template <class M, class T>
-std::string hex_string(T value, const upper_case&) {
-	if(value == 0) {
-		return "0";
+class format_buffer {
+public:
+	format_buffer(char *buffer, std::size_t size) : first_(buffer), p_(buffer), last_(buffer + (size != 0 ? size - 1 : 0)), size_(size) {
+	}
+
+	~format_buffer() {
+		if(size_ != 0) {
+			*p_ = '\0';
+		}
+	}
+
+public:
+	void put(char ch) {
+		if(p_ != last_) {
+			*p_++ = ch;
+		}
+	}
+
+	void put(const char *s) {
+		while(*s && p_ != last_) {
+			*p_++ = *s++;
+		}
+	}
+
+	void put_upper(const char *s) {
+		while(*s && p_ != last_) {
+			*p_++ = static_cast<char>(std::toupper(static_cast<unsigned char>(*s++)));
+		}
+	}
+
+	std::size_t size() const {
+		return p_ - first_;
 	}
 
-	std::ostringstream ss;
-	ss << "0x";
-	ss << std::uppercase << std::hex << std::setw(sizeof(T) * 2) << std::setfill('0') << static_cast<typename M::address_t>(value);
-	return ss.str();
+private:
+	format_buffer(const format_buffer &);
+	format_buffer &operator=(const format_buffer &);
+
+private:
+	char *const       first_;
+	char *            p_;
+	char *const       last_;
+	const std::size_t size_;
+};
+
+//------------------------------------------------------------------------------
+// Name: select(const lower_case&, const char *lower, const char *)
+//------------------------------------------------------------------------------
+inline const char *select(const lower_case&, const char *lower, const char *) {
+	return lower;
 }
 
 //------------------------------------------------------------------------------
-// Name: 
+// Name: select(const upper_case&, const char *, const char *upper)
 //------------------------------------------------------------------------------
-template <class M, class T>
-std::string hex_string(T value, const lower_case&) {
+inline const char *select(const upper_case&, const char *, const char *upper) {
+	return upper;
+}
+
+//------------------------------------------------------------------------------
+// Name: hex_digits(const T &format)
+//------------------------------------------------------------------------------
+template <class T>
+const char *hex_digits(const T &format) {
+	return select(format, "0123456789abcdef", "0123456789ABCDEF");
+}
+
+//------------------------------------------------------------------------------
+// Name: put_mnemonic(format_buffer &out, const char *mnemonic, const lower_case&)
+//------------------------------------------------------------------------------
+inline void put_mnemonic(format_buffer &out, const char *mnemonic, const lower_case&) {
+	out.put(mnemonic);
+}
+
+//------------------------------------------------------------------------------
+// Name: put_mnemonic(format_buffer &out, const char *mnemonic, const upper_case&)
+//------------------------------------------------------------------------------
+inline void put_mnemonic(format_buffer &out, const char *mnemonic, const upper_case&) {
+	out.put_upper(mnemonic);
+}
+
+//------------------------------------------------------------------------------
+// Name: put_hex(format_buffer &out, T value, const F &format)
+// Desc: writes "0" for zero, otherwise "0x" followed by the value (converted to
+//       an address_t) zero padded to the width of T
+//------------------------------------------------------------------------------
+template <class M, class T, class F>
+void put_hex(format_buffer &out, T value, const F &format) {
 	if(value == 0) {
-		return "0";
+		out.put('0');
+		return;
+	}
+
+	const char *const digits = hex_digits(format);
+
+	typename M::address_t n = static_cast<typename M::address_t>(value);
+	char temp[sizeof(n) * 2];
+	std::size_t length = 0;
+	do {
+		temp[length++] = digits[n & 0x0f];
+		n >>= 4;
+	} while(n != 0);
+
+	out.put("0x");
+	for(std::size_t i = length; i < sizeof(T) * 2; ++i) {
+		out.put('0');
 	}
 
-	std::ostringstream ss;
-	ss << "0x";
-	ss << std::hex << std::setw(sizeof(T) * 2) << std::setfill('0') << static_cast<typename M::address_t>(value);
-	return ss.str();
+	while(length != 0) {
+		out.put(temp[--length]);
+	}
 }
 
 //------------------------------------------------------------------------------
-// Name: 
+// Name: put_decimal(format_buffer &out, int64_t value, bool show_pos)
+//------------------------------------------------------------------------------
+inline void put_decimal(format_buffer &out, int64_t value, bool show_pos) {
+
+	uint64_t n = static_cast<uint64_t>(value);
+	if(value < 0) {
+		out.put('-');
+		n = 0 - n;
+	} else if(show_pos) {
+		out.put('+');
+	}
+
+	char temp[20];
+	std::size_t length = 0;
+	do {
+		temp[length++] = static_cast<char>('0' + (n % 10));
+		n /= 10;
+	} while(n != 0);
+
+	while(length != 0) {
+		out.put(temp[--length]);
+	}
+}
+
+//------------------------------------------------------------------------------
+// Name: put_byte(format_buffer &out, uint8_t value, const F &format)
+//------------------------------------------------------------------------------
+template <class F>
+void put_byte(format_buffer &out, uint8_t value, const F &format) {
+	const char *const digits = hex_digits(format);
+	out.put(digits[(value >> 4) & 0x0f]);
+	out.put(digits[value & 0x0f]);
+}
+
+//------------------------------------------------------------------------------
+// Name: register_string(typename Operand<M>::Register reg, const lower_case&)
+// Desc: returns the name of a given register from a static table
 //------------------------------------------------------------------------------
 template <class M>
-std::string format_absolute(const Operand<M> &operand, const upper_case &format) {
-	std::ostringstream ss;
+const char *register_string(typename Operand<M>::Register reg, const lower_case&) {
+
+	static const char *names[] = {
+		"",
+
+		"rax",	"rcx",	"rdx",	"rbx",
+		"rsp",	"rbp",	"rsi",	"rdi",
+		"r8",	"r9",	"r10",	"r11",
+		"r12",	"r13",	"r14",	"r15",
+
+		"eax",	"ecx",	"edx",	"ebx",
+		"esp",	"ebp",	"esi",	"edi",
+		"r8d",	"r9d",	"r10d",	"r11d",
+		"r12d",	"r13d",	"r14d",	"r15d",
+
+		"ax",	"cx",	"dx",	"bx",
+		"sp",	"bp",	"si",	"di",
+		"r8w",	"r9w",	"r10w",	"r11w",
+		"r12w",	"r13w",	"r14w",	"r15w",
+
+		"al",	"cl",	"dl",	"bl",
+		"ah",	"ch",	"dh",	"bh",
+		"r8b",	"r9b",	"r10b",	"r11b",
+		"r12b",	"r13b",	"r14b",	"r15b",
+		"spl",	"bpl",	"sil",	"dil",
+
+		"es",	"cs",	"ss",	"ds",
+		"fs",	"gs",	"seg7",	"seg8",
+
+		"cr0",	"cr1",	"cr2",	"cr3",
+		"cr4",	"cr5",	"cr6",	"cr7",
+		"cr8",	"cr9",	"cr10",	"cr11",
+		"cr12",	"cr13",	"cr14",	"cr15",
+
+		"dr0",	"dr1",	"dr2",	"dr3",
+		"dr4",	"dr5",	"dr6",	"dr7",
+		"dr8",	"dr9",	"dr10",	"dr11",
+		"dr12",	"dr13",	"dr14",	"dr15",
+
+		"tr0",	"tr1",	"tr2",	"tr3",
+		"tr4",	"tr5",	"tr6",	"tr7",
+
+		"mm0",	"mm1",	"mm2",	"mm3",
+		"mm4",	"mm5",	"mm6",	"mm7",
+
+		"xmm0",	"xmm1",	"xmm2",	"xmm3",
+		"xmm4",	"xmm5",	"xmm6",	"xmm7",
+		"xmm8",	"xmm9",	"xmm10","xmm11",
+		"xmm12","xmm13","xmm14","xmm15",
+
+		"st",
+		"st(0)", "st(1)", "st(2)", "st(3)",
+		"st(4)", "st(5)", "st(6)", "st(7)",
+
+		"rip",
+		"eip",
 
-	ss << "FAR "
-	   << hex_string<M>(operand.absolute().seg, format)
-	   << ':'
-	   << hex_string<M>(operand.absolute().offset, format);
+		"(invalid)"
+	};
 
-	return ss.str();
+	assert(static_cast<size_t>(reg) < sizeof(names) / sizeof(names[0]));
+	return names[reg];
 }
 
 //------------------------------------------------------------------------------
-// Name: 
+// Name: register_string(typename Operand<M>::Register reg, const upper_case&)
+// Desc: returns the name of a given register from a static table
 //------------------------------------------------------------------------------
 template <class M>
-std::string format_absolute(const Operand<M> &operand, const lower_case &format) {
-	std::ostringstream ss;
+const char *register_string(typename Operand<M>::Register reg, const upper_case&) {
+
+	static const char *names[] = {
+		"",
+
+		"RAX",	"RCX",	"RDX",	"RBX",
+		"RSP",	"RBP",	"RSI",	"RDI",
+		"R8",	"R9",	"R10",	"R11",
+		"R12",	"R13",	"R14",	"R15",
+
+		"EAX",	"ECX",	"EDX",	"EBX",
+		"ESP",	"EBP",	"ESI",	"EDI",
+		"R8D",	"R9D",	"R10D",	"R11D",
+		"R12D",	"R13D",	"R14D",	"R15D",
+
+		"AX",	"CX",	"DX",	"BX",
+		"SP",	"BP",	"SI",	"DI",
+		"R8W",	"R9W",	"R10W",	"R11W",
+		"R12W",	"R13W",	"R14W",	"R15W",
+
+		"AL",	"CL",	"DL",	"BL",
+		"AH",	"CH",	"DH",	"BH",
+		"R8B",	"R9B",	"R10B",	"R11B",
+		"R12B",	"R13B",	"R14B",	"R15B",
+		"SPL",	"BPL",	"SIL",	"DIL",
+
+		"ES",	"CS",	"SS",	"DS",
+		"FS",	"GS",	"SEG7",	"SEG8",
+
+		"CR0",	"CR1",	"CR2",	"CR3",
+		"CR4",	"CR5",	"CR6",	"CR7",
+		"CR8",	"CR9",	"CR10",	"CR11",
+		"CR12",	"CR13",	"CR14",	"CR15",
+
+		"DR0",	"DR1",	"DR2",	"DR3",
+		"DR4",	"DR5",	"DR6",	"DR7",
+		"DR8",	"DR9",	"DR10",	"DR11",
+		"DR12",	"DR13",	"DR14",	"DR15",
+
+		"TR0",	"TR1",	"TR2",	"TR3",
+		"TR4",	"TR5",	"TR6",	"TR7",
+
+		"MM0",	"MM1",	"MM2",	"MM3",
+		"MM4",	"MM5",	"MM6",	"MM7",
+
+		"XMM0",	"XMM1",	"XMM2",	"XMM3",
+		"XMM4",	"XMM5",	"XMM6",	"XMM7",
+		"XMM8",	"XMM9",	"XMM10","XMM11",
+		"XMM12","XMM13","XMM14","XMM15",
+
+		"ST",
+		"ST(0)", "ST(1)", "ST(2)", "ST(3)",
+		"ST(4)", "ST(5)", "ST(6)", "ST(7)",
+
+		"RIP",
+		"EIP",
 
-	ss << "far "
-	   << hex_string<M>(operand.absolute().seg, format)
-	   << ':'
-	   << hex_string<M>(operand.absolute().offset, format);
+		"(INVALID)"
+	};
 
-	return ss.str();
+	assert(static_cast<size_t>(reg) < sizeof(names) / sizeof(names[0]));
+	return names[reg];
 }
 
+//------------------------------------------------------------------------------
+// Name: 
+//------------------------------------------------------------------------------
+template <class M, class T>
+void format_absolute(format_buffer &out, const Operand<M> &operand, const T &format) {
+	out.put(select(format, "far ", "FAR "));
+	put_hex<M>(out, operand.absolute().seg, format);
+	out.put(':');
+	put_hex<M>(out, operand.absolute().offset, format);
+}
 
 //------------------------------------------------------------------------------
 // Name: 
 //------------------------------------------------------------------------------
 template <class M, class T>
-std::string format_register(const Operand<M> &operand, const T &format) {
-	return register_name<M>(operand.reg(), format);
+void format_register(format_buffer &out, const Operand<M> &operand, const T &format) {
+	out.put(register_string<M>(operand.reg(), format));
 }
 
 //------------------------------------------------------------------------------
@@ -102,17 +343,15 @@ std::string format_register(const Operand<M> &operand, const T &format) {
 // Desc: 
 //------------------------------------------------------------------------------
 template <class M, class T>
-std::string format_relative(const Operand<M> &operand, const T &format) {
-	return hex_string<M>(static_cast<typename M::address_t>(operand.relative_target()), format);
+void format_relative(format_buffer &out, const Operand<M> &operand, const T &format) {
+	put_hex<M>(out, static_cast<typename M::address_t>(operand.relative_target()), format);
 }
 
-
 //------------------------------------------------------------------------------
 // Name: 
 //------------------------------------------------------------------------------
 template <class M, class T>
-std::string format_immediate(const Operand<M> &operand, const T &format) {
-	std::ostringstream ss;
+void format_immediate(format_buffer &out, const Operand<M> &operand, const T &format) {
 
 	switch(operand.complete_type()) {
 	case Operand<M>::TYPE_IMMEDIATE64:
@@ -120,9 +359,9 @@ std::string format_immediate(const Operand<M> &operand, const T &format) {
 			// this will lead to a fall through, we can print smaller
 		} else {
 			if(util::is_small_num(operand.sqword())) {
-				ss << operand.sqword();
+				put_decimal(out, operand.sqword(), false);
 			} else {
-				ss << hex_string<M>(operand.sqword(), format);
+				put_hex<M>(out, operand.sqword(), format);
 			}
 			break;
 		}
@@ -132,9 +371,9 @@ std::string format_immediate(const Operand<M> &operand, const T &format) {
 			// this will lead to a fall through, we can print smaller
 		} else {
 			if(util::is_small_num(operand.sdword())) {
-				ss << operand.sdword();
+				put_decimal(out, operand.sdword(), false);
 			} else {
-				ss << hex_string<M>(operand.sdword(), format);
+				put_hex<M>(out, operand.sdword(), format);
 			}
 			break;
 		}
@@ -144,67 +383,30 @@ std::string format_immediate(const Operand<M> &operand, const T &format) {
 			// this will lead to a fall through, we can print smaller
 		} else {
 			if(util::is_small_num(operand.sword())) {
-				ss << operand.sword();
+				put_decimal(out, operand.sword(), false);
 			} else {
-				ss << hex_string<M>(operand.sword(), format);
+				put_hex<M>(out, operand.sword(), format);
 			}
 			break;
 		}
 		// FALL THROUGH
 	case Operand<M>::TYPE_IMMEDIATE8:
 		if(operand.sbyte() & 0x80) {
-			ss << hex_string<M>(operand.byte(), format);
+			put_hex<M>(out, operand.byte(), format);
 		} else {
-			ss << static_cast<int>(operand.sbyte());
+			put_decimal(out, operand.sbyte(), false);
 		}
 		break;
 	default:
 		break;
 	}
-
-	return ss.str();
-}
-
-//------------------------------------------------------------------------------
-// Name: format_prefix(const Instruction<M> &insn, const lower_case &)
-//------------------------------------------------------------------------------
-template <class M>
-std::string format_prefix(const Instruction<M> &insn, const lower_case &) {
-	std::string ret;
-
-	if((insn.prefix() & Instruction<M>::PREFIX_LOCK) && !(insn.mandatory_prefix() & Instruction<M>::PREFIX_LOCK)) {
-		
-		// TODO: this is only legal for the memory dest versions of:
-		// ADD, ADC, AND, BTC, BTR, BTS, CMPXCHG, CMPXCH8B, (CMPXCH16B?)
-		// DEC, INC, NEG, NOT, OR, SBB, SUB, XOR, XADD, XCHG
-		
-		ret = "lock ";
-
-	} else if((insn.prefix() & Instruction<M>::PREFIX_REP) && !(insn.mandatory_prefix() & Instruction<M>::PREFIX_REP)) {
-		if(insn.type() == Instruction<M>::OP_CMPS || insn.type() == Instruction<M>::OP_SCAS) {
-			ret = "repe ";
-		} else {
-			
-			// TODO: this is only legal for:
-			// INS, OUTS, MOVS, LODS and STOS
-			
-			ret = "rep ";
-		}
-	} else if((insn.prefix() & Instruction<M>::PREFIX_REPNE) && !(insn.mandatory_prefix() & Instruction<M>::PREFIX_REPNE)) {
-		// TODO: this is only legal for:
-		// CMPS and SCAS
-		ret = "repne ";
-	}
-
-	return ret;
 }
 
 //------------------------------------------------------------------------------
-// Name: format_prefix(const Instruction<M> &insn, const upper_case &)
+// Name: format_prefix(format_buffer &out, const Instruction<M> &insn, const T &format)
 //------------------------------------------------------------------------------
-template <class M>
-std::string format_prefix(const Instruction<M> &insn, const upper_case &) {
-	std::string ret;
+template <class M, class T>
+void format_prefix(format_buffer &out, const Instruction<M> &insn, const T &format) {
 
 	if((insn.prefix() & Instruction<M>::PREFIX_LOCK) && !(insn.mandatory_prefix() & Instruction<M>::PREFIX_LOCK)) {
 		
@@ -212,36 +414,45 @@ std::string format_prefix(const Instruction<M> &insn, const upper_case &) {
 		// ADD, ADC, AND, BTC, BTR, BTS, CMPXCHG, CMPXCH8B, (CMPXCH16B?)
 		// DEC, INC, NEG, NOT, OR, SBB, SUB, XOR, XADD, XCHG
 		
-		ret = "LOCK ";
+		out.put(select(format, "lock ", "LOCK "));
 
 	} else if((insn.prefix() & Instruction<M>::PREFIX_REP) && !(insn.mandatory_prefix() & Instruction<M>::PREFIX_REP)) {
 		if(insn.type() == Instruction<M>::OP_CMPS || insn.type() == Instruction<M>::OP_SCAS) {
-			ret = "REPE ";
+			out.put(select(format, "repe ", "REPE "));
 		} else {
 			
 			// TODO: this is only legal for:
 			// INS, OUTS, MOVS, LODS and STOS
 			
-			ret = "REP ";
+			out.put(select(format, "rep ", "REP "));
 		}
 	} else if((insn.prefix() & Instruction<M>::PREFIX_REPNE) && !(insn.mandatory_prefix() & Instruction<M>::PREFIX_REPNE)) {
 		// TODO: this is only legal for:
 		// CMPS and SCAS
-		ret = "REPNE ";
+		out.put(select(format, "repne ", "REPNE "));
 	}
-
-	return ret;
 }
 
 //------------------------------------------------------------------------------
 // Name: 
 //------------------------------------------------------------------------------
-template <class M>
-std::string format_expression(const Operand<M> &operand, const upper_case &format) {
+template <class M, class T>
+void format_expression(format_buffer &out, const Operand<M> &operand, const T &format) {
 
 	typedef Instruction<M> instruction_t;
 
-	static const char *expression_strings[] = {
+	static const char *lower_expression_strings[] = {
+		"",
+		"byte ptr ",
+		"word ptr ",
+		"dword ptr ",
+		"fword ptr ",
+		"qword ptr ",
+		"tbyte ptr ",
+		"xmmword ptr ",
+	};
+
+	static const char *upper_expression_strings[] = {
 		"",
 		"BYTE PTR ",
 		"WORD PTR ",
@@ -252,39 +463,40 @@ std::string format_expression(const Operand<M> &operand, const upper_case &forma
 		"XMMWORD PTR ",
 	};
 
-	std::ostringstream ss;
-	ss << expression_strings[operand.complete_type() - Operand<M>::TYPE_EXPRESSION];
+	const std::size_t expression_index = operand.complete_type() - Operand<M>::TYPE_EXPRESSION;
+	out.put(select(format, lower_expression_strings[expression_index], upper_expression_strings[expression_index]));
 
 	const uint32_t prefix = operand.owner()->prefix();
 
-	if(prefix & instruction_t::PREFIX_CS)      ss << "CS:";
-	else if(prefix & instruction_t::PREFIX_SS) ss << "SS:";
-	else if(prefix & instruction_t::PREFIX_DS) ss << "DS:";
-	else if(prefix & instruction_t::PREFIX_ES) ss << "ES:";
-	else if(prefix & instruction_t::PREFIX_FS) ss << "FS:";
-	else if(prefix & instruction_t::PREFIX_GS) ss << "GS:";
+	if(prefix & instruction_t::PREFIX_CS)      out.put(select(format, "cs:", "CS:"));
+	else if(prefix & instruction_t::PREFIX_SS) out.put(select(format, "ss:", "SS:"));
+	else if(prefix & instruction_t::PREFIX_DS) out.put(select(format, "ds:", "DS:"));
+	else if(prefix & instruction_t::PREFIX_ES) out.put(select(format, "es:", "ES:"));
+	else if(prefix & instruction_t::PREFIX_FS) out.put(select(format, "fs:", "FS:"));
+	else if(prefix & instruction_t::PREFIX_GS) out.put(select(format, "gs:", "GS:"));
 	
 	bool only_disp = true;
 
-	ss << '[';
+	out.put('[');
 
 	// the base, if any
 	if(operand.expression().base != Operand<M>::REG_NULL) {
-		ss << register_name<M>(operand.expression().base, format);
+		out.put(register_string<M>(operand.expression().base, format));
 		only_disp = false;
 	}
 
 	// the index, if any
 	if(operand.expression().index != Operand<M>::REG_NULL) {
 		if(!only_disp) {
-			ss << '+';
+			out.put('+');
 		}
-		ss << register_name<M>(operand.expression().index, format);
+		out.put(register_string<M>(operand.expression().index, format));
 		only_disp = false;
 
 		// the scale, if any
 		if(operand.expression().scale != 1) {
-			ss << '*' << static_cast<int>(operand.expression().scale);
+			out.put('*');
+			put_decimal(out, operand.expression().scale, false);
 		}
 	}
 
@@ -295,9 +507,9 @@ std::string format_expression(const Operand<M> &operand, const upper_case &forma
 			// this will lead to a fall through, we can print smaller
 		} else {
 			if(!only_disp) {
-				ss << '+';
+				out.put('+');
 			}
-			ss << hex_string<M>(operand.expression().u_disp32, format);
+			put_hex<M>(out, operand.expression().u_disp32, format);
 			break;
 		}
 		// FALL THROUGH
@@ -306,18 +518,18 @@ std::string format_expression(const Operand<M> &operand, const upper_case &forma
 			// this will lead to a fall through, we can print smaller
 		} else {
 			if(!only_disp) {
-				ss << '+';
+				out.put('+');
 			}
-			ss << hex_string<M>(operand.expression().u_disp16, format);
+			put_hex<M>(out, operand.expression().u_disp16, format);
 			break;
 		}
 		// FALL THROUGH
 	case Operand<M>::DISP_U8:
 		if(operand.expression().u_disp8 != 0 || only_disp) {
 			if(!only_disp) {
-				ss << '+';
+				out.put('+');
 			}
-			ss << hex_string<M>(operand.expression().u_disp8, format);
+			put_hex<M>(out, operand.expression().u_disp8, format);
 		}
 		break;
 
@@ -325,13 +537,11 @@ std::string format_expression(const Operand<M> &operand, const upper_case &forma
 		if(operand.expression().s_disp32 <= std::numeric_limits<int16_t>::max() && operand.expression().s_disp32 >= std::numeric_limits<int16_t>::min()) {
 			// this will lead to a fall through, we can print smaller
 		} else {
-			if(only_disp) {
-				// we only have a displacement, so we wanna display in hex since it is likely an address
-				ss << hex_string<M>(operand.expression().s_disp32, format);
-			} else {
-				ss << '+';
-				ss << hex_string<M>(operand.expression().s_disp32, format);
+			if(!only_disp) {
+				out.put('+');
 			}
+			// we only have a displacement, so we wanna display in hex since it is likely an address
+			put_hex<M>(out, operand.expression().s_disp32, format);
 			break;
 		}
 		// FALL THROUGH
@@ -341,9 +551,9 @@ std::string format_expression(const Operand<M> &operand, const upper_case &forma
 		} else {
 			if(only_disp) {
 				// we only have a displacement, so we wanna display in hex since it is likely an address
-				ss << hex_string<M>(operand.expression().s_disp16, format);
+				put_hex<M>(out, operand.expression().s_disp16, format);
 			} else {
-				ss << std::showpos << static_cast<int32_t>(operand.expression().s_disp16);
+				put_decimal(out, operand.expression().s_disp16, true);
 			}
 			break;
 		}
@@ -352,9 +562,9 @@ std::string format_expression(const Operand<M> &operand, const upper_case &forma
 		if(operand.expression().s_disp8 != 0 || only_disp) {
 			if(only_disp) {
 				// we only have a displacement, so we wanna display in hex since it is likely an address
-				ss << hex_string<M>(operand.expression().s_disp8, format);
+				put_hex<M>(out, operand.expression().s_disp8, format);
 			} else {
-				ss << std::showpos << static_cast<int32_t>(operand.expression().s_disp8);
+				put_decimal(out, operand.expression().s_disp8, true);
 			}
 		}
 		break;
@@ -362,144 +572,64 @@ std::string format_expression(const Operand<M> &operand, const upper_case &forma
 	default:
 		break;
 	}
-	ss << ']';
-
-	return ss.str();
+	out.put(']');
 }
 
-
 //------------------------------------------------------------------------------
-// Name: 
+// Name: format_operand(format_buffer &out, const Operand<M> &operand, const T &format)
 //------------------------------------------------------------------------------
-template <class M>
-std::string format_expression(const Operand<M> &operand, const lower_case &format) {
-
-	typedef Instruction<M> instruction_t;
+template <class M, class T>
+void format_operand(format_buffer &out, const Operand<M> &operand, const T &format) {
+	
+	switch(operand.general_type()) {
+	case Operand<M>::TYPE_ABSOLUTE:   format_absolute(out, operand, format);   break;
+	case Operand<M>::TYPE_EXPRESSION: format_expression(out, operand, format); break;
+	case Operand<M>::TYPE_IMMEDIATE:  format_immediate(out, operand, format);  break;
+	case Operand<M>::TYPE_REGISTER:   format_register(out, operand, format);   break;
+	case Operand<M>::TYPE_REL:        format_relative(out, operand, format);   break;
+	default:
+		out.put(register_string<M>(Operand<M>::REG_INVALID, format));
+		// is it better to throw, or return a string?
+		//throw invalid_operand(owner_->size());
+		break;
+	}
+}
 
-	static const char *expression_strings[] = {
-		"",
-		"byte ptr ",
-		"word ptr ",
-		"dword ptr ",
-		"fword ptr ",
-		"qword ptr ",
-		"tbyte ptr ",
-		"xmmword ptr ",
-	};
+//------------------------------------------------------------------------------
+// Name: format_instruction(format_buffer &out, const Instruction<M> &insn, const T &format)
+//------------------------------------------------------------------------------
+template <class M, class T>
+void format_instruction(format_buffer &out, const Instruction<M> &insn, const T &format) {
 
-	std::ostringstream ss;
-	ss << expression_strings[operand.complete_type() - Operand<M>::TYPE_EXPRESSION];
+	format_prefix(out, insn, format);
+	put_mnemonic(out, insn.mnemonic_c_str(), format);
 
-	const uint32_t prefix = operand.owner()->prefix();
-
-	if(prefix & instruction_t::PREFIX_CS)      ss << "cs:";
-	else if(prefix & instruction_t::PREFIX_SS) ss << "ss:";
-	else if(prefix & instruction_t::PREFIX_DS) ss << "ds:";
-	else if(prefix & instruction_t::PREFIX_ES) ss << "es:";
-	else if(prefix & instruction_t::PREFIX_FS) ss << "fs:";
-	else if(prefix & instruction_t::PREFIX_GS) ss << "gs:";
-	
-	bool only_disp = true;
-
-	ss << '[';
-
-	// the base, if any
-	if(operand.expression().base != Operand<M>::REG_NULL) {
-		ss << register_name<M>(operand.expression().base, format);
-		only_disp = false;
-	}
-
-	// the index, if any
-	if(operand.expression().index != Operand<M>::REG_NULL) {
-		if(!only_disp) {
-			ss << '+';
-		}
-		ss << register_name<M>(operand.expression().index, format);
-		only_disp = false;
-
-		// the scale, if any
-		if(operand.expression().scale != 1) {
-			ss << '*' << static_cast<int>(operand.expression().scale);
+	const std::size_t count = insn.operand_count();
+	if(count != 0) {
+		out.put(' ');
+		format_operand(out, insn.operand(0), format);
+		for(std::size_t i = 1; i < count; ++i) {
+			out.put(", ");
+			format_operand(out, insn.operand(i), format);
 		}
 	}
+}
 
-	// the displacement, if any
-	switch(operand.expression().displacement_type) {
-	case Operand<M>::DISP_U32:
-		if(operand.expression().u_disp32 <= std::numeric_limits<uint16_t>::max()) {
-			// this will lead to a fall through, we can print smaller
-		} else {
-			if(!only_disp) {
-				ss << '+';
-			}
-			ss << hex_string<M>(operand.expression().u_disp32, format);
-			break;
-		}
-		// FALL THROUGH
-	case Operand<M>::DISP_U16:
-		if(operand.expression().u_disp16 <= std::numeric_limits<uint8_t>::max()) {
-			// this will lead to a fall through, we can print smaller
-		} else {
-			if(!only_disp) {
-				ss << '+';
-			}
-			ss << hex_string<M>(operand.expression().u_disp16, format);
-			break;
-		}
-		// FALL THROUGH
-	case Operand<M>::DISP_U8:
-		if(operand.expression().u_disp8 != 0 || only_disp) {
-			if(!only_disp) {
-				ss << '+';
-			}
-			ss << hex_string<M>(operand.expression().u_disp8, format);
-		}
-		break;
+//------------------------------------------------------------------------------
+// Name: format_bytes(format_buffer &out, const Instruction<M> &insn, const T &format)
+//------------------------------------------------------------------------------
+template <class M, class T>
+void format_bytes(format_buffer &out, const Instruction<M> &insn, const T &format) {
 
-	case Operand<M>::DISP_S32:
-		if(operand.expression().s_disp32 <= std::numeric_limits<int16_t>::max() && operand.expression().s_disp32 >= std::numeric_limits<int16_t>::min()) {
-			// this will lead to a fall through, we can print smaller
-		} else {
-			if(only_disp) {
-				// we only have a displacement, so we wanna display in hex since it is likely an address
-				ss << hex_string<M>(operand.expression().s_disp32, format);
-			} else {
-				ss << '+';
-				ss << hex_string<M>(operand.expression().s_disp32, format);
-			}
-			break;
-		}
-		// FALL THROUGH
-	case Operand<M>::DISP_S16:
-		if(operand.expression().s_disp16 <= std::numeric_limits<int8_t>::max() && operand.expression().s_disp16 >= std::numeric_limits<int8_t>::min()) {
-			// this will lead to a fall through, we can print smaller
-		} else {
-			if(only_disp) {
-				// we only have a displacement, so we wanna display in hex since it is likely an address
-				ss << hex_string<M>(operand.expression().s_disp16, format);
-			} else {
-				ss << std::showpos << static_cast<int32_t>(operand.expression().s_disp16);
-			}
-			break;
-		}
-		// FALL THROUGH
-	case Operand<M>::DISP_S8:
-		if(operand.expression().s_disp8 != 0 || only_disp) {
-			if(only_disp) {
-				// we only have a displacement, so we wanna display in hex since it is likely an address
-				ss << hex_string<M>(operand.expression().s_disp8, format);
-			} else {
-				ss << std::showpos << static_cast<int32_t>(operand.expression().s_disp8);
-			}
+	const uint8_t *const ptr = insn.bytes();
+	const unsigned int size = insn.size();
+	if(size != 0) {
+		put_byte(out, ptr[0], format);
+		for(unsigned int i = 1; i < size; ++i) {
+			out.put(' ');
+			put_byte(out, ptr[i], format);
 		}
-		break;
-
-	default:
-		break;
 	}
-	ss << ']';
-
-	return ss.str();
 }
 
 }
@@ -509,68 +639,8 @@ std::string format_expression(const Operand<M> &operand, const lower_case &forma
 // Desc: returns a string for a given register
 //------------------------------------------------------------------------------
 template <class M>
-std::string register_name(typename Operand<M>::Register reg, const lower_case&) {
-
-	static const char *names[] = {
-		"",
-
-		"rax",	"rcx",	"rdx",	"rbx",
-		"rsp",	"rbp",	"rsi",	"rdi",
-		"r8",	"r9",	"r10",	"r11",
-		"r12",	"r13",	"r14",	"r15",
-
-		"eax",	"ecx",	"edx",	"ebx",
-		"esp",	"ebp",	"esi",	"edi",
-		"r8d",	"r9d",	"r10d",	"r11d",
-		"r12d",	"r13d",	"r14d",	"r15d",
-
-		"ax",	"cx",	"dx",	"bx",
-		"sp",	"bp",	"si",	"di",
-		"r8w",	"r9w",	"r10w",	"r11w",
-		"r12w",	"r13w",	"r14w",	"r15w",
-
-		"al",	"cl",	"dl",	"bl",
-		"ah",	"ch",	"dh",	"bh",
-		"r8b",	"r9b",	"r10b",	"r11b",
-		"r12b",	"r13b",	"r14b",	"r15b",
-		"spl",	"bpl",	"sil",	"dil",
-
-		"es",	"cs",	"ss",	"ds",
-		"fs",	"gs",	"seg7",	"seg8",
-
-		"cr0",	"cr1",	"cr2",	"cr3",
-		"cr4",	"cr5",	"cr6",	"cr7",
-		"cr8",	"cr9",	"cr10",	"cr11",
-		"cr12",	"cr13",	"cr14",	"cr15",
-
-		"dr0",	"dr1",	"dr2",	"dr3",
-		"dr4",	"dr5",	"dr6",	"dr7",
-		"dr8",	"dr9",	"dr10",	"dr11",
-		"dr12",	"dr13",	"dr14",	"dr15",
-
-		"tr0",	"tr1",	"tr2",	"tr3",
-		"tr4",	"tr5",	"tr6",	"tr7",
-
-		"mm0",	"mm1",	"mm2",	"mm3",
-		"mm4",	"mm5",	"mm6",	"mm7",
-
-		"xmm0",	"xmm1",	"xmm2",	"xmm3",
-		"xmm4",	"xmm5",	"xmm6",	"xmm7",
-		"xmm8",	"xmm9",	"xmm10","xmm11",
-		"xmm12","xmm13","xmm14","xmm15",
-
-		"st",
-		"st(0)", "st(1)", "st(2)", "st(3)",
-		"st(4)", "st(5)", "st(6)", "st(7)",
-
-		"rip",
-		"eip",
-
-		"(invalid)"
-	};
-
-	assert(static_cast<size_t>(reg) < sizeof(names) / sizeof(names[0]));
-	return names[reg];
+std::string register_name(typename Operand<M>::Register reg, const lower_case &format) {
+	return register_string<M>(reg, format);
 }
 
 //------------------------------------------------------------------------------
@@ -578,175 +648,82 @@ std::string register_name(typename Operand<M>::Register reg, const lower_case&)
 // Desc: returns a string for a given register
 //------------------------------------------------------------------------------
 template <class M>
-std::string register_name(typename Operand<M>::Register reg, const upper_case&) {
-
-	static const char *names[] = {
-		"",
-
-		"RAX",	"RCX",	"RDX",	"RBX",
-		"RSP",	"RBP",	"RSI",	"RDI",
-		"R8",	"R9",	"R10",	"R11",
-		"R12",	"R13",	"R14",	"R15",
-
-		"EAX",	"ECX",	"EDX",	"EBX",
-		"ESP",	"EBP",	"ESI",	"EDI",
-		"R8D",	"R9D",	"R10D",	"R11D",
-		"R12D",	"R13D",	"R14D",	"R15D",
-
-		"AX",	"CX",	"DX",	"BX",
-		"SP",	"BP",	"SI",	"DI",
-		"R8W",	"R9W",	"R10W",	"R11W",
-		"R12W",	"R13W",	"R14W",	"R15W",
-
-		"AL",	"CL",	"DL",	"BL",
-		"AH",	"CH",	"DH",	"BH",
-		"R8B",	"R9B",	"R10B",	"R11B",
-		"R12B",	"R13B",	"R14B",	"R15B",
-		"SPL",	"BPL",	"SIL",	"DIL",
-
-		"ES",	"CS",	"SS",	"DS",
-		"FS",	"GS",	"SEG7",	"SEG8",
-
-		"CR0",	"CR1",	"CR2",	"CR3",
-		"CR4",	"CR5",	"CR6",	"CR7",
-		"CR8",	"CR9",	"CR10",	"CR11",
-		"CR12",	"CR13",	"CR14",	"CR15",
-
-		"DR0",	"DR1",	"DR2",	"DR3",
-		"DR4",	"DR5",	"DR6",	"DR7",
-		"DR8",	"DR9",	"DR10",	"DR11",
-		"DR12",	"DR13",	"DR14",	"DR15",
-
-		"TR0",	"TR1",	"TR2",	"TR3",
-		"TR4",	"TR5",	"TR6",	"TR7",
-
-		"MM0",	"MM1",	"MM2",	"MM3",
-		"MM4",	"MM5",	"MM6",	"MM7",
-
-		"XMM0",	"XMM1",	"XMM2",	"XMM3",
-		"XMM4",	"XMM5",	"XMM6",	"XMM7",
-		"XMM8",	"XMM9",	"XMM10","XMM11",
-		"XMM12","XMM13","XMM14","XMM15",
-
-		"ST",
-		"ST(0)", "ST(1)", "ST(2)", "ST(3)",
-		"ST(4)", "ST(5)", "ST(6)", "ST(7)",
-
-		"RIP",
-		"EIP",
-
-		"(INVALID)"
-	};
-
-	assert(static_cast<size_t>(reg) < sizeof(names) / sizeof(names[0]));
-	return names[reg];
+std::string register_name(typename Operand<M>::Register reg, const upper_case &format) {
+	return register_string<M>(reg, format);
 }
 
-
 //------------------------------------------------------------------------------
-// Name: 
-// Desc: 
+// Name: format(const Instruction<M> &insn, char *buffer, std::size_t size, const T &format)
+// Desc: writes the given instruction into buffer, returns the length written
 //------------------------------------------------------------------------------
-template<class M, class T>
-std::string to_string(const Operand<M> &operand, const T &format) {
-	
-	switch(operand.general_type()) {
-	case Operand<M>::TYPE_ABSOLUTE:   return format_absolute(operand, format);
-	case Operand<M>::TYPE_EXPRESSION: return format_expression(operand, format);
-	case Operand<M>::TYPE_IMMEDIATE:  return format_immediate(operand, format);
-	case Operand<M>::TYPE_REGISTER:   return format_register(operand, format);
-	case Operand<M>::TYPE_REL:        return format_relative(operand, format);
-	default:
-		return register_name<M>(Operand<M>::REG_INVALID, format);
-		// is it better to throw, or return a string?
-		//throw invalid_operand(owner_->size());
-	}
+template <class M, class T>
+std::size_t format(const Instruction<M> &insn, char *buffer, std::size_t size, const T &format) {
+	format_buffer out(buffer, size);
+	format_instruction(out, insn, format);
+	return out.size();
 }
 
 //------------------------------------------------------------------------------
-// Name: to_string(const Instruction<M> &insn, const syntax_intel_lcase &syntax)
-// Desc: creates a std::string which represents the given instruction
+// Name: format(const Operand<M> &operand, char *buffer, std::size_t size, const T &format)
+// Desc: writes the given operand into buffer, returns the length written
 //------------------------------------------------------------------------------
-template <class M>
-std::string to_string(const Instruction<M> &insn, const syntax_intel_lcase &syntax) {
-
-	std::ostringstream ss;
-
-	ss << format_prefix(insn, syntax);
-	ss << insn.mnemonic();
-
-	const std::size_t count = insn.operand_count();
-	if(count != 0) {
-		ss << ' ' << to_string(insn.operand(0), syntax);
-		for(std::size_t i = 1; i < count; ++i) {
-			ss << ", " << to_string(insn.operand(i), syntax);
-		}
-	}
-
-	return ss.str();
+template <class M, class T>
+std::size_t format(const Operand<M> &operand, char *buffer, std::size_t size, const T &format) {
+	format_buffer out(buffer, size);
+	format_operand(out, operand, format);
+	return out.size();
 }
 
 //------------------------------------------------------------------------------
-// Name: to_string(const Instruction<M> &insn, const syntax_intel_ucase &syntax)
-// Desc: creates a std::string which represents the given instruction
+// Name: format(const Instruction<M> &insn, std::string &s, const T &format)
+// Desc: replaces the contents of s with the given instruction
 //------------------------------------------------------------------------------
-template <class M>
-std::string to_string(const Instruction<M> &insn, const syntax_intel_ucase &syntax) {
-	
-	std::ostringstream ss;
-
-	ss << format_prefix(insn, syntax);
-	ss << util::toupper_copy(insn.mnemonic());
-
-	const std::size_t count = insn.operand_count();
-	if(count != 0) {
-		ss << ' ' << to_string(insn.operand(0), syntax);
-		for(std::size_t i = 1; i < count; ++i) {
-			ss << ", " << to_string(insn.operand(i), syntax);
-		}
-	}
+template <class M, class T>
+std::string &format(const Instruction<M> &insn, std::string &s, const T &format) {
+	char buffer[FORMAT_BUFFER_SIZE];
+	return s.assign(buffer, edisassm::format(insn, buffer, sizeof(buffer), format));
+}
 
-	return ss.str();
+//------------------------------------------------------------------------------
+// Name: format_bytes(const Instruction<M> &insn, char *buffer, std::size_t size, const T &format)
+// Desc: writes the bytes of the given instruction into buffer, returns the
+//       length written
+//------------------------------------------------------------------------------
+template <class M, class T>
+std::size_t format_bytes(const Instruction<M> &insn, char *buffer, std::size_t size, const T &format) {
+	format_buffer out(buffer, size);
+	format_bytes(out, insn, format);
+	return out.size();
 }
 
+//------------------------------------------------------------------------------
+// Name: 
+// Desc: 
+//------------------------------------------------------------------------------
+template<class M, class T>
+std::string to_string(const Operand<M> &operand, const T &format) {
+	char buffer[FORMAT_BUFFER_SIZE];
+	return std::string(buffer, edisassm::format(operand, buffer, sizeof(buffer), format));
+}
 
 //------------------------------------------------------------------------------
-// Name: to_byte_string(const Instruction<M> &insn, const upper_case&)
+// Name: to_string(const Instruction<M> &insn, const T &format)
 // Desc: creates a std::string which represents the given instruction
 //------------------------------------------------------------------------------
-template <class M>
-std::string to_byte_string(const Instruction<M> &insn, const upper_case&) {
-
-	std::ostringstream ss;
-
-	const uint8_t *const ptr = insn.bytes();
-	const unsigned int size = insn.size();
-	if(size != 0) {
-		ss << std::hex << std::uppercase << std::setw(2) << std::setfill('0') << static_cast<uint32_t>(ptr[0]);
-		for(unsigned int i = 1; i < size; ++i) {
-			ss << ' ' << std::uppercase << std::hex << std::setw(2) << std::setfill('0') << static_cast<uint32_t>(ptr[i]);
-		}
-	}
-	return ss.str();
-
-	
+template <class M, class T>
+std::string to_string(const Instruction<M> &insn, const T &format) {
+	char buffer[FORMAT_BUFFER_SIZE];
+	return std::string(buffer, edisassm::format(insn, buffer, sizeof(buffer), format));
 }
 
 //------------------------------------------------------------------------------
-// Name: to_byte_string(const Instruction<M> &insn, const lower_case&)
+// Name: to_byte_string(const Instruction<M> &insn, const T &format)
 // Desc: creates a std::string which represents the given instruction
 //------------------------------------------------------------------------------
-template <class M>
-std::string to_byte_string(const Instruction<M> &insn, const lower_case&) {
-	std::ostringstream ss;
-	
-	const uint8_t *const ptr = insn.bytes();
-	
-	ss << std::hex << std::setw(2) << std::setfill('0') << static_cast<uint32_t>(ptr[0]);
-	for(unsigned int i = 1; i < insn.size(); ++i) {
-		ss << ' ' << std::hex << std::setw(2) << std::setfill('0') << static_cast<uint32_t>(ptr[i]);
-	}
-	return ss.str();
+template <class M, class T>
+std::string to_byte_string(const Instruction<M> &insn, const T &format) {
+	char buffer[FORMAT_BUFFER_SIZE];
+	return std::string(buffer, edisassm::format_bytes(insn, buffer, sizeof(buffer), format));
 }
 
 }
@@ -0,0 +1,381 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Instruction.h"
+#include "edisassm_length.h"
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <new>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+// measures decoder and formatter throughput over a few corpora. the decoders
+// and the buffer based formatter are expected to be allocation free, and a
+// linear sweep with the length classifier has to step through exactly the
+// same instructions as one with the full decoder. if either ever stops being
+// true this exits with a non-zero status so that the regression shows up in
+// ctest
+
+namespace {
+
+std::size_t allocation_count = 0;
+
+struct corpus_t {
+	std::string          name;
+	std::vector<uint8_t> bytes;
+};
+
+struct result_t {
+	std::size_t count;       // instructions seen
+	double      rate;        // instructions per second
+	double      allocations; // allocations per instruction
+};
+
+//------------------------------------------------------------------------------
+// Name: random_corpus(std::size_t size)
+// Desc: uniformly random bytes, the worst case for the decoder
+//------------------------------------------------------------------------------
+corpus_t random_corpus(std::size_t size) {
+	corpus_t corpus;
+	corpus.name = "random";
+	corpus.bytes.resize(size);
+
+	uint32_t seed = 0x20080414;
+	for(std::size_t i = 0; i < size; ++i) {
+		seed = seed * 1103515245 + 12345;
+		corpus.bytes[i] = static_cast<uint8_t>(seed >> 16);
+	}
+	return corpus;
+}
+
+//------------------------------------------------------------------------------
+// Name: synthetic_corpus(std::size_t size)
+// Desc: a pseudo-random mix of typical compiler output
+//------------------------------------------------------------------------------
+corpus_t synthetic_corpus(std::size_t size) {
+	static const struct {
+		unsigned    size;
+		const char *bytes;
+	} samples[] = {
+		{1, "\x55"},                              // push ebp
+		{2, "\x89\xe5"},                          // mov ebp, esp
+		{3, "\x83\xec\x18"},                      // sub esp, 0x18
+		{3, "\x8b\x45\x08"},                      // mov eax, [ebp+8]
+		{4, "\x8b\x44\x24\x04"},                  // mov eax, [esp+4]
+		{6, "\x8b\x80\x00\x01\x00\x00"},          // mov eax, [eax+0x100]
+		{2, "\x85\xc0"},                          // test eax, eax
+		{2, "\x74\x10"},                          // jz
+		{6, "\x0f\x85\x10\x01\x00\x00"},          // jnz
+		{5, "\xe8\x00\x10\x00\x00"},              // call
+		{5, "\xe9\x00\x10\x00\x00"},              // jmp
+		{2, "\xff\xd0"},                          // call eax
+		{3, "\x0f\xb6\xc0"},                      // movzx eax, al
+		{3, "\x0f\x44\xc1"},                      // cmovz eax, ecx
+		{7, "\xc7\x45\xfc\x00\x00\x00\x00"},      // mov dword ptr [ebp-4], 0
+		{3, "\x8d\x04\x89"},                      // lea eax, [ecx+ecx*4]
+		{2, "\x31\xc0"},                          // xor eax, eax
+		{3, "\xc1\xe0\x02"},                      // shl eax, 2
+		{4, "\x66\x0f\x6f\xc1"},                  // movdqa xmm0, xmm1
+		{5, "\xf3\x0f\x10\x45\xf8"},              // movss xmm0, [ebp-8]
+		{3, "\xd9\x45\x08"},                      // fld dword ptr [ebp+8]
+		{1, "\xc9"},                              // leave
+		{1, "\xc3"},                              // ret
+		{1, "\x90"},                              // nop
+	};
+
+	corpus_t corpus;
+	corpus.name = "synthetic";
+	corpus.bytes.reserve(size + 16);
+
+	uint32_t seed = 0x20110816;
+	while(corpus.bytes.size() < size) {
+		seed = seed * 1103515245 + 12345;
+		const std::size_t n = (seed >> 16) % (sizeof(samples) / sizeof(samples[0]));
+		corpus.bytes.insert(corpus.bytes.end(), samples[n].bytes, samples[n].bytes + samples[n].size);
+	}
+	return corpus;
+}
+
+//------------------------------------------------------------------------------
+// Name: file_corpus(const char *filename)
+//------------------------------------------------------------------------------
+corpus_t file_corpus(const char *filename) {
+	corpus_t corpus;
+
+	const char *const slash = std::strrchr(filename, '/');
+	corpus.name = slash ? slash + 1 : filename;
+
+	std::ifstream file(filename, std::ios::binary);
+	corpus.bytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return corpus;
+}
+
+//------------------------------------------------------------------------------
+// Name: elapsed(std::clock_t start)
+//------------------------------------------------------------------------------
+double elapsed(std::clock_t start) {
+	return static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+//------------------------------------------------------------------------------
+// Name: make_result(std::size_t count, double seconds, std::size_t allocations)
+//------------------------------------------------------------------------------
+result_t make_result(std::size_t count, double seconds, std::size_t allocations) {
+	result_t result;
+	result.count       = count;
+	result.rate        = (seconds > 0) ? count / seconds : 0;
+	result.allocations = count ? static_cast<double>(allocations) / count : 0;
+	return result;
+}
+
+//------------------------------------------------------------------------------
+// Name: bench_decode(const std::vector<uint8_t> &bytes, int rounds)
+// Desc: linear sweep with the full decoder
+//------------------------------------------------------------------------------
+template <class M>
+result_t bench_decode(const std::vector<uint8_t> &bytes, int rounds) {
+	std::size_t count = 0;
+	const std::size_t allocations = allocation_count;
+	const std::clock_t start = std::clock();
+
+	for(int r = 0; r < rounds; ++r) {
+		for(std::size_t i = 0; i < bytes.size(); ++count) {
+			const Instruction<M> insn(&bytes[i], bytes.size() - i, i, std::nothrow);
+			i += insn.valid() ? insn.size() : 1;
+		}
+	}
+
+	return make_result(count, elapsed(start), allocation_count - allocations);
+}
+
+//------------------------------------------------------------------------------
+// Name: bench_length(const std::vector<uint8_t> &bytes, int rounds)
+// Desc: linear sweep with the length classifier
+//------------------------------------------------------------------------------
+template <class M>
+result_t bench_length(const std::vector<uint8_t> &bytes, int rounds) {
+	std::size_t count = 0;
+	const std::size_t allocations = allocation_count;
+	const std::clock_t start = std::clock();
+
+	for(int r = 0; r < rounds; ++r) {
+		for(std::size_t i = 0; i < bytes.size(); ++count) {
+			edisassm::length_info<M> info;
+			i += edisassm::decode_length(&bytes[i], bytes.size() - i, i, info) ? info.size : 1;
+		}
+	}
+
+	return make_result(count, elapsed(start), allocation_count - allocations);
+}
+
+//------------------------------------------------------------------------------
+// Name: decode_all(const std::vector<uint8_t> &bytes)
+// Desc: every valid instruction of a linear sweep
+//------------------------------------------------------------------------------
+template <class M>
+std::vector<Instruction<M> > decode_all(const std::vector<uint8_t> &bytes) {
+	std::vector<Instruction<M> > instructions;
+	for(std::size_t i = 0; i < bytes.size(); ) {
+		const Instruction<M> insn(&bytes[i], bytes.size() - i, i, std::nothrow);
+		if(insn.valid()) {
+			instructions.push_back(insn);
+			i += insn.size();
+		} else {
+			i += 1;
+		}
+	}
+	return instructions;
+}
+
+//------------------------------------------------------------------------------
+// Name: bench_format(const std::vector<uint8_t> &bytes, int rounds)
+// Desc: formats every valid instruction of a linear sweep, decoding is done
+//       up front so that only the formatter is timed
+//------------------------------------------------------------------------------
+template <class M>
+result_t bench_format(const std::vector<uint8_t> &bytes, int rounds) {
+	const std::vector<Instruction<M> > instructions = decode_all<M>(bytes);
+
+	char buffer[edisassm::FORMAT_BUFFER_SIZE];
+	std::size_t count = 0;
+	std::size_t total = 0;
+	const std::size_t allocations = allocation_count;
+	const std::clock_t start = std::clock();
+
+	for(int r = 0; r < rounds; ++r) {
+		for(std::size_t i = 0; i < instructions.size(); ++i, ++count) {
+			total += edisassm::format(instructions[i], buffer, sizeof(buffer), edisassm::syntax_intel());
+		}
+	}
+
+	const result_t result = make_result(count, elapsed(start), allocation_count - allocations);
+
+	// keep the optimizer from throwing the work away
+	if(total == 0 && count != 0) {
+		std::cerr << "formatter produced no output" << std::endl;
+	}
+
+	return result;
+}
+
+//------------------------------------------------------------------------------
+// Name: bench_to_string(const std::vector<uint8_t> &bytes, int rounds)
+// Desc: like bench_format, but through edisassm::to_string which is what most
+//       callers use. it returns a std::string, so it is expected to allocate
+//------------------------------------------------------------------------------
+template <class M>
+result_t bench_to_string(const std::vector<uint8_t> &bytes, int rounds) {
+	const std::vector<Instruction<M> > instructions = decode_all<M>(bytes);
+
+	std::size_t count = 0;
+	std::size_t total = 0;
+	const std::size_t allocations = allocation_count;
+	const std::clock_t start = std::clock();
+
+	for(int r = 0; r < rounds; ++r) {
+		for(std::size_t i = 0; i < instructions.size(); ++i, ++count) {
+			total += edisassm::to_string(instructions[i]).size();
+		}
+	}
+
+	const result_t result = make_result(count, elapsed(start), allocation_count - allocations);
+
+	if(total == 0 && count != 0) {
+		std::cerr << "to_string produced no output" << std::endl;
+	}
+
+	return result;
+}
+
+//------------------------------------------------------------------------------
+// Name: run(const corpus_t &corpus, int rounds)
+// Desc: returns false if a decoder or the formatter allocated, or if the
+//       length classifier disagreed with the full decoder
+//------------------------------------------------------------------------------
+template <class M>
+bool run(const corpus_t &corpus, int rounds) {
+	const result_t decode = bench_decode<M>(corpus.bytes, rounds);
+	const result_t length = bench_length<M>(corpus.bytes, rounds);
+	const result_t format = bench_format<M>(corpus.bytes, rounds);
+	const result_t string = bench_to_string<M>(corpus.bytes, rounds);
+
+	std::printf("%-16.16s %3d-bit %13.0f %7.3f %13.0f %7.3f %13.0f %7.3f %13.0f %7.3f\n",
+		corpus.name.c_str(), M::BITS,
+		decode.rate, decode.allocations,
+		length.rate, length.allocations,
+		format.rate, format.allocations,
+		string.rate, string.allocations);
+
+	if(decode.count != length.count) {
+		std::cerr << corpus.name << ": " << M::BITS << "-bit instruction counts differ " << decode.count << " != " << length.count << std::endl;
+		return false;
+	}
+
+	return decode.allocations == 0 && length.allocations == 0 && format.allocations == 0;
+}
+
+//------------------------------------------------------------------------------
+// Name: print_usage(const char *arg0)
+//------------------------------------------------------------------------------
+void print_usage(const char *arg0) {
+	std::cerr << arg0 << " [--quick] [--rounds <n>] [<filename>...]" << std::endl;
+	std::exit(-1);
+}
+
+}
+
+//------------------------------------------------------------------------------
+// Name: operator new(std::size_t size)
+// Desc: counts every allocation the benchmarked code makes
+//------------------------------------------------------------------------------
+void *operator new(std::size_t size) throw(std::bad_alloc) {
+	++allocation_count;
+	if(void *const p = std::malloc(size ? size : 1)) {
+		return p;
+	}
+	throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) throw(std::bad_alloc) {
+	return operator new(size);
+}
+
+void operator delete(void *p) throw() {
+	std::free(p);
+}
+
+void operator delete[](void *p) throw() {
+	std::free(p);
+}
+
+//------------------------------------------------------------------------------
+// Name: main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[]) {
+
+	std::size_t synthetic_size = 4 * 1024 * 1024;
+	int rounds                 = 3;
+	std::vector<corpus_t> corpora;
+
+	for(int i = 1; i < argc; ++i) {
+		if(std::strcmp(argv[i], "--quick") == 0) {
+			synthetic_size = 64 * 1024;
+			rounds         = 1;
+		} else if(std::strcmp(argv[i], "--rounds") == 0) {
+			if(++i == argc) {
+				print_usage(argv[0]);
+			}
+			rounds = std::max(1, std::atoi(argv[i]));
+		} else if(argv[i][0] == '-') {
+			print_usage(argv[0]);
+		} else {
+			corpora.push_back(file_corpus(argv[i]));
+		}
+	}
+
+	corpora.insert(corpora.begin(), synthetic_corpus(synthetic_size));
+	corpora.insert(corpora.begin(), random_corpus(synthetic_size));
+
+	// with no files given, this executable is the real binary corpus
+	if(corpora.size() == 2) {
+		corpora.push_back(file_corpus(argv[0]));
+	}
+
+	std::printf("%-16s %7s %13s %7s %13s %7s %13s %7s %13s %7s\n", "corpus", "mode", "decode/s", "allocs", "length/s", "allocs", "format/s", "allocs", "to_string/s", "allocs");
+
+	bool ok = true;
+	for(std::size_t i = 0; i < corpora.size(); ++i) {
+		if(corpora[i].bytes.empty()) {
+			std::cerr << "could not read: " << corpora[i].name << std::endl;
+			continue;
+		}
+		ok = run<edisassm::x86>(corpora[i], rounds) && ok;
+		ok = run<edisassm::x86_64>(corpora[i], rounds) && ok;
+	}
+
+	if(!ok) {
+		std::cerr << "a decoder or the formatter allocated memory, or the decoders disagreed" << std::endl;
+		return -1;
+	}
+}
@@ -0,0 +1,16414 @@
+#ifndef EDISASSMGOLDEN_20121017_H_
+#define EDISASSMGOLDEN_20121017_H_
+
+// what the decoder produced for every offset of the two buffers built by
+// fill_random and fill_prefixed in edisassmtest.cpp, in both modes, before
+// it stopped using a heap allocated byte stream and exceptions internally.
+// Each offset is decoded with at most MAX_SIZE + 1 bytes available. Invalid
+// entries record the size at which the old decoder threw
+
+struct golden_t {
+	bool        valid;
+	unsigned    size;
+	const char *text;
+};
+
+static const int golden_count = 4096;
+
+static const golden_t golden_random32[golden_count] = {
+	{true, 3, "and byte ptr [ecx+113], al"},
+	{true, 1, "inc ecx"},
+	{true, 2, "jno 0x0000106d"},
+	{true, 4, "imul ecx, dword ptr [ebp+125], 75"},
+	{true, 1, "dec ebp"},
+	{true, 2, "jnl 0x0000104d"},
+	{true, 1, "dec ebx"},
+	{false, 2, 0},
+	{true, 2, "mov bl, dl"},
+	{true, 3, "shl dword ptr [esi-11], cl"},
+	{true, 2, "cmc"},
+	{true, 1, "cmc"},
+	{true, 1, "pop eax"},
+	{true, 5, "mov ebx, 0x5e403eea"},
+	{true, 7, "jmp far 0xbcad:0xc55e403e"},
+	{true, 2, "inc eax"},
+	{true, 1, "inc eax"},
+	{true, 1, "pop esi"},
+	{true, 6, "lds ebp, fword ptr [ebp+0x44fee0bc]"},
+	{true, 1, "lodsd"},
+	{true, 5, "mov esp, 0xfa44fee0"},
+	{true, 2, "loopne 0x00001000"},
+	{true, 4, "inc byte ptr [edx+edi*8+111]"},
+	{true, 1, "inc esp"},
+	{true, 1, "cli"},
+	{true, 1, "outsd"},
+	{true, 2, "fldenv [ecx]"},
+	{true, 3, "and dword ptr [ecx+16], ebx"},
+	{true, 1, "pop ecx"},
+	{true, 6, "adc byte ptr [eax+0x8c24a21f], dh"},
+	{true, 2, "mov al, 31"},
+	{true, 1, "pop ds"},
+	{true, 5, "mov byte ptr [0x084b8c24], al"},
+	{true, 2, "and al, 0x8c"},
+	{true, 3, "mov dword ptr [ebx+8], cs"},
+	{true, 1, "dec ebx"},
+	{true, 6, "or byte ptr [ebp+0xa3e10d86], bh"},
+	{true, 5, "mov ebp, 0xa3e10d86"},
+	{true, 6, "xchg cl, byte ptr [0x12e0a3e1]"},
+	{true, 5, "or eax, 0x12e0a3e1"},
+	{true, 2, "loope 0x00000fa5"},
+	{true, 5, "mov dword ptr [0x242212e0], eax"},
+	{true, 2, "loopne 0x00001014"},
+	{true, 2, "adc ah, byte ptr [edx]"},
+	{true, 3, "and ah, byte ptr [edx]"},
+	{true, 2, "and al, 0xe2"},
+	{true, 2, "loop 0x00000ffe"},
+	{true, 1, "cld"},
+	{true, 1, "popfd"},
+	{true, 1, "lahf"},
+	{true, 2, "jbe 0x00000fcb"},
+	{true, 1, "leave"},
+	{true, 1, "stc"},
+	{true, 1, "iret"},
+	{true, 8, "add dword ptr [esi*2+0x5cae09d8], 19"},
+	{true, 2, "add al, 117"},
+	{true, 2, "jnz 0x00000fda"},
+	{true, 2, "fmul dword ptr [ecx]"},
+	{true, 6, "or dword ptr [esi+0xe901135c], ebp"},
+	{true, 1, "scasb"},
+	{true, 1, "pop esp"},
+	{true, 2, "adc eax, dword ptr [ecx]"},
+	{true, 2, "add ecx, ebp"},
+	{true, 5, "jmp 0x6af2aa4c"},
+	{true, 1, "inc edi"},
+	{true, 7, "callf far 0x9c53:0x92156af2"},
+	{true, 3, "repne push 21"},
+	{true, 2, "push 21"},
+	{true, 5, "adc eax, 0xab9c5392"},
+	{true, 1, "xchg edx, eax"},
+	{true, 1, "push ebx"},
+	{true, 1, "pushfd"},
+	{true, 1, "stosd"},
+	{true, 7, "cmp esp, dword ptr [ebp+edx*4+0xba4bb96c]"},
+	{true, 1, "movsb"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 1, "insb"},
+	{true, 5, "mov ecx, 0xa077ba4b"},
+	{true, 1, "dec ebx"},
+	{true, 5, "mov edx, 0x302fa077"},
+	{true, 2, "jnbe 0x00000fa2"},
+	{true, 5, "mov al, byte ptr [0x41a3302f]"},
+	{true, 1, "das"},
+	{true, 6, "xor byte ptr [ebx+0x3c091641], ah"},
+	{true, 5, "mov dword ptr [0x3c091641], eax"},
+	{true, 1, "inc ecx"},
+	{true, 1, "push ss"},
+	{true, 3, "or dword ptr [esi+esi*4], edi"},
+	{true, 2, "cmp al, 0xb6"},
+	{true, 2, "mov dh, 0xbf"},
+	{true, 5, "mov edi, 0xbfaf7a2b"},
+	{true, 3, "sub edi, dword ptr [edx-81]"},
+	{true, 2, "jp 0x00000fb1"},
+	{true, 1, "scasd"},
+	{true, 5, "mov edi, 0x1cfbc500"},
+	{true, 2, "add ch, al"},
+	{true, 2, "lds edi, (invalid)"},
+	{true, 1, "sti"},
+	{true, 2, "sbb al, 0xe0"},
+	{true, 2, "loopne 0x00000fad"},
+	{true, 1, "stosd"},
+	{true, 1, "salc"},
+	{true, 1, "stosd"},
+	{true, 2, "popfd"},
+	{true, 1, "popfd"},
+	{true, 1, "cmc"},
+	{true, 7, "sub dword ptr [ebp+ebp*2+0x880f1c52], edx"},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "insd"},
+	{true, 1, "push edx"},
+	{true, 2, "sbb al, 15"},
+	{true, 6, "js 0xf3fa77bd"},
+	{true, 6, "mov byte ptr [edi+0x0df3fa67], dh"},
+	{true, 2, "mov bh, 103"},
+	{true, 2, "cli"},
+	{true, 1, "cli"},
+	{true, 6, "rep or eax, 0x6206ecb0"},
+	{true, 5, "or eax, 0x6206ecb0"},
+	{true, 2, "mov al, 0xec"},
+	{true, 1, "in al, dx"},
+	{true, 1, "push es"},
+	{true, 3, "bound esi, qword ptr [edx-78]"},
+	{true, 2, "jb 0x00000fb4"},
+	{true, 2, "mov dl, 0xeb"},
+	{true, 2, "jmp 0x00000fbd"},
+	{true, 5, "mov ebx, 0x9fd6fae1"},
+	{true, 2, "loope 0x00000ffc"},
+	{true, 1, "cli"},
+	{true, 1, "salc"},
+	{true, 1, "lahf"},
+	{true, 6, "add esp, 0x88846002"},
+	{true, 2, "les eax, fword ptr [edx]"},
+	{true, 3, "add ah, byte ptr [eax-124]"},
+	{true, 1, "pushad"},
+	{true, 6, "test byte ptr [eax+0x28e8286f], cl"},
+	{true, 3, "mov byte ptr [edi+40], ch"},
+	{true, 1, "outsd"},
+	{true, 2, "sub al, ch"},
+	{true, 5, "call 0x4dc76c2d"},
+	{true, 4, "sub byte ptr [edi+eax*8+77], bl"},
+	{true, 1, "pop esp"},
+	{false, 2, 0},
+	{true, 1, "dec ebp"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "xchg bh, byte ptr [esi]"},
+	{true, 2, "xchg edi, eax"},
+	{true, 1, "xchg edi, eax"},
+	{true, 1, "aas"},
+	{true, 1, "pop ds"},
+	{true, 3, "or ecx, dword ptr [eax+69]"},
+	{true, 1, "dec eax"},
+	{true, 1, "inc ebp"},
+	{true, 2, "lea esi, [edx]"},
+	{true, 6, "xor bl, byte ptr [edx+0x5f10e759]"},
+	{true, 7, "callf far 0x3070:0x5f10e759"},
+	{true, 1, "pop ecx"},
+	{true, 2, "out 16, eax"},
+	{true, 3, "adc byte ptr [edi+112], bl"},
+	{true, 1, "pop edi"},
+	{true, 2, "jo 0x00001032"},
+	{true, 2, "xor bh, bl"},
+	{true, 6, "fistp word ptr [ecx+0xd908512f]"},
+	{true, 1, "cdq"},
+	{true, 1, "das"},
+	{true, 1, "push ecx"},
+	{true, 2, "or cl, bl"},
+	{true, 6, "fst dword ptr [0x68582cd8]"},
+	{true, 5, "adc eax, 0x68582cd8"},
+	{true, 3, "fsubr dword ptr [eax+ebx*2]"},
+	{true, 2, "sub al, 88"},
+	{true, 1, "pop eax"},
+	{true, 5, "push 0xe1d7f073"},
+	{true, 2, "jnb 0x00000ff2"},
+	{true, 2, "lock xlat"},
+	{true, 1, "xlat"},
+	{true, 2, "loope 0x0000102c"},
+	{true, 7, "sub cl, byte ptr [esi+esi+0xd6136016]"},
+	{true, 2, "mov dword ptr [esi], seg7"},
+	{true, 2, "push ss"},
+	{true, 1, "push ss"},
+	{true, 1, "pushad"},
+	{true, 2, "adc edx, esi"},
+	{true, 1, "salc"},
+	{true, 1, "stosd"},
+	{true, 6, "mov byte ptr [eax+0x84a638b0], al"},
+	{true, 7, "xor byte ptr [eax+0x3284a638], 0xf9"},
+	{true, 2, "mov al, 56"},
+	{true, 6, "cmp byte ptr [esi+0x8cf93284], ah"},
+	{true, 1, "cmpsb"},
+	{true, 2, "test byte ptr [edx], dh"},
+	{true, 2, "xor bh, cl"},
+	{true, 1, "stc"},
+	{true, 2, "mov dword ptr [edx], ss"},
+	{true, 2, "adc bl, ch"},
+	{true, 2, "fnstsw word ptr [ecx]"},
+	{true, 2, "cmp edx, edx"},
+	{true, 6, "shl byte ptr [esi+0x59927ba0], cl"},
+	{true, 1, "cmpsb"},
+	{true, 5, "mov al, byte ptr [0xf259927b]"},
+	{true, 2, "jnp 0x00000f94"},
+	{true, 1, "xchg edx, eax"},
+	{true, 1, "pop ecx"},
+	{true, 2, "repne insd"},
+	{true, 1, "insd"},
+	{true, 5, "call 0x2d8dc1ab"},
+	{true, 1, "cmpsb"},
+	{true, 2, "mov cl, 0x8d"},
+	{true, 6, "lea ebp, [0xee98bdfa]"},
+	{true, 5, "sub eax, 0xee98bdfa"},
+	{true, 1, "cli"},
+	{true, 5, "mov ebp, 0x53fdee98"},
+	{true, 1, "cwde"},
+	{true, 1, "out dx, al"},
+	{true, 1, "std"},
+	{true, 1, "push ebx"},
+	{true, 2, "mov bh, 0xae"},
+	{true, 1, "scasb"},
+	{true, 5, "mov dword ptr [0xf160692b], eax"},
+	{true, 3, "sub ebp, dword ptr [ecx+96]"},
+	{true, 7, "imul esp, dword ptr [eax-15], 0x8fa32f51"},
+	{true, 1, "pushad"},
+	{false, 1, 0},
+	{true, 1, "push ecx"},
+	{true, 1, "das"},
+	{true, 5, "mov dword ptr [0xbbf9c58f], eax"},
+	{true, 2, "pop ebp"},
+	{true, 2, "lds edi, (invalid)"},
+	{true, 1, "stc"},
+	{true, 5, "mov ebx, 0x5353d113"},
+	{true, 2, "adc edx, ecx"},
+	{true, 3, "rcl dword ptr [ebx+83], 1"},
+	{true, 1, "push ebx"},
+	{true, 1, "push ebx"},
+	{true, 1, "pop es"},
+	{true, 2, "sub al, 79"},
+	{true, 1, "dec edi"},
+	{true, 1, "cmc"},
+	{true, 3, "rcl bl, 49"},
+	{true, 2, "sal dword ptr [ecx], cl"},
+	{true, 3, "xor dword ptr [ebp-34], eax"},
+	{true, 1, "inc ebp"},
+	{true, 6, "fisub word ptr [ebx+0xb7a201dd]"},
+	{true, 5, "mov dword ptr [0xb7a201dd], eax"},
+	{true, 2, "fld qword ptr [ecx]"},
+	{true, 6, "add dword ptr [edx+0xf3b901b7], esp"},
+	{true, 5, "mov byte ptr [0xf3b901b7], al"},
+	{true, 2, "mov bh, 1"},
+	{true, 6, "add dword ptr [ecx+0x4d0284f3], edi"},
+	{true, 5, "mov ecx, 0x4d0284f3"},
+	{true, 3, "rep test byte ptr [edx], al"},
+	{true, 2, "test byte ptr [edx], al"},
+	{true, 3, "add cl, byte ptr [ebp+46]"},
+	{true, 1, "dec ebp"},
+	{true, 3, "mov ch, 0xa8"},
+	{true, 2, "mov ch, 0xa8"},
+	{true, 2, "test al, 43"},
+	{true, 6, "sub esi, dword ptr [ecx+0x254588c7]"},
+	{true, 2, "mov cl, 0xc7"},
+	{false, 2, 0},
+	{true, 3, "mov byte ptr [ebp+37], al"},
+	{true, 1, "inc ebp"},
+	{true, 5, "and eax, 0x8fd53565"},
+	{true, 6, "xor eax, 0x25818fd5"},
+	{true, 5, "xor eax, 0x25818fd5"},
+	{true, 2, "aad 0x8f"},
+	{true, 6, "pop dword ptr [ecx+0x3616d025]"},
+	{true, 10, "and dword ptr [0x653616d0], 0xfd61922b"},
+	{true, 5, "and eax, 0x653616d0"},
+	{true, 2, "rcl byte ptr [esi], 1"},
+	{true, 1, "push ss"},
+	{true, 8, "sub edx, dword ptr gs:[edx+0xd8d0fd61]"},
+	{true, 7, "sub edx, dword ptr gs:[edx+0xd8d0fd61]"},
+	{true, 6, "sub edx, dword ptr [edx+0xd8d0fd61]"},
+	{true, 1, "xchg edx, eax"},
+	{true, 1, "popad"},
+	{true, 1, "std"},
+	{true, 2, "rcr al, 1"},
+	{true, 2, "fdivr st, st(1)"},
+	{true, 1, "stc"},
+	{true, 3, "and dword ptr [edi-56], ebx"},
+	{true, 1, "pop edi"},
+	{true, 4, "enter 0x1c32, 0xa5"},
+	{true, 7, "xor bl, byte ptr [0xddfc5613]"},
+	{true, 2, "sbb al, 0xa5"},
+	{true, 1, "movsd"},
+	{true, 3, "adc edx, dword ptr [esi-4]"},
+	{true, 1, "push esi"},
+	{true, 1, "cld"},
+	{false, 2, 0},
+	{true, 2, "int 94"},
+	{true, 1, "pop esi"},
+	{false, 2, 0},
+	{true, 5, "test eax, 0xceb853b6"},
+	{true, 2, "mov dh, 83"},
+	{true, 1, "push ebx"},
+	{true, 5, "mov eax, 0x096748ce"},
+	{true, 1, "into"},
+	{true, 1, "dec eax"},
+	{true, 5, "or dword ptr [bp+si-11648], esi"},
+	{true, 6, "or dword ptr [edx+0x97c0d280], esi"},
+	{true, 2, "mov dl, 0x80"},
+	{true, 3, "adc dl, 0xc0"},
+	{true, 2, "rol al, cl"},
+	{true, 7, "rcl byte ptr [edi+0x950f6d6d], 121"},
+	{true, 1, "xchg edi, eax"},
+	{true, 1, "insd"},
+	{true, 1, "insd"},
+	{true, 4, "setnz byte ptr [ecx+17]"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 2, "jns 0x00001013"},
+	{true, 6, "adc dword ptr [esi+0xceae7a59], ebp"},
+	{true, 1, "scasb"},
+	{true, 1, "pop ecx"},
+	{true, 2, "jp 0x00000fb0"},
+	{true, 1, "scasb"},
+	{true, 1, "into"},
+	{true, 5, "mov al, byte ptr [0x71c42a78]"},
+	{true, 2, "js 0x0000102c"},
+	{true, 2, "sub al, ah"},
+	{true, 3, "les esi, fword ptr [ecx+60]"},
+	{true, 2, "jno 0x0000103e"},
+	{true, 2, "cmp al, 0xff"},
+	{true, 3, "push dword ptr [edx+29]"},
+	{true, 2, "jb 0x0000101f"},
+	{true, 5, "sbb eax, 0xf775939d"},
+	{true, 1, "popfd"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 2, "jnz 0x00000ff9"},
+	{false, 2, 0},
+	{true, 3, "mov dl, byte ptr [esi+16]"},
+	{true, 1, "push esi"},
+	{true, 2, "adc ah, dl"},
+	{true, 2, "aam 0xd6"},
+	{true, 1, "salc"},
+	{true, 1, "sahf"},
+	{true, 3, "fild dword ptr [ecx-57]"},
+	{true, 1, "inc ecx"},
+	{true, 7, "mov dword ptr [edx+43], 0x40f85c87"},
+	{true, 1, "inc edx"},
+	{true, 6, "sub eax, dword ptr [edi+0x5f40f85c]"},
+	{true, 4, "xchg ebx, dword ptr [eax+edi*8+64]"},
+	{true, 1, "pop esp"},
+	{true, 1, "clc"},
+	{true, 1, "inc eax"},
+	{true, 1, "pop edi"},
+	{true, 3, "bound ebp, qword ptr [edi+50]"},
+	{true, 1, "outsd"},
+	{true, 3, "xor dh, byte ptr [ebp+53]"},
+	{true, 2, "jnz 0x00001037"},
+	{true, 5, "xor eax, 0x579f982b"},
+	{true, 6, "sub ebx, dword ptr [eax+0xfd24579f]"},
+	{true, 1, "cwde"},
+	{true, 1, "lahf"},
+	{true, 1, "push edi"},
+	{true, 2, "and al, 0xfd"},
+	{true, 1, "std"},
+	{true, 6, "fidiv dword ptr [edx+0xad09041e]"},
+	{true, 2, "mov dl, 30"},
+	{true, 1, "push ds"},
+	{true, 2, "add al, 9"},
+	{true, 6, "or dword ptr [ebp+0xf16c55c7], ebp"},
+	{true, 1, "lodsd"},
+	{false, 2, 0},
+	{true, 1, "push ebp"},
+	{true, 1, "insb"},
+	{false, 1, 0},
+	{true, 1, "xchg edx, eax"},
+	{true, 1, "dec esi"},
+	{true, 2, "loope 0x00000ffa"},
+	{true, 1, "clc"},
+	{true, 1, "push esi"},
+	{true, 3, "imul ebx, esi, 90"},
+	{true, 3, "ficomp word ptr [edx-91]"},
+	{true, 1, "pop edx"},
+	{true, 1, "movsd"},
+	{true, 2, "jno 0x0000102c"},
+	{true, 2, "sub dl, bh"},
+	{true, 1, "xlat"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "pop ebp"},
+	{true, 1, "pop esi"},
+	{true, 3, "and edx, dword ptr [ecx+16]"},
+	{true, 1, "push ecx"},
+	{true, 2, "adc byte ptr [edi], bl"},
+	{true, 1, "pop ds"},
+	{true, 2, "jnz 0x00001047"},
+	{true, 1, "inc ebp"},
+	{true, 2, "mov bh, 24"},
+	{true, 2, "sbb dh, cl"},
+	{true, 1, "into"},
+	{true, 1, "in al, dx"},
+	{true, 1, "cld"},
+	{true, 5, "mov edx, 0xb3ee3109"},
+	{true, 2, "or dword ptr [ecx], esi"},
+	{true, 2, "xor esi, ebp"},
+	{true, 1, "out dx, al"},
+	{true, 2, "mov bl, 0xa7"},
+	{true, 1, "cmpsd"},
+	{true, 1, "cmpsd"},
+	{true, 2, "mov cl, 47"},
+	{true, 1, "das"},
+	{true, 1, "pop eax"},
+	{true, 2, "and ebp, esp"},
+	{true, 2, "in eax, 0xd1"},
+	{true, 3, "ror dword ptr [ecx+17], 1"},
+	{true, 1, "dec ecx"},
+	{true, 2, "adc edi, edx"},
+	{true, 1, "xlat"},
+	{true, 2, "jo 0x00001033"},
+	{true, 6, "xor dword ptr [ecx+0x9319926a], esp"},
+	{true, 5, "mov eax, dword ptr [0x9319926a]"},
+	{true, 2, "push 0x92"},
+	{true, 1, "xchg edx, eax"},
+	{true, 6, "sbb dword ptr [ebx+0xd9eea9c3], edx"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "ret"},
+	{true, 5, "test eax, 0x0fb8d9ee"},
+	{true, 1, "out dx, al"},
+	{true, 6, "fnstcw word ptr [eax+0xf6f3c70f]"},
+	{true, 5, "mov eax, 0xf6f3c70f"},
+	{true, 3, "vmptrld (invalid)"},
+	{false, 2, 0},
+	{true, 4, "rep test bl, 0xf7"},
+	{true, 3, "test bl, 0xf7"},
+	{true, 1, "ret"},
+	{false, 2, 0},
+	{true, 2, "or al, 0xf4"},
+	{true, 1, "hlt"},
+	{true, 2, "loope 0x00000fd4"},
+	{true, 2, "rcl ah, cl"},
+	{true, 2, "aam 0x9b"},
+	{true, 1, "wait"},
+	{true, 2, "jcez 0x00001042"},
+	{true, 1, "inc eax"},
+	{true, 2, "sbb al, 0xb2"},
+	{true, 2, "mov dl, 0x9a"},
+	{true, 7, "callf far 0x02c8:0xea0b3303"},
+	{true, 2, "add esi, dword ptr [ebx]"},
+	{true, 2, "xor ecx, dword ptr [ebx]"},
+	{true, 2, "or ebp, edx"},
+	{true, 7, "jmp far 0xe9ef:0x486f02c8"},
+	{true, 4, "enter 0x6f02, 72"},
+	{true, 3, "add ch, byte ptr [edi+72]"},
+	{true, 1, "outsd"},
+	{true, 1, "dec eax"},
+	{true, 1, "out dx, eax"},
+	{true, 5, "jmp 0x581b054f"},
+	{true, 1, "dec edx"},
+	{true, 1, "cmc"},
+	{true, 3, "sbb bl, byte ptr [eax+23]"},
+	{true, 1, "pop eax"},
+	{true, 1, "pop ss"},
+	{true, 3, "div dword ptr [edi+46]"},
+	{true, 2, "jnbe 0x00001030"},
+	{true, 3, "mov bl, ah"},
+	{true, 2, "mov bl, ah"},
+	{true, 2, "fmul st(6), st"},
+	{true, 1, "into"},
+	{true, 3, "sar byte ptr [edi+46], cl"},
+	{true, 2, "jnle 0x00001030"},
+	{true, 2, "dec ecx"},
+	{true, 1, "dec ecx"},
+	{true, 6, "adc ah, byte ptr [ebp+0xe9be07b5]"},
+	{true, 1, "movsd"},
+	{true, 2, "mov ch, 7"},
+	{true, 1, "pop es"},
+	{true, 5, "mov esi, 0x035f6fe9"},
+	{true, 5, "jmp 0xa5036f74"},
+	{true, 1, "outsd"},
+	{true, 1, "pop edi"},
+	{true, 6, "add esp, dword ptr [ebp+0x8589f450]"},
+	{true, 1, "movsd"},
+	{true, 1, "push eax"},
+	{true, 1, "hlt"},
+	{true, 6, "mov dword ptr [ebp+0x3d4c7dba], eax"},
+	{true, 6, "test dword ptr [edx+0xba3d4c7d], edi"},
+	{true, 5, "mov edx, 0xba3d4c7d"},
+	{true, 2, "jnl 0x0000104e"},
+	{true, 1, "dec esp"},
+	{true, 5, "cmp eax, 0xed3b51ba"},
+	{true, 5, "mov edx, 0x08ed3b51"},
+	{true, 1, "push ecx"},
+	{true, 2, "cmp ebp, ebp"},
+	{true, 1, "in eax, dx"},
+	{true, 6, "or byte ptr [ebp+0xe6bd4f92], dh"},
+	{true, 2, "mov ch, 0x92"},
+	{true, 1, "xchg edx, eax"},
+	{true, 1, "dec edi"},
+	{true, 5, "mov ebp, 0xd2a6f8e6"},
+	{true, 2, "out 0xf8, al"},
+	{true, 1, "clc"},
+	{true, 1, "cmpsb"},
+	{true, 2, "shl ch, cl"},
+	{true, 2, "in eax, 88"},
+	{true, 1, "pop eax"},
+	{true, 2, "pop sp"},
+	{true, 1, "pop esp"},
+	{true, 5, "add eax, 0x358aa47f"},
+	{true, 2, "jnle 0x00000fa6"},
+	{true, 1, "movsb"},
+	{true, 6, "mov dh, byte ptr [0x0e5a3c7a]"},
+	{true, 5, "xor eax, 0x0e5a3c7a"},
+	{true, 2, "jp 0x0000103e"},
+	{true, 2, "cmp al, 90"},
+	{true, 1, "pop edx"},
+	{true, 1, "push cs"},
+	{true, 1, "lodsd"},
+	{true, 2, "les ebx, fword ptr [esi]"},
+	{true, 1, "push ds"},
+	{true, 1, "wait"},
+	{true, 2, "mov bl, 52"},
+	{true, 2, "xor al, 0xb2"},
+	{true, 2, "mov dl, 0xec"},
+	{true, 1, "in al, dx"},
+	{true, 1, "stc"},
+	{true, 1, "push ecx"},
+	{true, 2, "jp 0x0000105b"},
+	{true, 1, "pop ecx"},
+	{true, 2, "sbb bl, dh"},
+	{true, 2, "ficomp word ptr [esi]"},
+	{true, 1, "push ds"},
+	{true, 1, "xchg edi, eax"},
+	{true, 1, "clc"},
+	{true, 7, "add byte ptr [0x92789e7c], 0x92"},
+	{true, 5, "add eax, 0x92789e7c"},
+	{true, 2, "jl 0x00000fa0"},
+	{true, 1, "sahf"},
+	{true, 2, "js 0x00000f94"},
+	{true, 1, "xchg edx, eax"},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "fdivr st, st(0)"},
+	{true, 1, "clc"},
+	{true, 3, "and dword ptr [ebp-112], ebx"},
+	{true, 1, "pop ebp"},
+	{true, 1, "nop"},
+	{true, 6, "imul eax, eax, 0xad43e76c"},
+	{true, 5, "shr byte ptr [edi+67], 0xad"},
+	{true, 1, "insb"},
+	{true, 2, "out 67, eax"},
+	{true, 1, "inc ebx"},
+	{true, 1, "lodsd"},
+	{true, 2, "and dl, byte ptr [edi]"},
+	{true, 1, "pop ss"},
+	{false, 2, 0},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "inc edx"},
+	{true, 4, "or ebx, dword ptr [ebp+eax*4+60]"},
+	{true, 1, "pop esp"},
+	{true, 3, "test dword ptr [ebx+edi*4], edi"},
+	{true, 2, "cmp al, 0xbb"},
+	{true, 5, "mov ebx, 0x4939b7cf"},
+	{true, 1, "iret"},
+	{true, 2, "mov bh, 57"},
+	{true, 3, "cmp dword ptr [ecx+43], ecx"},
+	{true, 1, "dec ecx"},
+	{true, 2, "sub edi, edi"},
+	{true, 2, "jmpf (invalid)"},
+	{true, 5, "call 0x060e81e2"},
+	{true, 3, "fnsave [ecx+14]"},
+	{true, 2, "jno 0x00001010"},
+	{true, 1, "push cs"},
+	{true, 1, "push es"},
+	{true, 1, "inc ecx"},
+	{true, 3, "add byte ptr [ebp-80], ch"},
+	{true, 1, "insd"},
+	{true, 2, "mov al, 59"},
+	{true, 2, "cmp eax, ebx"},
+	{true, 1, "ret"},
+	{true, 3, "cmp ch, byte ptr [eax-82]"},
+	{true, 5, "push 0xe9a01bae"},
+	{true, 1, "scasb"},
+	{true, 6, "sbb esp, dword ptr [eax+0x178b6fe9]"},
+	{true, 5, "mov al, byte ptr [0x178b6fe9]"},
+	{true, 5, "jmp 0xaa179b74"},
+	{true, 1, "outsd"},
+	{true, 2, "mov edx, dword ptr [edi]"},
+	{true, 1, "pop ss"},
+	{true, 1, "stosb"},
+	{true, 5, "call 0x6f34712b"},
+	{true, 2, "popad"},
+	{true, 1, "popad"},
+	{true, 2, "xor al, 111"},
+	{true, 1, "outsd"},
+	{true, 5, "mov ecx, 0xb8642440"},
+	{true, 1, "inc eax"},
+	{true, 2, "and al, 100"},
+	{true, 6, "mov eax, 0xe90dfff7"},
+	{true, 5, "mov eax, 0xe90dfff7"},
+	{true, 2, "idiv edi"},
+	{true, 6, "dec dword ptr [0x31ba87e9]"},
+	{true, 5, "or eax, 0x31ba87e9"},
+	{true, 5, "jmp 0xd231ca8c"},
+	{true, 6, "xchg edi, dword ptr [edx+0x04a6d231]"},
+	{true, 5, "mov edx, 0x04a6d231"},
+	{true, 2, "xor edx, edx"},
+	{true, 6, "shl byte ptr [esi+0x7fe47604], cl"},
+	{true, 1, "cmpsb"},
+	{true, 2, "add al, 118"},
+	{true, 2, "jbe 0x00000fe6"},
+	{true, 2, "in al, 127"},
+	{true, 2, "jnle 0x0000105b"},
+	{true, 1, "pop ecx"},
+	{true, 2, "jp 0x00001066"},
+	{true, 6, "sub eax, 0xf51db4c7"},
+	{true, 5, "sub eax, 0xf51db4c7"},
+	{false, 2, 0},
+	{true, 2, "mov ah, 29"},
+	{true, 5, "sbb eax, 0xc7097ff5"},
+	{true, 1, "cmc"},
+	{true, 2, "jnle 0x0000100b"},
+	{true, 2, "or edi, eax"},
+	{true, 7, "mov dword ptr [ebp+27], 0xb170352e"},
+	{true, 1, "inc ebp"},
+	{true, 2, "sbb ebp, dword ptr [esi]"},
+	{true, 6, "xor eax, 0x42c0b170"},
+	{true, 5, "xor eax, 0x42c0b170"},
+	{true, 2, "jo 0x00000fb3"},
+	{true, 2, "mov cl, 0xc0"},
+	{true, 4, "rol byte ptr [edx+39], 0x9b"},
+	{true, 1, "inc edx"},
+	{true, 1, "daa"},
+	{true, 1, "wait"},
+	{true, 2, "and al, 122"},
+	{true, 2, "jp 0x00000fb9"},
+	{true, 2, "mov bh, 4"},
+	{true, 2, "add al, 32"},
+	{true, 6, "and byte ptr [edi+0x62363305], al"},
+	{true, 6, "xchg eax, dword ptr [0x49623633]"},
+	{true, 5, "add eax, 0x49623633"},
+	{true, 2, "xor esi, dword ptr [esi]"},
+	{true, 4, "bound ecx, qword ptr ss:[ecx-105]"},
+	{true, 3, "bound ecx, qword ptr [ecx-105]"},
+	{true, 1, "dec ecx"},
+	{true, 1, "xchg edi, eax"},
+	{true, 6, "les esi, fword ptr [0x12dd978d]"},
+	{true, 5, "xor eax, 0x12dd978d"},
+	{true, 6, "lea edx, [edi+0x16e412dd]"},
+	{true, 1, "xchg edi, eax"},
+	{true, 2, "fst qword ptr [edx]"},
+	{true, 2, "adc ah, ah"},
+	{true, 2, "in al, 22"},
+	{true, 1, "push ss"},
+	{true, 2, "in eax, 86"},
+	{true, 1, "push esi"},
+	{true, 3, "imul ecx, eax, 0xef"},
+	{true, 4, "enter 0xffffdbef, 1"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "fild dword ptr [ecx]"},
+	{true, 2, "add dword ptr [edi], esi"},
+	{true, 1, "aaa"},
+	{true, 1, "salc"},
+	{true, 2, "loope 0x00000fc8"},
+	{false, 2, 0},
+	{true, 1, "xchg esp, eax"},
+	{true, 5, "sbb eax, 0x873e54ba"},
+	{true, 5, "mov edx, 0x37873e54"},
+	{true, 1, "push esp"},
+	{true, 3, "xchg esi, dword ptr ds:[edi]"},
+	{true, 2, "xchg esi, dword ptr [edi]"},
+	{true, 1, "aaa"},
+	{true, 8, "rcl byte ptr [esi*2+0x047b4fd5], 0xa7"},
+	{true, 2, "adc al, 117"},
+	{true, 2, "jnz 0x00000fd7"},
+	{true, 2, "aad 79"},
+	{true, 1, "dec edi"},
+	{true, 2, "jnp 0x00001006"},
+	{true, 2, "add al, 0xa7"},
+	{true, 1, "cmpsd"},
+	{true, 1, "clc"},
+	{true, 3, "jcez 0x00001006"},
+	{true, 2, "jcez 0x00001005"},
+	{true, 6, "add ebx, dword ptr [esi+0x0aecf5c8]"},
+	{true, 1, "sahf"},
+	{true, 4, "enter 0xffffecf5, 10"},
+	{true, 1, "cmc"},
+	{true, 1, "in al, dx"},
+	{true, 2, "or dl, byte ptr [ebx]"},
+	{true, 6, "adc ebp, dword ptr [edx+0x1d0eaa43]"},
+	{true, 1, "stosb"},
+	{true, 1, "inc ebx"},
+	{true, 1, "stosb"},
+	{true, 1, "push cs"},
+	{true, 5, "sbb eax, 0xedc00bac"},
+	{true, 1, "lodsb"},
+	{true, 2, "or eax, eax"},
+	{true, 3, "shr ch, 65"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "inc ecx"},
+	{true, 6, "sbb byte ptr [edi+0x7f10f9dd], bh"},
+	{true, 5, "mov edi, 0x7f10f9dd"},
+	{false, 2, 0},
+	{true, 1, "stc"},
+	{true, 3, "adc byte ptr [edi+43], bh"},
+	{true, 2, "jnle 0x0000102d"},
+	{true, 2, "sub edx, edi"},
+	{true, 1, "xlat"},
+	{true, 1, "dec eax"},
+	{true, 1, "pop esp"},
+	{true, 2, "mov cl, 0xd2"},
+	{true, 6, "shl byte ptr [esi+0xd987bc65], cl"},
+	{true, 1, "cmpsb"},
+	{true, 6, "mov esp, 0xafeed987"},
+	{true, 5, "mov esp, 0xafeed987"},
+	{true, 2, "xchg ebx, ecx"},
+	{true, 2, "fldz"},
+	{true, 1, "out dx, al"},
+	{true, 1, "scasd"},
+	{true, 5, "mov eax, dword ptr [0x0458d459]"},
+	{true, 1, "pop ecx"},
+	{true, 2, "aam 88"},
+	{true, 1, "pop eax"},
+	{true, 2, "add al, 34"},
+	{true, 6, "and cl, byte ptr [esi+0xf930bc0e]"},
+	{true, 2, "mov cs, word ptr [esi]"},
+	{true, 1, "push cs"},
+	{true, 5, "mov esp, 0xa98ff930"},
+	{true, 2, "xor cl, bh"},
+	{true, 1, "stc"},
+	{false, 2, 0},
+	{true, 5, "test eax, 0xe69be0b9"},
+	{true, 5, "mov ecx, 0x2de69be0"},
+	{true, 2, "loopne 0x00000f9d"},
+	{true, 1, "wait"},
+	{true, 2, "out 45, al"},
+	{true, 5, "sub eax, 0xeefe4f4c"},
+	{true, 1, "dec esp"},
+	{true, 1, "dec edi"},
+	{false, 2, 0},
+	{true, 1, "out dx, al"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 1, "inc ebx"},
+	{true, 1, "into"},
+	{true, 1, "iret"},
+	{true, 5, "adc eax, 0xdf4e3863"},
+	{true, 2, "arpl word ptr [eax], di"},
+	{true, 3, "cmp byte ptr [esi-33], cl"},
+	{true, 1, "dec esi"},
+	{true, 6, "fisttp word ptr [esi+0xf0e3918c]"},
+	{true, 7, "mov cs, word ptr [ecx+edx*4+0x23b7f0e3]"},
+	{true, 6, "mov dword ptr [ecx+0x23b7f0e3], ss"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "jcez 0x00000ff2"},
+	{true, 3, "lock mov bh, 35"},
+	{true, 2, "mov bh, 35"},
+	{true, 2, "and edx, dword ptr [eax]"},
+	{true, 2, "adc byte ptr [edi], bl"},
+	{true, 1, "pop ds"},
+	{true, 3, "sub dword ptr [ebx+21], ebp"},
+	{true, 7, "imul edx, dword ptr [0xf7f088f8], 56"},
+	{true, 5, "adc eax, 0xf7f088f8"},
+	{true, 1, "clc"},
+	{true, 2, "mov al, dh"},
+	{true, 3, "lock idiv dword ptr [eax]"},
+	{true, 2, "idiv dword ptr [eax]"},
+	{true, 2, "cmp byte ptr [esi], dl"},
+	{true, 1, "push ss"},
+	{true, 1, "dec edi"},
+	{true, 1, "push esp"},
+	{false, 2, 0},
+	{true, 2, "loop 0x00000ff9"},
+	{true, 4, "div dword ptr [ebx+esi-78]"},
+	{true, 2, "jz 0x00001035"},
+	{true, 6, "xor esi, dword ptr [edx+0xacce15ab]"},
+	{true, 2, "mov dl, 0xab"},
+	{true, 1, "stosd"},
+	{true, 5, "adc eax, 0xf3b5acce"},
+	{true, 1, "into"},
+	{true, 1, "lodsb"},
+	{true, 2, "mov ch, 0xf3"},
+	{true, 3, "rep or dh, al"},
+	{true, 2, "or dh, al"},
+	{false, 2, 0},
+	{true, 2, "jmp 0x0000101b"},
+	{true, 3, "sbb dword ptr [ebx-13], ebp"},
+	{true, 3, "imul esi, ebx, 99"},
+	{true, 3, "rep arpl dx, bp"},
+	{true, 2, "arpl dx, bp"},
+	{true, 7, "jmp far 0x7622:0xeef50bcb"},
+	{true, 1, "retf"},
+	{true, 2, "or esi, ebp"},
+	{true, 1, "cmc"},
+	{true, 1, "out dx, al"},
+	{true, 3, "and dh, byte ptr [esi+117]"},
+	{true, 2, "jbe 0x00001077"},
+	{true, 2, "jnz 0x00001060"},
+	{true, 1, "pop esi"},
+	{true, 2, "sub al, 0xa0"},
+	{true, 5, "mov al, byte ptr [0x1dc26ead]"},
+	{true, 1, "lodsd"},
+	{true, 1, "outsb"},
+	{true, 3, "ret 0x1d1d"},
+	{true, 5, "sbb eax, 0x97f85d1d"},
+	{true, 5, "sbb eax, 0x7297f85d"},
+	{true, 1, "pop ebp"},
+	{true, 1, "clc"},
+	{true, 1, "xchg edi, eax"},
+	{true, 2, "jb 0x0000103f"},
+	{true, 5, "cmp eax, 0x82c67bf5"},
+	{true, 1, "cmc"},
+	{true, 2, "jnp 0x00000fc8"},
+	{true, 7, "mov byte ptr [edx+0x4d9d6795], 0xc0"},
+	{true, 7, "adc byte ptr [ebp+0xc04d9d67], 82"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 2, "popfd"},
+	{true, 1, "popfd"},
+	{true, 1, "dec ebp"},
+	{true, 4, "rcl byte ptr [edx-101], 118"},
+	{true, 1, "push edx"},
+	{true, 1, "wait"},
+	{true, 2, "jbe 0x00000f8a"},
+	{true, 3, "mov byte ptr [ecx+7], bh"},
+	{true, 2, "jns 0x00001009"},
+	{true, 1, "pop es"},
+	{true, 1, "pop ebx"},
+	{true, 5, "add eax, 0xf06c000d"},
+	{true, 5, "or eax, 0x9ef06c00"},
+	{true, 4, "add byte ptr [eax+esi*8-98], ch"},
+	{true, 1, "insb"},
+	{true, 2, "lock sahf"},
+	{true, 1, "sahf"},
+	{true, 7, "xor dword ptr [edx+2], 0x0aa21645"},
+	{true, 2, "jb 0x00001004"},
+	{true, 3, "add al, byte ptr [ebp+22]"},
+	{true, 1, "inc ebp"},
+	{true, 1, "push ss"},
+	{true, 5, "mov byte ptr [0x655b940a], al"},
+	{true, 7, "or dl, byte ptr [ebx+ebx*2+0x3a3ed165]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "pop ebx"},
+	{true, 3, "sar dword ptr gs:[esi], 1"},
+	{true, 2, "sar dword ptr [esi], 1"},
+	{true, 3, "cmp ah, ch"},
+	{true, 2, "cmp ah, ch"},
+	{true, 2, "in eax, 0xad"},
+	{true, 1, "lodsd"},
+	{true, 2, "xchg esp, eax"},
+	{true, 2, "loopne 0x00001059"},
+	{true, 1, "push edi"},
+	{true, 2, "out 106, eax"},
+	{true, 2, "push 0x84"},
+	{true, 2, "test byte ptr [ebx], cl"},
+	{true, 2, "or ecx, esi"},
+	{true, 1, "into"},
+	{true, 2, "mov edi, ss"},
+	{true, 1, "xlat"},
+	{true, 5, "xor eax, 0x7949e398"},
+	{true, 1, "cwde"},
+	{true, 2, "jcez 0x0000104b"},
+	{true, 1, "dec ecx"},
+	{true, 2, "jns 0x00000ffe"},
+	{true, 1, "cld"},
+	{true, 5, "and eax, 0xf38f3802"},
+	{true, 2, "add bh, byte ptr [eax]"},
+	{true, 6, "cmp byte ptr [edi+0xe29d9bf3], cl"},
+	{false, 2, 0},
+	{true, 2, "rep wait"},
+	{true, 1, "wait"},
+	{true, 1, "popfd"},
+	{true, 2, "loop 0x00000fc4"},
+	{true, 3, "ret 0x65a0"},
+	{true, 5, "mov al, byte ptr [0xc78d5965]"},
+	{true, 2, "pop ecx"},
+	{true, 1, "pop ecx"},
+	{true, 2, "lea eax, (invalid)"},
+	{false, 2, 0},
+	{true, 2, "jb 0x00000fcc"},
+	{true, 3, "retf 0xffffed3d"},
+	{true, 5, "cmp eax, 0xd3d90fed"},
+	{true, 1, "in eax, dx"},
+	{true, 3, "psubusw mm2, mm3"},
+	{false, 2, 0},
+	{true, 2, "rcl esp, cl"},
+	{true, 2, "aam 1"},
+	{true, 2, "add dword ptr [esi], edx"},
+	{true, 1, "push ss"},
+	{true, 1, "pop ebx"},
+	{true, 1, "sahf"},
+	{true, 1, "push edx"},
+	{true, 6, "rcl dword ptr [ecx+0x50c6dd08], cl"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "or ch, bl"},
+	{true, 2, "ffree st(6)"},
+	{false, 2, 0},
+	{true, 1, "push eax"},
+	{true, 5, "push 0x65be6498"},
+	{true, 1, "cwde"},
+	{true, 6, "mov esi, 0x39f8a465"},
+	{true, 5, "mov esi, 0x39f8a465"},
+	{true, 2, "movsb"},
+	{true, 1, "movsb"},
+	{true, 1, "clc"},
+	{true, 3, "cmp dword ptr [eax+22], edi"},
+	{true, 2, "js 0x00001018"},
+	{true, 1, "push ss"},
+	{true, 2, "test dword ptr [eax], eax"},
+	{true, 6, "add byte ptr [0xfaa26183], ah"},
+	{true, 5, "and eax, 0xfaa26183"},
+	{true, 4, "and dword ptr [ecx-94], 0xfa"},
+	{true, 1, "popad"},
+	{true, 5, "mov byte ptr [0x278e4efa], al"},
+	{true, 1, "cli"},
+	{true, 1, "dec esi"},
+	{true, 2, "mov fs, word ptr [edi]"},
+	{true, 1, "daa"},
+	{true, 1, "inc esp"},
+	{true, 2, "mov cl, 0xd7"},
+	{true, 1, "xlat"},
+	{true, 7, "call dword ptr [esp+ecx*4+0xf0f5aeaf]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 6, "mov dword ptr [edi+0xc9f0f5ae], gs"},
+	{true, 1, "scasd"},
+	{true, 1, "scasb"},
+	{true, 1, "cmc"},
+	{true, 2, "lock leave"},
+	{true, 1, "leave"},
+	{true, 5, "xor eax, 0x3f766bea"},
+	{true, 7, "jmp far 0xc311:0x2a3f766b"},
+	{true, 4, "imul esi, dword ptr [esi+63], 42"},
+	{true, 2, "jbe 0x00001041"},
+	{true, 1, "aas"},
+	{true, 2, "sub dl, byte ptr [ecx]"},
+	{true, 2, "adc ebx, eax"},
+	{true, 1, "ret"},
+	{true, 2, "adc dword ptr [edx], ebx"},
+	{true, 3, "sbb cl, byte ptr [edi+78]"},
+	{true, 1, "dec edi"},
+	{true, 1, "dec esi"},
+	{true, 2, "push cs"},
+	{true, 1, "push cs"},
+	{true, 1, "outsd"},
+	{true, 1, "in al, dx"},
+	{true, 2, "int 64"},
+	{true, 1, "inc eax"},
+	{true, 7, "jmp far 0x9089:0x718cfcfd"},
+	{true, 1, "std"},
+	{true, 1, "cld"},
+	{true, 3, "mov dword ptr [ecx-119], seg7"},
+	{true, 2, "jno 0x00000f8b"},
+	{true, 6, "mov dword ptr [eax+0xd323baf1], edx"},
+	{true, 1, "nop"},
+	{false, 1, 0},
+	{true, 5, "mov edx, 0x0bc8d323"},
+	{true, 2, "and edx, ebx"},
+	{true, 2, "ror eax, cl"},
+	{true, 4, "enter 0x7a0b, 0xed"},
+	{true, 3, "or edi, dword ptr [edx-19]"},
+	{true, 2, "jp 0x00000fef"},
+	{true, 1, "in eax, dx"},
+	{true, 3, "ret 0xffffbf87"},
+	{true, 6, "xchg edi, dword ptr [edi+0xbb3ba30e]"},
+	{true, 5, "mov edi, 0xbb3ba30e"},
+	{true, 1, "push cs"},
+	{true, 5, "mov dword ptr [0xc061bb3b], eax"},
+	{true, 6, "cmp edi, dword ptr [ebx+0xace8c061]"},
+	{true, 5, "mov ebx, 0xace8c061"},
+	{true, 1, "popad"},
+	{true, 3, "shr al, 0xac"},
+	{true, 5, "call 0x8e39c0b1"},
+	{true, 1, "lodsb"},
+	{true, 2, "mov al, 57"},
+	{true, 6, "cmp dword ptr [esi+0xbdf7d7e3], ecx"},
+	{true, 2, "mov fs, bx"},
+	{true, 2, "jcez 0x00000fd9"},
+	{true, 1, "xlat"},
+	{true, 6, "idiv dword ptr [ebp+0x9b64ea1e]"},
+	{true, 5, "mov ebp, 0x9b64ea1e"},
+	{true, 1, "push ds"},
+	{true, 7, "jmp far 0xb4ed:0x26a69b64"},
+	{true, 2, "wait"},
+	{true, 1, "wait"},
+	{true, 1, "cmpsb"},
+	{true, 2, "in eax, dx"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "mov ah, 40"},
+	{true, 6, "sub byte ptr [eax+0x8f548539], bl"},
+	{true, 1, "cwde"},
+	{true, 6, "cmp dword ptr [ebp+0xc6268f54], eax"},
+	{true, 4, "test dword ptr [edi+ecx*4+38], edx"},
+	{true, 1, "push esp"},
+	{false, 2, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 1, "aaa"},
+	{true, 1, "ret"},
+	{true, 3, "mov byte ptr [ebx+89], bh"},
+	{true, 2, "jnp 0x0000105b"},
+	{true, 1, "pop ecx"},
+	{true, 1, "inc edx"},
+	{true, 5, "mov al, byte ptr [0x5e1e96b9]"},
+	{true, 5, "mov ecx, 0x395e1e96"},
+	{true, 1, "xchg esi, eax"},
+	{true, 1, "push ds"},
+	{true, 1, "pop esi"},
+	{true, 7, "cmp dword ptr [eax+ebx*8+0x8bea9e57], edi"},
+	{true, 5, "mov esp, 0xea9e57d8"},
+	{true, 3, "fcom dword ptr [edi-98]"},
+	{true, 1, "push edi"},
+	{true, 1, "sahf"},
+	{true, 7, "jmp far 0xc0d8:0xa386848b"},
+	{true, 7, "mov eax, dword ptr [esi+eax*4+0x52c0d8a3]"},
+	{true, 6, "test byte ptr [esi+0x52c0d8a3], al"},
+	{true, 6, "xchg ah, byte ptr [ebx+0xb552c0d8]"},
+	{true, 5, "mov dword ptr [0xb552c0d8], eax"},
+	{true, 2, "fadd st, st(0)"},
+	{true, 4, "rcl byte ptr [edx-75], 0x95"},
+	{true, 1, "push edx"},
+	{true, 2, "mov ch, 0x95"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 6, "add byte ptr [esi+0xff4f34cc], dh"},
+	{true, 2, "mov dh, 0xcc"},
+	{true, 1, "int3"},
+	{true, 2, "xor al, 79"},
+	{true, 1, "dec edi"},
+	{true, 2, "call ebp"},
+	{true, 2, "aad 0xf5"},
+	{true, 1, "cmc"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 1, "daa"},
+	{true, 2, "adc al, 0xcc"},
+	{true, 1, "int3"},
+	{true, 1, "hlt"},
+	{true, 7, "callf far 0xe8f2:0xc6351004"},
+	{true, 2, "add al, 16"},
+	{true, 6, "adc byte ptr [0x98e8f2c6], dh"},
+	{true, 5, "xor eax, 0x98e8f2c6"},
+	{false, 2, 0},
+	{true, 6, "repne call 0x7558759e"},
+	{true, 5, "call 0x7558759d"},
+	{true, 1, "cwde"},
+	{true, 2, "pop eax"},
+	{true, 1, "pop eax"},
+	{true, 2, "jnz 0x00000fa6"},
+	{true, 1, "movsb"},
+	{true, 2, "mov bh, dl"},
+	{true, 1, "cli"},
+	{true, 5, "mov edi, 0x61c26da2"},
+	{true, 5, "mov byte ptr [0xd461c26d], al"},
+	{true, 1, "insd"},
+	{true, 3, "ret 0xffffd461"},
+	{true, 1, "popad"},
+	{true, 2, "aam 0xf6"},
+	{true, 4, "neg byte ptr [esp+esi*8+118]"},
+	{true, 1, "pop esp"},
+	{true, 1, "hlt"},
+	{true, 2, "jbe 0x0000100c"},
+	{true, 6, "or dl, byte ptr [ecx+0x6499763d]"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 5, "cmp eax, 0x16649976"},
+	{true, 2, "jbe 0x00000f9b"},
+	{true, 1, "cdq"},
+	{true, 2, "push ss"},
+	{true, 1, "push ss"},
+	{true, 3, "repne out dx, eax"},
+	{true, 2, "out dx, eax"},
+	{true, 1, "out dx, eax"},
+	{true, 5, "sbb eax, 0x1efa8f75"},
+	{true, 2, "jnz 0x00000f91"},
+	{false, 2, 0},
+	{true, 1, "cli"},
+	{true, 1, "push ds"},
+	{false, 1, 0},
+	{true, 7, "jmp far 0xf322:0xff7c4160"},
+	{true, 1, "pushad"},
+	{true, 1, "inc ecx"},
+	{true, 2, "jl 0x00001001"},
+	{true, 2, "jmp dword ptr [edx]"},
+	{true, 2, "and dh, bl"},
+	{true, 2, "rep retf"},
+	{true, 1, "retf"},
+	{true, 3, "fisttp dword ptr [eax-107]"},
+	{true, 1, "dec eax"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 1, "outsd"},
+	{true, 1, "popfd"},
+	{true, 2, "jl 0x00000fe9"},
+	{true, 2, "out 0xd1, eax"},
+	{true, 2, "rol eax, 1"},
+	{true, 5, "shl byte ptr [ebx+esi-18], 40"},
+	{true, 3, "xor ebp, esi"},
+	{true, 2, "xor ebp, esi"},
+	{true, 1, "out dx, al"},
+	{true, 2, "sub dl, al"},
+	{true, 3, "ret 0xffffd339"},
+	{true, 2, "cmp ebx, edx"},
+	{true, 2, "shr esi, cl"},
+	{true, 1, "out dx, al"},
+	{true, 1, "dec esi"},
+	{true, 2, "fstp st(0)"},
+	{true, 2, "fsubr st, st(3)"},
+	{true, 2, "jmp 0x00001051"},
+	{true, 1, "dec edi"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "pushfd"},
+	{true, 1, "push es"},
+	{true, 1, "sti"},
+	{true, 2, "xchg al, ah"},
+	{true, 2, "les edi, fword ptr [esi]"},
+	{true, 2, "xchg esp, eax"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "mov esi, dword ptr [edx+118]"},
+	{true, 2, "jb 0x00001078"},
+	{true, 2, "jbe 0x00001041"},
+	{true, 1, "aas"},
+	{true, 1, "leave"},
+	{true, 3, "xchg eax, dword ptr [edx]"},
+	{true, 2, "add al, 0xa2"},
+	{true, 5, "mov byte ptr [0x45f79924], al"},
+	{true, 2, "and al, 0x99"},
+	{true, 1, "cdq"},
+	{true, 7, "test dword ptr [ebp+110], 0x4da62cb3"},
+	{true, 1, "inc ebp"},
+	{true, 1, "outsb"},
+	{true, 2, "mov bl, 44"},
+	{true, 2, "sub al, 0xa6"},
+	{true, 1, "cmpsb"},
+	{true, 1, "dec ebp"},
+	{true, 1, "iret"},
+	{true, 2, "adc byte ptr [ecx], bl"},
+	{true, 2, "sbb edx, ebp"},
+	{true, 7, "jmp far 0x90d0:0x5e663214"},
+	{true, 2, "adc al, 50"},
+	{true, 3, "xor ah, byte ptr [esi+94]"},
+	{true, 2, "pop si"},
+	{true, 1, "pop esi"},
+	{true, 6, "rcl byte ptr [eax+0x9d34dd21], 1"},
+	{true, 1, "nop"},
+	{true, 2, "and ebp, ebx"},
+	{true, 7, "fnsave [ebx*4+0x15d1a0c7]"},
+	{true, 2, "xor al, 0x9d"},
+	{true, 1, "popfd"},
+	{false, 2, 0},
+	{true, 5, "mov al, byte ptr [0x949d15d1]"},
+	{true, 6, "rcl dword ptr [0x81d6949d], 1"},
+	{true, 5, "adc eax, 0x81d6949d"},
+	{true, 1, "popfd"},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "salc"},
+	{true, 7, "or dword ptr [ecx-60], 0x872d8906"},
+	{true, 1, "dec ecx"},
+	{true, 2, "les eax, fword ptr [esi]"},
+	{true, 1, "push es"},
+	{true, 6, "mov dword ptr [0x87fd7c87], ebp"},
+	{true, 5, "sub eax, 0x87fd7c87"},
+	{true, 4, "xchg edi, dword ptr [ebp+edi*8-121]"},
+	{true, 2, "jl 0x00000fff"},
+	{true, 1, "std"},
+	{true, 3, "xchg ebp, dword ptr [ecx+31]"},
+	{true, 6, "imul ebx, dword ptr [edi], 0xe3da49a2"},
+	{true, 1, "pop ds"},
+	{true, 5, "mov byte ptr [0xbce3da49], al"},
+	{true, 1, "dec ecx"},
+	{false, 2, 0},
+	{true, 2, "jcez 0x00000fbe"},
+	{true, 5, "mov esp, 0x60c499b9"},
+	{true, 5, "mov ecx, 0xc960c499"},
+	{true, 1, "cdq"},
+	{true, 3, "les esp, fword ptr [eax-55]"},
+	{true, 1, "pushad"},
+	{true, 1, "leave"},
+	{true, 6, "fiadd word ptr [ebx+0x1f4a3476]"},
+	{true, 4, "xor dword ptr [esi+52], 74"},
+	{true, 2, "jbe 0x00001036"},
+	{true, 2, "xor al, 74"},
+	{true, 1, "dec edx"},
+	{true, 1, "pop ds"},
+	{true, 1, "nop"},
+	{true, 1, "pop ebp"},
+	{false, 2, 0},
+	{true, 3, "adc ch, byte ptr [esi-25]"},
+	{true, 1, "outsb"},
+	{true, 2, "out 0xdf, eax"},
+	{true, 3, "fist word ptr [ecx+77]"},
+	{true, 1, "push ecx"},
+	{true, 1, "dec ebp"},
+	{true, 2, "adc edx, dword ptr [esi]"},
+	{true, 1, "push ss"},
+	{true, 2, "add esp, esi"},
+	{true, 1, "hlt"},
+	{true, 6, "frstor [esi+0x46d67cf9]"},
+	{true, 1, "cmpsb"},
+	{true, 1, "stc"},
+	{true, 2, "jl 0x00000fd8"},
+	{true, 1, "salc"},
+	{true, 1, "inc esi"},
+	{true, 1, "sti"},
+	{true, 2, "loop 0x00000fc2"},
+	{true, 4, "rcr byte ptr [edx-78], 78"},
+	{true, 1, "pop edx"},
+	{true, 2, "mov dl, 78"},
+	{true, 1, "dec esi"},
+	{true, 2, "jmp 0x00001023"},
+	{true, 3, "and dword ptr [ebx+32], ebp"},
+	{true, 3, "imul esp, dword ptr [eax], 82"},
+	{true, 3, "and byte ptr [edx-96], dl"},
+	{true, 1, "push edx"},
+	{true, 5, "mov al, byte ptr [0x5274c093]"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 5, "sal byte ptr [edx+edx*2-11], 34"},
+	{true, 2, "jz 0x00001054"},
+	{true, 1, "push edx"},
+	{true, 1, "cmc"},
+	{true, 2, "and dh, ah"},
+	{true, 1, "hlt"},
+	{true, 6, "mov dword ptr [eax+0xf9b2f01b], seg7"},
+	{true, 2, "mov al, 27"},
+	{true, 2, "sbb esi, eax"},
+	{true, 3, "lock mov dl, 0xf9"},
+	{true, 2, "mov dl, 0xf9"},
+	{true, 1, "stc"},
+	{true, 3, "and dword ptr [si], ebx"},
+	{true, 3, "and dword ptr [esi+edx*4], ebx"},
+	{true, 2, "sbb al, 0x96"},
+	{true, 1, "xchg esi, eax"},
+	{true, 2, "jbe 0x00000fb9"},
+	{true, 2, "mov bh, 0xc5"},
+	{true, 6, "lds edx, fword ptr [0xd0b9f2fb]"},
+	{true, 5, "adc eax, 0xd0b9f2fb"},
+	{true, 1, "sti"},
+	{true, 6, "repne mov ecx, 0x3d8032d0"},
+	{true, 5, "mov ecx, 0x3d8032d0"},
+	{true, 2, "sal byte ptr [edx], 1"},
+	{true, 6, "xor al, byte ptr [eax+0x9af3a23d]"},
+	{true, 7, "cmp byte ptr [0xbb9af3a2], 103"},
+	{true, 5, "cmp eax, 0xbb9af3a2"},
+	{true, 5, "mov byte ptr [0x67bb9af3], al"},
+	{true, 8, "rep callf far 0x3574:0xdc7b67bb"},
+	{true, 7, "callf far 0x3574:0xdc7b67bb"},
+	{true, 5, "mov ebx, 0x74dc7b67"},
+	{true, 3, "jnp 0x00000fdf"},
+	{true, 2, "jnp 0x00000fde"},
+	{true, 4, "fdiv qword ptr [ebp+esi-10]"},
+	{true, 2, "jz 0x00001037"},
+	{true, 5, "xor eax, 0x5ce4e8f6"},
+	{true, 2, "imul al"},
+	{true, 5, "call 0xbbcc6ce9"},
+	{true, 2, "in al, 92"},
+	{true, 1, "pop esp"},
+	{true, 1, "int3"},
+	{true, 5, "mov ebx, 0xcab01ef4"},
+	{true, 1, "hlt"},
+	{true, 1, "push ds"},
+	{true, 2, "mov al, 0xca"},
+	{true, 3, "retf 0x2ee2"},
+	{true, 2, "loop 0x00001030"},
+	{true, 7, "imul esp, esp, 0xc75eeaf1"},
+	{true, 6, "imul esp, esp, 0xc75eeaf1"},
+	{true, 2, "in al, 0xf1"},
+	{false, 1, 0},
+	{true, 7, "jmp far 0x7fe4:0x58d0c75e"},
+	{true, 1, "pop esi"},
+	{false, 2, 0},
+	{true, 3, "rcr byte ptr [eax-28], 1"},
+	{true, 1, "pop eax"},
+	{true, 2, "in al, 127"},
+	{true, 2, "jnle 0x00000fcd"},
+	{true, 1, "retf"},
+	{true, 2, "loop 0x0000104a"},
+	{true, 1, "dec eax"},
+	{true, 7, "xor byte ptr [ebx+0x8e8d9bd1], 0x8b"},
+	{true, 2, "mov bl, 0xd1"},
+	{true, 6, "rcr dword ptr [ebx+0x408b8e8d], 1"},
+	{true, 1, "wait"},
+	{true, 6, "lea ecx, [esi+0xff3d408b]"},
+	{true, 6, "mov cs, word ptr [ebx+0x8cff3d40]"},
+	{true, 3, "mov eax, dword ptr [eax+61]"},
+	{true, 1, "inc eax"},
+	{true, 5, "cmp eax, 0x6c368cff"},
+	{true, 7, "dec dword ptr [esi+esi+0x2626746c]"},
+	{true, 2, "mov dword ptr [esi], seg7"},
+	{true, 2, "insb"},
+	{true, 1, "insb"},
+	{true, 2, "jz 0x00001028"},
+	{true, 3, "push ecx"},
+	{true, 2, "push ecx"},
+	{true, 1, "push ecx"},
+	{true, 2, "adc ecx, edi"},
+	{true, 1, "stc"},
+	{true, 2, "sub al, 86"},
+	{true, 1, "push esi"},
+	{true, 1, "pushad"},
+	{true, 3, "xor byte ptr [ebp-72], ah"},
+	{true, 6, "mov eax, 0xe13d80b5"},
+	{true, 5, "mov eax, 0xe13d80b5"},
+	{true, 2, "mov ch, 0x80"},
+	{true, 7, "cmp byte ptr [0x76e162e1], 0x85"},
+	{true, 5, "cmp eax, 0x76e162e1"},
+	{true, 2, "loope 0x00001064"},
+	{true, 2, "bound esp, (invalid)"},
+	{true, 2, "loope 0x00001078"},
+	{true, 2, "jbe 0x00000f87"},
+	{true, 6, "test dword ptr [eax+0x387ef70b], esp"},
+	{true, 5, "mov al, byte ptr [0x387ef70b]"},
+	{true, 2, "or esi, edi"},
+	{true, 3, "idiv dword ptr [esi+56]"},
+	{true, 2, "jle 0x0000103a"},
+	{true, 6, "cmp byte ptr [edi+0x7af4685a], ch"},
+	{true, 1, "scasd"},
+	{true, 1, "pop edx"},
+	{true, 5, "push 0xfc337af4"},
+	{true, 1, "hlt"},
+	{true, 2, "jp 0x00001035"},
+	{true, 2, "xor edi, esp"},
+	{true, 1, "cld"},
+	{true, 1, "leave"},
+	{true, 1, "retf"},
+	{true, 6, "and dword ptr [0x04972ec1], ebp"},
+	{true, 5, "sub eax, 0x04972ec1"},
+	{true, 3, "shr dword ptr [esi], 0x97"},
+	{true, 2, "xchg edi, eax"},
+	{true, 1, "xchg edi, eax"},
+	{true, 2, "add al, 0xaa"},
+	{true, 1, "stosb"},
+	{true, 5, "mov al, byte ptr [0x82813c68]"},
+	{true, 5, "push 0x1482813c"},
+	{true, 2, "cmp al, 0x81"},
+	{true, 10, "add dword ptr [edx+0x599b9d14], 0x4b9919d4"},
+	{true, 8, "adc byte ptr [ebx*4+0x19d4599b], 0x99"},
+	{true, 2, "adc al, 0x9d"},
+	{true, 1, "popfd"},
+	{true, 1, "wait"},
+	{true, 1, "pop ecx"},
+	{true, 2, "aam 25"},
+	{true, 6, "sbb dword ptr [ecx+0x09a8674b], ebx"},
+	{true, 1, "cdq"},
+	{true, 1, "dec ebx"},
+	{true, 3, "test al, 9"},
+	{true, 2, "test al, 9"},
+	{true, 3, "or dword ptr [ecx-101], ebx"},
+	{true, 1, "pop ecx"},
+	{true, 1, "wait"},
+	{true, 2, "jcez 0x00000fde"},
+	{true, 3, "fcomp qword ptr [ebp-102]"},
+	{true, 1, "pop ebp"},
+	{true, 7, "callf far 0x0ad7:0xfac38c62"},
+	{true, 7, "bound ecx, qword ptr [ebx+eax*8+0x070ad7fa]"},
+	{true, 2, "mov ebx, es"},
+	{true, 1, "ret"},
+	{true, 1, "cli"},
+	{true, 1, "xlat"},
+	{true, 2, "or al, byte ptr [edi]"},
+	{true, 1, "pop es"},
+	{true, 3, "and bh, 104"},
+	{true, 2, "out 104, eax"},
+	{true, 5, "push 0x4bccbdf2"},
+	{true, 6, "repne mov ebp, 0x41944bcc"},
+	{true, 5, "mov ebp, 0x41944bcc"},
+	{true, 1, "int3"},
+	{true, 1, "dec ebx"},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "inc ecx"},
+	{true, 1, "stosd"},
+	{true, 1, "push cs"},
+	{true, 7, "add byte ptr [esi+esi*4+0x01c3cab7], bh"},
+	{true, 5, "mov esp, 0xc3cab7b6"},
+	{true, 2, "mov dh, 0xb7"},
+	{true, 2, "mov bh, 0xca"},
+	{true, 3, "retf 0x01c3"},
+	{true, 1, "ret"},
+	{true, 6, "add dword ptr [edx+0xcf255b41], ebx"},
+	{true, 7, "callf far 0x436d:0xcf255b41"},
+	{true, 1, "inc ecx"},
+	{true, 1, "pop ebx"},
+	{true, 5, "and eax, 0x97436dcf"},
+	{true, 1, "iret"},
+	{true, 1, "insd"},
+	{true, 1, "inc ebx"},
+	{true, 1, "xchg edi, eax"},
+	{true, 1, "push ebp"},
+	{true, 6, "mov dword ptr [edi], 0xc6bb03c6"},
+	{true, 1, "pop es"},
+	{true, 3, "mov byte ptr [ebx], 0xbb"},
+	{true, 6, "add edi, dword ptr [ebx+0xde32f6c6]"},
+	{true, 5, "mov ebx, 0xde32f6c6"},
+	{false, 2, 0},
+	{true, 2, "div byte ptr [edx]"},
+	{true, 2, "xor bl, dh"},
+	{true, 6, "fidivr word ptr [esi+0x9cef2cdf]"},
+	{true, 5, "mov esi, 0x9cef2cdf"},
+	{true, 3, "fild qword ptr [edi+ebp*8]"},
+	{true, 2, "sub al, 0xef"},
+	{true, 1, "out dx, eax"},
+	{true, 1, "pushfd"},
+	{true, 2, "add al, 83"},
+	{true, 1, "push ebx"},
+	{true, 6, "pop dword ptr [ebp+0xe4c011d5]"},
+	{true, 2, "test ebp, edx"},
+	{true, 2, "aad 17"},
+	{true, 2, "adc eax, eax"},
+	{true, 3, "shl ah, 0x84"},
+	{true, 2, "in al, 0x84"},
+	{true, 6, "test byte ptr [ebx+0xe5a7f21f], al"},
+	{true, 3, "sbb dword ptr [edi], 0xf2"},
+	{true, 1, "pop ds"},
+	{true, 2, "repne cmpsd"},
+	{true, 1, "cmpsd"},
+	{true, 2, "in eax, 0xe1"},
+	{true, 2, "loope 0x00001008"},
+	{true, 1, "push es"},
+	{true, 1, "xchg edx, eax"},
+	{true, 5, "mov esp, 0xc572a28f"},
+	{false, 2, 0},
+	{true, 5, "mov byte ptr [0x3981c572], al"},
+	{true, 2, "jb 0x00000fc7"},
+	{true, 6, "lds eax, fword ptr [ecx+0x1ca02a39]"},
+	{true, 6, "cmp dword ptr [ecx], 0xc21ca02a"},
+	{true, 2, "cmp dword ptr [edx], ebp"},
+	{true, 6, "sub ah, byte ptr [eax+0x3cedc21c]"},
+	{true, 5, "mov al, byte ptr [0x3cedc21c]"},
+	{true, 2, "sbb al, 0xc2"},
+	{true, 3, "ret 0x3ced"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "cmp al, 0xcb"},
+	{true, 1, "retf"},
+	{true, 1, "std"},
+	{true, 5, "mov al, byte ptr [0xed88be01]"},
+	{true, 6, "add dword ptr [esi+0x65c0ed88], edi"},
+	{true, 5, "mov esi, 0x65c0ed88"},
+	{true, 2, "mov ch, ch"},
+	{true, 1, "in eax, dx"},
+	{true, 4, "shl byte ptr [ebp-95], 39"},
+	{true, 6, "mov eax, dword ptr gs:[0xb8ab5c27]"},
+	{true, 5, "mov eax, dword ptr [0xb8ab5c27]"},
+	{true, 1, "daa"},
+	{true, 1, "pop esp"},
+	{true, 1, "stosd"},
+	{true, 5, "mov eax, 0xbcf335e0"},
+	{true, 2, "loopne 0x00001037"},
+	{true, 5, "xor eax, 0x584cbcf3"},
+	{true, 6, "rep mov esp, 0x22d3584c"},
+	{true, 5, "mov esp, 0x22d3584c"},
+	{true, 1, "dec esp"},
+	{true, 1, "pop eax"},
+	{true, 2, "shl dword ptr [edx], cl"},
+	{true, 4, "and dl, byte ptr [edi-109]"},
+	{true, 1, "push esp"},
+	{true, 2, "xchg ebx, eax"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 2, "mov ch, 122"},
+	{true, 2, "jp 0x0000104b"},
+	{true, 1, "dec ecx"},
+	{true, 4, "and dword ptr fs:[edi-110], ebp"},
+	{true, 3, "and dword ptr [edi-110], ebp"},
+	{true, 1, "outsd"},
+	{true, 1, "xchg edx, eax"},
+	{true, 1, "pushad"},
+	{true, 5, "cmp eax, 0x1b46b176"},
+	{true, 2, "jbe 0x00000fb3"},
+	{true, 2, "mov cl, 70"},
+	{true, 1, "inc esi"},
+	{true, 3, "sbb esi, dword ptr [esi-36]"},
+	{true, 2, "jbe 0x00000fde"},
+	{true, 2, "fdivr st(1), st"},
+	{false, 1, 0},
+	{true, 2, "shl edx, 1"},
+	{true, 2, "loop 0x00000fbe"},
+	{true, 5, "mov esp, 0xd849069d"},
+	{true, 1, "popfd"},
+	{true, 1, "push es"},
+	{true, 1, "dec ecx"},
+	{true, 2, "fcomp st(2)"},
+	{true, 3, "fidivr dword ptr [esp+edi*4]"},
+	{true, 2, "cmp al, 0xbc"},
+	{true, 5, "mov esp, 0xe3df4cc2"},
+	{true, 3, "ret 0xffffdf4c"},
+	{true, 1, "dec esp"},
+	{false, 2, 0},
+	{true, 2, "jcez 0x00001005"},
+	{true, 2, "add ebp, dword ptr [eax]"},
+	{true, 2, "sub byte ptr [ecx], dl"},
+	{true, 2, "adc esi, ebx"},
+	{true, 2, "faddp st(6), st"},
+	{false, 2, 0},
+	{true, 1, "outsb"},
+	{true, 2, "xor ebx, ebp"},
+	{true, 3, "fisttp qword ptr [eax-26]"},
+	{true, 1, "dec eax"},
+	{true, 2, "out 51, al"},
+	{true, 3, "xor edi, dword ptr [esi-5]"},
+	{true, 2, "jle 0x00000ffd"},
+	{true, 1, "sti"},
+	{true, 6, "fstp qword ptr [eax+0x4f9c7dea]"},
+	{true, 1, "cwde"},
+	{true, 7, "jmp far 0xad3c:0xad4f9c7d"},
+	{true, 2, "jnl 0x00000f9e"},
+	{true, 1, "pushfd"},
+	{true, 1, "dec edi"},
+	{true, 1, "lodsd"},
+	{true, 2, "cmp al, 0xad"},
+	{true, 1, "lodsd"},
+	{true, 3, "xor ebx, dword ptr [ecx-27]"},
+	{true, 1, "pop ecx"},
+	{true, 2, "in eax, 0xcd"},
+	{true, 2, "int 93"},
+	{true, 1, "pop ebp"},
+	{true, 6, "ficom dword ptr [ecx+0xaf9831b0]"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "mov al, 49"},
+	{true, 6, "xor dword ptr [eax+0x4f2577af], ebx"},
+	{true, 1, "cwde"},
+	{true, 1, "scasd"},
+	{true, 2, "jnbe 0x00001027"},
+	{true, 5, "and eax, 0x50f1af4f"},
+	{true, 1, "dec edi"},
+	{true, 1, "scasd"},
+	{false, 1, 0},
+	{true, 1, "push eax"},
+	{true, 1, "scasb"},
+	{true, 2, "jnb 0x00000f97"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 2, "mov bh, 0xb1"},
+	{true, 2, "mov cl, 118"},
+	{true, 2, "jbe 0x0000103e"},
+	{true, 2, "cmp al, 86"},
+	{true, 1, "push esi"},
+	{true, 5, "mov esi, 0x82f09eba"},
+	{true, 5, "mov edx, 0x7382f09e"},
+	{true, 1, "sahf"},
+	{true, 5, "lock xor byte ptr [ebx-109], 0x96"},
+	{true, 4, "xor byte ptr [ebx-109], 0x96"},
+	{true, 2, "jnb 0x00000f95"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "xchg esi, eax"},
+	{true, 3, "mov dword ptr [ebp+5], esi"},
+	{true, 2, "jnz 0x00001007"},
+	{true, 5, "add eax, 0xb85e9ffa"},
+	{true, 1, "cli"},
+	{true, 1, "lahf"},
+	{true, 1, "pop esi"},
+	{true, 5, "mov eax, 0xb983ea71"},
+	{true, 2, "jno 0x00000fec"},
+	{true, 7, "jmp far 0xa79c:0xc4c9b983"},
+	{true, 7, "cmp dword ptr [ecx+0xa79cc4c9], 0xd1"},
+	{true, 5, "mov ecx, 0xa79cc4c9"},
+	{true, 1, "leave"},
+	{true, 7, "les ebx, fword ptr [edi+0xa52e5ad1]"},
+	{true, 1, "pushfd"},
+	{true, 1, "cmpsd"},
+	{true, 3, "rcr dword ptr [edx+46], 1"},
+	{true, 1, "pop edx"},
+	{true, 2, "movsd"},
+	{true, 1, "movsd"},
+	{true, 5, "mov eax, dword ptr [0xad1abc06]"},
+	{true, 1, "push es"},
+	{true, 5, "mov esp, 0xac6cad1a"},
+	{true, 6, "sbb ch, byte ptr [ebp+0x8d2fac6c]"},
+	{true, 1, "lodsd"},
+	{true, 1, "insb"},
+	{true, 1, "lodsb"},
+	{true, 1, "das"},
+	{true, 3, "lea edx, [esi-5]"},
+	{true, 1, "push esi"},
+	{true, 1, "sti"},
+	{true, 1, "push es"},
+	{true, 3, "mov dl, byte ptr [eax-96]"},
+	{true, 1, "push eax"},
+	{true, 5, "mov al, byte ptr [0xc103e8bb]"},
+	{true, 5, "mov ebx, 0x1bc103e8"},
+	{true, 5, "call 0xf61bd108"},
+	{true, 2, "add eax, ecx"},
+	{true, 3, "rcr dword ptr [ebx], 0xf6"},
+	{true, 2, "sbb esi, esi"},
+	{true, 3, "not byte ptr [edx-104]"},
+	{true, 1, "push edx"},
+	{true, 1, "cwde"},
+	{true, 1, "daa"},
+	{true, 1, "salc"},
+	{true, 3, "and al, 71"},
+	{true, 2, "and al, 71"},
+	{true, 1, "inc edi"},
+	{true, 2, "or al, 90"},
+	{true, 1, "pop edx"},
+	{false, 2, 0},
+	{true, 1, "dec esi"},
+	{true, 1, "leave"},
+	{true, 2, "jnz 0x00001064"},
+	{true, 2, "bound esi, qword ptr [ecx]"},
+	{true, 2, "xor ebp, esi"},
+	{true, 1, "cmc"},
+	{true, 4, "imul ebp, dword ptr [ebx-121], 0xff"},
+	{true, 7, "imul eax, dword ptr [edi+0xc06a23ff], 100"},
+	{true, 2, "xchg edi, edi"},
+	{true, 2, "jmp dword ptr [ebx]"},
+	{true, 3, "and ebp, dword ptr [edx-64]"},
+	{true, 2, "push 0xc0"},
+	{true, 5, "shl byte ptr [esi+126], 37"},
+	{true, 4, "jle 0x00001029"},
+	{true, 3, "jle 0x00001028"},
+	{true, 2, "jle 0x00001027"},
+	{true, 5, "and eax, 0x9352fd00"},
+	{true, 2, "add ch, bh"},
+	{true, 1, "std"},
+	{true, 1, "push edx"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 3, "sbb byte ptr [edi+7], al"},
+	{true, 1, "inc edi"},
+	{true, 1, "pop es"},
+	{true, 2, "mul dword ptr [ebx]"},
+	{true, 7, "and ebx, dword ptr [edi+ebx*8+0xaf255b88]"},
+	{true, 1, "pushfd"},
+	{true, 6, "fisttp word ptr [eax+0xc8af255b]"},
+	{true, 3, "mov byte ptr [ebx+37], bl"},
+	{true, 1, "pop ebx"},
+	{true, 5, "and eax, 0xf708c8af"},
+	{true, 1, "scasd"},
+	{true, 4, "enter 0xfffff708, 3"},
+	{true, 2, "or bh, dh"},
+	{true, 6, "test dword ptr [ebx], 0x0e348738"},
+	{true, 2, "add edi, dword ptr [eax]"},
+	{true, 6, "cmp byte ptr [edi+0x1dde0e34], al"},
+	{true, 3, "xchg esi, dword ptr [esi+ecx]"},
+	{true, 2, "xor al, 14"},
+	{true, 1, "push cs"},
+	{true, 6, "ficomp word ptr [0x7e7758e0]"},
+	{true, 5, "sbb eax, 0x7e7758e0"},
+	{true, 2, "loopne 0x0000105a"},
+	{true, 1, "pop eax"},
+	{true, 2, "jnbe 0x00001080"},
+	{true, 2, "jle 0x00000f86"},
+	{true, 2, "test byte ptr [esi], ah"},
+	{true, 3, "jl 0x0000101e"},
+	{true, 2, "jl 0x0000101d"},
+	{true, 6, "sbb eax, dword ptr [ebp+0x412fd7a8]"},
+	{true, 6, "test dword ptr [eax+0xe5412fd7], ebp"},
+	{true, 2, "test al, 0xd7"},
+	{true, 1, "xlat"},
+	{true, 1, "das"},
+	{true, 1, "inc ecx"},
+	{true, 2, "in eax, 98"},
+	{true, 6, "bound ecx, qword ptr [eax+0x152467ef]"},
+	{true, 2, "mov bh, ch"},
+	{true, 1, "out dx, eax"},
+	{true, 3, "and al, 21"},
+	{true, 2, "and al, 21"},
+	{true, 5, "adc eax, 0x344aa633"},
+	{true, 6, "xor esp, dword ptr [esi+0x3584344a]"},
+	{true, 1, "cmpsb"},
+	{true, 1, "dec edx"},
+	{true, 2, "xor al, 0x84"},
+	{true, 6, "test byte ptr [0xae3ebae7], dh"},
+	{true, 5, "xor eax, 0xae3ebae7"},
+	{true, 2, "out 0xba, eax"},
+	{true, 5, "mov edx, 0xbf6bae3e"},
+	{true, 2, "scasb"},
+	{true, 1, "scasb"},
+	{true, 7, "imul edi, dword ptr [edi+0x2ee55f86], 0xe2"},
+	{true, 5, "mov edi, 0x2ee55f86"},
+	{true, 3, "xchg bl, byte ptr [edi-27]"},
+	{true, 1, "pop edi"},
+	{true, 2, "in eax, 46"},
+	{true, 3, "loop 0x00000fb4"},
+	{true, 2, "loop 0x00000fb3"},
+	{true, 2, "mov cl, 0xf8"},
+	{true, 1, "clc"},
+	{true, 7, "adc byte ptr [esp+ebx*2+0x4db9939f], dl"},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "pop esp"},
+	{true, 1, "lahf"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 5, "mov ecx, 0x26dda04d"},
+	{true, 1, "dec ebp"},
+	{true, 5, "mov al, byte ptr [0xd15226dd]"},
+	{true, 2, "frstor [esi]"},
+	{true, 2, "push edx"},
+	{true, 1, "push edx"},
+	{true, 6, "rcl dword ptr [ebx+0x270e8bfe], 1"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 6, "dec byte ptr [ebx+0x9113270e]"},
+	{true, 2, "mov ecx, dword ptr [esi]"},
+	{true, 1, "push cs"},
+	{true, 1, "daa"},
+	{true, 6, "adc edx, dword ptr [ecx+0x6302e5f6]"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "mul ch"},
+	{true, 2, "in eax, 2"},
+	{true, 3, "add ah, byte ptr [ebx+104]"},
+	{true, 3, "arpl word ptr [eax-67], bp"},
+	{true, 5, "push 0xc0150dbd"},
+	{true, 5, "mov ebp, 0xcec0150d"},
+	{true, 5, "or eax, 0xb6cec015"},
+	{true, 5, "adc eax, 0x37b6cec0"},
+	{true, 3, "ror dh, 0xb6"},
+	{true, 1, "into"},
+	{true, 2, "mov dh, 55"},
+	{true, 1, "aaa"},
+	{true, 6, "sal dword ptr [edi+0x9ca20621], 1"},
+	{true, 2, "mov bh, 33"},
+	{true, 2, "and dword ptr [esi], eax"},
+	{true, 1, "push es"},
+	{true, 5, "mov byte ptr [0xe955279c], al"},
+	{true, 1, "pushfd"},
+	{true, 1, "daa"},
+	{true, 1, "push ebp"},
+	{true, 5, "jmp 0x493949ff"},
+	{true, 1, "cli"},
+	{true, 2, "cmp dword ptr [ecx], edi"},
+	{true, 3, "cmp dword ptr [ecx+43], ecx"},
+	{true, 1, "dec ecx"},
+	{true, 2, "sub edi, ebx"},
+	{true, 1, "sti"},
+	{true, 2, "jnbe 0x0000104c"},
+	{true, 1, "dec edx"},
+	{true, 5, "mov eax, 0x621cae9c"},
+	{true, 1, "pushfd"},
+	{true, 1, "scasb"},
+	{true, 2, "sbb al, 98"},
+	{true, 2, "bound esi, (invalid)"},
+	{true, 8, "test dword ptr [ebx+ecx-17], 0xb5c2126b"},
+	{true, 1, "inc esp"},
+	{true, 2, "or ebp, edi"},
+	{true, 1, "out dx, eax"},
+	{true, 3, "imul edx, dword ptr [edx], 0xc2"},
+	{true, 2, "adc al, dl"},
+	{true, 3, "ret 0x7bb5"},
+	{true, 2, "mov ch, 123"},
+	{true, 2, "jnp 0x00000fd1"},
+	{true, 1, "iret"},
+	{true, 1, "inc eax"},
+	{true, 5, "call 0xa39a4d29"},
+	{true, 2, "and al, 61"},
+	{true, 5, "cmp eax, 0x1502a39a"},
+	{true, 7, "callf far 0x21b7:0x751502a3"},
+	{true, 5, "mov dword ptr [0xb7751502], eax"},
+	{true, 6, "add dl, byte ptr [0xb321b775]"},
+	{true, 5, "adc eax, 0xb321b775"},
+	{true, 2, "jnz 0x00000fb9"},
+	{true, 2, "mov bh, 33"},
+	{true, 6, "and dword ptr [ebx+0x82a43742], esi"},
+	{true, 2, "mov bl, 66"},
+	{true, 1, "inc edx"},
+	{true, 1, "aaa"},
+	{true, 1, "movsb"},
+	{true, 3, "cmp byte ptr [eax], 0xc0"},
+	{true, 2, "cmp al, al"},
+	{true, 3, "rcr byte ptr [eax], 37"},
+	{true, 6, "sbb byte ptr [0x6b958913], ah"},
+	{true, 5, "and eax, 0x6b958913"},
+	{true, 6, "adc ecx, dword ptr [ecx+0x2e8e6b95]"},
+	{true, 6, "mov dword ptr [ebp+0x9a2e8e6b], edx"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 7, "imul ecx, dword ptr [esi+0xa1f09a2e], 60"},
+	{true, 2, "mov gs, word ptr [esi]"},
+	{true, 8, "callf far 0x7a92:0xa63ca1f0"},
+	{true, 7, "callf far 0x7a92:0xa63ca1f0"},
+	{true, 6, "lock mov eax, dword ptr [0x7a92a63c]"},
+	{true, 5, "mov eax, dword ptr [0x7a92a63c]"},
+	{true, 2, "cmp al, 0xa6"},
+	{true, 1, "cmpsb"},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "jp 0x0000107d"},
+	{true, 2, "jnp 0x00000f98"},
+	{true, 1, "xchg esi, eax"},
+	{true, 7, "callf far 0xed7c:0xa7c2ff3d"},
+	{true, 5, "cmp eax, 0x7ca7c2ff"},
+	{true, 2, "inc edx"},
+	{true, 3, "ret 0x7ca7"},
+	{true, 1, "cmpsd"},
+	{true, 2, "jl 0x00000fef"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "salc"},
+	{true, 1, "pop edx"},
+	{true, 2, "jnz 0x00001010"},
+	{true, 1, "push cs"},
+	{true, 2, "jo 0x00000fc5"},
+	{true, 1, "ret"},
+	{true, 1, "push cs"},
+	{true, 5, "adc eax, 0xb0918e7e"},
+	{true, 2, "jle 0x00000f90"},
+	{true, 6, "mov ss, word ptr [ecx+0x27ed55b0]"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "mov al, 85"},
+	{true, 1, "push ebp"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "daa"},
+	{true, 1, "push ecx"},
+	{true, 1, "xchg edx, eax"},
+	{true, 1, "inc ebp"},
+	{true, 1, "push ss"},
+	{true, 5, "mov ecx, 0x49ba98b1"},
+	{true, 2, "mov cl, 0x98"},
+	{true, 1, "cwde"},
+	{true, 5, "mov edx, 0x45b56f49"},
+	{true, 1, "dec ecx"},
+	{true, 1, "outsd"},
+	{true, 2, "mov ch, 69"},
+	{true, 1, "inc ebp"},
+	{true, 2, "or bh, bl"},
+	{true, 2, "fbld tbyte ptr [ecx]"},
+	{true, 2, "and dword ptr [esi], esi"},
+	{true, 3, "jnb 0x00001051"},
+	{true, 2, "jnb 0x00001050"},
+	{true, 1, "dec esi"},
+	{true, 6, "les ebx, fword ptr [edx+0x0653d808]"},
+	{true, 7, "callf far 0xc791:0x0653d808"},
+	{true, 2, "or al, bl"},
+	{true, 3, "fcom dword ptr [ebx+6]"},
+	{true, 1, "push ebx"},
+	{true, 1, "push es"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 10, "mov dword ptr [ecx+0xe5af3150], 0xa94a2f10"},
+	{true, 7, "adc dword ptr [eax+49], 0x2f10e5af"},
+	{true, 1, "push eax"},
+	{true, 6, "xor dword ptr [edi+0x4a2f10e5], ebp"},
+	{true, 1, "scasd"},
+	{true, 2, "in eax, 16"},
+	{true, 2, "adc byte ptr [edi], ch"},
+	{true, 1, "das"},
+	{true, 1, "dec edx"},
+	{true, 5, "test eax, 0xf81486d9"},
+	{true, 6, "fld dword ptr [esi+0x2837f814]"},
+	{true, 3, "xchg dl, byte ptr [eax+edi*8]"},
+	{true, 2, "adc al, 0xf8"},
+	{true, 1, "clc"},
+	{true, 1, "aaa"},
+	{true, 6, "sub byte ptr [esi+0xd3166825], ah"},
+	{true, 1, "cmpsb"},
+	{true, 5, "and eax, 0x9cd31668"},
+	{true, 5, "push 0xdb9cd316"},
+	{true, 1, "push ss"},
+	{true, 7, "rcr dword ptr [ebx+ebx*8+0x6a898421], cl"},
+	{true, 1, "pushfd"},
+	{false, 2, 0},
+	{true, 7, "and dword ptr [ecx+ecx*4+0x4a537d6a], eax"},
+	{true, 6, "test byte ptr [ecx+0x4a537d6a], cl"},
+	{true, 3, "mov dword ptr [edx+125], ebp"},
+	{true, 2, "push 125"},
+	{true, 2, "jnl 0x00001055"},
+	{true, 1, "push ebx"},
+	{true, 1, "dec edx"},
+	{true, 1, "push esi"},
+	{true, 2, "or ebp, edx"},
+	{true, 7, "jmp far 0x7f69:0x1a630695"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 1, "push es"},
+	{true, 2, "arpl word ptr [edx], bx"},
+	{true, 3, "sbb ch, byte ptr [ecx+127]"},
+	{true, 7, "imul edi, dword ptr [edi-93], 0xf9a2b6ba"},
+	{true, 2, "jnle 0x00000fa5"},
+	{true, 5, "mov dword ptr [0xf9a2b6ba], eax"},
+	{true, 5, "mov edx, 0x46f9a2b6"},
+	{true, 2, "mov dh, 0xa2"},
+	{true, 5, "mov byte ptr [0x29cb46f9], al"},
+	{true, 1, "stc"},
+	{true, 1, "inc esi"},
+	{true, 1, "retf"},
+	{true, 2, "sub edx, esi"},
+	{true, 7, "repne xor eax, dword ptr [ebx+0x2f138160]"},
+	{true, 6, "xor eax, dword ptr [ebx+0x2f138160]"},
+	{true, 4, "and dword ptr [eax-127], 19"},
+	{true, 1, "pushad"},
+	{true, 6, "adc dword ptr [ebx], 0x6dcfa32f"},
+	{true, 2, "adc ebp, dword ptr [edi]"},
+	{true, 1, "das"},
+	{true, 5, "mov dword ptr [0x9b426dcf], eax"},
+	{true, 1, "iret"},
+	{true, 1, "insd"},
+	{true, 1, "inc edx"},
+	{true, 1, "wait"},
+	{false, 2, 0},
+	{true, 1, "pop edx"},
+	{true, 5, "mov edi, 0x63e05b37"},
+	{true, 1, "aaa"},
+	{true, 1, "pop ebx"},
+	{true, 2, "loopne 0x00001065"},
+	{true, 4, "arpl word ptr [esi+ebx*4+14], bp"},
+	{true, 1, "insb"},
+	{true, 1, "sahf"},
+	{true, 1, "push cs"},
+	{true, 1, "xchg edx, eax"},
+	{true, 1, "lodsd"},
+	{true, 3, "sbb bl, 2"},
+	{true, 2, "fild dword ptr [edx]"},
+	{true, 2, "add ch, byte ptr [ecx]"},
+	{true, 3, "sub dword ptr [ebp-65], ebp"},
+	{true, 1, "insd"},
+	{true, 5, "mov edi, 0x0f7ec829"},
+	{true, 2, "sub eax, ecx"},
+	{true, 4, "enter 0x0f7e, 103"},
+	{true, 2, "jle 0x00001011"},
+	{true, 3, "packuswb mm4, mm3"},
+	{true, 3, "jcez 0x00000fa5"},
+	{true, 2, "jcez 0x00000fa4"},
+	{true, 5, "mov byte ptr [0x56c5f419], al"},
+	{true, 2, "sbb esp, esi"},
+	{true, 1, "hlt"},
+	{true, 3, "lds edx, fword ptr [esi+3]"},
+	{true, 1, "push esi"},
+	{true, 6, "add eax, dword ptr [edi+0xcb6439e6]"},
+	{true, 2, "xchg esp, esi"},
+	{true, 2, "out 57, al"},
+	{true, 4, "cmp dword ptr [ebx+ecx*8-31], esp"},
+	{true, 2, "retf"},
+	{true, 1, "retf"},
+	{true, 2, "loope 0x0000105b"},
+	{true, 1, "pop ecx"},
+	{true, 1, "lahf"},
+	{true, 3, "cmp dword ptr [ebx], 58"},
+	{true, 2, "cmp edi, dword ptr [edx]"},
+	{true, 3, "cmp al, byte ptr [edi+esi*2]"},
+	{true, 2, "add al, 119"},
+	{true, 2, "jnbe 0x00000fd4"},
+	{true, 6, "shl byte ptr [ebp+0x372626a5], cl"},
+	{true, 1, "movsd"},
+	{true, 1, "movsd"},
+	{true, 3, "aaa"},
+	{true, 2, "aaa"},
+	{true, 1, "aaa"},
+	{true, 1, "clc"},
+	{true, 3, "sub cl, byte ptr [ebx-91]"},
+	{true, 1, "dec ebx"},
+	{true, 1, "movsd"},
+	{true, 3, "xor dword ptr [ecx-86], ebp"},
+	{true, 10, "imul ebp, dword ptr [edx+0x7b005dd0], 0x03f03e8c"},
+	{true, 1, "stosb"},
+	{true, 3, "rcr byte ptr [ebp], 1"},
+	{true, 1, "pop ebp"},
+	{true, 3, "add byte ptr [ebx-116], bh"},
+	{true, 2, "jnp 0x00000f8e"},
+	{true, 2, "mov dword ptr [esi], seg8"},
+	{true, 4, "lock add esi, dword ptr ds:[eax]"},
+	{true, 3, "lock add esi, dword ptr [eax]"},
+	{true, 2, "add esi, dword ptr [eax]"},
+	{true, 2, "xor dl, ch"},
+	{true, 7, "jmp far 0x298c:0x22dd8d86"},
+	{true, 6, "xchg cl, byte ptr [ebp+0x298c22dd]"},
+	{true, 2, "lea ebx, (invalid)"},
+	{true, 2, "frstor [edx]"},
+	{true, 7, "and cl, byte ptr [ecx+ebp+0x2732738f]"},
+	{true, 2, "mov dword ptr [ecx], gs"},
+	{true, 6, "sub dword ptr [edi+0xe5273273], ecx"},
+	{false, 2, 0},
+	{true, 2, "jnb 0x00001034"},
+	{true, 2, "xor ah, byte ptr [edi]"},
+	{true, 1, "daa"},
+	{true, 2, "in eax, 14"},
+	{true, 1, "push cs"},
+	{true, 5, "mov ecx, 0xe568b051"},
+	{true, 1, "push ecx"},
+	{true, 2, "mov al, 104"},
+	{true, 5, "push 0x923dece5"},
+	{true, 2, "in eax, 0xec"},
+	{true, 1, "in al, dx"},
+	{true, 5, "cmp eax, 0x636d2092"},
+	{true, 1, "xchg edx, eax"},
+	{true, 3, "and byte ptr [ebp+99], ch"},
+	{true, 1, "insd"},
+	{true, 3, "arpl word ptr [ebp+110], dx"},
+	{true, 1, "push ebp"},
+	{true, 1, "outsb"},
+	{true, 1, "cld"},
+	{true, 1, "dec ebx"},
+	{true, 5, "adc eax, 0x6302a914"},
+	{true, 2, "adc al, 0xa9"},
+	{true, 5, "test eax, 0x71086302"},
+	{true, 3, "add ah, byte ptr [ebx+8]"},
+	{true, 2, "arpl word ptr [eax], cx"},
+	{true, 3, "or byte ptr [ecx-64], dh"},
+	{true, 2, "jno 0x00000fc2"},
+	{true, 4, "rcr byte ptr [edi+23], 0xef"},
+	{true, 1, "pop edi"},
+	{true, 1, "pop ss"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "not bl"},
+	{true, 2, "rcr ecx, cl"},
+	{false, 2, 0},
+	{true, 2, "loop 0x0000101b"},
+	{true, 2, "sbb dword ptr [ecx], edx"},
+	{true, 3, "adc dword ptr [ebp+98], edx"},
+	{true, 1, "push ebp"},
+	{true, 2, "bound esi, qword ptr [ecx]"},
+	{true, 6, "xor dword ptr [eax+0x2920e173], ecx"},
+	{true, 3, "mov byte ptr [ebx-31], dh"},
+	{true, 2, "jnb 0x00000fe3"},
+	{true, 2, "loope 0x00001022"},
+	{true, 2, "and byte ptr [ecx], ch"},
+	{true, 6, "sub dword ptr [0x547cb3e4], esp"},
+	{true, 5, "and eax, 0x547cb3e4"},
+	{true, 2, "in al, 0xb3"},
+	{true, 2, "mov bl, 124"},
+	{true, 2, "jl 0x00001056"},
+	{true, 1, "push esp"},
+	{true, 2, "jnle 0x0000106c"},
+	{true, 2, "push 0x80"},
+	{true, 8, "or byte ptr [edx+edx*4+0xc6684707], 0xd9"},
+	{true, 6, "mov dword ptr [edx+0xc6684707], ss"},
+	{true, 1, "xchg edx, eax"},
+	{true, 1, "pop es"},
+	{true, 1, "inc edi"},
+	{true, 5, "push 0xbc4ed9c6"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 1, "dec esi"},
+	{true, 5, "mov esp, 0x849dc545"},
+	{true, 1, "inc ebp"},
+	{true, 6, "lds ebx, fword ptr [ebp+0xa3193c84]"},
+	{true, 1, "popfd"},
+	{true, 3, "test byte ptr [ecx+ebx], bh"},
+	{true, 2, "cmp al, 25"},
+	{true, 6, "sbb dword ptr [ebx+0xcf10118f], esp"},
+	{true, 5, "mov dword ptr [0xcf10118f], eax"},
+	{false, 2, 0},
+	{true, 2, "adc dword ptr [eax], edx"},
+	{true, 2, "adc bh, cl"},
+	{true, 1, "iret"},
+	{true, 2, "jmp 0x00001066"},
+	{true, 6, "and eax, 0x18c70fee"},
+	{true, 5, "and eax, 0x18c70fee"},
+	{true, 1, "out dx, al"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "sbb byte ptr [eax-53], cl"},
+	{true, 1, "dec eax"},
+	{true, 1, "retf"},
+	{true, 5, "sar dword ptr ds:[eax-16], 117"},
+	{true, 4, "sar dword ptr [eax-16], 117"},
+	{true, 2, "js 0x00000ff2"},
+	{true, 3, "lock jnz 0x00000f9b"},
+	{true, 2, "jnz 0x00000f9a"},
+	{true, 1, "cwde"},
+	{true, 3, "movsx eax, sp"},
+	{true, 5, "mov edi, 0x12e800c4"},
+	{true, 2, "les eax, fword ptr [eax]"},
+	{true, 2, "add al, ch"},
+	{true, 5, "call 0x4956f317"},
+	{true, 2, "adc ah, bl"},
+	{true, 2, "jcez 0x00001058"},
+	{true, 1, "push esi"},
+	{true, 1, "dec ecx"},
+	{true, 1, "dec esp"},
+	{true, 1, "insb"},
+	{true, 5, "mov ebp, 0xa71602be"},
+	{true, 5, "mov esi, 0xb6a71602"},
+	{true, 2, "add dl, byte ptr [esi]"},
+	{true, 1, "push ss"},
+	{true, 1, "cmpsd"},
+	{true, 2, "mov dh, 102"},
+	{true, 2, "stosw"},
+	{true, 1, "stosd"},
+	{true, 2, "and al, 0xda"},
+	{true, 3, "fidivr dword ptr [eax-50]"},
+	{true, 2, "js 0x00000fd0"},
+	{true, 1, "into"},
+	{true, 2, "jmp 0x00001033"},
+	{true, 2, "xor ebx, ebp"},
+	{true, 2, "jmp 0x00001071"},
+	{true, 1, "outsd"},
+	{true, 2, "sub ebp, esi"},
+	{true, 1, "cmc"},
+	{true, 2, "fmul dword ptr [edx]"},
+	{true, 2, "or cl, byte ptr [ebx]"},
+	{true, 2, "or esi, dword ptr [edx]"},
+	{true, 3, "xor ah, byte ptr [edx]"},
+	{true, 2, "and al, 0xa2"},
+	{true, 5, "mov byte ptr [0x81b2240d], al"},
+	{true, 5, "or eax, 0x0081b224"},
+	{true, 2, "and al, 0xb2"},
+	{true, 2, "mov dl, 0x81"},
+	{true, 6, "add dword ptr [eax], 0xdeac494e"},
+	{true, 3, "add byte ptr [esi+73], cl"},
+	{true, 1, "dec esi"},
+	{true, 1, "dec ecx"},
+	{true, 1, "lodsb"},
+	{true, 3, "ficomp word ptr [edx+68]"},
+	{true, 1, "pop edx"},
+	{true, 1, "inc esp"},
+	{true, 3, "sub byte ptr [esi-76], cl"},
+	{true, 1, "dec esi"},
+	{true, 2, "mov ah, 0xfc"},
+	{true, 1, "cld"},
+	{true, 2, "lock cmc"},
+	{true, 1, "cmc"},
+	{true, 2, "in al, 0xf6"},
+	{true, 6, "div byte ptr [ecx+0x4bcbaf82]"},
+	{true, 2, "mov cl, 0x82"},
+	{true, 7, "sub byte ptr [edi+0xed784bcb], 0xdb"},
+	{true, 1, "scasd"},
+	{true, 1, "retf"},
+	{true, 1, "dec ebx"},
+	{true, 2, "js 0x00000fef"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "fisttp dword ptr [eax]"},
+	{true, 6, "or byte ptr [edx+0xd89ab129], bh"},
+	{true, 5, "mov edx, 0xd89ab129"},
+	{true, 6, "sub dword ptr [ecx+0x34fbd89a], esi"},
+	{true, 2, "mov cl, 0x9a"},
+	{true, 7, "callf far 0x241c:0xd734fbd8"},
+	{true, 2, "fdivr st, st(3)"},
+	{true, 1, "sti"},
+	{true, 2, "xor al, 0xd7"},
+	{true, 1, "xlat"},
+	{true, 2, "sbb al, 36"},
+	{true, 2, "and al, 0x93"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 3, "xor edx, dword ptr [edx+110]"},
+	{true, 1, "push edx"},
+	{true, 1, "outsb"},
+	{true, 1, "out dx, al"},
+	{true, 3, "add dword ptr [ebx+65], ebx"},
+	{true, 1, "pop ebx"},
+	{true, 1, "inc ecx"},
+	{true, 3, "lds ebp, fword ptr [ecx+113]"},
+	{true, 7, "imul esi, dword ptr [ecx+5], 0x3b372821"},
+	{true, 2, "jno 0x00001007"},
+	{true, 5, "add eax, 0x3b372821"},
+	{true, 2, "and dword ptr [eax], ebp"},
+	{true, 2, "sub byte ptr [edi], dh"},
+	{true, 1, "aaa"},
+	{true, 7, "cmp eax, dword ptr [ebx+ecx+0x29915b88]"},
+	{true, 2, "test byte ptr [ebx], cl"},
+	{true, 6, "or ecx, dword ptr [eax+0xfc29915b]"},
+	{true, 3, "mov byte ptr [ebx-111], bl"},
+	{true, 1, "pop ebx"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "sub esp, edi"},
+	{true, 1, "cld"},
+	{true, 5, "imul edi, dword ptr [ebx+58], 100"},
+	{true, 2, "jl 0x00000fe5"},
+	{true, 2, "jcez 0x0000103c"},
+	{true, 4, "cmp ah, byte ptr [eax+esi-100]"},
+	{true, 8, "xor byte ptr fs:[eax+eax+0xf3394144], bl"},
+	{true, 7, "xor byte ptr [eax+eax+0xf3394144], bl"},
+	{true, 1, "pushfd"},
+	{true, 4, "add byte ptr [ecx+eax*2+57], al"},
+	{true, 1, "inc esp"},
+	{true, 1, "inc ecx"},
+	{true, 2, "cmp ebx, esi"},
+	{true, 3, "repne cwde"},
+	{true, 2, "repne cwde"},
+	{true, 1, "cwde"},
+	{true, 1, "push edi"},
+	{true, 1, "daa"},
+	{true, 1, "salc"},
+	{true, 3, "fmul dword ptr [edi+110]"},
+	{true, 1, "dec edi"},
+	{true, 1, "outsb"},
+	{true, 2, "xor al, 0x92"},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "jmp 0x00001063"},
+	{true, 1, "popad"},
+	{true, 1, "dec ebp"},
+	{true, 3, "in eax, 48"},
+	{true, 2, "in eax, 48"},
+	{true, 3, "xor byte ptr [esp+edx*4], dh"},
+	{true, 2, "xor al, 0x94"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "and ebp, dword ptr [ecx]"},
+	{true, 3, "sub dword ptr [ecx-99], esi"},
+	{true, 2, "jno 0x00000f9f"},
+	{true, 1, "popfd"},
+	{true, 2, "mov ch, 9"},
+	{true, 3, "or dword ptr [edi+61], edx"},
+	{true, 1, "push edi"},
+	{true, 5, "cmp eax, 0x6c25068a"},
+	{true, 2, "mov al, byte ptr [esi]"},
+	{true, 1, "push es"},
+	{true, 5, "and eax, 0xdf98f66c"},
+	{true, 1, "insb"},
+	{true, 6, "neg byte ptr [eax+0x0be4d9df]"},
+	{true, 1, "cwde"},
+	{false, 2, 0},
+	{true, 2, "ftst"},
+	{true, 2, "in al, 11"},
+	{true, 2, "or ebp, edx"},
+	{true, 7, "jmp far 0xb2e1:0x6ac6da4e"},
+	{true, 1, "dec esi"},
+	{true, 2, "fcmovb st, st(6)"},
+	{false, 2, 0},
+	{true, 2, "push 0xe1"},
+	{true, 2, "loope 0x00000fb4"},
+	{true, 2, "mov dl, 89"},
+	{true, 1, "pop ecx"},
+	{true, 1, "pop esp"},
+	{true, 2, "loopne 0x00001014"},
+	{true, 3, "adc cl, byte ptr [eax+114]"},
+	{true, 1, "dec eax"},
+	{true, 2, "jb 0x0000107c"},
+	{true, 2, "jp 0x00000fb2"},
+	{true, 2, "mov al, 0x99"},
+	{true, 1, "cdq"},
+	{true, 2, "mov dl, 45"},
+	{true, 5, "sub eax, 0xf4cd1f47"},
+	{true, 1, "inc edi"},
+	{true, 1, "pop ds"},
+	{true, 2, "int 0xf4"},
+	{true, 1, "hlt"},
+	{true, 1, "pop eax"},
+	{true, 3, "test dword ptr [eax+44], eax"},
+	{true, 1, "inc eax"},
+	{true, 2, "sub al, 0xa1"},
+	{true, 5, "mov eax, dword ptr [0x5e4a2c19]"},
+	{true, 3, "sbb dword ptr [edx+ecx*2], ebp"},
+	{true, 2, "sub al, 74"},
+	{true, 1, "dec edx"},
+	{true, 1, "pop esi"},
+	{true, 1, "pop esi"},
+	{true, 2, "idiv byte ptr [edi]"},
+	{true, 1, "aas"},
+	{true, 1, "inc edx"},
+	{true, 1, "push eax"},
+	{true, 1, "sahf"},
+	{true, 1, "cmpsb"},
+	{true, 2, "xor al, 117"},
+	{true, 2, "jnz 0x00000fe2"},
+	{true, 2, "loopne 0x00000fb5"},
+	{true, 2, "mov bl, 0xca"},
+	{true, 3, "retf 0x0da8"},
+	{true, 2, "test al, 13"},
+	{true, 5, "or eax, 0xa6a586dc"},
+	{true, 6, "fadd qword ptr [esi+0xd344a6a5]"},
+	{true, 6, "xchg ah, byte ptr [ebp+0x53d344a6]"},
+	{true, 1, "movsd"},
+	{true, 1, "cmpsb"},
+	{true, 1, "inc esp"},
+	{true, 3, "rcl dword ptr [ebx-67], cl"},
+	{true, 1, "push ebx"},
+	{true, 5, "mov ebp, 0x0cd5bdec"},
+	{true, 1, "in al, dx"},
+	{true, 5, "mov ebp, 0x74990cd5"},
+	{true, 2, "aad 12"},
+	{true, 2, "or al, 0x99"},
+	{true, 1, "cdq"},
+	{true, 2, "jz 0x00001051"},
+	{true, 1, "dec edi"},
+	{true, 6, "rol byte ptr [ebx+0xc271787f], cl"},
+	{true, 4, "cmp dword ptr [edi+120], 113"},
+	{true, 2, "jnle 0x0000107a"},
+	{true, 2, "js 0x00001073"},
+	{true, 2, "jno 0x00000fc4"},
+	{true, 3, "ret 0xffffe4bf"},
+	{true, 5, "mov edi, 0x2b78c9e4"},
+	{true, 2, "in al, 0xc9"},
+	{true, 1, "leave"},
+	{true, 2, "js 0x0000102d"},
+	{true, 2, "sub ecx, dword ptr [edi]"},
+	{true, 7, "rsqrtps xmm7, xmmword ptr [edi+0x51fc2945]"},
+	{true, 1, "push edx"},
+	{true, 5, "mov edi, 0x51fc2945"},
+	{true, 1, "inc ebp"},
+	{true, 2, "sub esp, edi"},
+	{true, 1, "cld"},
+	{true, 1, "push ecx"},
+	{true, 1, "pop edi"},
+	{true, 5, "mov dword ptr [0x7e8ffac6], eax"},
+	{false, 2, 0},
+	{true, 1, "cli"},
+	{false, 2, 0},
+	{true, 2, "jle 0x00001022"},
+	{true, 6, "and byte ptr [esi+0xca014e73], bh"},
+	{true, 5, "mov esi, 0xca014e73"},
+	{true, 2, "jnb 0x00001050"},
+	{true, 1, "dec esi"},
+	{true, 2, "add edx, ecx"},
+	{true, 3, "retf 0x10a5"},
+	{true, 1, "movsd"},
+	{true, 2, "adc al, cl"},
+	{true, 4, "enter 0xfffffd1b, 0xb1"},
+	{true, 2, "sbb edi, ebp"},
+	{true, 1, "std"},
+	{true, 2, "mov cl, 0xd4"},
+	{true, 2, "aam 0xf0"},
+	{true, 4, "lock mov dword ptr [edx-30], ebx"},
+	{true, 3, "mov dword ptr [edx-30], ebx"},
+	{true, 1, "pop edx"},
+	{true, 2, "loop 0x00000ff3"},
+	{false, 1, 0},
+	{true, 1, "dec ebp"},
+	{true, 2, "jnl 0x0000102b"},
+	{true, 3, "sub dword ptr [ebx+edi*4], ebx"},
+	{true, 2, "sbb al, 0xbb"},
+	{true, 5, "mov ebx, 0xf17337a1"},
+	{true, 5, "mov eax, dword ptr [0xedf17337]"},
+	{true, 1, "aaa"},
+	{true, 2, "jnb 0x00000ff3"},
+	{false, 1, 0},
+	{true, 1, "in eax, dx"},
+	{true, 3, "mov ah, byte ptr [edi-75]"},
+	{true, 3, "mov ch, 118"},
+	{true, 2, "mov ch, 118"},
+	{true, 2, "jbe 0x00000fef"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "add dh, byte ptr [ecx]"},
+	{true, 3, "xor dword ptr [eax-104], ecx"},
+	{true, 1, "dec eax"},
+	{true, 1, "cwde"},
+	{true, 1, "xlat"},
+	{true, 1, "outsb"},
+	{true, 2, "pop es"},
+	{true, 1, "pop es"},
+	{true, 1, "stosd"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 6, "bound edx, qword ptr [esi+0xe18bd8e1]"},
+	{true, 1, "xchg esi, eax"},
+	{true, 2, "loope 0x00000fda"},
+	{true, 6, "fmul dword ptr [ebx+0x1954a6e1]"},
+	{true, 2, "mov esp, ecx"},
+	{true, 2, "loope 0x00000fa8"},
+	{true, 1, "cmpsb"},
+	{true, 1, "push esp"},
+	{true, 2, "sbb esi, ebx"},
+	{true, 2, "fsubrp st(1), st"},
+	{true, 2, "loope 0x00001066"},
+	{true, 8, "jmp far 0xa268:0xdaf5d8b7"},
+	{true, 7, "jmp far 0xa268:0xdaf5d8b7"},
+	{true, 2, "mov bh, 0xd8"},
+	{true, 2, "fdiv st, st(5)"},
+	{true, 1, "cmc"},
+	{true, 3, "fisubr dword ptr [eax-94]"},
+	{true, 5, "push 0x1d157ba2"},
+	{true, 5, "mov byte ptr [0x501d157b], al"},
+	{true, 2, "jnp 0x00001017"},
+	{true, 5, "adc eax, 0x1cae501d"},
+	{true, 5, "sbb eax, 0x491cae50"},
+	{true, 1, "push eax"},
+	{true, 1, "scasb"},
+	{true, 2, "sbb al, 73"},
+	{true, 1, "dec ecx"},
+	{true, 6, "fiadd dword ptr [0xf3cb8698]"},
+	{true, 5, "add eax, 0xf3cb8698"},
+	{true, 1, "cwde"},
+	{true, 2, "xchg cl, bl"},
+	{true, 1, "retf"},
+	{true, 3, "rep loop 0x00001033"},
+	{true, 2, "loop 0x00001032"},
+	{true, 7, "xor byte ptr [esp+0xf632bf4e], ch"},
+	{true, 1, "lodsb"},
+	{true, 2, "in al, 78"},
+	{true, 1, "dec esi"},
+	{true, 5, "mov edi, 0xe83bf632"},
+	{true, 2, "xor dh, dh"},
+	{true, 2, "idiv byte ptr [ebx]"},
+	{true, 2, "cmp ebp, eax"},
+	{true, 5, "call 0x73db882b"},
+	{true, 3, "js 0x00000fde"},
+	{true, 2, "js 0x00000fdd"},
+	{false, 2, 0},
+	{true, 2, "jnb 0x0000101a"},
+	{true, 2, "sbb byte ptr [ebx], ah"},
+	{true, 2, "and eax, ebx"},
+	{true, 1, "ret"},
+	{true, 2, "fcmovnb st, st(3)"},
+	{true, 1, "ret"},
+	{true, 2, "sbb dh, byte ptr [ecx]"},
+	{true, 6, "xor dword ptr [edi+0x8b21a33f], esp"},
+	{true, 1, "cmpsd"},
+	{true, 1, "aas"},
+	{true, 5, "mov dword ptr [0xa3e98b21], eax"},
+	{true, 6, "and dword ptr [ebx+0x3d0ea3e9], ecx"},
+	{true, 2, "mov ebp, ecx"},
+	{true, 5, "jmp 0x123d1ea8"},
+	{true, 5, "mov dword ptr [0xdb123d0e], eax"},
+	{true, 1, "push cs"},
+	{true, 5, "cmp eax, 0x1888db12"},
+	{true, 2, "adc bl, bl"},
+	{true, 6, "fisttp dword ptr [eax+0x7be56a18]"},
+	{true, 2, "mov byte ptr [eax], bl"},
+	{true, 3, "sbb byte ptr [edx-27], ch"},
+	{true, 2, "push 0xe5"},
+	{true, 2, "in eax, 123"},
+	{true, 2, "jnp 0x00001076"},
+	{true, 2, "jz 0x0000102d"},
+	{true, 2, "sub ebp, esp"},
+	{true, 1, "in al, dx"},
+	{true, 2, "cmp eax, eax"},
+	{true, 7, "rol byte ptr [0xcc644c2e], 51"},
+	{true, 5, "add eax, 0xcc644c2e"},
+	{true, 2, "dec esp"},
+	{true, 1, "dec esp"},
+	{true, 2, "int3"},
+	{true, 1, "int3"},
+	{true, 2, "xor edi, esi"},
+	{false, 2, 0},
+	{true, 1, "pop eax"},
+	{true, 2, "in al, 0xcb"},
+	{true, 1, "retf"},
+	{true, 1, "movsb"},
+	{true, 3, "test byte ptr [eax-55], ch"},
+	{true, 5, "push 0x1dd6afc9"},
+	{true, 1, "leave"},
+	{true, 1, "scasd"},
+	{true, 1, "salc"},
+	{true, 5, "sbb eax, 0x1a257180"},
+	{true, 4, "xor byte ptr [ecx+37], 26"},
+	{true, 2, "jno 0x00001027"},
+	{true, 5, "and eax, 0xc9ae011a"},
+	{true, 2, "sbb al, byte ptr [ecx]"},
+	{true, 6, "add dword ptr [esi+0xea1333c9], ebp"},
+	{true, 1, "scasb"},
+	{true, 1, "leave"},
+	{true, 2, "xor edx, dword ptr [ebx]"},
+	{true, 2, "adc ebp, edx"},
+	{true, 7, "jmp far 0x94dd:0x6def2af6"},
+	{true, 2, "imul byte ptr [edx]"},
+	{true, 2, "sub ch, bh"},
+	{true, 1, "out dx, eax"},
+	{true, 1, "insd"},
+	{true, 7, "fst qword ptr [eax+eax*8+0xdd8c8116]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "rcl byte ptr [esi], 0x81"},
+	{true, 1, "push ss"},
+	{true, 11, "or dword ptr [ebp+ebx*8+0xc41b59e5], 0xd663ab46"},
+	{true, 2, "mov ebp, ds"},
+	{true, 2, "fucom st(5)"},
+	{true, 2, "in eax, 89"},
+	{true, 1, "pop ecx"},
+	{true, 2, "sbb eax, esp"},
+	{true, 3, "les eax, fword ptr [esi-85]"},
+	{true, 1, "inc esi"},
+	{true, 1, "stosd"},
+	{true, 2, "arpl si, dx"},
+	{true, 1, "salc"},
+	{true, 1, "push ds"},
+	{true, 5, "mov dword ptr [0x3697d58e], eax"},
+	{true, 2, "mov ss, bp"},
+	{true, 2, "aad 0x97"},
+	{true, 1, "xchg edi, eax"},
+	{true, 3, "js 0x00001020"},
+	{true, 2, "js 0x0000101f"},
+	{true, 5, "sbb eax, 0xa51eb9ac"},
+	{true, 1, "lodsb"},
+	{true, 5, "mov ecx, 0x3f73a51e"},
+	{true, 1, "push ds"},
+	{true, 1, "movsd"},
+	{true, 2, "jnb 0x00001041"},
+	{true, 1, "aas"},
+	{false, 2, 0},
+	{true, 2, "mov ch, 45"},
+	{true, 5, "sub eax, 0x0f65ecb7"},
+	{true, 2, "mov bh, 0xec"},
+	{true, 1, "in al, dx"},
+	{true, 5, "cmpps xmm6, xmm0, 0xd9"},
+	{true, 4, "cmpps xmm6, xmm0, 0xd9"},
+	{true, 3, "ret 0xffffd9f0"},
+	{true, 3, "lock fxch st(6)"},
+	{true, 2, "fxch st(6)"},
+	{true, 1, "into"},
+	{true, 1, "push esi"},
+	{true, 6, "cmp dword ptr [esi], 0x83c714ed"},
+	{true, 2, "in eax, dx"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "adc al, 0xc7"},
+	{true, 10, "mov dword ptr [ebx+0xd85369c6], 0xe7c7665a"},
+	{true, 3, "add esi, 105"},
+	{false, 2, 0},
+	{true, 7, "imul edx, dword ptr [ebx-40], 0xe7c7665a"},
+	{true, 1, "push ebx"},
+	{true, 3, "fcomp dword ptr [edx+102]"},
+	{true, 1, "pop edx"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "out 0xd8, eax"},
+	{true, 3, "fsub dword ptr [eax+69]"},
+	{true, 1, "pushad"},
+	{true, 1, "inc ebp"},
+	{true, 2, "aad 0xef"},
+	{true, 1, "out dx, eax"},
+	{true, 1, "inc edi"},
+	{true, 1, "cwde"},
+	{true, 2, "not ebx"},
+	{true, 2, "rol edi, cl"},
+	{false, 2, 0},
+	{true, 5, "and eax, 0x8f201154"},
+	{true, 1, "push esp"},
+	{true, 2, "adc dword ptr [eax], esp"},
+	{true, 6, "and byte ptr [edi+0x2dc613df], cl"},
+	{false, 2, 0},
+	{true, 2, "fist word ptr [ebx]"},
+	{true, 2, "adc eax, esi"},
+	{false, 2, 0},
+	{true, 5, "sub eax, 0x2db87371"},
+	{true, 2, "jno 0x00001075"},
+	{true, 2, "jnb 0x00000fba"},
+	{true, 5, "mov eax, 0xa000882d"},
+	{true, 5, "sub eax, 0x85a00088"},
+	{true, 2, "mov byte ptr [eax], al"},
+	{true, 6, "add byte ptr [eax+0xb091c285], ah"},
+	{true, 5, "mov al, byte ptr [0xb091c285]"},
+	{true, 2, "test edx, eax"},
+	{true, 3, "ret 0xffffb091"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "mov al, 0x9d"},
+	{true, 1, "popfd"},
+	{true, 1, "pop ss"},
+	{true, 2, "mov dword ptr [edi], seg7"},
+	{true, 1, "aaa"},
+	{true, 5, "mov ebp, 0x380534d9"},
+	{true, 7, "fnstenv [eax+0x84b76d38]"},
+	{true, 2, "xor al, 5"},
+	{true, 5, "add eax, 0x84b76d38"},
+	{true, 3, "cmp byte ptr [ebp-73], ch"},
+	{true, 1, "insd"},
+	{true, 2, "mov bh, 0x84"},
+	{true, 3, "test byte ptr [esi-57], dl"},
+	{true, 1, "push esi"},
+	{false, 2, 0},
+	{true, 2, "rep xchg ebx, eax"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 6, "add esp, dword ptr [edi+0x9538210c]"},
+	{true, 1, "cmpsd"},
+	{true, 2, "or al, 33"},
+	{true, 2, "and dword ptr [eax], edi"},
+	{true, 6, "cmp byte ptr [ebp+0x9d2d8eae], dl"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 1, "scasb"},
+	{true, 6, "mov gs, word ptr [0x3bc1239d]"},
+	{true, 5, "sub eax, 0x3bc1239d"},
+	{true, 1, "popfd"},
+	{true, 2, "and eax, ecx"},
+	{true, 3, "sar dword ptr [ebx], 0xcb"},
+	{true, 2, "cmp ecx, ebx"},
+	{true, 1, "retf"},
+	{true, 2, "adc al, 9"},
+	{true, 6, "or dword ptr [ebx+0xa1b51e65], edx"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 2, "push ds"},
+	{true, 1, "push ds"},
+	{true, 2, "mov ch, 0xa1"},
+	{true, 5, "mov eax, dword ptr [0x3e721ceb]"},
+	{true, 2, "jmp 0x0000101e"},
+	{true, 2, "sbb al, 114"},
+	{true, 2, "jb 0x00001040"},
+	{true, 2, "iret"},
+	{true, 1, "iret"},
+	{true, 1, "das"},
+	{true, 2, "cwde"},
+	{true, 1, "cwde"},
+	{true, 1, "hlt"},
+	{true, 2, "lea edx, [edx]"},
+	{true, 2, "adc ah, cl"},
+	{true, 2, "loope 0x00000feb"},
+	{true, 5, "jmp 0xe2baf014"},
+	{true, 7, "pavgb mm7, qword ptr [edx+0x5e8f78e2]"},
+	{true, 2, "loopne 0x00000fbc"},
+	{true, 5, "mov edx, 0x5e8f78e2"},
+	{true, 2, "loop 0x0000107a"},
+	{true, 2, "js 0x00000f91"},
+	{false, 2, 0},
+	{true, 1, "pop esi"},
+	{true, 2, "jp 0x00000f88"},
+	{true, 4, "xchg al, byte ptr [edi+ecx*4+43]"},
+	{true, 1, "inc esp"},
+	{false, 2, 0},
+	{true, 6, "sub edi, dword ptr [ebx+0xe889406b]"},
+	{true, 5, "mov ebx, 0xe889406b"},
+	{true, 4, "imul eax, dword ptr [eax-119], 0xe8"},
+	{true, 1, "inc eax"},
+	{true, 2, "mov eax, ebp"},
+	{true, 5, "call 0x7e411757"},
+	{true, 1, "push edx"},
+	{true, 1, "pop es"},
+	{true, 1, "inc ecx"},
+	{true, 2, "jle 0x00000f87"},
+	{true, 3, "test dword ptr [ecx-43], eax"},
+	{true, 1, "inc ecx"},
+	{true, 2, "aad 0x94"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "out 2, eax"},
+	{true, 6, "add dl, byte ptr [0x5cc495b8]"},
+	{true, 5, "adc eax, 0x5cc495b8"},
+	{true, 5, "mov eax, 0x765cc495"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 4, "les ebx, fword ptr [esi+esi*2+122]"},
+	{true, 1, "pop esp"},
+	{true, 2, "jbe 0x0000107c"},
+	{true, 2, "jp 0x00000fcd"},
+	{true, 1, "retf"},
+	{true, 1, "nop"},
+	{true, 5, "test eax, 0x84d759b2"},
+	{true, 2, "mov dl, 89"},
+	{true, 1, "pop ecx"},
+	{true, 1, "xlat"},
+	{true, 6, "test byte ptr [eax+0xce5e1a97], ah"},
+	{true, 5, "mov al, byte ptr [0xce5e1a97]"},
+	{true, 1, "xchg edi, eax"},
+	{true, 3, "sbb bl, byte ptr [esi-50]"},
+	{true, 1, "pop esi"},
+	{true, 1, "into"},
+	{true, 4, "cmp al, byte ptr ds:[edx-121]"},
+	{true, 3, "cmp al, byte ptr [edx-121]"},
+	{true, 1, "inc edx"},
+	{true, 2, "xchg ecx, dword ptr [eax]"},
+	{true, 6, "or byte ptr [0x37da3632], dl"},
+	{true, 5, "adc eax, 0x37da3632"},
+	{true, 2, "xor dh, byte ptr [esi]"},
+	{true, 3, "fidiv dword ptr ss:[edi]"},
+	{true, 2, "fidiv dword ptr [edi]"},
+	{true, 1, "aaa"},
+	{true, 1, "aas"},
+	{true, 2, "jnl 0x00000fb0"},
+	{true, 1, "scasb"},
+	{true, 1, "pushad"},
+	{true, 1, "dec edx"},
+	{true, 5, "adc eax, 0x6897ba42"},
+	{true, 1, "inc edx"},
+	{true, 5, "mov edx, 0xd7826897"},
+	{true, 1, "xchg edi, eax"},
+	{true, 5, "push 0xf017d782"},
+	{true, 3, "adc bh, 23"},
+	{true, 1, "xlat"},
+	{true, 1, "pop ss"},
+	{true, 3, "lock mov dh, 108"},
+	{true, 2, "mov dh, 108"},
+	{true, 1, "insb"},
+	{true, 2, "jb 0x0000104f"},
+	{true, 1, "dec ebp"},
+	{true, 3, "imul ecx, edi, 0xd6"},
+	{true, 1, "iret"},
+	{true, 1, "salc"},
+	{true, 2, "sub dword ptr [ebx], esp"},
+	{true, 2, "and esi, dword ptr [edx]"},
+	{true, 6, "xor al, byte ptr [edx+0x119dbccc]"},
+	{true, 3, "or ah, 0xbc"},
+	{true, 1, "int3"},
+	{true, 5, "mov esp, 0xa07e119d"},
+	{true, 1, "popfd"},
+	{true, 3, "adc dword ptr [esi-96], edi"},
+	{true, 2, "jle 0x00000fa2"},
+	{true, 5, "mov al, byte ptr [0xb2a087ad]"},
+	{true, 1, "lodsd"},
+	{true, 6, "xchg esp, dword ptr [eax+0x891d0eb2]"},
+	{true, 5, "mov al, byte ptr [0x891d0eb2]"},
+	{true, 2, "mov dl, 14"},
+	{true, 1, "push cs"},
+	{true, 5, "sbb eax, 0xccb9f489"},
+	{true, 2, "mov esp, esi"},
+	{true, 1, "hlt"},
+	{true, 5, "mov ecx, 0xeef821cc"},
+	{true, 1, "int3"},
+	{true, 2, "and eax, edi"},
+	{true, 1, "clc"},
+	{true, 1, "out dx, al"},
+	{true, 1, "wait"},
+	{true, 1, "inc eax"},
+	{true, 2, "or al, 0xf1"},
+	{false, 1, 0},
+	{true, 5, "test eax, 0xfa8425c4"},
+	{true, 6, "les esp, fword ptr [0x8774fa84]"},
+	{true, 5, "and eax, 0x8774fa84"},
+	{true, 2, "test dl, bh"},
+	{true, 1, "cli"},
+	{true, 2, "jz 0x00000f89"},
+	{true, 2, "xchg esp, dword ptr [edi]"},
+	{true, 1, "daa"},
+	{true, 6, "add dword ptr [eax+0x54f1123a], ebx"},
+	{true, 1, "cwde"},
+	{true, 2, "cmp dl, byte ptr [edx]"},
+	{true, 2, "adc dh, cl"},
+	{false, 1, 0},
+	{true, 1, "push esp"},
+	{true, 5, "sub eax, 0x26c8c4ef"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "les ecx, (invalid)"},
+	{true, 4, "enter 0x5826, 8"},
+	{true, 2, "pop eax"},
+	{true, 1, "pop eax"},
+	{true, 2, "or cl, ch"},
+	{true, 5, "jmp 0x1e6c2376"},
+	{true, 2, "jno 0x00001015"},
+	{true, 4, "adc ebp, dword ptr [esi+ebx+69]"},
+	{true, 1, "insb"},
+	{true, 1, "push ds"},
+	{true, 1, "inc ebp"},
+	{false, 2, 0},
+	{true, 1, "push cs"},
+	{true, 7, "callf far 0x70db:0x7c821df4"},
+	{true, 1, "hlt"},
+	{true, 5, "sbb eax, 0x70db7c82"},
+	{true, 5, "cmp byte ptr [ebx+ebx*8+112], 0xa2"},
+	{true, 2, "jl 0x00000fdd"},
+	{false, 2, 0},
+	{true, 2, "jo 0x00000fa4"},
+	{true, 5, "mov byte ptr [0x18d304a8], al"},
+	{true, 2, "test al, 4"},
+	{true, 2, "add al, 0xd3"},
+	{true, 2, "rcr dword ptr [eax], cl"},
+	{true, 3, "sbb byte ptr [ebx-101], ah"},
+	{true, 6, "arpl word ptr [ebx+0x17b1acac], bx"},
+	{true, 1, "wait"},
+	{true, 1, "lodsb"},
+	{true, 1, "lodsb"},
+	{true, 2, "mov cl, 23"},
+	{true, 1, "pop ss"},
+	{true, 2, "mov ah, 78"},
+	{true, 1, "dec esi"},
+	{true, 1, "outsb"},
+	{true, 2, "and al, 116"},
+	{true, 2, "jz 0x00000fe5"},
+	{true, 2, "jcez 0x00001031"},
+	{true, 1, "das"},
+	{true, 1, "push edx"},
+	{true, 2, "jle 0x00000fd2"},
+	{true, 2, "rcl dh, 1"},
+	{true, 1, "salc"},
+	{true, 4, "xor byte ptr [ecx+71], 0xf7"},
+	{true, 2, "jno 0x00001049"},
+	{true, 1, "inc edi"},
+	{true, 6, "test dword ptr [esi], 0xa5ee54aa"},
+	{true, 1, "push es"},
+	{true, 1, "stosb"},
+	{true, 1, "push esp"},
+	{true, 1, "out dx, al"},
+	{true, 1, "movsd"},
+	{true, 3, "retf 0xffffbca6"},
+	{true, 1, "cmpsb"},
+	{true, 5, "mov esp, 0xa61eec30"},
+	{true, 2, "xor ah, ch"},
+	{true, 1, "in al, dx"},
+	{true, 1, "push ds"},
+	{true, 1, "cmpsb"},
+	{true, 6, "mul dword ptr [ebx+0xb6f68c19]"},
+	{true, 5, "mov dword ptr [0xb6f68c19], eax"},
+	{true, 7, "sbb dword ptr [esi+esi*8+0xc20a7eb6], ecx"},
+	{true, 2, "mov esi, seg7"},
+	{true, 6, "div byte ptr [esi+0x9bc20a7e]"},
+	{true, 2, "mov dh, 126"},
+	{true, 2, "jle 0x0000100c"},
+	{true, 2, "or al, dl"},
+	{true, 3, "ret 0xffff869b"},
+	{true, 1, "wait"},
+	{true, 3, "xchg dl, byte ptr [eax+47]"},
+	{true, 1, "push eax"},
+	{true, 1, "das"},
+	{true, 2, "mov ah, 78"},
+	{true, 1, "dec esi"},
+	{true, 3, "rol edx, 75"},
+	{true, 3, "ret 0x1e4b"},
+	{true, 1, "dec ebx"},
+	{true, 1, "push ds"},
+	{true, 1, "dec esi"},
+	{true, 3, "fimul dword ptr [edi+119]"},
+	{true, 1, "dec edi"},
+	{true, 2, "jnbe 0x00000f93"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 1, "popfd"},
+	{true, 1, "int3"},
+	{true, 6, "fisubr word ptr [ecx+0xd86b2ca3]"},
+	{true, 5, "test eax, 0xd86b2ca3"},
+	{true, 5, "mov dword ptr [0x65d86b2c], eax"},
+	{true, 2, "sub al, 107"},
+	{true, 3, "imul ebx, eax, 101"},
+	{true, 3, "fsub dword ptr [ebp+47]"},
+	{true, 2, "das"},
+	{true, 1, "das"},
+	{true, 2, "adc dh, bl"},
+	{true, 4, "fisub word ptr [esp+ebp*4-86]"},
+	{true, 2, "lodsb"},
+	{true, 1, "lodsb"},
+	{true, 1, "stosb"},
+	{true, 2, "adc ebx, dword ptr [ecx]"},
+	{true, 6, "sbb dword ptr [0x6ba046ca], eax"},
+	{true, 5, "add eax, 0x6ba046ca"},
+	{true, 3, "retf 0xffffa046"},
+	{true, 1, "inc esi"},
+	{true, 5, "mov al, byte ptr [0x2358406b]"},
+	{true, 4, "imul eax, dword ptr [eax+88], 35"},
+	{true, 1, "inc eax"},
+	{true, 1, "pop eax"},
+	{true, 2, "and edx, edi"},
+	{true, 1, "xlat"},
+	{true, 7, "imul ebx, dword ptr [eax+0xdd43c307], 0xd9"},
+	{true, 1, "cwde"},
+	{true, 1, "pop es"},
+	{true, 1, "ret"},
+	{true, 1, "inc ebx"},
+	{true, 2, "fstp st(1)"},
+	{true, 7, "fldcw word ptr [ebx+0x5749f766]"},
+	{true, 1, "lodsb"},
+	{true, 3, "and esp, dword ptr [esi-9]"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 1, "dec ecx"},
+	{true, 1, "push edi"},
+	{true, 2, "jb 0x00001000"},
+	{true, 6, "dec byte ptr [eax+0x4df79e6a]"},
+	{true, 3, "mov byte ptr [edx-98], ch"},
+	{true, 2, "push 0x9e"},
+	{true, 1, "sahf"},
+	{false, 2, 0},
+	{true, 1, "dec ebp"},
+	{true, 2, "sub al, 1"},
+	{true, 3, "add dword ptr [eax-22], eax"},
+	{true, 1, "inc eax"},
+	{true, 7, "jmp far 0x13fd:0x5c3c0885"},
+	{true, 2, "test dword ptr [eax], ecx"},
+	{true, 3, "or byte ptr [esp+ebx*2], bh"},
+	{true, 2, "cmp al, 92"},
+	{true, 1, "pop esp"},
+	{true, 1, "std"},
+	{true, 6, "adc edi, dword ptr [edx+0x26cc074b]"},
+	{true, 5, "mov edx, 0x26cc074b"},
+	{true, 1, "dec ebx"},
+	{true, 1, "pop es"},
+	{true, 1, "int3"},
+	{true, 4, "rcl byte ptr es:[ecx], 75"},
+	{true, 3, "rcl byte ptr [ecx], 75"},
+	{true, 3, "adc dword ptr [ebx+114], ecx"},
+	{true, 1, "dec ebx"},
+	{true, 2, "jb 0x00000fa6"},
+	{true, 1, "movsb"},
+	{true, 1, "dec esp"},
+	{true, 1, "in al, dx"},
+	{true, 3, "ret 0x3bfc"},
+	{true, 1, "cld"},
+	{true, 2, "cmp ebp, ebx"},
+	{true, 2, "jmp 0x00000fdc"},
+	{false, 2, 0},
+	{true, 2, "out 0xfd, al"},
+	{true, 1, "std"},
+	{true, 3, "les ecx, fword ptr [eax+83]"},
+	{true, 1, "dec eax"},
+	{true, 1, "push ebx"},
+	{true, 1, "pop ebx"},
+	{true, 1, "dec esp"},
+	{true, 1, "push eax"},
+	{true, 7, "adc byte ptr [ecx+0xdd409c8f], 105"},
+	{true, 1, "xchg ecx, eax"},
+	{false, 2, 0},
+	{true, 1, "pushfd"},
+	{true, 1, "inc eax"},
+	{false, 2, 0},
+	{true, 10, "imul esp, dword ptr [eax+0xcfe3c8e1], 0x7f5337fc"},
+	{true, 5, "mov al, byte ptr [0xcfe3c8e1]"},
+	{true, 2, "loope 0x00000fca"},
+	{true, 4, "enter 0xffffcfe3, 0xfc"},
+	{true, 2, "jcez 0x00000fd1"},
+	{true, 1, "iret"},
+	{true, 1, "cld"},
+	{true, 1, "aaa"},
+	{true, 1, "push ebx"},
+	{true, 2, "jnle 0x00000fec"},
+	{true, 7, "jmp far 0xbb6e:0xfd9c3231"},
+	{true, 2, "xor dword ptr [edx], esi"},
+	{true, 7, "xor bl, byte ptr [ebp+edi*8+0x8110bb6e]"},
+	{true, 1, "pushfd"},
+	{true, 1, "std"},
+	{true, 1, "outsb"},
+	{true, 5, "mov ebx, 0x49a38110"},
+	{true, 6, "adc byte ptr [ecx+0x74ee49a3], al"},
+	{true, 10, "and dword ptr [ebx+0x8f74ee49], 0xc504616e"},
+	{true, 5, "mov dword ptr [0x8f74ee49], eax"},
+	{true, 1, "dec ecx"},
+	{true, 1, "out dx, al"},
+	{true, 2, "jz 0x00000f91"},
+	{false, 2, 0},
+	{true, 1, "outsb"},
+	{true, 1, "popad"},
+	{true, 2, "add al, 0xc5"},
+	{true, 2, "lds edx, (invalid)"},
+	{true, 3, "rcl byte ptr [edi-51], cl"},
+	{true, 1, "push edi"},
+	{true, 2, "int 56"},
+	{true, 2, "cmp dl, dl"},
+	{true, 2, "shr ch, cl"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "iret"},
+	{true, 2, "mov ah, dl"},
+	{true, 2, "aam 0x99"},
+	{true, 1, "cdq"},
+	{true, 2, "xor dword ptr [edi], ecx"},
+	{false, 2, 0},
+	{true, 1, "insb"},
+	{true, 6, "sbb dword ptr [edi+0x041f30aa], esi"},
+	{true, 2, "mov bh, 0xaa"},
+	{true, 1, "stosb"},
+	{true, 2, "xor byte ptr [edi], bl"},
+	{true, 1, "pop ds"},
+	{true, 2, "add al, 71"},
+	{true, 1, "inc edi"},
+	{true, 1, "pop ebx"},
+	{true, 5, "mov ecx, 0x82243391"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 3, "xor esp, dword ptr [edx+eax*4]"},
+	{true, 2, "and al, 0x82"},
+	{true, 4, "sub byte ptr [ecx+33], 0xdc"},
+	{true, 6, "imul esp, dword ptr [ecx], 0xf9aa8bdc"},
+	{true, 2, "and esp, ebx"},
+	{true, 6, "fmul qword ptr [ebx+0x07caf9aa]"},
+	{true, 6, "mov ebp, dword ptr [edx+0xbc07caf9]"},
+	{true, 1, "stosb"},
+	{true, 1, "stc"},
+	{true, 3, "retf 0xffffbc07"},
+	{true, 1, "pop es"},
+	{true, 5, "mov esp, 0x4eb8c667"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 5, "mov eax, 0x1d981e4e"},
+	{true, 1, "dec esi"},
+	{true, 1, "push ds"},
+	{true, 1, "cwde"},
+	{true, 5, "sbb eax, 0x580ef015"},
+	{true, 5, "adc eax, 0x44580ef0"},
+	{true, 2, "lock push cs"},
+	{true, 1, "push cs"},
+	{true, 1, "pop eax"},
+	{true, 1, "inc esp"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 2, "loope 0x00000fcc"},
+	{true, 3, "retf 0x4320"},
+	{true, 3, "and byte ptr [ebx-19], al"},
+	{true, 1, "inc ebx"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "dec esi"},
+	{true, 3, "test dword ptr [esi-100], ecx"},
+	{true, 1, "dec esi"},
+	{true, 1, "pushfd"},
+	{true, 2, "jmp 0x00001069"},
+	{true, 3, "adc ch, ah"},
+	{true, 2, "adc ch, ah"},
+	{true, 2, "in eax, 0xab"},
+	{true, 1, "stosd"},
+	{true, 1, "push es"},
+	{true, 1, "outsb"},
+	{true, 1, "inc ecx"},
+	{true, 2, "lds eax, (invalid)"},
+	{true, 7, "sar byte ptr [edi+0x2663961a], 0xf2"},
+	{true, 5, "mov edi, 0x2663961a"},
+	{true, 6, "sbb dl, byte ptr [esi+0x61f22663]"},
+	{true, 1, "xchg esi, eax"},
+	{true, 2, "arpl word ptr [esi], sp"},
+	{true, 3, "repne popad"},
+	{true, 2, "repne popad"},
+	{true, 1, "popad"},
+	{true, 6, "xor dh, byte ptr [edx+0x36b9c754]"},
+	{true, 2, "mov dl, 84"},
+	{true, 1, "push esp"},
+	{false, 2, 0},
+	{true, 5, "mov ecx, 0x51047b36"},
+	{true, 3, "jnp 0x00001007"},
+	{true, 2, "jnp 0x00001006"},
+	{true, 2, "add al, 81"},
+	{true, 1, "push ecx"},
+	{true, 5, "jmp 0xbe71ffc8"},
+	{true, 1, "ret"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "jno 0x00000fc0"},
+	{true, 5, "mov esi, 0x82bbb0d3"},
+	{true, 6, "sal dword ptr [eax+0x3e8882bb], cl"},
+	{true, 2, "mov al, 0xbb"},
+	{true, 5, "mov ebx, 0xc23e8882"},
+	{true, 7, "or byte ptr [eax+0xa0b7c23e], 0xa0"},
+	{true, 2, "mov byte ptr [esi], bh"},
+	{true, 4, "ret 0xffffa0b7"},
+	{true, 3, "ret 0xffffa0b7"},
+	{true, 2, "mov bh, 0xa0"},
+	{true, 5, "mov al, byte ptr [0x2b329da0]"},
+	{true, 5, "mov al, byte ptr [0xdf2b329d]"},
+	{true, 1, "popfd"},
+	{true, 2, "xor ch, byte ptr [ebx]"},
+	{true, 2, "sub ebx, edi"},
+	{true, 6, "fild qword ptr [0x2dcdb276]"},
+	{true, 5, "sub eax, 0x2dcdb276"},
+	{true, 2, "jbe 0x00000fb4"},
+	{true, 2, "mov dl, 0xcd"},
+	{true, 2, "int 45"},
+	{true, 5, "sub eax, 0xfe7924cf"},
+	{true, 1, "iret"},
+	{true, 2, "and al, 121"},
+	{true, 2, "jns 0x00001000"},
+	{false, 2, 0},
+	{true, 4, "test byte ptr cs:[ebp+48], ch"},
+	{true, 3, "test byte ptr [ebp+48], ch"},
+	{true, 1, "insd"},
+	{true, 2, "xor al, cl"},
+	{true, 4, "enter 0xffffae55, 0xd0"},
+	{true, 1, "push ebp"},
+	{true, 1, "scasb"},
+	{true, 3, "shr byte ptr [ebp-63], 1"},
+	{true, 1, "insd"},
+	{true, 4, "sal dword ptr [ecx+116], 0xa8"},
+	{true, 2, "jno 0x00001076"},
+	{true, 2, "jz 0x00000faa"},
+	{true, 2, "test al, 0x8b"},
+	{true, 6, "mov ebx, dword ptr [ebp+0x05ba9c07]"},
+	{true, 1, "popfd"},
+	{true, 1, "pop es"},
+	{true, 1, "pushfd"},
+	{true, 5, "mov edx, 0x03995505"},
+	{true, 5, "add eax, 0x61039955"},
+	{true, 1, "push ebp"},
+	{true, 1, "cdq"},
+	{true, 3, "add esp, dword ptr [ecx+86]"},
+	{true, 1, "popad"},
+	{true, 1, "push esi"},
+	{true, 6, "xor ebx, 0xe1dd3a11"},
+	{true, 3, "rep adc dword ptr [edx], edi"},
+	{true, 2, "adc dword ptr [edx], edi"},
+	{true, 2, "cmp bl, ch"},
+	{true, 2, "fucom st(1)"},
+	{true, 2, "loope 0x00000f94"},
+	{true, 1, "xchg edx, eax"},
+	{true, 6, "cmp byte ptr [esi+0x5517bc96], bh"},
+	{true, 5, "mov esi, 0x5517bc96"},
+	{true, 1, "xchg esi, eax"},
+	{true, 5, "mov esp, 0xc1b85517"},
+	{true, 1, "pop ss"},
+	{true, 1, "push ebp"},
+	{true, 5, "mov eax, 0xfb5279c1"},
+	{true, 4, "sar dword ptr [ecx+82], 0xfb"},
+	{true, 2, "jns 0x00001054"},
+	{true, 1, "push edx"},
+	{true, 1, "sti"},
+	{true, 2, "out 0xea, al"},
+	{true, 7, "jmp far 0x2915:0xacff08fd"},
+	{true, 1, "std"},
+	{true, 2, "or bh, bh"},
+	{true, 7, "jmpf fword ptr [ebp+edx+0x6c40ab29]"},
+	{true, 1, "lodsb"},
+	{true, 5, "adc eax, 0x6c40ab29"},
+	{true, 6, "sub dword ptr [ebx+0x54b96c40], ebp"},
+	{true, 1, "stosd"},
+	{true, 1, "inc eax"},
+	{true, 1, "insb"},
+	{true, 5, "mov ecx, 0x4d3eb454"},
+	{true, 1, "push esp"},
+	{true, 2, "mov ah, 62"},
+	{true, 2, "dec ebp"},
+	{true, 1, "dec ebp"},
+	{true, 2, "in eax, 0xb0"},
+	{true, 2, "mov al, 85"},
+	{true, 1, "push ebp"},
+	{true, 5, "mov byte ptr [0x46df3e4a], al"},
+	{true, 1, "dec edx"},
+	{true, 4, "fild word ptr ds:[esi-87]"},
+	{true, 3, "fild word ptr [esi-87]"},
+	{true, 1, "inc esi"},
+	{true, 5, "test eax, 0x62070b5c"},
+	{true, 1, "pop esp"},
+	{true, 2, "or eax, dword ptr [edi]"},
+	{true, 1, "pop es"},
+	{true, 3, "bound eax, qword ptr [ebx+101]"},
+	{true, 1, "inc ebx"},
+	{true, 3, "sbb al, 0xc7"},
+	{true, 2, "sbb al, 0xc7"},
+	{false, 2, 0},
+	{true, 2, "jbe 0x00000ff9"},
+	{true, 3, "not dword ptr [ebx+ebx*4]"},
+	{true, 2, "adc al, 0x9b"},
+	{true, 1, "wait"},
+	{true, 2, "mov dword ptr [ebx], ebx"},
+	{true, 6, "sbb eax, dword ptr [edx+0x6621b64c]"},
+	{true, 5, "or byte ptr [esi+esi*4+33], 102"},
+	{true, 1, "dec esp"},
+	{true, 2, "mov dh, 33"},
+	{true, 3, "and dword ptr [esi-16], esp"},
+	{true, 8, "lock and word ptr [esi+0xafe7015a], sp"},
+	{true, 7, "lock and dword ptr [esi+0xafe7015a], esp"},
+	{true, 6, "and dword ptr [esi+0xafe7015a], esp"},
+	{true, 1, "cmpsb"},
+	{true, 1, "pop edx"},
+	{true, 2, "add edi, esp"},
+	{true, 2, "out 0xaf, eax"},
+	{true, 1, "scasd"},
+	{true, 6, "sbb ecx, 0xec2f88e9"},
+	{true, 2, "fldl2t"},
+	{true, 5, "jmp 0x59ec3f8d"},
+	{true, 2, "mov byte ptr [edi], ch"},
+	{true, 1, "das"},
+	{true, 1, "in al, dx"},
+	{true, 1, "pop ecx"},
+	{true, 1, "pop edi"},
+	{true, 1, "pop eax"},
+	{false, 2, 0},
+	{true, 6, "or dword ptr [edi+0x0e6eccba], ebx"},
+	{true, 1, "lahf"},
+	{true, 5, "mov edx, 0xca0e6ecc"},
+	{true, 1, "int3"},
+	{true, 1, "outsb"},
+	{true, 1, "push cs"},
+	{true, 3, "retf 0x77aa"},
+	{true, 1, "stosb"},
+	{true, 2, "jnbe 0x00000fa7"},
+	{true, 1, "movsd"},
+	{true, 1, "pushad"},
+	{true, 1, "lahf"},
+	{true, 2, "adc byte ptr [ebx], dh"},
+	{true, 2, "xor esp, dword ptr [ecx]"},
+	{true, 3, "and dword ptr [ebp+116], ebp"},
+	{true, 1, "insd"},
+	{true, 2, "jz 0x00000fb2"},
+	{true, 2, "mov al, 0xb0"},
+	{true, 2, "mov al, 29"},
+	{true, 5, "sbb eax, 0x77946237"},
+	{true, 1, "aaa"},
+	{true, 7, "bound edx, qword ptr [edi+esi*2+0x3ce7b20f]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "jnbe 0x00001011"},
+	{true, 3, "lss esp, (invalid)"},
+	{true, 2, "mov dl, 0xe7"},
+	{true, 2, "out 60, eax"},
+	{true, 2, "cmp al, 102"},
+	{true, 2, "retf"},
+	{true, 1, "retf"},
+	{true, 2, "les ebp, fword ptr [edx]"},
+	{true, 6, "sub ah, byte ptr [eax+0x2cad6ef8]"},
+	{true, 5, "mov al, byte ptr [0x2cad6ef8]"},
+	{true, 1, "clc"},
+	{true, 1, "outsb"},
+	{true, 1, "lodsd"},
+	{true, 2, "sub al, 0xba"},
+	{true, 5, "mov edx, 0xac4c6540"},
+	{true, 1, "inc eax"},
+	{true, 2, "dec esp"},
+	{true, 1, "dec esp"},
+	{true, 1, "lodsb"},
+	{true, 1, "pop ecx"},
+	{true, 1, "pop ebx"},
+	{true, 1, "movsd"},
+	{true, 1, "pop ss"},
+	{true, 2, "add eax, dword ptr [ebx]"},
+	{true, 6, "add eax, dword ptr [esi+0xf8f1e855]"},
+	{true, 3, "xchg dl, byte ptr [ebp-24]"},
+	{true, 1, "push ebp"},
+	{true, 5, "call 0xf3e708f6"},
+	{false, 1, 0},
+	{true, 1, "clc"},
+	{true, 2, "out 0xf3, al"},
+	{true, 2, "rep pop ebx"},
+	{true, 1, "pop ebx"},
+	{true, 4, "mov dl, byte ptr [edi+eax+83]"},
+	{true, 1, "push esp"},
+	{true, 1, "pop es"},
+	{true, 1, "push ebx"},
+	{true, 2, "fld st(7)"},
+	{false, 2, 0},
+	{true, 2, "arpl cx, ax"},
+	{true, 3, "shl ecx, 102"},
+	{true, 2, "loope 0x00001068"},
+	{true, 3, "shl byte ptr [edx], 1"},
+	{true, 2, "shl byte ptr [edx], 1"},
+	{true, 2, "and al, byte ptr [edi]"},
+	{true, 1, "pop es"},
+	{true, 2, "jz 0x00000f91"},
+	{true, 2, "pop dword ptr [edx]"},
+	{true, 2, "add ah, dl"},
+	{true, 2, "loop 0x00001029"},
+	{true, 1, "daa"},
+	{true, 1, "push es"},
+	{true, 2, "cmp cl, ch"},
+	{true, 2, "int 72"},
+	{true, 1, "dec eax"},
+	{true, 2, "and al, 0xea"},
+	{true, 7, "jmp far 0xb483:0x35998c2d"},
+	{true, 5, "sub eax, 0x8335998c"},
+	{true, 6, "mov dword ptr [ecx+0xb8b48335], ds"},
+	{true, 1, "cdq"},
+	{true, 5, "xor eax, 0xbfb8b483"},
+	{true, 8, "xor dword ptr [eax+edi*4+0x276630bf], 0xe8"},
+	{true, 2, "mov ah, 0xb8"},
+	{true, 5, "mov eax, 0x276630bf"},
+	{true, 5, "mov edi, 0xe8276630"},
+	{true, 3, "xor byte ptr [esi+39], ah"},
+	{true, 2, "daa"},
+	{true, 1, "daa"},
+	{true, 5, "call 0xc54cd910"},
+	{true, 2, "or ecx, ecx"},
+	{true, 1, "leave"},
+	{true, 1, "dec esp"},
+	{true, 6, "lds esp, fword ptr [ebp+0x57e277e4]"},
+	{true, 1, "movsd"},
+	{true, 2, "in al, 119"},
+	{true, 2, "jnbe 0x00000fe4"},
+	{true, 2, "loop 0x00001059"},
+	{true, 1, "push edi"},
+	{true, 2, "mov ah, 0xcf"},
+	{true, 1, "iret"},
+	{true, 5, "mov edx, 0xf3fe0f10"},
+	{true, 2, "adc byte ptr [edi], cl"},
+	{true, 3, "paddd mm6, mm3"},
+	{false, 2, 0},
+	{true, 3, "rep loopne 0x0000103e"},
+	{true, 2, "loopne 0x0000103d"},
+	{true, 7, "cmp ebx, dword ptr [edx+ebx*2+0xa15c4d43]"},
+	{true, 1, "pushfd"},
+	{true, 1, "pop edx"},
+	{true, 1, "inc ebx"},
+	{true, 1, "dec ebp"},
+	{true, 1, "pop esp"},
+	{true, 5, "mov eax, dword ptr [0xdaf9432e]"},
+	{true, 2, "inc ebx"},
+	{true, 1, "inc ebx"},
+	{true, 1, "stc"},
+	{true, 2, "fcmovu st, st(3)"},
+	{true, 2, "fndisi"},
+	{true, 2, "loope 0x00000fe0"},
+	{true, 6, "fidiv word ptr [edx+0x6e984c55]"},
+	{true, 2, "mov dl, 85"},
+	{true, 1, "push ebp"},
+	{true, 1, "dec esp"},
+	{true, 1, "cwde"},
+	{true, 1, "outsb"},
+	{true, 1, "ret"},
+	{true, 2, "cld"},
+	{true, 1, "cld"},
+	{true, 1, "cmpsd"},
+	{true, 2, "jz 0x00000ff3"},
+	{false, 1, 0},
+	{true, 2, "sbb ch, al"},
+	{true, 6, "lds ebp, fword ptr [esi+0x363dda5b]"},
+	{true, 1, "scasb"},
+	{true, 1, "pop ebx"},
+	{true, 6, "fidivr dword ptr [0x8a826a36]"},
+	{true, 5, "cmp eax, 0x8a826a36"},
+	{true, 3, "push 0x82"},
+	{true, 2, "push 0x82"},
+	{true, 7, "or byte ptr [edx+0xecc9919f], 83"},
+	{true, 6, "mov bl, byte ptr [edi+0x53ecc991]"},
+	{true, 1, "lahf"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 1, "leave"},
+	{true, 1, "in al, dx"},
+	{true, 1, "push ebx"},
+	{true, 2, "or al, 0xce"},
+	{true, 1, "into"},
+	{true, 2, "jcez 0x00001065"},
+	{true, 7, "arpl word ptr [ebp+eax*8+0x5ec60e6a], di"},
+	{true, 5, "mov esp, 0xc60e6ac5"},
+	{true, 3, "lds ebp, fword ptr [edx+14]"},
+	{true, 2, "push 14"},
+	{true, 1, "push cs"},
+	{false, 2, 0},
+	{true, 1, "pop esi"},
+	{true, 1, "hlt"},
+	{true, 2, "adc ebp, edx"},
+	{true, 7, "jmp far 0x5b81:0xa3b628f7"},
+	{true, 2, "imul dword ptr [eax]"},
+	{true, 6, "sub byte ptr [esi+0x945b81a3], dh"},
+	{true, 2, "mov dh, 0xa3"},
+	{true, 5, "mov dword ptr [0x03945b81], eax"},
+	{true, 7, "sbb dword ptr [ebx-108], 0x28d13203"},
+	{true, 1, "pop ebx"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "add esi, dword ptr [edx]"},
+	{true, 2, "xor dl, cl"},
+	{true, 2, "shr dword ptr [eax], 1"},
+	{true, 3, "sub byte ptr [ebp-17], cl"},
+	{true, 1, "dec ebp"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "mov ah, 25"},
+	{true, 3, "sbb dword ptr [eax+120], edx"},
+	{true, 1, "push eax"},
+	{true, 2, "js 0x00000fd2"},
+	{true, 3, "ror byte ptr [ecx-122], 1"},
+	{true, 1, "dec ecx"},
+	{true, 3, "xchg dl, byte ptr [ecx+20]"},
+	{true, 1, "push ecx"},
+	{true, 2, "adc al, 0x9e"},
+	{true, 1, "sahf"},
+	{true, 3, "lock jz 0x00000fcc"},
+	{true, 2, "jz 0x00000fcb"},
+	{true, 1, "leave"},
+	{true, 6, "mov gs, word ptr [edi+0x626d8fb8]"},
+	{true, 1, "scasd"},
+	{true, 5, "mov eax, 0xff626d8f"},
+	{false, 2, 0},
+	{true, 1, "insd"},
+	{true, 2, "bound edi, (invalid)"},
+	{true, 3, "callf fword ptr [esi+esi*2]"},
+	{true, 2, "sbb al, 118"},
+	{true, 2, "jbe 0x00001045"},
+	{true, 1, "inc ebx"},
+	{true, 7, "and dh, byte ptr [ebx+ebx*4+0x0c689e00]"},
+	{true, 2, "mov ah, 0x9b"},
+	{true, 1, "wait"},
+	{true, 6, "add byte ptr [esi+0xfb5b0c68], bl"},
+	{true, 1, "sahf"},
+	{true, 5, "push 0x0efb5b0c"},
+	{true, 2, "or al, 91"},
+	{true, 1, "pop ebx"},
+	{true, 1, "sti"},
+	{true, 1, "push cs"},
+	{true, 6, "mov dword ptr [eax+0x29680400], eax"},
+	{true, 3, "add byte ptr [eax], 4"},
+	{true, 3, "add byte ptr [eax+ebp*2], al"},
+	{true, 2, "add al, 104"},
+	{true, 5, "push 0x66a49829"},
+	{true, 6, "sub dword ptr [eax+0x827466a4], ebx"},
+	{true, 1, "cwde"},
+	{true, 1, "movsb"},
+	{true, 3, "jz 0x00000f85"},
+	{true, 2, "jz 0x00000f84"},
+	{true, 7, "add byte ptr [ebp+0x77bc7f2d], 0xa9"},
+	{true, 6, "test dword ptr [0xa977bc7f], ebp"},
+	{true, 5, "sub eax, 0xa977bc7f"},
+	{true, 2, "jnle 0x00000fbe"},
+	{true, 5, "mov esp, 0xadc9a977"},
+	{true, 2, "jnbe 0x00000fab"},
+	{true, 5, "test eax, 0x0b3dadc9"},
+	{true, 1, "leave"},
+	{true, 1, "lodsd"},
+	{true, 5, "cmp eax, 0x0815480b"},
+	{true, 3, "or ecx, dword ptr [eax+21]"},
+	{true, 1, "dec eax"},
+	{true, 5, "adc eax, 0xb54a9908"},
+	{true, 6, "or byte ptr [ecx+0x3cb8b54a], bl"},
+	{true, 1, "cdq"},
+	{true, 1, "dec edx"},
+	{true, 2, "mov ch, 0xb8"},
+	{true, 5, "mov eax, 0xd2bd0c3c"},
+	{true, 2, "cmp al, 12"},
+	{true, 2, "or al, 0xbd"},
+	{true, 5, "mov ebp, 0xfa1cc8d2"},
+	{true, 2, "ror al, cl"},
+	{true, 4, "enter 0xfffffa1c, 63"},
+	{true, 2, "sbb al, 0xfa"},
+	{true, 1, "cli"},
+	{true, 1, "aas"},
+	{true, 3, "or dword ptr [esi-68], ebp"},
+	{true, 1, "outsb"},
+	{true, 5, "mov esp, 0x884191ca"},
+	{true, 3, "retf 0x4191"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 1, "inc ecx"},
+	{true, 3, "mov byte ptr [edi+68], dl"},
+	{true, 1, "push edi"},
+	{true, 1, "inc esp"},
+	{true, 1, "scasd"},
+	{true, 3, "and esp, 0xa0"},
+	{true, 2, "in al, 0xa0"},
+	{true, 5, "mov al, byte ptr [0xcd419917]"},
+	{true, 1, "pop ss"},
+	{true, 1, "cdq"},
+	{true, 1, "inc ecx"},
+	{true, 2, "int 43"},
+	{true, 3, "sub esi, dword ptr [eax-113]"},
+	{true, 2, "jo 0x00000f91"},
+	{false, 2, 0},
+	{true, 5, "push 0x0f7a10d8"},
+	{true, 2, "fcom dword ptr [eax]"},
+	{true, 3, "adc byte ptr [edx+15], bh"},
+	{true, 2, "jp 0x00001011"},
+	{true, 4, "psubusw mm1, qword ptr [esi+54]"},
+	{false, 2, 0},
+	{true, 1, "dec esi"},
+	{true, 2, "lodsb"},
+	{true, 1, "lodsb"},
+	{true, 2, "sbb ebp, edi"},
+	{true, 1, "std"},
+	{true, 6, "cmp eax, dword ptr [edx+0xf9bfd4cd]"},
+	{true, 3, "or ch, 0xd4"},
+	{true, 2, "int 0xd4"},
+	{true, 2, "aam 0xbf"},
+	{true, 5, "mov edi, 0xf71e4ef9"},
+	{true, 1, "stc"},
+	{true, 1, "dec esi"},
+	{true, 1, "push ds"},
+	{true, 2, "imul dword ptr [edx]"},
+	{true, 6, "sub dh, byte ptr [edi+0x42280e24]"},
+	{true, 2, "mov bh, 36"},
+	{true, 2, "and al, 14"},
+	{true, 1, "push cs"},
+	{true, 3, "sub byte ptr [edx+90], al"},
+	{true, 1, "inc edx"},
+	{true, 1, "pop edx"},
+	{true, 2, "loop 0x00001016"},
+	{true, 2, "adc al, 99"},
+	{true, 4, "arpl word ptr [ecx+eax*4-33], cx"},
+	{true, 1, "dec esp"},
+	{true, 6, "sbb edi, 0xde6646a2"},
+	{true, 6, "fbld tbyte ptr [edx+0x39de6646]"},
+	{true, 5, "mov byte ptr [0x39de6646], al"},
+	{true, 1, "inc esi"},
+	{true, 3, "fidivr word ptr [ecx]"},
+	{true, 2, "fidivr word ptr [ecx]"},
+	{true, 2, "cmp esi, eax"},
+	{false, 2, 0},
+	{true, 2, "jnb 0x00001011"},
+	{true, 8, "psraw (invalid), 0xbc"},
+	{true, 2, "jno 0x00000fa5"},
+	{true, 5, "mov dword ptr [0xf9bd2dae], eax"},
+	{true, 1, "scasb"},
+	{true, 5, "sub eax, 0x75bcf9bd"},
+	{true, 5, "mov ebp, 0x9375bcf9"},
+	{true, 1, "stc"},
+	{true, 5, "mov esp, 0x1edb9375"},
+	{true, 2, "jnz 0x00000f95"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 2, "fistp dword ptr [esi]"},
+	{true, 1, "push ds"},
+	{true, 2, "push cs"},
+	{true, 1, "push cs"},
+	{true, 5, "mov eax, 0x89451b2d"},
+	{true, 5, "sub eax, 0xd689451b"},
+	{true, 3, "sbb eax, dword ptr [ebp-119]"},
+	{true, 1, "inc ebp"},
+	{true, 2, "mov esi, edx"},
+	{true, 1, "salc"},
+	{true, 3, "cmp dword ptr [ecx-64], ebp"},
+	{true, 6, "imul eax, eax, 0xf1a0d716"},
+	{true, 3, "rcl byte ptr [esi], 0xd7"},
+	{true, 1, "push ss"},
+	{true, 1, "xlat"},
+	{true, 5, "mov al, byte ptr [0xa5ff34f1]"},
+	{false, 1, 0},
+	{true, 2, "xor al, 0xff"},
+	{true, 6, "jmp dword ptr [ebp+0x1cc8c23d]"},
+	{true, 1, "movsd"},
+	{true, 5, "cmp eax, 0x821cc8c2"},
+	{true, 3, "ret 0x1cc8"},
+	{true, 4, "enter 0xffff821c, 81"},
+	{true, 2, "sbb al, 0x82"},
+	{true, 4, "adc byte ptr [ecx+97], 0xb6"},
+	{true, 1, "push ecx"},
+	{true, 1, "popad"},
+	{true, 2, "mov dh, 67"},
+	{true, 1, "inc ebx"},
+	{true, 2, "neg esi"},
+	{true, 2, "fimul word ptr [ecx]"},
+	{true, 3, "or dword ptr [ecx-126], ebx"},
+	{true, 1, "pop ecx"},
+	{true, 3, "add dl, 44"},
+	{true, 3, "ret 0x572c"},
+	{true, 2, "sub al, 87"},
+	{true, 1, "push edi"},
+	{true, 2, "jns 0x00001052"},
+	{true, 1, "push eax"},
+	{true, 1, "push ss"},
+	{true, 5, "mov esi, 0xe5b492d6"},
+	{true, 1, "salc"},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "mov ah, 0xe5"},
+	{true, 2, "in eax, 0x86"},
+	{true, 2, "xchg ah, byte ptr [esi]"},
+	{true, 2, "int3"},
+	{true, 1, "int3"},
+	{true, 1, "cmpsd"},
+	{true, 1, "pushfd"},
+	{true, 1, "int3"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "retf 0xffffaf59"},
+	{true, 1, "pop ecx"},
+	{true, 1, "scasd"},
+	{true, 2, "adc dword ptr [edx], esi"},
+	{true, 2, "xor bl, ah"},
+	{true, 3, "fdiv qword ptr [esi+49]"},
+	{true, 2, "jbe 0x00001033"},
+	{true, 2, "xor edx, ecx"},
+	{true, 3, "retf 0x0aa9"},
+	{true, 5, "test eax, 0xdc2da70a"},
+	{true, 6, "or ah, byte ptr [edi+0x8a26dc2d]"},
+	{true, 1, "cmpsd"},
+	{true, 5, "sub eax, 0x188a26dc"},
+	{true, 2, "fsub qword ptr [esi]"},
+	{true, 3, "mov bl, byte ptr es:[eax]"},
+	{true, 2, "mov bl, byte ptr [eax]"},
+	{true, 2, "sbb byte ptr [ecx], ch"},
+	{true, 6, "sub dword ptr [eax+0x799b91ad], esp"},
+	{true, 5, "mov al, byte ptr [0x799b91ad]"},
+	{true, 1, "lodsd"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 1, "wait"},
+	{true, 2, "jns 0x00000fbe"},
+	{true, 5, "mov esp, 0x1ba608d3"},
+	{true, 2, "ror dword ptr [eax], cl"},
+	{true, 6, "or byte ptr [esi+0x9b56001b], ah"},
+	{true, 1, "cmpsb"},
+	{true, 2, "sbb eax, dword ptr [eax]"},
+	{true, 3, "add byte ptr [esi-101], dl"},
+	{true, 1, "push esi"},
+	{true, 1, "wait"},
+	{true, 2, "jle 0x00000f87"},
+	{true, 3, "test dword ptr [ecx-99], esi"},
+	{true, 2, "jno 0x00000f9f"},
+	{true, 1, "popfd"},
+	{true, 1, "dec eax"},
+	{true, 1, "dec esp"},
+	{true, 2, "or ch, al"},
+	{true, 6, "lds esp, fword ptr [ebp+0x66d30aa5]"},
+	{true, 1, "movsd"},
+	{true, 1, "movsd"},
+	{true, 2, "or dl, bl"},
+	{true, 3, "shl dword ptr [esi-14], cl"},
+	{true, 4, "repne jcez 0x00000fbc"},
+	{true, 3, "repne jcez 0x00000fbb"},
+	{true, 2, "jcez 0x00000fba"},
+	{true, 5, "mov eax, 0xe177149f"},
+	{true, 1, "lahf"},
+	{true, 2, "adc al, 119"},
+	{true, 2, "jnbe 0x00000fe3"},
+	{true, 2, "loope 0x00001004"},
+	{true, 6, "add bl, byte ptr [ecx+0xa2fa45db]"},
+	{true, 1, "cdq"},
+	{true, 3, "fild dword ptr [ebp-6]"},
+	{true, 1, "inc ebp"},
+	{true, 1, "cli"},
+	{true, 5, "mov byte ptr [0x96872dd6], al"},
+	{true, 1, "salc"},
+	{true, 5, "sub eax, 0xc61a9687"},
+	{true, 6, "xchg edx, dword ptr [esi+0x88dcc61a]"},
+	{true, 1, "xchg esi, eax"},
+	{true, 2, "sbb al, dh"},
+	{false, 2, 0},
+	{true, 6, "fmul qword ptr [eax+0x68ba6842]"},
+	{true, 3, "mov byte ptr [edx+104], al"},
+	{true, 1, "inc edx"},
+	{true, 5, "push 0xa48b68ba"},
+	{true, 5, "mov edx, 0x8aa48b68"},
+	{true, 5, "push 0xed8aa48b"},
+	{true, 7, "mov esp, dword ptr [edx+ecx*4+0x3d1052ed]"},
+	{true, 1, "movsb"},
+	{true, 2, "mov ch, ch"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "push edx"},
+	{true, 6, "adc byte ptr [0xe4d2513e], bh"},
+	{true, 5, "cmp eax, 0xe4d2513e"},
+	{true, 2, "push ecx"},
+	{true, 1, "push ecx"},
+	{true, 2, "shl ah, cl"},
+	{true, 2, "in al, 99"},
+	{true, 6, "arpl word ptr [ecx+0x4f6f0eed], bx"},
+	{true, 1, "cdq"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "push cs"},
+	{true, 1, "outsd"},
+	{true, 1, "dec edi"},
+	{true, 1, "dec esi"},
+	{true, 2, "in eax, 105"},
+	{true, 6, "imul esp, dword ptr [esi], 0xa0ff0895"},
+	{true, 2, "xchg ebp, eax"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 2, "or bh, bh"},
+	{true, 6, "jmp dword ptr [eax+0x04e926a5]"},
+	{true, 5, "mov al, byte ptr [0x04e926a5]"},
+	{true, 1, "movsd"},
+	{true, 6, "jmp 0x1e5efa0a"},
+	{true, 5, "jmp 0x1e5efa09"},
+	{true, 2, "add al, 0xea"},
+	{true, 7, "jmp far 0xba59:0x6d1e1e5e"},
+	{true, 1, "pop esi"},
+	{true, 1, "push ds"},
+	{true, 1, "push ds"},
+	{true, 1, "insd"},
+	{true, 1, "pop ecx"},
+	{true, 5, "mov edx, 0xaa2599b9"},
+	{true, 5, "mov ecx, 0xddaa2599"},
+	{true, 1, "cdq"},
+	{true, 5, "and eax, 0xd0caddaa"},
+	{true, 1, "stosb"},
+	{false, 2, 0},
+	{true, 3, "retf 0x1dd0"},
+	{true, 6, "rcr byte ptr [0xaac99bc9], 1"},
+	{true, 5, "sbb eax, 0xaac99bc9"},
+	{true, 1, "leave"},
+	{true, 1, "wait"},
+	{true, 1, "leave"},
+	{true, 1, "stosb"},
+	{true, 1, "scasd"},
+	{true, 1, "in al, dx"},
+	{true, 4, "test byte ptr [ecx+50], 0xb5"},
+	{true, 1, "inc ecx"},
+	{true, 6, "xor dh, byte ptr [ebp+0x8ea0d394]"},
+	{true, 2, "mov ch, 0x94"},
+	{true, 1, "xchg esp, eax"},
+	{true, 6, "shl dword ptr [eax+0xefc1d38e], cl"},
+	{true, 5, "mov al, byte ptr [0xefc1d38e]"},
+	{true, 2, "mov ss, bx"},
+	{true, 2, "rol ecx, cl"},
+	{true, 3, "shr edi, 0xfa"},
+	{true, 1, "out dx, eax"},
+	{true, 1, "cli"},
+	{true, 5, "sub eax, 0x8a777906"},
+	{true, 1, "push es"},
+	{true, 2, "jns 0x00001079"},
+	{true, 2, "jnbe 0x00000f8c"},
+	{true, 2, "mov ah, byte ptr [ebx]"},
+	{true, 3, "and esi, dword ptr [edi+70]"},
+	{true, 2, "jnbe 0x00001048"},
+	{true, 1, "inc esi"},
+	{true, 5, "adc eax, 0xdcfa3fce"},
+	{true, 1, "into"},
+	{true, 1, "aas"},
+	{true, 1, "cli"},
+	{true, 3, "fcomp qword ptr [ecx+61]"},
+	{true, 1, "pop ecx"},
+	{true, 5, "cmp eax, 0xb3e32ac3"},
+	{true, 1, "ret"},
+	{true, 2, "sub ah, bl"},
+	{true, 2, "jcez 0x00000fb5"},
+	{true, 2, "mov bl, 120"},
+	{true, 2, "js 0x00000fa6"},
+	{true, 1, "movsb"},
+	{true, 1, "inc edx"},
+	{true, 3, "xor byte ptr [esi+38], ah"},
+	{true, 3, "lodsb"},
+	{true, 2, "lodsb"},
+	{true, 1, "lodsb"},
+	{true, 2, "rcr ebx, 1"},
+	{true, 3, "fistp dword ptr [ebx+40]"},
+	{true, 1, "pop ebx"},
+	{true, 2, "sub byte ptr [ebx], bh"},
+	{true, 3, "cmp esi, dword ptr [eax+30]"},
+	{true, 2, "jo 0x00001020"},
+	{true, 1, "push ds"},
+	{true, 2, "mov bh, 84"},
+	{true, 1, "push esp"},
+	{true, 7, "sbb dl, byte ptr [ecx+eax*2+0x4106f0c4]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "inc ecx"},
+	{true, 2, "les esi, (invalid)"},
+	{true, 2, "lock push es"},
+	{true, 1, "push es"},
+	{true, 1, "inc ecx"},
+	{true, 6, "mov ecx, 0x3d2e307f"},
+	{true, 5, "mov ecx, 0x3d2e307f"},
+	{true, 2, "jnle 0x00001032"},
+	{true, 2, "xor byte ptr [esi], ch"},
+	{true, 6, "cmp eax, 0x4813b229"},
+	{true, 5, "cmp eax, 0x4813b229"},
+	{true, 6, "sub dword ptr [edx+0x83684813], esi"},
+	{true, 2, "mov dl, 19"},
+	{true, 3, "adc ecx, dword ptr [eax+104]"},
+	{true, 1, "dec eax"},
+	{true, 5, "push 0xb37e5983"},
+	{true, 4, "sbb dword ptr [ecx+126], 0xb3"},
+	{true, 1, "pop ecx"},
+	{true, 2, "jle 0x00000fb5"},
+	{true, 2, "mov bl, 32"},
+	{true, 2, "and ch, ch"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "loop 0x00001039"},
+	{true, 1, "aaa"},
+	{true, 5, "xor eax, 0xc92a2520"},
+	{true, 6, "and byte ptr [0xae67c92a], ah"},
+	{true, 5, "and eax, 0xae67c92a"},
+	{true, 2, "sub cl, cl"},
+	{true, 1, "leave"},
+	{true, 2, "scasb"},
+	{true, 1, "scasb"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "sub al, 0xd8"},
+	{true, 3, "fsubr dword ptr [ebp-18]"},
+	{true, 1, "insd"},
+	{true, 1, "out dx, al"},
+	{true, 1, "pushfd"},
+	{true, 2, "pushad"},
+	{true, 1, "pushad"},
+	{true, 6, "xor dword ptr [ecx+0xafbfe2d5], edi"},
+	{true, 5, "mov ecx, 0xafbfe2d5"},
+	{true, 2, "aad 0xe2"},
+	{true, 2, "loop 0x00000fc1"},
+	{true, 5, "mov edi, 0xb9b686af"},
+	{true, 1, "scasd"},
+	{true, 6, "xchg dh, byte ptr [esi+0xd7e61db9]"},
+	{true, 2, "mov dh, 0xb9"},
+	{true, 5, "mov ecx, 0x36d7e61d"},
+	{true, 5, "sbb eax, 0xc836d7e6"},
+	{true, 2, "out 0xd7, al"},
+	{true, 1, "xlat"},
+	{true, 5, "enter 0xfffffdab, 0xde"},
+	{true, 4, "enter 0xfffffdab, 0xde"},
+	{true, 1, "stosd"},
+	{true, 1, "std"},
+	{true, 2, "fiadd word ptr [ecx]"},
+	{true, 2, "add ebp, edx"},
+	{true, 2, "aad 0xef"},
+	{true, 1, "out dx, eax"},
+	{true, 1, "dec eax"},
+	{true, 1, "salc"},
+	{true, 11, "imul ecx, dword ptr [esp+edx+0xc897eafb], 0x6b459876"},
+	{true, 3, "mov dword ptr [ebx+edi*8], ss"},
+	{true, 2, "adc al, 0xfb"},
+	{true, 1, "sti"},
+	{true, 7, "jmp far 0x6b45:0x9876c897"},
+	{true, 1, "xchg edi, eax"},
+	{true, 4, "enter 0xffff9876, 69"},
+	{true, 2, "jbe 0x00000f9a"},
+	{true, 1, "cwde"},
+	{true, 1, "inc ebp"},
+	{true, 3, "imul ecx, dword ptr [esi], 104"},
+	{true, 1, "push cs"},
+	{true, 5, "push 0xc671e388"},
+	{true, 2, "mov bl, ah"},
+	{true, 2, "jcez 0x00001073"},
+	{true, 2, "jno 0x00000fc8"},
+	{false, 2, 0},
+	{true, 2, "sbb dword ptr [edi], ecx"},
+	{true, 7, "movaps xmm1, xmmword ptr [0xc23ba448]"},
+	{true, 6, "sub byte ptr [0xc23ba448], cl"},
+	{true, 5, "or eax, 0xc23ba448"},
+	{true, 1, "dec eax"},
+	{true, 1, "movsb"},
+	{true, 2, "cmp eax, edx"},
+	{true, 3, "ret 0xffffc883"},
+	{true, 3, "or eax, 0xa3"},
+	{true, 4, "enter 0xffff94a3, 0xa8"},
+	{true, 5, "mov dword ptr [0x7470a894], eax"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "test al, 112"},
+	{true, 2, "jo 0x00001076"},
+	{true, 2, "jz 0x00001016"},
+	{true, 2, "adc al, 10"},
+	{true, 3, "or bh, byte ptr [edx-57]"},
+	{true, 2, "jp 0x00000fc9"},
+	{false, 2, 0},
+	{true, 2, "xor al, 69"},
+	{true, 1, "inc ebp"},
+	{true, 3, "mov ch, byte ptr [ecx-127]"},
+	{true, 10, "imul eax, dword ptr [ecx+0x2045a5c2], 0x8a918e09"},
+	{true, 6, "add edx, 0x092045a5"},
+	{true, 3, "ret 0x45a5"},
+	{true, 1, "movsd"},
+	{true, 1, "inc ebp"},
+	{true, 2, "and byte ptr [ecx], cl"},
+	{true, 6, "or dword ptr [esi+0xe3ca8a91], ecx"},
+	{true, 6, "mov ss, word ptr [ecx+0xbbe3ca8a]"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "mov cl, dl"},
+	{true, 3, "retf 0xffffbbe3"},
+	{true, 2, "jcez 0x00000fbd"},
+	{true, 5, "mov ebx, 0x12f7a907"},
+	{true, 1, "pop es"},
+	{true, 5, "test eax, 0xcdec12f7"},
+	{true, 2, "not dword ptr [edx]"},
+	{true, 2, "adc ch, ah"},
+	{true, 1, "in al, dx"},
+	{true, 2, "int 110"},
+	{true, 1, "outsb"},
+	{true, 5, "xor eax, 0x3c9b2794"},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "daa"},
+	{true, 1, "wait"},
+	{true, 2, "cmp al, 31"},
+	{true, 1, "pop ds"},
+	{true, 7, "sbb byte ptr [edx+0x2c4feda8], 11"},
+	{true, 7, "callf far 0xd80b:0x2c4feda8"},
+	{true, 2, "test al, 0xed"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "dec edi"},
+	{true, 2, "sub al, 11"},
+	{true, 2, "or ebx, eax"},
+	{true, 2, "fsubr dword ptr [esi]"},
+	{true, 2, "push ebp"},
+	{true, 1, "push ebp"},
+	{true, 2, "jbe 0x00001037"},
+	{true, 5, "xor eax, 0x8aa7b73c"},
+	{true, 2, "cmp al, 0xb7"},
+	{true, 2, "mov bh, 0xa7"},
+	{true, 1, "cmpsd"},
+	{true, 2, "mov bl, byte ptr [edi]"},
+	{true, 1, "pop ds"},
+	{true, 1, "lodsd"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "or al, 0xd2"},
+	{true, 2, "shl byte ptr [edi], cl"},
+	{true, 1, "daa"},
+	{true, 2, "in eax, 0xdf"},
+	{true, 2, "fbstp tbyte ptr [ecx]"},
+	{true, 3, "xor dword ptr [eax-51], ecx"},
+	{true, 1, "dec eax"},
+	{true, 2, "int 12"},
+	{true, 2, "or al, 68"},
+	{true, 1, "inc esp"},
+	{true, 3, "rol ebp, 65"},
+	{true, 3, "lds eax, fword ptr [ecx+75]"},
+	{true, 1, "inc ecx"},
+	{true, 1, "dec ebx"},
+	{true, 2, "jmp 0x00000fb7"},
+	{true, 2, "mov ch, 76"},
+	{true, 1, "dec esp"},
+	{true, 6, "mov fs, word ptr [edi+0xf5e156f4]"},
+	{true, 1, "cmpsd"},
+	{true, 1, "hlt"},
+	{true, 1, "push esi"},
+	{true, 2, "loope 0x00000ff7"},
+	{true, 1, "cmc"},
+	{true, 5, "mov ebx, 0x4a57f9df"},
+	{false, 2, 0},
+	{true, 1, "stc"},
+	{true, 1, "push edi"},
+	{true, 1, "dec edx"},
+	{true, 2, "jnl 0x00001074"},
+	{true, 2, "jb 0x00000fe6"},
+	{true, 2, "in al, 0xdc"},
+	{true, 4, "fcom qword ptr [esp+ebx*4+43]"},
+	{true, 1, "push esp"},
+	{true, 1, "pushfd"},
+	{true, 4, "sub ecx, dword ptr [esp+edx*2+9]"},
+	{true, 1, "dec esp"},
+	{true, 1, "push esp"},
+	{true, 2, "or ebp, ecx"},
+	{true, 2, "int 0x83"},
+	{true, 3, "xor dword ptr [esi], 0xd7"},
+	{true, 2, "xlat"},
+	{true, 1, "xlat"},
+	{true, 6, "fsubr dword ptr [ecx+0x07e5be34]"},
+	{true, 5, "test eax, 0x07e5be34"},
+	{true, 2, "xor al, 0xbe"},
+	{true, 5, "mov esi, 0xd88b07e5"},
+	{true, 2, "in eax, 7"},
+	{true, 1, "pop es"},
+	{true, 2, "mov ebx, eax"},
+	{true, 2, "fdiv st, st(2)"},
+	{true, 6, "repne mov esi, 0x2afd33b1"},
+	{true, 5, "mov esi, 0x2afd33b1"},
+	{true, 2, "mov cl, 51"},
+	{true, 2, "xor edi, ebp"},
+	{true, 1, "std"},
+	{true, 3, "sub dl, byte ptr [esi+24]"},
+	{true, 1, "push esi"},
+	{true, 3, "sbb byte ptr [ebp+19], ah"},
+	{true, 7, "adc ebx, dword ptr gs:[0x1799001a]"},
+	{true, 6, "adc ebx, dword ptr [0x1799001a]"},
+	{true, 5, "sbb eax, 0x1799001a"},
+	{true, 2, "sbb al, byte ptr [eax]"},
+	{true, 6, "add byte ptr [ecx+0xdefbdd17], bl"},
+	{true, 1, "cdq"},
+	{true, 1, "pop ss"},
+	{false, 2, 0},
+	{true, 1, "sti"},
+	{true, 2, "fiadd word ptr [ebx]"},
+	{true, 7, "add ebp, dword ptr [ebp+esi*2+0xdbb84871]"},
+	{true, 1, "lodsb"},
+	{true, 2, "jnz 0x00001073"},
+	{true, 2, "jno 0x0000104a"},
+	{true, 1, "dec eax"},
+	{true, 5, "mov eax, 0x31ae7ddb"},
+	{true, 3, "fstp tbyte ptr [ebp-82]"},
+	{true, 2, "jnl 0x00000fb0"},
+	{true, 1, "scasb"},
+	{true, 2, "xor dword ptr [ecx], eax"},
+	{true, 6, "add dword ptr [esi+0xff0507e0], esi"},
+	{true, 2, "mov dh, 0xe0"},
+	{true, 2, "loopne 0x00001009"},
+	{true, 1, "pop es"},
+	{true, 5, "add eax, 0xe47da2ff"},
+	{true, 6, "jmp dword ptr [edx+0xd2dbe47d]"},
+	{true, 5, "mov byte ptr [0xd2dbe47d], al"},
+	{true, 2, "jnl 0x00000fe6"},
+	{true, 2, "in al, 0xdb"},
+	{true, 2, "fcmovnbe st, st(2)"},
+	{true, 3, "sal byte ptr [edx-39], cl"},
+	{true, 2, "jb 0x00000fdb"},
+	{true, 6, "fstp dword ptr [edx+0x40796f20]"},
+	{true, 7, "callf far 0x6f8d:0x40796f20"},
+	{true, 3, "and byte ptr [edi+121], ch"},
+	{true, 1, "outsd"},
+	{true, 2, "jns 0x00001042"},
+	{true, 1, "inc eax"},
+	{true, 3, "lea ebp, [edi-112]"},
+	{true, 1, "outsd"},
+	{true, 1, "nop"},
+	{true, 2, "xor al, 0xa5"},
+	{true, 1, "movsd"},
+	{true, 2, "jb 0x00000fbb"},
+	{true, 5, "mov ecx, 0xbfc07bad"},
+	{true, 1, "lodsd"},
+	{true, 2, "jnp 0x00000fc2"},
+	{true, 7, "sar byte ptr [edi+0xb7fe69dc], 0xd9"},
+	{true, 5, "mov edi, 0xb7fe69dc"},
+	{true, 3, "fsubr qword ptr [ecx-2]"},
+	{true, 6, "imul edi, esi, 0xf284d9b7"},
+	{false, 2, 0},
+	{true, 2, "mov bh, 0xd9"},
+	{true, 7, "fld dword ptr [edx+esi*8+0x15e250d9]"},
+	{true, 2, "test dl, dh"},
+	{true, 4, "repne fst dword ptr [eax-30]"},
+	{true, 3, "fst dword ptr [eax-30]"},
+	{true, 1, "push eax"},
+	{true, 2, "loop 0x00001017"},
+	{true, 5, "adc eax, 0xde8be823"},
+	{true, 2, "and ebp, eax"},
+	{true, 5, "call 0x76acee90"},
+	{true, 2, "mov ebx, esi"},
+	{true, 7, "fisubr word ptr [esi+esi*2+0xe6c9c940]"},
+	{true, 1, "lodsb"},
+	{true, 2, "jbe 0x00001042"},
+	{true, 1, "inc eax"},
+	{true, 1, "leave"},
+	{true, 1, "leave"},
+	{true, 2, "out 0xee, al"},
+	{true, 1, "out dx, al"},
+	{true, 2, "sub ecx, esp"},
+	{true, 2, "loope 0x00000fe7"},
+	{true, 2, "in eax, 0xf0"},
+	{true, 3, "lock mov bl, 16"},
+	{true, 2, "mov bl, 16"},
+	{true, 3, "adc byte ptr [eax+8], dl"},
+	{true, 1, "push eax"},
+	{true, 2, "or dh, al"},
+	{false, 2, 0},
+	{true, 2, "jle 0x0000105e"},
+	{true, 1, "pop esp"},
+	{true, 3, "sbb edi, dword ptr [ebx+126]"},
+	{true, 2, "jnp 0x00001080"},
+	{true, 2, "jle 0x00000f8c"},
+	{true, 6, "mov dh, byte ptr [eax+0x27486671]"},
+	{true, 2, "mov al, 113"},
+	{true, 2, "jno 0x00001068"},
+	{true, 2, "dec ax"},
+	{true, 1, "dec eax"},
+	{true, 1, "daa"},
+	{true, 1, "push ebp"},
+	{true, 3, "xor dword ptr [edi-71], esp"},
+	{true, 6, "mov ecx, 0x3341d534"},
+	{true, 5, "mov ecx, 0x3341d534"},
+	{true, 2, "xor al, 0xd5"},
+	{true, 2, "aad 65"},
+	{true, 1, "inc ecx"},
+	{true, 6, "xor eax, dword ptr [eax+0xe472a665]"},
+	{true, 4, "and byte ptr [ebp-90], 114"},
+	{true, 2, "cmpsb"},
+	{true, 1, "cmpsb"},
+	{true, 2, "jb 0x00000fe6"},
+	{true, 2, "in al, 0xe7"},
+	{true, 2, "out 0x8b, eax"},
+	{true, 6, "mov ebx, dword ptr [ebp+0x2571f3c7]"},
+	{true, 1, "popfd"},
+	{false, 2, 0},
+	{true, 3, "rep jno 0x00001028"},
+	{true, 2, "jno 0x00001027"},
+	{true, 5, "and eax, 0x7e9610a2"},
+	{true, 5, "mov byte ptr [0x027e9610], al"},
+	{true, 6, "adc byte ptr [esi+0xdece027e], dl"},
+	{true, 1, "xchg esi, eax"},
+	{true, 2, "jle 0x00001004"},
+	{true, 2, "add cl, dh"},
+	{true, 1, "into"},
+	{true, 6, "ficomp word ptr [edx+0x2a80a35c]"},
+	{true, 7, "callf far 0x8694:0x2a80a35c"},
+	{true, 1, "pop esp"},
+	{true, 5, "mov dword ptr [0x86942a80], eax"},
+	{true, 3, "sub byte ptr [edx], 0x94"},
+	{true, 7, "sub dl, byte ptr [esi+eax*4+0x4d4c9371]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "xchg dh, byte ptr [ecx-109]"},
+	{true, 2, "jno 0x00000f95"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "dec esp"},
+	{true, 1, "dec ebp"},
+	{true, 1, "nop"},
+	{true, 2, "mov dl, 0xed"},
+	{true, 1, "in eax, dx"},
+	{false, 2, 0},
+	{true, 1, "xchg esi, eax"},
+	{true, 1, "push eax"},
+	{true, 2, "jbe 0x00000f9b"},
+	{true, 1, "cdq"},
+	{true, 5, "mov esp, 0x29d90764"},
+	{true, 2, "pop es"},
+	{true, 1, "pop es"},
+	{true, 2, "fldcw word ptr [ecx]"},
+	{true, 2, "sub dword ptr [ebx], ecx"},
+	{true, 3, "or ebp, dword ptr [esp+ebp*2]"},
+	{true, 2, "sub al, 108"},
+	{true, 1, "insb"},
+	{true, 3, "and cl, byte ptr [eax-21]"},
+	{true, 1, "dec eax"},
+	{true, 2, "jmp 0x00001022"},
+	{true, 2, "and al, dh"},
+	{true, 3, "lock jnp 0x00000f8f"},
+	{true, 2, "jnp 0x00000f8e"},
+	{true, 6, "mov dword ptr [eax+0x9b2ba390], cs"},
+	{true, 6, "mov byte ptr [eax+0x1d9b2ba3], dl"},
+	{true, 1, "nop"},
+	{true, 5, "mov dword ptr [0x531d9b2b], eax"},
+	{true, 6, "sub ebx, dword ptr [ebx+0x0bfe531d]"},
+	{true, 1, "wait"},
+	{true, 5, "sbb eax, 0xfe0bfe53"},
+	{true, 1, "push ebx"},
+	{true, 2, "dec byte ptr [ebx]"},
+	{true, 2, "or edi, esi"},
+	{false, 2, 0},
+	{true, 2, "jnz 0x00001069"},
+	{true, 3, "iret"},
+	{true, 2, "iret"},
+	{true, 1, "iret"},
+	{true, 3, "ret 0xffffefb9"},
+	{true, 5, "mov ecx, 0xcafd10ef"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "adc ch, bh"},
+	{true, 1, "std"},
+	{true, 3, "retf 0xffff903b"},
+	{true, 6, "cmp edx, dword ptr [eax+0x978a3df2]"},
+	{true, 1, "nop"},
+	{true, 6, "repne cmp eax, 0x8c32978a"},
+	{true, 5, "cmp eax, 0x8c32978a"},
+	{true, 6, "mov dl, byte ptr [edi+0xd6eb8c32]"},
+	{true, 1, "xchg edi, eax"},
+	{true, 7, "xor cl, byte ptr [ebx+ebp*8+0x0ed78bd6]"},
+	{true, 2, "mov ebx, gs"},
+	{true, 2, "jmp 0x00000fd8"},
+	{true, 1, "salc"},
+	{true, 2, "mov edx, edi"},
+	{true, 1, "xlat"},
+	{true, 1, "push cs"},
+	{true, 4, "cmovp esi, dword ptr [eax-25]"},
+	{true, 1, "dec edx"},
+	{true, 2, "jo 0x00000fe9"},
+	{true, 2, "out 0x84, eax"},
+	{true, 2, "test byte ptr [eax], dh"},
+	{true, 2, "xor byte ptr [ebx], ah"},
+	{true, 2, "and ecx, dword ptr [eax]"},
+	{true, 2, "or byte ptr [ecx], ah"},
+	{true, 3, "and dword ptr [esi+eax*2], esi"},
+	{true, 2, "xor al, 70"},
+	{true, 1, "inc esi"},
+	{true, 5, "mov ebx, 0xe283fe69"},
+	{true, 6, "imul edi, esi, 0x2021e283"},
+	{true, 6, "inc byte ptr [ebx+0x682021e2]"},
+	{true, 3, "and edx, 33"},
+	{true, 2, "loop 0x00001023"},
+	{true, 2, "and dword ptr [eax], esp"},
+	{true, 3, "and byte ptr [eax-112], ch"},
+	{true, 5, "push 0xab12bd90"},
+	{true, 1, "nop"},
+	{true, 5, "mov ebp, 0x8e63ab12"},
+	{true, 6, "adc ch, byte ptr [ebx+0x3ef48e63]"},
+	{true, 1, "stosd"},
+	{true, 6, "arpl word ptr [esi+0xa9a73ef4], cx"},
+	{true, 2, "mov seg7, sp"},
+	{true, 1, "hlt"},
+	{true, 2, "cmpsd"},
+	{true, 1, "cmpsd"},
+	{true, 5, "test eax, 0x972c1702"},
+	{true, 2, "add dl, byte ptr [edi]"},
+	{true, 1, "pop ss"},
+	{true, 2, "sub al, 0x97"},
+	{true, 1, "xchg edi, eax"},
+	{true, 1, "salc"},
+	{true, 5, "mov ebp, 0x9161bee3"},
+	{true, 2, "jcez 0x00000fc0"},
+	{true, 5, "mov esi, 0x923b9161"},
+	{true, 1, "popad"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 6, "cmp edx, dword ptr [edx+0x7b3ee2a8]"},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "test al, 0xe2"},
+	{true, 2, "loop 0x00001040"},
+	{true, 3, "jnp 0x00001041"},
+	{true, 2, "jnp 0x00001040"},
+	{true, 2, "scasb"},
+	{true, 1, "scasb"},
+	{true, 2, "push 0x85"},
+	{true, 6, "test dword ptr [ebp+0xa3ca5039], eax"},
+	{true, 2, "test dword ptr [ecx], edi"},
+	{true, 3, "cmp dword ptr [eax-54], edx"},
+	{true, 1, "push eax"},
+	{true, 3, "retf 0x50a3"},
+	{true, 5, "mov dword ptr [0x469fee50], eax"},
+	{true, 1, "push eax"},
+	{true, 1, "out dx, al"},
+	{true, 1, "lahf"},
+	{true, 1, "inc esi"},
+	{true, 1, "pop edx"},
+	{true, 2, "int 0x81"},
+	{true, 6, "sbb dword ptr [eax], 0x01bddb23"},
+	{true, 2, "sbb byte ptr [ebx], ah"},
+	{true, 2, "and ebx, ebx"},
+	{true, 6, "fstp tbyte ptr [ebp+0xe3066801]"},
+	{true, 5, "mov ebp, 0xe3066801"},
+	{true, 3, "add dword ptr [eax+6], ebp"},
+	{true, 5, "push 0x2220e306"},
+	{true, 1, "push es"},
+	{true, 2, "jcez 0x00001022"},
+	{true, 2, "and byte ptr [edx], ah"},
+	{true, 6, "and bl, byte ptr [ebp+0x669387e8]"},
+	{true, 1, "popfd"},
+	{true, 5, "call 0x1e66a38c"},
+	{true, 6, "xchg edx, dword ptr [ebx+0x12b81e66]"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 2, "push ds"},
+	{true, 1, "push ds"},
+	{true, 5, "mov eax, 0xe3d47e12"},
+	{true, 3, "adc bh, byte ptr [esi-44]"},
+	{true, 2, "jle 0x00000fd6"},
+	{true, 2, "aam 0xe3"},
+	{true, 2, "jcez 0x00000f97"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 1, "hlt"},
+	{true, 1, "int3"},
+	{true, 2, "fld qword ptr [ebx]"},
+	{true, 3, "add esp, dword ptr [ecx]"},
+	{true, 2, "and al, 97"},
+	{true, 1, "popad"},
+	{true, 2, "loopne 0x00001039"},
+	{true, 1, "aaa"},
+	{true, 2, "aad 117"},
+	{true, 2, "jnz 0x00001007"},
+	{true, 5, "add eax, 0x821c12d4"},
+	{true, 2, "aam 18"},
+	{true, 3, "adc bl, byte ptr [edx+eax*4]"},
+	{true, 2, "sbb al, 0x82"},
+	{true, 3, "or bl, 0xc9"},
+	{true, 1, "retf"},
+	{true, 1, "leave"},
+	{true, 6, "or ah, byte ptr [ebx+0x8abd25ad]"},
+	{true, 5, "mov dword ptr [0x8abd25ad], eax"},
+	{true, 1, "lodsd"},
+	{true, 5, "and eax, 0xabb18abd"},
+	{true, 5, "mov ebp, 0x69abb18a"},
+	{true, 6, "mov dh, byte ptr [ecx+0x85a669ab]"},
+	{true, 2, "mov cl, 0xab"},
+	{true, 1, "stosd"},
+	{false, 5, 0},
+	{true, 1, "cmpsb"},
+	{true, 2, "test dword ptr [esi], edx"},
+	{true, 1, "push ss"},
+	{false, 1, 0},
+};
+
+static const golden_t golden_random64[golden_count] = {
+	{true, 3, "and byte ptr [rcx+113], al"},
+	{true, 3, "jno 0x000000000000106e"},
+	{true, 2, "jno 0x000000000000106d"},
+	{true, 4, "imul ecx, dword ptr [rbp+125], 75"},
+	{true, 3, "jnl 0x000000000000104e"},
+	{true, 2, "jnl 0x000000000000104d"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "mov bl, dl"},
+	{true, 3, "shl dword ptr [rsi-11], cl"},
+	{true, 2, "cmc"},
+	{true, 1, "cmc"},
+	{true, 1, "pop rax"},
+	{true, 5, "mov ebx, 0x5e403eea"},
+	{false, 1, 0},
+	{true, 3, "pop rsi"},
+	{true, 2, "pop rsi"},
+	{true, 1, "pop rsi"},
+	{false, 1, 0},
+	{true, 1, "lodsd"},
+	{true, 5, "mov esp, 0xfffffffffa44fee0"},
+	{true, 2, "loopne 0x0000000000001000"},
+	{true, 4, "inc byte ptr [rdx+rdi*8+111]"},
+	{true, 2, "cli"},
+	{true, 1, "cli"},
+	{true, 1, "outsd"},
+	{true, 2, "fldenv [rcx]"},
+	{true, 3, "and dword ptr [rcx+16], ebx"},
+	{true, 1, "pop rcx"},
+	{true, 6, "adc byte ptr [rax+0xffffffff8c24a21f], dh"},
+	{true, 2, "mov al, 31"},
+	{false, 1, 0},
+	{true, 5, "mov byte ptr [0x084b8c24], al"},
+	{true, 2, "and al, 0x8c"},
+	{true, 3, "mov dword ptr [rbx+8], cs"},
+	{true, 7, "or byte ptr [r13+0xffffffffa3e10d86], dil"},
+	{true, 6, "or byte ptr [rbp+0xffffffffa3e10d86], bh"},
+	{true, 5, "mov ebp, 0xffffffffa3e10d86"},
+	{true, 6, "xchg cl, byte ptr [rip+0x12e0a3e1]"},
+	{true, 5, "or eax, 0x12e0a3e1"},
+	{true, 2, "loope 0x0000000000000fa5"},
+	{true, 5, "mov dword ptr [0x242212e0], eax"},
+	{true, 2, "loopne 0x0000000000001014"},
+	{true, 2, "adc ah, byte ptr [rdx]"},
+	{true, 3, "and ah, byte ptr [rdx]"},
+	{true, 2, "and al, 0xe2"},
+	{true, 2, "loop 0x0000000000000ffe"},
+	{true, 1, "cld"},
+	{true, 1, "popfd"},
+	{true, 1, "lahf"},
+	{true, 2, "jbe 0x0000000000000fcb"},
+	{true, 1, "leave"},
+	{true, 1, "stc"},
+	{true, 1, "iret"},
+	{true, 8, "add dword ptr [rsi*2+0x5cae09d8], 19"},
+	{true, 2, "add al, 117"},
+	{true, 2, "jnz 0x0000000000000fda"},
+	{true, 2, "fmul dword ptr [rcx]"},
+	{true, 6, "or dword ptr [rsi+0xffffffffe901135c], ebp"},
+	{true, 1, "scasb"},
+	{true, 1, "pop rsp"},
+	{true, 2, "adc eax, dword ptr [rcx]"},
+	{true, 2, "add ecx, ebp"},
+	{true, 5, "jmp 0x000000006af2aa4c"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "repne push 21"},
+	{true, 2, "push 21"},
+	{true, 5, "adc eax, 0xffffffffab9c5392"},
+	{true, 1, "xchg edx, eax"},
+	{true, 1, "push rbx"},
+	{true, 1, "pushfd"},
+	{true, 1, "stosd"},
+	{true, 7, "cmp esp, dword ptr [rbp+rdx*4+0xffffffffba4bb96c]"},
+	{true, 1, "movsb"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 1, "insb"},
+	{true, 5, "mov ecx, 0xffffffffa077ba4b"},
+	{true, 10, "mov r10, 0x091641a3302fa077"},
+	{true, 5, "mov edx, 0x302fa077"},
+	{true, 2, "jnbe 0x0000000000000fa2"},
+	{true, 5, "mov al, byte ptr [0x41a3302f]"},
+	{false, 1, 0},
+	{true, 6, "xor byte ptr [rbx+0x3c091641], ah"},
+	{true, 5, "mov dword ptr [0x3c091641], eax"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "or dword ptr [rsi+rsi*4], edi"},
+	{true, 2, "cmp al, 0xb6"},
+	{true, 2, "mov dh, 0xbf"},
+	{true, 5, "mov edi, 0xffffffffbfaf7a2b"},
+	{true, 3, "sub edi, dword ptr [rdx-81]"},
+	{true, 2, "jp 0x0000000000000fb1"},
+	{true, 1, "scasd"},
+	{true, 5, "mov edi, 0x1cfbc500"},
+	{true, 2, "add ch, al"},
+	{false, 1, 0},
+	{true, 1, "sti"},
+	{true, 2, "sbb al, 0xe0"},
+	{true, 2, "loopne 0x0000000000000fad"},
+	{true, 1, "stosd"},
+	{false, 1, 0},
+	{true, 1, "stosd"},
+	{true, 2, "popfd"},
+	{true, 1, "popfd"},
+	{true, 1, "cmc"},
+	{true, 7, "sub dword ptr [rbp+rbp*2+0xffffffff880f1c52], edx"},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "insd"},
+	{true, 1, "push rdx"},
+	{true, 2, "sbb al, 15"},
+	{true, 6, "js 0xfffffffff3fa77bd"},
+	{true, 6, "mov byte ptr [rdi+0x0df3fa67], dh"},
+	{true, 2, "mov bh, 103"},
+	{true, 2, "cli"},
+	{true, 1, "cli"},
+	{true, 6, "rep or eax, 0x6206ecb0"},
+	{true, 5, "or eax, 0x6206ecb0"},
+	{true, 2, "mov al, 0xec"},
+	{true, 1, "in al, dx"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 2, "jb 0x0000000000000fb4"},
+	{true, 2, "mov dl, 0xeb"},
+	{true, 2, "jmp 0x0000000000000fbd"},
+	{true, 5, "mov ebx, 0xffffffff9fd6fae1"},
+	{true, 2, "loope 0x0000000000000ffc"},
+	{true, 1, "cli"},
+	{false, 1, 0},
+	{true, 1, "lahf"},
+	{true, 6, "add esp, 0xffffffff88846002"},
+	{false, 1, 0},
+	{true, 3, "add ah, byte ptr [rax-124]"},
+	{false, 1, 0},
+	{true, 6, "test byte ptr [rax+0x28e8286f], cl"},
+	{true, 3, "mov byte ptr [rdi+40], ch"},
+	{true, 1, "outsd"},
+	{true, 2, "sub al, ch"},
+	{true, 5, "call 0x000000004dc76c2d"},
+	{true, 4, "sub byte ptr [rdi+rax*8+77], bl"},
+	{true, 1, "pop rsp"},
+	{false, 2, 0},
+	{true, 2, "xchg r12, rax"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "xchg bh, byte ptr [rsi]"},
+	{true, 2, "xchg edi, eax"},
+	{true, 1, "xchg edi, eax"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 3, "or ecx, dword ptr [rax+69]"},
+	{false, 2, 0},
+	{true, 3, "lea r14d, [r10]"},
+	{true, 2, "lea esi, [rdx]"},
+	{true, 6, "xor bl, byte ptr [rdx+0x5f10e759]"},
+	{false, 1, 0},
+	{true, 1, "pop rcx"},
+	{true, 2, "out 16, eax"},
+	{true, 3, "adc byte ptr [rdi+112], bl"},
+	{true, 1, "pop rdi"},
+	{true, 2, "jo 0x0000000000001032"},
+	{true, 2, "xor bh, bl"},
+	{true, 6, "fistp word ptr [rcx+0xffffffffd908512f]"},
+	{true, 1, "cdq"},
+	{false, 1, 0},
+	{true, 1, "push rcx"},
+	{true, 2, "or cl, bl"},
+	{true, 6, "fst dword ptr [rip+0x68582cd8]"},
+	{true, 5, "adc eax, 0x68582cd8"},
+	{true, 3, "fsubr dword ptr [rax+rbx*2]"},
+	{true, 2, "sub al, 88"},
+	{true, 1, "pop rax"},
+	{true, 5, "push 0xffffffffe1d7f073"},
+	{true, 2, "jnb 0x0000000000000ff2"},
+	{true, 2, "lock xlat"},
+	{true, 1, "xlat"},
+	{true, 2, "loope 0x000000000000102c"},
+	{true, 7, "sub cl, byte ptr [rsi+rsi+0xffffffffd6136016]"},
+	{true, 2, "mov dword ptr [rsi], seg7"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 2, "adc edx, esi"},
+	{false, 1, 0},
+	{true, 1, "stosd"},
+	{true, 6, "mov byte ptr [rax+0xffffffff84a638b0], al"},
+	{true, 7, "xor byte ptr [rax+0x3284a638], 0xf9"},
+	{true, 2, "mov al, 56"},
+	{true, 6, "cmp byte ptr [rsi+0xffffffff8cf93284], ah"},
+	{true, 1, "cmpsb"},
+	{true, 2, "test byte ptr [rdx], dh"},
+	{true, 2, "xor bh, cl"},
+	{true, 1, "stc"},
+	{true, 2, "mov dword ptr [rdx], ss"},
+	{true, 2, "adc bl, ch"},
+	{true, 2, "fnstsw word ptr [rcx]"},
+	{true, 2, "cmp edx, edx"},
+	{true, 6, "shl byte ptr [rsi+0x59927ba0], cl"},
+	{true, 1, "cmpsb"},
+	{true, 5, "mov al, byte ptr [0xfffffffff259927b]"},
+	{true, 2, "jnp 0x0000000000000f94"},
+	{true, 1, "xchg edx, eax"},
+	{true, 1, "pop rcx"},
+	{true, 2, "repne insd"},
+	{true, 1, "insd"},
+	{true, 5, "call 0x000000002d8dc1ab"},
+	{true, 1, "cmpsb"},
+	{true, 2, "mov cl, 0x8d"},
+	{true, 6, "lea ebp, [rip+0xffffffffee98bdfa]"},
+	{true, 5, "sub eax, 0xffffffffee98bdfa"},
+	{true, 1, "cli"},
+	{true, 5, "mov ebp, 0x53fdee98"},
+	{true, 1, "cwde"},
+	{true, 1, "out dx, al"},
+	{true, 1, "std"},
+	{true, 1, "push rbx"},
+	{true, 2, "mov bh, 0xae"},
+	{true, 1, "scasb"},
+	{true, 5, "mov dword ptr [0xfffffffff160692b], eax"},
+	{true, 3, "sub ebp, dword ptr [rcx+96]"},
+	{true, 7, "imul esp, dword ptr [rax-15], 0xffffffff8fa32f51"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 1, "push rcx"},
+	{false, 1, 0},
+	{true, 5, "mov dword ptr [0xffffffffbbf9c58f], eax"},
+	{true, 2, "pop rbp"},
+	{false, 1, 0},
+	{true, 1, "stc"},
+	{true, 5, "mov ebx, 0x5353d113"},
+	{true, 2, "adc edx, ecx"},
+	{true, 3, "rcl dword ptr [rbx+83], 1"},
+	{true, 1, "push rbx"},
+	{true, 1, "push rbx"},
+	{false, 1, 0},
+	{true, 2, "sub al, 79"},
+	{true, 2, "cmc"},
+	{true, 1, "cmc"},
+	{true, 3, "rcl bl, 49"},
+	{true, 2, "sal dword ptr [rcx], cl"},
+	{true, 3, "xor dword ptr [rbp-34], eax"},
+	{true, 7, "fisub word ptr [r11+0xffffffffb7a201dd]"},
+	{true, 6, "fisub word ptr [rbx+0xffffffffb7a201dd]"},
+	{true, 5, "mov dword ptr [0xffffffffb7a201dd], eax"},
+	{true, 2, "fld qword ptr [rcx]"},
+	{true, 6, "add dword ptr [rdx+0xfffffffff3b901b7], esp"},
+	{true, 5, "mov byte ptr [0xfffffffff3b901b7], al"},
+	{true, 2, "mov bh, 1"},
+	{true, 6, "add dword ptr [rcx+0x4d0284f3], edi"},
+	{true, 5, "mov ecx, 0x4d0284f3"},
+	{true, 3, "rep test byte ptr [rdx], al"},
+	{true, 2, "test byte ptr [rdx], al"},
+	{true, 3, "add cl, byte ptr [rbp+46]"},
+	{false, 2, 0},
+	{true, 3, "mov ch, 0xa8"},
+	{true, 2, "mov ch, 0xa8"},
+	{true, 2, "test al, 43"},
+	{true, 6, "sub esi, dword ptr [rcx+0x254588c7]"},
+	{true, 2, "mov cl, 0xc7"},
+	{false, 2, 0},
+	{true, 3, "mov byte ptr [rbp+37], al"},
+	{true, 6, "and r8d, 0xffffffff8fd53565"},
+	{true, 5, "and eax, 0xffffffff8fd53565"},
+	{true, 6, "xor eax, 0x25818fd5"},
+	{true, 5, "xor eax, 0x25818fd5"},
+	{false, 1, 0},
+	{true, 6, "pop qword ptr [rcx+0x3616d025]"},
+	{true, 10, "and dword ptr [rip+0x653616d0], 0xfffffffffd61922b"},
+	{true, 5, "and eax, 0x653616d0"},
+	{true, 2, "rcl byte ptr [rsi], 1"},
+	{false, 1, 0},
+	{true, 8, "sub edx, dword ptr gs:[rdx+0xffffffffd8d0fd61]"},
+	{true, 7, "sub edx, dword ptr gs:[rdx+0xffffffffd8d0fd61]"},
+	{true, 6, "sub edx, dword ptr [rdx+0xffffffffd8d0fd61]"},
+	{true, 1, "xchg edx, eax"},
+	{false, 1, 0},
+	{true, 1, "std"},
+	{true, 2, "rcr al, 1"},
+	{true, 2, "fdivr st, st(1)"},
+	{true, 1, "stc"},
+	{true, 3, "and dword ptr [rdi-56], ebx"},
+	{true, 1, "pop rdi"},
+	{true, 4, "enter 0x1c32, 0xa5"},
+	{true, 7, "xor bl, byte ptr [0xffffffffddfc5613]"},
+	{true, 2, "sbb al, 0xa5"},
+	{true, 1, "movsd"},
+	{true, 3, "adc edx, dword ptr [rsi-4]"},
+	{true, 1, "push rsi"},
+	{true, 1, "cld"},
+	{false, 2, 0},
+	{true, 2, "int 94"},
+	{true, 1, "pop rsi"},
+	{false, 2, 0},
+	{true, 5, "test eax, 0xffffffffceb853b6"},
+	{true, 2, "mov dh, 83"},
+	{true, 1, "push rbx"},
+	{true, 5, "mov eax, 0x096748ce"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 7, "or dword ptr [edx+0xffffffff97c0d280], esi"},
+	{true, 6, "or dword ptr [rdx+0xffffffff97c0d280], esi"},
+	{true, 2, "mov dl, 0x80"},
+	{true, 3, "adc dl, 0xc0"},
+	{true, 2, "rol al, cl"},
+	{true, 7, "rcl byte ptr [rdi+0xffffffff950f6d6d], 121"},
+	{true, 1, "xchg edi, eax"},
+	{true, 1, "insd"},
+	{true, 1, "insd"},
+	{true, 4, "setnz byte ptr [rcx+17]"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 2, "jns 0x0000000000001013"},
+	{true, 6, "adc dword ptr [rsi+0xffffffffceae7a59], ebp"},
+	{true, 1, "scasb"},
+	{true, 1, "pop rcx"},
+	{true, 2, "jp 0x0000000000000fb0"},
+	{true, 1, "scasb"},
+	{false, 1, 0},
+	{true, 5, "mov al, byte ptr [0x71c42a78]"},
+	{true, 2, "js 0x000000000000102c"},
+	{true, 2, "sub al, ah"},
+	{false, 1, 0},
+	{true, 2, "jno 0x000000000000103e"},
+	{true, 2, "cmp al, 0xff"},
+	{true, 3, "push qword ptr [rdx+29]"},
+	{true, 2, "jb 0x000000000000101f"},
+	{true, 5, "sbb eax, 0xfffffffff775939d"},
+	{true, 1, "popfd"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 2, "jnz 0x0000000000000ff9"},
+	{false, 2, 0},
+	{true, 3, "mov dl, byte ptr [rsi+16]"},
+	{true, 1, "push rsi"},
+	{true, 2, "adc ah, dl"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 1, "sahf"},
+	{true, 3, "fild dword ptr [rcx-57]"},
+	{true, 8, "mov dword ptr [r10+43], 0x40f85c87"},
+	{true, 7, "mov dword ptr [rdx+43], 0x40f85c87"},
+	{true, 7, "sub eax, dword ptr [rdi+0x5f40f85c]"},
+	{true, 6, "sub eax, dword ptr [rdi+0x5f40f85c]"},
+	{true, 4, "xchg ebx, dword ptr [rax+rdi*8+64]"},
+	{true, 1, "pop rsp"},
+	{true, 1, "clc"},
+	{true, 2, "pop rdi"},
+	{true, 1, "pop rdi"},
+	{false, 1, 0},
+	{true, 1, "outsd"},
+	{true, 3, "xor dh, byte ptr [rbp+53]"},
+	{true, 2, "jnz 0x0000000000001037"},
+	{true, 5, "xor eax, 0x579f982b"},
+	{true, 6, "sub ebx, dword ptr [rax+0xfffffffffd24579f]"},
+	{true, 1, "cwde"},
+	{true, 1, "lahf"},
+	{true, 1, "push rdi"},
+	{true, 2, "and al, 0xfd"},
+	{true, 1, "std"},
+	{true, 6, "fidiv dword ptr [rdx+0xffffffffad09041e]"},
+	{true, 2, "mov dl, 30"},
+	{false, 1, 0},
+	{true, 2, "add al, 9"},
+	{true, 6, "or dword ptr [rbp+0xfffffffff16c55c7], ebp"},
+	{true, 1, "lodsd"},
+	{false, 2, 0},
+	{true, 1, "push rbp"},
+	{true, 1, "insb"},
+	{false, 1, 0},
+	{true, 1, "xchg edx, eax"},
+	{true, 3, "loope 0x0000000000000ffb"},
+	{true, 2, "loope 0x0000000000000ffa"},
+	{true, 1, "clc"},
+	{true, 1, "push rsi"},
+	{true, 3, "imul ebx, esi, 90"},
+	{true, 3, "ficomp word ptr [rdx-91]"},
+	{true, 1, "pop rdx"},
+	{true, 1, "movsd"},
+	{true, 2, "jno 0x000000000000102c"},
+	{true, 2, "sub dl, bh"},
+	{true, 1, "xlat"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "pop rbp"},
+	{true, 1, "pop rsi"},
+	{true, 3, "and edx, dword ptr [rcx+16]"},
+	{true, 1, "push rcx"},
+	{true, 2, "adc byte ptr [rdi], bl"},
+	{false, 1, 0},
+	{true, 2, "jnz 0x0000000000001047"},
+	{true, 3, "mov r15b, 24"},
+	{true, 2, "mov bh, 24"},
+	{true, 2, "sbb dh, cl"},
+	{false, 1, 0},
+	{true, 1, "in al, dx"},
+	{true, 1, "cld"},
+	{true, 5, "mov edx, 0xffffffffb3ee3109"},
+	{true, 2, "or dword ptr [rcx], esi"},
+	{true, 2, "xor esi, ebp"},
+	{true, 1, "out dx, al"},
+	{true, 2, "mov bl, 0xa7"},
+	{true, 1, "cmpsd"},
+	{true, 1, "cmpsd"},
+	{true, 2, "mov cl, 47"},
+	{false, 1, 0},
+	{true, 1, "pop rax"},
+	{true, 2, "and ebp, esp"},
+	{true, 2, "in eax, 0xd1"},
+	{true, 3, "ror dword ptr [rcx+17], 1"},
+	{true, 3, "adc r15, rdx"},
+	{true, 2, "adc edi, edx"},
+	{true, 1, "xlat"},
+	{true, 2, "jo 0x0000000000001033"},
+	{true, 6, "xor dword ptr [rcx+0xffffffff9319926a], esp"},
+	{true, 5, "mov eax, dword ptr [0xffffffff9319926a]"},
+	{true, 2, "push 0x92"},
+	{true, 1, "xchg edx, eax"},
+	{true, 6, "sbb dword ptr [rbx+0xffffffffd9eea9c3], edx"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "ret"},
+	{true, 5, "test eax, 0x0fb8d9ee"},
+	{true, 1, "out dx, al"},
+	{true, 6, "fnstcw word ptr [rax+0xfffffffff6f3c70f]"},
+	{true, 5, "mov eax, 0xfffffffff6f3c70f"},
+	{true, 3, "vmptrld (invalid)"},
+	{false, 2, 0},
+	{true, 4, "rep test bl, 0xf7"},
+	{true, 3, "test bl, 0xf7"},
+	{true, 1, "ret"},
+	{false, 2, 0},
+	{true, 2, "or al, 0xf4"},
+	{true, 1, "hlt"},
+	{true, 2, "loope 0x0000000000000fd4"},
+	{true, 2, "rcl ah, cl"},
+	{false, 1, 0},
+	{true, 1, "wait"},
+	{true, 2, "jcez 0x0000000000001042"},
+	{true, 3, "sbb al, 0xb2"},
+	{true, 2, "sbb al, 0xb2"},
+	{true, 2, "mov dl, 0x9a"},
+	{false, 1, 0},
+	{true, 2, "add esi, dword ptr [rbx]"},
+	{true, 2, "xor ecx, dword ptr [rbx]"},
+	{true, 2, "or ebp, edx"},
+	{false, 1, 0},
+	{true, 4, "enter 0x6f02, 72"},
+	{true, 3, "add ch, byte ptr [rdi+72]"},
+	{true, 1, "outsd"},
+	{true, 2, "out dx, rax"},
+	{true, 1, "out dx, eax"},
+	{true, 5, "jmp 0x00000000581b054f"},
+	{true, 2, "cmc"},
+	{true, 1, "cmc"},
+	{true, 3, "sbb bl, byte ptr [rax+23]"},
+	{true, 1, "pop rax"},
+	{false, 1, 0},
+	{true, 3, "div dword ptr [rdi+46]"},
+	{true, 2, "jnbe 0x0000000000001030"},
+	{true, 3, "mov bl, ah"},
+	{true, 2, "mov bl, ah"},
+	{true, 2, "fmul st(6), st"},
+	{false, 1, 0},
+	{true, 3, "sar byte ptr [rdi+46], cl"},
+	{true, 2, "jnle 0x0000000000001030"},
+	{true, 8, "adc spl, byte ptr cs:[r13+0xffffffffe9be07b5]"},
+	{true, 7, "adc spl, byte ptr [r13+0xffffffffe9be07b5]"},
+	{true, 6, "adc ah, byte ptr [rbp+0xffffffffe9be07b5]"},
+	{true, 1, "movsd"},
+	{true, 2, "mov ch, 7"},
+	{false, 1, 0},
+	{true, 5, "mov esi, 0x035f6fe9"},
+	{true, 5, "jmp 0xffffffffa5036f74"},
+	{true, 1, "outsd"},
+	{true, 1, "pop rdi"},
+	{true, 6, "add esp, dword ptr [rbp+0xffffffff8589f450]"},
+	{true, 1, "movsd"},
+	{true, 1, "push rax"},
+	{true, 1, "hlt"},
+	{true, 6, "mov dword ptr [rbp+0x3d4c7dba], eax"},
+	{true, 6, "test dword ptr [rdx+0xffffffffba3d4c7d], edi"},
+	{true, 5, "mov edx, 0xffffffffba3d4c7d"},
+	{true, 2, "jnl 0x000000000000104e"},
+	{true, 6, "cmp rax, 0xffffffffed3b51ba"},
+	{true, 5, "cmp eax, 0xffffffffed3b51ba"},
+	{true, 5, "mov edx, 0x08ed3b51"},
+	{true, 1, "push rcx"},
+	{true, 2, "cmp ebp, ebp"},
+	{true, 1, "in eax, dx"},
+	{true, 6, "or byte ptr [rbp+0xffffffffe6bd4f92], dh"},
+	{true, 2, "mov ch, 0x92"},
+	{true, 1, "xchg edx, eax"},
+	{true, 10, "mov r13, 0x5c6658e5d2a6f8e6"},
+	{true, 5, "mov ebp, 0xffffffffd2a6f8e6"},
+	{true, 2, "out 0xf8, al"},
+	{true, 1, "clc"},
+	{true, 1, "cmpsb"},
+	{true, 2, "shl ch, cl"},
+	{true, 2, "in eax, 88"},
+	{true, 1, "pop rax"},
+	{true, 2, "pop rsp"},
+	{true, 1, "pop rsp"},
+	{true, 5, "add eax, 0x358aa47f"},
+	{true, 2, "jnle 0x0000000000000fa6"},
+	{true, 1, "movsb"},
+	{true, 6, "mov dh, byte ptr [rip+0x0e5a3c7a]"},
+	{true, 5, "xor eax, 0x0e5a3c7a"},
+	{true, 2, "jp 0x000000000000103e"},
+	{true, 2, "cmp al, 90"},
+	{true, 1, "pop rdx"},
+	{false, 1, 0},
+	{true, 1, "lodsd"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 1, "wait"},
+	{true, 2, "mov bl, 52"},
+	{true, 2, "xor al, 0xb2"},
+	{true, 2, "mov dl, 0xec"},
+	{true, 1, "in al, dx"},
+	{true, 1, "stc"},
+	{true, 1, "push rcx"},
+	{true, 2, "jp 0x000000000000105b"},
+	{true, 1, "pop rcx"},
+	{true, 2, "sbb bl, dh"},
+	{true, 2, "ficomp word ptr [rsi]"},
+	{false, 1, 0},
+	{true, 1, "xchg edi, eax"},
+	{true, 1, "clc"},
+	{false, 1, 0},
+	{true, 5, "add eax, 0xffffffff92789e7c"},
+	{true, 2, "jl 0x0000000000000fa0"},
+	{true, 1, "sahf"},
+	{true, 2, "js 0x0000000000000f94"},
+	{true, 1, "xchg edx, eax"},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "fdivr st, st(0)"},
+	{true, 1, "clc"},
+	{true, 3, "and dword ptr [rbp-112], ebx"},
+	{true, 1, "pop rbp"},
+	{true, 1, "nop"},
+	{true, 6, "imul eax, eax, 0xffffffffad43e76c"},
+	{true, 5, "shr byte ptr [rdi+67], 0xad"},
+	{true, 1, "insb"},
+	{true, 2, "out 67, eax"},
+	{true, 2, "lodsd"},
+	{true, 1, "lodsd"},
+	{true, 2, "and dl, byte ptr [rdi]"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 1, "xchg esp, eax"},
+	{true, 5, "or ebx, dword ptr [rbp+r8*4+60]"},
+	{true, 4, "or ebx, dword ptr [rbp+rax*4+60]"},
+	{true, 1, "pop rsp"},
+	{true, 3, "test dword ptr [rbx+rdi*4], edi"},
+	{true, 2, "cmp al, 0xbb"},
+	{true, 5, "mov ebx, 0x4939b7cf"},
+	{true, 1, "iret"},
+	{true, 2, "mov bh, 57"},
+	{true, 3, "cmp dword ptr [rcx+43], ecx"},
+	{true, 3, "sub rdi, r15"},
+	{true, 2, "sub edi, edi"},
+	{true, 2, "jmpf (invalid)"},
+	{true, 5, "call 0x00000000060e81e2"},
+	{true, 3, "fnsave [rcx+14]"},
+	{true, 2, "jno 0x0000000000001010"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 4, "add byte ptr [r13-80], bpl"},
+	{true, 3, "add byte ptr [rbp-80], ch"},
+	{true, 1, "insd"},
+	{true, 2, "mov al, 59"},
+	{true, 2, "cmp eax, ebx"},
+	{true, 1, "ret"},
+	{true, 3, "cmp ch, byte ptr [rax-82]"},
+	{true, 5, "push 0xffffffffe9a01bae"},
+	{true, 1, "scasb"},
+	{true, 6, "sbb esp, dword ptr [rax+0x178b6fe9]"},
+	{true, 5, "mov al, byte ptr [0x178b6fe9]"},
+	{true, 5, "jmp 0xffffffffaa179b74"},
+	{true, 1, "outsd"},
+	{true, 2, "mov edx, dword ptr [rdi]"},
+	{false, 1, 0},
+	{true, 1, "stosb"},
+	{true, 5, "call 0x000000006f34712b"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "xor al, 111"},
+	{true, 1, "outsd"},
+	{true, 5, "mov ecx, 0xffffffffb8642440"},
+	{true, 3, "and al, 100"},
+	{true, 2, "and al, 100"},
+	{true, 6, "mov eax, 0xffffffffe90dfff7"},
+	{true, 5, "mov eax, 0xffffffffe90dfff7"},
+	{true, 2, "idiv edi"},
+	{true, 6, "dec dword ptr [rip+0x31ba87e9]"},
+	{true, 5, "or eax, 0x31ba87e9"},
+	{true, 5, "jmp 0xffffffffd231ca8c"},
+	{true, 6, "xchg edi, dword ptr [rdx+0x04a6d231]"},
+	{true, 5, "mov edx, 0x04a6d231"},
+	{true, 2, "xor edx, edx"},
+	{true, 6, "shl byte ptr [rsi+0x7fe47604], cl"},
+	{true, 1, "cmpsb"},
+	{true, 2, "add al, 118"},
+	{true, 2, "jbe 0x0000000000000fe6"},
+	{true, 2, "in al, 127"},
+	{true, 2, "jnle 0x000000000000105b"},
+	{true, 1, "pop rcx"},
+	{true, 2, "jp 0x0000000000001066"},
+	{true, 6, "sub eax, 0xfffffffff51db4c7"},
+	{true, 5, "sub eax, 0xfffffffff51db4c7"},
+	{false, 2, 0},
+	{true, 2, "mov ah, 29"},
+	{true, 5, "sbb eax, 0xffffffffc7097ff5"},
+	{true, 1, "cmc"},
+	{true, 2, "jnle 0x000000000000100b"},
+	{true, 2, "or edi, eax"},
+	{true, 7, "mov dword ptr [rbp+27], 0xffffffffb170352e"},
+	{true, 3, "sbb r13d, dword ptr [r14]"},
+	{true, 2, "sbb ebp, dword ptr [rsi]"},
+	{true, 6, "xor eax, 0x42c0b170"},
+	{true, 5, "xor eax, 0x42c0b170"},
+	{true, 2, "jo 0x0000000000000fb3"},
+	{true, 2, "mov cl, 0xc0"},
+	{true, 4, "rol byte ptr [rdx+39], 0x9b"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "wait"},
+	{true, 2, "and al, 122"},
+	{true, 2, "jp 0x0000000000000fb9"},
+	{true, 2, "mov bh, 4"},
+	{true, 2, "add al, 32"},
+	{true, 6, "and byte ptr [rdi+0x62363305], al"},
+	{true, 6, "xchg eax, dword ptr [rip+0x49623633]"},
+	{true, 5, "add eax, 0x49623633"},
+	{true, 2, "xor esi, dword ptr [rsi]"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "xchg r15, rax"},
+	{true, 1, "xchg edi, eax"},
+	{false, 1, 0},
+	{true, 5, "xor eax, 0x12dd978d"},
+	{true, 6, "lea edx, [rdi+0x16e412dd]"},
+	{true, 1, "xchg edi, eax"},
+	{true, 2, "fst qword ptr [rdx]"},
+	{true, 2, "adc ah, ah"},
+	{true, 2, "in al, 22"},
+	{false, 1, 0},
+	{true, 2, "in eax, 86"},
+	{true, 1, "push rsi"},
+	{true, 3, "imul ecx, eax, 0xef"},
+	{true, 4, "enter 0xffffffffffffdbef, 1"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "fild dword ptr [rcx]"},
+	{true, 2, "add dword ptr [rdi], esi"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 2, "loope 0x0000000000000fc8"},
+	{false, 2, 0},
+	{true, 1, "xchg esp, eax"},
+	{true, 5, "sbb eax, 0xffffffff873e54ba"},
+	{true, 5, "mov edx, 0x37873e54"},
+	{true, 1, "push rsp"},
+	{true, 3, "xchg esi, dword ptr ds:[rdi]"},
+	{true, 2, "xchg esi, dword ptr [rdi]"},
+	{false, 1, 0},
+	{true, 8, "rcl byte ptr [rsi*2+0x047b4fd5], 0xa7"},
+	{true, 2, "adc al, 117"},
+	{true, 2, "jnz 0x0000000000000fd7"},
+	{false, 1, 0},
+	{true, 3, "jnp 0x0000000000001007"},
+	{true, 2, "jnp 0x0000000000001006"},
+	{true, 2, "add al, 0xa7"},
+	{true, 1, "cmpsd"},
+	{true, 1, "clc"},
+	{true, 3, "jcez 0x0000000000001006"},
+	{true, 2, "jcez 0x0000000000001005"},
+	{true, 6, "add ebx, dword ptr [rsi+0x0aecf5c8]"},
+	{true, 1, "sahf"},
+	{true, 4, "enter 0xffffffffffffecf5, 10"},
+	{true, 1, "cmc"},
+	{true, 1, "in al, dx"},
+	{true, 2, "or dl, byte ptr [rbx]"},
+	{true, 6, "adc ebp, dword ptr [rdx+0x1d0eaa43]"},
+	{true, 1, "stosb"},
+	{true, 2, "stosb"},
+	{true, 1, "stosb"},
+	{false, 1, 0},
+	{true, 5, "sbb eax, 0xffffffffedc00bac"},
+	{true, 1, "lodsb"},
+	{true, 2, "or eax, eax"},
+	{true, 3, "shr ch, 65"},
+	{true, 1, "in eax, dx"},
+	{true, 7, "sbb byte ptr [r15+0x7f10f9dd], dil"},
+	{true, 6, "sbb byte ptr [rdi+0x7f10f9dd], bh"},
+	{true, 5, "mov edi, 0x7f10f9dd"},
+	{false, 2, 0},
+	{true, 1, "stc"},
+	{true, 3, "adc byte ptr [rdi+43], bh"},
+	{true, 2, "jnle 0x000000000000102d"},
+	{true, 2, "sub edx, edi"},
+	{true, 1, "xlat"},
+	{true, 2, "pop rsp"},
+	{true, 1, "pop rsp"},
+	{true, 2, "mov cl, 0xd2"},
+	{true, 6, "shl byte ptr [rsi+0xffffffffd987bc65], cl"},
+	{true, 1, "cmpsb"},
+	{true, 6, "mov esp, 0xffffffffafeed987"},
+	{true, 5, "mov esp, 0xffffffffafeed987"},
+	{true, 2, "xchg ebx, ecx"},
+	{true, 2, "fldz"},
+	{true, 1, "out dx, al"},
+	{true, 1, "scasd"},
+	{true, 5, "mov eax, dword ptr [0x0458d459]"},
+	{true, 1, "pop rcx"},
+	{false, 1, 0},
+	{true, 1, "pop rax"},
+	{true, 2, "add al, 34"},
+	{true, 6, "and cl, byte ptr [rsi+0xfffffffff930bc0e]"},
+	{true, 2, "mov cs, word ptr [rsi]"},
+	{false, 1, 0},
+	{true, 5, "mov esp, 0xffffffffa98ff930"},
+	{true, 2, "xor cl, bh"},
+	{true, 1, "stc"},
+	{false, 2, 0},
+	{true, 5, "test eax, 0xffffffffe69be0b9"},
+	{true, 5, "mov ecx, 0x2de69be0"},
+	{true, 2, "loopne 0x0000000000000f9d"},
+	{true, 1, "wait"},
+	{true, 2, "out 45, al"},
+	{true, 5, "sub eax, 0xffffffffeefe4f4c"},
+	{false, 2, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 1, "out dx, al"},
+	{true, 1, "xchg ecx, eax"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "iret"},
+	{true, 5, "adc eax, 0xffffffffdf4e3863"},
+	{true, 2, "movsxd edi, dword ptr [rax]"},
+	{true, 3, "cmp byte ptr [rsi-33], cl"},
+	{true, 7, "fisttp word ptr [rsi+0xfffffffff0e3918c]"},
+	{true, 6, "fisttp word ptr [rsi+0xfffffffff0e3918c]"},
+	{true, 7, "mov cs, word ptr [rcx+rdx*4+0x23b7f0e3]"},
+	{true, 6, "mov dword ptr [rcx+0x23b7f0e3], ss"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "jcez 0x0000000000000ff2"},
+	{true, 3, "lock mov bh, 35"},
+	{true, 2, "mov bh, 35"},
+	{true, 2, "and edx, dword ptr [rax]"},
+	{true, 2, "adc byte ptr [rdi], bl"},
+	{false, 1, 0},
+	{true, 3, "sub dword ptr [rbx+21], ebp"},
+	{true, 7, "imul edx, dword ptr [rip+0xfffffffff7f088f8], 56"},
+	{true, 5, "adc eax, 0xfffffffff7f088f8"},
+	{true, 1, "clc"},
+	{true, 2, "mov al, dh"},
+	{true, 3, "lock idiv dword ptr [rax]"},
+	{true, 2, "idiv dword ptr [rax]"},
+	{true, 2, "cmp byte ptr [rsi], dl"},
+	{false, 1, 0},
+	{true, 2, "push r12"},
+	{true, 1, "push rsp"},
+	{false, 2, 0},
+	{true, 2, "loop 0x0000000000000ff9"},
+	{true, 4, "div dword ptr [rbx+rsi-78]"},
+	{true, 2, "jz 0x0000000000001035"},
+	{true, 6, "xor esi, dword ptr [rdx+0xffffffffacce15ab]"},
+	{true, 2, "mov dl, 0xab"},
+	{true, 1, "stosd"},
+	{true, 5, "adc eax, 0xfffffffff3b5acce"},
+	{false, 1, 0},
+	{true, 1, "lodsb"},
+	{true, 2, "mov ch, 0xf3"},
+	{true, 3, "rep or dh, al"},
+	{true, 2, "or dh, al"},
+	{false, 2, 0},
+	{true, 2, "jmp 0x000000000000101b"},
+	{true, 3, "sbb dword ptr [rbx-13], ebp"},
+	{true, 3, "imul esi, ebx, 99"},
+	{true, 3, "rep movsxd ebp, edx"},
+	{true, 2, "movsxd ebp, edx"},
+	{false, 1, 0},
+	{true, 1, "retf"},
+	{true, 2, "or esi, ebp"},
+	{true, 1, "cmc"},
+	{true, 1, "out dx, al"},
+	{true, 3, "and dh, byte ptr [rsi+117]"},
+	{true, 2, "jbe 0x0000000000001077"},
+	{true, 2, "jnz 0x0000000000001060"},
+	{true, 1, "pop rsi"},
+	{true, 2, "sub al, 0xa0"},
+	{true, 5, "mov al, byte ptr [0x1dc26ead]"},
+	{true, 1, "lodsd"},
+	{true, 1, "outsb"},
+	{true, 3, "ret 0x1d1d"},
+	{true, 5, "sbb eax, 0xffffffff97f85d1d"},
+	{true, 5, "sbb eax, 0x7297f85d"},
+	{true, 1, "pop rbp"},
+	{true, 1, "clc"},
+	{true, 1, "xchg edi, eax"},
+	{true, 2, "jb 0x000000000000103f"},
+	{true, 5, "cmp eax, 0xffffffff82c67bf5"},
+	{true, 1, "cmc"},
+	{true, 2, "jnp 0x0000000000000fc8"},
+	{true, 7, "mov byte ptr [rdx+0x4d9d6795], 0xc0"},
+	{false, 1, 0},
+	{true, 1, "xchg ebp, eax"},
+	{true, 2, "popfd"},
+	{true, 1, "popfd"},
+	{true, 5, "rcl byte ptr [r10-101], 118"},
+	{true, 4, "rcl byte ptr [rdx-101], 118"},
+	{true, 1, "push rdx"},
+	{true, 1, "wait"},
+	{true, 2, "jbe 0x0000000000000f8a"},
+	{true, 3, "mov byte ptr [rcx+7], bh"},
+	{true, 2, "jns 0x0000000000001009"},
+	{false, 1, 0},
+	{true, 1, "pop rbx"},
+	{true, 5, "add eax, 0xfffffffff06c000d"},
+	{true, 5, "or eax, 0xffffffff9ef06c00"},
+	{true, 4, "add byte ptr [rax+rsi*8-98], ch"},
+	{true, 1, "insb"},
+	{true, 2, "lock sahf"},
+	{true, 1, "sahf"},
+	{true, 7, "xor dword ptr [rdx+2], 0x0aa21645"},
+	{true, 2, "jb 0x0000000000001004"},
+	{true, 3, "add al, byte ptr [rbp+22]"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 5, "mov byte ptr [0x655b940a], al"},
+	{true, 7, "or dl, byte ptr [rbx+rbx*2+0x3a3ed165]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "pop rbx"},
+	{true, 3, "sar dword ptr gs:[rsi], 1"},
+	{true, 2, "sar dword ptr [rsi], 1"},
+	{true, 3, "cmp ah, ch"},
+	{true, 2, "cmp ah, ch"},
+	{true, 2, "in eax, 0xad"},
+	{true, 1, "lodsd"},
+	{true, 2, "xchg esp, eax"},
+	{true, 2, "loopne 0x0000000000001059"},
+	{true, 1, "push rdi"},
+	{true, 2, "out 106, eax"},
+	{true, 2, "push 0x84"},
+	{true, 2, "test byte ptr [rbx], cl"},
+	{true, 2, "or ecx, esi"},
+	{false, 1, 0},
+	{true, 2, "mov edi, ss"},
+	{true, 1, "xlat"},
+	{true, 5, "xor eax, 0x7949e398"},
+	{true, 1, "cwde"},
+	{true, 2, "jcez 0x000000000000104b"},
+	{true, 3, "jns 0x0000000000000fff"},
+	{true, 2, "jns 0x0000000000000ffe"},
+	{true, 1, "cld"},
+	{true, 5, "and eax, 0xfffffffff38f3802"},
+	{true, 2, "add bh, byte ptr [rax]"},
+	{true, 6, "cmp byte ptr [rdi+0xffffffffe29d9bf3], cl"},
+	{false, 2, 0},
+	{true, 2, "rep wait"},
+	{true, 1, "wait"},
+	{true, 1, "popfd"},
+	{true, 2, "loop 0x0000000000000fc4"},
+	{true, 3, "ret 0x65a0"},
+	{true, 5, "mov al, byte ptr [0xffffffffc78d5965]"},
+	{true, 2, "pop rcx"},
+	{true, 1, "pop rcx"},
+	{true, 2, "lea eax, (invalid)"},
+	{false, 2, 0},
+	{true, 2, "jb 0x0000000000000fcc"},
+	{true, 3, "retf 0xffffffffffffed3d"},
+	{true, 5, "cmp eax, 0xffffffffd3d90fed"},
+	{true, 1, "in eax, dx"},
+	{true, 3, "psubusw mm2, mm3"},
+	{false, 2, 0},
+	{true, 2, "rcl esp, cl"},
+	{false, 1, 0},
+	{true, 2, "add dword ptr [rsi], edx"},
+	{false, 1, 0},
+	{true, 1, "pop rbx"},
+	{true, 1, "sahf"},
+	{true, 1, "push rdx"},
+	{true, 6, "rcl dword ptr [rcx+0x50c6dd08], cl"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "or ch, bl"},
+	{true, 2, "ffree st(6)"},
+	{false, 2, 0},
+	{true, 1, "push rax"},
+	{true, 5, "push 0x65be6498"},
+	{true, 1, "cwde"},
+	{true, 6, "mov esi, 0x39f8a465"},
+	{true, 5, "mov esi, 0x39f8a465"},
+	{true, 2, "movsb"},
+	{true, 1, "movsb"},
+	{true, 1, "clc"},
+	{true, 3, "cmp dword ptr [rax+22], edi"},
+	{true, 2, "js 0x0000000000001018"},
+	{false, 1, 0},
+	{true, 2, "test dword ptr [rax], eax"},
+	{true, 6, "add byte ptr [rip+0xfffffffffaa26183], ah"},
+	{true, 5, "and eax, 0xfffffffffaa26183"},
+	{true, 4, "and dword ptr [rcx-94], 0xfa"},
+	{false, 1, 0},
+	{true, 5, "mov byte ptr [0x278e4efa], al"},
+	{true, 1, "cli"},
+	{true, 3, "mov cr4, word ptr [rdi]"},
+	{true, 2, "mov fs, word ptr [rdi]"},
+	{false, 1, 0},
+	{true, 3, "mov cl, 0xd7"},
+	{true, 2, "mov cl, 0xd7"},
+	{true, 1, "xlat"},
+	{true, 7, "call qword ptr [rsp+rcx*4+0xfffffffff0f5aeaf]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 6, "mov dword ptr [rdi+0xffffffffc9f0f5ae], gs"},
+	{true, 1, "scasd"},
+	{true, 1, "scasb"},
+	{true, 1, "cmc"},
+	{true, 2, "lock leave"},
+	{true, 1, "leave"},
+	{true, 5, "xor eax, 0x3f766bea"},
+	{false, 1, 0},
+	{true, 4, "imul esi, dword ptr [rsi+63], 42"},
+	{true, 2, "jbe 0x0000000000001041"},
+	{false, 1, 0},
+	{true, 2, "sub dl, byte ptr [rcx]"},
+	{true, 2, "adc ebx, eax"},
+	{true, 1, "ret"},
+	{true, 2, "adc dword ptr [rdx], ebx"},
+	{true, 3, "sbb cl, byte ptr [rdi+78]"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "outsd"},
+	{true, 1, "in al, dx"},
+	{true, 2, "int 64"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "std"},
+	{true, 1, "cld"},
+	{true, 3, "mov dword ptr [rcx-119], seg7"},
+	{true, 2, "jno 0x0000000000000f8b"},
+	{true, 6, "mov dword ptr [rax+0xffffffffd323baf1], edx"},
+	{true, 1, "nop"},
+	{false, 1, 0},
+	{true, 5, "mov edx, 0x0bc8d323"},
+	{true, 2, "and edx, ebx"},
+	{true, 2, "ror eax, cl"},
+	{true, 4, "enter 0x7a0b, 0xed"},
+	{true, 3, "or edi, dword ptr [rdx-19]"},
+	{true, 2, "jp 0x0000000000000fef"},
+	{true, 1, "in eax, dx"},
+	{true, 3, "ret 0xffffffffffffbf87"},
+	{true, 6, "xchg edi, dword ptr [rdi+0xffffffffbb3ba30e]"},
+	{true, 5, "mov edi, 0xffffffffbb3ba30e"},
+	{false, 1, 0},
+	{true, 5, "mov dword ptr [0xffffffffc061bb3b], eax"},
+	{true, 6, "cmp edi, dword ptr [rbx+0xfffffffface8c061]"},
+	{true, 5, "mov ebx, 0xfffffffface8c061"},
+	{false, 1, 0},
+	{true, 3, "shr al, 0xac"},
+	{true, 5, "call 0xffffffff8e39c0b1"},
+	{true, 1, "lodsb"},
+	{true, 2, "mov al, 57"},
+	{true, 6, "cmp dword ptr [rsi+0xffffffffbdf7d7e3], ecx"},
+	{true, 2, "mov fs, bx"},
+	{true, 2, "jcez 0x0000000000000fd9"},
+	{true, 1, "xlat"},
+	{true, 6, "idiv dword ptr [rbp+0xffffffff9b64ea1e]"},
+	{true, 5, "mov ebp, 0xffffffff9b64ea1e"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 2, "wait"},
+	{true, 1, "wait"},
+	{true, 1, "cmpsb"},
+	{true, 2, "in eax, dx"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "mov ah, 40"},
+	{true, 6, "sub byte ptr [rax+0xffffffff8f548539], bl"},
+	{true, 1, "cwde"},
+	{true, 6, "cmp dword ptr [rbp+0xffffffffc6268f54], eax"},
+	{true, 4, "test dword ptr [rdi+rcx*4+38], edx"},
+	{true, 1, "push rsp"},
+	{false, 2, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "ret"},
+	{true, 3, "mov byte ptr [rbx+89], bh"},
+	{true, 2, "jnp 0x000000000000105b"},
+	{true, 1, "pop rcx"},
+	{true, 6, "mov al, byte ptr [0x5e1e96b9]"},
+	{true, 5, "mov al, byte ptr [0x5e1e96b9]"},
+	{true, 5, "mov ecx, 0x395e1e96"},
+	{true, 1, "xchg esi, eax"},
+	{false, 1, 0},
+	{true, 1, "pop rsi"},
+	{true, 7, "cmp dword ptr [rax+rbx*8+0xffffffff8bea9e57], edi"},
+	{true, 5, "mov esp, 0xffffffffea9e57d8"},
+	{true, 3, "fcom dword ptr [rdi-98]"},
+	{true, 1, "push rdi"},
+	{true, 1, "sahf"},
+	{false, 1, 0},
+	{true, 7, "mov eax, dword ptr [rsi+rax*4+0x52c0d8a3]"},
+	{true, 6, "test byte ptr [rsi+0x52c0d8a3], al"},
+	{true, 6, "xchg ah, byte ptr [rbx+0xffffffffb552c0d8]"},
+	{true, 5, "mov dword ptr [0xffffffffb552c0d8], eax"},
+	{true, 2, "fadd st, st(0)"},
+	{true, 4, "rcl byte ptr [rdx-75], 0x95"},
+	{true, 1, "push rdx"},
+	{true, 2, "mov ch, 0x95"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 6, "add byte ptr [rsi+0xffffffffff4f34cc], dh"},
+	{true, 2, "mov dh, 0xcc"},
+	{true, 1, "int3"},
+	{true, 2, "xor al, 79"},
+	{true, 3, "call r13"},
+	{true, 2, "call rbp"},
+	{false, 1, 0},
+	{true, 1, "cmc"},
+	{true, 1, "xchg ecx, eax"},
+	{false, 1, 0},
+	{true, 2, "adc al, 0xcc"},
+	{true, 1, "int3"},
+	{true, 1, "hlt"},
+	{false, 1, 0},
+	{true, 2, "add al, 16"},
+	{true, 6, "adc byte ptr [rip+0xffffffff98e8f2c6], dh"},
+	{true, 5, "xor eax, 0xffffffff98e8f2c6"},
+	{false, 2, 0},
+	{true, 6, "repne call 0x000000007558759e"},
+	{true, 5, "call 0x000000007558759d"},
+	{true, 1, "cwde"},
+	{true, 2, "pop rax"},
+	{true, 1, "pop rax"},
+	{true, 2, "jnz 0x0000000000000fa6"},
+	{true, 1, "movsb"},
+	{true, 2, "mov bh, dl"},
+	{true, 1, "cli"},
+	{true, 5, "mov edi, 0x61c26da2"},
+	{true, 5, "mov byte ptr [0xffffffffd461c26d], al"},
+	{true, 1, "insd"},
+	{true, 3, "ret 0xffffffffffffd461"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 4, "neg byte ptr [rsp+rsi*8+118]"},
+	{true, 1, "pop rsp"},
+	{true, 1, "hlt"},
+	{true, 2, "jbe 0x000000000000100c"},
+	{true, 6, "or dl, byte ptr [rcx+0x6499763d]"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 5, "cmp eax, 0x16649976"},
+	{true, 2, "jbe 0x0000000000000f9b"},
+	{true, 1, "cdq"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "repne out dx, eax"},
+	{true, 2, "out dx, eax"},
+	{true, 1, "out dx, eax"},
+	{true, 5, "sbb eax, 0x1efa8f75"},
+	{true, 2, "jnz 0x0000000000000f91"},
+	{false, 2, 0},
+	{true, 1, "cli"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 3, "jl 0x0000000000001002"},
+	{true, 2, "jl 0x0000000000001001"},
+	{true, 2, "jmp qword ptr [rdx]"},
+	{true, 2, "and dh, bl"},
+	{true, 2, "rep retf"},
+	{true, 1, "retf"},
+	{true, 3, "fisttp dword ptr [rax-107]"},
+	{true, 2, "xchg rbp, rax"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 1, "outsd"},
+	{true, 1, "popfd"},
+	{true, 2, "jl 0x0000000000000fe9"},
+	{true, 2, "out 0xd1, eax"},
+	{true, 2, "rol eax, 1"},
+	{true, 5, "shl byte ptr [rbx+rsi-18], 40"},
+	{true, 3, "xor ebp, esi"},
+	{true, 2, "xor ebp, esi"},
+	{true, 1, "out dx, al"},
+	{true, 2, "sub dl, al"},
+	{true, 3, "ret 0xffffffffffffd339"},
+	{true, 2, "cmp ebx, edx"},
+	{true, 2, "shr esi, cl"},
+	{true, 1, "out dx, al"},
+	{true, 3, "fstp st(0)"},
+	{true, 2, "fstp st(0)"},
+	{true, 2, "fsubr st, st(3)"},
+	{true, 2, "jmp 0x0000000000001051"},
+	{true, 2, "xchg r11, rax"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "pushfd"},
+	{false, 1, 0},
+	{true, 1, "sti"},
+	{true, 2, "xchg al, ah"},
+	{false, 1, 0},
+	{true, 2, "xchg esp, eax"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "mov esi, dword ptr [rdx+118]"},
+	{true, 2, "jb 0x0000000000001078"},
+	{true, 2, "jbe 0x0000000000001041"},
+	{false, 1, 0},
+	{true, 1, "leave"},
+	{true, 3, "xchg eax, dword ptr [rdx]"},
+	{true, 2, "add al, 0xa2"},
+	{true, 5, "mov byte ptr [0x45f79924], al"},
+	{true, 2, "and al, 0x99"},
+	{true, 1, "cdq"},
+	{true, 7, "test dword ptr [rbp+110], 0x4da62cb3"},
+	{true, 2, "outsb"},
+	{true, 1, "outsb"},
+	{true, 2, "mov bl, 44"},
+	{true, 2, "sub al, 0xa6"},
+	{true, 1, "cmpsb"},
+	{true, 2, "iretq"},
+	{true, 1, "iret"},
+	{true, 2, "adc byte ptr [rcx], bl"},
+	{true, 2, "sbb edx, ebp"},
+	{false, 1, 0},
+	{true, 2, "adc al, 50"},
+	{true, 3, "xor ah, byte ptr [rsi+94]"},
+	{true, 2, "pop rsi"},
+	{true, 1, "pop rsi"},
+	{true, 6, "rcl byte ptr [rax+0xffffffff9d34dd21], 1"},
+	{true, 1, "nop"},
+	{true, 2, "and ebp, ebx"},
+	{true, 7, "fnsave [rbx*4+0x15d1a0c7]"},
+	{true, 2, "xor al, 0x9d"},
+	{true, 1, "popfd"},
+	{false, 2, 0},
+	{true, 5, "mov al, byte ptr [0xffffffff949d15d1]"},
+	{true, 6, "rcl dword ptr [rip+0xffffffff81d6949d], 1"},
+	{true, 5, "adc eax, 0xffffffff81d6949d"},
+	{true, 1, "popfd"},
+	{true, 1, "xchg esp, eax"},
+	{false, 1, 0},
+	{true, 7, "or dword ptr [rcx-60], 0xffffffff872d8906"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 6, "mov dword ptr [rip+0xffffffff87fd7c87], ebp"},
+	{true, 5, "sub eax, 0xffffffff87fd7c87"},
+	{true, 4, "xchg edi, dword ptr [rbp+rdi*8-121]"},
+	{true, 2, "jl 0x0000000000000fff"},
+	{true, 1, "std"},
+	{true, 3, "xchg ebp, dword ptr [rcx+31]"},
+	{true, 6, "imul ebx, dword ptr [rdi], 0xffffffffe3da49a2"},
+	{false, 1, 0},
+	{true, 5, "mov byte ptr [0xffffffffbce3da49], al"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "jcez 0x0000000000000fbe"},
+	{true, 5, "mov esp, 0x60c499b9"},
+	{true, 5, "mov ecx, 0xffffffffc960c499"},
+	{true, 1, "cdq"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 1, "leave"},
+	{true, 6, "fiadd word ptr [rbx+0x1f4a3476]"},
+	{true, 4, "xor dword ptr [rsi+52], 74"},
+	{true, 2, "jbe 0x0000000000001036"},
+	{true, 2, "xor al, 74"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "nop"},
+	{true, 1, "pop rbp"},
+	{false, 2, 0},
+	{true, 3, "adc ch, byte ptr [rsi-25]"},
+	{true, 1, "outsb"},
+	{true, 2, "out 0xdf, eax"},
+	{true, 3, "fist word ptr [rcx+77]"},
+	{true, 1, "push rcx"},
+	{true, 3, "adc r10, qword ptr [r14]"},
+	{true, 2, "adc edx, dword ptr [rsi]"},
+	{false, 1, 0},
+	{true, 2, "add esp, esi"},
+	{true, 1, "hlt"},
+	{true, 6, "frstor [rsi+0x46d67cf9]"},
+	{true, 1, "cmpsb"},
+	{true, 1, "stc"},
+	{true, 2, "jl 0x0000000000000fd8"},
+	{false, 1, 0},
+	{true, 2, "sti"},
+	{true, 1, "sti"},
+	{true, 2, "loop 0x0000000000000fc2"},
+	{true, 4, "rcr byte ptr [rdx-78], 78"},
+	{true, 1, "pop rdx"},
+	{true, 2, "mov dl, 78"},
+	{true, 3, "jmp 0x0000000000001024"},
+	{true, 2, "jmp 0x0000000000001023"},
+	{true, 3, "and dword ptr [rbx+32], ebp"},
+	{true, 3, "imul esp, dword ptr [rax], 82"},
+	{true, 3, "and byte ptr [rdx-96], dl"},
+	{true, 1, "push rdx"},
+	{true, 5, "mov al, byte ptr [0x5274c093]"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 5, "sal byte ptr [rdx+rdx*2-11], 34"},
+	{true, 2, "jz 0x0000000000001054"},
+	{true, 1, "push rdx"},
+	{true, 1, "cmc"},
+	{true, 2, "and dh, ah"},
+	{true, 1, "hlt"},
+	{true, 6, "mov dword ptr [rax+0xfffffffff9b2f01b], seg7"},
+	{true, 2, "mov al, 27"},
+	{true, 2, "sbb esi, eax"},
+	{true, 3, "lock mov dl, 0xf9"},
+	{true, 2, "mov dl, 0xf9"},
+	{true, 1, "stc"},
+	{true, 4, "and dword ptr [esi+edx*4], ebx"},
+	{true, 3, "and dword ptr [rsi+rdx*4], ebx"},
+	{true, 2, "sbb al, 0x96"},
+	{true, 1, "xchg esi, eax"},
+	{true, 2, "jbe 0x0000000000000fb9"},
+	{true, 2, "mov bh, 0xc5"},
+	{false, 1, 0},
+	{true, 5, "adc eax, 0xffffffffd0b9f2fb"},
+	{true, 1, "sti"},
+	{true, 6, "repne mov ecx, 0x3d8032d0"},
+	{true, 5, "mov ecx, 0x3d8032d0"},
+	{true, 2, "sal byte ptr [rdx], 1"},
+	{true, 6, "xor al, byte ptr [rax+0xffffffff9af3a23d]"},
+	{true, 7, "cmp byte ptr [rip+0xffffffffbb9af3a2], 103"},
+	{true, 5, "cmp eax, 0xffffffffbb9af3a2"},
+	{true, 5, "mov byte ptr [0x67bb9af3], al"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 5, "mov ebx, 0x74dc7b67"},
+	{true, 3, "jnp 0x0000000000000fdf"},
+	{true, 2, "jnp 0x0000000000000fde"},
+	{true, 4, "fdiv qword ptr [rbp+rsi-10]"},
+	{true, 2, "jz 0x0000000000001037"},
+	{true, 5, "xor eax, 0x5ce4e8f6"},
+	{true, 2, "imul al"},
+	{true, 5, "call 0xffffffffbbcc6ce9"},
+	{true, 2, "in al, 92"},
+	{true, 1, "pop rsp"},
+	{true, 1, "int3"},
+	{true, 5, "mov ebx, 0xffffffffcab01ef4"},
+	{true, 1, "hlt"},
+	{false, 1, 0},
+	{true, 2, "mov al, 0xca"},
+	{true, 3, "retf 0x2ee2"},
+	{true, 2, "loop 0x0000000000001030"},
+	{true, 7, "imul esp, esp, 0xffffffffc75eeaf1"},
+	{true, 6, "imul esp, esp, 0xffffffffc75eeaf1"},
+	{true, 2, "in al, 0xf1"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 1, "pop rsi"},
+	{false, 2, 0},
+	{true, 3, "rcr byte ptr [rax-28], 1"},
+	{true, 1, "pop rax"},
+	{true, 2, "in al, 127"},
+	{true, 2, "jnle 0x0000000000000fcd"},
+	{true, 1, "retf"},
+	{true, 2, "loop 0x000000000000104a"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "mov bl, 0xd1"},
+	{true, 6, "rcr dword ptr [rbx+0x408b8e8d], 1"},
+	{true, 1, "wait"},
+	{true, 6, "lea ecx, [rsi+0xffffffffff3d408b]"},
+	{true, 6, "mov cs, word ptr [rbx+0xffffffff8cff3d40]"},
+	{true, 3, "mov eax, dword ptr [rax+61]"},
+	{true, 6, "cmp eax, 0x6c368cff"},
+	{true, 5, "cmp eax, 0x6c368cff"},
+	{true, 7, "dec dword ptr [rsi+rsi+0x2626746c]"},
+	{true, 2, "mov dword ptr [rsi], seg7"},
+	{true, 2, "insb"},
+	{true, 1, "insb"},
+	{true, 2, "jz 0x0000000000001028"},
+	{true, 3, "push rcx"},
+	{true, 2, "push rcx"},
+	{true, 1, "push rcx"},
+	{true, 2, "adc ecx, edi"},
+	{true, 1, "stc"},
+	{true, 2, "sub al, 86"},
+	{true, 1, "push rsi"},
+	{false, 1, 0},
+	{true, 3, "xor byte ptr [rbp-72], ah"},
+	{true, 6, "mov eax, 0xffffffffe13d80b5"},
+	{true, 5, "mov eax, 0xffffffffe13d80b5"},
+	{true, 2, "mov ch, 0x80"},
+	{true, 7, "cmp byte ptr [rip+0x76e162e1], 0x85"},
+	{true, 5, "cmp eax, 0x76e162e1"},
+	{true, 2, "loope 0x0000000000001064"},
+	{false, 1, 0},
+	{true, 2, "loope 0x0000000000001078"},
+	{true, 2, "jbe 0x0000000000000f87"},
+	{true, 6, "test dword ptr [rax+0x387ef70b], esp"},
+	{true, 5, "mov al, byte ptr [0x387ef70b]"},
+	{true, 2, "or esi, edi"},
+	{true, 3, "idiv dword ptr [rsi+56]"},
+	{true, 2, "jle 0x000000000000103a"},
+	{true, 6, "cmp byte ptr [rdi+0x7af4685a], ch"},
+	{true, 1, "scasd"},
+	{true, 1, "pop rdx"},
+	{true, 5, "push 0xfffffffffc337af4"},
+	{true, 1, "hlt"},
+	{true, 2, "jp 0x0000000000001035"},
+	{true, 2, "xor edi, esp"},
+	{true, 1, "cld"},
+	{true, 1, "leave"},
+	{true, 1, "retf"},
+	{true, 6, "and dword ptr [rip+0x04972ec1], ebp"},
+	{true, 5, "sub eax, 0x04972ec1"},
+	{true, 3, "shr dword ptr [rsi], 0x97"},
+	{true, 2, "xchg edi, eax"},
+	{true, 1, "xchg edi, eax"},
+	{true, 2, "add al, 0xaa"},
+	{true, 1, "stosb"},
+	{true, 5, "mov al, byte ptr [0xffffffff82813c68]"},
+	{true, 5, "push 0x1482813c"},
+	{true, 2, "cmp al, 0x81"},
+	{true, 10, "add dword ptr [rdx+0x599b9d14], 0x4b9919d4"},
+	{false, 1, 0},
+	{true, 2, "adc al, 0x9d"},
+	{true, 1, "popfd"},
+	{true, 1, "wait"},
+	{true, 1, "pop rcx"},
+	{false, 1, 0},
+	{true, 6, "sbb dword ptr [rcx+0x09a8674b], ebx"},
+	{true, 1, "cdq"},
+	{false, 2, 0},
+	{true, 3, "test al, 9"},
+	{true, 2, "test al, 9"},
+	{true, 3, "or dword ptr [rcx-101], ebx"},
+	{true, 1, "pop rcx"},
+	{true, 1, "wait"},
+	{true, 2, "jcez 0x0000000000000fde"},
+	{true, 3, "fcomp qword ptr [rbp-102]"},
+	{true, 1, "pop rbp"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 2, "mov ebx, es"},
+	{true, 1, "ret"},
+	{true, 1, "cli"},
+	{true, 1, "xlat"},
+	{true, 2, "or al, byte ptr [rdi]"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 2, "out 104, eax"},
+	{true, 5, "push 0x4bccbdf2"},
+	{true, 6, "repne mov ebp, 0x41944bcc"},
+	{true, 5, "mov ebp, 0x41944bcc"},
+	{true, 1, "int3"},
+	{true, 2, "xchg r12, rax"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "stosd"},
+	{true, 1, "stosd"},
+	{false, 1, 0},
+	{true, 7, "add byte ptr [rsi+rsi*4+0x01c3cab7], bh"},
+	{true, 5, "mov esp, 0xffffffffc3cab7b6"},
+	{true, 2, "mov dh, 0xb7"},
+	{true, 2, "mov bh, 0xca"},
+	{true, 3, "retf 0x01c3"},
+	{true, 1, "ret"},
+	{true, 6, "add dword ptr [rdx+0xffffffffcf255b41], ebx"},
+	{false, 1, 0},
+	{true, 2, "pop r11"},
+	{true, 1, "pop rbx"},
+	{true, 5, "and eax, 0xffffffff97436dcf"},
+	{true, 1, "iret"},
+	{true, 1, "insd"},
+	{true, 2, "xchg r15d, eax"},
+	{true, 1, "xchg edi, eax"},
+	{true, 1, "push rbp"},
+	{true, 6, "mov dword ptr [rdi], 0xffffffffc6bb03c6"},
+	{false, 1, 0},
+	{true, 3, "mov byte ptr [rbx], 0xbb"},
+	{true, 6, "add edi, dword ptr [rbx+0xffffffffde32f6c6]"},
+	{true, 5, "mov ebx, 0xffffffffde32f6c6"},
+	{false, 2, 0},
+	{true, 2, "div byte ptr [rdx]"},
+	{true, 2, "xor bl, dh"},
+	{true, 6, "fidivr word ptr [rsi+0xffffffff9cef2cdf]"},
+	{true, 5, "mov esi, 0xffffffff9cef2cdf"},
+	{true, 3, "fild qword ptr [rdi+rbp*8]"},
+	{true, 2, "sub al, 0xef"},
+	{true, 1, "out dx, eax"},
+	{true, 1, "pushfd"},
+	{true, 2, "add al, 83"},
+	{true, 1, "push rbx"},
+	{true, 6, "pop qword ptr [rbp+0xffffffffe4c011d5]"},
+	{true, 2, "test ebp, edx"},
+	{false, 1, 0},
+	{true, 2, "adc eax, eax"},
+	{true, 3, "shl ah, 0x84"},
+	{true, 2, "in al, 0x84"},
+	{true, 6, "test byte ptr [rbx+0xffffffffe5a7f21f], al"},
+	{true, 3, "sbb dword ptr [rdi], 0xf2"},
+	{false, 1, 0},
+	{true, 2, "repne cmpsd"},
+	{true, 1, "cmpsd"},
+	{true, 2, "in eax, 0xe1"},
+	{true, 2, "loope 0x0000000000001008"},
+	{false, 1, 0},
+	{true, 1, "xchg edx, eax"},
+	{true, 5, "mov esp, 0xffffffffc572a28f"},
+	{false, 2, 0},
+	{true, 5, "mov byte ptr [0x3981c572], al"},
+	{true, 2, "jb 0x0000000000000fc7"},
+	{false, 1, 0},
+	{true, 6, "cmp dword ptr [rcx], 0xffffffffc21ca02a"},
+	{true, 2, "cmp dword ptr [rdx], ebp"},
+	{true, 6, "sub ah, byte ptr [rax+0x3cedc21c]"},
+	{true, 5, "mov al, byte ptr [0x3cedc21c]"},
+	{true, 2, "sbb al, 0xc2"},
+	{true, 3, "ret 0x3ced"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "cmp al, 0xcb"},
+	{true, 1, "retf"},
+	{true, 1, "std"},
+	{true, 5, "mov al, byte ptr [0xffffffffed88be01]"},
+	{true, 6, "add dword ptr [rsi+0x65c0ed88], edi"},
+	{true, 5, "mov esi, 0x65c0ed88"},
+	{true, 2, "mov ch, ch"},
+	{true, 1, "in eax, dx"},
+	{true, 4, "shl byte ptr [rbp-95], 39"},
+	{true, 6, "mov eax, dword ptr gs:[0xffffffffb8ab5c27]"},
+	{true, 5, "mov eax, dword ptr [0xffffffffb8ab5c27]"},
+	{false, 1, 0},
+	{true, 1, "pop rsp"},
+	{true, 1, "stosd"},
+	{true, 5, "mov eax, 0xffffffffbcf335e0"},
+	{true, 2, "loopne 0x0000000000001037"},
+	{true, 5, "xor eax, 0x584cbcf3"},
+	{true, 6, "rep mov esp, 0x22d3584c"},
+	{true, 5, "mov esp, 0x22d3584c"},
+	{true, 2, "pop rax"},
+	{true, 1, "pop rax"},
+	{true, 2, "shl dword ptr [rdx], cl"},
+	{true, 4, "and dl, byte ptr [rdi-109]"},
+	{true, 1, "push rsp"},
+	{true, 2, "xchg ebx, eax"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 2, "mov ch, 122"},
+	{true, 2, "jp 0x000000000000104b"},
+	{false, 2, 0},
+	{true, 4, "and dword ptr fs:[rdi-110], ebp"},
+	{true, 3, "and dword ptr [rdi-110], ebp"},
+	{true, 1, "outsd"},
+	{true, 1, "xchg edx, eax"},
+	{false, 1, 0},
+	{true, 5, "cmp eax, 0x1b46b176"},
+	{true, 2, "jbe 0x0000000000000fb3"},
+	{true, 2, "mov cl, 70"},
+	{true, 4, "sbb r14d, dword ptr [rsi-36]"},
+	{true, 3, "sbb esi, dword ptr [rsi-36]"},
+	{true, 2, "jbe 0x0000000000000fde"},
+	{true, 2, "fdivr st(1), st"},
+	{false, 1, 0},
+	{true, 2, "shl edx, 1"},
+	{true, 2, "loop 0x0000000000000fbe"},
+	{true, 5, "mov esp, 0xffffffffd849069d"},
+	{true, 1, "popfd"},
+	{false, 1, 0},
+	{true, 3, "fcomp st(2)"},
+	{true, 2, "fcomp st(2)"},
+	{true, 3, "fidivr dword ptr [rsp+rdi*4]"},
+	{true, 2, "cmp al, 0xbc"},
+	{true, 5, "mov esp, 0xffffffffe3df4cc2"},
+	{true, 3, "ret 0xffffffffffffdf4c"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "jcez 0x0000000000001005"},
+	{true, 2, "add ebp, dword ptr [rax]"},
+	{true, 2, "sub byte ptr [rcx], dl"},
+	{true, 2, "adc esi, ebx"},
+	{true, 2, "faddp st(6), st"},
+	{false, 2, 0},
+	{true, 1, "outsb"},
+	{true, 2, "xor ebx, ebp"},
+	{true, 3, "fisttp qword ptr [rax-26]"},
+	{true, 3, "out 51, al"},
+	{true, 2, "out 51, al"},
+	{true, 3, "xor edi, dword ptr [rsi-5]"},
+	{true, 2, "jle 0x0000000000000ffd"},
+	{true, 1, "sti"},
+	{true, 6, "fstp qword ptr [rax+0x4f9c7dea]"},
+	{true, 1, "cwde"},
+	{false, 1, 0},
+	{true, 2, "jnl 0x0000000000000f9e"},
+	{true, 1, "pushfd"},
+	{true, 2, "lodsq"},
+	{true, 1, "lodsd"},
+	{true, 2, "cmp al, 0xad"},
+	{true, 1, "lodsd"},
+	{true, 3, "xor ebx, dword ptr [rcx-27]"},
+	{true, 1, "pop rcx"},
+	{true, 2, "in eax, 0xcd"},
+	{true, 2, "int 93"},
+	{true, 1, "pop rbp"},
+	{true, 6, "ficom dword ptr [rcx+0xffffffffaf9831b0]"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "mov al, 49"},
+	{true, 6, "xor dword ptr [rax+0x4f2577af], ebx"},
+	{true, 1, "cwde"},
+	{true, 1, "scasd"},
+	{true, 2, "jnbe 0x0000000000001027"},
+	{true, 5, "and eax, 0x50f1af4f"},
+	{true, 2, "scasq"},
+	{true, 1, "scasd"},
+	{false, 1, 0},
+	{true, 1, "push rax"},
+	{true, 1, "scasb"},
+	{true, 2, "jnb 0x0000000000000f97"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 2, "mov bh, 0xb1"},
+	{true, 2, "mov cl, 118"},
+	{true, 2, "jbe 0x000000000000103e"},
+	{true, 2, "cmp al, 86"},
+	{true, 1, "push rsi"},
+	{true, 5, "mov esi, 0xffffffff82f09eba"},
+	{true, 5, "mov edx, 0x7382f09e"},
+	{true, 1, "sahf"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "jnb 0x0000000000000f95"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "xchg esi, eax"},
+	{true, 3, "mov dword ptr [rbp+5], esi"},
+	{true, 2, "jnz 0x0000000000001007"},
+	{true, 5, "add eax, 0xffffffffb85e9ffa"},
+	{true, 1, "cli"},
+	{true, 1, "lahf"},
+	{true, 1, "pop rsi"},
+	{true, 5, "mov eax, 0xffffffffb983ea71"},
+	{true, 2, "jno 0x0000000000000fec"},
+	{false, 1, 0},
+	{true, 7, "cmp dword ptr [rcx+0xffffffffa79cc4c9], 0xd1"},
+	{true, 5, "mov ecx, 0xffffffffa79cc4c9"},
+	{true, 1, "leave"},
+	{false, 1, 0},
+	{true, 1, "pushfd"},
+	{true, 1, "cmpsd"},
+	{true, 3, "rcr dword ptr [rdx+46], 1"},
+	{true, 1, "pop rdx"},
+	{true, 2, "movsd"},
+	{true, 1, "movsd"},
+	{true, 5, "mov eax, dword ptr [0xffffffffad1abc06]"},
+	{false, 1, 0},
+	{true, 5, "mov esp, 0xffffffffac6cad1a"},
+	{true, 6, "sbb ch, byte ptr [rbp+0xffffffff8d2fac6c]"},
+	{true, 1, "lodsd"},
+	{true, 1, "insb"},
+	{true, 1, "lodsb"},
+	{false, 1, 0},
+	{true, 3, "lea edx, [rsi-5]"},
+	{true, 1, "push rsi"},
+	{true, 1, "sti"},
+	{false, 1, 0},
+	{true, 3, "mov dl, byte ptr [rax-96]"},
+	{true, 1, "push rax"},
+	{true, 5, "mov al, byte ptr [0xffffffffc103e8bb]"},
+	{true, 5, "mov ebx, 0x1bc103e8"},
+	{true, 5, "call 0xfffffffff61bd108"},
+	{true, 2, "add eax, ecx"},
+	{true, 3, "rcr dword ptr [rbx], 0xf6"},
+	{true, 2, "sbb esi, esi"},
+	{true, 3, "not byte ptr [rdx-104]"},
+	{true, 1, "push rdx"},
+	{true, 1, "cwde"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 3, "and al, 71"},
+	{true, 2, "and al, 71"},
+	{true, 3, "or r8b, 90"},
+	{true, 2, "or al, 90"},
+	{true, 1, "pop rdx"},
+	{false, 2, 0},
+	{true, 2, "leave"},
+	{true, 1, "leave"},
+	{true, 2, "jnz 0x0000000000001064"},
+	{false, 1, 0},
+	{true, 2, "xor ebp, esi"},
+	{true, 1, "cmc"},
+	{true, 4, "imul ebp, dword ptr [rbx-121], 0xff"},
+	{true, 7, "imul eax, dword ptr [rdi+0xffffffffc06a23ff], 100"},
+	{true, 2, "xchg edi, edi"},
+	{true, 2, "jmp qword ptr [rbx]"},
+	{true, 3, "and ebp, dword ptr [rdx-64]"},
+	{true, 2, "push 0xc0"},
+	{true, 5, "shl byte ptr [rsi+126], 37"},
+	{true, 4, "jle 0x0000000000001029"},
+	{true, 3, "jle 0x0000000000001028"},
+	{true, 2, "jle 0x0000000000001027"},
+	{true, 5, "and eax, 0xffffffff9352fd00"},
+	{true, 2, "add ch, bh"},
+	{true, 1, "std"},
+	{true, 1, "push rdx"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 3, "sbb byte ptr [rdi+7], al"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "mul dword ptr [rbx]"},
+	{true, 7, "and ebx, dword ptr [rdi+rbx*8+0xffffffffaf255b88]"},
+	{true, 1, "pushfd"},
+	{true, 6, "fisttp word ptr [rax+0xffffffffc8af255b]"},
+	{true, 3, "mov byte ptr [rbx+37], bl"},
+	{true, 1, "pop rbx"},
+	{true, 5, "and eax, 0xfffffffff708c8af"},
+	{true, 1, "scasd"},
+	{true, 4, "enter 0xfffffffffffff708, 3"},
+	{true, 2, "or bh, dh"},
+	{true, 6, "test dword ptr [rbx], 0x0e348738"},
+	{true, 2, "add edi, dword ptr [rax]"},
+	{true, 6, "cmp byte ptr [rdi+0x1dde0e34], al"},
+	{true, 3, "xchg esi, dword ptr [rsi+rcx]"},
+	{true, 2, "xor al, 14"},
+	{false, 1, 0},
+	{true, 6, "ficomp word ptr [rip+0x7e7758e0]"},
+	{true, 5, "sbb eax, 0x7e7758e0"},
+	{true, 2, "loopne 0x000000000000105a"},
+	{true, 1, "pop rax"},
+	{true, 2, "jnbe 0x0000000000001080"},
+	{true, 2, "jle 0x0000000000000f86"},
+	{true, 2, "test byte ptr [rsi], ah"},
+	{true, 3, "jl 0x000000000000101e"},
+	{true, 2, "jl 0x000000000000101d"},
+	{true, 6, "sbb eax, dword ptr [rbp+0x412fd7a8]"},
+	{true, 6, "test dword ptr [rax+0xffffffffe5412fd7], ebp"},
+	{true, 2, "test al, 0xd7"},
+	{true, 1, "xlat"},
+	{false, 1, 0},
+	{true, 3, "in eax, 98"},
+	{true, 2, "in eax, 98"},
+	{false, 1, 0},
+	{true, 2, "mov bh, ch"},
+	{true, 1, "out dx, eax"},
+	{true, 3, "and al, 21"},
+	{true, 2, "and al, 21"},
+	{true, 5, "adc eax, 0x344aa633"},
+	{true, 6, "xor esp, dword ptr [rsi+0x3584344a]"},
+	{true, 1, "cmpsb"},
+	{true, 3, "xor al, 0x84"},
+	{true, 2, "xor al, 0x84"},
+	{true, 6, "test byte ptr [rip+0xffffffffae3ebae7], dh"},
+	{true, 5, "xor eax, 0xffffffffae3ebae7"},
+	{true, 2, "out 0xba, eax"},
+	{true, 5, "mov edx, 0xffffffffbf6bae3e"},
+	{true, 2, "scasb"},
+	{true, 1, "scasb"},
+	{true, 7, "imul edi, dword ptr [rdi+0x2ee55f86], 0xe2"},
+	{true, 5, "mov edi, 0x2ee55f86"},
+	{true, 3, "xchg bl, byte ptr [rdi-27]"},
+	{true, 1, "pop rdi"},
+	{true, 2, "in eax, 46"},
+	{true, 3, "loop 0x0000000000000fb4"},
+	{true, 2, "loop 0x0000000000000fb3"},
+	{true, 2, "mov cl, 0xf8"},
+	{true, 1, "clc"},
+	{true, 7, "adc byte ptr [rsp+rbx*2+0x4db9939f], dl"},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "pop rsp"},
+	{true, 1, "lahf"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 5, "mov ecx, 0x26dda04d"},
+	{true, 6, "mov al, byte ptr [0xffffffffd15226dd]"},
+	{true, 5, "mov al, byte ptr [0xffffffffd15226dd]"},
+	{true, 2, "frstor [rsi]"},
+	{true, 2, "push rdx"},
+	{true, 1, "push rdx"},
+	{true, 6, "rcl dword ptr [rbx+0x270e8bfe], 1"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 6, "dec byte ptr [rbx+0xffffffff9113270e]"},
+	{true, 2, "mov ecx, dword ptr [rsi]"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 6, "adc edx, dword ptr [rcx+0x6302e5f6]"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "mul ch"},
+	{true, 2, "in eax, 2"},
+	{true, 3, "add ah, byte ptr [rbx+104]"},
+	{true, 3, "movsxd ebp, dword ptr [rax-67]"},
+	{true, 5, "push 0xffffffffc0150dbd"},
+	{true, 5, "mov ebp, 0xffffffffcec0150d"},
+	{true, 5, "or eax, 0xffffffffb6cec015"},
+	{true, 5, "adc eax, 0x37b6cec0"},
+	{true, 3, "ror dh, 0xb6"},
+	{false, 1, 0},
+	{true, 2, "mov dh, 55"},
+	{false, 1, 0},
+	{true, 6, "sal dword ptr [rdi+0xffffffff9ca20621], 1"},
+	{true, 2, "mov bh, 33"},
+	{true, 2, "and dword ptr [rsi], eax"},
+	{false, 1, 0},
+	{true, 5, "mov byte ptr [0xffffffffe955279c], al"},
+	{true, 1, "pushfd"},
+	{false, 1, 0},
+	{true, 1, "push rbp"},
+	{true, 5, "jmp 0x00000000493949ff"},
+	{true, 1, "cli"},
+	{true, 2, "cmp dword ptr [rcx], edi"},
+	{true, 3, "cmp dword ptr [rcx+43], ecx"},
+	{true, 3, "sub rdi, r11"},
+	{true, 2, "sub edi, ebx"},
+	{true, 1, "sti"},
+	{true, 2, "jnbe 0x000000000000104c"},
+	{true, 10, "mov rax, 0xef0b44f7621cae9c"},
+	{true, 5, "mov eax, 0x621cae9c"},
+	{true, 1, "pushfd"},
+	{true, 1, "scasb"},
+	{true, 2, "sbb al, 98"},
+	{false, 1, 0},
+	{true, 8, "test dword ptr [rbx+rcx-17], 0xffffffffb5c2126b"},
+	{true, 3, "or r13d, edi"},
+	{true, 2, "or ebp, edi"},
+	{true, 1, "out dx, eax"},
+	{true, 3, "imul edx, dword ptr [rdx], 0xc2"},
+	{true, 2, "adc al, dl"},
+	{true, 3, "ret 0x7bb5"},
+	{true, 2, "mov ch, 123"},
+	{true, 2, "jnp 0x0000000000000fd1"},
+	{true, 1, "iret"},
+	{true, 6, "call 0xffffffffa39a4d2a"},
+	{true, 5, "call 0xffffffffa39a4d29"},
+	{true, 2, "and al, 61"},
+	{true, 5, "cmp eax, 0x1502a39a"},
+	{false, 1, 0},
+	{true, 5, "mov dword ptr [0xffffffffb7751502], eax"},
+	{true, 6, "add dl, byte ptr [rip+0xffffffffb321b775]"},
+	{true, 5, "adc eax, 0xffffffffb321b775"},
+	{true, 2, "jnz 0x0000000000000fb9"},
+	{true, 2, "mov bh, 33"},
+	{true, 6, "and dword ptr [rbx+0xffffffff82a43742], esi"},
+	{true, 2, "mov bl, 66"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "movsb"},
+	{false, 1, 0},
+	{true, 2, "cmp al, al"},
+	{true, 3, "rcr byte ptr [rax], 37"},
+	{true, 6, "sbb byte ptr [rip+0x6b958913], ah"},
+	{true, 5, "and eax, 0x6b958913"},
+	{true, 6, "adc ecx, dword ptr [rcx+0x2e8e6b95]"},
+	{true, 6, "mov dword ptr [rbp+0xffffffff9a2e8e6b], edx"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 7, "imul ecx, dword ptr [rsi+0xffffffffa1f09a2e], 60"},
+	{true, 2, "mov gs, word ptr [rsi]"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 6, "lock mov eax, dword ptr [0x7a92a63c]"},
+	{true, 5, "mov eax, dword ptr [0x7a92a63c]"},
+	{true, 2, "cmp al, 0xa6"},
+	{true, 1, "cmpsb"},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "jp 0x000000000000107d"},
+	{true, 2, "jnp 0x0000000000000f98"},
+	{true, 1, "xchg esi, eax"},
+	{false, 1, 0},
+	{true, 5, "cmp eax, 0x7ca7c2ff"},
+	{true, 2, "inc edx"},
+	{true, 3, "ret 0x7ca7"},
+	{true, 1, "cmpsd"},
+	{true, 2, "jl 0x0000000000000fef"},
+	{true, 1, "in eax, dx"},
+	{false, 1, 0},
+	{true, 1, "pop rdx"},
+	{true, 2, "jnz 0x0000000000001010"},
+	{false, 1, 0},
+	{true, 2, "jo 0x0000000000000fc5"},
+	{true, 1, "ret"},
+	{false, 1, 0},
+	{true, 5, "adc eax, 0xffffffffb0918e7e"},
+	{true, 2, "jle 0x0000000000000f90"},
+	{true, 6, "mov ss, word ptr [rcx+0x27ed55b0]"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "mov al, 85"},
+	{true, 1, "push rbp"},
+	{true, 1, "in eax, dx"},
+	{false, 1, 0},
+	{true, 1, "push rcx"},
+	{true, 1, "xchg edx, eax"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 5, "mov ecx, 0x49ba98b1"},
+	{true, 2, "mov cl, 0x98"},
+	{true, 1, "cwde"},
+	{true, 5, "mov edx, 0x45b56f49"},
+	{false, 2, 0},
+	{true, 1, "outsd"},
+	{true, 2, "mov ch, 69"},
+	{true, 3, "or r15b, r11b"},
+	{true, 2, "or bh, bl"},
+	{true, 2, "fbld tbyte ptr [rcx]"},
+	{true, 2, "and dword ptr [rsi], esi"},
+	{true, 3, "jnb 0x0000000000001051"},
+	{true, 2, "jnb 0x0000000000001050"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 2, "or al, bl"},
+	{true, 3, "fcom dword ptr [rbx+6]"},
+	{true, 1, "push rbx"},
+	{false, 1, 0},
+	{true, 1, "xchg ecx, eax"},
+	{true, 10, "mov dword ptr [rcx+0xffffffffe5af3150], 0xffffffffa94a2f10"},
+	{true, 7, "adc dword ptr [rax+49], 0x2f10e5af"},
+	{true, 1, "push rax"},
+	{true, 6, "xor dword ptr [rdi+0x4a2f10e5], ebp"},
+	{true, 1, "scasd"},
+	{true, 2, "in eax, 16"},
+	{true, 2, "adc byte ptr [rdi], ch"},
+	{false, 1, 0},
+	{true, 6, "test rax, 0xfffffffff81486d9"},
+	{true, 5, "test eax, 0xfffffffff81486d9"},
+	{true, 6, "fld dword ptr [rsi+0x2837f814]"},
+	{true, 3, "xchg dl, byte ptr [rax+rdi*8]"},
+	{true, 2, "adc al, 0xf8"},
+	{true, 1, "clc"},
+	{false, 1, 0},
+	{true, 6, "sub byte ptr [rsi+0xffffffffd3166825], ah"},
+	{true, 1, "cmpsb"},
+	{true, 5, "and eax, 0xffffffff9cd31668"},
+	{true, 5, "push 0xffffffffdb9cd316"},
+	{false, 1, 0},
+	{true, 7, "rcr dword ptr [rbx+rbx*8+0x6a898421], cl"},
+	{true, 1, "pushfd"},
+	{false, 2, 0},
+	{true, 7, "and dword ptr [rcx+rcx*4+0x4a537d6a], eax"},
+	{true, 6, "test byte ptr [rcx+0x4a537d6a], cl"},
+	{true, 3, "mov dword ptr [rdx+125], ebp"},
+	{true, 2, "push 125"},
+	{true, 2, "jnl 0x0000000000001055"},
+	{true, 1, "push rbx"},
+	{true, 2, "push rsi"},
+	{true, 1, "push rsi"},
+	{true, 2, "or ebp, edx"},
+	{false, 1, 0},
+	{true, 1, "xchg ebp, eax"},
+	{false, 1, 0},
+	{true, 2, "movsxd ebx, dword ptr [rdx]"},
+	{true, 3, "sbb ch, byte ptr [rcx+127]"},
+	{true, 7, "imul edi, dword ptr [rdi-93], 0xfffffffff9a2b6ba"},
+	{true, 2, "jnle 0x0000000000000fa5"},
+	{true, 5, "mov dword ptr [0xfffffffff9a2b6ba], eax"},
+	{true, 5, "mov edx, 0x46f9a2b6"},
+	{true, 2, "mov dh, 0xa2"},
+	{true, 5, "mov byte ptr [0x29cb46f9], al"},
+	{true, 1, "stc"},
+	{true, 2, "retf"},
+	{true, 1, "retf"},
+	{true, 2, "sub edx, esi"},
+	{true, 7, "repne xor eax, dword ptr [rbx+0x2f138160]"},
+	{true, 6, "xor eax, dword ptr [rbx+0x2f138160]"},
+	{true, 4, "and dword ptr [rax-127], 19"},
+	{false, 1, 0},
+	{true, 6, "adc dword ptr [rbx], 0x6dcfa32f"},
+	{true, 2, "adc ebp, dword ptr [rdi]"},
+	{false, 1, 0},
+	{true, 5, "mov dword ptr [0xffffffff9b426dcf], eax"},
+	{true, 1, "iret"},
+	{true, 1, "insd"},
+	{true, 2, "wait"},
+	{true, 1, "wait"},
+	{false, 2, 0},
+	{true, 1, "pop rdx"},
+	{true, 5, "mov edi, 0x63e05b37"},
+	{false, 1, 0},
+	{true, 1, "pop rbx"},
+	{true, 2, "loopne 0x0000000000001065"},
+	{true, 4, "movsxd ebp, dword ptr [rsi+rbx*4+14]"},
+	{true, 1, "insb"},
+	{true, 1, "sahf"},
+	{false, 1, 0},
+	{true, 1, "xchg edx, eax"},
+	{true, 1, "lodsd"},
+	{false, 1, 0},
+	{true, 2, "fild dword ptr [rdx]"},
+	{true, 2, "add ch, byte ptr [rcx]"},
+	{true, 3, "sub dword ptr [rbp-65], ebp"},
+	{true, 1, "insd"},
+	{true, 5, "mov edi, 0x0f7ec829"},
+	{true, 2, "sub eax, ecx"},
+	{true, 4, "enter 0x0f7e, 103"},
+	{true, 2, "jle 0x0000000000001011"},
+	{true, 3, "packuswb mm4, mm3"},
+	{true, 3, "jcez 0x0000000000000fa5"},
+	{true, 2, "jcez 0x0000000000000fa4"},
+	{true, 5, "mov byte ptr [0x56c5f419], al"},
+	{true, 2, "sbb esp, esi"},
+	{true, 1, "hlt"},
+	{false, 1, 0},
+	{true, 1, "push rsi"},
+	{true, 6, "add eax, dword ptr [rdi+0xffffffffcb6439e6]"},
+	{true, 2, "xchg esp, esi"},
+	{true, 2, "out 57, al"},
+	{true, 4, "cmp dword ptr [rbx+rcx*8-31], esp"},
+	{true, 2, "retf"},
+	{true, 1, "retf"},
+	{true, 2, "loope 0x000000000000105b"},
+	{true, 1, "pop rcx"},
+	{true, 1, "lahf"},
+	{true, 3, "cmp dword ptr [rbx], 58"},
+	{true, 2, "cmp edi, dword ptr [rdx]"},
+	{true, 3, "cmp al, byte ptr [rdi+rsi*2]"},
+	{true, 2, "add al, 119"},
+	{true, 2, "jnbe 0x0000000000000fd4"},
+	{true, 6, "shl byte ptr [rbp+0x372626a5], cl"},
+	{true, 1, "movsd"},
+	{true, 1, "movsd"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "clc"},
+	{true, 3, "sub cl, byte ptr [rbx-91]"},
+	{true, 2, "movsq"},
+	{true, 1, "movsd"},
+	{true, 3, "xor dword ptr [rcx-86], ebp"},
+	{true, 10, "imul ebp, dword ptr [rdx+0x7b005dd0], 0x03f03e8c"},
+	{true, 1, "stosb"},
+	{true, 3, "rcr byte ptr [rbp], 1"},
+	{true, 1, "pop rbp"},
+	{true, 3, "add byte ptr [rbx-116], bh"},
+	{true, 2, "jnp 0x0000000000000f8e"},
+	{true, 2, "mov dword ptr [rsi], seg8"},
+	{true, 4, "lock add esi, dword ptr ds:[rax]"},
+	{true, 3, "lock add esi, dword ptr [rax]"},
+	{true, 2, "add esi, dword ptr [rax]"},
+	{true, 2, "xor dl, ch"},
+	{false, 1, 0},
+	{true, 6, "xchg cl, byte ptr [rbp+0x298c22dd]"},
+	{true, 2, "lea ebx, (invalid)"},
+	{true, 2, "frstor [rdx]"},
+	{true, 7, "and cl, byte ptr [rcx+rbp+0x2732738f]"},
+	{true, 2, "mov dword ptr [rcx], gs"},
+	{true, 6, "sub dword ptr [rdi+0xffffffffe5273273], ecx"},
+	{false, 2, 0},
+	{true, 2, "jnb 0x0000000000001034"},
+	{true, 2, "xor ah, byte ptr [rdi]"},
+	{false, 1, 0},
+	{true, 2, "in eax, 14"},
+	{false, 1, 0},
+	{true, 5, "mov ecx, 0xffffffffe568b051"},
+	{true, 1, "push rcx"},
+	{true, 2, "mov al, 104"},
+	{true, 5, "push 0xffffffff923dece5"},
+	{true, 2, "in eax, 0xec"},
+	{true, 1, "in al, dx"},
+	{true, 5, "cmp eax, 0x636d2092"},
+	{true, 1, "xchg edx, eax"},
+	{true, 3, "and byte ptr [rbp+99], ch"},
+	{true, 1, "insd"},
+	{true, 3, "movsxd edx, dword ptr [rbp+110]"},
+	{true, 1, "push rbp"},
+	{true, 1, "outsb"},
+	{true, 1, "cld"},
+	{true, 6, "adc r8, 0x6302a914"},
+	{true, 5, "adc eax, 0x6302a914"},
+	{true, 2, "adc al, 0xa9"},
+	{true, 5, "test eax, 0x71086302"},
+	{true, 3, "add ah, byte ptr [rbx+8]"},
+	{true, 2, "movsxd ecx, dword ptr [rax]"},
+	{true, 3, "or byte ptr [rcx-64], dh"},
+	{true, 2, "jno 0x0000000000000fc2"},
+	{true, 4, "rcr byte ptr [rdi+23], 0xef"},
+	{true, 1, "pop rdi"},
+	{false, 1, 0},
+	{true, 1, "out dx, eax"},
+	{true, 2, "not bl"},
+	{true, 2, "rcr ecx, cl"},
+	{false, 2, 0},
+	{true, 2, "loop 0x000000000000101b"},
+	{true, 2, "sbb dword ptr [rcx], edx"},
+	{true, 3, "adc dword ptr [rbp+98], edx"},
+	{true, 1, "push rbp"},
+	{false, 1, 0},
+	{true, 6, "xor dword ptr [rax+0x2920e173], ecx"},
+	{true, 3, "mov byte ptr [rbx-31], dh"},
+	{true, 2, "jnb 0x0000000000000fe3"},
+	{true, 2, "loope 0x0000000000001022"},
+	{true, 2, "and byte ptr [rcx], ch"},
+	{true, 6, "sub dword ptr [rip+0x547cb3e4], esp"},
+	{true, 5, "and eax, 0x547cb3e4"},
+	{true, 2, "in al, 0xb3"},
+	{true, 2, "mov bl, 124"},
+	{true, 2, "jl 0x0000000000001056"},
+	{true, 1, "push rsp"},
+	{true, 2, "jnle 0x000000000000106c"},
+	{true, 2, "push 0x80"},
+	{true, 8, "or byte ptr [rdx+rdx*4+0xffffffffc6684707], 0xd9"},
+	{true, 6, "mov dword ptr [rdx+0xffffffffc6684707], ss"},
+	{true, 1, "xchg edx, eax"},
+	{false, 1, 0},
+	{true, 6, "push 0xffffffffbc4ed9c6"},
+	{true, 5, "push 0xffffffffbc4ed9c6"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 10, "mov rsp, 0x8fa3193c849dc545"},
+	{true, 5, "mov esp, 0xffffffff849dc545"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "popfd"},
+	{true, 3, "test byte ptr [rcx+rbx], bh"},
+	{true, 2, "cmp al, 25"},
+	{true, 6, "sbb dword ptr [rbx+0xffffffffcf10118f], esp"},
+	{true, 5, "mov dword ptr [0xffffffffcf10118f], eax"},
+	{false, 2, 0},
+	{true, 2, "adc dword ptr [rax], edx"},
+	{true, 2, "adc bh, cl"},
+	{true, 1, "iret"},
+	{true, 2, "jmp 0x0000000000001066"},
+	{true, 6, "and eax, 0x18c70fee"},
+	{true, 5, "and eax, 0x18c70fee"},
+	{true, 1, "out dx, al"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "sbb byte ptr [rax-53], cl"},
+	{true, 2, "retf"},
+	{true, 1, "retf"},
+	{true, 5, "sar dword ptr ds:[rax-16], 117"},
+	{true, 4, "sar dword ptr [rax-16], 117"},
+	{true, 2, "js 0x0000000000000ff2"},
+	{true, 3, "lock jnz 0x0000000000000f9b"},
+	{true, 2, "jnz 0x0000000000000f9a"},
+	{true, 1, "cwde"},
+	{true, 3, "movsx eax, sp"},
+	{true, 5, "mov edi, 0x12e800c4"},
+	{false, 1, 0},
+	{true, 2, "add al, ch"},
+	{true, 5, "call 0x000000004956f317"},
+	{true, 2, "adc ah, bl"},
+	{true, 2, "jcez 0x0000000000001058"},
+	{true, 1, "push rsi"},
+	{false, 2, 0},
+	{true, 2, "insb"},
+	{true, 1, "insb"},
+	{true, 5, "mov ebp, 0xffffffffa71602be"},
+	{true, 5, "mov esi, 0xffffffffb6a71602"},
+	{true, 2, "add dl, byte ptr [rsi]"},
+	{false, 1, 0},
+	{true, 1, "cmpsd"},
+	{true, 2, "mov dh, 102"},
+	{true, 2, "stosw"},
+	{true, 1, "stosd"},
+	{true, 2, "and al, 0xda"},
+	{true, 3, "fidivr dword ptr [rax-50]"},
+	{true, 2, "js 0x0000000000000fd0"},
+	{false, 1, 0},
+	{true, 2, "jmp 0x0000000000001033"},
+	{true, 2, "xor ebx, ebp"},
+	{true, 2, "jmp 0x0000000000001071"},
+	{true, 1, "outsd"},
+	{true, 2, "sub ebp, esi"},
+	{true, 1, "cmc"},
+	{true, 2, "fmul dword ptr [rdx]"},
+	{true, 2, "or cl, byte ptr [rbx]"},
+	{true, 2, "or esi, dword ptr [rdx]"},
+	{true, 3, "xor ah, byte ptr [rdx]"},
+	{true, 2, "and al, 0xa2"},
+	{true, 5, "mov byte ptr [0xffffffff81b2240d], al"},
+	{true, 5, "or eax, 0x0081b224"},
+	{true, 2, "and al, 0xb2"},
+	{true, 2, "mov dl, 0x81"},
+	{true, 6, "add dword ptr [rax], 0xffffffffdeac494e"},
+	{true, 3, "add byte ptr [rsi+73], cl"},
+	{false, 2, 0},
+	{true, 2, "lodsb"},
+	{true, 1, "lodsb"},
+	{true, 3, "ficomp word ptr [rdx+68]"},
+	{true, 1, "pop rdx"},
+	{true, 4, "sub byte ptr [rsi-76], r9b"},
+	{true, 3, "sub byte ptr [rsi-76], cl"},
+	{true, 3, "mov ah, 0xfc"},
+	{true, 2, "mov ah, 0xfc"},
+	{true, 1, "cld"},
+	{true, 2, "lock cmc"},
+	{true, 1, "cmc"},
+	{true, 2, "in al, 0xf6"},
+	{true, 6, "div byte ptr [rcx+0x4bcbaf82]"},
+	{true, 2, "mov cl, 0x82"},
+	{false, 1, 0},
+	{true, 1, "scasd"},
+	{true, 1, "retf"},
+	{true, 3, "js 0x0000000000000ff0"},
+	{true, 2, "js 0x0000000000000fef"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "fisttp dword ptr [rax]"},
+	{true, 6, "or byte ptr [rdx+0xffffffffd89ab129], bh"},
+	{true, 5, "mov edx, 0xffffffffd89ab129"},
+	{true, 6, "sub dword ptr [rcx+0x34fbd89a], esi"},
+	{true, 2, "mov cl, 0x9a"},
+	{false, 1, 0},
+	{true, 2, "fdivr st, st(3)"},
+	{true, 1, "sti"},
+	{true, 2, "xor al, 0xd7"},
+	{true, 1, "xlat"},
+	{true, 2, "sbb al, 36"},
+	{true, 2, "and al, 0x93"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 3, "xor edx, dword ptr [rdx+110]"},
+	{true, 1, "push rdx"},
+	{true, 1, "outsb"},
+	{true, 1, "out dx, al"},
+	{true, 3, "add dword ptr [rbx+65], ebx"},
+	{true, 1, "pop rbx"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 7, "imul esi, dword ptr [rcx+5], 0x3b372821"},
+	{true, 2, "jno 0x0000000000001007"},
+	{true, 5, "add eax, 0x3b372821"},
+	{true, 2, "and dword ptr [rax], ebp"},
+	{true, 2, "sub byte ptr [rdi], dh"},
+	{false, 1, 0},
+	{true, 7, "cmp eax, dword ptr [rbx+rcx+0x29915b88]"},
+	{true, 2, "test byte ptr [rbx], cl"},
+	{true, 6, "or ecx, dword ptr [rax+0xfffffffffc29915b]"},
+	{true, 3, "mov byte ptr [rbx-111], bl"},
+	{true, 1, "pop rbx"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "sub esp, edi"},
+	{true, 1, "cld"},
+	{true, 5, "imul edi, dword ptr [rbx+58], 100"},
+	{true, 2, "jl 0x0000000000000fe5"},
+	{true, 2, "jcez 0x000000000000103c"},
+	{true, 4, "cmp ah, byte ptr [rax+rsi-100]"},
+	{true, 8, "xor byte ptr fs:[rax+rax+0xfffffffff3394144], bl"},
+	{true, 7, "xor byte ptr [rax+rax+0xfffffffff3394144], bl"},
+	{true, 1, "pushfd"},
+	{true, 4, "add byte ptr [rcx+rax*2+57], al"},
+	{false, 2, 0},
+	{true, 3, "cmp r11d, esi"},
+	{true, 2, "cmp ebx, esi"},
+	{true, 3, "repne cwde"},
+	{true, 2, "repne cwde"},
+	{true, 1, "cwde"},
+	{true, 1, "push rdi"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 3, "fmul dword ptr [rdi+110]"},
+	{true, 2, "outsb"},
+	{true, 1, "outsb"},
+	{true, 2, "xor al, 0x92"},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "jmp 0x0000000000001063"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 3, "in eax, 48"},
+	{true, 2, "in eax, 48"},
+	{true, 3, "xor byte ptr [rsp+rdx*4], dh"},
+	{true, 2, "xor al, 0x94"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "and ebp, dword ptr [rcx]"},
+	{true, 3, "sub dword ptr [rcx-99], esi"},
+	{true, 2, "jno 0x0000000000000f9f"},
+	{true, 1, "popfd"},
+	{true, 2, "mov ch, 9"},
+	{true, 3, "or dword ptr [rdi+61], edx"},
+	{true, 1, "push rdi"},
+	{true, 5, "cmp eax, 0x6c25068a"},
+	{true, 2, "mov al, byte ptr [rsi]"},
+	{false, 1, 0},
+	{true, 5, "and eax, 0xffffffffdf98f66c"},
+	{true, 1, "insb"},
+	{true, 6, "neg byte ptr [rax+0x0be4d9df]"},
+	{true, 1, "cwde"},
+	{false, 2, 0},
+	{true, 2, "ftst"},
+	{true, 2, "in al, 11"},
+	{true, 2, "or ebp, edx"},
+	{false, 1, 0},
+	{true, 3, "fcmovb st, st(6)"},
+	{true, 2, "fcmovb st, st(6)"},
+	{false, 2, 0},
+	{true, 2, "push 0xe1"},
+	{true, 2, "loope 0x0000000000000fb4"},
+	{true, 2, "mov dl, 89"},
+	{true, 1, "pop rcx"},
+	{true, 1, "pop rsp"},
+	{true, 2, "loopne 0x0000000000001014"},
+	{true, 3, "adc cl, byte ptr [rax+114]"},
+	{true, 3, "jb 0x000000000000107d"},
+	{true, 2, "jb 0x000000000000107c"},
+	{true, 2, "jp 0x0000000000000fb2"},
+	{true, 2, "mov al, 0x99"},
+	{true, 1, "cdq"},
+	{true, 2, "mov dl, 45"},
+	{true, 5, "sub eax, 0xfffffffff4cd1f47"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "int 0xf4"},
+	{true, 1, "hlt"},
+	{true, 1, "pop rax"},
+	{true, 3, "test dword ptr [rax+44], eax"},
+	{true, 3, "sub al, 0xa1"},
+	{true, 2, "sub al, 0xa1"},
+	{true, 5, "mov eax, dword ptr [0x5e4a2c19]"},
+	{true, 3, "sbb dword ptr [rdx+rcx*2], ebp"},
+	{true, 2, "sub al, 74"},
+	{true, 2, "pop rsi"},
+	{true, 1, "pop rsi"},
+	{true, 1, "pop rsi"},
+	{true, 2, "idiv byte ptr [rdi]"},
+	{false, 1, 0},
+	{true, 2, "push rax"},
+	{true, 1, "push rax"},
+	{true, 1, "sahf"},
+	{true, 1, "cmpsb"},
+	{true, 2, "xor al, 117"},
+	{true, 2, "jnz 0x0000000000000fe2"},
+	{true, 2, "loopne 0x0000000000000fb5"},
+	{true, 2, "mov bl, 0xca"},
+	{true, 3, "retf 0x0da8"},
+	{true, 2, "test al, 13"},
+	{true, 5, "or eax, 0xffffffffa6a586dc"},
+	{true, 6, "fadd qword ptr [rsi+0xffffffffd344a6a5]"},
+	{true, 6, "xchg ah, byte ptr [rbp+0x53d344a6]"},
+	{true, 1, "movsd"},
+	{true, 1, "cmpsb"},
+	{true, 4, "rcl dword ptr [rbx-67], cl"},
+	{true, 3, "rcl dword ptr [rbx-67], cl"},
+	{true, 1, "push rbx"},
+	{true, 5, "mov ebp, 0x0cd5bdec"},
+	{true, 1, "in al, dx"},
+	{true, 5, "mov ebp, 0x74990cd5"},
+	{false, 1, 0},
+	{true, 2, "or al, 0x99"},
+	{true, 1, "cdq"},
+	{true, 2, "jz 0x0000000000001051"},
+	{true, 7, "rol byte ptr [r11+0xffffffffc271787f], cl"},
+	{true, 6, "rol byte ptr [rbx+0xffffffffc271787f], cl"},
+	{true, 4, "cmp dword ptr [rdi+120], 113"},
+	{true, 2, "jnle 0x000000000000107a"},
+	{true, 2, "js 0x0000000000001073"},
+	{true, 2, "jno 0x0000000000000fc4"},
+	{true, 3, "ret 0xffffffffffffe4bf"},
+	{true, 5, "mov edi, 0x2b78c9e4"},
+	{true, 2, "in al, 0xc9"},
+	{true, 1, "leave"},
+	{true, 2, "js 0x000000000000102d"},
+	{true, 2, "sub ecx, dword ptr [rdi]"},
+	{true, 7, "rsqrtps xmm7, xmmword ptr [rdi+0x51fc2945]"},
+	{true, 1, "push rdx"},
+	{true, 5, "mov edi, 0x51fc2945"},
+	{true, 3, "sub r12d, r15d"},
+	{true, 2, "sub esp, edi"},
+	{true, 1, "cld"},
+	{true, 1, "push rcx"},
+	{true, 1, "pop rdi"},
+	{true, 5, "mov dword ptr [0x7e8ffac6], eax"},
+	{false, 2, 0},
+	{true, 1, "cli"},
+	{false, 2, 0},
+	{true, 2, "jle 0x0000000000001022"},
+	{true, 6, "and byte ptr [rsi+0xffffffffca014e73], bh"},
+	{true, 5, "mov esi, 0xffffffffca014e73"},
+	{true, 2, "jnb 0x0000000000001050"},
+	{true, 3, "add rdx, r9"},
+	{true, 2, "add edx, ecx"},
+	{true, 3, "retf 0x10a5"},
+	{true, 1, "movsd"},
+	{true, 2, "adc al, cl"},
+	{true, 4, "enter 0xfffffffffffffd1b, 0xb1"},
+	{true, 2, "sbb edi, ebp"},
+	{true, 1, "std"},
+	{true, 2, "mov cl, 0xd4"},
+	{false, 1, 0},
+	{true, 4, "lock mov dword ptr [rdx-30], ebx"},
+	{true, 3, "mov dword ptr [rdx-30], ebx"},
+	{true, 1, "pop rdx"},
+	{true, 2, "loop 0x0000000000000ff3"},
+	{false, 1, 0},
+	{true, 3, "jnl 0x000000000000102c"},
+	{true, 2, "jnl 0x000000000000102b"},
+	{true, 3, "sub dword ptr [rbx+rdi*4], ebx"},
+	{true, 2, "sbb al, 0xbb"},
+	{true, 5, "mov ebx, 0xfffffffff17337a1"},
+	{true, 5, "mov eax, dword ptr [0xffffffffedf17337]"},
+	{false, 1, 0},
+	{true, 2, "jnb 0x0000000000000ff3"},
+	{false, 1, 0},
+	{true, 1, "in eax, dx"},
+	{true, 3, "mov ah, byte ptr [rdi-75]"},
+	{true, 3, "mov ch, 118"},
+	{true, 2, "mov ch, 118"},
+	{true, 2, "jbe 0x0000000000000fef"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "add dh, byte ptr [rcx]"},
+	{true, 3, "xor dword ptr [rax-104], ecx"},
+	{true, 2, "cdqe"},
+	{true, 1, "cwde"},
+	{true, 1, "xlat"},
+	{true, 1, "outsb"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "stosd"},
+	{true, 1, "xchg ecx, eax"},
+	{false, 1, 0},
+	{true, 1, "xchg esi, eax"},
+	{true, 2, "loope 0x0000000000000fda"},
+	{true, 6, "fmul dword ptr [rbx+0x1954a6e1]"},
+	{true, 2, "mov esp, ecx"},
+	{true, 2, "loope 0x0000000000000fa8"},
+	{true, 1, "cmpsb"},
+	{true, 1, "push rsp"},
+	{true, 2, "sbb esi, ebx"},
+	{true, 2, "fsubrp st(1), st"},
+	{true, 2, "loope 0x0000000000001066"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "mov bh, 0xd8"},
+	{true, 2, "fdiv st, st(5)"},
+	{true, 1, "cmc"},
+	{true, 3, "fisubr dword ptr [rax-94]"},
+	{true, 5, "push 0x1d157ba2"},
+	{true, 5, "mov byte ptr [0x501d157b], al"},
+	{true, 2, "jnp 0x0000000000001017"},
+	{true, 5, "adc eax, 0x1cae501d"},
+	{true, 5, "sbb eax, 0x491cae50"},
+	{true, 1, "push rax"},
+	{true, 1, "scasb"},
+	{true, 2, "sbb al, 73"},
+	{true, 7, "fiadd dword ptr [rip+0xfffffffff3cb8698]"},
+	{true, 6, "fiadd dword ptr [rip+0xfffffffff3cb8698]"},
+	{true, 5, "add eax, 0xfffffffff3cb8698"},
+	{true, 1, "cwde"},
+	{true, 2, "xchg cl, bl"},
+	{true, 1, "retf"},
+	{true, 3, "rep loop 0x0000000000001033"},
+	{true, 2, "loop 0x0000000000001032"},
+	{true, 7, "xor byte ptr [rsp+0xfffffffff632bf4e], ch"},
+	{true, 1, "lodsb"},
+	{true, 2, "in al, 78"},
+	{true, 10, "mov rdi, 0x73db7826e83bf632"},
+	{true, 5, "mov edi, 0xffffffffe83bf632"},
+	{true, 2, "xor dh, dh"},
+	{true, 2, "idiv byte ptr [rbx]"},
+	{true, 2, "cmp ebp, eax"},
+	{true, 5, "call 0x0000000073db882b"},
+	{true, 3, "js 0x0000000000000fde"},
+	{true, 2, "js 0x0000000000000fdd"},
+	{false, 2, 0},
+	{true, 2, "jnb 0x000000000000101a"},
+	{true, 2, "sbb byte ptr [rbx], ah"},
+	{true, 2, "and eax, ebx"},
+	{true, 1, "ret"},
+	{true, 2, "fcmovnb st, st(3)"},
+	{true, 1, "ret"},
+	{true, 2, "sbb dh, byte ptr [rcx]"},
+	{true, 6, "xor dword ptr [rdi+0xffffffff8b21a33f], esp"},
+	{true, 1, "cmpsd"},
+	{false, 1, 0},
+	{true, 5, "mov dword ptr [0xffffffffa3e98b21], eax"},
+	{true, 6, "and dword ptr [rbx+0x3d0ea3e9], ecx"},
+	{true, 2, "mov ebp, ecx"},
+	{true, 5, "jmp 0x00000000123d1ea8"},
+	{true, 5, "mov dword ptr [0xffffffffdb123d0e], eax"},
+	{false, 1, 0},
+	{true, 5, "cmp eax, 0x1888db12"},
+	{true, 2, "adc bl, bl"},
+	{true, 6, "fisttp dword ptr [rax+0x7be56a18]"},
+	{true, 2, "mov byte ptr [rax], bl"},
+	{true, 3, "sbb byte ptr [rdx-27], ch"},
+	{true, 2, "push 0xe5"},
+	{true, 2, "in eax, 123"},
+	{true, 2, "jnp 0x0000000000001076"},
+	{true, 2, "jz 0x000000000000102d"},
+	{true, 2, "sub ebp, esp"},
+	{true, 1, "in al, dx"},
+	{true, 2, "cmp eax, eax"},
+	{true, 7, "rol byte ptr [rip+0xffffffffcc644c2e], 51"},
+	{true, 5, "add eax, 0xffffffffcc644c2e"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "int3"},
+	{true, 1, "int3"},
+	{true, 2, "xor edi, esi"},
+	{false, 2, 0},
+	{true, 1, "pop rax"},
+	{true, 2, "in al, 0xcb"},
+	{true, 1, "retf"},
+	{true, 1, "movsb"},
+	{true, 3, "test byte ptr [rax-55], ch"},
+	{true, 5, "push 0x1dd6afc9"},
+	{true, 1, "leave"},
+	{true, 1, "scasd"},
+	{false, 1, 0},
+	{true, 5, "sbb eax, 0x1a257180"},
+	{true, 4, "xor byte ptr [rcx+37], 26"},
+	{true, 2, "jno 0x0000000000001027"},
+	{true, 5, "and eax, 0xffffffffc9ae011a"},
+	{true, 2, "sbb al, byte ptr [rcx]"},
+	{true, 6, "add dword ptr [rsi+0xffffffffea1333c9], ebp"},
+	{true, 1, "scasb"},
+	{true, 1, "leave"},
+	{true, 2, "xor edx, dword ptr [rbx]"},
+	{true, 2, "adc ebp, edx"},
+	{false, 1, 0},
+	{true, 2, "imul byte ptr [rdx]"},
+	{true, 2, "sub ch, bh"},
+	{true, 1, "out dx, eax"},
+	{true, 1, "insd"},
+	{true, 7, "fst qword ptr [rax+rax*8+0xffffffffdd8c8116]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "rcl byte ptr [rsi], 0x81"},
+	{false, 1, 0},
+	{true, 11, "or dword ptr [rbp+rbx*8+0xffffffffc41b59e5], 0xffffffffd663ab46"},
+	{true, 2, "mov ebp, ds"},
+	{true, 2, "fucom st(5)"},
+	{true, 2, "in eax, 89"},
+	{true, 1, "pop rcx"},
+	{true, 2, "sbb eax, esp"},
+	{false, 1, 0},
+	{true, 2, "stosd"},
+	{true, 1, "stosd"},
+	{true, 2, "movsxd edx, esi"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 5, "mov dword ptr [0x3697d58e], eax"},
+	{true, 2, "mov ss, bp"},
+	{false, 1, 0},
+	{true, 1, "xchg edi, eax"},
+	{true, 3, "js 0x0000000000001020"},
+	{true, 2, "js 0x000000000000101f"},
+	{true, 5, "sbb eax, 0xffffffffa51eb9ac"},
+	{true, 1, "lodsb"},
+	{true, 5, "mov ecx, 0x3f73a51e"},
+	{false, 1, 0},
+	{true, 1, "movsd"},
+	{true, 2, "jnb 0x0000000000001041"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 2, "mov ch, 45"},
+	{true, 5, "sub eax, 0x0f65ecb7"},
+	{true, 2, "mov bh, 0xec"},
+	{true, 1, "in al, dx"},
+	{true, 5, "cmpps xmm6, xmm0, 0xd9"},
+	{true, 4, "cmpps xmm6, xmm0, 0xd9"},
+	{true, 3, "ret 0xffffffffffffd9f0"},
+	{true, 3, "lock fxch st(6)"},
+	{true, 2, "fxch st(6)"},
+	{false, 1, 0},
+	{true, 1, "push rsi"},
+	{true, 6, "cmp dword ptr [rsi], 0xffffffff83c714ed"},
+	{true, 2, "in eax, dx"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "adc al, 0xc7"},
+	{true, 10, "mov dword ptr [rbx+0xffffffffd85369c6], 0xffffffffe7c7665a"},
+	{true, 3, "add esi, 105"},
+	{false, 2, 0},
+	{true, 7, "imul edx, dword ptr [rbx-40], 0xffffffffe7c7665a"},
+	{true, 1, "push rbx"},
+	{true, 3, "fcomp dword ptr [rdx+102]"},
+	{true, 1, "pop rdx"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "out 0xd8, eax"},
+	{true, 3, "fsub dword ptr [rax+69]"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "out dx, eax"},
+	{true, 2, "cwde"},
+	{true, 1, "cwde"},
+	{true, 2, "not ebx"},
+	{true, 2, "rol edi, cl"},
+	{false, 2, 0},
+	{true, 5, "and eax, 0xffffffff8f201154"},
+	{true, 1, "push rsp"},
+	{true, 2, "adc dword ptr [rax], esp"},
+	{true, 6, "and byte ptr [rdi+0x2dc613df], cl"},
+	{false, 2, 0},
+	{true, 2, "fist word ptr [rbx]"},
+	{true, 2, "adc eax, esi"},
+	{false, 2, 0},
+	{true, 5, "sub eax, 0x2db87371"},
+	{true, 2, "jno 0x0000000000001075"},
+	{true, 2, "jnb 0x0000000000000fba"},
+	{true, 5, "mov eax, 0xffffffffa000882d"},
+	{true, 5, "sub eax, 0xffffffff85a00088"},
+	{true, 2, "mov byte ptr [rax], al"},
+	{true, 6, "add byte ptr [rax+0xffffffffb091c285], ah"},
+	{true, 5, "mov al, byte ptr [0xffffffffb091c285]"},
+	{true, 2, "test edx, eax"},
+	{true, 3, "ret 0xffffffffffffb091"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "mov al, 0x9d"},
+	{true, 1, "popfd"},
+	{false, 1, 0},
+	{true, 2, "mov dword ptr [rdi], seg7"},
+	{false, 1, 0},
+	{true, 5, "mov ebp, 0x380534d9"},
+	{true, 7, "fnstenv [rax+0xffffffff84b76d38]"},
+	{true, 2, "xor al, 5"},
+	{true, 5, "add eax, 0xffffffff84b76d38"},
+	{true, 3, "cmp byte ptr [rbp-73], ch"},
+	{true, 1, "insd"},
+	{true, 2, "mov bh, 0x84"},
+	{true, 3, "test byte ptr [rsi-57], dl"},
+	{true, 1, "push rsi"},
+	{false, 2, 0},
+	{true, 2, "rep xchg ebx, eax"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 6, "add esp, dword ptr [rdi+0xffffffff9538210c]"},
+	{true, 1, "cmpsd"},
+	{true, 2, "or al, 33"},
+	{true, 2, "and dword ptr [rax], edi"},
+	{true, 6, "cmp byte ptr [rbp+0xffffffff9d2d8eae], dl"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 1, "scasb"},
+	{true, 6, "mov gs, word ptr [rip+0x3bc1239d]"},
+	{true, 5, "sub eax, 0x3bc1239d"},
+	{true, 1, "popfd"},
+	{true, 2, "and eax, ecx"},
+	{true, 3, "sar dword ptr [rbx], 0xcb"},
+	{true, 2, "cmp ecx, ebx"},
+	{true, 1, "retf"},
+	{true, 2, "adc al, 9"},
+	{true, 6, "or dword ptr [rbx+0xffffffffa1b51e65], edx"},
+	{true, 1, "xchg ebx, eax"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "mov ch, 0xa1"},
+	{true, 5, "mov eax, dword ptr [0x3e721ceb]"},
+	{true, 2, "jmp 0x000000000000101e"},
+	{true, 2, "sbb al, 114"},
+	{true, 2, "jb 0x0000000000001040"},
+	{true, 2, "iret"},
+	{true, 1, "iret"},
+	{false, 1, 0},
+	{true, 2, "cwde"},
+	{true, 1, "cwde"},
+	{true, 1, "hlt"},
+	{true, 2, "lea edx, [rdx]"},
+	{true, 2, "adc ah, cl"},
+	{true, 2, "loope 0x0000000000000feb"},
+	{true, 5, "jmp 0xffffffffe2baf014"},
+	{true, 7, "pavgb mm7, qword ptr [rdx+0x5e8f78e2]"},
+	{true, 2, "loopne 0x0000000000000fbc"},
+	{true, 5, "mov edx, 0x5e8f78e2"},
+	{true, 2, "loop 0x000000000000107a"},
+	{true, 2, "js 0x0000000000000f91"},
+	{false, 2, 0},
+	{true, 1, "pop rsi"},
+	{true, 2, "jp 0x0000000000000f88"},
+	{true, 4, "xchg al, byte ptr [rdi+rcx*4+43]"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 6, "sub edi, dword ptr [rbx+0xffffffffe889406b]"},
+	{true, 5, "mov ebx, 0xffffffffe889406b"},
+	{true, 4, "imul eax, dword ptr [rax-119], 0xe8"},
+	{true, 3, "mov eax, ebp"},
+	{true, 2, "mov eax, ebp"},
+	{true, 5, "call 0x000000007e411757"},
+	{true, 1, "push rdx"},
+	{false, 1, 0},
+	{true, 3, "jle 0x0000000000000f88"},
+	{true, 2, "jle 0x0000000000000f87"},
+	{true, 3, "test dword ptr [rcx-43], eax"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "out 2, eax"},
+	{true, 6, "add dl, byte ptr [rip+0x5cc495b8]"},
+	{true, 5, "adc eax, 0x5cc495b8"},
+	{true, 5, "mov eax, 0x765cc495"},
+	{true, 1, "xchg ebp, eax"},
+	{false, 1, 0},
+	{true, 1, "pop rsp"},
+	{true, 2, "jbe 0x000000000000107c"},
+	{true, 2, "jp 0x0000000000000fcd"},
+	{true, 1, "retf"},
+	{true, 1, "nop"},
+	{true, 5, "test eax, 0xffffffff84d759b2"},
+	{true, 2, "mov dl, 89"},
+	{true, 1, "pop rcx"},
+	{true, 1, "xlat"},
+	{true, 6, "test byte ptr [rax+0xffffffffce5e1a97], ah"},
+	{true, 5, "mov al, byte ptr [0xffffffffce5e1a97]"},
+	{true, 1, "xchg edi, eax"},
+	{true, 3, "sbb bl, byte ptr [rsi-50]"},
+	{true, 1, "pop rsi"},
+	{false, 1, 0},
+	{true, 4, "cmp al, byte ptr ds:[rdx-121]"},
+	{true, 3, "cmp al, byte ptr [rdx-121]"},
+	{true, 3, "xchg ecx, dword ptr [rax]"},
+	{true, 2, "xchg ecx, dword ptr [rax]"},
+	{true, 6, "or byte ptr [rip+0x37da3632], dl"},
+	{true, 5, "adc eax, 0x37da3632"},
+	{true, 2, "xor dh, byte ptr [rsi]"},
+	{true, 3, "fidiv dword ptr ss:[rdi]"},
+	{true, 2, "fidiv dword ptr [rdi]"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 2, "jnl 0x0000000000000fb0"},
+	{true, 1, "scasb"},
+	{false, 1, 0},
+	{true, 6, "adc rax, 0x6897ba42"},
+	{true, 5, "adc eax, 0x6897ba42"},
+	{true, 6, "mov edx, 0xffffffffd7826897"},
+	{true, 5, "mov edx, 0xffffffffd7826897"},
+	{true, 1, "xchg edi, eax"},
+	{true, 5, "push 0xfffffffff017d782"},
+	{false, 1, 0},
+	{true, 1, "xlat"},
+	{false, 1, 0},
+	{true, 3, "lock mov dh, 108"},
+	{true, 2, "mov dh, 108"},
+	{true, 1, "insb"},
+	{true, 2, "jb 0x000000000000104f"},
+	{true, 4, "imul r9, r15, 0xd6"},
+	{true, 3, "imul ecx, edi, 0xd6"},
+	{true, 1, "iret"},
+	{false, 1, 0},
+	{true, 2, "sub dword ptr [rbx], esp"},
+	{true, 2, "and esi, dword ptr [rdx]"},
+	{true, 6, "xor al, byte ptr [rdx+0x119dbccc]"},
+	{false, 1, 0},
+	{true, 1, "int3"},
+	{true, 5, "mov esp, 0xffffffffa07e119d"},
+	{true, 1, "popfd"},
+	{true, 3, "adc dword ptr [rsi-96], edi"},
+	{true, 2, "jle 0x0000000000000fa2"},
+	{true, 5, "mov al, byte ptr [0xffffffffb2a087ad]"},
+	{true, 1, "lodsd"},
+	{true, 6, "xchg esp, dword ptr [rax+0xffffffff891d0eb2]"},
+	{true, 5, "mov al, byte ptr [0xffffffff891d0eb2]"},
+	{true, 2, "mov dl, 14"},
+	{false, 1, 0},
+	{true, 5, "sbb eax, 0xffffffffccb9f489"},
+	{true, 2, "mov esp, esi"},
+	{true, 1, "hlt"},
+	{true, 5, "mov ecx, 0xffffffffeef821cc"},
+	{true, 1, "int3"},
+	{true, 2, "and eax, edi"},
+	{true, 1, "clc"},
+	{true, 1, "out dx, al"},
+	{true, 1, "wait"},
+	{true, 3, "or al, 0xf1"},
+	{true, 2, "or al, 0xf1"},
+	{false, 1, 0},
+	{true, 5, "test eax, 0xfffffffffa8425c4"},
+	{false, 1, 0},
+	{true, 5, "and eax, 0xffffffff8774fa84"},
+	{true, 2, "test dl, bh"},
+	{true, 1, "cli"},
+	{true, 2, "jz 0x0000000000000f89"},
+	{true, 2, "xchg esp, dword ptr [rdi]"},
+	{false, 1, 0},
+	{true, 6, "add dword ptr [rax+0x54f1123a], ebx"},
+	{true, 1, "cwde"},
+	{true, 2, "cmp dl, byte ptr [rdx]"},
+	{true, 2, "adc dh, cl"},
+	{false, 1, 0},
+	{true, 1, "push rsp"},
+	{true, 5, "sub eax, 0x26c8c4ef"},
+	{true, 1, "out dx, eax"},
+	{false, 1, 0},
+	{true, 4, "enter 0x5826, 8"},
+	{true, 2, "pop rax"},
+	{true, 1, "pop rax"},
+	{true, 2, "or cl, ch"},
+	{true, 5, "jmp 0x000000001e6c2376"},
+	{true, 2, "jno 0x0000000000001015"},
+	{true, 4, "adc ebp, dword ptr [rsi+rbx+69]"},
+	{true, 1, "insb"},
+	{false, 1, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 1, "hlt"},
+	{true, 5, "sbb eax, 0x70db7c82"},
+	{false, 1, 0},
+	{true, 2, "jl 0x0000000000000fdd"},
+	{false, 2, 0},
+	{true, 2, "jo 0x0000000000000fa4"},
+	{true, 5, "mov byte ptr [0x18d304a8], al"},
+	{true, 2, "test al, 4"},
+	{true, 2, "add al, 0xd3"},
+	{true, 2, "rcr dword ptr [rax], cl"},
+	{true, 3, "sbb byte ptr [rbx-101], ah"},
+	{true, 6, "movsxd ebx, dword ptr [rbx+0x17b1acac]"},
+	{true, 1, "wait"},
+	{true, 1, "lodsb"},
+	{true, 1, "lodsb"},
+	{true, 2, "mov cl, 23"},
+	{false, 1, 0},
+	{true, 2, "mov ah, 78"},
+	{true, 2, "outsb"},
+	{true, 1, "outsb"},
+	{true, 2, "and al, 116"},
+	{true, 2, "jz 0x0000000000000fe5"},
+	{true, 2, "jcez 0x0000000000001031"},
+	{false, 1, 0},
+	{true, 1, "push rdx"},
+	{true, 2, "jle 0x0000000000000fd2"},
+	{true, 2, "rcl dh, 1"},
+	{false, 1, 0},
+	{true, 4, "xor byte ptr [rcx+71], 0xf7"},
+	{true, 2, "jno 0x0000000000001049"},
+	{true, 7, "test dword ptr [r14], 0xffffffffa5ee54aa"},
+	{true, 6, "test dword ptr [rsi], 0xffffffffa5ee54aa"},
+	{false, 1, 0},
+	{true, 1, "stosb"},
+	{true, 1, "push rsp"},
+	{true, 1, "out dx, al"},
+	{true, 1, "movsd"},
+	{true, 3, "retf 0xffffffffffffbca6"},
+	{true, 1, "cmpsb"},
+	{true, 5, "mov esp, 0xffffffffa61eec30"},
+	{true, 2, "xor ah, ch"},
+	{true, 1, "in al, dx"},
+	{false, 1, 0},
+	{true, 1, "cmpsb"},
+	{true, 6, "mul dword ptr [rbx+0xffffffffb6f68c19]"},
+	{true, 5, "mov dword ptr [0xffffffffb6f68c19], eax"},
+	{true, 7, "sbb dword ptr [rsi+rsi*8+0xffffffffc20a7eb6], ecx"},
+	{true, 2, "mov esi, seg7"},
+	{true, 6, "div byte ptr [rsi+0xffffffff9bc20a7e]"},
+	{true, 2, "mov dh, 126"},
+	{true, 2, "jle 0x000000000000100c"},
+	{true, 2, "or al, dl"},
+	{true, 3, "ret 0xffffffffffff869b"},
+	{true, 1, "wait"},
+	{true, 3, "xchg dl, byte ptr [rax+47]"},
+	{true, 1, "push rax"},
+	{false, 1, 0},
+	{true, 2, "mov ah, 78"},
+	{true, 4, "rol rdx, 75"},
+	{true, 3, "rol edx, 75"},
+	{true, 3, "ret 0x1e4b"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 4, "fimul dword ptr [rdi+119]"},
+	{true, 3, "fimul dword ptr [rdi+119]"},
+	{true, 3, "jnbe 0x0000000000000f94"},
+	{true, 2, "jnbe 0x0000000000000f93"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 1, "popfd"},
+	{true, 1, "int3"},
+	{true, 6, "fisubr word ptr [rcx+0xffffffffd86b2ca3]"},
+	{true, 5, "test eax, 0xffffffffd86b2ca3"},
+	{true, 5, "mov dword ptr [0x65d86b2c], eax"},
+	{true, 2, "sub al, 107"},
+	{true, 3, "imul ebx, eax, 101"},
+	{true, 3, "fsub dword ptr [rbp+47]"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "adc dh, bl"},
+	{true, 4, "fisub word ptr [rsp+rbp*4-86]"},
+	{true, 2, "lodsb"},
+	{true, 1, "lodsb"},
+	{true, 1, "stosb"},
+	{true, 2, "adc ebx, dword ptr [rcx]"},
+	{true, 6, "sbb dword ptr [rip+0x6ba046ca], eax"},
+	{true, 5, "add eax, 0x6ba046ca"},
+	{true, 3, "retf 0xffffffffffffa046"},
+	{true, 6, "mov al, byte ptr [0x2358406b]"},
+	{true, 5, "mov al, byte ptr [0x2358406b]"},
+	{true, 4, "imul eax, dword ptr [rax+88], 35"},
+	{true, 2, "pop rax"},
+	{true, 1, "pop rax"},
+	{true, 2, "and edx, edi"},
+	{true, 1, "xlat"},
+	{true, 7, "imul ebx, dword ptr [rax+0xffffffffdd43c307], 0xd9"},
+	{true, 1, "cwde"},
+	{false, 1, 0},
+	{true, 1, "ret"},
+	{true, 3, "fstp st(1)"},
+	{true, 2, "fstp st(1)"},
+	{true, 7, "fldcw word ptr [rbx+0x5749f766]"},
+	{true, 1, "lodsb"},
+	{true, 3, "and esp, dword ptr [rsi-9]"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "push r15"},
+	{true, 1, "push rdi"},
+	{true, 2, "jb 0x0000000000001000"},
+	{true, 6, "dec byte ptr [rax+0x4df79e6a]"},
+	{true, 3, "mov byte ptr [rdx-98], ch"},
+	{true, 2, "push 0x9e"},
+	{true, 1, "sahf"},
+	{false, 2, 0},
+	{true, 3, "sub r8b, 1"},
+	{true, 2, "sub al, 1"},
+	{true, 3, "add dword ptr [rax-22], eax"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "test dword ptr [rax], ecx"},
+	{true, 3, "or byte ptr [rsp+rbx*2], bh"},
+	{true, 2, "cmp al, 92"},
+	{true, 1, "pop rsp"},
+	{true, 1, "std"},
+	{true, 6, "adc edi, dword ptr [rdx+0x26cc074b]"},
+	{true, 5, "mov edx, 0x26cc074b"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "int3"},
+	{true, 4, "rcl byte ptr es:[rcx], 75"},
+	{true, 3, "rcl byte ptr [rcx], 75"},
+	{true, 3, "adc dword ptr [rbx+114], ecx"},
+	{true, 3, "jb 0x0000000000000fa7"},
+	{true, 2, "jb 0x0000000000000fa6"},
+	{true, 1, "movsb"},
+	{true, 2, "in al, dx"},
+	{true, 1, "in al, dx"},
+	{true, 3, "ret 0x3bfc"},
+	{true, 1, "cld"},
+	{true, 2, "cmp ebp, ebx"},
+	{true, 2, "jmp 0x0000000000000fdc"},
+	{false, 2, 0},
+	{true, 2, "out 0xfd, al"},
+	{true, 1, "std"},
+	{false, 1, 0},
+	{true, 2, "push rbx"},
+	{true, 1, "push rbx"},
+	{true, 1, "pop rbx"},
+	{true, 2, "push rax"},
+	{true, 1, "push rax"},
+	{false, 1, 0},
+	{true, 1, "xchg ecx, eax"},
+	{false, 2, 0},
+	{true, 1, "pushfd"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 10, "imul esp, dword ptr [rax+0xffffffffcfe3c8e1], 0x7f5337fc"},
+	{true, 5, "mov al, byte ptr [0xffffffffcfe3c8e1]"},
+	{true, 2, "loope 0x0000000000000fca"},
+	{true, 4, "enter 0xffffffffffffcfe3, 0xfc"},
+	{true, 2, "jcez 0x0000000000000fd1"},
+	{true, 1, "iret"},
+	{true, 1, "cld"},
+	{false, 1, 0},
+	{true, 1, "push rbx"},
+	{true, 2, "jnle 0x0000000000000fec"},
+	{false, 1, 0},
+	{true, 2, "xor dword ptr [rdx], esi"},
+	{true, 7, "xor bl, byte ptr [rbp+rdi*8+0xffffffff8110bb6e]"},
+	{true, 1, "pushfd"},
+	{true, 1, "std"},
+	{true, 1, "outsb"},
+	{true, 5, "mov ebx, 0x49a38110"},
+	{true, 6, "adc byte ptr [rcx+0x74ee49a3], al"},
+	{true, 10, "and dword ptr [rbx+0xffffffff8f74ee49], 0xffffffffc504616e"},
+	{true, 5, "mov dword ptr [0xffffffff8f74ee49], eax"},
+	{true, 2, "out dx, al"},
+	{true, 1, "out dx, al"},
+	{true, 2, "jz 0x0000000000000f91"},
+	{false, 2, 0},
+	{true, 1, "outsb"},
+	{false, 1, 0},
+	{true, 2, "add al, 0xc5"},
+	{false, 1, 0},
+	{true, 3, "rcl byte ptr [rdi-51], cl"},
+	{true, 1, "push rdi"},
+	{true, 2, "int 56"},
+	{true, 2, "cmp dl, dl"},
+	{true, 2, "shr ch, cl"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "iret"},
+	{true, 2, "mov ah, dl"},
+	{false, 1, 0},
+	{true, 1, "cdq"},
+	{true, 2, "xor dword ptr [rdi], ecx"},
+	{false, 2, 0},
+	{true, 1, "insb"},
+	{true, 6, "sbb dword ptr [rdi+0x041f30aa], esi"},
+	{true, 2, "mov bh, 0xaa"},
+	{true, 1, "stosb"},
+	{true, 2, "xor byte ptr [rdi], bl"},
+	{false, 1, 0},
+	{true, 2, "add al, 71"},
+	{true, 2, "pop r11"},
+	{true, 1, "pop rbx"},
+	{true, 5, "mov ecx, 0xffffffff82243391"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 3, "xor esp, dword ptr [rdx+rax*4]"},
+	{true, 2, "and al, 0x82"},
+	{false, 1, 0},
+	{true, 6, "imul esp, dword ptr [rcx], 0xfffffffff9aa8bdc"},
+	{true, 2, "and esp, ebx"},
+	{true, 6, "fmul qword ptr [rbx+0x07caf9aa]"},
+	{true, 6, "mov ebp, dword ptr [rdx+0xffffffffbc07caf9]"},
+	{true, 1, "stosb"},
+	{true, 1, "stc"},
+	{true, 3, "retf 0xffffffffffffbc07"},
+	{false, 1, 0},
+	{true, 5, "mov esp, 0x4eb8c667"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 5, "mov eax, 0x1d981e4e"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "cwde"},
+	{true, 5, "sbb eax, 0x580ef015"},
+	{true, 5, "adc eax, 0x44580ef0"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "pop rax"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 2, "loope 0x0000000000000fcc"},
+	{true, 3, "retf 0x4320"},
+	{true, 3, "and byte ptr [rbx-19], al"},
+	{true, 2, "in eax, dx"},
+	{true, 1, "in eax, dx"},
+	{true, 4, "test qword ptr [rsi-100], r9"},
+	{true, 3, "test dword ptr [rsi-100], ecx"},
+	{true, 2, "pushfq"},
+	{true, 1, "pushfd"},
+	{true, 2, "jmp 0x0000000000001069"},
+	{true, 3, "adc ch, ah"},
+	{true, 2, "adc ch, ah"},
+	{true, 2, "in eax, 0xab"},
+	{true, 1, "stosd"},
+	{false, 1, 0},
+	{true, 1, "outsb"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 7, "sar byte ptr [rdi+0x2663961a], 0xf2"},
+	{true, 5, "mov edi, 0x2663961a"},
+	{true, 6, "sbb dl, byte ptr [rsi+0x61f22663]"},
+	{true, 1, "xchg esi, eax"},
+	{true, 2, "movsxd esp, dword ptr [rsi]"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 6, "xor dh, byte ptr [rdx+0x36b9c754]"},
+	{true, 2, "mov dl, 84"},
+	{true, 1, "push rsp"},
+	{false, 2, 0},
+	{true, 5, "mov ecx, 0x51047b36"},
+	{true, 3, "jnp 0x0000000000001007"},
+	{true, 2, "jnp 0x0000000000001006"},
+	{true, 2, "add al, 81"},
+	{true, 1, "push rcx"},
+	{true, 5, "jmp 0xffffffffbe71ffc8"},
+	{true, 1, "ret"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "jno 0x0000000000000fc0"},
+	{true, 5, "mov esi, 0xffffffff82bbb0d3"},
+	{true, 6, "sal dword ptr [rax+0x3e8882bb], cl"},
+	{true, 2, "mov al, 0xbb"},
+	{true, 5, "mov ebx, 0xffffffffc23e8882"},
+	{false, 1, 0},
+	{true, 2, "mov byte ptr [rsi], bh"},
+	{true, 4, "ret 0xffffffffffffa0b7"},
+	{true, 3, "ret 0xffffffffffffa0b7"},
+	{true, 2, "mov bh, 0xa0"},
+	{true, 5, "mov al, byte ptr [0x2b329da0]"},
+	{true, 5, "mov al, byte ptr [0xffffffffdf2b329d]"},
+	{true, 1, "popfd"},
+	{true, 2, "xor ch, byte ptr [rbx]"},
+	{true, 2, "sub ebx, edi"},
+	{true, 6, "fild qword ptr [rip+0x2dcdb276]"},
+	{true, 5, "sub eax, 0x2dcdb276"},
+	{true, 2, "jbe 0x0000000000000fb4"},
+	{true, 2, "mov dl, 0xcd"},
+	{true, 2, "int 45"},
+	{true, 5, "sub eax, 0xfffffffffe7924cf"},
+	{true, 1, "iret"},
+	{true, 2, "and al, 121"},
+	{true, 2, "jns 0x0000000000001000"},
+	{false, 2, 0},
+	{true, 4, "test byte ptr cs:[rbp+48], ch"},
+	{true, 3, "test byte ptr [rbp+48], ch"},
+	{true, 1, "insd"},
+	{true, 2, "xor al, cl"},
+	{true, 4, "enter 0xffffffffffffae55, 0xd0"},
+	{true, 1, "push rbp"},
+	{true, 1, "scasb"},
+	{true, 3, "shr byte ptr [rbp-63], 1"},
+	{true, 1, "insd"},
+	{true, 4, "sal dword ptr [rcx+116], 0xa8"},
+	{true, 2, "jno 0x0000000000001076"},
+	{true, 2, "jz 0x0000000000000faa"},
+	{true, 2, "test al, 0x8b"},
+	{true, 6, "mov ebx, dword ptr [rbp+0x05ba9c07]"},
+	{true, 1, "popfd"},
+	{false, 1, 0},
+	{true, 1, "pushfd"},
+	{true, 5, "mov edx, 0x03995505"},
+	{true, 5, "add eax, 0x61039955"},
+	{true, 1, "push rbp"},
+	{true, 1, "cdq"},
+	{true, 3, "add esp, dword ptr [rcx+86]"},
+	{false, 1, 0},
+	{true, 1, "push rsi"},
+	{true, 6, "xor ebx, 0xffffffffe1dd3a11"},
+	{true, 3, "rep adc dword ptr [rdx], edi"},
+	{true, 2, "adc dword ptr [rdx], edi"},
+	{true, 2, "cmp bl, ch"},
+	{true, 2, "fucom st(1)"},
+	{true, 2, "loope 0x0000000000000f94"},
+	{true, 1, "xchg edx, eax"},
+	{true, 6, "cmp byte ptr [rsi+0x5517bc96], bh"},
+	{true, 5, "mov esi, 0x5517bc96"},
+	{true, 1, "xchg esi, eax"},
+	{true, 5, "mov esp, 0xffffffffc1b85517"},
+	{false, 1, 0},
+	{true, 1, "push rbp"},
+	{true, 5, "mov eax, 0xfffffffffb5279c1"},
+	{true, 4, "sar dword ptr [rcx+82], 0xfb"},
+	{true, 2, "jns 0x0000000000001054"},
+	{true, 1, "push rdx"},
+	{true, 1, "sti"},
+	{true, 2, "out 0xea, al"},
+	{false, 1, 0},
+	{true, 1, "std"},
+	{true, 2, "or bh, bh"},
+	{true, 7, "jmpf fword ptr [rbp+rdx+0x6c40ab29]"},
+	{true, 1, "lodsb"},
+	{true, 5, "adc eax, 0x6c40ab29"},
+	{true, 6, "sub dword ptr [rbx+0x54b96c40], ebp"},
+	{true, 1, "stosd"},
+	{true, 2, "insb"},
+	{true, 1, "insb"},
+	{true, 5, "mov ecx, 0x4d3eb454"},
+	{true, 1, "push rsp"},
+	{true, 2, "mov ah, 62"},
+	{true, 4, "in rax, 0xb0"},
+	{true, 3, "in rax, 0xb0"},
+	{true, 2, "in eax, 0xb0"},
+	{true, 2, "mov al, 85"},
+	{true, 1, "push rbp"},
+	{true, 5, "mov byte ptr [0x46df3e4a], al"},
+	{false, 2, 0},
+	{true, 4, "fild word ptr ds:[rsi-87]"},
+	{true, 3, "fild word ptr [rsi-87]"},
+	{true, 6, "test eax, 0x62070b5c"},
+	{true, 5, "test eax, 0x62070b5c"},
+	{true, 1, "pop rsp"},
+	{true, 2, "or eax, dword ptr [rdi]"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 3, "sbb al, 0xc7"},
+	{true, 2, "sbb al, 0xc7"},
+	{false, 2, 0},
+	{true, 2, "jbe 0x0000000000000ff9"},
+	{true, 3, "not dword ptr [rbx+rbx*4]"},
+	{true, 2, "adc al, 0x9b"},
+	{true, 1, "wait"},
+	{true, 2, "mov dword ptr [rbx], ebx"},
+	{true, 6, "sbb eax, dword ptr [rdx+0x6621b64c]"},
+	{false, 1, 0},
+	{true, 3, "mov dh, 33"},
+	{true, 2, "mov dh, 33"},
+	{true, 3, "and dword ptr [rsi-16], esp"},
+	{true, 8, "lock and word ptr [rsi+0xffffffffafe7015a], sp"},
+	{true, 7, "lock and dword ptr [rsi+0xffffffffafe7015a], esp"},
+	{true, 6, "and dword ptr [rsi+0xffffffffafe7015a], esp"},
+	{true, 1, "cmpsb"},
+	{true, 1, "pop rdx"},
+	{true, 2, "add edi, esp"},
+	{true, 2, "out 0xaf, eax"},
+	{true, 1, "scasd"},
+	{true, 6, "sbb ecx, 0xffffffffec2f88e9"},
+	{true, 2, "fldl2t"},
+	{true, 5, "jmp 0x0000000059ec3f8d"},
+	{true, 2, "mov byte ptr [rdi], ch"},
+	{false, 1, 0},
+	{true, 1, "in al, dx"},
+	{true, 1, "pop rcx"},
+	{true, 1, "pop rdi"},
+	{true, 1, "pop rax"},
+	{false, 2, 0},
+	{true, 6, "or dword ptr [rdi+0x0e6eccba], ebx"},
+	{true, 1, "lahf"},
+	{true, 5, "mov edx, 0xffffffffca0e6ecc"},
+	{true, 1, "int3"},
+	{true, 1, "outsb"},
+	{false, 1, 0},
+	{true, 3, "retf 0x77aa"},
+	{true, 1, "stosb"},
+	{true, 2, "jnbe 0x0000000000000fa7"},
+	{true, 1, "movsd"},
+	{false, 1, 0},
+	{true, 1, "lahf"},
+	{true, 2, "adc byte ptr [rbx], dh"},
+	{true, 2, "xor esp, dword ptr [rcx]"},
+	{true, 3, "and dword ptr [rbp+116], ebp"},
+	{true, 1, "insd"},
+	{true, 2, "jz 0x0000000000000fb2"},
+	{true, 2, "mov al, 0xb0"},
+	{true, 2, "mov al, 29"},
+	{true, 5, "sbb eax, 0x77946237"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "jnbe 0x0000000000001011"},
+	{true, 3, "lss esp, (invalid)"},
+	{true, 2, "mov dl, 0xe7"},
+	{true, 2, "out 60, eax"},
+	{true, 2, "cmp al, 102"},
+	{true, 2, "retf"},
+	{true, 1, "retf"},
+	{false, 1, 0},
+	{true, 6, "sub ah, byte ptr [rax+0x2cad6ef8]"},
+	{true, 5, "mov al, byte ptr [0x2cad6ef8]"},
+	{true, 1, "clc"},
+	{true, 1, "outsb"},
+	{true, 1, "lodsd"},
+	{true, 2, "sub al, 0xba"},
+	{true, 5, "mov edx, 0xffffffffac4c6540"},
+	{false, 2, 0},
+	{true, 3, "lodsb"},
+	{true, 2, "lodsb"},
+	{true, 1, "lodsb"},
+	{true, 1, "pop rcx"},
+	{true, 1, "pop rbx"},
+	{true, 1, "movsd"},
+	{false, 1, 0},
+	{true, 2, "add eax, dword ptr [rbx]"},
+	{true, 6, "add eax, dword ptr [rsi+0xfffffffff8f1e855]"},
+	{true, 3, "xchg dl, byte ptr [rbp-24]"},
+	{true, 1, "push rbp"},
+	{true, 5, "call 0xfffffffff3e708f6"},
+	{false, 1, 0},
+	{true, 1, "clc"},
+	{true, 2, "out 0xf3, al"},
+	{true, 2, "rep pop rbx"},
+	{true, 1, "pop rbx"},
+	{true, 4, "mov dl, byte ptr [rdi+rax+83]"},
+	{true, 1, "push rsp"},
+	{false, 1, 0},
+	{true, 1, "push rbx"},
+	{true, 2, "fld st(7)"},
+	{false, 2, 0},
+	{true, 2, "movsxd eax, ecx"},
+	{true, 3, "shl ecx, 102"},
+	{true, 2, "loope 0x0000000000001068"},
+	{true, 3, "shl byte ptr [rdx], 1"},
+	{true, 2, "shl byte ptr [rdx], 1"},
+	{true, 2, "and al, byte ptr [rdi]"},
+	{false, 1, 0},
+	{true, 2, "jz 0x0000000000000f91"},
+	{true, 2, "pop qword ptr [rdx]"},
+	{true, 2, "add ah, dl"},
+	{true, 2, "loop 0x0000000000001029"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 2, "cmp cl, ch"},
+	{true, 2, "int 72"},
+	{true, 3, "and al, 0xea"},
+	{true, 2, "and al, 0xea"},
+	{false, 1, 0},
+	{true, 5, "sub eax, 0xffffffff8335998c"},
+	{true, 6, "mov dword ptr [rcx+0xffffffffb8b48335], ds"},
+	{true, 1, "cdq"},
+	{true, 5, "xor eax, 0xffffffffbfb8b483"},
+	{true, 8, "xor dword ptr [rax+rdi*4+0x276630bf], 0xe8"},
+	{true, 2, "mov ah, 0xb8"},
+	{true, 5, "mov eax, 0x276630bf"},
+	{true, 5, "mov edi, 0xffffffffe8276630"},
+	{true, 3, "xor byte ptr [rsi+39], ah"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 5, "call 0xffffffffc54cd910"},
+	{true, 2, "or ecx, ecx"},
+	{true, 1, "leave"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "movsd"},
+	{true, 2, "in al, 119"},
+	{true, 2, "jnbe 0x0000000000000fe4"},
+	{true, 2, "loop 0x0000000000001059"},
+	{true, 1, "push rdi"},
+	{true, 2, "mov ah, 0xcf"},
+	{true, 1, "iret"},
+	{true, 5, "mov edx, 0xfffffffff3fe0f10"},
+	{true, 2, "adc byte ptr [rdi], cl"},
+	{true, 3, "paddd mm6, mm3"},
+	{false, 2, 0},
+	{true, 3, "rep loopne 0x000000000000103e"},
+	{true, 2, "loopne 0x000000000000103d"},
+	{true, 7, "cmp ebx, dword ptr [rdx+rbx*2+0xffffffffa15c4d43]"},
+	{true, 1, "pushfd"},
+	{true, 1, "pop rdx"},
+	{false, 2, 0},
+	{true, 2, "pop r12"},
+	{true, 1, "pop rsp"},
+	{true, 5, "mov eax, dword ptr [0xffffffffdaf9432e]"},
+	{true, 3, "stc"},
+	{true, 2, "stc"},
+	{true, 1, "stc"},
+	{true, 2, "fcmovu st, st(3)"},
+	{true, 2, "fndisi"},
+	{true, 2, "loope 0x0000000000000fe0"},
+	{true, 6, "fidiv word ptr [rdx+0x6e984c55]"},
+	{true, 2, "mov dl, 85"},
+	{true, 1, "push rbp"},
+	{true, 2, "cdqe"},
+	{true, 1, "cwde"},
+	{true, 1, "outsb"},
+	{true, 1, "ret"},
+	{true, 2, "cld"},
+	{true, 1, "cld"},
+	{true, 1, "cmpsd"},
+	{true, 2, "jz 0x0000000000000ff3"},
+	{false, 1, 0},
+	{true, 2, "sbb ch, al"},
+	{false, 1, 0},
+	{true, 1, "scasb"},
+	{true, 1, "pop rbx"},
+	{true, 6, "fidivr dword ptr [rip+0xffffffff8a826a36]"},
+	{true, 5, "cmp eax, 0xffffffff8a826a36"},
+	{true, 3, "push 0x82"},
+	{true, 2, "push 0x82"},
+	{false, 1, 0},
+	{true, 6, "mov bl, byte ptr [rdi+0x53ecc991]"},
+	{true, 1, "lahf"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 1, "leave"},
+	{true, 1, "in al, dx"},
+	{true, 1, "push rbx"},
+	{true, 2, "or al, 0xce"},
+	{false, 1, 0},
+	{true, 2, "jcez 0x0000000000001065"},
+	{true, 7, "movsxd edi, dword ptr [rbp+rax*8+0x5ec60e6a]"},
+	{true, 5, "mov esp, 0xffffffffc60e6ac5"},
+	{false, 1, 0},
+	{true, 2, "push 14"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 1, "pop rsi"},
+	{true, 1, "hlt"},
+	{true, 2, "adc ebp, edx"},
+	{false, 1, 0},
+	{true, 2, "imul dword ptr [rax]"},
+	{true, 6, "sub byte ptr [rsi+0xffffffff945b81a3], dh"},
+	{true, 2, "mov dh, 0xa3"},
+	{true, 5, "mov dword ptr [0x03945b81], eax"},
+	{true, 7, "sbb dword ptr [rbx-108], 0x28d13203"},
+	{true, 1, "pop rbx"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "add esi, dword ptr [rdx]"},
+	{true, 2, "xor dl, cl"},
+	{true, 2, "shr dword ptr [rax], 1"},
+	{true, 3, "sub byte ptr [rbp-17], cl"},
+	{true, 2, "out dx, rax"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "mov ah, 25"},
+	{true, 3, "sbb dword ptr [rax+120], edx"},
+	{true, 1, "push rax"},
+	{true, 2, "js 0x0000000000000fd2"},
+	{true, 3, "ror byte ptr [rcx-122], 1"},
+	{true, 4, "xchg dl, byte ptr [r9+20]"},
+	{true, 3, "xchg dl, byte ptr [rcx+20]"},
+	{true, 1, "push rcx"},
+	{true, 2, "adc al, 0x9e"},
+	{true, 1, "sahf"},
+	{true, 3, "lock jz 0x0000000000000fcc"},
+	{true, 2, "jz 0x0000000000000fcb"},
+	{true, 1, "leave"},
+	{true, 6, "mov gs, word ptr [rdi+0x626d8fb8]"},
+	{true, 1, "scasd"},
+	{true, 5, "mov eax, 0xffffffffff626d8f"},
+	{false, 2, 0},
+	{true, 1, "insd"},
+	{false, 1, 0},
+	{true, 3, "callf fword ptr [rsi+rsi*2]"},
+	{true, 2, "sbb al, 118"},
+	{true, 2, "jbe 0x0000000000001045"},
+	{true, 8, "and sil, byte ptr [r11+r11*4+0x0c689e00]"},
+	{true, 7, "and dh, byte ptr [rbx+rbx*4+0x0c689e00]"},
+	{true, 2, "mov ah, 0x9b"},
+	{true, 1, "wait"},
+	{true, 6, "add byte ptr [rsi+0xfffffffffb5b0c68], bl"},
+	{true, 1, "sahf"},
+	{true, 5, "push 0x0efb5b0c"},
+	{true, 2, "or al, 91"},
+	{true, 1, "pop rbx"},
+	{true, 1, "sti"},
+	{false, 1, 0},
+	{true, 6, "mov dword ptr [rax+0x29680400], eax"},
+	{true, 3, "add byte ptr [rax], 4"},
+	{true, 3, "add byte ptr [rax+rbp*2], al"},
+	{true, 2, "add al, 104"},
+	{true, 5, "push 0x66a49829"},
+	{true, 6, "sub dword ptr [rax+0xffffffff827466a4], ebx"},
+	{true, 1, "cwde"},
+	{true, 1, "movsb"},
+	{true, 3, "jz 0x0000000000000f85"},
+	{true, 2, "jz 0x0000000000000f84"},
+	{false, 1, 0},
+	{true, 6, "test dword ptr [rip+0xffffffffa977bc7f], ebp"},
+	{true, 5, "sub eax, 0xffffffffa977bc7f"},
+	{true, 2, "jnle 0x0000000000000fbe"},
+	{true, 5, "mov esp, 0xffffffffadc9a977"},
+	{true, 2, "jnbe 0x0000000000000fab"},
+	{true, 5, "test eax, 0x0b3dadc9"},
+	{true, 1, "leave"},
+	{true, 1, "lodsd"},
+	{true, 5, "cmp eax, 0x0815480b"},
+	{true, 3, "or ecx, dword ptr [rax+21]"},
+	{true, 6, "adc rax, 0xffffffffb54a9908"},
+	{true, 5, "adc eax, 0xffffffffb54a9908"},
+	{true, 6, "or byte ptr [rcx+0x3cb8b54a], bl"},
+	{true, 1, "cdq"},
+	{true, 3, "mov ch, 0xb8"},
+	{true, 2, "mov ch, 0xb8"},
+	{true, 5, "mov eax, 0xffffffffd2bd0c3c"},
+	{true, 2, "cmp al, 12"},
+	{true, 2, "or al, 0xbd"},
+	{true, 5, "mov ebp, 0xfffffffffa1cc8d2"},
+	{true, 2, "ror al, cl"},
+	{true, 4, "enter 0xfffffffffffffa1c, 63"},
+	{true, 2, "sbb al, 0xfa"},
+	{true, 1, "cli"},
+	{false, 1, 0},
+	{true, 3, "or dword ptr [rsi-68], ebp"},
+	{true, 1, "outsb"},
+	{true, 5, "mov esp, 0xffffffff884191ca"},
+	{true, 3, "retf 0x4191"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 4, "mov byte ptr [r15+68], dl"},
+	{true, 3, "mov byte ptr [rdi+68], dl"},
+	{true, 1, "push rdi"},
+	{true, 2, "scasd"},
+	{true, 1, "scasd"},
+	{true, 3, "and esp, 0xa0"},
+	{true, 2, "in al, 0xa0"},
+	{true, 5, "mov al, byte ptr [0xffffffffcd419917]"},
+	{false, 1, 0},
+	{true, 1, "cdq"},
+	{true, 3, "int 43"},
+	{true, 2, "int 43"},
+	{true, 3, "sub esi, dword ptr [rax-113]"},
+	{true, 2, "jo 0x0000000000000f91"},
+	{false, 2, 0},
+	{true, 5, "push 0x0f7a10d8"},
+	{true, 2, "fcom dword ptr [rax]"},
+	{true, 3, "adc byte ptr [rdx+15], bh"},
+	{true, 2, "jp 0x0000000000001011"},
+	{true, 4, "psubusw mm1, qword ptr [rsi+54]"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 2, "lodsb"},
+	{true, 1, "lodsb"},
+	{true, 2, "sbb ebp, edi"},
+	{true, 1, "std"},
+	{true, 6, "cmp eax, dword ptr [rdx+0xfffffffff9bfd4cd]"},
+	{false, 1, 0},
+	{true, 2, "int 0xd4"},
+	{false, 1, 0},
+	{true, 5, "mov edi, 0xfffffffff71e4ef9"},
+	{true, 1, "stc"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "imul dword ptr [rdx]"},
+	{true, 6, "sub dh, byte ptr [rdi+0x42280e24]"},
+	{true, 2, "mov bh, 36"},
+	{true, 2, "and al, 14"},
+	{false, 1, 0},
+	{true, 3, "sub byte ptr [rdx+90], al"},
+	{true, 2, "pop rdx"},
+	{true, 1, "pop rdx"},
+	{true, 2, "loop 0x0000000000001016"},
+	{true, 2, "adc al, 99"},
+	{true, 4, "movsxd ecx, dword ptr [rcx+rax*4-33]"},
+	{true, 7, "sbb rdi, 0xffffffffde6646a2"},
+	{true, 6, "sbb edi, 0xffffffffde6646a2"},
+	{true, 6, "fbld tbyte ptr [rdx+0x39de6646]"},
+	{true, 5, "mov byte ptr [0x39de6646], al"},
+	{false, 2, 0},
+	{true, 3, "fidivr word ptr [rcx]"},
+	{true, 2, "fidivr word ptr [rcx]"},
+	{true, 2, "cmp esi, eax"},
+	{false, 2, 0},
+	{true, 2, "jnb 0x0000000000001011"},
+	{true, 8, "psraw (invalid), 0xbc"},
+	{true, 2, "jno 0x0000000000000fa5"},
+	{true, 5, "mov dword ptr [0xfffffffff9bd2dae], eax"},
+	{true, 1, "scasb"},
+	{true, 5, "sub eax, 0x75bcf9bd"},
+	{true, 5, "mov ebp, 0xffffffff9375bcf9"},
+	{true, 1, "stc"},
+	{true, 5, "mov esp, 0x1edb9375"},
+	{true, 2, "jnz 0x0000000000000f95"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 2, "fistp dword ptr [rsi]"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 5, "mov eax, 0xffffffff89451b2d"},
+	{true, 5, "sub eax, 0xffffffffd689451b"},
+	{true, 3, "sbb eax, dword ptr [rbp-119]"},
+	{true, 3, "mov r14d, r10d"},
+	{true, 2, "mov esi, edx"},
+	{false, 1, 0},
+	{true, 3, "cmp dword ptr [rcx-64], ebp"},
+	{true, 6, "imul eax, eax, 0xfffffffff1a0d716"},
+	{true, 3, "rcl byte ptr [rsi], 0xd7"},
+	{false, 1, 0},
+	{true, 1, "xlat"},
+	{true, 5, "mov al, byte ptr [0xffffffffa5ff34f1]"},
+	{false, 1, 0},
+	{true, 2, "xor al, 0xff"},
+	{true, 6, "jmp qword ptr [rbp+0x1cc8c23d]"},
+	{true, 1, "movsd"},
+	{true, 5, "cmp eax, 0xffffffff821cc8c2"},
+	{true, 3, "ret 0x1cc8"},
+	{true, 4, "enter 0xffffffffffff821c, 81"},
+	{true, 2, "sbb al, 0x82"},
+	{false, 1, 0},
+	{true, 1, "push rcx"},
+	{false, 1, 0},
+	{true, 2, "mov dh, 67"},
+	{true, 3, "neg r14d"},
+	{true, 2, "neg esi"},
+	{true, 2, "fimul word ptr [rcx]"},
+	{true, 3, "or dword ptr [rcx-126], ebx"},
+	{true, 1, "pop rcx"},
+	{false, 1, 0},
+	{true, 3, "ret 0x572c"},
+	{true, 2, "sub al, 87"},
+	{true, 1, "push rdi"},
+	{true, 2, "jns 0x0000000000001052"},
+	{true, 1, "push rax"},
+	{false, 1, 0},
+	{true, 5, "mov esi, 0xffffffffe5b492d6"},
+	{false, 1, 0},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "mov ah, 0xe5"},
+	{true, 2, "in eax, 0x86"},
+	{true, 2, "xchg ah, byte ptr [rsi]"},
+	{true, 2, "int3"},
+	{true, 1, "int3"},
+	{true, 1, "cmpsd"},
+	{true, 1, "pushfd"},
+	{true, 1, "int3"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "retf 0xffffffffffffaf59"},
+	{true, 1, "pop rcx"},
+	{true, 1, "scasd"},
+	{true, 2, "adc dword ptr [rdx], esi"},
+	{true, 2, "xor bl, ah"},
+	{true, 3, "fdiv qword ptr [rsi+49]"},
+	{true, 2, "jbe 0x0000000000001033"},
+	{true, 2, "xor edx, ecx"},
+	{true, 3, "retf 0x0aa9"},
+	{true, 5, "test eax, 0xffffffffdc2da70a"},
+	{true, 6, "or ah, byte ptr [rdi+0xffffffff8a26dc2d]"},
+	{true, 1, "cmpsd"},
+	{true, 5, "sub eax, 0x188a26dc"},
+	{true, 2, "fsub qword ptr [rsi]"},
+	{true, 3, "mov bl, byte ptr es:[rax]"},
+	{true, 2, "mov bl, byte ptr [rax]"},
+	{true, 2, "sbb byte ptr [rcx], ch"},
+	{true, 6, "sub dword ptr [rax+0x799b91ad], esp"},
+	{true, 5, "mov al, byte ptr [0x799b91ad]"},
+	{true, 1, "lodsd"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 1, "wait"},
+	{true, 2, "jns 0x0000000000000fbe"},
+	{true, 5, "mov esp, 0x1ba608d3"},
+	{true, 2, "ror dword ptr [rax], cl"},
+	{true, 6, "or byte ptr [rsi+0xffffffff9b56001b], ah"},
+	{true, 1, "cmpsb"},
+	{true, 2, "sbb eax, dword ptr [rax]"},
+	{true, 3, "add byte ptr [rsi-101], dl"},
+	{true, 1, "push rsi"},
+	{true, 1, "wait"},
+	{true, 2, "jle 0x0000000000000f87"},
+	{true, 3, "test dword ptr [rcx-99], esi"},
+	{true, 2, "jno 0x0000000000000f9f"},
+	{true, 1, "popfd"},
+	{false, 2, 0},
+	{true, 3, "or bpl, r8b"},
+	{true, 2, "or ch, al"},
+	{false, 1, 0},
+	{true, 1, "movsd"},
+	{true, 1, "movsd"},
+	{true, 2, "or dl, bl"},
+	{true, 3, "shl dword ptr [rsi-14], cl"},
+	{true, 4, "repne jcez 0x0000000000000fbc"},
+	{true, 3, "repne jcez 0x0000000000000fbb"},
+	{true, 2, "jcez 0x0000000000000fba"},
+	{true, 5, "mov eax, 0xffffffffe177149f"},
+	{true, 1, "lahf"},
+	{true, 2, "adc al, 119"},
+	{true, 2, "jnbe 0x0000000000000fe3"},
+	{true, 2, "loope 0x0000000000001004"},
+	{true, 6, "add bl, byte ptr [rcx+0xffffffffa2fa45db]"},
+	{true, 1, "cdq"},
+	{true, 3, "fild dword ptr [rbp-6]"},
+	{true, 2, "cli"},
+	{true, 1, "cli"},
+	{true, 5, "mov byte ptr [0xffffffff96872dd6], al"},
+	{false, 1, 0},
+	{true, 5, "sub eax, 0xffffffffc61a9687"},
+	{true, 6, "xchg edx, dword ptr [rsi+0xffffffff88dcc61a]"},
+	{true, 1, "xchg esi, eax"},
+	{true, 2, "sbb al, dh"},
+	{false, 2, 0},
+	{true, 6, "fmul qword ptr [rax+0x68ba6842]"},
+	{true, 3, "mov byte ptr [rdx+104], al"},
+	{true, 6, "push 0xffffffffa48b68ba"},
+	{true, 5, "push 0xffffffffa48b68ba"},
+	{true, 5, "mov edx, 0xffffffff8aa48b68"},
+	{true, 5, "push 0xffffffffed8aa48b"},
+	{true, 7, "mov esp, dword ptr [rdx+rcx*4+0x3d1052ed]"},
+	{true, 1, "movsb"},
+	{true, 2, "mov ch, ch"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "push rdx"},
+	{true, 6, "adc byte ptr [rip+0xffffffffe4d2513e], bh"},
+	{true, 5, "cmp eax, 0xffffffffe4d2513e"},
+	{true, 2, "push rcx"},
+	{true, 1, "push rcx"},
+	{true, 2, "shl ah, cl"},
+	{true, 2, "in al, 99"},
+	{true, 6, "movsxd ebx, dword ptr [rcx+0x4f6f0eed]"},
+	{true, 1, "cdq"},
+	{true, 1, "in eax, dx"},
+	{false, 1, 0},
+	{true, 1, "outsd"},
+	{false, 2, 0},
+	{true, 3, "in rax, 105"},
+	{true, 2, "in eax, 105"},
+	{true, 6, "imul esp, dword ptr [rsi], 0xffffffffa0ff0895"},
+	{true, 2, "xchg ebp, eax"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 2, "or bh, bh"},
+	{true, 6, "jmp qword ptr [rax+0x04e926a5]"},
+	{true, 5, "mov al, byte ptr [0x04e926a5]"},
+	{true, 1, "movsd"},
+	{true, 6, "jmp 0x000000001e5efa0a"},
+	{true, 5, "jmp 0x000000001e5efa09"},
+	{true, 2, "add al, 0xea"},
+	{false, 1, 0},
+	{true, 1, "pop rsi"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 1, "insd"},
+	{true, 1, "pop rcx"},
+	{true, 5, "mov edx, 0xffffffffaa2599b9"},
+	{true, 5, "mov ecx, 0xffffffffddaa2599"},
+	{true, 1, "cdq"},
+	{true, 5, "and eax, 0xffffffffd0caddaa"},
+	{true, 1, "stosb"},
+	{false, 2, 0},
+	{true, 3, "retf 0x1dd0"},
+	{true, 6, "rcr byte ptr [rip+0xffffffffaac99bc9], 1"},
+	{true, 5, "sbb eax, 0xffffffffaac99bc9"},
+	{true, 1, "leave"},
+	{true, 1, "wait"},
+	{true, 1, "leave"},
+	{true, 1, "stosb"},
+	{true, 1, "scasd"},
+	{true, 1, "in al, dx"},
+	{true, 4, "test byte ptr [rcx+50], 0xb5"},
+	{true, 7, "xor sil, byte ptr [r13+0xffffffff8ea0d394]"},
+	{true, 6, "xor dh, byte ptr [rbp+0xffffffff8ea0d394]"},
+	{true, 2, "mov ch, 0x94"},
+	{true, 1, "xchg esp, eax"},
+	{true, 6, "shl dword ptr [rax+0xffffffffefc1d38e], cl"},
+	{true, 5, "mov al, byte ptr [0xffffffffefc1d38e]"},
+	{true, 2, "mov ss, bx"},
+	{true, 2, "rol ecx, cl"},
+	{true, 3, "shr edi, 0xfa"},
+	{true, 1, "out dx, eax"},
+	{true, 1, "cli"},
+	{true, 5, "sub eax, 0xffffffff8a777906"},
+	{false, 1, 0},
+	{true, 2, "jns 0x0000000000001079"},
+	{true, 2, "jnbe 0x0000000000000f8c"},
+	{true, 2, "mov ah, byte ptr [rbx]"},
+	{true, 3, "and esi, dword ptr [rdi+70]"},
+	{true, 2, "jnbe 0x0000000000001048"},
+	{true, 6, "adc eax, 0xffffffffdcfa3fce"},
+	{true, 5, "adc eax, 0xffffffffdcfa3fce"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 1, "cli"},
+	{true, 3, "fcomp qword ptr [rcx+61]"},
+	{true, 1, "pop rcx"},
+	{true, 5, "cmp eax, 0xffffffffb3e32ac3"},
+	{true, 1, "ret"},
+	{true, 2, "sub ah, bl"},
+	{true, 2, "jcez 0x0000000000000fb5"},
+	{true, 2, "mov bl, 120"},
+	{true, 2, "js 0x0000000000000fa6"},
+	{true, 1, "movsb"},
+	{true, 4, "xor byte ptr [rsi+38], spl"},
+	{true, 3, "xor byte ptr [rsi+38], ah"},
+	{true, 3, "lodsb"},
+	{true, 2, "lodsb"},
+	{true, 1, "lodsb"},
+	{true, 2, "rcr ebx, 1"},
+	{true, 3, "fistp dword ptr [rbx+40]"},
+	{true, 1, "pop rbx"},
+	{true, 2, "sub byte ptr [rbx], bh"},
+	{true, 3, "cmp esi, dword ptr [rax+30]"},
+	{true, 2, "jo 0x0000000000001020"},
+	{false, 1, 0},
+	{true, 2, "mov bh, 84"},
+	{true, 1, "push rsp"},
+	{true, 7, "sbb dl, byte ptr [rcx+rax*2+0x4106f0c4]"},
+	{true, 1, "xchg esp, eax"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 6, "mov ecx, 0x3d2e307f"},
+	{true, 5, "mov ecx, 0x3d2e307f"},
+	{true, 2, "jnle 0x0000000000001032"},
+	{true, 2, "xor byte ptr [rsi], ch"},
+	{true, 6, "cmp eax, 0x4813b229"},
+	{true, 5, "cmp eax, 0x4813b229"},
+	{true, 6, "sub dword ptr [rdx+0xffffffff83684813], esi"},
+	{true, 2, "mov dl, 19"},
+	{true, 3, "adc ecx, dword ptr [rax+104]"},
+	{true, 6, "push 0xffffffffb37e5983"},
+	{true, 5, "push 0xffffffffb37e5983"},
+	{true, 4, "sbb dword ptr [rcx+126], 0xb3"},
+	{true, 1, "pop rcx"},
+	{true, 2, "jle 0x0000000000000fb5"},
+	{true, 2, "mov bl, 32"},
+	{true, 2, "and ch, ch"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "loop 0x0000000000001039"},
+	{false, 1, 0},
+	{true, 5, "xor eax, 0xffffffffc92a2520"},
+	{true, 6, "and byte ptr [rip+0xffffffffae67c92a], ah"},
+	{true, 5, "and eax, 0xffffffffae67c92a"},
+	{true, 2, "sub cl, cl"},
+	{true, 1, "leave"},
+	{true, 2, "scasb"},
+	{true, 1, "scasb"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "sub al, 0xd8"},
+	{true, 3, "fsubr dword ptr [rbp-18]"},
+	{true, 1, "insd"},
+	{true, 1, "out dx, al"},
+	{true, 1, "pushfd"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 6, "xor dword ptr [rcx+0xffffffffafbfe2d5], edi"},
+	{true, 5, "mov ecx, 0xffffffffafbfe2d5"},
+	{false, 1, 0},
+	{true, 2, "loop 0x0000000000000fc1"},
+	{true, 5, "mov edi, 0xffffffffb9b686af"},
+	{true, 1, "scasd"},
+	{true, 6, "xchg dh, byte ptr [rsi+0xffffffffd7e61db9]"},
+	{true, 2, "mov dh, 0xb9"},
+	{true, 5, "mov ecx, 0x36d7e61d"},
+	{true, 5, "sbb eax, 0xffffffffc836d7e6"},
+	{true, 2, "out 0xd7, al"},
+	{true, 1, "xlat"},
+	{true, 5, "enter 0xfffffffffffffdab, 0xde"},
+	{true, 4, "enter 0xfffffffffffffdab, 0xde"},
+	{true, 1, "stosd"},
+	{true, 1, "std"},
+	{true, 2, "fiadd word ptr [rcx]"},
+	{true, 2, "add ebp, edx"},
+	{false, 1, 0},
+	{true, 1, "out dx, eax"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 11, "imul ecx, dword ptr [rsp+rdx+0xffffffffc897eafb], 0x6b459876"},
+	{true, 3, "mov dword ptr [rbx+rdi*8], ss"},
+	{true, 2, "adc al, 0xfb"},
+	{true, 1, "sti"},
+	{false, 1, 0},
+	{true, 1, "xchg edi, eax"},
+	{true, 4, "enter 0xffffffffffff9876, 69"},
+	{true, 2, "jbe 0x0000000000000f9a"},
+	{true, 1, "cwde"},
+	{true, 4, "imul r9d, dword ptr [r14], 104"},
+	{true, 3, "imul ecx, dword ptr [rsi], 104"},
+	{false, 1, 0},
+	{true, 5, "push 0xffffffffc671e388"},
+	{true, 2, "mov bl, ah"},
+	{true, 2, "jcez 0x0000000000001073"},
+	{true, 2, "jno 0x0000000000000fc8"},
+	{false, 2, 0},
+	{true, 2, "sbb dword ptr [rdi], ecx"},
+	{true, 7, "movaps xmm1, xmmword ptr [rip+0xffffffffc23ba448]"},
+	{true, 6, "sub byte ptr [rip+0xffffffffc23ba448], cl"},
+	{true, 5, "or eax, 0xffffffffc23ba448"},
+	{true, 2, "movsb"},
+	{true, 1, "movsb"},
+	{true, 2, "cmp eax, edx"},
+	{true, 3, "ret 0xffffffffffffc883"},
+	{true, 3, "or eax, 0xa3"},
+	{true, 4, "enter 0xffffffffffff94a3, 0xa8"},
+	{true, 5, "mov dword ptr [0x7470a894], eax"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "test al, 112"},
+	{true, 2, "jo 0x0000000000001076"},
+	{true, 2, "jz 0x0000000000001016"},
+	{true, 2, "adc al, 10"},
+	{true, 3, "or bh, byte ptr [rdx-57]"},
+	{true, 2, "jp 0x0000000000000fc9"},
+	{false, 2, 0},
+	{true, 2, "xor al, 69"},
+	{true, 4, "mov r13b, byte ptr [r9-127]"},
+	{true, 3, "mov ch, byte ptr [rcx-127]"},
+	{true, 10, "imul eax, dword ptr [rcx+0x2045a5c2], 0xffffffff8a918e09"},
+	{true, 6, "add edx, 0x092045a5"},
+	{true, 3, "ret 0x45a5"},
+	{true, 1, "movsd"},
+	{true, 3, "and byte ptr [r9], r9b"},
+	{true, 2, "and byte ptr [rcx], cl"},
+	{true, 6, "or dword ptr [rsi+0xffffffffe3ca8a91], ecx"},
+	{true, 6, "mov ss, word ptr [rcx+0xffffffffbbe3ca8a]"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "mov cl, dl"},
+	{true, 3, "retf 0xffffffffffffbbe3"},
+	{true, 2, "jcez 0x0000000000000fbd"},
+	{true, 5, "mov ebx, 0x12f7a907"},
+	{false, 1, 0},
+	{true, 5, "test eax, 0xffffffffcdec12f7"},
+	{true, 2, "not dword ptr [rdx]"},
+	{true, 2, "adc ch, ah"},
+	{true, 1, "in al, dx"},
+	{true, 2, "int 110"},
+	{true, 1, "outsb"},
+	{true, 5, "xor eax, 0x3c9b2794"},
+	{true, 1, "xchg esp, eax"},
+	{false, 1, 0},
+	{true, 1, "wait"},
+	{true, 2, "cmp al, 31"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 2, "test al, 0xed"},
+	{true, 1, "in eax, dx"},
+	{true, 3, "sub r8b, 11"},
+	{true, 2, "sub al, 11"},
+	{true, 2, "or ebx, eax"},
+	{true, 2, "fsubr dword ptr [rsi]"},
+	{true, 2, "push rbp"},
+	{true, 1, "push rbp"},
+	{true, 2, "jbe 0x0000000000001037"},
+	{true, 5, "xor eax, 0xffffffff8aa7b73c"},
+	{true, 2, "cmp al, 0xb7"},
+	{true, 2, "mov bh, 0xa7"},
+	{true, 1, "cmpsd"},
+	{true, 2, "mov bl, byte ptr [rdi]"},
+	{false, 1, 0},
+	{true, 1, "lodsd"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "or al, 0xd2"},
+	{true, 2, "shl byte ptr [rdi], cl"},
+	{false, 1, 0},
+	{true, 2, "in eax, 0xdf"},
+	{true, 2, "fbstp tbyte ptr [rcx]"},
+	{true, 3, "xor dword ptr [rax-51], ecx"},
+	{true, 3, "int 12"},
+	{true, 2, "int 12"},
+	{true, 2, "or al, 68"},
+	{true, 4, "rol ebp, 65"},
+	{true, 3, "rol ebp, 65"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 3, "jmp 0x0000000000000fb8"},
+	{true, 2, "jmp 0x0000000000000fb7"},
+	{true, 2, "mov ch, 76"},
+	{true, 7, "mov cr4, word ptr [rdi+0xfffffffff5e156f4]"},
+	{true, 6, "mov fs, word ptr [rdi+0xfffffffff5e156f4]"},
+	{true, 1, "cmpsd"},
+	{true, 1, "hlt"},
+	{true, 1, "push rsi"},
+	{true, 2, "loope 0x0000000000000ff7"},
+	{true, 1, "cmc"},
+	{true, 5, "mov ebx, 0x4a57f9df"},
+	{false, 2, 0},
+	{true, 1, "stc"},
+	{true, 1, "push rdi"},
+	{true, 3, "jnl 0x0000000000001075"},
+	{true, 2, "jnl 0x0000000000001074"},
+	{true, 2, "jb 0x0000000000000fe6"},
+	{true, 2, "in al, 0xdc"},
+	{true, 4, "fcom qword ptr [rsp+rbx*4+43]"},
+	{true, 1, "push rsp"},
+	{true, 1, "pushfd"},
+	{true, 4, "sub ecx, dword ptr [rsp+rdx*2+9]"},
+	{true, 2, "push rsp"},
+	{true, 1, "push rsp"},
+	{true, 2, "or ebp, ecx"},
+	{true, 2, "int 0x83"},
+	{true, 3, "xor dword ptr [rsi], 0xd7"},
+	{true, 2, "xlat"},
+	{true, 1, "xlat"},
+	{true, 6, "fsubr dword ptr [rcx+0x07e5be34]"},
+	{true, 5, "test eax, 0x07e5be34"},
+	{true, 2, "xor al, 0xbe"},
+	{true, 5, "mov esi, 0xffffffffd88b07e5"},
+	{true, 2, "in eax, 7"},
+	{false, 1, 0},
+	{true, 2, "mov ebx, eax"},
+	{true, 2, "fdiv st, st(2)"},
+	{true, 6, "repne mov esi, 0x2afd33b1"},
+	{true, 5, "mov esi, 0x2afd33b1"},
+	{true, 2, "mov cl, 51"},
+	{true, 2, "xor edi, ebp"},
+	{true, 1, "std"},
+	{true, 3, "sub dl, byte ptr [rsi+24]"},
+	{true, 1, "push rsi"},
+	{true, 3, "sbb byte ptr [rbp+19], ah"},
+	{true, 7, "adc ebx, dword ptr gs:[rip+0x1799001a]"},
+	{true, 6, "adc ebx, dword ptr [rip+0x1799001a]"},
+	{true, 5, "sbb eax, 0x1799001a"},
+	{true, 2, "sbb al, byte ptr [rax]"},
+	{true, 6, "add byte ptr [rcx+0xffffffffdefbdd17], bl"},
+	{true, 1, "cdq"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 1, "sti"},
+	{true, 2, "fiadd word ptr [rbx]"},
+	{true, 7, "add ebp, dword ptr [rbp+rsi*2+0xffffffffdbb84871]"},
+	{true, 1, "lodsb"},
+	{true, 2, "jnz 0x0000000000001073"},
+	{true, 2, "jno 0x000000000000104a"},
+	{true, 10, "mov rax, 0x07e0b60131ae7ddb"},
+	{true, 5, "mov eax, 0x31ae7ddb"},
+	{true, 3, "fstp tbyte ptr [rbp-82]"},
+	{true, 2, "jnl 0x0000000000000fb0"},
+	{true, 1, "scasb"},
+	{true, 2, "xor dword ptr [rcx], eax"},
+	{true, 6, "add dword ptr [rsi+0xffffffffff0507e0], esi"},
+	{true, 2, "mov dh, 0xe0"},
+	{true, 2, "loopne 0x0000000000001009"},
+	{false, 1, 0},
+	{true, 5, "add eax, 0xffffffffe47da2ff"},
+	{true, 6, "jmp qword ptr [rdx+0xffffffffd2dbe47d]"},
+	{true, 5, "mov byte ptr [0xffffffffd2dbe47d], al"},
+	{true, 2, "jnl 0x0000000000000fe6"},
+	{true, 2, "in al, 0xdb"},
+	{true, 2, "fcmovnbe st, st(2)"},
+	{true, 3, "sal byte ptr [rdx-39], cl"},
+	{true, 2, "jb 0x0000000000000fdb"},
+	{true, 6, "fstp dword ptr [rdx+0x40796f20]"},
+	{false, 1, 0},
+	{true, 3, "and byte ptr [rdi+121], ch"},
+	{true, 1, "outsd"},
+	{true, 2, "jns 0x0000000000001042"},
+	{true, 4, "lea ebp, [rdi-112]"},
+	{true, 3, "lea ebp, [rdi-112]"},
+	{true, 1, "outsd"},
+	{true, 1, "nop"},
+	{true, 2, "xor al, 0xa5"},
+	{true, 1, "movsd"},
+	{true, 2, "jb 0x0000000000000fbb"},
+	{true, 5, "mov ecx, 0xffffffffbfc07bad"},
+	{true, 1, "lodsd"},
+	{true, 2, "jnp 0x0000000000000fc2"},
+	{true, 7, "sar byte ptr [rdi+0xffffffffb7fe69dc], 0xd9"},
+	{true, 5, "mov edi, 0xffffffffb7fe69dc"},
+	{true, 3, "fsubr qword ptr [rcx-2]"},
+	{true, 6, "imul edi, esi, 0xfffffffff284d9b7"},
+	{false, 2, 0},
+	{true, 2, "mov bh, 0xd9"},
+	{true, 7, "fld dword ptr [rdx+rsi*8+0x15e250d9]"},
+	{true, 2, "test dl, dh"},
+	{true, 4, "repne fst dword ptr [rax-30]"},
+	{true, 3, "fst dword ptr [rax-30]"},
+	{true, 1, "push rax"},
+	{true, 2, "loop 0x0000000000001017"},
+	{true, 5, "adc eax, 0xffffffffde8be823"},
+	{true, 2, "and ebp, eax"},
+	{true, 5, "call 0x0000000076acee90"},
+	{true, 2, "mov ebx, esi"},
+	{true, 7, "fisubr word ptr [rsi+rsi*2+0xffffffffe6c9c940]"},
+	{true, 1, "lodsb"},
+	{true, 2, "jbe 0x0000000000001042"},
+	{true, 2, "leave"},
+	{true, 1, "leave"},
+	{true, 1, "leave"},
+	{true, 2, "out 0xee, al"},
+	{true, 1, "out dx, al"},
+	{true, 2, "sub ecx, esp"},
+	{true, 2, "loope 0x0000000000000fe7"},
+	{true, 2, "in eax, 0xf0"},
+	{true, 3, "lock mov bl, 16"},
+	{true, 2, "mov bl, 16"},
+	{true, 3, "adc byte ptr [rax+8], dl"},
+	{true, 1, "push rax"},
+	{true, 2, "or dh, al"},
+	{false, 2, 0},
+	{true, 2, "jle 0x000000000000105e"},
+	{true, 1, "pop rsp"},
+	{true, 3, "sbb edi, dword ptr [rbx+126]"},
+	{true, 2, "jnp 0x0000000000001080"},
+	{true, 2, "jle 0x0000000000000f8c"},
+	{true, 6, "mov dh, byte ptr [rax+0x27486671]"},
+	{true, 2, "mov al, 113"},
+	{true, 2, "jno 0x0000000000001068"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "push rbp"},
+	{true, 3, "xor dword ptr [rdi-71], esp"},
+	{true, 6, "mov ecx, 0x3341d534"},
+	{true, 5, "mov ecx, 0x3341d534"},
+	{true, 2, "xor al, 0xd5"},
+	{false, 1, 0},
+	{true, 7, "xor eax, dword ptr [r8+0xffffffffe472a665]"},
+	{true, 6, "xor eax, dword ptr [rax+0xffffffffe472a665]"},
+	{true, 4, "and byte ptr [rbp-90], 114"},
+	{true, 2, "cmpsb"},
+	{true, 1, "cmpsb"},
+	{true, 2, "jb 0x0000000000000fe6"},
+	{true, 2, "in al, 0xe7"},
+	{true, 2, "out 0x8b, eax"},
+	{true, 6, "mov ebx, dword ptr [rbp+0x2571f3c7]"},
+	{true, 1, "popfd"},
+	{false, 2, 0},
+	{true, 3, "rep jno 0x0000000000001028"},
+	{true, 2, "jno 0x0000000000001027"},
+	{true, 5, "and eax, 0x7e9610a2"},
+	{true, 5, "mov byte ptr [0x027e9610], al"},
+	{true, 6, "adc byte ptr [rsi+0xffffffffdece027e], dl"},
+	{true, 1, "xchg esi, eax"},
+	{true, 2, "jle 0x0000000000001004"},
+	{true, 2, "add cl, dh"},
+	{false, 1, 0},
+	{true, 6, "ficomp word ptr [rdx+0x2a80a35c]"},
+	{false, 1, 0},
+	{true, 1, "pop rsp"},
+	{true, 5, "mov dword ptr [0xffffffff86942a80], eax"},
+	{true, 3, "sub byte ptr [rdx], 0x94"},
+	{true, 7, "sub dl, byte ptr [rsi+rax*4+0x4d4c9371]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "xchg dh, byte ptr [rcx-109]"},
+	{true, 2, "jno 0x0000000000000f95"},
+	{true, 1, "xchg ebx, eax"},
+	{false, 2, 0},
+	{true, 2, "xchg r8, rax"},
+	{true, 1, "nop"},
+	{true, 2, "mov dl, 0xed"},
+	{true, 1, "in eax, dx"},
+	{false, 2, 0},
+	{true, 1, "xchg esi, eax"},
+	{true, 1, "push rax"},
+	{true, 2, "jbe 0x0000000000000f9b"},
+	{true, 1, "cdq"},
+	{true, 5, "mov esp, 0x29d90764"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "fldcw word ptr [rcx]"},
+	{true, 2, "sub dword ptr [rbx], ecx"},
+	{true, 3, "or ebp, dword ptr [rsp+rbp*2]"},
+	{true, 2, "sub al, 108"},
+	{true, 1, "insb"},
+	{true, 3, "and cl, byte ptr [rax-21]"},
+	{true, 3, "jmp 0x0000000000001023"},
+	{true, 2, "jmp 0x0000000000001022"},
+	{true, 2, "and al, dh"},
+	{true, 3, "lock jnp 0x0000000000000f8f"},
+	{true, 2, "jnp 0x0000000000000f8e"},
+	{true, 6, "mov dword ptr [rax+0xffffffff9b2ba390], cs"},
+	{true, 6, "mov byte ptr [rax+0x1d9b2ba3], dl"},
+	{true, 1, "nop"},
+	{true, 5, "mov dword ptr [0x531d9b2b], eax"},
+	{true, 6, "sub ebx, dword ptr [rbx+0x0bfe531d]"},
+	{true, 1, "wait"},
+	{true, 5, "sbb eax, 0xfffffffffe0bfe53"},
+	{true, 1, "push rbx"},
+	{true, 2, "dec byte ptr [rbx]"},
+	{true, 2, "or edi, esi"},
+	{false, 2, 0},
+	{true, 2, "jnz 0x0000000000001069"},
+	{true, 3, "iret"},
+	{true, 2, "iret"},
+	{true, 1, "iret"},
+	{true, 3, "ret 0xffffffffffffefb9"},
+	{true, 5, "mov ecx, 0xffffffffcafd10ef"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "adc ch, bh"},
+	{true, 1, "std"},
+	{true, 3, "retf 0xffffffffffff903b"},
+	{true, 6, "cmp edx, dword ptr [rax+0xffffffff978a3df2]"},
+	{true, 1, "nop"},
+	{true, 6, "repne cmp eax, 0xffffffff8c32978a"},
+	{true, 5, "cmp eax, 0xffffffff8c32978a"},
+	{true, 6, "mov dl, byte ptr [rdi+0xffffffffd6eb8c32]"},
+	{true, 1, "xchg edi, eax"},
+	{true, 7, "xor cl, byte ptr [rbx+rbp*8+0x0ed78bd6]"},
+	{true, 2, "mov ebx, gs"},
+	{true, 2, "jmp 0x0000000000000fd8"},
+	{false, 1, 0},
+	{true, 2, "mov edx, edi"},
+	{true, 1, "xlat"},
+	{false, 1, 0},
+	{true, 4, "cmovp esi, dword ptr [rax-25]"},
+	{true, 3, "jo 0x0000000000000fea"},
+	{true, 2, "jo 0x0000000000000fe9"},
+	{true, 2, "out 0x84, eax"},
+	{true, 2, "test byte ptr [rax], dh"},
+	{true, 2, "xor byte ptr [rbx], ah"},
+	{true, 2, "and ecx, dword ptr [rax]"},
+	{true, 2, "or byte ptr [rcx], ah"},
+	{true, 3, "and dword ptr [rsi+rax*2], esi"},
+	{true, 2, "xor al, 70"},
+	{true, 6, "mov ebx, 0xffffffffe283fe69"},
+	{true, 5, "mov ebx, 0xffffffffe283fe69"},
+	{true, 6, "imul edi, esi, 0x2021e283"},
+	{true, 6, "inc byte ptr [rbx+0x682021e2]"},
+	{true, 3, "and edx, 33"},
+	{true, 2, "loop 0x0000000000001023"},
+	{true, 2, "and dword ptr [rax], esp"},
+	{true, 3, "and byte ptr [rax-112], ch"},
+	{true, 5, "push 0xffffffffab12bd90"},
+	{true, 1, "nop"},
+	{true, 5, "mov ebp, 0xffffffff8e63ab12"},
+	{true, 6, "adc ch, byte ptr [rbx+0x3ef48e63]"},
+	{true, 1, "stosd"},
+	{true, 6, "movsxd ecx, dword ptr [rsi+0xffffffffa9a73ef4]"},
+	{true, 2, "mov seg7, sp"},
+	{true, 1, "hlt"},
+	{true, 2, "cmpsd"},
+	{true, 1, "cmpsd"},
+	{true, 5, "test eax, 0xffffffff972c1702"},
+	{true, 2, "add dl, byte ptr [rdi]"},
+	{false, 1, 0},
+	{true, 2, "sub al, 0x97"},
+	{true, 1, "xchg edi, eax"},
+	{false, 1, 0},
+	{true, 5, "mov ebp, 0xffffffff9161bee3"},
+	{true, 2, "jcez 0x0000000000000fc0"},
+	{true, 5, "mov esi, 0xffffffff923b9161"},
+	{false, 1, 0},
+	{true, 1, "xchg ecx, eax"},
+	{true, 6, "cmp edx, dword ptr [rdx+0x7b3ee2a8]"},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "test al, 0xe2"},
+	{true, 2, "loop 0x0000000000001040"},
+	{true, 3, "jnp 0x0000000000001041"},
+	{true, 2, "jnp 0x0000000000001040"},
+	{true, 2, "scasb"},
+	{true, 1, "scasb"},
+	{true, 2, "push 0x85"},
+	{true, 6, "test dword ptr [rbp+0xffffffffa3ca5039], eax"},
+	{true, 2, "test dword ptr [rcx], edi"},
+	{true, 3, "cmp dword ptr [rax-54], edx"},
+	{true, 1, "push rax"},
+	{true, 3, "retf 0x50a3"},
+	{true, 5, "mov dword ptr [0x469fee50], eax"},
+	{true, 1, "push rax"},
+	{true, 1, "out dx, al"},
+	{true, 1, "lahf"},
+	{true, 2, "pop rdx"},
+	{true, 1, "pop rdx"},
+	{true, 2, "int 0x81"},
+	{true, 6, "sbb dword ptr [rax], 0x01bddb23"},
+	{true, 2, "sbb byte ptr [rbx], ah"},
+	{true, 2, "and ebx, ebx"},
+	{true, 6, "fstp tbyte ptr [rbp+0xffffffffe3066801]"},
+	{true, 5, "mov ebp, 0xffffffffe3066801"},
+	{true, 3, "add dword ptr [rax+6], ebp"},
+	{true, 5, "push 0x2220e306"},
+	{false, 1, 0},
+	{true, 2, "jcez 0x0000000000001022"},
+	{true, 2, "and byte ptr [rdx], ah"},
+	{true, 6, "and bl, byte ptr [rbp+0x669387e8]"},
+	{true, 1, "popfd"},
+	{true, 5, "call 0x000000001e66a38c"},
+	{true, 6, "xchg edx, dword ptr [rbx+0x12b81e66]"},
+	{true, 1, "xchg ebx, eax"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 5, "mov eax, 0xffffffffe3d47e12"},
+	{true, 3, "adc bh, byte ptr [rsi-44]"},
+	{true, 2, "jle 0x0000000000000fd6"},
+	{false, 1, 0},
+	{true, 2, "jcez 0x0000000000000f97"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 1, "hlt"},
+	{true, 1, "int3"},
+	{true, 2, "fld qword ptr [rbx]"},
+	{true, 3, "add esp, dword ptr [rcx]"},
+	{true, 2, "and al, 97"},
+	{false, 1, 0},
+	{true, 2, "loopne 0x0000000000001039"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 2, "jnz 0x0000000000001007"},
+	{true, 5, "add eax, 0xffffffff821c12d4"},
+	{false, 1, 0},
+	{true, 3, "adc bl, byte ptr [rdx+rax*4]"},
+	{true, 2, "sbb al, 0x82"},
+	{false, 1, 0},
+	{true, 1, "retf"},
+	{true, 1, "leave"},
+	{true, 6, "or ah, byte ptr [rbx+0xffffffff8abd25ad]"},
+	{true, 5, "mov dword ptr [0xffffffff8abd25ad], eax"},
+	{true, 1, "lodsd"},
+	{true, 5, "and eax, 0xffffffffabb18abd"},
+	{true, 5, "mov ebp, 0x69abb18a"},
+	{true, 6, "mov dh, byte ptr [rcx+0xffffffff85a669ab]"},
+	{true, 2, "mov cl, 0xab"},
+	{true, 1, "stosd"},
+	{false, 5, 0},
+	{true, 1, "cmpsb"},
+	{true, 2, "test dword ptr [rsi], edx"},
+	{false, 1, 0},
+	{false, 1, 0},
+};
+
+static const golden_t golden_prefixed32[golden_count] = {
+	{true, 1, "pop eax"},
+	{true, 3, "mov ch, 7"},
+	{true, 2, "mov ch, 7"},
+	{true, 1, "pop es"},
+	{true, 2, "jnl 0x00001011"},
+	{true, 3, "verr word ptr [esi]"},
+	{true, 2, "add byte ptr [esi], ah"},
+	{true, 3, "cld"},
+	{true, 2, "cld"},
+	{true, 1, "cld"},
+	{true, 3, "pop ds"},
+	{true, 2, "pop ds"},
+	{true, 1, "pop ds"},
+	{true, 1, "cmpsb"},
+	{true, 2, "in al, 80"},
+	{true, 1, "push eax"},
+	{true, 5, "mov eax, 0x504ee546"},
+	{true, 1, "inc esi"},
+	{true, 2, "in eax, 78"},
+	{true, 1, "dec esi"},
+	{true, 1, "push eax"},
+	{true, 1, "cmc"},
+	{true, 2, "jnle 0x00001068"},
+	{true, 5, "enter 0x054d, 15"},
+	{true, 4, "enter 0x054d, 15"},
+	{true, 1, "dec ebp"},
+	{true, 5, "add eax, 0x19d53e0f"},
+	{false, 2, 0},
+	{true, 3, "aad 25"},
+	{true, 2, "aad 25"},
+	{true, 2, "sbb edx, ebp"},
+	{true, 7, "jmp far 0x333e:0x4c91fe0e"},
+	{true, 1, "push cs"},
+	{false, 2, 0},
+	{true, 1, "xchg ecx, eax"},
+	{true, 1, "dec esp"},
+	{true, 7, "xor ecx, dword ptr ds:[ebx+0x407d2e40]"},
+	{true, 6, "xor ecx, dword ptr [ebx+0x407d2e40]"},
+	{true, 3, "mov eax, dword ptr [eax+46]"},
+	{true, 1, "inc eax"},
+	{true, 3, "jnl 0x00001043"},
+	{true, 2, "jnl 0x00001042"},
+	{true, 1, "inc eax"},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 5, "mov dword ptr [0xac8de072], eax"},
+	{true, 2, "jb 0x00000fe2"},
+	{true, 2, "loopne 0x00000f8f"},
+	{true, 7, "lea ebp, [ebx+edi*8+0x1682574c]"},
+	{true, 1, "lodsb"},
+	{true, 1, "sti"},
+	{true, 1, "dec esp"},
+	{true, 1, "push edi"},
+	{true, 3, "adc byte ptr [esi], 0xc8"},
+	{true, 1, "push ss"},
+	{true, 4, "enter 0x5465, 22"},
+	{true, 2, "push esp"},
+	{true, 1, "push esp"},
+	{true, 1, "push ss"},
+	{true, 3, "psrlw mm7, mm2"},
+	{true, 2, "sar edx, 1"},
+	{true, 1, "cli"},
+	{true, 1, "clc"},
+	{true, 1, "popad"},
+	{true, 2, "pop ecx"},
+	{true, 1, "pop ecx"},
+	{true, 3, "mov byte ptr [edi+62], dh"},
+	{true, 2, "jnbe 0x00001040"},
+	{true, 2, "dec eax"},
+	{true, 1, "dec eax"},
+	{true, 1, "sti"},
+	{true, 2, "adc al, 0xbd"},
+	{true, 5, "mov ebp, 0x484cf4ae"},
+	{true, 1, "scasb"},
+	{true, 1, "hlt"},
+	{true, 1, "dec esp"},
+	{true, 1, "dec eax"},
+	{true, 2, "sti"},
+	{true, 1, "sti"},
+	{true, 2, "jbe 0x00000ff8"},
+	{true, 2, "imul dl"},
+	{true, 7, "jmp far 0xa8a8:0x9c49ea65"},
+	{true, 8, "jmp far 0xa736:0xa8a89c49"},
+	{true, 7, "jmp far 0xa736:0xa8a89c49"},
+	{true, 1, "dec ecx"},
+	{true, 1, "pushfd"},
+	{true, 2, "test al, 0xa8"},
+	{true, 2, "test al, 54"},
+	{true, 2, "cmpsd"},
+	{true, 1, "cmpsd"},
+	{true, 5, "mov byte ptr [eax-39], 108"},
+	{true, 4, "mov byte ptr [eax-39], 108"},
+	{true, 1, "inc eax"},
+	{true, 4, "fldcw word ptr [ebp+esi*4-116]"},
+	{true, 1, "insb"},
+	{true, 2, "mov ch, 0x8c"},
+	{true, 2, "mov edx, fs"},
+	{true, 2, "loop 0x00001042"},
+	{true, 1, "inc eax"},
+	{true, 1, "pushad"},
+	{true, 2, "insd"},
+	{true, 1, "insd"},
+	{true, 1, "dec esp"},
+	{true, 1, "dec edi"},
+	{true, 2, "pop ebx"},
+	{true, 1, "pop ebx"},
+	{true, 1, "cdq"},
+	{true, 1, "dec ecx"},
+	{true, 3, "imul edi, dword ptr [esi], 68"},
+	{true, 2, "inc esp"},
+	{true, 1, "inc esp"},
+	{true, 3, "bound esi, qword ptr [eax-11]"},
+	{true, 2, "jo 0x00000ff7"},
+	{true, 1, "cmc"},
+	{true, 6, "sub dword ptr [eax+0x0f688454], ebp"},
+	{true, 2, "test al, 84"},
+	{true, 1, "push esp"},
+	{true, 3, "test byte ptr [eax+15], ch"},
+	{true, 5, "push 0xf0653e0f"},
+	{false, 2, 0},
+	{true, 4, "lock push es"},
+	{true, 3, "lock push es"},
+	{true, 2, "lock push es"},
+	{true, 1, "push es"},
+	{true, 1, "dec ebp"},
+	{true, 7, "sub al, byte ptr [ecx+esi*2+0x43b904f0]"},
+	{true, 3, "test byte ptr [ecx-16], dh"},
+	{true, 2, "jno 0x00000ff2"},
+	{true, 3, "lock add al, 0xb9"},
+	{true, 2, "add al, 0xb9"},
+	{true, 5, "mov ecx, 0x44262643"},
+	{true, 1, "inc ebx"},
+	{true, 3, "inc esp"},
+	{true, 2, "inc esp"},
+	{true, 1, "inc esp"},
+	{true, 1, "dec edi"},
+	{true, 3, "xor ecx, dword ptr [esi-24]"},
+	{true, 1, "dec esi"},
+	{true, 5, "call 0x3b05f2b0"},
+	{true, 1, "stosd"},
+	{true, 2, "loop 0x00001007"},
+	{true, 5, "add eax, 0x22e8883b"},
+	{true, 6, "cmp ecx, dword ptr [eax+0x630f22e8]"},
+	{true, 2, "mov al, ch"},
+	{true, 5, "call 0x8b631f27"},
+	{true, 2, "and cl, byte ptr [edi]"},
+	{true, 7, "packsswb mm1, qword ptr [ebx+0x4da244ef]"},
+	{true, 6, "arpl word ptr [ebx+0x4da244ef], cx"},
+	{true, 2, "mov ebp, edi"},
+	{true, 1, "out dx, eax"},
+	{true, 1, "inc esp"},
+	{true, 5, "mov byte ptr [0xcebeb24d], al"},
+	{true, 1, "dec ebp"},
+	{true, 2, "mov dl, 0xbe"},
+	{true, 5, "mov esi, 0x7e6519ce"},
+	{true, 1, "into"},
+	{true, 3, "sbb dword ptr [ebp+126], esp"},
+	{true, 3, "jle 0x00000ffe"},
+	{true, 2, "jle 0x00000ffd"},
+	{true, 1, "sti"},
+	{true, 5, "mov eax, 0x69e89e93"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "sahf"},
+	{true, 5, "call 0xc278816e"},
+	{true, 7, "imul esi, dword ptr [ecx+120], 0x661cc4c2"},
+	{true, 2, "jno 0x0000107a"},
+	{true, 2, "js 0x00000fc4"},
+	{true, 3, "ret 0x1cc4"},
+	{true, 3, "les ebx, fword ptr [esi]"},
+	{true, 2, "sbb al, 102"},
+	{true, 3, "test al, 54"},
+	{true, 2, "test al, 54"},
+	{true, 3, "adc byte ptr ss:[esi], dh"},
+	{true, 2, "adc byte ptr [esi], dh"},
+	{true, 2, "inc eax"},
+	{true, 1, "inc eax"},
+	{true, 1, "dec ebp"},
+	{true, 1, "leave"},
+	{true, 3, "cmp esp, dword ptr [edx+72]"},
+	{true, 3, "bound ecx, qword ptr [eax-108]"},
+	{true, 1, "dec eax"},
+	{true, 1, "xchg esp, eax"},
+	{true, 4, "xchg esi, eax"},
+	{true, 3, "xchg esi, eax"},
+	{true, 2, "xchg esi, eax"},
+	{true, 1, "xchg esi, eax"},
+	{true, 2, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 2, "sar esi, 1"},
+	{false, 2, 0},
+	{true, 4, "repne sbb al, 102"},
+	{true, 3, "sbb al, 102"},
+	{true, 2, "sbb al, 102"},
+	{true, 3, "mov word ptr [edi], cx"},
+	{true, 2, "mov dword ptr [edi], ecx"},
+	{false, 2, 0},
+	{true, 3, "pop esi"},
+	{true, 2, "pop esi"},
+	{true, 1, "pop esi"},
+	{true, 2, "dec esp"},
+	{true, 1, "int3"},
+	{true, 1, "inc eax"},
+	{true, 1, "stc"},
+	{true, 1, "salc"},
+	{true, 2, "jz 0x00001058"},
+	{true, 1, "push esi"},
+	{true, 2, "callf fword ptr [esi]"},
+	{true, 1, "push ds"},
+	{true, 2, "mov dword ptr [esi], seg8"},
+	{true, 4, "les esp, fword ptr ds:[edi+112]"},
+	{true, 3, "les esp, fword ptr [edi+112]"},
+	{true, 3, "jo 0x0000102b"},
+	{true, 2, "jo 0x0000102a"},
+	{true, 6, "sub byte ptr [ebp+0xacd74466], bl"},
+	{true, 1, "popfd"},
+	{true, 2, "inc sp"},
+	{true, 1, "inc esp"},
+	{true, 1, "xlat"},
+	{true, 1, "lodsb"},
+	{true, 1, "dec eax"},
+	{true, 7, "callf far 0x9853:0xf2f3116d"},
+	{true, 1, "insd"},
+	{true, 2, "adc ebx, esi"},
+	{true, 3, "repne push ebx"},
+	{true, 2, "repne push ebx"},
+	{true, 1, "push ebx"},
+	{true, 1, "cwde"},
+	{true, 3, "mov al, byte ptr [edi+71]"},
+	{true, 1, "inc edi"},
+	{true, 1, "inc edi"},
+	{true, 3, "retf 0xfffff326"},
+	{true, 7, "rep mov byte ptr es:[0xcb404d77], al"},
+	{true, 6, "rep mov byte ptr [0xcb404d77], al"},
+	{true, 5, "mov byte ptr [0xcb404d77], al"},
+	{true, 2, "jnbe 0x0000104f"},
+	{true, 1, "dec ebp"},
+	{true, 1, "inc eax"},
+	{true, 1, "retf"},
+	{true, 1, "scasb"},
+	{true, 1, "pop ecx"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "fsub dword ptr [eax]"},
+	{true, 3, "and byte ptr [ebx+77], al"},
+	{true, 1, "inc ebx"},
+	{true, 1, "dec ebp"},
+	{true, 2, "bound edi, (invalid)"},
+	{true, 1, "sti"},
+	{true, 2, "loop 0x00001051"},
+	{true, 1, "dec edi"},
+	{true, 2, "mov dword ptr [edi], ebp"},
+	{true, 1, "das"},
+	{true, 3, "add esp, dword ptr es:[edi]"},
+	{true, 2, "add esp, dword ptr [edi]"},
+	{true, 1, "daa"},
+	{true, 9, "imul sp, word ptr [edi+0x2e654140], 0xffffb948"},
+	{true, 10, "imul esp, dword ptr [edi+0x2e654140], 0xfae1b948"},
+	{true, 1, "cmpsd"},
+	{true, 1, "inc eax"},
+	{true, 1, "inc ecx"},
+	{true, 3, "dec eax"},
+	{true, 2, "dec eax"},
+	{true, 1, "dec eax"},
+	{true, 5, "mov ecx, 0x1786fae1"},
+	{true, 2, "loope 0x00000ffc"},
+	{true, 1, "cli"},
+	{true, 2, "xchg dl, byte ptr [edi]"},
+	{true, 1, "pop ss"},
+	{true, 8, "rep jmp far 0xed4c:0x52673867"},
+	{true, 7, "jmp far 0xed4c:0x52673867"},
+	{true, 4, "cmp byte ptr [bx+82], ah"},
+	{true, 3, "cmp byte ptr [edi+82], ah"},
+	{true, 2, "push edx"},
+	{true, 1, "push edx"},
+	{true, 1, "dec esp"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "repne dec ebp"},
+	{true, 1, "dec ebp"},
+	{true, 4, "mul dword ptr [ebx-111]"},
+	{true, 6, "mov dword ptr fs:[0xace3c491], eax"},
+	{true, 5, "mov dword ptr [0xace3c491], eax"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "les esp, (invalid)"},
+	{true, 2, "jcez 0x00000fae"},
+	{true, 1, "lodsb"},
+	{true, 1, "dec ebp"},
+	{true, 1, "inc esp"},
+	{true, 2, "adc al, 39"},
+	{true, 1, "daa"},
+	{true, 1, "stosb"},
+	{true, 6, "rcr byte ptr [ecx+0x2a9f9326], cl"},
+	{true, 1, "cdq"},
+	{true, 2, "xchg ebx, eax"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "lahf"},
+	{true, 2, "sub cl, byte ptr [edi]"},
+	{false, 2, 0},
+	{true, 2, "jnp 0x0000104f"},
+	{true, 1, "dec ebp"},
+	{true, 2, "mov dh, 64"},
+	{true, 1, "inc eax"},
+	{true, 2, "repne push ds"},
+	{true, 1, "push ds"},
+	{true, 1, "pop ebx"},
+	{true, 3, "mov ah, 0xd2"},
+	{true, 2, "mov ah, 0xd2"},
+	{true, 2, "ror cl, cl"},
+	{true, 1, "leave"},
+	{true, 2, "jp 0x00001004"},
+	{true, 6, "add bl, byte ptr [esi+0x44b4ce2e]"},
+	{true, 1, "sahf"},
+	{true, 2, "into"},
+	{true, 1, "into"},
+	{true, 2, "mov ah, 68"},
+	{true, 1, "inc esp"},
+	{true, 5, "and eax, 0x1b53ec71"},
+	{true, 2, "jno 0x00000fee"},
+	{true, 1, "in al, dx"},
+	{true, 1, "push ebx"},
+	{true, 6, "sbb esi, dword ptr [ecx+0x79641068]"},
+	{true, 2, "mov cl, 104"},
+	{true, 5, "push 0x84796410"},
+	{true, 4, "adc byte ptr [ecx+edi*2-124], ah"},
+	{true, 3, "jns 0x00000f87"},
+	{true, 2, "jns 0x00000f86"},
+	{true, 6, "test byte ptr [ebx+0x7e2ba167], al"},
+	{true, 4, "and dword ptr [edi-95], 43"},
+	{true, 6, "mov eax, dword ptr [0xe6337e2b]"},
+	{true, 5, "mov eax, dword ptr [0xe6337e2b]"},
+	{true, 3, "sub edi, dword ptr [esi+51]"},
+	{true, 2, "jle 0x00001035"},
+	{true, 2, "xor esp, esi"},
+	{true, 2, "out 0xb2, al"},
+	{true, 2, "mov dl, 0xe8"},
+	{true, 5, "call 0x3e36a4da"},
+	{true, 2, "aad 0x94"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "push ecx"},
+	{true, 2, "push ecx"},
+	{true, 1, "push ecx"},
+	{true, 1, "inc esp"},
+	{true, 1, "pushfd"},
+	{true, 5, "or eax, 0x2bbd36dc"},
+	{true, 2, "fdiv qword ptr [esi]"},
+	{true, 6, "mov ebp, 0x88e2642b"},
+	{true, 5, "mov ebp, 0x88e2642b"},
+	{true, 4, "sub esp, dword ptr [edx-120]"},
+	{true, 3, "loop 0x00000f8b"},
+	{true, 2, "loop 0x00000f8a"},
+	{true, 6, "mov byte ptr [edx+0xc04f6578], dh"},
+	{true, 2, "mov dl, 120"},
+	{true, 2, "js 0x00001067"},
+	{true, 2, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 7, "rcl byte ptr [edx+0x892abb26], 115"},
+	{true, 1, "xchg edx, eax"},
+	{true, 6, "mov ebx, 0x3873892a"},
+	{true, 5, "mov ebx, 0x3873892a"},
+	{true, 6, "sub cl, byte ptr [ecx+0x6bbe3873]"},
+	{true, 3, "mov dword ptr [ebx+56], esi"},
+	{true, 2, "jnb 0x0000103a"},
+	{true, 6, "cmp byte ptr [esi+0xb958de6b], bh"},
+	{true, 5, "mov esi, 0xb958de6b"},
+	{true, 3, "imul ebx, esi, 88"},
+	{true, 3, "ficomp word ptr [eax-71]"},
+	{true, 1, "pop eax"},
+	{true, 5, "mov ecx, 0x681f7f64"},
+	{true, 3, "jnle 0x00001022"},
+	{true, 2, "jnle 0x00001021"},
+	{true, 1, "pop ds"},
+	{true, 5, "push 0xf9433825"},
+	{true, 5, "and eax, 0xb8f94338"},
+	{true, 3, "cmp byte ptr [ebx-7], al"},
+	{true, 1, "inc ebx"},
+	{true, 1, "stc"},
+	{true, 5, "mov eax, 0x41835af0"},
+	{true, 2, "lock pop edx"},
+	{true, 1, "pop edx"},
+	{true, 4, "add dword ptr [ecx+38], 0xfc"},
+	{true, 1, "inc ecx"},
+	{true, 2, "cld"},
+	{true, 1, "cld"},
+	{true, 2, "xor al, 105"},
+	{true, 6, "imul eax, eax, 0x2e16b84f"},
+	{true, 4, "ror byte ptr [edi-72], 22"},
+	{true, 1, "dec edi"},
+	{true, 5, "mov eax, 0xc9852e16"},
+	{true, 1, "push ss"},
+	{true, 3, "test ecx, ecx"},
+	{true, 2, "test ecx, ecx"},
+	{true, 1, "leave"},
+	{true, 2, "outsd"},
+	{true, 1, "outsd"},
+	{true, 2, "sal bl, 1"},
+	{true, 3, "rep cmp al, 43"},
+	{true, 2, "cmp al, 43"},
+	{true, 6, "sub edi, dword ptr [0x03d54f89]"},
+	{true, 5, "cmp eax, 0x03d54f89"},
+	{true, 3, "mov dword ptr [edi-43], ecx"},
+	{true, 1, "dec edi"},
+	{true, 2, "aad 3"},
+	{true, 2, "add eax, esp"},
+	{true, 2, "les esp, (invalid)"},
+	{true, 2, "loope 0x00000fbb"},
+	{true, 5, "mov ecx, 0x4a2f4164"},
+	{true, 2, "inc ecx"},
+	{true, 1, "inc ecx"},
+	{true, 1, "das"},
+	{true, 1, "dec edx"},
+	{true, 6, "cmp dword ptr [ebx+0x4f36f2ee], edi"},
+	{true, 5, "mov ebx, 0x4f36f2ee"},
+	{true, 1, "out dx, al"},
+	{true, 3, "repne dec edi"},
+	{true, 2, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 2, "sub al, 18"},
+	{true, 3, "adc dl, byte ptr [ebx-13]"},
+	{true, 1, "push ebx"},
+	{true, 3, "rep jb 0x00000ff5"},
+	{true, 2, "jb 0x00000ff4"},
+	{true, 4, "repne xor byte ptr [eax-42], cl"},
+	{true, 3, "xor byte ptr [eax-42], cl"},
+	{true, 1, "dec eax"},
+	{true, 1, "salc"},
+	{true, 5, "mov edx, 0xf385b444"},
+	{true, 1, "inc esp"},
+	{true, 2, "mov ah, 0x85"},
+	{true, 2, "test ebx, esi"},
+	{true, 2, "rep outsd"},
+	{true, 1, "outsd"},
+	{true, 1, "dec ebp"},
+	{true, 5, "mov edx, 0x242e4464"},
+	{true, 2, "inc esp"},
+	{true, 1, "inc esp"},
+	{true, 3, "and al, 0xad"},
+	{true, 2, "and al, 0xad"},
+	{true, 1, "lodsd"},
+	{true, 1, "inc ecx"},
+	{true, 3, "and cl, byte ptr [edi-101]"},
+	{true, 1, "dec edi"},
+	{true, 1, "wait"},
+	{true, 2, "or cl, ch"},
+	{true, 5, "jmp 0x79a3831a"},
+	{true, 5, "adc eax, 0x6479a373"},
+	{true, 2, "jnb 0x00000fa5"},
+	{true, 5, "mov dword ptr [0x4bc76479], eax"},
+	{true, 2, "jns 0x00001066"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 1, "dec ebx"},
+	{true, 1, "xlat"},
+	{true, 3, "les ecx, fword ptr [eax+11]"},
+	{true, 1, "dec eax"},
+	{true, 2, "or ecx, ecx"},
+	{true, 1, "leave"},
+	{true, 2, "mov cl, 122"},
+	{true, 2, "jp 0x00001046"},
+	{true, 1, "inc esp"},
+	{true, 1, "xchg esi, eax"},
+	{true, 3, "and esp, dword ptr [ebp+38]"},
+	{true, 3, "dec edi"},
+	{true, 2, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 2, "pop ecx"},
+	{true, 1, "pop ecx"},
+	{true, 1, "iret"},
+	{true, 1, "dec esp"},
+	{true, 2, "pop ebx"},
+	{true, 1, "pop ebx"},
+	{true, 3, "mov dword ptr [edi+65], cs"},
+	{true, 1, "dec edi"},
+	{true, 1, "inc ecx"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "and al, 0xa1"},
+	{true, 2, "and al, 0xa1"},
+	{true, 5, "mov eax, dword ptr [0x2128f2cc]"},
+	{true, 1, "int3"},
+	{true, 3, "repne sub byte ptr [ecx], ah"},
+	{true, 2, "sub byte ptr [ecx], ah"},
+	{true, 2, "and dword ptr [esi], edi"},
+	{true, 3, "repne stosb"},
+	{true, 2, "repne stosb"},
+	{true, 1, "stosb"},
+	{true, 1, "dec ebp"},
+	{true, 2, "loopne 0x00001064"},
+	{true, 4, "bound eax, qword ptr [ecx+eax-42]"},
+	{true, 1, "inc esp"},
+	{true, 2, "add esi, edx"},
+	{true, 1, "salc"},
+	{true, 1, "cmpsd"},
+	{true, 1, "das"},
+	{true, 1, "hlt"},
+	{true, 1, "inc esi"},
+	{true, 5, "mov byte ptr gs:[esp+edx*2-110], cl"},
+	{true, 4, "mov byte ptr [esp+edx*2-110], cl"},
+	{true, 1, "dec esp"},
+	{true, 1, "push esp"},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "and al, 0xb7"},
+	{true, 2, "mov bh, 9"},
+	{true, 2, "or eax, esi"},
+	{true, 2, "lock leave"},
+	{true, 1, "leave"},
+	{true, 1, "pop ds"},
+	{true, 3, "fsub qword ptr [esi-127]"},
+	{true, 7, "and word ptr [esi+edi+81], 0xffffced2"},
+	{true, 8, "and dword ptr [esi+edi+81], 0x66f6ced2"},
+	{true, 3, "push ecx"},
+	{true, 2, "push ecx"},
+	{true, 1, "push ecx"},
+	{true, 2, "ror dh, cl"},
+	{true, 1, "into"},
+	{true, 3, "mul byte ptr [esi+29]"},
+	{true, 4, "sbb ax, 0xffffd7c1"},
+	{true, 5, "sbb eax, 0x3385d7c1"},
+	{true, 3, "rcl edi, 0x85"},
+	{true, 1, "xlat"},
+	{true, 2, "test dword ptr [ebx], esi"},
+	{true, 2, "xor esi, ebx"},
+	{true, 3, "rep aaa"},
+	{true, 2, "rep aaa"},
+	{true, 1, "aaa"},
+	{true, 5, "adc eax, 0xec651fd7"},
+	{true, 1, "xlat"},
+	{true, 1, "pop ds"},
+	{true, 2, "in al, dx"},
+	{true, 1, "in al, dx"},
+	{true, 2, "push ecx"},
+	{true, 1, "push ecx"},
+	{true, 2, "jl 0x00001028"},
+	{true, 2, "inc ebx"},
+	{true, 1, "inc ebx"},
+	{true, 1, "cld"},
+	{true, 4, "paddsb mm3, qword ptr gs:[eax]"},
+	{true, 3, "paddsb mm3, qword ptr [eax]"},
+	{true, 1, "in al, dx"},
+	{true, 2, "sbb al, ah"},
+	{true, 2, "loopne 0x00001018"},
+	{true, 1, "push ss"},
+	{true, 1, "pop esi"},
+	{true, 2, "loopne 0x0000104f"},
+	{true, 1, "dec ebp"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "inc esi"},
+	{true, 3, "cmp esi, dword ptr [esi+eax]"},
+	{true, 2, "xor al, 6"},
+	{true, 1, "push es"},
+	{true, 5, "test eax, 0xfb0ff3d8"},
+	{true, 2, "fdiv st, st(3)"},
+	{true, 4, "psubq mm7, mm0"},
+	{true, 3, "psubq mm7, mm0"},
+	{true, 1, "sti"},
+	{true, 1, "clc"},
+	{true, 2, "cmp bh, bl"},
+	{true, 6, "fild qword ptr [ecx+0x0b1c4d3e]"},
+	{true, 5, "test eax, 0x0b1c4d3e"},
+	{true, 2, "dec ebp"},
+	{true, 1, "dec ebp"},
+	{true, 2, "sbb al, 11"},
+	{true, 2, "or edi, dword ptr [eax]"},
+	{true, 3, "cmp byte ptr [ebx-16], bh"},
+	{true, 2, "jnp 0x00000ff2"},
+	{true, 2, "lock into"},
+	{true, 1, "into"},
+	{true, 2, "jnp 0x0000103d"},
+	{true, 6, "cmp ebx, dword ptr [esi+0xfa3befca]"},
+	{true, 1, "sahf"},
+	{true, 3, "retf 0x3bef"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "cmp edi, edx"},
+	{true, 1, "cli"},
+	{true, 1, "dec ebx"},
+	{true, 1, "cmpsd"},
+	{true, 2, "jbe 0x00000ff1"},
+	{true, 1, "out dx, eax"},
+	{false, 2, 0},
+	{true, 2, "jl 0x00001048"},
+	{true, 1, "inc esi"},
+	{true, 2, "cmp edi, esi"},
+	{false, 2, 0},
+	{true, 1, "cmpsd"},
+	{true, 3, "mov bh, 0xa1"},
+	{true, 2, "mov bh, 0xa1"},
+	{true, 5, "mov eax, dword ptr [0x2e22d80a]"},
+	{true, 2, "or bl, al"},
+	{true, 2, "fsub dword ptr [edx]"},
+	{true, 2, "and ch, byte ptr [esi]"},
+	{true, 3, "dec esp"},
+	{true, 2, "dec esp"},
+	{true, 1, "dec esp"},
+	{true, 1, "push cs"},
+	{true, 2, "imul ch"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "jl 0x00001008"},
+	{true, 1, "push es"},
+	{true, 1, "cmc"},
+	{true, 1, "inc eax"},
+	{true, 3, "loope 0x0000103a"},
+	{true, 2, "loope 0x00001039"},
+	{true, 1, "aaa"},
+	{true, 1, "push es"},
+	{true, 1, "in al, dx"},
+	{true, 1, "inc edx"},
+	{true, 5, "adc eax, 0x493e5849"},
+	{true, 1, "dec ecx"},
+	{true, 1, "pop eax"},
+	{true, 2, "dec ecx"},
+	{true, 1, "dec ecx"},
+	{true, 1, "pop ds"},
+	{true, 2, "xchg cx, ax"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "fistp qword ptr [esi]"},
+	{true, 9, "or dh, byte ptr ss:[edi+ecx*2+0x70647445]"},
+	{true, 8, "or dh, byte ptr ss:[edi+ecx*2+0x70647445]"},
+	{true, 7, "or dh, byte ptr [edi+ecx*2+0x70647445]"},
+	{true, 2, "mov ah, 79"},
+	{true, 1, "dec edi"},
+	{true, 1, "inc ebp"},
+	{true, 2, "jz 0x00001066"},
+	{true, 3, "jo 0x00000ff8"},
+	{true, 2, "jo 0x00000ff7"},
+	{true, 1, "cmc"},
+	{true, 5, "mov eax, 0x8e6d57e6"},
+	{true, 2, "out 87, al"},
+	{true, 1, "push edi"},
+	{true, 1, "insd"},
+	{true, 3, "mov es, word ptr [eax+52]"},
+	{true, 1, "inc eax"},
+	{true, 2, "xor al, 0xc0"},
+	{true, 4, "rcl byte ptr [ecx-80], 3"},
+	{true, 1, "push ecx"},
+	{true, 2, "mov al, 3"},
+	{true, 2, "add esi, edx"},
+	{true, 3, "repne add al, 46"},
+	{true, 2, "add al, 46"},
+	{true, 2, "int3"},
+	{true, 1, "int3"},
+	{true, 1, "dec ebp"},
+	{true, 6, "adc ebp, 0x6adff28a"},
+	{true, 2, "aad 0x8a"},
+	{true, 2, "mov dh, dl"},
+	{true, 4, "repne fild qword ptr [edx-55]"},
+	{true, 3, "fild qword ptr [edx-55]"},
+	{true, 2, "push 0xc9"},
+	{true, 1, "leave"},
+	{true, 6, "sbb dword ptr [0x6cadee32], eax"},
+	{true, 5, "add eax, 0x6cadee32"},
+	{true, 2, "xor ch, dh"},
+	{true, 1, "out dx, al"},
+	{true, 1, "lodsd"},
+	{true, 1, "insb"},
+	{true, 5, "push 0x9910f036"},
+	{true, 8, "lock adc byte ptr ss:[ecx+0x93983d4c], bl"},
+	{true, 7, "lock adc byte ptr [ecx+0x93983d4c], bl"},
+	{true, 6, "adc byte ptr [ecx+0x93983d4c], bl"},
+	{true, 1, "cdq"},
+	{true, 1, "dec esp"},
+	{true, 5, "cmp eax, 0x0bfa9398"},
+	{true, 1, "cwde"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "cli"},
+	{true, 6, "or esp, dword ptr [ebp+0x56078d49]"},
+	{true, 1, "movsd"},
+	{true, 1, "dec ecx"},
+	{true, 2, "lea eax, [edi]"},
+	{true, 1, "pop es"},
+	{true, 1, "push esi"},
+	{true, 8, "cmp esp, 0xfbcd23e1"},
+	{true, 7, "cmp esp, 0xfbcd23e1"},
+	{true, 6, "cmp esp, 0xfbcd23e1"},
+	{true, 1, "cld"},
+	{true, 2, "loope 0x00001025"},
+	{true, 2, "and ecx, ebp"},
+	{true, 2, "int 0xfb"},
+	{true, 1, "sti"},
+	{true, 5, "mov ebp, 0x67df0fa8"},
+	{true, 2, "test al, 15"},
+	{true, 4, "pandn mm4, qword ptr [edi-14]"},
+	{true, 3, "fbld tbyte ptr [edi-14]"},
+	{true, 4, "repne dec eax"},
+	{true, 3, "repne dec eax"},
+	{true, 2, "dec eax"},
+	{true, 1, "dec eax"},
+	{true, 5, "mov dword ptr [0x660c5706], eax"},
+	{true, 1, "push es"},
+	{true, 1, "push edi"},
+	{true, 2, "or al, 102"},
+	{true, 2, "dec ax"},
+	{true, 1, "dec eax"},
+	{true, 3, "rep jnp 0x00001048"},
+	{true, 2, "jnp 0x00001047"},
+	{true, 1, "inc ebp"},
+	{true, 2, "outsb"},
+	{true, 1, "outsb"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 4, "ror byte ptr [ecx-50], 79"},
+	{true, 1, "dec ecx"},
+	{true, 1, "into"},
+	{true, 1, "dec edi"},
+	{true, 1, "inc edi"},
+	{true, 2, "mov fs, sp"},
+	{true, 2, "in al, 79"},
+	{true, 1, "dec edi"},
+	{true, 2, "push eax"},
+	{true, 1, "push eax"},
+	{true, 6, "fnstcw word ptr [ebx+0xce1336f6]"},
+	{true, 5, "mov ebx, 0xce1336f6"},
+	{true, 2, "div byte ptr [esi]"},
+	{true, 3, "adc ecx, esi"},
+	{true, 2, "adc ecx, esi"},
+	{true, 1, "into"},
+	{false, 2, 0},
+	{true, 2, "shl byte ptr [esi], 1"},
+	{true, 6, "mov dword ptr es:[0xa2363e24], eax"},
+	{true, 5, "mov dword ptr [0xa2363e24], eax"},
+	{true, 2, "and al, 62"},
+	{true, 7, "mov byte ptr ss:[0x8d414941], al"},
+	{true, 6, "mov byte ptr ss:[0x8d414941], al"},
+	{true, 5, "mov byte ptr [0x8d414941], al"},
+	{true, 1, "inc ecx"},
+	{true, 1, "dec ecx"},
+	{true, 1, "inc ecx"},
+	{true, 3, "lea ecx, [edi+esi*4]"},
+	{true, 2, "or al, 0xb7"},
+	{true, 2, "mov bh, 0xb7"},
+	{true, 2, "mov bh, 0xd0"},
+	{true, 3, "ror byte ptr [edi-34], 1"},
+	{true, 1, "dec edi"},
+	{true, 6, "fisub word ptr [ebx+0x392e2e04]"},
+	{true, 5, "mov dword ptr [0x392e2e04], eax"},
+	{true, 2, "add al, 46"},
+	{true, 8, "cmp dword ptr cs:[esi+0x4c366738], esp"},
+	{true, 7, "cmp dword ptr cs:[esi+0x4c366738], esp"},
+	{true, 6, "cmp dword ptr [esi+0x4c366738], esp"},
+	{true, 1, "cmpsb"},
+	{true, 3, "cmp byte ptr [edi+54], ah"},
+	{true, 3, "dec esp"},
+	{true, 2, "dec esp"},
+	{true, 1, "dec esp"},
+	{true, 3, "loopne 0x0000104f"},
+	{true, 2, "loopne 0x0000104e"},
+	{true, 1, "dec esp"},
+	{true, 1, "pop es"},
+	{true, 3, "and byte ptr [edi-109], bl"},
+	{true, 1, "pop edi"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "push cs"},
+	{true, 4, "enter 0x2edd, 0xf2"},
+	{false, 2, 0},
+	{true, 7, "rep xor byte ptr ss:[esi+esi], ah"},
+	{true, 6, "rep xor byte ptr ss:[esi+esi], ah"},
+	{true, 5, "rep xor byte ptr ss:[esi+esi], ah"},
+	{true, 4, "rep xor byte ptr [esi+esi], ah"},
+	{true, 3, "xor byte ptr [esi+esi], ah"},
+	{true, 2, "and al, 54"},
+	{true, 4, "cmp al, byte ptr ss:[ecx+79]"},
+	{true, 3, "cmp al, byte ptr [ecx+79]"},
+	{true, 1, "inc ecx"},
+	{true, 1, "dec edi"},
+	{true, 7, "jmp far 0x0e1c:0xc76449f1"},
+	{false, 1, 0},
+	{true, 1, "dec ecx"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "sbb al, 14"},
+	{true, 1, "push cs"},
+	{true, 3, "sar dh, 0xfd"},
+	{false, 2, 0},
+	{true, 1, "std"},
+	{true, 1, "push ebx"},
+	{true, 2, "jle 0x00000f93"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "lds eax, (invalid)"},
+	{true, 3, "rol ecx, 57"},
+	{true, 3, "sar dword ptr [ecx], 0xe0"},
+	{true, 2, "cmp eax, esp"},
+	{true, 2, "loopne 0x00000fb5"},
+	{true, 2, "mov bl, 119"},
+	{true, 2, "jnbe 0x00001070"},
+	{true, 1, "outsb"},
+	{true, 5, "dec byte ptr fs:[ebp+ebx*8+15]"},
+	{true, 4, "dec byte ptr [ebp+ebx*8+15]"},
+	{true, 1, "dec esp"},
+	{true, 2, "fisttp qword ptr [edi]"},
+	{true, 5, "shufps xmm4, xmmword ptr [esi+80], 72"},
+	{false, 2, 0},
+	{true, 2, "push ax"},
+	{true, 1, "push eax"},
+	{true, 1, "dec eax"},
+	{true, 2, "xor al, 46"},
+	{true, 3, "add al, 41"},
+	{true, 2, "add al, 41"},
+	{true, 2, "sub dword ptr [esi], ebp"},
+	{true, 2, "sti"},
+	{true, 1, "sti"},
+	{true, 2, "jno 0x00001061"},
+	{true, 1, "pop edi"},
+	{true, 2, "lock cld"},
+	{true, 1, "cld"},
+	{true, 4, "cmovp ecx, dword ptr [ebp+45]"},
+	{true, 1, "dec edx"},
+	{true, 1, "dec ebp"},
+	{true, 5, "sub eax, 0x31bfe32f"},
+	{true, 1, "das"},
+	{true, 2, "jcez 0x00000fc1"},
+	{true, 5, "mov edi, 0x4078b431"},
+	{true, 7, "xor dword ptr [eax+edi*2+0xf2f37340], esi"},
+	{true, 2, "mov ah, 120"},
+	{true, 2, "js 0x00001042"},
+	{true, 1, "inc eax"},
+	{true, 2, "jnb 0x00000ff5"},
+	{true, 7, "repne or eax, 0xe0fc829d"},
+	{true, 6, "repne or eax, 0xe0fc829d"},
+	{true, 5, "or eax, 0xe0fc829d"},
+	{true, 1, "popfd"},
+	{true, 3, "cmp ah, 0xe0"},
+	{true, 1, "cld"},
+	{true, 2, "loopne 0x0000103a"},
+	{true, 2, "cmp byte ptr [edx], cl"},
+	{true, 2, "or ah, bh"},
+	{true, 2, "out 4, eax"},
+	{true, 2, "add al, 0x80"},
+	{true, 3, "sbb byte ptr [edi], 103"},
+	{true, 1, "pop ds"},
+	{true, 2, "inc ecx"},
+	{true, 1, "inc ecx"},
+	{true, 6, "imul esi, edx, 0xf7486e64"},
+	{true, 3, "repne outsb"},
+	{true, 2, "outsb"},
+	{true, 1, "outsb"},
+	{true, 1, "dec eax"},
+	{true, 6, "test edx, 0xff64d883"},
+	{true, 3, "ret 0xffffd883"},
+	{true, 3, "sbb eax, 100"},
+	{true, 4, "fsub dword ptr [edi+edi*8+101]"},
+	{true, 4, "jmp dword ptr fs:[ebp+54]"},
+	{true, 3, "jmp dword ptr [ebp+54]"},
+	{true, 5, "mov cs, word ptr ss:[ebp+64]"},
+	{true, 4, "mov cs, word ptr ss:[ebp+64]"},
+	{true, 3, "mov cs, word ptr [ebp+64]"},
+	{true, 1, "dec ebp"},
+	{true, 1, "inc eax"},
+	{true, 6, "xor eax, 0x5e371e4d"},
+	{true, 5, "xor eax, 0x5e371e4d"},
+	{true, 1, "dec ebp"},
+	{true, 1, "push ds"},
+	{true, 1, "aaa"},
+	{true, 1, "pop esi"},
+	{true, 7, "sub dword ptr [ebp+97], 0x40f29d50"},
+	{true, 1, "insd"},
+	{true, 1, "popad"},
+	{true, 1, "push eax"},
+	{true, 1, "popfd"},
+	{true, 2, "repne inc eax"},
+	{true, 1, "inc eax"},
+	{true, 5, "mov eax, 0x6d64369d"},
+	{true, 1, "popfd"},
+	{true, 3, "insd"},
+	{true, 2, "insd"},
+	{true, 1, "insd"},
+	{true, 1, "sti"},
+	{true, 1, "push ss"},
+	{true, 1, "scasb"},
+	{true, 1, "cmpsb"},
+	{true, 2, "int 72"},
+	{true, 1, "dec eax"},
+	{true, 1, "push ebp"},
+	{true, 1, "dec ecx"},
+	{true, 2, "loopne 0x00000f91"},
+	{false, 2, 0},
+	{true, 5, "or eax, 0x7d2e86c6"},
+	{true, 7, "mov byte ptr [esi+0x0d137d2e], 64"},
+	{true, 2, "xchg ch, byte ptr [esi]"},
+	{true, 3, "jnl 0x00001016"},
+	{true, 2, "jnl 0x00001015"},
+	{true, 6, "adc ecx, dword ptr [0x3e2f4d40]"},
+	{true, 5, "or eax, 0x3e2f4d40"},
+	{true, 1, "inc eax"},
+	{true, 1, "dec ebp"},
+	{true, 1, "das"},
+	{true, 2, "pop edx"},
+	{true, 1, "pop edx"},
+	{true, 5, "shl dword ptr [bx+46], 76"},
+	{true, 4, "shl dword ptr [edi+46], 76"},
+	{true, 3, "dec esp"},
+	{true, 2, "dec esp"},
+	{true, 1, "dec esp"},
+	{true, 1, "dec esi"},
+	{true, 3, "cbw"},
+	{true, 2, "cbw"},
+	{true, 1, "cwde"},
+	{true, 4, "jbe 0x00001015"},
+	{true, 3, "jbe 0x00001014"},
+	{true, 2, "jbe 0x00001013"},
+	{true, 3, "adc dword ptr [ecx-49], eax"},
+	{true, 1, "inc ecx"},
+	{true, 1, "iret"},
+	{true, 3, "rep dec ebp"},
+	{true, 2, "rep dec ebp"},
+	{true, 1, "dec ebp"},
+	{true, 1, "dec esp"},
+	{true, 1, "std"},
+	{true, 2, "in eax, 89"},
+	{true, 1, "pop ecx"},
+	{true, 5, "repne enter 0x6ab7, 0xcc"},
+	{true, 4, "enter 0x6ab7, 0xcc"},
+	{true, 2, "mov bh, 106"},
+	{true, 2, "push 0xcc"},
+	{true, 1, "int3"},
+	{true, 10, "sbb dword ptr [edx+0x49961fb3], 0x95612649"},
+	{true, 7, "callf far 0x2649:0x49961fb3"},
+	{true, 2, "mov bl, 31"},
+	{true, 1, "pop ds"},
+	{true, 1, "xchg esi, eax"},
+	{true, 1, "dec ecx"},
+	{true, 1, "dec ecx"},
+	{true, 2, "popad"},
+	{true, 1, "popad"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 1, "pop edi"},
+	{true, 3, "imul edx, ebp, 0x85"},
+	{true, 2, "aad 0x85"},
+	{true, 2, "test dword ptr [esi], edi"},
+	{true, 3, "fistp dword ptr ds:[ebx]"},
+	{true, 2, "fistp dword ptr [ebx]"},
+	{true, 4, "sbb ebp, dword ptr [esi+esi+47]"},
+	{true, 1, "insb"},
+	{true, 2, "das"},
+	{true, 1, "das"},
+	{true, 3, "sbb al, 127"},
+	{true, 2, "sbb al, 127"},
+	{true, 2, "jnle 0x00001067"},
+	{true, 3, "sub al, 75"},
+	{true, 2, "sub al, 75"},
+	{true, 1, "dec ebx"},
+	{true, 1, "dec edi"},
+	{true, 5, "mov edx, 0xf341dc19"},
+	{true, 2, "sbb esp, ebx"},
+	{true, 3, "fadd qword ptr [ecx-13]"},
+	{true, 1, "inc ecx"},
+	{true, 2, "rep out dx, al"},
+	{true, 1, "out dx, al"},
+	{true, 3, "test al, 76"},
+	{true, 2, "test al, 76"},
+	{true, 1, "dec esp"},
+	{true, 1, "push cs"},
+	{true, 1, "popad"},
+	{true, 1, "dec esp"},
+	{true, 3, "test dword ptr [esi-25], edi"},
+	{true, 2, "jle 0x00000fe9"},
+	{true, 2, "out 104, eax"},
+	{true, 5, "push 0x90c81313"},
+	{true, 2, "adc edx, dword ptr [ebx]"},
+	{true, 2, "adc ecx, eax"},
+	{true, 4, "enter 0x7490, 0x94"},
+	{true, 1, "nop"},
+	{true, 2, "jz 0x00000f96"},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "aaa"},
+	{true, 1, "dec edi"},
+	{true, 4, "rep adc bl, byte ptr fs:[edi]"},
+	{true, 3, "rep adc bl, byte ptr [edi]"},
+	{true, 2, "adc bl, byte ptr [edi]"},
+	{true, 1, "pop ds"},
+	{true, 3, "push 118"},
+	{true, 2, "push 118"},
+	{true, 2, "jbe 0x00000f8d"},
+	{true, 2, "mov eax, dword ptr [ecx]"},
+	{true, 2, "add dword ptr [ecx], esi"},
+	{true, 6, "xor dword ptr [ebx+0x4d487ffc], eax"},
+	{true, 3, "cmp esp, 127"},
+	{true, 1, "cld"},
+	{true, 2, "jnle 0x0000104a"},
+	{true, 1, "dec eax"},
+	{true, 1, "dec ebp"},
+	{true, 1, "inc ecx"},
+	{true, 10, "xor dword ptr [ecx+0xf1f34201], 0xd0c3e838"},
+	{true, 2, "mov cl, 1"},
+	{true, 3, "add dword ptr [edx-13], eax"},
+	{true, 1, "inc edx"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "cmp al, ch"},
+	{true, 5, "call 0x4440e0c8"},
+	{true, 1, "ret"},
+	{true, 3, "rol byte ptr [eax+68], 1"},
+	{true, 1, "inc eax"},
+	{true, 1, "inc esp"},
+	{true, 3, "xor byte ptr [edi-25], ch"},
+	{true, 1, "outsd"},
+	{true, 2, "out 77, eax"},
+	{true, 1, "dec ebp"},
+	{true, 1, "inc esp"},
+	{true, 1, "daa"},
+	{true, 6, "xor dh, byte ptr [edx+0xf364058b]"},
+	{true, 2, "mov dl, 0x8b"},
+	{true, 6, "mov eax, dword ptr [0x3e44f364]"},
+	{true, 5, "add eax, 0x3e44f364"},
+	{true, 3, "rep inc esp"},
+	{true, 2, "rep inc esp"},
+	{true, 1, "inc esp"},
+	{true, 2, "inc ecx"},
+	{true, 1, "inc ecx"},
+	{true, 1, "dec ecx"},
+	{true, 2, "jnle 0x00001066"},
+	{true, 5, "lock fidivr word ptr fs:[edx+108]"},
+	{true, 4, "lock fidivr word ptr [edx+108]"},
+	{true, 3, "fidivr word ptr [edx+108]"},
+	{true, 2, "jp 0x0000106e"},
+	{true, 1, "insb"},
+	{true, 6, "jnp 0x5c3f98dc"},
+	{true, 2, "mov edx, esi"},
+	{true, 1, "salc"},
+	{true, 2, "mov byte ptr [edi], bh"},
+	{true, 1, "aas"},
+	{true, 1, "pop esp"},
+	{true, 3, "and dword ptr [ecx-87], eax"},
+	{true, 1, "inc ecx"},
+	{true, 5, "test eax, 0xf24415f3"},
+	{true, 6, "rep adc eax, 0x80b5f244"},
+	{true, 5, "adc eax, 0x80b5f244"},
+	{true, 1, "inc esp"},
+	{true, 3, "repne mov ch, 0x80"},
+	{true, 2, "mov ch, 0x80"},
+	{true, 5, "and byte ptr [edx+edx*2+88], 0xde"},
+	{true, 2, "push edx"},
+	{true, 1, "push edx"},
+	{true, 1, "pop eax"},
+	{true, 4, "fimul word ptr [esp+eax*2+64]"},
+	{true, 1, "dec esp"},
+	{true, 1, "inc esp"},
+	{true, 1, "inc eax"},
+	{true, 2, "test al, 110"},
+	{true, 1, "outsb"},
+	{true, 1, "lodsb"},
+	{true, 3, "fmul qword ptr [ebx-49]"},
+	{true, 1, "dec ebx"},
+	{true, 1, "iret"},
+	{true, 6, "add byte ptr [edx+0xf24f2e3e], bl"},
+	{true, 7, "callf far 0x1254:0xf24f2e3e"},
+	{true, 3, "dec edi"},
+	{true, 2, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 2, "repne push esp"},
+	{true, 1, "push esp"},
+	{true, 6, "adc dh, byte ptr [edx+0x737bd443]"},
+	{true, 2, "mov dl, 67"},
+	{true, 1, "inc ebx"},
+	{true, 2, "aam 123"},
+	{true, 2, "jnp 0x00001075"},
+	{true, 2, "jnb 0x0000101c"},
+	{true, 3, "sbb ah, byte ptr [esi-126]"},
+	{true, 4, "xor byte ptr [esi], 0xbe"},
+	{true, 3, "xor byte ptr [esi], 0xbe"},
+	{true, 6, "mov esi, 0x2d47e640"},
+	{true, 5, "mov esi, 0x2d47e640"},
+	{true, 1, "inc eax"},
+	{true, 2, "out 71, al"},
+	{true, 1, "inc edi"},
+	{true, 5, "sub eax, 0x53ae8c99"},
+	{true, 1, "cdq"},
+	{true, 6, "mov dword ptr [esi+0x5a4f5353], gs"},
+	{true, 1, "scasb"},
+	{true, 1, "push ebx"},
+	{true, 1, "push ebx"},
+	{true, 1, "dec edi"},
+	{true, 1, "pop edx"},
+	{true, 1, "xchg esp, eax"},
+	{true, 7, "imul eax, dword ptr [eax-95], 0x77e47cc0"},
+	{true, 1, "inc eax"},
+	{true, 5, "mov eax, dword ptr [0x77e47cc0]"},
+	{true, 5, "sar byte ptr [esp+119], 125"},
+	{true, 2, "jl 0x00000fe6"},
+	{true, 2, "in al, 119"},
+	{true, 2, "jnbe 0x0000107f"},
+	{true, 2, "jnl 0x00001046"},
+	{true, 1, "inc esp"},
+	{true, 1, "pop esp"},
+	{true, 1, "inc esi"},
+	{true, 2, "sbb esi, dword ptr [esi]"},
+	{true, 3, "inc eax"},
+	{true, 2, "inc eax"},
+	{true, 1, "inc eax"},
+	{true, 3, "fnsave [ebx-42]"},
+	{true, 2, "jnb 0x00000fd8"},
+	{true, 1, "salc"},
+	{true, 6, "repne push eax"},
+	{true, 5, "repne push eax"},
+	{true, 4, "repne push eax"},
+	{true, 3, "repne push eax"},
+	{true, 2, "repne push eax"},
+	{true, 1, "push eax"},
+	{true, 3, "adc dword ptr [ebx], 7"},
+	{true, 2, "adc eax, dword ptr [edi]"},
+	{true, 1, "pop es"},
+	{true, 2, "loop 0x0000106e"},
+	{true, 1, "insb"},
+	{true, 1, "out dx, al"},
+	{true, 2, "loop 0x00000ffb"},
+	{true, 1, "stc"},
+	{true, 1, "pushad"},
+	{true, 1, "wait"},
+	{true, 6, "or eax, 0x62677d50"},
+	{true, 5, "or eax, 0x62677d50"},
+	{true, 1, "push eax"},
+	{true, 2, "jnl 0x00001069"},
+	{true, 4, "bound ebx, qword ptr [bx+di+52]"},
+	{true, 3, "bound ebx, qword ptr [ecx+52]"},
+	{true, 1, "pop ecx"},
+	{true, 2, "xor al, 102"},
+	{true, 2, "popaw"},
+	{true, 1, "popad"},
+	{true, 1, "iret"},
+	{true, 1, "inc esi"},
+	{true, 4, "sub byte ptr [eax+edi*8-60], bl"},
+	{true, 1, "pop esp"},
+	{true, 1, "clc"},
+	{true, 2, "les ebp, fword ptr [esi]"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "jnz 0x00000fd5"},
+	{true, 3, "ror dword ptr [edi+ebx*8], cl"},
+	{true, 2, "or al, 0xdf"},
+	{true, 3, "fbld tbyte ptr [ecx+100]"},
+	{true, 1, "popad"},
+	{true, 7, "xor edi, dword ptr fs:[edi+0xf3d99b18]"},
+	{true, 6, "xor edi, dword ptr [edi+0xf3d99b18]"},
+	{true, 5, "mov edi, 0xf3d99b18"},
+	{true, 6, "sbb byte ptr [ebx+0x4fb4f3d9], bl"},
+	{true, 3, "fstenv (invalid)"},
+	{true, 2, "fpatan"},
+	{true, 3, "rep mov ah, 79"},
+	{true, 2, "mov ah, 79"},
+	{true, 1, "dec edi"},
+	{true, 2, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 2, "cmp esi, esp"},
+	{true, 2, "out 0xf3, al"},
+	{true, 5, "rep bound ebp, qword ptr [eax+ebp*2+15]"},
+	{true, 4, "bound ebp, qword ptr [eax+ebp*2+15]"},
+	{true, 1, "insb"},
+	{true, 5, "push 0xab63940f"},
+	{true, 4, "setz byte ptr [ebx-85]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 6, "arpl word ptr [ebx+0xd9bef33f], bp"},
+	{true, 1, "stosd"},
+	{true, 1, "aas"},
+	{true, 6, "rep mov esi, 0x8f4364d9"},
+	{true, 5, "mov esi, 0x8f4364d9"},
+	{true, 4, "fldenv [ebx+eax*2-113]"},
+	{true, 2, "inc ebx"},
+	{true, 1, "inc ebx"},
+	{false, 2, 0},
+	{true, 3, "xchg edi, eax"},
+	{true, 2, "xchg edi, eax"},
+	{true, 1, "clc"},
+	{true, 1, "cli"},
+	{true, 1, "das"},
+	{true, 3, "out 126, eax"},
+	{true, 2, "out 126, eax"},
+	{true, 2, "jle 0x00001025"},
+	{true, 2, "and edx, ebp"},
+	{true, 2, "aad 100"},
+	{true, 2, "in eax, dx"},
+	{true, 1, "in eax, dx"},
+	{true, 6, "imul esp, dword ptr [edi], 0xda0e1d64"},
+	{true, 1, "daa"},
+	{true, 6, "sbb eax, 0x3d1bda0e"},
+	{true, 5, "sbb eax, 0x3d1bda0e"},
+	{true, 1, "push cs"},
+	{true, 2, "ficomp dword ptr [ebx]"},
+	{true, 6, "sbb edi, dword ptr [0xe431e767]"},
+	{true, 5, "cmp eax, 0xe431e767"},
+	{true, 3, "out 49, eax"},
+	{true, 2, "out 49, eax"},
+	{true, 2, "xor esp, esp"},
+	{true, 2, "in al, 0xa1"},
+	{true, 5, "mov eax, dword ptr [0x2ecb073e]"},
+	{true, 2, "pop es"},
+	{true, 1, "pop es"},
+	{true, 1, "retf"},
+	{true, 4, "repne aaa"},
+	{true, 3, "repne aaa"},
+	{true, 2, "repne aaa"},
+	{true, 1, "aaa"},
+	{true, 2, "dec ecx"},
+	{true, 1, "dec ecx"},
+	{true, 5, "mov eax, 0x59da6014"},
+	{true, 2, "adc al, 96"},
+	{true, 1, "pushad"},
+	{true, 3, "ficomp dword ptr [ecx-61]"},
+	{true, 1, "pop ecx"},
+	{true, 1, "ret"},
+	{true, 2, "lock insd"},
+	{true, 1, "insd"},
+	{true, 2, "in eax, 0x90"},
+	{true, 1, "nop"},
+	{true, 3, "repne adc al, 74"},
+	{true, 2, "adc al, 74"},
+	{true, 1, "dec edx"},
+	{true, 1, "dec ebp"},
+	{true, 2, "loop 0x00000ffc"},
+	{true, 1, "cli"},
+	{true, 2, "sub edx, dword ptr [ecx]"},
+	{true, 6, "adc dword ptr [0x26f7b71e], ebx"},
+	{true, 5, "sbb eax, 0x26f7b71e"},
+	{true, 1, "push ds"},
+	{true, 2, "mov bh, 0xf7"},
+	{true, 2, "mul dword ptr [esi]"},
+	{true, 2, "push esp"},
+	{true, 1, "push esp"},
+	{true, 6, "and eax, 0xd20f7bf0"},
+	{true, 5, "and eax, 0xd20f7bf0"},
+	{true, 3, "lock jnp 0x00001012"},
+	{true, 2, "jnp 0x00001011"},
+	{true, 3, "psrld mm2, qword ptr [ecx]"},
+	{true, 2, "rcl byte ptr [ecx], cl"},
+	{true, 2, "adc esp, ebx"},
+	{true, 2, "fdivr qword ptr [edi]"},
+	{true, 1, "aas"},
+	{true, 3, "adc cl, al"},
+	{true, 2, "adc cl, al"},
+	{true, 3, "rcl dword ptr [ebx], 13"},
+	{true, 6, "adc ecx, dword ptr [0x2340367b]"},
+	{true, 5, "or eax, 0x2340367b"},
+	{true, 2, "jnp 0x00001038"},
+	{true, 2, "inc eax"},
+	{true, 1, "inc eax"},
+	{true, 6, "and ebp, dword ptr [ebx+0x516d9ffb]"},
+	{true, 1, "stosd"},
+	{true, 1, "sti"},
+	{true, 1, "lahf"},
+	{true, 1, "insd"},
+	{true, 1, "push ecx"},
+	{true, 3, "repne das"},
+	{true, 2, "das"},
+	{true, 1, "das"},
+	{true, 3, "cmp cl, byte ptr [ecx-92]"},
+	{true, 1, "dec ecx"},
+	{true, 1, "movsb"},
+	{true, 2, "cld"},
+	{true, 1, "cld"},
+	{true, 2, "jle 0x0000100e"},
+	{true, 2, "or al, 79"},
+	{true, 1, "dec edi"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "jmp 0x00001040"},
+	{true, 5, "enter 0x6248, 0xa9"},
+	{true, 4, "enter 0x6248, 0xa9"},
+	{true, 1, "dec eax"},
+	{true, 6, "bound ebp, qword ptr [ecx+0x12538de2]"},
+	{true, 5, "test eax, 0x12538de2"},
+	{true, 2, "loop 0x00000f8f"},
+	{true, 3, "lea edx, [ebx+18]"},
+	{true, 1, "push ebx"},
+	{true, 6, "adc al, byte ptr [ebx+0x2c44c6a8]"},
+	{true, 7, "sub dword ptr [eax+0x662c44c6], 0xd2"},
+	{true, 2, "test al, 0xc6"},
+	{true, 5, "mov byte ptr [esp+ebp+102], 0xd2"},
+	{true, 1, "inc esp"},
+	{true, 2, "sub al, 102"},
+	{true, 3, "rcl cl, cl"},
+	{true, 2, "rcl cl, cl"},
+	{true, 6, "shl dword ptr [esi+0xddc73c48], 1"},
+	{true, 1, "cmpsb"},
+	{true, 1, "dec eax"},
+	{true, 2, "cmp al, 0xc7"},
+	{false, 2, 0},
+	{true, 2, "fucomp st(3)"},
+	{true, 2, "jmp 0x00001051"},
+	{true, 1, "dec edi"},
+	{true, 2, "jnz 0x0000106e"},
+	{true, 1, "insb"},
+	{true, 7, "fidivr dword ptr cs:[ebx+0x6766f2d9]"},
+	{true, 6, "fidivr dword ptr [ebx+0x6766f2d9]"},
+	{true, 5, "mov ebx, 0x6766f2d9"},
+	{true, 2, "fptan"},
+	{true, 5, "repne jnl 0x00001080"},
+	{true, 4, "jnl 0x0000107f"},
+	{true, 3, "jnl 0x0000107e"},
+	{true, 2, "jnl 0x0000107d"},
+	{true, 2, "jnp 0x00001067"},
+	{true, 6, "adc eax, 0x554d26f3"},
+	{true, 5, "adc eax, 0x554d26f3"},
+	{true, 3, "rep dec ebp"},
+	{true, 2, "dec ebp"},
+	{true, 1, "dec ebp"},
+	{true, 1, "push ebp"},
+	{true, 1, "dec eax"},
+	{true, 5, "push 0xcf3221b4"},
+	{true, 2, "mov ah, 33"},
+	{true, 2, "and dword ptr [edx], esi"},
+	{true, 2, "xor cl, bh"},
+	{true, 1, "iret"},
+	{false, 2, 0},
+	{true, 1, "dec edi"},
+	{true, 2, "jb 0x00001046"},
+	{true, 1, "inc esp"},
+	{true, 3, "or cl, byte ptr [ecx+96]"},
+	{true, 1, "dec ecx"},
+	{true, 1, "pushad"},
+	{true, 6, "push dword ptr [esi+0x7ec748a9]"},
+	{true, 2, "mov dh, 0xa9"},
+	{true, 5, "test eax, 0x0f7ec748"},
+	{true, 1, "dec eax"},
+	{false, 2, 0},
+	{true, 2, "jle 0x00001011"},
+	{false, 2, 0},
+	{true, 1, "aas"},
+	{true, 3, "add esp, dword ptr [edx+5]"},
+	{true, 6, "bound eax, qword ptr [0x362e0d2e]"},
+	{true, 5, "add eax, 0x362e0d2e"},
+	{true, 6, "or eax, 0x28fa362e"},
+	{true, 5, "or eax, 0x28fa362e"},
+	{true, 3, "cli"},
+	{true, 2, "cli"},
+	{true, 1, "cli"},
+	{true, 2, "sub byte ptr [edi], cl"},
+	{true, 7, "psubusw mm1, qword ptr [ecx+0xb9f02ee8]"},
+	{false, 2, 0},
+	{true, 2, "mov eax, ebp"},
+	{true, 5, "call 0x99ba0033"},
+	{true, 7, "lock mov ecx, 0xb6c52899"},
+	{true, 6, "lock mov ecx, 0xb6c52899"},
+	{true, 5, "mov ecx, 0xb6c52899"},
+	{true, 1, "cdq"},
+	{true, 2, "sub ch, al"},
+	{true, 6, "lds esi, fword ptr [esi+0x26274488]"},
+	{true, 2, "mov dh, 0x88"},
+	{true, 4, "mov byte ptr [edi+38], al"},
+	{true, 1, "inc esp"},
+	{true, 1, "daa"},
+	{true, 2, "inc edx"},
+	{true, 1, "inc edx"},
+	{true, 1, "out dx, al"},
+	{true, 1, "inc esp"},
+	{true, 7, "rep or word ptr [eax+10], 0x66f2"},
+	{true, 6, "or word ptr [eax+10], 0x66f2"},
+	{true, 7, "or dword ptr [eax+10], 0xc0ef66f2"},
+	{true, 1, "dec eax"},
+	{true, 2, "or dh, dl"},
+	{true, 3, "repne out dx, ax"},
+	{true, 2, "out dx, ax"},
+	{true, 1, "out dx, eax"},
+	{true, 3, "rcr byte ptr [ebx], 108"},
+	{true, 4, "sbb ebp, dword ptr [eax+esi*8+49]"},
+	{true, 1, "insb"},
+	{true, 3, "lock xor ecx, esp"},
+	{true, 2, "xor ecx, esp"},
+	{true, 2, "loope 0x00001026"},
+	{true, 2, "and al, 0x9d"},
+	{true, 1, "popfd"},
+	{true, 2, "rep pop eax"},
+	{true, 1, "pop eax"},
+	{true, 2, "xchg esp, eax"},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "dec ecx"},
+	{true, 1, "inc esi"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 3, "add ebx, dword ptr [edx-84]"},
+	{true, 1, "pop edx"},
+	{true, 1, "lodsb"},
+	{true, 1, "scasd"},
+	{true, 2, "sub eax, dword ptr [eax]"},
+	{true, 7, "add byte ptr [esi+ebp*4+0xf8724165], al"},
+	{true, 6, "test byte ptr [esi+0xf8724165], ch"},
+	{true, 1, "scasb"},
+	{true, 2, "inc ecx"},
+	{true, 1, "inc ecx"},
+	{true, 2, "jb 0x00000ffa"},
+	{true, 1, "clc"},
+	{true, 2, "loop 0x00001042"},
+	{true, 1, "inc eax"},
+	{true, 1, "pushad"},
+	{true, 2, "mov dh, 73"},
+	{true, 1, "dec ecx"},
+	{true, 2, "sbb dword ptr [edx], edx"},
+	{true, 6, "adc dh, byte ptr [esi+0x7c9f8d91]"},
+	{true, 2, "mov dh, 0x91"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 6, "lea ebx, [edi+0xf2059f7c]"},
+	{true, 1, "lahf"},
+	{true, 2, "jl 0x00000fa1"},
+	{true, 1, "lahf"},
+	{true, 5, "add eax, 0x671788f2"},
+	{true, 3, "repne mov byte ptr [edi], dl"},
+	{true, 2, "mov byte ptr [edi], dl"},
+	{true, 1, "pop ss"},
+	{true, 3, "in al, 0xc6"},
+	{true, 2, "in al, 0xc6"},
+	{false, 2, 0},
+	{true, 2, "rep inc edx"},
+	{true, 1, "inc edx"},
+	{true, 2, "adc dword ptr [edx], esi"},
+	{true, 2, "xor bh, byte ptr [edx]"},
+	{true, 4, "cmp cl, byte ptr [eax+ecx*2-84]"},
+	{true, 1, "dec esp"},
+	{true, 1, "dec eax"},
+	{true, 1, "lodsb"},
+	{true, 8, "cmp byte ptr [esi+ebp*2+0x49e767f9], 0xf9"},
+	{true, 5, "mov esp, 0xe767f96e"},
+	{true, 1, "outsb"},
+	{true, 1, "stc"},
+	{true, 3, "out 73, eax"},
+	{true, 2, "out 73, eax"},
+	{true, 1, "dec ecx"},
+	{true, 1, "stc"},
+	{true, 1, "inc esp"},
+	{true, 3, "retf 0x074c"},
+	{true, 1, "dec esp"},
+	{true, 1, "pop es"},
+	{true, 2, "xor eax, esi"},
+	{true, 2, "lock inc ecx"},
+	{true, 1, "inc ecx"},
+	{true, 7, "fmul qword ptr cs:[esi+0x99f4c7bc]"},
+	{true, 6, "fmul qword ptr [esi+0x99f4c7bc]"},
+	{true, 7, "mov seg8, word ptr [edi+eax*8+0xb74c99f4]"},
+	{true, 5, "mov esp, 0x4c99f4c7"},
+	{false, 2, 0},
+	{true, 1, "hlt"},
+	{true, 1, "cdq"},
+	{true, 1, "dec esp"},
+	{true, 2, "mov bh, 0xbb"},
+	{true, 5, "mov ebx, 0xf264a555"},
+	{true, 1, "push ebp"},
+	{true, 1, "movsd"},
+	{true, 3, "repne aas"},
+	{true, 2, "repne aas"},
+	{true, 1, "aas"},
+	{true, 6, "cmp ebx, dword ptr [ebp+0x9b2ef84f]"},
+	{true, 1, "popfd"},
+	{true, 1, "dec edi"},
+	{true, 1, "clc"},
+	{true, 2, "wait"},
+	{true, 1, "wait"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "push es"},
+	{true, 5, "sbb eax, 0xf2392b96"},
+	{true, 1, "xchg esi, eax"},
+	{true, 2, "sub edi, dword ptr [ecx]"},
+	{true, 2, "cmp edx, esi"},
+	{true, 7, "repne push 0x538c63cb"},
+	{true, 6, "push 0x538c63cb"},
+	{true, 5, "push 0x538c63cb"},
+	{true, 1, "retf"},
+	{true, 7, "arpl word ptr [ebx+edx*2+0x08510d67], cx"},
+	{true, 3, "mov dword ptr [ebx+103], ss"},
+	{true, 1, "push ebx"},
+	{true, 6, "or eax, 0x2a440851"},
+	{true, 5, "or eax, 0x2a440851"},
+	{true, 1, "push ecx"},
+	{true, 4, "or byte ptr [edx+ebp+92], al"},
+	{true, 1, "inc esp"},
+	{true, 4, "sub bl, byte ptr [edx+esi*4+68]"},
+	{true, 1, "pop esp"},
+	{true, 2, "mov dl, 68"},
+	{true, 1, "inc esp"},
+	{true, 1, "push ebp"},
+	{true, 1, "inc esi"},
+	{true, 1, "dec esp"},
+	{true, 2, "repne dec ebx"},
+	{true, 1, "dec ebx"},
+	{true, 1, "inc eax"},
+	{true, 1, "dec ebp"},
+	{true, 2, "neg byte ptr [ebx]"},
+	{true, 2, "sbb esi, ebx"},
+	{true, 7, "rep mov ax, word ptr [0xcc4401f3]"},
+	{true, 6, "mov ax, word ptr [0xcc4401f3]"},
+	{true, 5, "mov eax, dword ptr [0xcc4401f3]"},
+	{true, 5, "rep add dword ptr [esp+ecx*8-68], eax"},
+	{true, 4, "add dword ptr [esp+ecx*8-68], eax"},
+	{true, 1, "inc esp"},
+	{true, 1, "int3"},
+	{true, 5, "mov esp, 0x05655619"},
+	{true, 3, "sbb dword ptr [esi+101], edx"},
+	{true, 1, "push esi"},
+	{true, 6, "add eax, 0xf2f4f340"},
+	{true, 5, "add eax, 0xf2f4f340"},
+	{true, 1, "inc eax"},
+	{true, 2, "rep hlt"},
+	{true, 1, "hlt"},
+	{true, 6, "repne mov esp, 0xf0ee5232"},
+	{true, 5, "mov esp, 0xf0ee5232"},
+	{true, 3, "xor dl, byte ptr [edx-18]"},
+	{true, 1, "push edx"},
+	{true, 1, "out dx, al"},
+	{true, 6, "lock mov eax, 0xd4832695"},
+	{true, 5, "mov eax, 0xd4832695"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 4, "adc esp, 76"},
+	{true, 3, "adc esp, 76"},
+	{true, 2, "aam 76"},
+	{true, 1, "dec esp"},
+	{true, 1, "xchg edx, eax"},
+	{true, 6, "xor al, byte ptr [edi+0x5e17275d]"},
+	{true, 3, "xchg ebx, dword ptr [ebp+39]"},
+	{true, 1, "pop ebp"},
+	{true, 1, "daa"},
+	{true, 1, "pop ss"},
+	{true, 1, "pop esi"},
+	{true, 7, "shr byte ptr [eax+0xa5e9a6b2], 0x86"},
+	{true, 2, "test al, 0xb2"},
+	{true, 2, "mov dl, 0xa6"},
+	{true, 1, "cmpsb"},
+	{true, 5, "jmp 0xe31796aa"},
+	{true, 1, "movsd"},
+	{true, 2, "xchg dl, byte ptr [edi]"},
+	{true, 1, "pop ss"},
+	{true, 2, "jcez 0x00000fe6"},
+	{true, 2, "in al, 46"},
+	{true, 3, "out 77, al"},
+	{true, 2, "out 77, al"},
+	{true, 1, "dec ebp"},
+	{true, 2, "ror dword ptr [edi], 1"},
+	{true, 3, "cmovs ebp, dword ptr [esi]"},
+	{true, 1, "dec eax"},
+	{true, 3, "wait"},
+	{true, 2, "wait"},
+	{true, 1, "wait"},
+	{true, 1, "dec ecx"},
+	{true, 2, "lea ecx, [edi]"},
+	{true, 4, "pcmpgtw mm1, qword ptr [eax+79]"},
+	{true, 2, "dec eax"},
+	{true, 1, "dec eax"},
+	{true, 1, "dec edi"},
+	{true, 2, "fnsave [esi]"},
+	{true, 6, "xor eax, 0x404df04f"},
+	{true, 5, "xor eax, 0x404df04f"},
+	{true, 1, "dec edi"},
+	{true, 2, "lock dec ebp"},
+	{true, 1, "dec ebp"},
+	{true, 1, "inc eax"},
+	{true, 5, "push 0x4db71d4f"},
+	{true, 1, "dec edi"},
+	{true, 5, "sbb eax, 0x52f34db7"},
+	{true, 2, "mov bh, 77"},
+	{true, 1, "dec ebp"},
+	{true, 2, "rep push edx"},
+	{true, 1, "push edx"},
+	{true, 3, "retf 0x4f90"},
+	{true, 1, "nop"},
+	{true, 1, "dec edi"},
+	{true, 2, "repne std"},
+	{true, 1, "std"},
+	{true, 4, "enter 0x0ff2, 61"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 5, "cmp eax, 0xea20fea3"},
+	{true, 5, "mov dword ptr [0x48ea20fe], eax"},
+	{false, 2, 0},
+	{true, 2, "and dl, ch"},
+	{true, 7, "jmp far 0x4858:0xc2115c48"},
+	{true, 1, "dec eax"},
+	{true, 1, "pop esp"},
+	{true, 2, "adc edx, eax"},
+	{true, 3, "ret 0x4858"},
+	{true, 1, "pop eax"},
+	{true, 1, "dec eax"},
+	{true, 5, "sbb eax, 0x1c12fc36"},
+	{true, 2, "cld"},
+	{true, 1, "cld"},
+	{true, 3, "adc bl, byte ptr [edx+esi]"},
+	{true, 2, "sbb al, 50"},
+	{true, 6, "xor bl, byte ptr [edi+0x5852ba4f]"},
+	{true, 1, "lahf"},
+	{true, 1, "dec edi"},
+	{true, 5, "mov edx, 0x65265852"},
+	{true, 1, "push edx"},
+	{true, 1, "pop eax"},
+	{true, 4, "lea eax, gs:[esi]"},
+	{true, 3, "lea eax, gs:[esi]"},
+	{true, 2, "lea eax, [esi]"},
+	{true, 1, "push es"},
+	{true, 3, "movlps xmm7, qword ptr [esi]"},
+	{true, 2, "adc bh, byte ptr [esi]"},
+	{true, 3, "pop fs"},
+	{true, 2, "pop fs"},
+	{true, 5, "mov eax, dword ptr [0x66144f22]"},
+	{true, 3, "and cl, byte ptr [edi+20]"},
+	{true, 1, "dec edi"},
+	{true, 2, "adc al, 102"},
+	{true, 3, "xchg cx, ax"},
+	{true, 2, "xchg cx, ax"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 1, "lodsb"},
+	{true, 3, "retf 0x080f"},
+	{true, 2, "invd"},
+	{true, 7, "or byte ptr [eax+edi*4+0x4c80077a], ch"},
+	{true, 1, "lodsb"},
+	{true, 5, "mov eax, 0x4c80077a"},
+	{true, 2, "jp 0x00001009"},
+	{true, 1, "pop es"},
+	{true, 5, "or byte ptr [esi+esi-54], 73"},
+	{true, 1, "dec esp"},
+	{true, 4, "retf 0xfffff249"},
+	{true, 3, "retf 0xfffff249"},
+	{true, 1, "dec ecx"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "rep jnbe 0x00001078"},
+	{true, 2, "jnbe 0x00001077"},
+	{true, 2, "jnz 0x00001051"},
+	{true, 1, "dec edi"},
+	{true, 2, "jle 0x0000100d"},
+	{true, 2, "or edi, ebp"},
+	{true, 1, "std"},
+	{true, 1, "inc eax"},
+	{true, 1, "dec ecx"},
+	{true, 2, "cmp al, byte ptr [ecx]"},
+	{true, 2, "add esi, ebp"},
+	{true, 1, "out dx, al"},
+	{true, 5, "add eax, 0xf0c52144"},
+	{true, 1, "inc esp"},
+	{true, 2, "and ebp, eax"},
+	{true, 2, "lds esi, (invalid)"},
+	{true, 2, "lock dec eax"},
+	{true, 1, "dec eax"},
+	{true, 1, "dec edi"},
+	{true, 5, "mov dword ptr [0x0ee492ab], eax"},
+	{true, 1, "stosd"},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "in al, 14"},
+	{true, 1, "push cs"},
+	{true, 1, "daa"},
+	{true, 5, "add eax, 0xd3ff5b41"},
+	{true, 1, "inc ecx"},
+	{true, 1, "pop ebx"},
+	{true, 2, "call ebx"},
+	{true, 2, "shr esp, cl"},
+	{true, 1, "in al, dx"},
+	{true, 1, "pop esi"},
+	{true, 1, "pop ds"},
+	{true, 1, "inc eax"},
+	{true, 2, "xor byte ptr [esi], bh"},
+	{true, 7, "call 0x00005d6d"},
+	{true, 6, "call 0x00005d6c"},
+	{true, 5, "call 0x00005d6b"},
+	{true, 4, "call 0x00005d6a"},
+	{true, 5, "call 0x8aed5d6b"},
+	{true, 2, "dec bp"},
+	{true, 1, "dec ebp"},
+	{true, 1, "in eax, dx"},
+	{true, 7, "mov bl, byte ptr [ebp+0x06b365f2]"},
+	{true, 1, "pushfd"},
+	{true, 5, "and eax, 0x06b365f2"},
+	{true, 4, "repne mov bl, 6"},
+	{true, 3, "mov bl, 6"},
+	{true, 2, "mov bl, 6"},
+	{true, 1, "push es"},
+	{true, 3, "lock and al, 73"},
+	{true, 2, "and al, 73"},
+	{true, 1, "dec ecx"},
+	{true, 1, "push eax"},
+	{true, 1, "dec esp"},
+	{true, 1, "nop"},
+	{true, 2, "adc al, 64"},
+	{true, 1, "inc eax"},
+	{true, 2, "mov cl, 15"},
+	{false, 2, 0},
+	{true, 3, "in eax, dx"},
+	{true, 2, "in eax, dx"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "push edx"},
+	{true, 1, "int3"},
+	{true, 3, "or byte ptr [edi], 0xfa"},
+	{true, 4, "psubd mm4, qword ptr [ecx-40]"},
+	{true, 1, "cli"},
+	{true, 1, "popad"},
+	{true, 6, "fadd dword ptr [ecx+0x95793855]"},
+	{true, 7, "adc dword ptr [ebp+56], 0x498b9579"},
+	{true, 1, "push ebp"},
+	{true, 3, "cmp byte ptr [ecx-107], bh"},
+	{true, 2, "jns 0x00000f97"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 3, "mov ecx, dword ptr [ecx-48]"},
+	{true, 1, "dec ecx"},
+	{true, 2, "rol bh, 1"},
+	{false, 2, 0},
+	{true, 1, "dec edx"},
+	{true, 1, "stosb"},
+	{true, 1, "leave"},
+	{true, 1, "pop ebx"},
+	{true, 5, "call 0x36bf002b"},
+	{true, 7, "lock mov esi, 0x37a74b36"},
+	{true, 6, "lock mov esi, 0x37a74b36"},
+	{true, 5, "mov esi, 0x37a74b36"},
+	{true, 2, "dec ebx"},
+	{true, 1, "dec ebx"},
+	{true, 1, "cmpsd"},
+	{true, 1, "aaa"},
+	{true, 1, "dec eax"},
+	{true, 2, "mov dh, 100"},
+	{true, 4, "test byte ptr fs:[edi-4], cl"},
+	{true, 3, "test byte ptr [edi-4], cl"},
+	{true, 1, "dec edi"},
+	{true, 1, "cld"},
+	{true, 3, "push 48"},
+	{true, 2, "push 48"},
+	{true, 3, "xor byte ptr [ecx+44], cl"},
+	{true, 1, "dec ecx"},
+	{true, 2, "sub al, 77"},
+	{true, 1, "dec ebp"},
+	{true, 1, "inc ecx"},
+	{true, 2, "xor al, 0xe5"},
+	{true, 2, "in eax, 37"},
+	{true, 5, "and eax, 0xce466726"},
+	{true, 3, "inc esi"},
+	{true, 2, "inc esi"},
+	{true, 1, "inc esi"},
+	{true, 1, "into"},
+	{true, 3, "loop 0x00001044"},
+	{true, 2, "loop 0x00001043"},
+	{true, 1, "inc ecx"},
+	{true, 3, "in eax, dx"},
+	{true, 2, "in eax, dx"},
+	{true, 1, "in eax, dx"},
+	{true, 3, "imul ebp, dword ptr [esi], 65"},
+	{true, 2, "inc ecx"},
+	{true, 1, "inc ecx"},
+	{true, 1, "dec ebx"},
+	{true, 2, "adc ebp, ebx"},
+	{true, 6, "frstor [ebp+0xcb3ff2f4]"},
+	{true, 1, "movsd"},
+	{true, 1, "hlt"},
+	{true, 2, "repne aas"},
+	{true, 1, "aas"},
+	{true, 1, "retf"},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 1, "leave"},
+	{true, 2, "inc eax"},
+	{true, 1, "inc eax"},
+	{true, 1, "dec ecx"},
+	{true, 1, "dec esp"},
+	{true, 1, "push edi"},
+	{true, 2, "mov dh, 0xcd"},
+	{true, 2, "int 21"},
+	{true, 5, "adc eax, 0x5f600c8f"},
+	{false, 2, 0},
+	{true, 2, "or al, 96"},
+	{true, 1, "pushad"},
+	{true, 1, "pop edi"},
+	{true, 2, "sbb edi, esi"},
+	{true, 2, "imul ebp"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "nop"},
+	{true, 2, "lock inc eax"},
+	{true, 1, "inc eax"},
+	{true, 1, "stc"},
+	{true, 1, "ret"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "adc esi, dword ptr [esi]"},
+	{true, 2, "inc ebx"},
+	{true, 1, "inc ebx"},
+	{true, 3, "stosd"},
+	{true, 2, "stosd"},
+	{true, 1, "stosd"},
+	{true, 2, "cmp al, 0xd9"},
+	{true, 6, "fld dword ptr [0x49fc9c33]"},
+	{true, 5, "add eax, 0x49fc9c33"},
+	{true, 7, "xor ebx, dword ptr [esp+edi*8+0xa02b0a49]"},
+	{true, 1, "pushfd"},
+	{true, 1, "cld"},
+	{true, 1, "dec ecx"},
+	{true, 2, "or ch, byte ptr [ebx]"},
+	{true, 6, "sub esp, dword ptr [eax+0x4fcab913]"},
+	{true, 5, "mov al, byte ptr [0x4fcab913]"},
+	{true, 6, "adc edi, dword ptr [ecx+0x0fa84fca]"},
+	{true, 5, "mov ecx, 0x0fa84fca"},
+	{true, 3, "retf 0xffffa84f"},
+	{true, 1, "dec edi"},
+	{true, 2, "test al, 15"},
+	{true, 7, "movntq qword ptr [0xe520dc67], mm1"},
+	{true, 2, "out 13, eax"},
+	{true, 5, "or eax, 0xe520dc67"},
+	{true, 3, "fsub qword ptr [bx+si]"},
+	{true, 2, "fsub qword ptr [eax]"},
+	{true, 2, "and ch, ah"},
+	{true, 2, "in eax, 44"},
+	{true, 2, "sub al, 94"},
+	{true, 1, "pop esi"},
+	{true, 1, "pop ss"},
+	{true, 1, "pushfd"},
+	{true, 4, "lock jz 0x0000100f"},
+	{true, 3, "jz 0x0000100e"},
+	{true, 2, "jz 0x0000100d"},
+	{true, 2, "or eax, edx"},
+	{true, 3, "ret 0x1857"},
+	{true, 1, "push edi"},
+	{true, 2, "sbb byte ptr [ebx], al"},
+	{true, 2, "add ebp, ecx"},
+	{true, 5, "jmp 0x2a768f24"},
+	{true, 1, "pop ds"},
+	{true, 2, "jnle 0x00001078"},
+	{true, 2, "jbe 0x0000102c"},
+	{true, 3, "sub cl, byte ptr [eax+86]"},
+	{true, 1, "dec eax"},
+	{true, 1, "push esi"},
+	{true, 5, "or eax, 0x303cf221"},
+	{true, 2, "and edx, esi"},
+	{true, 3, "repne cmp al, 48"},
+	{true, 2, "cmp al, 48"},
+	{true, 6, "xor byte ptr [eax+0x597cb55c], ah"},
+	{true, 5, "mov al, byte ptr [0x597cb55c]"},
+	{true, 1, "pop esp"},
+	{true, 2, "mov ch, 124"},
+	{true, 2, "jl 0x0000105b"},
+	{true, 1, "pop ecx"},
+	{true, 2, "rep dec ebx"},
+	{true, 1, "dec ebx"},
+	{true, 1, "stosd"},
+	{true, 6, "cmp al, byte ptr [0x5c4ceae7]"},
+	{true, 5, "add eax, 0x5c4ceae7"},
+	{true, 2, "out 0xea, eax"},
+	{true, 7, "jmp far 0xd14f:0xa04d5c4c"},
+	{true, 1, "dec esp"},
+	{true, 1, "pop esp"},
+	{true, 1, "dec ebp"},
+	{true, 5, "mov al, byte ptr [0xa7d5d14f]"},
+	{true, 1, "dec edi"},
+	{true, 2, "rcl ebp, 1"},
+	{true, 2, "aad 0xa7"},
+	{true, 1, "cmpsd"},
+	{true, 1, "push ebx"},
+	{true, 1, "stc"},
+	{true, 1, "dec eax"},
+	{true, 6, "lock mov ebp, 0x3e9bf8cc"},
+	{true, 5, "mov ebp, 0x3e9bf8cc"},
+	{true, 1, "int3"},
+	{true, 1, "clc"},
+	{true, 1, "wait"},
+	{true, 3, "sbb dword ptr ds:[edx], eax"},
+	{true, 2, "sbb dword ptr [edx], eax"},
+	{true, 6, "add al, byte ptr [eax+0x2467e27a]"},
+	{true, 4, "cmp byte ptr [edx-30], 103"},
+	{true, 2, "jp 0x00000fe4"},
+	{true, 2, "loop 0x00001069"},
+	{true, 3, "and al, 92"},
+	{true, 2, "and al, 92"},
+	{true, 1, "pop esp"},
+	{true, 1, "stosd"},
+	{true, 3, "and ah, al"},
+	{true, 2, "and ah, al"},
+	{true, 6, "les edi, fword ptr [ebp+0x4e28f8e8]"},
+	{true, 5, "mov ebp, 0x4e28f8e8"},
+	{true, 5, "call 0xe54e38fd"},
+	{true, 1, "clc"},
+	{true, 3, "sub byte ptr [esi-27], cl"},
+	{true, 1, "dec esi"},
+	{true, 2, "in eax, 64"},
+	{true, 1, "inc eax"},
+	{true, 1, "cwde"},
+	{true, 1, "cmpsd"},
+	{true, 5, "jmp 0xcc2eb908"},
+	{true, 6, "add ebp, dword ptr [ecx+0x0f87cc2e]"},
+	{true, 5, "test eax, 0x0f87cc2e"},
+	{true, 2, "int3"},
+	{true, 1, "int3"},
+	{true, 2, "xchg ecx, dword ptr [edi]"},
+	{true, 4, "punpckhwd mm0, dword ptr [esi+73]"},
+	{true, 7, "imul eax, dword ptr [esi+73], 0x4eb165f3"},
+	{true, 1, "inc esi"},
+	{true, 1, "dec ecx"},
+	{true, 4, "rep mov cl, 78"},
+	{true, 3, "mov cl, 78"},
+	{true, 2, "mov cl, 78"},
+	{true, 1, "dec esi"},
+	{true, 5, "mov ebp, 0x4f64fa4f"},
+	{true, 1, "dec edi"},
+	{true, 1, "cli"},
+	{true, 2, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 5, "push 0x5240e2ca"},
+	{true, 3, "retf 0x40e2"},
+	{true, 2, "loop 0x00001042"},
+	{true, 1, "inc eax"},
+	{true, 1, "push edx"},
+	{true, 3, "rol dword ptr [ebp+8], 1"},
+	{true, 1, "inc ebp"},
+	{true, 2, "or dh, al"},
+	{false, 2, 0},
+	{true, 3, "mov bl, 0xb1"},
+	{true, 2, "mov bl, 0xb1"},
+	{true, 2, "mov cl, 102"},
+	{true, 4, "retf 0x5155"},
+	{true, 3, "retf 0x5155"},
+	{true, 1, "push ebp"},
+	{true, 1, "push ecx"},
+	{true, 5, "sub eax, 0xebe65be2"},
+	{true, 2, "loop 0x0000105d"},
+	{true, 1, "pop ebx"},
+	{true, 2, "out 0xeb, al"},
+	{true, 2, "jmp 0x00001079"},
+	{true, 2, "jnbe 0x00001016"},
+	{true, 2, "adc al, 0xf0"},
+	{true, 3, "lock mov ch, 0xdf"},
+	{true, 2, "mov ch, 0xdf"},
+	{true, 3, "fbstp tbyte ptr [edi+77]"},
+	{true, 2, "jnbe 0x0000104f"},
+	{true, 1, "dec ebp"},
+	{true, 1, "inc esp"},
+	{true, 1, "pop esi"},
+	{true, 2, "sbb byte ptr [esi], dh"},
+	{true, 3, "leave"},
+	{true, 2, "leave"},
+	{true, 1, "leave"},
+	{true, 1, "dec eax"},
+	{true, 7, "arpl word ptr [edi+edx*2+0x3e72be4e], dx"},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "push edi"},
+	{true, 1, "dec esi"},
+	{true, 5, "mov esi, 0x9b4d3e72"},
+	{true, 2, "jb 0x00001040"},
+	{true, 2, "dec ebp"},
+	{true, 1, "dec ebp"},
+	{true, 1, "wait"},
+	{true, 1, "inc esp"},
+	{true, 1, "out dx, al"},
+	{true, 3, "mov cl, 73"},
+	{true, 2, "mov cl, 73"},
+	{true, 1, "dec ecx"},
+	{true, 3, "mov byte ptr cs:[edi], al"},
+	{true, 2, "mov byte ptr [edi], al"},
+	{true, 1, "pop es"},
+	{true, 5, "mov al, byte ptr [0xac26fb41]"},
+	{true, 1, "inc ecx"},
+	{true, 1, "sti"},
+	{true, 2, "lodsb"},
+	{true, 1, "lodsb"},
+	{true, 7, "ficom dword ptr ds:[edx+0x4049e03c]"},
+	{true, 6, "ficom dword ptr [edx+0x4049e03c]"},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "cmp al, 0xe0"},
+	{true, 2, "loopne 0x0000104b"},
+	{true, 1, "dec ecx"},
+	{true, 1, "inc eax"},
+	{true, 6, "xor byte ptr [ebx+0x315049c4], bh"},
+	{true, 5, "mov ebx, 0x315049c4"},
+	{true, 3, "les ecx, fword ptr [ecx+80]"},
+	{true, 1, "dec ecx"},
+	{true, 1, "push eax"},
+	{true, 6, "xor dword ptr [edx+0x70fd4cf1], edx"},
+	{true, 1, "xchg edx, eax"},
+	{false, 1, 0},
+	{true, 1, "dec esp"},
+	{true, 1, "std"},
+	{true, 2, "jo 0x0000105e"},
+	{true, 1, "pop esp"},
+	{true, 2, "fcmove st, st(3)"},
+	{true, 1, "retf"},
+	{true, 2, "aam 79"},
+	{true, 1, "dec edi"},
+	{true, 1, "aas"},
+	{true, 2, "sbb al, 0xf3"},
+	{true, 4, "rep cmp dword ptr [edi+88], ecx"},
+	{true, 3, "cmp dword ptr [edi+88], ecx"},
+	{true, 1, "dec edi"},
+	{true, 1, "pop eax"},
+	{true, 1, "cld"},
+	{true, 3, "jmp dword ptr [ebp+17]"},
+	{true, 5, "adc dword ptr gs:[ecx+esi+33], edx"},
+	{true, 4, "adc dword ptr [ecx+esi+33], edx"},
+	{true, 1, "push esp"},
+	{true, 2, "xor dword ptr [ecx], esp"},
+	{true, 3, "and dword ptr [esi-40], esi"},
+	{true, 2, "jbe 0x00000fda"},
+	{true, 2, "fmul dword ptr [edi]"},
+	{false, 2, 0},
+	{true, 3, "div dl"},
+	{true, 2, "div dl"},
+	{true, 4, "repne cmp byte ptr [ebp+76], dl"},
+	{true, 3, "cmp byte ptr [ebp+76], dl"},
+	{true, 1, "push ebp"},
+	{true, 1, "dec esp"},
+	{true, 3, "pop dword ptr [esi+79]"},
+	{true, 1, "inc esi"},
+	{true, 1, "dec edi"},
+	{true, 2, "rep cdq"},
+	{true, 1, "cdq"},
+	{true, 2, "stosd"},
+	{true, 1, "stosd"},
+	{true, 1, "dec ecx"},
+	{true, 3, "xor byte ptr cs:[edi], cl"},
+	{true, 2, "xor byte ptr [edi], cl"},
+	{true, 4, "paddsb mm5, qword ptr [ecx+77]"},
+	{true, 1, "in al, dx"},
+	{true, 7, "imul ecx, dword ptr [ebp-36], 0xd4f01475"},
+	{true, 1, "dec ebp"},
+	{true, 3, "fdiv qword ptr [ebp+20]"},
+	{true, 2, "jnz 0x00001016"},
+	{true, 2, "adc al, 0xf0"},
+	{true, 3, "lock aam 65"},
+	{true, 2, "aam 65"},
+	{true, 1, "inc ecx"},
+	{true, 1, "ret"},
+	{true, 3, "add dword ptr cs:[esi], edx"},
+	{true, 2, "add dword ptr [esi], edx"},
+	{true, 1, "push ss"},
+	{true, 4, "shl byte ptr [ebp-22], 0xd0"},
+	{true, 8, "jmp far 0xc240:0x6f4642d0"},
+	{true, 7, "jmp far 0xc240:0x6f4642d0"},
+	{true, 3, "rol byte ptr [edx+70], 1"},
+	{true, 1, "inc edx"},
+	{true, 1, "inc esi"},
+	{true, 1, "outsd"},
+	{true, 1, "inc eax"},
+	{true, 3, "ret 0x6749"},
+	{true, 1, "dec ecx"},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "jl 0x00000f9f"},
+	{true, 1, "popfd"},
+	{true, 2, "mov dword ptr [ebx], edx"},
+	{true, 3, "adc ebx, dword ptr [edi+ebx*4]"},
+	{true, 2, "sbb al, 0x9f"},
+	{true, 1, "lahf"},
+	{true, 2, "rep pop eax"},
+	{true, 1, "pop eax"},
+	{true, 2, "out 0xff, eax"},
+	{true, 4, "dec dword ptr [edx+eax*2-16]"},
+	{true, 1, "dec esp"},
+	{true, 1, "inc edx"},
+	{true, 2, "lock pushad"},
+	{true, 1, "pushad"},
+	{true, 2, "repne push es"},
+	{true, 1, "push es"},
+	{true, 2, "jbe 0x00000feb"},
+	{true, 5, "jmp 0xf28b65bb"},
+	{true, 2, "mov dh, 85"},
+	{true, 1, "push ebp"},
+	{true, 2, "mov esi, edx"},
+	{true, 2, "repne lahf"},
+	{true, 1, "lahf"},
+	{false, 2, 0},
+	{true, 2, "jz 0x00001070"},
+	{true, 1, "outsb"},
+	{true, 6, "shr byte ptr [edx+0x44dec349], 1"},
+	{true, 1, "stosb"},
+	{true, 1, "dec ecx"},
+	{true, 1, "ret"},
+	{true, 4, "fiadd word ptr [edi+63]"},
+	{true, 1, "inc esp"},
+	{true, 2, "out 63, eax"},
+	{true, 1, "aas"},
+	{true, 1, "push ebp"},
+	{true, 1, "salc"},
+	{true, 2, "inc eax"},
+	{true, 1, "inc eax"},
+	{true, 1, "pop ds"},
+	{true, 2, "out dx, eax"},
+	{true, 1, "out dx, eax"},
+	{true, 7, "rep adc eax, dword ptr [ebx+0xfabd4055]"},
+	{true, 6, "adc eax, dword ptr [ebx+0xfabd4055]"},
+	{true, 4, "adc dword ptr [ebp+64], 0xbd"},
+	{true, 1, "push ebp"},
+	{true, 1, "inc eax"},
+	{true, 5, "mov ebp, 0x4c4c26fa"},
+	{true, 1, "cli"},
+	{true, 2, "dec esp"},
+	{true, 1, "dec esp"},
+	{true, 1, "dec esp"},
+	{true, 1, "push ebp"},
+	{true, 1, "movsd"},
+	{true, 1, "push es"},
+	{true, 5, "mov eax, 0x141ff04b"},
+	{true, 1, "dec ebx"},
+	{true, 2, "lock pop ds"},
+	{true, 1, "pop ds"},
+	{true, 2, "adc al, 0xc5"},
+	{true, 6, "lds edx, fword ptr [eax+0x414d11a5]"},
+	{true, 1, "nop"},
+	{true, 1, "movsd"},
+	{true, 3, "adc dword ptr [ebp+65], ecx"},
+	{true, 1, "dec ebp"},
+	{true, 1, "inc ecx"},
+	{true, 1, "pop ds"},
+	{true, 2, "mov dl, 103"},
+	{true, 2, "dec ecx"},
+	{true, 1, "dec ecx"},
+	{true, 5, "mov ebp, 0xd51fc92e"},
+	{true, 2, "leave"},
+	{true, 1, "leave"},
+	{true, 1, "pop ds"},
+	{true, 2, "aad 1"},
+	{true, 2, "add esi, edx"},
+	{true, 1, "salc"},
+	{true, 1, "dec esi"},
+	{true, 1, "push eax"},
+	{true, 5, "xor eax, 0xcef2eb7d"},
+	{true, 2, "jnl 0x00000fed"},
+	{true, 2, "jmp 0x00000ff4"},
+	{true, 2, "repne into"},
+	{true, 1, "into"},
+	{true, 2, "jle 0x00000fca"},
+	{true, 4, "enter 0x7240, 111"},
+	{true, 1, "inc eax"},
+	{true, 2, "jb 0x00001071"},
+	{true, 1, "outsd"},
+	{true, 1, "inc edi"},
+	{true, 7, "repne cmp dl, byte ptr [eax+0x14b3cfeb]"},
+	{true, 6, "cmp dl, byte ptr [eax+0x14b3cfeb]"},
+	{true, 1, "nop"},
+	{true, 2, "jmp 0x00000fd1"},
+	{true, 1, "iret"},
+	{true, 2, "mov bl, 20"},
+	{true, 2, "adc al, 0x90"},
+	{true, 1, "nop"},
+	{true, 2, "pop ss"},
+	{true, 1, "pop ss"},
+	{true, 1, "dec ecx"},
+	{true, 1, "push esi"},
+	{true, 1, "dec edi"},
+	{true, 1, "dec esp"},
+	{true, 2, "mov byte ptr [edi], bh"},
+	{true, 1, "aas"},
+	{true, 2, "lock dec esp"},
+	{true, 1, "dec esp"},
+	{true, 4, "cmp dword ptr [edi+ecx+70], esi"},
+	{true, 2, "jz 0x00001011"},
+	{true, 4, "cmovb ebp, dword ptr [esi+71]"},
+	{true, 1, "inc esi"},
+	{true, 1, "outsb"},
+	{true, 1, "inc edi"},
+	{true, 2, "arpl word ptr [edi], cx"},
+	{false, 2, 0},
+	{true, 3, "psubusw mm6, mm4"},
+	{true, 2, "fxtract"},
+	{true, 1, "hlt"},
+	{true, 2, "and edx, eax"},
+	{true, 3, "sar byte ptr [eax-48], 1"},
+	{true, 2, "js 0x00000fd2"},
+	{true, 2, "sal bh, 1"},
+	{true, 2, "div ebx"},
+	{true, 2, "repe cmpsb"},
+	{true, 1, "cmpsb"},
+	{true, 1, "out dx, eax"},
+	{true, 3, "fldenv [edi-38]"},
+	{true, 3, "fcmovbe st, st(0)"},
+	{true, 2, "fcmovbe st, st(0)"},
+	{true, 2, "sar al, 1"},
+	{true, 1, "clc"},
+	{true, 1, "dec eax"},
+	{true, 4, "or word ptr [ebp+114], sp"},
+	{true, 3, "or dword ptr [ebp+114], esp"},
+	{true, 3, "jb 0x00001012"},
+	{true, 2, "jb 0x00001011"},
+	{true, 3, "cmovns ebp, dword ptr [ecx]"},
+	{true, 1, "dec ecx"},
+	{true, 6, "sub dword ptr [ecx+0xaa8740ee], ebp"},
+	{true, 5, "test eax, 0xaa8740ee"},
+	{true, 1, "out dx, al"},
+	{true, 1, "inc eax"},
+	{true, 6, "xchg ebp, dword ptr [edx+0x446f4fc1]"},
+	{true, 1, "stosb"},
+	{true, 4, "ror dword ptr [edi+111], 68"},
+	{true, 1, "dec edi"},
+	{true, 1, "outsd"},
+	{true, 1, "inc esp"},
+	{true, 3, "shr byte ptr [esi], 33"},
+	{true, 3, "and dword ptr cs:[ebx], ecx"},
+	{true, 2, "and dword ptr [ebx], ecx"},
+	{true, 2, "or esp, eax"},
+	{true, 2, "loopne 0x0000106e"},
+	{true, 1, "insb"},
+	{true, 1, "dec ebp"},
+	{true, 3, "xor byte ptr [eax-77], ch"},
+	{true, 5, "push 0x66409ab3"},
+	{true, 2, "mov bl, 0x9a"},
+	{true, 7, "callf far 0x5d72:0xcdbd6640"},
+	{true, 1, "inc eax"},
+	{true, 4, "mov bp, 0x72cd"},
+	{true, 5, "mov ebp, 0x405d72cd"},
+	{true, 2, "int 114"},
+	{true, 2, "jb 0x0000105f"},
+	{true, 1, "pop ebp"},
+	{true, 1, "inc eax"},
+	{true, 3, "cmp cl, byte ptr [eax+97]"},
+	{true, 1, "dec eax"},
+	{true, 1, "popad"},
+	{true, 1, "dec eax"},
+	{true, 1, "iret"},
+	{true, 5, "and eax, 0x0f8d03e1"},
+	{true, 2, "loope 0x00001005"},
+	{true, 6, "add ecx, dword ptr [ebp+0x7965400f]"},
+	{true, 2, "lea ecx, [edi]"},
+	{true, 4, "cmovo esp, dword ptr [ebp+121]"},
+	{true, 1, "inc eax"},
+	{true, 3, "jns 0x0000105f"},
+	{true, 2, "jns 0x0000105e"},
+	{true, 1, "pop esp"},
+	{true, 1, "popad"},
+	{true, 2, "and al, 0xc2"},
+	{true, 3, "ret 0x0fc0"},
+	{true, 3, "ror byte ptr [edi], 0xf2"},
+	{true, 3, "pslld mm2, qword ptr [eax]"},
+	{true, 3, "repne adc byte ptr [ecx], al"},
+	{true, 2, "adc byte ptr [ecx], al"},
+	{true, 2, "add esi, edx"},
+	{true, 1, "salc"},
+	{true, 1, "leave"},
+	{true, 5, "sar dword ptr [bx+si+64], 10"},
+	{true, 4, "sar dword ptr [eax+64], 10"},
+	{true, 2, "js 0x00001042"},
+	{true, 1, "inc eax"},
+	{true, 6, "or dh, byte ptr [ebx+0x43fcf322]"},
+	{true, 2, "mov bl, 34"},
+	{true, 2, "and dh, bl"},
+	{true, 2, "rep cld"},
+	{true, 1, "cld"},
+	{true, 1, "inc ebx"},
+	{true, 2, "repne inc edi"},
+	{true, 1, "inc edi"},
+	{true, 2, "jnb 0x0000104a"},
+	{true, 1, "dec eax"},
+	{true, 1, "inc eax"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "out dx, al"},
+	{true, 2, "jl 0x0000102a"},
+	{true, 2, "sub al, dh"},
+	{true, 3, "lock xchg esi, eax"},
+	{true, 2, "xchg esi, eax"},
+	{true, 1, "xchg esi, eax"},
+	{true, 1, "inc eax"},
+	{true, 1, "inc eax"},
+	{true, 1, "pop ebx"},
+	{true, 3, "mov esi, dword ptr [eax+48]"},
+	{true, 2, "jo 0x00001032"},
+	{true, 2, "xor byte ptr [esi], ah"},
+	{true, 3, "jp 0x00000f99"},
+	{true, 2, "jp 0x00000f98"},
+	{true, 1, "xchg esi, eax"},
+	{true, 3, "fisttp word ptr [ebp-14]"},
+	{true, 1, "dec ebp"},
+	{true, 7, "repne fadd dword ptr [esi+0xf69b2e27]"},
+	{true, 6, "fadd dword ptr [esi+0xf69b2e27]"},
+	{true, 2, "xchg ah, byte ptr [edi]"},
+	{true, 1, "daa"},
+	{true, 2, "wait"},
+	{true, 1, "wait"},
+	{true, 7, "test byte ptr [edx+0x4c670f65], 56"},
+	{true, 4, "and byte ptr [ebp+15], 103"},
+	{true, 6, "packuswb mm1, qword ptr gs:[eax+edi+73]"},
+	{true, 5, "packuswb mm1, qword ptr [eax+edi+73]"},
+	{true, 2, "dec esp"},
+	{true, 1, "dec esp"},
+	{true, 3, "cmp byte ptr [ecx+26], cl"},
+	{true, 1, "dec ecx"},
+	{true, 3, "sbb al, byte ptr [eax-50]"},
+	{true, 1, "inc eax"},
+	{true, 1, "into"},
+	{true, 1, "inc ecx"},
+	{true, 2, "rcl eax, 1"},
+	{true, 2, "ror byte ptr [edi], 1"},
+	{false, 2, 0},
+	{true, 1, "insd"},
+	{true, 2, "inc bx"},
+	{true, 1, "inc ebx"},
+	{true, 3, "or esp, dword ptr [esp+esi*8]"},
+	{true, 2, "and al, 0xf4"},
+	{true, 1, "hlt"},
+	{true, 4, "cmovnle ecx, dword ptr [edi-93]"},
+	{true, 1, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 5, "mov dword ptr [0x7e48dd55], eax"},
+	{true, 1, "push ebp"},
+	{true, 3, "fisttp qword ptr [eax+126]"},
+	{true, 1, "dec eax"},
+	{true, 2, "jle 0x00001067"},
+	{true, 2, "push esp"},
+	{true, 1, "push esp"},
+	{true, 3, "jmp 0x00000fa5"},
+	{true, 2, "jmp 0x00000fa4"},
+	{true, 5, "mov byte ptr [0x8fc3e948], al"},
+	{true, 1, "dec eax"},
+	{true, 5, "jmp 0x0fca9fc8"},
+	{true, 1, "ret"},
+	{false, 2, 0},
+	{true, 3, "retf 0xffffc60f"},
+	{true, 4, "shufps xmm3, xmmword ptr [edx], 0xe4"},
+	{false, 2, 0},
+	{true, 2, "sbb ah, ah"},
+	{true, 2, "in al, 79"},
+	{true, 1, "dec edi"},
+	{false, 2, 0},
+	{true, 4, "or byte ptr [ebx-20], ah"},
+	{true, 6, "mov dword ptr fs:[0x27ded0ec], eax"},
+	{true, 5, "mov dword ptr [0x27ded0ec], eax"},
+	{true, 1, "in al, dx"},
+	{true, 2, "rcr dh, 1"},
+	{true, 2, "fisub word ptr [edi]"},
+	{true, 1, "daa"},
+	{true, 5, "or eax, 0xc3a75f6c"},
+	{true, 1, "insb"},
+	{true, 1, "pop edi"},
+	{true, 1, "cmpsd"},
+	{true, 1, "ret"},
+	{true, 3, "mov bh, 0xd7"},
+	{true, 2, "mov bh, 0xd7"},
+	{true, 1, "xlat"},
+	{true, 1, "xchg esi, eax"},
+	{true, 2, "aad 73"},
+	{true, 1, "dec ecx"},
+	{true, 1, "inc ecx"},
+	{true, 1, "aas"},
+	{true, 3, "rep mov dl, 72"},
+	{true, 2, "mov dl, 72"},
+	{true, 1, "dec eax"},
+	{true, 5, "mov dword ptr [0xf3646173], eax"},
+	{true, 2, "jnb 0x00001063"},
+	{true, 1, "popad"},
+	{true, 4, "rep adc dword ptr fs:[edi], ecx"},
+	{true, 3, "rep adc dword ptr [edi], ecx"},
+	{true, 2, "adc dword ptr [edi], ecx"},
+	{false, 3, 0},
+	{true, 7, "cmp ah, byte ptr [edi+0x58092c75]"},
+	{true, 1, "movsb"},
+	{true, 2, "out 117, eax"},
+	{true, 2, "jnz 0x0000102e"},
+	{true, 2, "sub al, 9"},
+	{true, 3, "or dword ptr [eax-94], ebx"},
+	{true, 1, "pop eax"},
+	{true, 5, "mov byte ptr [0x4fa448c0], al"},
+	{true, 4, "ror byte ptr [eax-92], 79"},
+	{true, 1, "dec eax"},
+	{true, 1, "movsb"},
+	{true, 1, "dec edi"},
+	{true, 2, "in eax, dx"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "repne inc edx"},
+	{true, 1, "inc edx"},
+	{true, 5, "sbb byte ptr [ebx+edx*2+101], 58"},
+	{true, 1, "pop esp"},
+	{true, 1, "push ebx"},
+	{true, 4, "cmp ah, byte ptr gs:[ecx+7]"},
+	{true, 3, "cmp ah, byte ptr [ecx+7]"},
+	{true, 1, "popad"},
+	{true, 1, "pop es"},
+	{true, 3, "sbb al, byte ptr [ecx+76]"},
+	{true, 1, "inc ecx"},
+	{true, 1, "dec esp"},
+	{true, 4, "lock inc esi"},
+	{true, 3, "lock inc esi"},
+	{true, 2, "lock inc esi"},
+	{true, 1, "inc esi"},
+	{true, 5, "mov ebx, 0x61e667d1"},
+	{true, 3, "shl dword ptr [edi-26], 1"},
+	{true, 3, "out 97, al"},
+	{true, 2, "out 97, al"},
+	{true, 1, "popad"},
+	{true, 1, "lahf"},
+	{true, 1, "out dx, al"},
+	{true, 1, "dec ebx"},
+	{true, 2, "xor ebp, esi"},
+	{true, 1, "cmc"},
+	{true, 1, "inc ecx"},
+	{true, 2, "jnb 0x00001070"},
+	{true, 1, "outsb"},
+	{true, 2, "leave"},
+	{true, 1, "leave"},
+	{true, 4, "repne fisttp dword ptr [bx]"},
+	{true, 3, "repne fisttp dword ptr [edi]"},
+	{true, 2, "fisttp dword ptr [edi]"},
+	{true, 7, "minps xmm1, xmmword ptr [eax+0xf8be4f33]"},
+	{true, 1, "pop ebp"},
+	{true, 2, "mov byte ptr [ebx], dh"},
+	{true, 3, "xor ecx, dword ptr [edi-66]"},
+	{true, 1, "dec edi"},
+	{true, 5, "mov esi, 0x2d997ff8"},
+	{true, 1, "clc"},
+	{true, 2, "jnle 0x00000f9b"},
+	{true, 1, "cdq"},
+	{true, 5, "sub eax, 0x75449041"},
+	{true, 1, "inc ecx"},
+	{true, 1, "nop"},
+	{true, 1, "inc esp"},
+	{true, 2, "jnz 0x00000fb1"},
+	{true, 1, "scasd"},
+	{true, 3, "repne retf"},
+	{true, 2, "retf"},
+	{true, 1, "retf"},
+	{true, 1, "outsb"},
+	{true, 5, "mov al, byte ptr [0x41b09fcf]"},
+	{true, 1, "iret"},
+	{true, 1, "lahf"},
+	{true, 2, "mov al, 65"},
+	{true, 1, "inc ecx"},
+	{true, 1, "retf"},
+	{true, 1, "inc ecx"},
+	{true, 3, "xor ch, 0xdf"},
+	{true, 1, "cmc"},
+	{true, 2, "fisttp word ptr [edi]"},
+	{true, 4, "pmaddwd mm4, qword ptr [ebp+78]"},
+	{true, 1, "cmc"},
+	{true, 2, "dec esi"},
+	{true, 1, "dec esi"},
+	{true, 2, "sub dl, ch"},
+	{true, 7, "jmp far 0x482e:0xdbc475d7"},
+	{true, 1, "xlat"},
+	{true, 2, "jnz 0x00000fc6"},
+	{true, 2, "les ebx, (invalid)"},
+	{true, 2, "fld tbyte ptr [esi]"},
+	{true, 2, "dec eax"},
+	{true, 1, "dec eax"},
+	{true, 2, "jnb 0x00001000"},
+	{false, 2, 0},
+	{true, 5, "and eax, 0x33828147"},
+	{true, 1, "inc edi"},
+	{true, 10, "add dword ptr [edx+0x6760a033], 0x2c64b567"},
+	{true, 3, "xor byte ptr [ebx], 0xa0"},
+	{true, 6, "xor esp, dword ptr [eax+0xb5676760]"},
+	{true, 5, "mov al, byte ptr [0xb5676760]"},
+	{true, 1, "pushad"},
+	{true, 4, "mov ch, 100"},
+	{true, 3, "mov ch, 100"},
+	{true, 2, "mov ch, 100"},
+	{true, 3, "sub al, 0xbf"},
+	{true, 2, "sub al, 0xbf"},
+	{true, 5, "mov edi, 0xb88fd2c9"},
+	{true, 1, "leave"},
+	{true, 6, "ror byte ptr [edi+0xa0722cb8], cl"},
+	{false, 2, 0},
+	{true, 5, "mov eax, 0x41a0722c"},
+	{true, 2, "sub al, 114"},
+	{true, 2, "jb 0x00000fa2"},
+	{true, 5, "mov al, byte ptr [0x3e4b7b41]"},
+	{true, 1, "inc ecx"},
+	{true, 2, "jnp 0x0000104d"},
+	{true, 1, "dec ebx"},
+	{true, 8, "pop dword ptr ds:[edi+0xcc4fbc86]"},
+	{true, 7, "pop dword ptr [edi+0xcc4fbc86]"},
+	{true, 3, "test byte ptr [edi-122], ah"},
+	{true, 5, "xchg bh, byte ptr [si-13233]"},
+	{true, 7, "xchg bh, byte ptr [edi+ecx*2+0x5db680cc]"},
+	{true, 5, "mov esp, 0xb680cc4f"},
+	{true, 1, "dec edi"},
+	{true, 1, "int3"},
+	{true, 7, "xor byte ptr [esi+0x1cca985d], 64"},
+	{true, 2, "mov dh, 93"},
+	{true, 1, "pop ebp"},
+	{true, 1, "cwde"},
+	{true, 3, "retf 0x401c"},
+	{true, 2, "sbb al, 64"},
+	{true, 1, "inc eax"},
+	{true, 2, "mov ah, 21"},
+	{true, 5, "adc eax, 0xfb378620"},
+	{true, 6, "and byte ptr [esi+0x7472fb37], al"},
+	{true, 2, "xchg dh, byte ptr [edi]"},
+	{true, 1, "aaa"},
+	{true, 1, "sti"},
+	{true, 2, "jb 0x00001076"},
+	{true, 2, "jz 0x00000fa4"},
+	{true, 5, "mov byte ptr [0x905696f3], al"},
+	{true, 2, "rep xchg esi, eax"},
+	{true, 1, "xchg esi, eax"},
+	{true, 1, "push esi"},
+	{true, 1, "nop"},
+	{true, 1, "stosd"},
+	{true, 5, "test eax, 0x992e54df"},
+	{true, 4, "fist word ptr [esi+ebp-103]"},
+	{true, 1, "push esp"},
+	{true, 2, "cdq"},
+	{true, 1, "cdq"},
+	{true, 6, "adc byte ptr [esi+0x8653cf4f], al"},
+	{true, 3, "xchg cl, byte ptr [edi-49]"},
+	{true, 1, "dec edi"},
+	{true, 1, "iret"},
+	{true, 1, "push ebx"},
+	{true, 6, "xchg dh, byte ptr [ecx+0x44e84341]"},
+	{true, 2, "mov cl, 65"},
+	{true, 1, "inc ecx"},
+	{true, 1, "inc ebx"},
+	{true, 5, "call 0x412a0b49"},
+	{true, 1, "inc esp"},
+	{true, 1, "sti"},
+	{true, 3, "sub dword ptr [ecx-100], eax"},
+	{true, 1, "inc ecx"},
+	{true, 1, "pushfd"},
+	{true, 3, "sbb al, byte ptr [eax+86]"},
+	{true, 1, "inc eax"},
+	{true, 1, "push esi"},
+	{true, 2, "jnb 0x00000ff4"},
+	{true, 2, "repne inc eax"},
+	{true, 1, "inc eax"},
+	{true, 7, "callf far 0x27f2:0x1e022e36"},
+	{true, 4, "add bl, byte ptr cs:[esi]"},
+	{true, 3, "add bl, byte ptr cs:[esi]"},
+	{true, 2, "add bl, byte ptr [esi]"},
+	{true, 1, "push ds"},
+	{true, 2, "repne daa"},
+	{true, 1, "daa"},
+	{true, 3, "adc al, 102"},
+	{true, 3, "shl byte ptr [esi+64], 1"},
+	{true, 2, "inc ax"},
+	{true, 1, "inc eax"},
+	{true, 10, "sbb dword ptr [0x2667498b], 0x9f48c2c6"},
+	{true, 5, "sbb eax, 0x2667498b"},
+	{true, 3, "mov ecx, dword ptr [ecx+103]"},
+	{true, 1, "dec ecx"},
+	{true, 5, "mov dl, 72"},
+	{true, 4, "mov dl, 72"},
+	{true, 3, "mov dl, 72"},
+	{true, 3, "ret 0xffff9f48"},
+	{true, 1, "dec eax"},
+	{true, 1, "lahf"},
+	{true, 4, "adc cl, byte ptr [ebx+edi*2-48]"},
+	{true, 1, "dec esp"},
+	{true, 2, "jnp 0x00000fd2"},
+	{true, 2, "shr byte ptr [esi], 1"},
+	{true, 3, "in al, 0x80"},
+	{true, 2, "in al, 0x80"},
+	{true, 4, "add byte ptr [eax+68], 0x8c"},
+	{true, 1, "inc eax"},
+	{true, 1, "inc esp"},
+	{true, 4, "mov dword ptr [esi+ebp-55], cs"},
+	{true, 1, "dec esp"},
+	{true, 2, "leave"},
+	{true, 1, "leave"},
+	{true, 2, "salc"},
+	{true, 1, "salc"},
+	{true, 3, "retf 0xffff8a3a"},
+	{true, 6, "cmp cl, byte ptr [edx+0x9c494e64]"},
+	{true, 4, "mov ah, byte ptr [esi+ecx*2+73]"},
+	{true, 2, "dec esi"},
+	{true, 1, "dec esi"},
+	{true, 1, "dec ecx"},
+	{true, 1, "pushfd"},
+	{true, 4, "cmp eax, dword ptr [ecx+edx*4+116]"},
+	{true, 1, "inc esp"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "jz 0x0000104a"},
+	{true, 1, "dec eax"},
+	{true, 1, "push esi"},
+	{true, 2, "idiv byte ptr [edx]"},
+	{true, 6, "cmp dl, byte ptr [0x33194ff0]"},
+	{true, 5, "adc eax, 0x33194ff0"},
+	{true, 2, "lock dec edi"},
+	{true, 1, "dec edi"},
+	{true, 2, "sbb dword ptr [ebx], esi"},
+	{true, 7, "xor esi, dword ptr [ebp+ebx*8+0xb5e3763e]"},
+	{true, 2, "mov ah, 0xdd"},
+	{true, 2, "fnstsw word ptr [esi]"},
+	{true, 3, "jbe 0x00000fe6"},
+	{true, 2, "jbe 0x00000fe5"},
+	{true, 2, "jcez 0x00000fb7"},
+	{true, 2, "mov ch, 102"},
+	{true, 2, "inc bp"},
+	{true, 1, "inc ebp"},
+	{true, 2, "cmp ecx, dword ptr [edi]"},
+	{true, 4, "btc dword ptr [ecx+66], edi"},
+	{true, 5, "mov ebx, 0xf0ea4279"},
+	{true, 2, "jns 0x00001044"},
+	{true, 1, "inc edx"},
+	{true, 7, "jmp far 0xa510:0x995c44f0"},
+	{true, 2, "lock inc esp"},
+	{true, 1, "inc esp"},
+	{true, 1, "pop esp"},
+	{true, 1, "cdq"},
+	{true, 6, "adc byte ptr [ebp+0xf943b736], ah"},
+	{true, 1, "movsd"},
+	{true, 3, "mov bh, 67"},
+	{true, 2, "mov bh, 67"},
+	{true, 1, "inc ebx"},
+	{true, 1, "stc"},
+	{true, 3, "or byte ptr [esi-91], dh"},
+	{true, 2, "jbe 0x00000fa7"},
+	{true, 1, "movsd"},
+	{true, 1, "dec ebp"},
+	{true, 4, "cmp byte ptr ds:[edi-40], cl"},
+	{true, 3, "cmp byte ptr [edi-40], cl"},
+	{true, 1, "dec edi"},
+	{true, 6, "fmul dword ptr [edi+0x2cee2e84]"},
+	{true, 7, "pop dword ptr [esi+ebp+0xb02b2cee]"},
+	{true, 2, "test byte ptr [esi], ch"},
+	{true, 2, "out dx, al"},
+	{true, 1, "out dx, al"},
+	{true, 2, "sub al, 43"},
+	{true, 6, "sub esi, dword ptr [eax+0x64978040]"},
+	{true, 2, "mov al, 64"},
+	{true, 1, "inc eax"},
+	{true, 7, "adc byte ptr [edi+0x48269064], 117"},
+	{true, 1, "xchg edi, eax"},
+	{true, 2, "nop"},
+	{true, 1, "nop"},
+	{true, 2, "dec eax"},
+	{true, 1, "dec eax"},
+	{true, 2, "jnz 0x00001010"},
+	{true, 1, "push cs"},
+	{true, 3, "lock mov bh, 0xcf"},
+	{true, 2, "mov bh, 0xcf"},
+	{true, 1, "iret"},
+	{true, 3, "jcez 0x00000fd6"},
+	{true, 2, "jcez 0x00000fd5"},
+	{true, 3, "shl dword ptr [esi+65], cl"},
+	{true, 2, "inc cx"},
+	{true, 1, "inc ecx"},
+	{true, 1, "push ebx"},
+	{true, 2, "jnl 0x00001004"},
+	{true, 2, "add ch, ch"},
+	{true, 1, "in eax, dx"},
+	{true, 5, "cmovno edi, dword ptr [esi+ebp*8+111]"},
+	{true, 1, "inc ecx"},
+	{true, 2, "jl 0x00000ff0"},
+	{true, 1, "out dx, al"},
+	{true, 1, "outsd"},
+	{true, 2, "jnbe 0x00000f89"},
+	{true, 2, "xchg edx, eax"},
+	{true, 2, "ror byte ptr [ecx], 1"},
+	{true, 6, "or dword ptr [edx+0x862566b2], esp"},
+	{true, 5, "mov byte ptr [0x862566b2], al"},
+	{true, 2, "mov dl, 102"},
+	{true, 4, "and ax, 0xffffb486"},
+	{true, 5, "and eax, 0x4d4db486"},
+	{true, 7, "xchg dh, byte ptr [ebp+ecx*2+0xe0b9894d]"},
+	{true, 2, "mov ah, 77"},
+	{true, 1, "dec ebp"},
+	{true, 1, "dec ebp"},
+	{true, 6, "mov dword ptr [ecx+0x443c5fe0], edi"},
+	{true, 5, "mov ecx, 0x443c5fe0"},
+	{true, 2, "loopne 0x00001061"},
+	{true, 1, "pop edi"},
+	{true, 2, "cmp al, 68"},
+	{true, 1, "inc esp"},
+	{true, 2, "xchg sp, ax"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "movd mm1, dword ptr [edi]"},
+	{true, 1, "outsb"},
+	{true, 6, "jbe 0xf31a5e46"},
+	{true, 3, "xchg al, byte ptr [eax+78]"},
+	{true, 1, "inc eax"},
+	{true, 1, "dec esi"},
+	{true, 2, "sbb dh, bl"},
+	{true, 3, "rdmsr"},
+	{true, 2, "rdmsr"},
+	{true, 2, "xor bh, ch"},
+	{true, 1, "std"},
+	{true, 1, "popad"},
+	{true, 1, "lodsb"},
+	{true, 1, "stc"},
+	{true, 3, "add byte ptr [ecx+112], ch"},
+	{true, 7, "imul esi, dword ptr [eax+101], 0x88f0f809"},
+	{true, 2, "jo 0x00001067"},
+	{true, 3, "or eax, edi"},
+	{true, 2, "or eax, edi"},
+	{true, 1, "clc"},
+	{true, 4, "lock mov byte ptr [eax+61], al"},
+	{true, 3, "mov byte ptr [eax+61], al"},
+	{true, 1, "inc eax"},
+	{true, 5, "cmp eax, 0x700d5aa4"},
+	{true, 1, "movsb"},
+	{true, 1, "pop edx"},
+	{true, 5, "or eax, 0x00229e70"},
+	{true, 2, "jo 0x00000fa0"},
+	{true, 1, "sahf"},
+	{true, 2, "and al, byte ptr [eax]"},
+	{true, 2, "add byte ptr [esi], bh"},
+	{true, 2, "inc esp"},
+	{true, 1, "inc esp"},
+	{true, 1, "push es"},
+	{true, 1, "insd"},
+	{true, 1, "in eax, dx"},
+	{false, 2, 0},
+	{true, 3, "mov byte ptr [eax+77], cl"},
+	{true, 1, "dec eax"},
+	{true, 1, "dec ebp"},
+	{true, 3, "rcl byte ptr [esi], 1"},
+	{true, 2, "adc al, 102"},
+	{true, 3, "jz 0x0000101c"},
+	{true, 2, "jz 0x0000101b"},
+	{true, 2, "sbb eax, esi"},
+	{true, 4, "lock cmp ch, dl"},
+	{true, 3, "cmp ch, dl"},
+	{true, 2, "cmp ch, dl"},
+	{true, 7, "jmp far 0x0ce8:0xff261caa"},
+	{true, 1, "stosb"},
+	{true, 2, "sbb al, 38"},
+	{true, 3, "jmpf (invalid)"},
+	{true, 2, "jmpf (invalid)"},
+	{true, 5, "call 0x65b9c111"},
+	{true, 2, "or al, 0xb1"},
+	{true, 2, "mov cl, 0xb9"},
+	{true, 5, "mov ecx, 0x644c9b65"},
+	{true, 2, "wait"},
+	{true, 1, "wait"},
+	{true, 1, "dec esp"},
+	{true, 3, "xor esp, dword ptr fs:[esi]"},
+	{true, 2, "xor esp, dword ptr [esi]"},
+	{true, 3, "repne inc ebp"},
+	{true, 2, "repne inc ebp"},
+	{true, 1, "inc ebp"},
+	{true, 4, "enter 0xffffd897, 0xd5"},
+	{true, 1, "xchg edi, eax"},
+	{true, 2, "fcom st(5)"},
+	{true, 2, "aad 0xae"},
+	{true, 1, "scasb"},
+	{true, 1, "dec esp"},
+	{true, 1, "dec esp"},
+	{false, 2, 0},
+	{true, 3, "jmp dword ptr [edi-74]"},
+	{true, 3, "mov dh, 0xb4"},
+	{true, 2, "mov dh, 0xb4"},
+	{true, 2, "mov ah, 72"},
+	{true, 1, "dec eax"},
+	{true, 3, "dec ecx"},
+	{true, 2, "dec ecx"},
+	{true, 1, "dec ecx"},
+	{true, 6, "fmul qword ptr [0x7148f661]"},
+	{true, 5, "or eax, 0x7148f661"},
+	{true, 1, "popad"},
+	{false, 2, 0},
+	{true, 1, "dec eax"},
+	{true, 2, "jno 0x0000104a"},
+	{true, 1, "dec eax"},
+	{true, 1, "dec eax"},
+	{true, 1, "inc eax"},
+	{true, 3, "repne jnbe 0x00000fd5"},
+	{true, 2, "jnbe 0x00000fd4"},
+	{true, 6, "rol byte ptr [esi+0xd294f836], cl"},
+	{true, 2, "xchg dh, byte ptr [esi]"},
+	{true, 2, "clc"},
+	{true, 1, "clc"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "shl byte ptr [ecx-108], cl"},
+	{true, 1, "popad"},
+	{true, 1, "xchg esp, eax"},
+	{true, 6, "adc bh, byte ptr [ebp+0xd2a02e6e]"},
+	{true, 5, "mov ebp, 0xd2a02e6e"},
+	{true, 1, "outsb"},
+	{true, 6, "mov al, byte ptr cs:[0x733536d2]"},
+	{true, 5, "mov al, byte ptr [0x733536d2]"},
+	{true, 2, "sal byte ptr [esi], cl"},
+	{true, 6, "xor eax, 0xe43e6673"},
+	{true, 5, "xor eax, 0xe43e6673"},
+	{true, 2, "jnb 0x00001068"},
+	{true, 4, "in al, 62"},
+	{true, 3, "in al, 62"},
+	{true, 2, "in al, 62"},
+	{true, 6, "add eax, 0x460f9322"},
+	{true, 5, "add eax, 0x460f9322"},
+	{true, 6, "and dl, byte ptr [ebx+0xdc88460f]"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 7, "cmovb ecx, dword ptr [eax+0xf3112adc]"},
+	{true, 1, "inc esi"},
+	{true, 2, "mov ah, bl"},
+	{true, 2, "fsubr qword ptr [edx]"},
+	{true, 2, "sub dl, byte ptr [ecx]"},
+	{true, 2, "adc ebx, esi"},
+	{true, 7, "rep mov dword ptr [edi+0x07a3e159], ecx"},
+	{true, 6, "mov dword ptr [edi+0x07a3e159], ecx"},
+	{false, 2, 0},
+	{true, 1, "pop ecx"},
+	{true, 2, "loope 0x00000fa5"},
+	{true, 5, "mov dword ptr [0x70444d07], eax"},
+	{true, 1, "pop es"},
+	{true, 1, "dec ebp"},
+	{true, 1, "inc esp"},
+	{true, 2, "jo 0x00000fe5"},
+	{true, 2, "jcez 0x00000fb6"},
+	{true, 2, "mov ah, 65"},
+	{true, 1, "inc ecx"},
+	{true, 3, "lock dec ebp"},
+	{true, 2, "dec ebp"},
+	{true, 1, "dec ebp"},
+	{true, 1, "popad"},
+	{true, 4, "dec byte ptr [eax+72]"},
+	{true, 1, "dec esp"},
+	{true, 1, "pushad"},
+	{true, 1, "dec eax"},
+	{true, 7, "callf far 0x403e:0x64a0c3c3"},
+	{true, 1, "ret"},
+	{true, 1, "ret"},
+	{true, 5, "mov al, byte ptr [0xf8403e64]"},
+	{true, 3, "inc eax"},
+	{true, 2, "inc eax"},
+	{true, 1, "inc eax"},
+	{true, 1, "clc"},
+	{true, 3, "lock bswap edi"},
+	{true, 2, "bswap edi"},
+	{true, 1, "iret"},
+	{true, 1, "leave"},
+	{true, 5, "or eax, 0x1f434f66"},
+	{true, 2, "dec di"},
+	{true, 1, "dec edi"},
+	{true, 1, "inc ebx"},
+	{true, 1, "pop ds"},
+	{true, 1, "inc eax"},
+	{true, 5, "xor eax, 0x657fb8ef"},
+	{true, 1, "out dx, eax"},
+	{true, 5, "mov eax, 0xf077657f"},
+	{true, 2, "jnle 0x00001067"},
+	{true, 3, "jnbe 0x00000ff3"},
+	{true, 2, "jnbe 0x00000ff2"},
+	{true, 3, "lock mov dh, 0xa5"},
+	{true, 2, "mov dh, 0xa5"},
+	{true, 1, "movsd"},
+	{true, 4, "and byte ptr [bp-40], ah"},
+	{true, 3, "and byte ptr [esi-40], ah"},
+	{true, 3, "fsub dword ptr [esi]"},
+	{true, 2, "fsub dword ptr [esi]"},
+	{true, 3, "js 0x00001044"},
+	{true, 2, "js 0x00001043"},
+	{true, 1, "inc ecx"},
+	{true, 2, "mov ah, 0xce"},
+	{true, 1, "into"},
+	{true, 1, "clc"},
+	{true, 1, "dec esp"},
+	{true, 5, "mov esi, 0xbf8d4066"},
+	{true, 2, "inc ax"},
+	{true, 1, "inc eax"},
+	{true, 6, "lea edi, [edi+0x789f91f0]"},
+	{true, 5, "mov edi, 0x789f91f0"},
+	{true, 2, "lock xchg ecx, eax"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 1, "lahf"},
+	{true, 2, "js 0x00000f87"},
+	{true, 2, "test ebx, ebx"},
+	{false, 2, 0},
+	{true, 2, "mov al, 0xcb"},
+	{true, 1, "retf"},
+	{true, 1, "aas"},
+	{true, 5, "mov esp, 0x3e12411c"},
+	{true, 2, "sbb al, 65"},
+	{true, 1, "inc ecx"},
+	{true, 2, "adc bh, byte ptr [esi]"},
+	{true, 4, "xor cl, byte ptr ds:[ebp]"},
+	{true, 3, "xor cl, byte ptr [ebp]"},
+	{true, 1, "dec ebp"},
+	{true, 6, "add byte ptr [ecx+0x6d644825], ch"},
+	{true, 5, "test eax, 0x6d644825"},
+	{true, 5, "and eax, 0x316d6448"},
+	{true, 1, "dec eax"},
+	{true, 2, "insd"},
+	{true, 1, "insd"},
+	{true, 2, "xor ebx, esi"},
+	{true, 5, "psllq mm7, qword ptr [edi]"},
+	{true, 4, "psllq mm7, qword ptr [edi]"},
+	{true, 3, "psllq mm7, qword ptr [edi]"},
+	{true, 2, "rep aas"},
+	{true, 1, "aas"},
+	{true, 1, "dec esp"},
+	{true, 3, "rep inc eax"},
+	{true, 2, "inc eax"},
+	{true, 1, "inc eax"},
+	{true, 1, "dec ebp"},
+	{true, 5, "mov byte ptr [0x4c0c6466], al"},
+	{true, 4, "or al, 76"},
+	{true, 3, "or al, 76"},
+	{true, 2, "or al, 76"},
+	{true, 1, "dec esp"},
+	{true, 1, "xchg edx, eax"},
+	{true, 3, "and byte ptr [eax-55], cl"},
+	{true, 1, "dec eax"},
+	{true, 1, "leave"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "repne inc ebp"},
+	{true, 1, "inc ebp"},
+	{true, 1, "dec edi"},
+	{true, 4, "shl dword ptr [esi-128], 103"},
+	{true, 5, "and byte ptr [edi+16], 54"},
+	{true, 4, "and byte ptr [edi+16], 54"},
+	{true, 5, "adc byte ptr [0x0f6c], dh"},
+	{true, 2, "adc byte ptr [esi], dh"},
+	{true, 2, "insb"},
+	{true, 1, "insb"},
+	{true, 8, "shufps xmm4, xmmword ptr [esi+0x41806651], 0xd5"},
+	{false, 2, 0},
+	{true, 1, "cmpsb"},
+	{true, 1, "push ecx"},
+	{true, 5, "add byte ptr [ecx-43], 75"},
+	{true, 4, "add byte ptr [ecx-43], 75"},
+	{true, 1, "inc ecx"},
+	{true, 2, "aad 75"},
+	{true, 1, "dec ebx"},
+	{true, 1, "inc ecx"},
+	{true, 3, "cmp eax, esi"},
+	{true, 2, "cmp eax, esi"},
+	{true, 4, "lock xor edi, dword ptr [edi+64]"},
+	{true, 3, "xor edi, dword ptr [edi+64]"},
+	{true, 2, "jnle 0x00001042"},
+	{true, 1, "inc eax"},
+	{true, 1, "leave"},
+	{true, 2, "lock push ebx"},
+	{true, 1, "push ebx"},
+	{true, 1, "iret"},
+	{true, 5, "sub eax, 0xfd36f02f"},
+	{true, 1, "das"},
+	{true, 3, "lock std"},
+	{true, 2, "std"},
+	{true, 1, "std"},
+	{true, 1, "stc"},
+	{true, 1, "xlat"},
+	{true, 2, "sub byte ptr [edi], ah"},
+	{true, 1, "daa"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "cdq"},
+	{true, 1, "insb"},
+	{true, 3, "bound esp, (invalid)"},
+	{true, 2, "bound esp, (invalid)"},
+	{true, 2, "jcez 0x00001034"},
+	{true, 3, "xor ah, byte ptr [edi+79]"},
+	{true, 2, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 1, "dec ebp"},
+	{true, 3, "and esp, dword ptr [ebx-26]"},
+	{true, 2, "arpl si, sp"},
+	{true, 2, "out 106, al"},
+	{true, 2, "push 23"},
+	{true, 1, "pop ss"},
+	{true, 1, "cmpsb"},
+	{true, 3, "jnz 0x00000f88"},
+	{true, 2, "jnz 0x00000f87"},
+	{true, 2, "test eax, ebx"},
+	{true, 6, "fsub dword ptr [eax+0x11379b82]"},
+	{true, 5, "mov al, byte ptr [0x11379b82]"},
+	{true, 7, "sbb byte ptr [ebx+0x44481137], 73"},
+	{true, 1, "wait"},
+	{true, 1, "aaa"},
+	{true, 3, "adc dword ptr [eax+68], ecx"},
+	{true, 1, "dec eax"},
+	{true, 1, "inc esp"},
+	{true, 1, "dec ecx"},
+	{true, 2, "jno 0x00001042"},
+	{true, 1, "inc eax"},
+	{true, 2, "jle 0x0000103a"},
+	{true, 6, "cmp byte ptr [ebx+0x5b1f2e71], dh"},
+	{true, 2, "mov bl, 113"},
+	{true, 2, "jno 0x00001030"},
+	{true, 2, "pop ds"},
+	{true, 1, "pop ds"},
+	{true, 1, "pop ebx"},
+	{true, 1, "inc eax"},
+	{true, 4, "fisttp dword ptr [edx+edx*2-66]"},
+	{true, 1, "dec esp"},
+	{true, 1, "push edx"},
+	{true, 5, "mov esi, 0x49e54867"},
+	{true, 2, "dec eax"},
+	{true, 1, "dec eax"},
+	{true, 2, "in eax, 73"},
+	{true, 1, "dec ecx"},
+	{true, 1, "dec edi"},
+	{true, 2, "mov ch, 0xfb"},
+	{true, 1, "sti"},
+	{true, 1, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 2, "dec ecx"},
+	{true, 1, "dec ecx"},
+	{true, 1, "retf"},
+	{true, 2, "jb 0x0000104b"},
+	{true, 1, "dec ecx"},
+	{true, 1, "int3"},
+	{true, 5, "or eax, 0x66be80e7"},
+	{true, 2, "out 0x80, eax"},
+	{true, 7, "cmp byte ptr [esi+0x56260966], 124"},
+	{true, 5, "mov esi, 0x56260966"},
+	{true, 3, "or word ptr [esi], sp"},
+	{true, 2, "or dword ptr [esi], esp"},
+	{true, 2, "push esi"},
+	{true, 1, "push esi"},
+	{true, 2, "jl 0x00000f82"},
+	{true, 3, "xor bl, 7"},
+	{true, 2, "rep pop es"},
+	{true, 1, "pop es"},
+	{true, 1, "std"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "lock dec ebp"},
+	{true, 1, "dec ebp"},
+	{true, 2, "daa"},
+	{true, 1, "daa"},
+	{true, 2, "sbb al, 0xa5"},
+	{true, 1, "movsd"},
+	{true, 1, "dec ebp"},
+	{true, 6, "lea ecx, [ecx+0x49de7a5a]"},
+	{true, 3, "mov dword ptr [edx+122], ebx"},
+	{true, 1, "pop edx"},
+	{true, 2, "jp 0x00000fe0"},
+	{true, 3, "fimul word ptr [ecx+77]"},
+	{true, 1, "dec ecx"},
+	{true, 1, "dec ebp"},
+	{true, 1, "dec esp"},
+	{true, 1, "inc esp"},
+	{true, 1, "dec ebp"},
+	{true, 4, "rep and dword ptr [eax-48], eax"},
+	{true, 3, "and dword ptr [eax-48], eax"},
+	{true, 1, "inc eax"},
+	{true, 3, "sal byte ptr [esi-1], 1"},
+	{true, 2, "jbe 0x00001001"},
+	{true, 3, "dec dword ptr [ebp+68]"},
+	{true, 1, "dec ebp"},
+	{true, 1, "inc esp"},
+	{true, 2, "dec esp"},
+	{true, 1, "dec esp"},
+	{true, 1, "inc ecx"},
+	{true, 4, "adc dword ptr [ebp+edx-101], esp"},
+	{true, 6, "adc eax, 0x2667649b"},
+	{true, 5, "adc eax, 0x2667649b"},
+	{true, 1, "wait"},
+	{true, 4, "dec ebp"},
+	{true, 3, "dec ebp"},
+	{true, 2, "dec ebp"},
+	{true, 1, "dec ebp"},
+	{true, 2, "sbb bh, byte ptr [ebx]"},
+	{true, 2, "cmp edx, dword ptr [edx]"},
+	{true, 2, "adc dh, byte ptr [ecx]"},
+	{true, 3, "xor dword ptr [ebp-88], ecx"},
+	{true, 1, "dec ebp"},
+	{true, 2, "test al, 6"},
+	{true, 1, "push es"},
+	{true, 5, "mov ebp, 0x644ff649"},
+	{true, 1, "dec ecx"},
+	{false, 2, 0},
+	{true, 1, "dec edi"},
+	{true, 2, "aas"},
+	{true, 1, "aas"},
+	{true, 6, "or eax, 0xfa496736"},
+	{true, 5, "or eax, 0xfa496736"},
+	{true, 3, "dec ecx"},
+	{true, 2, "dec ecx"},
+	{true, 1, "dec ecx"},
+	{true, 1, "cli"},
+	{true, 3, "rcr byte ptr [ebx+15], cl"},
+	{true, 1, "pop ebx"},
+	{false, 2, 0},
+	{true, 2, "and al, 88"},
+	{true, 1, "pop eax"},
+	{true, 2, "adc ecx, edi"},
+	{true, 1, "iret"},
+	{true, 2, "aas"},
+	{true, 1, "aas"},
+	{true, 1, "dec ebp"},
+	{true, 6, "or eax, 0x48be1565"},
+	{true, 5, "or eax, 0x48be1565"},
+	{true, 6, "adc eax, 0xbb7848be"},
+	{true, 5, "adc eax, 0xbb7848be"},
+	{true, 5, "mov esi, 0x48bb7848"},
+	{true, 1, "dec eax"},
+	{true, 2, "js 0x00000fbd"},
+	{true, 5, "mov ebx, 0x08464148"},
+	{true, 1, "dec eax"},
+	{true, 1, "inc ecx"},
+	{true, 1, "inc esi"},
+	{true, 3, "or byte ptr [ecx+109], cl"},
+	{true, 1, "dec ecx"},
+	{true, 1, "insd"},
+	{true, 6, "repne jmp 0x7333de32"},
+	{true, 5, "jmp 0x7333de31"},
+	{true, 2, "sub al, 0xce"},
+	{true, 1, "into"},
+	{true, 3, "xor esi, dword ptr [ebx+65]"},
+	{true, 2, "jnb 0x00001043"},
+	{true, 1, "inc ecx"},
+	{true, 6, "mov byte ptr [0x4c3c653b], bl"},
+	{true, 5, "sbb eax, 0x4c3c653b"},
+	{true, 3, "cmp esp, dword ptr [ebp+60]"},
+	{true, 3, "cmp al, 76"},
+	{true, 2, "cmp al, 76"},
+	{true, 1, "dec esp"},
+	{true, 1, "lodsd"},
+	{true, 1, "xchg edi, eax"},
+	{true, 2, "jno 0x00000fc4"},
+	{true, 3, "ret 0xffff9144"},
+	{true, 1, "inc esp"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 5, "push 0x660fbd6e"},
+	{true, 1, "outsb"},
+	{true, 5, "mov ebp, 0x35f2660f"},
+	{true, 3, "pcmpgtd mm6, mm2"},
+	{true, 5, "repne xor ax, 0x67e8"},
+	{true, 6, "repne xor eax, 0x64df67e8"},
+	{true, 5, "xor eax, 0x64df67e8"},
+	{true, 5, "call 0x1c64ef6c"},
+	{true, 4, "fbld tbyte ptr [si+28]"},
+	{true, 4, "fbld tbyte ptr [esp+ebx-13]"},
+	{true, 3, "sbb al, 0xf3"},
+	{true, 2, "sbb al, 0xf3"},
+	{true, 3, "rep mov al, 0xbf"},
+	{true, 2, "mov al, 0xbf"},
+	{true, 5, "mov edi, 0xf3b26365"},
+	{true, 7, "arpl word ptr gs:[edx+0xb4643ef3], si"},
+	{true, 6, "arpl word ptr [edx+0xb4643ef3], si"},
+	{true, 2, "mov dl, 0xf3"},
+	{true, 5, "rep mov ah, 0xf2"},
+	{true, 4, "mov ah, 0xf2"},
+	{true, 3, "mov ah, 0xf2"},
+	{true, 2, "mov ah, 0xf2"},
+	{true, 5, "repne enter 0x4980, 0xce"},
+	{true, 4, "enter 0x4980, 0xce"},
+	{true, 4, "or byte ptr [ecx-50], 106"},
+	{true, 1, "dec ecx"},
+	{true, 1, "into"},
+	{true, 2, "push 0xf2"},
+	{true, 5, "repne imul ebx, dword ptr [edi+ecx*2], 0xb6"},
+	{true, 4, "imul ebx, dword ptr [edi+ecx*2], 0xb6"},
+	{true, 2, "sbb al, 79"},
+	{true, 1, "dec edi"},
+	{true, 2, "mov dh, 0xfc"},
+	{true, 1, "cld"},
+	{true, 5, "mov esi, 0xac08a126"},
+	{true, 6, "mov eax, dword ptr es:[0xb7c7ac08]"},
+	{true, 5, "mov eax, dword ptr [0xb7c7ac08]"},
+	{true, 7, "or byte ptr [edi+eax*8+0x4485eeb7], ch"},
+	{true, 1, "lodsb"},
+	{false, 2, 0},
+	{true, 2, "mov bh, 0xee"},
+	{true, 1, "out dx, al"},
+	{true, 4, "test dword ptr [esp+eax*2+86], eax"},
+	{true, 1, "inc esp"},
+	{true, 1, "inc esp"},
+	{true, 1, "push esi"},
+	{true, 1, "push cs"},
+	{true, 2, "inc esp"},
+	{true, 1, "inc esp"},
+	{true, 1, "clc"},
+	{true, 5, "mov eax, dword ptr [0x8d1dd640]"},
+	{true, 1, "inc eax"},
+	{true, 1, "salc"},
+	{true, 5, "sbb eax, 0xc4ac2c8d"},
+	{true, 3, "lea ebp, [esp+ebp*4]"},
+	{true, 2, "sub al, 0xac"},
+	{true, 1, "lodsb"},
+	{true, 3, "les esp, fword ptr [ebx+77]"},
+	{true, 3, "arpl word ptr [ebp-47], cx"},
+	{true, 1, "dec ebp"},
+	{true, 6, "rol dword ptr [eax+0x04754435], 1"},
+	{true, 7, "xor byte ptr [0xc8047544], 0xab"},
+	{true, 5, "xor eax, 0xc8047544"},
+	{true, 1, "inc esp"},
+	{true, 2, "jnz 0x00001006"},
+	{true, 2, "add al, 0xc8"},
+	{true, 4, "enter 0xffffbbab, 92"},
+	{true, 1, "stosd"},
+	{true, 5, "mov ebx, 0x496daf5c"},
+	{true, 1, "pop esp"},
+	{true, 1, "scasd"},
+	{true, 1, "insd"},
+	{true, 1, "dec ecx"},
+	{false, 2, 0},
+	{true, 1, "dec ebp"},
+	{true, 3, "xor byte ptr cs:[edi], cl"},
+	{true, 2, "xor byte ptr [edi], cl"},
+	{false, 2, 0},
+	{true, 2, "and al, 46"},
+	{true, 4, "add byte ptr cs:[eax], ch"},
+	{true, 3, "add byte ptr [eax], ch"},
+	{true, 2, "sub al, 32"},
+	{true, 2, "and bl, bl"},
+	{false, 2, 0},
+	{true, 2, "dec eax"},
+	{true, 1, "dec eax"},
+	{true, 5, "adc byte ptr es:[ebx], 72"},
+	{true, 4, "adc byte ptr [ebx], 72"},
+	{true, 3, "adc byte ptr [ebx], 72"},
+	{true, 3, "adc ecx, dword ptr [eax-120]"},
+	{true, 1, "dec eax"},
+	{true, 6, "mov byte ptr [ebp+0x226c5c46], ch"},
+	{true, 1, "lodsd"},
+	{true, 1, "inc esi"},
+	{true, 1, "pop esp"},
+	{true, 1, "insb"},
+	{true, 6, "and ch, byte ptr [0x6c114864]"},
+	{true, 5, "sub eax, 0x6c114864"},
+	{true, 2, "dec eax"},
+	{true, 1, "dec eax"},
+	{true, 4, "adc dword ptr [esp+ecx*8+80], ebp"},
+	{true, 1, "insb"},
+	{true, 1, "int3"},
+	{true, 1, "push eax"},
+	{true, 1, "into"},
+	{true, 1, "push es"},
+	{true, 2, "xor bh, ch"},
+	{true, 1, "out dx, eax"},
+	{true, 1, "dec ebp"},
+	{true, 2, "jz 0x00001051"},
+	{true, 1, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 1, "inc eax"},
+	{true, 2, "int3"},
+	{true, 1, "int3"},
+	{true, 4, "fidivr dword ptr gs:[esi-86]"},
+	{true, 3, "fidivr dword ptr [esi-86]"},
+	{true, 2, "jle 0x00000fac"},
+	{true, 1, "stosb"},
+	{true, 1, "iret"},
+	{true, 5, "mov ecx, 0x247fa3f7"},
+	{true, 6, "mul dword ptr [ebx+0x642e247f]"},
+	{true, 5, "mov dword ptr [0x642e247f], eax"},
+	{true, 2, "jnle 0x00001026"},
+	{true, 2, "and al, 46"},
+	{true, 3, "inc ecx"},
+	{true, 2, "inc ecx"},
+	{true, 1, "inc ecx"},
+	{true, 2, "cmp al, 28"},
+	{true, 2, "sbb al, 0xab"},
+	{true, 1, "stosd"},
+	{true, 2, "and al, 0xf3"},
+	{true, 6, "rep cmp eax, 0x4811e690"},
+	{true, 5, "cmp eax, 0x4811e690"},
+	{true, 1, "nop"},
+	{true, 2, "out 17, al"},
+	{true, 3, "adc dword ptr [eax+77], ecx"},
+	{true, 1, "dec eax"},
+	{true, 1, "dec ebp"},
+	{true, 5, "sbb eax, 0x3ede78c5"},
+	{true, 3, "lds edi, fword ptr [eax-34]"},
+	{true, 2, "js 0x00000fe0"},
+	{true, 2, "fidivr word ptr [esi]"},
+	{true, 3, "sal esp, cl"},
+	{true, 2, "sal esp, cl"},
+	{true, 1, "hlt"},
+	{true, 3, "jz 0x0000104e"},
+	{true, 2, "jz 0x0000104d"},
+	{true, 1, "dec ebx"},
+	{true, 4, "or byte ptr [eax-5], 21"},
+	{true, 1, "dec eax"},
+	{true, 1, "sti"},
+	{true, 5, "adc eax, 0xd4446656"},
+	{true, 1, "push esi"},
+	{true, 2, "inc sp"},
+	{true, 1, "inc esp"},
+	{true, 2, "aam 0"},
+	{true, 6, "add byte ptr [0x2e784068], cl"},
+	{true, 5, "or eax, 0x2e784068"},
+	{true, 5, "push 0x4f2e7840"},
+	{true, 1, "inc eax"},
+	{true, 2, "js 0x00001030"},
+	{true, 2, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 7, "jmp far 0x79bd:0x44a567d5"},
+	{true, 2, "aad 103"},
+	{true, 2, "movsd"},
+	{true, 1, "movsd"},
+	{true, 1, "inc esp"},
+	{true, 5, "mov ebp, 0x7d3d4179"},
+	{true, 2, "jns 0x00001043"},
+	{true, 1, "inc ecx"},
+	{true, 5, "cmp eax, 0x6c3c1e7d"},
+	{true, 2, "jnl 0x00001020"},
+	{true, 1, "push ds"},
+	{true, 2, "cmp al, 108"},
+	{true, 1, "insb"},
+	{true, 2, "aam 98"},
+	{true, 6, "bound ebx, qword ptr [edi+0xab027083]"},
+	{true, 1, "lahf"},
+	{true, 4, "xor dword ptr [eax+2], 0xab"},
+	{true, 2, "jo 0x00001004"},
+	{true, 6, "add ch, byte ptr [ebx+0xecdd4452]"},
+	{true, 1, "stosd"},
+	{true, 1, "push edx"},
+	{true, 1, "inc esp"},
+	{true, 2, "fucomp st(4)"},
+	{true, 1, "in al, dx"},
+	{true, 1, "pop ebx"},
+	{true, 2, "dec eax"},
+	{true, 1, "dec eax"},
+	{true, 2, "lodsw"},
+	{true, 1, "lodsd"},
+	{true, 2, "out 0xd6, al"},
+	{true, 1, "salc"},
+	{true, 1, "pop edi"},
+	{true, 1, "inc esp"},
+	{true, 2, "cmp dh, dl"},
+	{true, 3, "repne add edi, dword ptr [edx]"},
+	{true, 2, "add edi, dword ptr [edx]"},
+	{true, 3, "cmp dl, byte ptr [ebx+ecx*8]"},
+	{true, 2, "adc al, 0xcb"},
+	{true, 1, "retf"},
+	{true, 1, "pop eax"},
+	{true, 2, "inc ecx"},
+	{true, 1, "inc ecx"},
+	{true, 1, "pop ebp"},
+	{true, 3, "inc esp"},
+	{true, 2, "inc esp"},
+	{true, 1, "inc esp"},
+	{true, 5, "test eax, 0xe7ce617b"},
+	{true, 2, "jnp 0x00001063"},
+	{true, 1, "popad"},
+	{true, 1, "into"},
+	{true, 2, "out 0xd5, eax"},
+	{true, 2, "aad 46"},
+	{true, 3, "sbb al, 0xaa"},
+	{true, 2, "sbb al, 0xaa"},
+	{true, 1, "stosb"},
+	{true, 1, "push cs"},
+	{true, 1, "push edi"},
+	{true, 3, "dec edx"},
+	{true, 2, "dec edx"},
+	{true, 1, "dec edx"},
+	{true, 3, "add dword ptr [esi+esi], ecx"},
+	{true, 2, "or al, 54"},
+	{true, 2, "pop esp"},
+	{true, 1, "pop esp"},
+	{true, 5, "sbb eax, 0x9d675873"},
+	{true, 2, "jnb 0x0000105a"},
+	{true, 1, "pop eax"},
+	{true, 2, "popfd"},
+	{true, 1, "popfd"},
+	{true, 1, "inc esp"},
+	{true, 4, "lock adc dword ptr [esi+ebp], ebx"},
+	{true, 3, "adc dword ptr [esi+ebp], ebx"},
+	{true, 2, "sbb al, 46"},
+	{true, 6, "jmp 0xd51003f6"},
+	{true, 5, "jmp 0xd51003f5"},
+	{true, 9, "pmullw mm3, qword ptr [esi+0x6f0522c2]"},
+	{true, 8, "pmullw mm3, qword ptr [esi+0x6f0522c2]"},
+	{true, 7, "pmullw mm3, qword ptr [esi+0x6f0522c2]"},
+	{true, 2, "aad 0x9e"},
+	{true, 1, "sahf"},
+	{true, 3, "ret 0x0522"},
+	{true, 6, "and al, byte ptr [0xf250266f]"},
+	{true, 5, "add eax, 0xf250266f"},
+	{true, 1, "outsd"},
+	{true, 2, "push eax"},
+	{true, 1, "push eax"},
+	{true, 3, "repne dec ebp"},
+	{true, 2, "dec ebp"},
+	{true, 1, "dec ebp"},
+	{true, 2, "and dword ptr [edi], ebx"},
+	{true, 1, "pop ds"},
+	{true, 5, "mov ecx, 0x0bb991b9"},
+	{true, 5, "mov ecx, 0x230bb991"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 5, "mov ecx, 0x4884230b"},
+	{true, 2, "or esp, dword ptr [ebx]"},
+	{true, 7, "and eax, dword ptr [eax+ecx*2+0xf34c412e]"},
+	{true, 3, "test byte ptr [eax+46], cl"},
+	{true, 1, "dec eax"},
+	{true, 2, "inc ecx"},
+	{true, 1, "inc ecx"},
+	{true, 1, "dec esp"},
+	{true, 5, "movsx ecx, word ptr [ecx+17]"},
+	{true, 4, "movsx ecx, word ptr [ecx+17]"},
+	{true, 5, "mov edi, 0x65511149"},
+	{true, 1, "dec ecx"},
+	{true, 3, "adc dword ptr [ecx+101], edx"},
+	{true, 1, "push ecx"},
+	{true, 6, "sub eax, 0x0f849e49"},
+	{true, 5, "sub eax, 0x0f849e49"},
+	{true, 1, "dec ecx"},
+	{true, 1, "sahf"},
+	{true, 2, "test byte ptr [edi], cl"},
+	{true, 4, "punpckhdq mm5, dword ptr [edi-68]"},
+	{true, 2, "push 111"},
+	{true, 1, "outsd"},
+	{true, 5, "mov esp, 0x25d64d97"},
+	{true, 1, "xchg edi, eax"},
+	{true, 1, "dec ebp"},
+	{true, 1, "salc"},
+	{true, 5, "and eax, 0x546781d0"},
+	{true, 6, "rol byte ptr [ecx+0x021a5467], 1"},
+	{true, 7, "and dword ptr [edi+84], 0x663e021a"},
+	{true, 2, "push esp"},
+	{true, 1, "push esp"},
+	{true, 2, "sbb al, byte ptr [edx]"},
+	{true, 2, "add bh, byte ptr [esi]"},
+	{true, 4, "jnz 0x00000fa9"},
+	{true, 3, "jnz 0x00000fa8"},
+	{true, 2, "jnz 0x00000fa7"},
+	{true, 1, "movsd"},
+	{true, 2, "jz 0x00001038"},
+	{true, 2, "retf"},
+	{true, 1, "retf"},
+	{true, 1, "movsb"},
+	{true, 5, "jmp 0x3df31f07"},
+	{true, 2, "add cl, byte ptr [edi]"},
+	{true, 7, "psllq mm7, qword ptr [0x12934f88]"},
+	{true, 6, "rep cmp eax, 0x12934f88"},
+	{true, 5, "cmp eax, 0x12934f88"},
+	{true, 3, "mov byte ptr [edi-109], cl"},
+	{true, 1, "dec edi"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 6, "adc al, byte ptr [esi+0x36cb23c5]"},
+	{true, 2, "xchg al, ch"},
+	{true, 2, "lds esp, fword ptr [ebx]"},
+	{true, 2, "and ecx, ebx"},
+	{true, 1, "retf"},
+	{true, 2, "salc"},
+	{true, 1, "salc"},
+	{false, 2, 0},
+	{true, 2, "sub byte ptr [ebx], dh"},
+	{true, 2, "xor ebx, dword ptr [edx]"},
+	{true, 7, "sbb dl, byte ptr [esi+ebx+0xd8c44e49]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "push ds"},
+	{true, 1, "dec ecx"},
+	{true, 1, "dec esi"},
+	{true, 2, "les ebx, (invalid)"},
+	{true, 2, "fcomp st(6)"},
+	{true, 3, "fimul word ptr [ebx-2]"},
+	{true, 1, "dec ebx"},
+	{false, 2, 0},
+	{true, 7, "jmp far 0xb103:0xb451ede7"},
+	{true, 2, "out 0xed, eax"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "push ecx"},
+	{true, 2, "mov ah, 3"},
+	{true, 6, "add esi, dword ptr [ecx+0xfef3f54d]"},
+	{true, 2, "mov cl, 77"},
+	{true, 1, "dec ebp"},
+	{true, 1, "cmc"},
+	{true, 7, "rep inc byte ptr [edx+0x3f20a58f]"},
+	{true, 6, "inc byte ptr [edx+0x3f20a58f]"},
+	{true, 7, "or byte ptr [edi+0x793f20a5], 0xae"},
+	{false, 2, 0},
+	{true, 1, "movsd"},
+	{true, 2, "and byte ptr [edi], bh"},
+	{true, 1, "aas"},
+	{true, 2, "jns 0x00000fb0"},
+	{true, 1, "scasb"},
+	{true, 1, "cmc"},
+	{true, 3, "and cl, 46"},
+	{true, 2, "loope 0x00001030"},
+	{true, 7, "and eax, 0xabd22a81"},
+	{true, 6, "and eax, 0xabd22a81"},
+	{true, 5, "and eax, 0xabd22a81"},
+	{true, 6, "sub dword ptr [edx], 0x4f22abd2"},
+	{true, 2, "sub dl, dl"},
+	{true, 6, "shr byte ptr [ebx+0x4c0c4f22], cl"},
+	{true, 1, "stosd"},
+	{true, 3, "and cl, byte ptr [edi+12]"},
+	{true, 1, "dec edi"},
+	{true, 2, "or al, 76"},
+	{true, 1, "dec esp"},
+	{true, 2, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 7, "and dword ptr [edi+65], 0xb037f8e0"},
+	{true, 2, "inc ecx"},
+	{true, 1, "inc ecx"},
+	{true, 2, "loopne 0x00000ffa"},
+	{true, 1, "clc"},
+	{true, 1, "aaa"},
+	{true, 2, "mov al, 100"},
+	{true, 3, "cmp byte ptr fs:[esi], dh"},
+	{true, 2, "cmp byte ptr [esi], dh"},
+	{true, 2, "lodsb"},
+	{true, 1, "lodsb"},
+	{true, 1, "dec ecx"},
+	{true, 2, "mov esp, ecx"},
+	{true, 1, "int3"},
+	{true, 1, "outsd"},
+	{true, 4, "enter 0xffffc6d8, 79"},
+	{true, 2, "fadd st, st(6)"},
+	{false, 2, 0},
+	{true, 1, "dec edi"},
+	{true, 2, "mov ah, 0x99"},
+	{true, 1, "cdq"},
+	{true, 6, "add ah, byte ptr [edx+0x0f0f4d65]"},
+	{true, 5, "mov byte ptr [0x0f0f4d65], al"},
+	{true, 2, "dec ebp"},
+	{true, 1, "dec ebp"},
+	{false, 2, 0},
+	{true, 7, "cmovnle edi, dword ptr [esi+0x364a14db]"},
+	{true, 1, "dec edi"},
+	{true, 5, "mov esi, 0x364a14db"},
+	{true, 3, "fist dword ptr [edx+ecx*2]"},
+	{true, 2, "adc al, 74"},
+	{true, 1, "dec edx"},
+	{true, 2, "inc ecx"},
+	{true, 1, "inc ecx"},
+	{true, 5, "xor eax, 0xa4d74d67"},
+	{true, 2, "dec ebp"},
+	{true, 1, "dec ebp"},
+	{true, 1, "xlat"},
+	{true, 1, "movsb"},
+	{true, 2, "add ah, bl"},
+	{true, 4, "fsub qword ptr [esi+esi+64]"},
+	{true, 3, "inc eax"},
+	{true, 2, "inc eax"},
+	{true, 1, "inc eax"},
+	{true, 2, "xchg dl, bh"},
+	{true, 1, "xlat"},
+	{true, 5, "mov dword ptr [0xdf4c664c], eax"},
+	{true, 1, "dec esp"},
+	{true, 2, "dec sp"},
+	{true, 1, "dec esp"},
+	{true, 3, "fbld tbyte ptr [ebx+90]"},
+	{true, 3, "arpl word ptr [edx-7], bx"},
+	{true, 1, "pop edx"},
+	{true, 1, "stc"},
+	{true, 3, "jb 0x00001067"},
+	{true, 2, "jb 0x00001066"},
+	{true, 2, "movsb"},
+	{true, 1, "movsb"},
+	{true, 2, "jmp 0x00001030"},
+	{true, 6, "push 0x64f0b37b"},
+	{true, 5, "push 0x64f0b37b"},
+	{true, 2, "jnp 0x00000fb5"},
+	{true, 2, "mov bl, 0xf0"},
+	{true, 3, "lock dec ecx"},
+	{true, 2, "dec ecx"},
+	{true, 1, "dec ecx"},
+	{true, 1, "xchg edi, eax"},
+	{true, 1, "movsd"},
+	{true, 1, "inc eax"},
+	{true, 1, "cdq"},
+	{true, 1, "push es"},
+	{true, 1, "sahf"},
+	{true, 7, "adc byte ptr [edi+ecx*2+0x0b649d4f], dh"},
+	{true, 2, "mov ah, 79"},
+	{true, 1, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 1, "popfd"},
+	{true, 4, "or ecx, dword ptr fs:[eax+77]"},
+	{true, 3, "or ecx, dword ptr [eax+77]"},
+	{true, 1, "dec eax"},
+	{true, 1, "dec ebp"},
+	{true, 3, "rcr cl, 1"},
+	{true, 2, "rcr cl, 1"},
+	{true, 2, "fxch st(7)"},
+	{true, 1, "iret"},
+	{true, 3, "fld dword ptr [eax-16]"},
+	{true, 1, "inc eax"},
+	{true, 6, "lock mov ebp, 0x4f589611"},
+	{true, 5, "mov ebp, 0x4f589611"},
+	{true, 6, "adc dword ptr [esi+0xa24f4f58], edx"},
+	{true, 1, "xchg esi, eax"},
+	{true, 1, "pop eax"},
+	{true, 1, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 5, "mov byte ptr [0x2d6e44f5], al"},
+	{true, 1, "cmc"},
+	{true, 1, "inc esp"},
+	{true, 1, "outsb"},
+	{true, 5, "sub eax, 0x0dca2e4d"},
+	{true, 1, "dec ebp"},
+	{true, 4, "retf 0xfffff30d"},
+	{true, 3, "retf 0xfffff30d"},
+	{true, 5, "or eax, 0x992a4cf3"},
+	{true, 2, "rep dec esp"},
+	{true, 1, "dec esp"},
+	{true, 6, "sub bl, byte ptr [ecx+0x66674c9f]"},
+	{true, 1, "cdq"},
+	{true, 1, "lahf"},
+	{true, 1, "dec esp"},
+	{true, 3, "inc ax"},
+	{true, 2, "inc ax"},
+	{true, 1, "inc eax"},
+	{true, 2, "sbb al, 97"},
+	{true, 1, "popad"},
+	{true, 7, "xor byte ptr [ebx+0x1c910f3d], 0xff"},
+	{true, 2, "mov bl, 61"},
+	{true, 5, "cmp eax, 0xff1c910f"},
+	{true, 4, "setno byte ptr [edi+edi*8]"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "sbb al, 0xff"},
+	{true, 3, "jmp dword ptr [ebp-115]"},
+	{true, 3, "lea esp, gs:[edi]"},
+	{true, 2, "lea esp, [edi]"},
+	{true, 1, "daa"},
+	{true, 5, "mov eax, 0x3d0155e4"},
+	{true, 2, "in al, 85"},
+	{true, 1, "push ebp"},
+	{true, 6, "add dword ptr [0xfa42cd76], edi"},
+	{true, 5, "cmp eax, 0xfa42cd76"},
+	{true, 2, "jbe 0x00000fcf"},
+	{true, 2, "int 66"},
+	{true, 1, "inc edx"},
+	{true, 1, "cli"},
+	{true, 5, "mov eax, 0xf6bdfeee"},
+	{true, 1, "out dx, al"},
+	{false, 2, 0},
+	{true, 5, "mov ebp, 0x32530ef6"},
+	{false, 2, 0},
+	{true, 1, "push cs"},
+	{true, 1, "push ebx"},
+	{true, 3, "xor bh, byte ptr [esi+80]"},
+	{true, 2, "jle 0x00001052"},
+	{true, 1, "push eax"},
+	{true, 1, "pop edx"},
+	{true, 4, "psllq mm0, qword ptr [ebp-111]"},
+	{true, 2, "rep inc ebp"},
+	{true, 1, "inc ebp"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "jmp 0x00000f8b"},
+	{true, 2, "mov dword ptr [esi], esp"},
+	{true, 3, "mov cl, 0xcf"},
+	{true, 2, "mov cl, 0xcf"},
+	{true, 1, "iret"},
+	{true, 2, "xor al, 0xe7"},
+	{true, 2, "out 64, eax"},
+	{true, 1, "inc eax"},
+	{true, 4, "imul esp, dword ptr [esi+68], 0xd9"},
+	{true, 2, "inc sp"},
+	{true, 1, "inc esp"},
+	{true, 6, "fld dword ptr [0x122c4c4d]"},
+	{true, 5, "add eax, 0x122c4c4d"},
+	{true, 1, "dec ebp"},
+	{true, 1, "dec esp"},
+	{true, 2, "sub al, 18"},
+	{true, 6, "adc dh, byte ptr [edx+0x653ebde0]"},
+	{true, 2, "mov dl, 0xe0"},
+	{true, 2, "loopne 0x00000fbf"},
+	{true, 5, "mov ebp, 0x5811653e"},
+	{true, 5, "adc dword ptr gs:[eax-68], ebx"},
+	{true, 4, "adc dword ptr gs:[eax-68], ebx"},
+	{true, 3, "adc dword ptr [eax-68], ebx"},
+	{true, 1, "pop eax"},
+	{true, 5, "mov esp, 0x453f1865"},
+	{true, 3, "sbb byte ptr gs:[edi], bh"},
+	{true, 2, "sbb byte ptr [edi], bh"},
+	{true, 1, "aas"},
+	{true, 1, "inc ebp"},
+	{true, 3, "jnz 0x00001012"},
+	{true, 2, "jnz 0x00001011"},
+	{true, 3, "nop ebp"},
+	{true, 1, "pop ds"},
+	{true, 1, "cmc"},
+	{true, 1, "inc edx"},
+	{true, 2, "sbb esp, edx"},
+	{true, 2, "aam 69"},
+	{true, 1, "inc ebp"},
+	{true, 1, "dec esp"},
+	{true, 6, "sub dword ptr [0xa3bb408d], ebp"},
+	{true, 5, "sub eax, 0xa3bb408d"},
+	{true, 3, "lea eax, [eax-69]"},
+	{true, 1, "inc eax"},
+	{true, 5, "mov ebx, 0xa66667a3"},
+	{true, 5, "mov dword ptr [0x73a66667], eax"},
+	{true, 3, "cmpsb"},
+	{true, 2, "cmpsb"},
+	{true, 1, "cmpsb"},
+	{true, 2, "jnb 0x00001006"},
+	{true, 2, "add al, 24"},
+	{true, 6, "sbb byte ptr [0x8d644470], ch"},
+	{true, 5, "sub eax, 0x8d644470"},
+	{true, 2, "jo 0x00001046"},
+	{true, 1, "inc esp"},
+	{true, 4, "lea edi, fs:[eax+104]"},
+	{true, 3, "lea edi, [eax+104]"},
+	{true, 2, "js 0x0000106a"},
+	{true, 5, "push 0xf2a4f3ed"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "rep movsb"},
+	{true, 1, "movsb"},
+	{true, 3, "repne int3"},
+	{true, 2, "int3"},
+	{true, 1, "int3"},
+	{true, 1, "dec edi"},
+	{true, 2, "rep dec ebp"},
+	{true, 1, "dec ebp"},
+	{true, 6, "sal dword ptr [ebx+0x4c18f248], 1"},
+	{true, 2, "mov bl, 72"},
+	{true, 1, "dec eax"},
+	{true, 5, "repne sbb byte ptr [eax+eax*2-86], cl"},
+	{true, 4, "sbb byte ptr [eax+eax*2-86], cl"},
+	{true, 1, "dec esp"},
+	{true, 1, "inc eax"},
+	{true, 1, "stosb"},
+	{true, 1, "inc esp"},
+	{true, 6, "mov dword ptr cs:[0xfe0f6667], eax"},
+	{true, 5, "mov dword ptr [0xfe0f6667], eax"},
+	{true, 5, "paddd xmm1, xmm5"},
+	{true, 4, "paddd xmm1, xmm5"},
+	{true, 3, "paddd mm1, mm5"},
+	{true, 2, "dec ch"},
+	{true, 2, "int 77"},
+	{true, 1, "dec ebp"},
+	{true, 1, "stosb"},
+	{true, 2, "pop ss"},
+	{true, 1, "pop ss"},
+	{true, 1, "iret"},
+	{true, 1, "in al, dx"},
+	{true, 1, "dec ebp"},
+	{true, 1, "ret"},
+	{true, 4, "and eax, dword ptr [eax+ecx*8+65]"},
+	{true, 1, "inc esp"},
+	{true, 4, "enter 0x6641, 48"},
+	{true, 1, "inc ecx"},
+	{true, 3, "xor ah, bh"},
+	{true, 2, "xor ah, bh"},
+	{true, 1, "cld"},
+	{true, 1, "stc"},
+	{true, 1, "pop eax"},
+	{true, 2, "bswap esi"},
+	{true, 1, "into"},
+	{true, 5, "sbb eax, 0x0ee4f724"},
+	{true, 2, "and al, 0xf7"},
+	{true, 2, "mul esp"},
+	{true, 2, "in al, 14"},
+	{true, 1, "push cs"},
+	{true, 1, "xchg esi, eax"},
+	{true, 1, "clc"},
+	{true, 2, "jnl 0x00001038"},
+	{true, 4, "shl dword ptr ss:[edi], 0xed"},
+	{true, 3, "shl dword ptr [edi], 0xed"},
+	{true, 1, "daa"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "xor al, 27"},
+	{true, 3, "sbb ebx, dword ptr [eax+14]"},
+	{true, 1, "pop eax"},
+	{true, 1, "push cs"},
+	{true, 1, "inc esi"},
+	{true, 1, "cld"},
+	{true, 1, "dec eax"},
+	{true, 1, "pushfd"},
+	{true, 1, "inc esp"},
+	{true, 3, "jz 0x00000f8b"},
+	{true, 2, "jz 0x00000f8a"},
+	{true, 3, "mov byte ptr [ebp+123], ah"},
+	{true, 3, "jnp 0x00001031"},
+	{true, 2, "jnp 0x00001030"},
+	{true, 7, "xor ebx, dword ptr cs:[esi+0xdca1982c]"},
+	{true, 6, "xor ebx, dword ptr [esi+0xdca1982c]"},
+	{true, 1, "sahf"},
+	{true, 2, "sub al, 0x98"},
+	{true, 1, "cwde"},
+	{true, 5, "mov eax, dword ptr [0x940b3edc]"},
+	{true, 2, "fdivr qword ptr [esi]"},
+	{true, 8, "or edx, dword ptr ds:[ebp+eax*4+0xc03e260a]"},
+	{true, 7, "or edx, dword ptr [ebp+eax*4+0xc03e260a]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "test dword ptr [edx], ecx"},
+	{true, 2, "or ah, byte ptr [esi]"},
+	{true, 9, "rcr byte ptr ds:[edi+0x94842006], 38"},
+	{true, 8, "rcr byte ptr ds:[edi+0x94842006], 38"},
+	{true, 7, "rcr byte ptr [edi+0x94842006], 38"},
+	{true, 1, "lahf"},
+	{true, 1, "push es"},
+	{true, 7, "and byte ptr [esp+edx*4+0xf35af226], al"},
+	{true, 7, "test byte ptr [esi+0x15f35af2], dl"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "repne pop edx"},
+	{true, 2, "repne pop edx"},
+	{true, 1, "pop edx"},
+	{true, 6, "rep adc eax, 0xb21b4ef3"},
+	{true, 5, "adc eax, 0xb21b4ef3"},
+	{true, 2, "rep dec esi"},
+	{true, 1, "dec esi"},
+	{true, 6, "sbb esi, dword ptr [edx+0x9fa9174f]"},
+	{true, 2, "mov dl, 79"},
+	{true, 1, "dec edi"},
+	{true, 1, "pop ss"},
+	{true, 5, "test eax, 0xca4f419f"},
+	{true, 1, "lahf"},
+	{true, 1, "inc ecx"},
+	{true, 1, "dec edi"},
+	{true, 3, "retf 0x66eb"},
+	{true, 2, "jmp 0x00001068"},
+	{true, 4, "imul cx, word ptr [ecx], 54"},
+	{true, 3, "imul ecx, dword ptr [ecx], 54"},
+	{true, 2, "or dword ptr [esi], esi"},
+	{true, 2, "pop edx"},
+	{true, 1, "pop edx"},
+	{true, 8, "sub dword ptr cs:[ebp+54], 0xe3458429"},
+	{true, 7, "sub dword ptr [ebp+54], 0xe3458429"},
+	{true, 1, "insd"},
+	{true, 8, "sub dword ptr ss:[ebp+eax*2+0x6767f3e3], eax"},
+	{true, 7, "sub dword ptr [ebp+eax*2+0x6767f3e3], eax"},
+	{true, 3, "test byte ptr [ebp-29], al"},
+	{true, 1, "inc ebp"},
+	{true, 2, "jcez 0x00000ff5"},
+	{true, 5, "rep les ebp, (invalid)"},
+	{true, 4, "les ebp, (invalid)"},
+	{true, 3, "les ebp, (invalid)"},
+	{true, 2, "les ebp, (invalid)"},
+	{true, 5, "jmp 0xef8c5d96"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 1, "dec ebp"},
+	{true, 2, "mov edi, gs"},
+	{true, 1, "out dx, eax"},
+	{true, 1, "pop edx"},
+	{true, 1, "inc ecx"},
+	{true, 1, "push ecx"},
+	{true, 5, "lea ecx, [bx+di+25870]"},
+	{true, 6, "lea ecx, [ecx+0x40b1650e]"},
+	{true, 2, "mov dword ptr [esi], ecx"},
+	{true, 1, "push cs"},
+	{true, 3, "mov cl, 64"},
+	{true, 2, "mov cl, 64"},
+	{true, 1, "inc eax"},
+	{true, 3, "loopne 0x00000fa1"},
+	{true, 2, "loopne 0x00000fa0"},
+	{true, 1, "sahf"},
+	{true, 1, "inc esp"},
+	{true, 3, "les ecx, fword ptr [ecx+55]"},
+	{true, 1, "dec ecx"},
+	{true, 1, "aaa"},
+	{true, 3, "xor dh, byte ptr [eax+117]"},
+	{true, 2, "jo 0x00001077"},
+	{true, 2, "jnz 0x00001066"},
+	{true, 2, "inc eax"},
+	{true, 1, "inc eax"},
+	{true, 6, "xchg dh, byte ptr [esi+0x8a4f6781]"},
+	{true, 2, "mov dh, 0x81"},
+	{true, 7, "and dword ptr [edi+79], 0x4166b48a"},
+	{true, 2, "dec edi"},
+	{true, 1, "dec edi"},
+	{true, 7, "mov dh, byte ptr [esi+0x56186941]"},
+	{true, 2, "mov ah, 102"},
+	{true, 2, "inc cx"},
+	{true, 1, "inc ecx"},
+	{true, 6, "imul ebx, dword ptr [eax], 0xc7363756"},
+	{true, 3, "sbb byte ptr [esi+55], dl"},
+	{true, 1, "push esi"},
+	{true, 1, "aaa"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 1, "popfd"},
+	{true, 1, "dec esi"},
+	{true, 3, "cmp bl, byte ptr [esi-115]"},
+	{true, 1, "pop esi"},
+	{true, 3, "lea edi, [edi-13]"},
+	{true, 2, "jnle 0x00000ff5"},
+	{true, 2, "rep inc eax"},
+	{true, 1, "inc eax"},
+	{true, 1, "dec ecx"},
+	{true, 1, "pop edi"},
+	{true, 4, "imul dword ptr [ecx+esi-4]"},
+	{true, 1, "insb"},
+	{true, 2, "xor esp, edi"},
+	{true, 1, "cld"},
+	{true, 2, "jnp 0x00001040"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 1, "push esi"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "mov dl, dh"},
+	{true, 1, "salc"},
+	{true, 2, "sar byte ptr [ebx], cl"},
+	{true, 3, "cmp ecx, dword ptr [ebp-90]"},
+	{true, 1, "dec ebp"},
+	{true, 1, "cmpsb"},
+	{true, 2, "mov ah, 19"},
+	{true, 2, "adc ebp, dword ptr [esi]"},
+	{true, 2, "inc ecx"},
+	{true, 1, "inc ecx"},
+	{true, 3, "rep dec esp"},
+	{true, 2, "rep dec esp"},
+	{true, 1, "dec esp"},
+	{true, 1, "inc esp"},
+	{true, 2, "mov cl, 80"},
+	{true, 1, "push eax"},
+	{true, 2, "sub byte ptr [esi], ch"},
+	{true, 2, "inc esp"},
+	{true, 1, "inc esp"},
+	{true, 2, "jcez 0x0000101f"},
+	{true, 5, "sbb eax, 0x655d563e"},
+	{true, 2, "push esi"},
+	{true, 1, "push esi"},
+	{true, 1, "pop ebp"},
+	{true, 3, "xchg edx, dword ptr gs:[ecx]"},
+	{true, 2, "xchg edx, dword ptr [ecx]"},
+	{true, 2, "adc dword ptr [esi], esp"},
+	{true, 3, "add al, 77"},
+	{true, 2, "add al, 77"},
+	{true, 1, "dec ebp"},
+	{true, 3, "adc ah, byte ptr [ebp-77]"},
+	{true, 3, "mov bl, 101"},
+	{true, 2, "mov bl, 101"},
+	{true, 2, "push edi"},
+	{true, 1, "push edi"},
+	{true, 2, "add esi, edx"},
+	{true, 3, "repne out 0xc5, al"},
+	{true, 2, "out 0xc5, al"},
+	{true, 2, "lds ecx, fword ptr [ecx]"},
+	{true, 2, "or dword ptr [esi], ebp"},
+	{true, 6, "test eax, 0x7866b047"},
+	{true, 5, "test eax, 0x7866b047"},
+	{true, 1, "inc edi"},
+	{true, 2, "mov al, 102"},
+	{true, 3, "js 0x00001027"},
+	{true, 2, "js 0x00001026"},
+	{true, 2, "and al, 5"},
+	{true, 5, "add eax, 0x4f4d8728"},
+	{true, 6, "sub byte ptr [edi+0x64f24f4d], al"},
+	{true, 3, "xchg ecx, dword ptr [ebp+79]"},
+	{true, 1, "dec ebp"},
+	{true, 1, "dec edi"},
+	{true, 3, "repne push ss"},
+	{true, 2, "push ss"},
+	{true, 1, "push ss"},
+	{true, 1, "dec eax"},
+	{true, 1, "dec ebp"},
+	{true, 5, "or byte ptr [eax+eax*8-126], 0xb6"},
+	{true, 1, "dec esp"},
+	{true, 7, "rol byte ptr [edx+0x34f316b6], 0xb4"},
+	{true, 7, "xor byte ptr [esi+0xb434f316], 64"},
+	{true, 2, "mov dh, 22"},
+	{true, 1, "push ss"},
+	{true, 3, "rep xor al, 0xb4"},
+	{true, 2, "xor al, 0xb4"},
+	{true, 2, "mov ah, 64"},
+	{true, 1, "inc eax"},
+	{true, 2, "jmp 0x00001038"},
+	{true, 6, "sub al, 18"},
+	{true, 5, "sub al, 18"},
+	{true, 4, "sub al, 18"},
+	{true, 3, "sub al, 18"},
+	{true, 2, "sub al, 18"},
+	{true, 3, "adc ah, byte ptr [esi-100]"},
+	{true, 2, "pushfw"},
+	{true, 1, "pushfd"},
+	{true, 1, "dec edi"},
+	{true, 3, "dec byte ptr [eax-6]"},
+	{true, 1, "dec eax"},
+	{true, 1, "cli"},
+	{true, 2, "xor edi, dword ptr [eax]"},
+	{true, 4, "cmp byte ptr [esp+eax*2-119], ch"},
+	{true, 1, "insb"},
+	{true, 1, "inc esp"},
+	{true, 2, "mov eax, ebp"},
+	{true, 5, "call 0x543e7bb2"},
+	{true, 1, "lodsd"},
+	{true, 3, "imul edi, dword ptr [esi], 84"},
+	{true, 2, "push esp"},
+	{true, 1, "push esp"},
+	{true, 1, "inc esp"},
+	{false, 2, 0},
+	{true, 1, "aas"},
+	{true, 2, "loop 0x00000ff2"},
+	{true, 2, "lock push cs"},
+	{true, 1, "push cs"},
+	{true, 2, "xor al, byte ptr [edx]"},
+	{true, 3, "add ah, byte ptr [esi+64]"},
+	{true, 2, "inc ax"},
+	{true, 1, "inc eax"},
+	{true, 1, "inc eax"},
+	{true, 2, "adc edx, dword ptr [eax]"},
+	{true, 2, "adc bh, bl"},
+	{true, 2, "fcomip st, st(3)"},
+	{true, 6, "rep sub eax, 0xe305552b"},
+	{true, 5, "sub eax, 0xe305552b"},
+	{true, 3, "sub edx, dword ptr [ebp+5]"},
+	{true, 1, "push ebp"},
+	{true, 5, "add eax, 0xeeaed4e3"},
+	{true, 2, "jcez 0x00000fd6"},
+	{true, 2, "aam 0xae"},
+	{true, 1, "scasb"},
+	{true, 1, "out dx, al"},
+	{true, 1, "dec ecx"},
+	{true, 1, "stosd"},
+	{true, 1, "nop"},
+	{true, 5, "sub eax, 0x4d044467"},
+	{true, 2, "inc esp"},
+	{true, 1, "inc esp"},
+	{true, 2, "add al, 77"},
+	{true, 1, "dec ebp"},
+	{true, 2, "jb 0x00000f8f"},
+	{true, 3, "lea ecx, [ebp+1]"},
+	{true, 1, "dec ebp"},
+	{true, 3, "add dword ptr [ebx+64], esi"},
+	{true, 2, "jnb 0x00001042"},
+	{true, 1, "inc eax"},
+	{true, 2, "add ebx, edx"},
+	{true, 2, "sal dword ptr [esi], cl"},
+	{true, 7, "xor edx, dword ptr ss:[eax+0x3a371cbf]"},
+	{true, 6, "xor edx, dword ptr [eax+0x3a371cbf]"},
+	{true, 1, "nop"},
+	{true, 5, "mov edi, 0x263a371c"},
+	{true, 2, "sbb al, 55"},
+	{true, 1, "aaa"},
+	{true, 2, "cmp ah, byte ptr [esi]"},
+	{true, 6, "jmp 0xf403896c"},
+	{true, 5, "jmp 0xf403896b"},
+	{true, 3, "jns 0x00001006"},
+	{true, 2, "jns 0x00001005"},
+	{true, 2, "add esi, esp"},
+	{true, 1, "hlt"},
+	{true, 2, "jnl 0x00001011"},
+	{false, 2, 0},
+	{true, 2, "dec dword ptr [edi]"},
+	{true, 5, "andps xmm0, xmmword ptr [edx+101]"},
+	{true, 1, "push esp"},
+	{true, 1, "inc esp"},
+	{true, 3, "and ah, byte ptr [ebp+65]"},
+	{true, 2, "inc ecx"},
+	{true, 1, "inc ecx"},
+	{true, 3, "rep test al, dh"},
+	{true, 2, "test al, dh"},
+	{true, 2, "lock dec edi"},
+	{true, 1, "dec edi"},
+	{true, 2, "jle 0x00000f8f"},
+	{true, 6, "lea esi, [edi+0x443e8f08]"},
+	{true, 2, "mov bh, 8"},
+	{true, 6, "or byte ptr [edi+0x0989443e], cl"},
+	{false, 2, 0},
+	{true, 2, "inc esp"},
+	{true, 1, "inc esp"},
+	{true, 2, "mov dword ptr [ecx], ecx"},
+	{true, 2, "or dword ptr [edi], ebp"},
+	{true, 1, "das"},
+	{true, 3, "cmp esp, 0x89"},
+	{true, 1, "cld"},
+	{true, 2, "mov dword ptr [esi], ebp"},
+	{true, 7, "xor eax, dword ptr cs:[ebx+0xfaffcfa5]"},
+	{true, 6, "xor eax, dword ptr [ebx+0xfaffcfa5]"},
+	{true, 7, "and dword ptr [ebp+0x36faffcf], 13"},
+	{true, 1, "movsd"},
+	{true, 1, "iret"},
+	{false, 2, 0},
+	{true, 1, "cli"},
+	{true, 6, "or eax, 0x6e7b7d28"},
+	{true, 5, "or eax, 0x6e7b7d28"},
+	{true, 3, "sub byte ptr [ebp+123], bh"},
+	{true, 2, "jnl 0x0000107d"},
+	{true, 2, "jnp 0x00001070"},
+	{true, 1, "outsb"},
+	{true, 1, "dec esp"},
+	{true, 6, "sbb dword ptr [ecx+0xdaad423d], edx"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 5, "cmp eax, 0xaadaad42"},
+	{true, 1, "inc edx"},
+	{true, 1, "lodsd"},
+	{true, 6, "fisubr dword ptr [edx+0x98b6034c]"},
+	{true, 1, "stosb"},
+	{true, 1, "dec esp"},
+	{true, 6, "add esi, dword ptr [esi+0x1a0b9398]"},
+	{true, 2, "mov dh, 0x98"},
+	{true, 1, "cwde"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 2, "or ebx, dword ptr [edx]"},
+	{true, 2, "sbb bl, byte ptr [ecx]"},
+	{true, 3, "sbb dword ptr [edi+85], edx"},
+	{true, 1, "push edi"},
+	{true, 1, "push ebp"},
+	{true, 3, "mov dword ptr [edi-6], ecx"},
+	{true, 1, "dec edi"},
+	{true, 1, "cli"},
+	{true, 2, "mov cl, 121"},
+	{true, 2, "jns 0x00001011"},
+	{true, 3, "psrld mm6, mm2"},
+	{true, 2, "sal dl, cl"},
+	{true, 6, "repne sub eax, 0xfb3d05bd"},
+	{true, 5, "sub eax, 0xfb3d05bd"},
+	{true, 5, "mov ebp, 0x18fb3d05"},
+	{true, 5, "add eax, 0xa818fb3d"},
+	{true, 5, "cmp eax, 0xa8a818fb"},
+	{true, 1, "sti"},
+	{true, 6, "sbb byte ptr [eax+0x4cfa00a8], ch"},
+	{true, 2, "test al, 0xa8"},
+	{true, 2, "test al, 0"},
+	{true, 2, "add dl, bh"},
+	{true, 1, "cli"},
+	{true, 1, "dec esp"},
+	{true, 4, "xor byte ptr [ebx+esi*8-111], cl"},
+	{true, 1, "dec esp"},
+	{true, 2, "rep xchg ecx, eax"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "add dh, byte ptr [esi]"},
+	{true, 3, "or dl, ch"},
+	{true, 2, "or dl, ch"},
+	{true, 7, "jmp far 0x4938:0x66032e4e"},
+	{true, 1, "dec esi"},
+	{true, 4, "add esp, dword ptr cs:[esi+56]"},
+	{true, 3, "add esp, dword ptr [esi+56]"},
+	{true, 4, "cmp byte ptr [ecx+38], cl"},
+	{true, 3, "cmp byte ptr [ecx+38], cl"},
+	{true, 1, "dec ecx"},
+	{true, 4, "rep xchg ecx, eax"},
+	{true, 3, "rep xchg ecx, eax"},
+	{true, 2, "rep xchg ecx, eax"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 3, "cmp al, 70"},
+	{true, 2, "cmp al, 70"},
+	{true, 1, "inc esi"},
+	{true, 3, "mov ch, 0xa0"},
+	{true, 2, "mov ch, 0xa0"},
+	{true, 5, "mov al, byte ptr [0xc924ffa9]"},
+	{true, 5, "test eax, 0x5cc924ff"},
+	{true, 3, "jmp dword ptr [ecx+ecx*8]"},
+	{true, 2, "and al, 0xc9"},
+	{true, 1, "leave"},
+	{true, 1, "pop esp"},
+	{true, 3, "fiadd word ptr [ecx+96]"},
+	{true, 1, "inc ecx"},
+	{true, 1, "pushad"},
+	{true, 1, "dec esp"},
+	{false, 3, 0},
+	{true, 1, "scasb"},
+	{true, 1, "ret"},
+	{true, 2, "cmp al, 79"},
+	{true, 1, "dec edi"},
+	{true, 2, "mov bl, 117"},
+	{true, 2, "jnz 0x00000fea"},
+	{true, 5, "call 0x9b7d747f"},
+	{true, 2, "jp 0x00001066"},
+	{true, 3, "jnl 0x00000f9e"},
+	{true, 2, "jnl 0x00000f9d"},
+	{true, 1, "wait"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 5, "mov ebp, 0x418cbfb5"},
+	{true, 2, "mov ch, 0xbf"},
+	{true, 5, "mov edi, 0x824d418c"},
+	{true, 3, "mov dword ptr [ecx+77], es"},
+	{true, 1, "inc ecx"},
+	{true, 1, "dec ebp"},
+	{true, 7, "adc byte ptr [esi+0x36d7a79c], 0x9a"},
+	{true, 1, "xchg esi, eax"},
+	{true, 1, "pushfd"},
+	{true, 1, "cmpsd"},
+	{true, 1, "xlat"},
+	{false, 5, 0},
+	{false, 4, 0},
+	{true, 2, "dec ecx"},
+	{true, 1, "dec ecx"},
+	{false, 1, 0},
+};
+
+static const golden_t golden_prefixed64[golden_count] = {
+	{true, 1, "pop rax"},
+	{true, 3, "mov ch, 7"},
+	{true, 2, "mov ch, 7"},
+	{false, 1, 0},
+	{true, 2, "jnl 0x0000000000001011"},
+	{true, 3, "verr word ptr [rsi]"},
+	{true, 2, "add byte ptr [rsi], ah"},
+	{true, 3, "cld"},
+	{true, 2, "cld"},
+	{true, 1, "cld"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "cmpsb"},
+	{true, 2, "in al, 80"},
+	{true, 1, "push rax"},
+	{true, 5, "mov eax, 0x504ee546"},
+	{true, 3, "in eax, 78"},
+	{true, 2, "in eax, 78"},
+	{true, 2, "push rax"},
+	{true, 1, "push rax"},
+	{true, 1, "cmc"},
+	{true, 2, "jnle 0x0000000000001068"},
+	{true, 5, "enter 0x054d, 15"},
+	{true, 4, "enter 0x054d, 15"},
+	{true, 6, "add r8, 0x19d53e0f"},
+	{true, 5, "add eax, 0x19d53e0f"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "sbb edx, ebp"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 1, "xchg ecx, eax"},
+	{false, 2, 0},
+	{true, 7, "xor ecx, dword ptr ds:[rbx+0x407d2e40]"},
+	{true, 6, "xor ecx, dword ptr [rbx+0x407d2e40]"},
+	{true, 3, "mov eax, dword ptr [rax+46]"},
+	{false, 2, 0},
+	{true, 3, "jnl 0x0000000000001043"},
+	{true, 2, "jnl 0x0000000000001042"},
+	{false, 2, 0},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 5, "mov dword ptr [0xffffffffac8de072], eax"},
+	{true, 2, "jb 0x0000000000000fe2"},
+	{true, 2, "loopne 0x0000000000000f8f"},
+	{true, 7, "lea ebp, [rbx+rdi*8+0x1682574c]"},
+	{true, 1, "lodsb"},
+	{true, 1, "sti"},
+	{true, 2, "push rdi"},
+	{true, 1, "push rdi"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 4, "enter 0x5465, 22"},
+	{true, 2, "push rsp"},
+	{true, 1, "push rsp"},
+	{false, 1, 0},
+	{true, 3, "psrlw mm7, mm2"},
+	{true, 2, "sar edx, 1"},
+	{true, 1, "cli"},
+	{true, 1, "clc"},
+	{false, 1, 0},
+	{true, 2, "pop rcx"},
+	{true, 1, "pop rcx"},
+	{true, 3, "mov byte ptr [rdi+62], dh"},
+	{true, 2, "jnbe 0x0000000000001040"},
+	{true, 3, "sti"},
+	{true, 2, "sti"},
+	{true, 1, "sti"},
+	{true, 2, "adc al, 0xbd"},
+	{true, 5, "mov ebp, 0x484cf4ae"},
+	{true, 1, "scasb"},
+	{true, 1, "hlt"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 2, "sti"},
+	{true, 1, "sti"},
+	{true, 2, "jbe 0x0000000000000ff8"},
+	{true, 2, "imul dl"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "pushfq"},
+	{true, 1, "pushfd"},
+	{true, 2, "test al, 0xa8"},
+	{true, 2, "test al, 54"},
+	{true, 2, "cmpsd"},
+	{true, 1, "cmpsd"},
+	{true, 5, "mov byte ptr [rax-39], 108"},
+	{true, 4, "mov byte ptr [rax-39], 108"},
+	{true, 5, "fldcw word ptr [rbp+rsi*4-116]"},
+	{true, 4, "fldcw word ptr [rbp+rsi*4-116]"},
+	{true, 1, "insb"},
+	{true, 2, "mov ch, 0x8c"},
+	{true, 2, "mov edx, fs"},
+	{true, 2, "loop 0x0000000000001042"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "insd"},
+	{true, 1, "insd"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 2, "pop rbx"},
+	{true, 1, "pop rbx"},
+	{true, 1, "cdq"},
+	{true, 4, "imul rdi, qword ptr [r14], 68"},
+	{true, 3, "imul edi, dword ptr [rsi], 68"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "jo 0x0000000000000ff7"},
+	{true, 1, "cmc"},
+	{true, 6, "sub dword ptr [rax+0x0f688454], ebp"},
+	{true, 2, "test al, 84"},
+	{true, 1, "push rsp"},
+	{true, 3, "test byte ptr [rax+15], ch"},
+	{true, 5, "push 0xfffffffff0653e0f"},
+	{false, 2, 0},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 8, "sub r8b, byte ptr [r9+rsi*2+0x43b904f0]"},
+	{true, 7, "sub al, byte ptr [rcx+rsi*2+0x43b904f0]"},
+	{true, 3, "test byte ptr [rcx-16], dh"},
+	{true, 2, "jno 0x0000000000000ff2"},
+	{true, 3, "lock add al, 0xb9"},
+	{true, 2, "add al, 0xb9"},
+	{true, 5, "mov ecx, 0x44262643"},
+	{false, 2, 0},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 4, "xor r9, qword ptr [r14-24]"},
+	{true, 3, "xor ecx, dword ptr [rsi-24]"},
+	{true, 6, "call 0x000000003b05f2b1"},
+	{true, 5, "call 0x000000003b05f2b0"},
+	{true, 1, "stosd"},
+	{true, 2, "loop 0x0000000000001007"},
+	{true, 5, "add eax, 0x22e8883b"},
+	{true, 6, "cmp ecx, dword ptr [rax+0x630f22e8]"},
+	{true, 2, "mov al, ch"},
+	{true, 5, "call 0xffffffff8b631f27"},
+	{true, 2, "and cl, byte ptr [rdi]"},
+	{true, 7, "packsswb mm1, qword ptr [rbx+0x4da244ef]"},
+	{true, 6, "movsxd ecx, dword ptr [rbx+0x4da244ef]"},
+	{true, 2, "mov ebp, edi"},
+	{true, 1, "out dx, eax"},
+	{true, 6, "mov byte ptr [0xffffffffcebeb24d], al"},
+	{true, 5, "mov byte ptr [0xffffffffcebeb24d], al"},
+	{true, 3, "mov r10b, 0xbe"},
+	{true, 2, "mov dl, 0xbe"},
+	{true, 5, "mov esi, 0x7e6519ce"},
+	{false, 1, 0},
+	{true, 3, "sbb dword ptr [rbp+126], esp"},
+	{true, 3, "jle 0x0000000000000ffe"},
+	{true, 2, "jle 0x0000000000000ffd"},
+	{true, 1, "sti"},
+	{true, 5, "mov eax, 0x69e89e93"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "sahf"},
+	{true, 5, "call 0xffffffffc278816e"},
+	{true, 7, "imul esi, dword ptr [rcx+120], 0x661cc4c2"},
+	{true, 2, "jno 0x000000000000107a"},
+	{true, 2, "js 0x0000000000000fc4"},
+	{true, 3, "ret 0x1cc4"},
+	{false, 1, 0},
+	{true, 2, "sbb al, 102"},
+	{true, 3, "test al, 54"},
+	{true, 2, "test al, 54"},
+	{true, 3, "adc byte ptr ss:[rsi], dh"},
+	{true, 2, "adc byte ptr [rsi], dh"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "leave"},
+	{true, 1, "leave"},
+	{true, 3, "cmp esp, dword ptr [rdx+72]"},
+	{false, 1, 0},
+	{true, 2, "xchg rsp, rax"},
+	{true, 1, "xchg esp, eax"},
+	{true, 4, "xchg esi, eax"},
+	{true, 3, "xchg esi, eax"},
+	{true, 2, "xchg esi, eax"},
+	{true, 1, "xchg esi, eax"},
+	{true, 4, "sar r14, 1"},
+	{true, 3, "sar r14, 1"},
+	{true, 2, "sar esi, 1"},
+	{false, 2, 0},
+	{true, 4, "repne sbb al, 102"},
+	{true, 3, "sbb al, 102"},
+	{true, 2, "sbb al, 102"},
+	{true, 3, "mov word ptr [rdi], cx"},
+	{true, 2, "mov dword ptr [rdi], ecx"},
+	{false, 2, 0},
+	{true, 3, "pop rsi"},
+	{true, 2, "pop rsi"},
+	{true, 1, "pop rsi"},
+	{true, 2, "dec esp"},
+	{true, 1, "int3"},
+	{true, 2, "stc"},
+	{true, 1, "stc"},
+	{false, 1, 0},
+	{true, 2, "jz 0x0000000000001058"},
+	{true, 1, "push rsi"},
+	{true, 2, "callf fword ptr [rsi]"},
+	{false, 1, 0},
+	{true, 2, "mov dword ptr [rsi], seg8"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "jo 0x000000000000102b"},
+	{true, 2, "jo 0x000000000000102a"},
+	{true, 6, "sub byte ptr [rbp+0xffffffffacd74466], bl"},
+	{true, 1, "popfd"},
+	{true, 3, "xlat"},
+	{true, 2, "xlat"},
+	{true, 1, "xlat"},
+	{true, 1, "lodsb"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "insd"},
+	{true, 2, "adc ebx, esi"},
+	{true, 3, "repne push rbx"},
+	{true, 2, "repne push rbx"},
+	{true, 1, "push rbx"},
+	{true, 1, "cwde"},
+	{true, 3, "mov al, byte ptr [rdi+71]"},
+	{false, 2, 0},
+	{true, 4, "retf 0xfffffffffffff326"},
+	{true, 3, "retf 0xfffffffffffff326"},
+	{true, 7, "rep mov byte ptr es:[0xffffffffcb404d77], al"},
+	{true, 6, "rep mov byte ptr [0xffffffffcb404d77], al"},
+	{true, 5, "mov byte ptr [0xffffffffcb404d77], al"},
+	{true, 2, "jnbe 0x000000000000104f"},
+	{false, 2, 0},
+	{true, 2, "retf"},
+	{true, 1, "retf"},
+	{true, 1, "scasb"},
+	{true, 1, "pop rcx"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "fsub dword ptr [rax]"},
+	{true, 3, "and byte ptr [rbx+77], al"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "sti"},
+	{true, 2, "loop 0x0000000000001051"},
+	{true, 3, "mov qword ptr [r15], r13"},
+	{true, 2, "mov dword ptr [rdi], ebp"},
+	{false, 1, 0},
+	{true, 3, "add esp, dword ptr es:[rdi]"},
+	{true, 2, "add esp, dword ptr [rdi]"},
+	{false, 1, 0},
+	{true, 9, "imul sp, word ptr [rdi+0x2e654140], 0xffffffffffffb948"},
+	{true, 10, "imul esp, dword ptr [rdi+0x2e654140], 0xfffffffffae1b948"},
+	{true, 1, "cmpsd"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 12, "mov rcx, 0x3867eaf31786fae1"},
+	{true, 11, "mov rcx, 0x3867eaf31786fae1"},
+	{true, 10, "mov rcx, 0x3867eaf31786fae1"},
+	{true, 5, "mov ecx, 0x1786fae1"},
+	{true, 2, "loope 0x0000000000000ffc"},
+	{true, 1, "cli"},
+	{true, 2, "xchg dl, byte ptr [rdi]"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 4, "cmp dword ptr [edi+82], ah"},
+	{true, 3, "cmp byte ptr [rdi+82], ah"},
+	{true, 2, "push rdx"},
+	{true, 1, "push rdx"},
+	{true, 2, "in rax, dx"},
+	{true, 1, "in eax, dx"},
+	{true, 6, "repne mul qword ptr [r11-111]"},
+	{true, 5, "mul qword ptr [r11-111]"},
+	{true, 4, "mul dword ptr [rbx-111]"},
+	{true, 6, "mov dword ptr fs:[0xfffffffface3c491], eax"},
+	{true, 5, "mov dword ptr [0xfffffffface3c491], eax"},
+	{true, 1, "xchg ecx, eax"},
+	{false, 1, 0},
+	{true, 2, "jcez 0x0000000000000fae"},
+	{true, 1, "lodsb"},
+	{false, 2, 0},
+	{true, 3, "adc al, 39"},
+	{true, 2, "adc al, 39"},
+	{false, 1, 0},
+	{true, 1, "stosb"},
+	{true, 6, "rcr byte ptr [rcx+0x2a9f9326], cl"},
+	{true, 1, "cdq"},
+	{true, 2, "xchg ebx, eax"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "lahf"},
+	{true, 2, "sub cl, byte ptr [rdi]"},
+	{false, 2, 0},
+	{true, 2, "jnp 0x000000000000104f"},
+	{true, 3, "mov r14b, 64"},
+	{true, 2, "mov dh, 64"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "pop rbx"},
+	{true, 3, "mov ah, 0xd2"},
+	{true, 2, "mov ah, 0xd2"},
+	{true, 2, "ror cl, cl"},
+	{true, 1, "leave"},
+	{true, 2, "jp 0x0000000000001004"},
+	{true, 6, "add bl, byte ptr [rsi+0x44b4ce2e]"},
+	{true, 1, "sahf"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "mov ah, 68"},
+	{true, 6, "and eax, 0x1b53ec71"},
+	{true, 5, "and eax, 0x1b53ec71"},
+	{true, 2, "jno 0x0000000000000fee"},
+	{true, 1, "in al, dx"},
+	{true, 1, "push rbx"},
+	{true, 6, "sbb esi, dword ptr [rcx+0x79641068]"},
+	{true, 2, "mov cl, 104"},
+	{true, 5, "push 0xffffffff84796410"},
+	{true, 4, "adc byte ptr [rcx+rdi*2-124], ah"},
+	{true, 3, "jns 0x0000000000000f87"},
+	{true, 2, "jns 0x0000000000000f86"},
+	{true, 6, "test byte ptr [rbx+0x7e2ba167], al"},
+	{true, 4, "and dword ptr [rdi-95], 43"},
+	{true, 6, "mov eax, dword ptr [0xffffffffe6337e2b]"},
+	{true, 5, "mov eax, dword ptr [0xffffffffe6337e2b]"},
+	{true, 3, "sub edi, dword ptr [rsi+51]"},
+	{true, 2, "jle 0x0000000000001035"},
+	{true, 2, "xor esp, esi"},
+	{true, 2, "out 0xb2, al"},
+	{true, 2, "mov dl, 0xe8"},
+	{true, 5, "call 0x000000003e36a4da"},
+	{false, 1, 0},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "push rcx"},
+	{true, 2, "push rcx"},
+	{true, 1, "push rcx"},
+	{true, 2, "pushfd"},
+	{true, 1, "pushfd"},
+	{true, 5, "or eax, 0x2bbd36dc"},
+	{true, 2, "fdiv qword ptr [rsi]"},
+	{true, 6, "mov ebp, 0xffffffff88e2642b"},
+	{true, 5, "mov ebp, 0xffffffff88e2642b"},
+	{true, 4, "sub esp, dword ptr [rdx-120]"},
+	{true, 3, "loop 0x0000000000000f8b"},
+	{true, 2, "loop 0x0000000000000f8a"},
+	{true, 6, "mov byte ptr [rdx+0xffffffffc04f6578], dh"},
+	{true, 2, "mov dl, 120"},
+	{true, 2, "js 0x0000000000001067"},
+	{true, 9, "rcl byte ptr gs:[r10+0xffffffff892abb26], 115"},
+	{true, 8, "rcl byte ptr [r10+0xffffffff892abb26], 115"},
+	{true, 7, "rcl byte ptr [rdx+0xffffffff892abb26], 115"},
+	{true, 1, "xchg edx, eax"},
+	{true, 6, "mov ebx, 0x3873892a"},
+	{true, 5, "mov ebx, 0x3873892a"},
+	{true, 6, "sub cl, byte ptr [rcx+0x6bbe3873]"},
+	{true, 3, "mov dword ptr [rbx+56], esi"},
+	{true, 2, "jnb 0x000000000000103a"},
+	{true, 6, "cmp byte ptr [rsi+0xffffffffb958de6b], bh"},
+	{true, 5, "mov esi, 0xffffffffb958de6b"},
+	{true, 3, "imul ebx, esi, 88"},
+	{true, 3, "ficomp word ptr [rax-71]"},
+	{true, 1, "pop rax"},
+	{true, 5, "mov ecx, 0x681f7f64"},
+	{true, 3, "jnle 0x0000000000001022"},
+	{true, 2, "jnle 0x0000000000001021"},
+	{false, 1, 0},
+	{true, 5, "push 0xfffffffff9433825"},
+	{true, 5, "and eax, 0xffffffffb8f94338"},
+	{true, 3, "cmp byte ptr [rbx-7], al"},
+	{true, 2, "stc"},
+	{true, 1, "stc"},
+	{true, 5, "mov eax, 0x41835af0"},
+	{true, 2, "lock pop rdx"},
+	{true, 1, "pop rdx"},
+	{true, 4, "add dword ptr [rcx+38], 0xfc"},
+	{false, 2, 0},
+	{true, 2, "cld"},
+	{true, 1, "cld"},
+	{true, 2, "xor al, 105"},
+	{true, 6, "imul eax, eax, 0x2e16b84f"},
+	{true, 4, "ror byte ptr [rdi-72], 22"},
+	{true, 10, "mov r8, 0xf3d06f67c9852e16"},
+	{true, 5, "mov eax, 0xffffffffc9852e16"},
+	{false, 1, 0},
+	{true, 3, "test ecx, ecx"},
+	{true, 2, "test ecx, ecx"},
+	{true, 1, "leave"},
+	{true, 2, "outsd"},
+	{true, 1, "outsd"},
+	{true, 2, "sal bl, 1"},
+	{true, 3, "rep cmp al, 43"},
+	{true, 2, "cmp al, 43"},
+	{true, 6, "sub edi, dword ptr [rip+0x03d54f89]"},
+	{true, 5, "cmp eax, 0x03d54f89"},
+	{true, 3, "mov dword ptr [rdi-43], ecx"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "add eax, esp"},
+	{false, 1, 0},
+	{true, 2, "loope 0x0000000000000fbb"},
+	{true, 5, "mov ecx, 0x4a2f4164"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 7, "cmp qword ptr [rbx+0x4f36f2ee], rdi"},
+	{true, 6, "cmp dword ptr [rbx+0x4f36f2ee], edi"},
+	{true, 5, "mov ebx, 0x4f36f2ee"},
+	{true, 1, "out dx, al"},
+	{true, 5, "repne sub r8b, 18"},
+	{true, 4, "sub r8b, 18"},
+	{true, 3, "sub r8b, 18"},
+	{true, 2, "sub al, 18"},
+	{true, 3, "adc dl, byte ptr [rbx-13]"},
+	{true, 1, "push rbx"},
+	{true, 3, "rep jb 0x0000000000000ff5"},
+	{true, 2, "jb 0x0000000000000ff4"},
+	{true, 4, "repne xor byte ptr [rax-42], cl"},
+	{true, 3, "xor byte ptr [rax-42], cl"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 5, "mov edx, 0xfffffffff385b444"},
+	{true, 3, "mov ah, 0x85"},
+	{true, 2, "mov ah, 0x85"},
+	{true, 2, "test ebx, esi"},
+	{true, 2, "rep outsd"},
+	{true, 1, "outsd"},
+	{true, 10, "mov r10, 0x4f2241ad242e4464"},
+	{true, 5, "mov edx, 0x242e4464"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "and al, 0xad"},
+	{true, 2, "and al, 0xad"},
+	{true, 1, "lodsd"},
+	{true, 4, "and cl, byte ptr [r15-101]"},
+	{true, 3, "and cl, byte ptr [rdi-101]"},
+	{true, 2, "wait"},
+	{true, 1, "wait"},
+	{true, 2, "or cl, ch"},
+	{true, 5, "jmp 0x0000000079a3831a"},
+	{true, 5, "adc eax, 0x6479a373"},
+	{true, 2, "jnb 0x0000000000000fa5"},
+	{true, 5, "mov dword ptr [0x4bc76479], eax"},
+	{true, 2, "jns 0x0000000000001066"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "xlat"},
+	{true, 1, "xlat"},
+	{false, 1, 0},
+	{true, 3, "or rcx, rcx"},
+	{true, 2, "or ecx, ecx"},
+	{true, 1, "leave"},
+	{true, 2, "mov cl, 122"},
+	{true, 2, "jp 0x0000000000001046"},
+	{true, 2, "xchg esi, eax"},
+	{true, 1, "xchg esi, eax"},
+	{true, 3, "and esp, dword ptr [rbp+38]"},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "pop rcx"},
+	{true, 1, "pop rcx"},
+	{true, 1, "iret"},
+	{false, 2, 0},
+	{true, 2, "pop rbx"},
+	{true, 1, "pop rbx"},
+	{true, 3, "mov dword ptr [rdi+65], cs"},
+	{false, 2, 0},
+	{true, 2, "xchg r12d, eax"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "and al, 0xa1"},
+	{true, 2, "and al, 0xa1"},
+	{true, 5, "mov eax, dword ptr [0x2128f2cc]"},
+	{true, 1, "int3"},
+	{true, 3, "repne sub byte ptr [rcx], ah"},
+	{true, 2, "sub byte ptr [rcx], ah"},
+	{true, 2, "and dword ptr [rsi], edi"},
+	{true, 3, "repne stosb"},
+	{true, 2, "repne stosb"},
+	{true, 1, "stosb"},
+	{true, 3, "loopne 0x0000000000001065"},
+	{true, 2, "loopne 0x0000000000001064"},
+	{false, 1, 0},
+	{true, 3, "add esi, r10d"},
+	{true, 2, "add esi, edx"},
+	{false, 1, 0},
+	{true, 1, "cmpsd"},
+	{false, 1, 0},
+	{true, 1, "hlt"},
+	{false, 2, 0},
+	{true, 5, "mov byte ptr gs:[rsp+rdx*2-110], cl"},
+	{true, 4, "mov byte ptr [rsp+rdx*2-110], cl"},
+	{true, 2, "push rsp"},
+	{true, 1, "push rsp"},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "and al, 0xb7"},
+	{true, 2, "mov bh, 9"},
+	{true, 2, "or eax, esi"},
+	{true, 2, "lock leave"},
+	{true, 1, "leave"},
+	{false, 1, 0},
+	{true, 3, "fsub qword ptr [rsi-127]"},
+	{true, 7, "and word ptr [rsi+rdi+81], 0xffffffffffffced2"},
+	{true, 8, "and dword ptr [rsi+rdi+81], 0x66f6ced2"},
+	{true, 3, "push rcx"},
+	{true, 2, "push rcx"},
+	{true, 1, "push rcx"},
+	{true, 2, "ror dh, cl"},
+	{false, 1, 0},
+	{true, 3, "mul byte ptr [rsi+29]"},
+	{true, 4, "sbb ax, 0xffffffffffffd7c1"},
+	{true, 5, "sbb eax, 0x3385d7c1"},
+	{true, 3, "rcl edi, 0x85"},
+	{true, 1, "xlat"},
+	{true, 2, "test dword ptr [rbx], esi"},
+	{true, 2, "xor esi, ebx"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 5, "adc eax, 0xffffffffec651fd7"},
+	{true, 1, "xlat"},
+	{false, 1, 0},
+	{true, 2, "in al, dx"},
+	{true, 1, "in al, dx"},
+	{true, 2, "push rcx"},
+	{true, 1, "push rcx"},
+	{true, 2, "jl 0x0000000000001028"},
+	{true, 3, "cld"},
+	{true, 2, "cld"},
+	{true, 1, "cld"},
+	{true, 4, "paddsb mm3, qword ptr gs:[rax]"},
+	{true, 3, "paddsb mm3, qword ptr [rax]"},
+	{true, 1, "in al, dx"},
+	{true, 2, "sbb al, ah"},
+	{true, 2, "loopne 0x0000000000001018"},
+	{false, 1, 0},
+	{true, 1, "pop rsi"},
+	{true, 2, "loopne 0x000000000000104f"},
+	{true, 2, "in rax, dx"},
+	{true, 1, "in eax, dx"},
+	{true, 4, "cmp r14d, dword ptr [rsi+r8]"},
+	{true, 3, "cmp esi, dword ptr [rsi+rax]"},
+	{true, 2, "xor al, 6"},
+	{false, 1, 0},
+	{true, 5, "test eax, 0xfffffffffb0ff3d8"},
+	{true, 2, "fdiv st, st(3)"},
+	{true, 4, "psubq mm7, mm0"},
+	{true, 3, "psubq mm7, mm0"},
+	{true, 1, "sti"},
+	{true, 1, "clc"},
+	{true, 2, "cmp bh, bl"},
+	{true, 6, "fild qword ptr [rcx+0x0b1c4d3e]"},
+	{true, 5, "test eax, 0x0b1c4d3e"},
+	{true, 4, "sbb r8b, 11"},
+	{true, 3, "sbb r8b, 11"},
+	{true, 2, "sbb al, 11"},
+	{true, 2, "or edi, dword ptr [rax]"},
+	{true, 3, "cmp byte ptr [rbx-16], bh"},
+	{true, 2, "jnp 0x0000000000000ff2"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "jnp 0x000000000000103d"},
+	{true, 6, "cmp ebx, dword ptr [rsi+0xfffffffffa3befca]"},
+	{true, 1, "sahf"},
+	{true, 3, "retf 0x3bef"},
+	{true, 1, "out dx, eax"},
+	{true, 2, "cmp edi, edx"},
+	{true, 1, "cli"},
+	{true, 2, "cmpsq"},
+	{true, 1, "cmpsd"},
+	{true, 2, "jbe 0x0000000000000ff1"},
+	{true, 1, "out dx, eax"},
+	{false, 2, 0},
+	{true, 2, "jl 0x0000000000001048"},
+	{true, 3, "cmp r15d, esi"},
+	{true, 2, "cmp edi, esi"},
+	{false, 2, 0},
+	{true, 1, "cmpsd"},
+	{true, 3, "mov bh, 0xa1"},
+	{true, 2, "mov bh, 0xa1"},
+	{true, 5, "mov eax, dword ptr [0x2e22d80a]"},
+	{true, 2, "or bl, al"},
+	{true, 2, "fsub dword ptr [rdx]"},
+	{true, 2, "and ch, byte ptr [rsi]"},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "imul ch"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "jl 0x0000000000001008"},
+	{false, 1, 0},
+	{true, 1, "cmc"},
+	{false, 2, 0},
+	{true, 3, "loope 0x000000000000103a"},
+	{true, 2, "loope 0x0000000000001039"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 1, "in al, dx"},
+	{true, 6, "adc eax, 0x493e5849"},
+	{true, 5, "adc eax, 0x493e5849"},
+	{true, 2, "pop r8"},
+	{true, 1, "pop rax"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "xchg cx, ax"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "fistp qword ptr [rsi]"},
+	{true, 9, "or dh, byte ptr ss:[rdi+rcx*2+0x70647445]"},
+	{true, 8, "or dh, byte ptr ss:[rdi+rcx*2+0x70647445]"},
+	{true, 7, "or dh, byte ptr [rdi+rcx*2+0x70647445]"},
+	{true, 2, "mov ah, 79"},
+	{false, 2, 0},
+	{true, 3, "jz 0x0000000000001067"},
+	{true, 2, "jz 0x0000000000001066"},
+	{true, 3, "jo 0x0000000000000ff8"},
+	{true, 2, "jo 0x0000000000000ff7"},
+	{true, 1, "cmc"},
+	{true, 5, "mov eax, 0xffffffff8e6d57e6"},
+	{true, 2, "out 87, al"},
+	{true, 1, "push rdi"},
+	{true, 1, "insd"},
+	{true, 3, "mov es, word ptr [rax+52]"},
+	{true, 3, "xor al, 0xc0"},
+	{true, 2, "xor al, 0xc0"},
+	{true, 4, "rcl byte ptr [rcx-80], 3"},
+	{true, 1, "push rcx"},
+	{true, 2, "mov al, 3"},
+	{true, 2, "add esi, edx"},
+	{true, 3, "repne add al, 46"},
+	{true, 2, "add al, 46"},
+	{true, 2, "int3"},
+	{true, 1, "int3"},
+	{true, 7, "adc r13, 0x6adff28a"},
+	{true, 6, "adc ebp, 0x6adff28a"},
+	{false, 1, 0},
+	{true, 2, "mov dh, dl"},
+	{true, 4, "repne fild qword ptr [rdx-55]"},
+	{true, 3, "fild qword ptr [rdx-55]"},
+	{true, 2, "push 0xc9"},
+	{true, 1, "leave"},
+	{true, 6, "sbb dword ptr [rip+0x6cadee32], eax"},
+	{true, 5, "add eax, 0x6cadee32"},
+	{true, 2, "xor ch, dh"},
+	{true, 1, "out dx, al"},
+	{true, 1, "lodsd"},
+	{true, 1, "insb"},
+	{true, 5, "push 0xffffffff9910f036"},
+	{true, 8, "lock adc byte ptr ss:[rcx+0xffffffff93983d4c], bl"},
+	{true, 7, "lock adc byte ptr [rcx+0xffffffff93983d4c], bl"},
+	{true, 6, "adc byte ptr [rcx+0xffffffff93983d4c], bl"},
+	{true, 1, "cdq"},
+	{true, 6, "cmp rax, 0x0bfa9398"},
+	{true, 5, "cmp eax, 0x0bfa9398"},
+	{true, 1, "cwde"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "cli"},
+	{true, 6, "or esp, dword ptr [rbp+0x56078d49]"},
+	{true, 1, "movsd"},
+	{true, 3, "lea rax, [r15]"},
+	{true, 2, "lea eax, [rdi]"},
+	{false, 1, 0},
+	{true, 1, "push rsi"},
+	{true, 8, "cmp esp, 0xfffffffffbcd23e1"},
+	{true, 7, "cmp esp, 0xfffffffffbcd23e1"},
+	{true, 6, "cmp esp, 0xfffffffffbcd23e1"},
+	{true, 1, "cld"},
+	{true, 2, "loope 0x0000000000001025"},
+	{true, 2, "and ecx, ebp"},
+	{true, 2, "int 0xfb"},
+	{true, 1, "sti"},
+	{true, 5, "mov ebp, 0x67df0fa8"},
+	{true, 2, "test al, 15"},
+	{true, 4, "pandn mm4, qword ptr [rdi-14]"},
+	{true, 3, "fbld tbyte ptr [rdi-14]"},
+	{false, 5, 0},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 5, "mov dword ptr [0x660c5706], eax"},
+	{false, 1, 0},
+	{true, 1, "push rdi"},
+	{true, 2, "or al, 102"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "rep jnp 0x0000000000001048"},
+	{true, 2, "jnp 0x0000000000001047"},
+	{false, 2, 0},
+	{true, 2, "outsb"},
+	{true, 1, "outsb"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 4, "ror byte ptr [rcx-50], 79"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 3, "mov cr4, r12w"},
+	{true, 2, "mov fs, sp"},
+	{true, 2, "in al, 79"},
+	{false, 2, 0},
+	{true, 2, "push rax"},
+	{true, 1, "push rax"},
+	{true, 6, "fnstcw word ptr [rbx+0xffffffffce1336f6]"},
+	{true, 5, "mov ebx, 0xffffffffce1336f6"},
+	{true, 2, "div byte ptr [rsi]"},
+	{true, 3, "adc ecx, esi"},
+	{true, 2, "adc ecx, esi"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 2, "shl byte ptr [rsi], 1"},
+	{true, 6, "mov dword ptr es:[0xffffffffa2363e24], eax"},
+	{true, 5, "mov dword ptr [0xffffffffa2363e24], eax"},
+	{true, 2, "and al, 62"},
+	{true, 7, "mov byte ptr ss:[0xffffffff8d414941], al"},
+	{true, 6, "mov byte ptr ss:[0xffffffff8d414941], al"},
+	{true, 5, "mov byte ptr [0xffffffff8d414941], al"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 4, "lea ecx, [r15+rsi*4]"},
+	{true, 3, "lea ecx, [rdi+rsi*4]"},
+	{true, 2, "or al, 0xb7"},
+	{true, 2, "mov bh, 0xb7"},
+	{true, 2, "mov bh, 0xd0"},
+	{true, 3, "ror byte ptr [rdi-34], 1"},
+	{true, 7, "fisub word ptr [r11+0x392e2e04]"},
+	{true, 6, "fisub word ptr [rbx+0x392e2e04]"},
+	{true, 5, "mov dword ptr [0x392e2e04], eax"},
+	{true, 2, "add al, 46"},
+	{true, 8, "cmp dword ptr cs:[rsi+0x4c366738], esp"},
+	{true, 7, "cmp dword ptr cs:[rsi+0x4c366738], esp"},
+	{true, 6, "cmp dword ptr [rsi+0x4c366738], esp"},
+	{true, 1, "cmpsb"},
+	{true, 3, "cmp byte ptr [rdi+54], ah"},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "loopne 0x000000000000104f"},
+	{true, 2, "loopne 0x000000000000104e"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "and byte ptr [rdi-109], bl"},
+	{true, 1, "pop rdi"},
+	{true, 1, "xchg ebx, eax"},
+	{false, 1, 0},
+	{true, 4, "enter 0x2edd, 0xf2"},
+	{false, 2, 0},
+	{true, 7, "rep xor byte ptr ss:[rsi+rsi], ah"},
+	{true, 6, "rep xor byte ptr ss:[rsi+rsi], ah"},
+	{true, 5, "rep xor byte ptr ss:[rsi+rsi], ah"},
+	{true, 4, "rep xor byte ptr [rsi+rsi], ah"},
+	{true, 3, "xor byte ptr [rsi+rsi], ah"},
+	{true, 2, "and al, 54"},
+	{true, 4, "cmp al, byte ptr ss:[rcx+79]"},
+	{true, 3, "cmp al, byte ptr [rcx+79]"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 1, 0},
+	{false, 2, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "sbb al, 14"},
+	{false, 1, 0},
+	{true, 3, "sar dh, 0xfd"},
+	{false, 2, 0},
+	{true, 1, "std"},
+	{true, 1, "push rbx"},
+	{true, 2, "jle 0x0000000000000f93"},
+	{true, 1, "xchg ecx, eax"},
+	{false, 1, 0},
+	{true, 3, "rol ecx, 57"},
+	{true, 3, "sar dword ptr [rcx], 0xe0"},
+	{true, 2, "cmp eax, esp"},
+	{true, 2, "loopne 0x0000000000000fb5"},
+	{true, 2, "mov bl, 119"},
+	{true, 2, "jnbe 0x0000000000001070"},
+	{true, 1, "outsb"},
+	{true, 5, "dec byte ptr fs:[rbp+rbx*8+15]"},
+	{true, 4, "dec byte ptr [rbp+rbx*8+15]"},
+	{true, 3, "fisttp qword ptr [rdi]"},
+	{true, 2, "fisttp qword ptr [rdi]"},
+	{true, 5, "shufps xmm4, xmmword ptr [rsi+80], 72"},
+	{false, 2, 0},
+	{true, 2, "push rax"},
+	{true, 1, "push rax"},
+	{true, 3, "xor al, 46"},
+	{true, 2, "xor al, 46"},
+	{true, 3, "add al, 41"},
+	{true, 2, "add al, 41"},
+	{true, 2, "sub dword ptr [rsi], ebp"},
+	{true, 2, "sti"},
+	{true, 1, "sti"},
+	{true, 2, "jno 0x0000000000001061"},
+	{true, 1, "pop rdi"},
+	{true, 2, "lock cld"},
+	{true, 1, "cld"},
+	{true, 4, "cmovp ecx, dword ptr [rbp+45]"},
+	{false, 2, 0},
+	{true, 6, "sub r8, 0x31bfe32f"},
+	{true, 5, "sub eax, 0x31bfe32f"},
+	{false, 1, 0},
+	{true, 2, "jcez 0x0000000000000fc1"},
+	{true, 5, "mov edi, 0x4078b431"},
+	{true, 7, "xor dword ptr [rax+rdi*2+0xfffffffff2f37340], esi"},
+	{true, 2, "mov ah, 120"},
+	{true, 2, "js 0x0000000000001042"},
+	{true, 3, "jnb 0x0000000000000ff6"},
+	{true, 2, "jnb 0x0000000000000ff5"},
+	{true, 7, "repne or eax, 0xffffffffe0fc829d"},
+	{true, 6, "repne or eax, 0xffffffffe0fc829d"},
+	{true, 5, "or eax, 0xffffffffe0fc829d"},
+	{true, 1, "popfd"},
+	{false, 1, 0},
+	{true, 1, "cld"},
+	{true, 2, "loopne 0x000000000000103a"},
+	{true, 2, "cmp byte ptr [rdx], cl"},
+	{true, 2, "or ah, bh"},
+	{true, 2, "out 4, eax"},
+	{true, 2, "add al, 0x80"},
+	{true, 3, "sbb byte ptr [rdi], 103"},
+	{false, 1, 0},
+	{true, 8, "imul esi, edx, 0xfffffffff7486e64"},
+	{true, 7, "imul esi, r10d, 0xfffffffff7486e64"},
+	{true, 6, "imul esi, edx, 0xfffffffff7486e64"},
+	{true, 3, "repne outsb"},
+	{true, 2, "outsb"},
+	{true, 1, "outsb"},
+	{true, 7, "test rdx, 0xffffffffff64d883"},
+	{true, 6, "test edx, 0xffffffffff64d883"},
+	{true, 3, "ret 0xffffffffffffd883"},
+	{true, 3, "sbb eax, 100"},
+	{true, 4, "fsub dword ptr [rdi+rdi*8+101]"},
+	{true, 4, "jmp qword ptr fs:[rbp+54]"},
+	{true, 3, "jmp qword ptr [rbp+54]"},
+	{true, 5, "mov cs, word ptr ss:[rbp+64]"},
+	{true, 4, "mov cs, word ptr ss:[rbp+64]"},
+	{true, 3, "mov cs, word ptr [rbp+64]"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 6, "xor eax, 0x5e371e4d"},
+	{true, 5, "xor eax, 0x5e371e4d"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 1, "pop rsi"},
+	{true, 7, "sub dword ptr [rbp+97], 0x40f29d50"},
+	{true, 1, "insd"},
+	{false, 1, 0},
+	{true, 1, "push rax"},
+	{true, 1, "popfd"},
+	{true, 7, "repne mov eax, 0x6d64369d"},
+	{true, 6, "mov eax, 0x6d64369d"},
+	{true, 5, "mov eax, 0x6d64369d"},
+	{true, 1, "popfd"},
+	{true, 3, "insd"},
+	{true, 2, "insd"},
+	{true, 1, "insd"},
+	{true, 1, "sti"},
+	{false, 1, 0},
+	{true, 1, "scasb"},
+	{true, 1, "cmpsb"},
+	{true, 2, "int 72"},
+	{true, 2, "push rbp"},
+	{true, 1, "push rbp"},
+	{true, 3, "loopne 0x0000000000000f92"},
+	{true, 2, "loopne 0x0000000000000f91"},
+	{false, 2, 0},
+	{true, 5, "or eax, 0x7d2e86c6"},
+	{true, 7, "mov byte ptr [rsi+0x0d137d2e], 64"},
+	{true, 2, "xchg ch, byte ptr [rsi]"},
+	{true, 3, "jnl 0x0000000000001016"},
+	{true, 2, "jnl 0x0000000000001015"},
+	{true, 6, "adc ecx, dword ptr [rip+0x3e2f4d40]"},
+	{true, 5, "or eax, 0x3e2f4d40"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "pop rdx"},
+	{true, 1, "pop rdx"},
+	{true, 5, "shl dword ptr [edi+46], 76"},
+	{true, 4, "shl dword ptr [rdi+46], 76"},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 3, "cbw"},
+	{true, 2, "cbw"},
+	{true, 1, "cwde"},
+	{true, 4, "jbe 0x0000000000001015"},
+	{true, 3, "jbe 0x0000000000001014"},
+	{true, 2, "jbe 0x0000000000001013"},
+	{true, 3, "adc dword ptr [rcx-49], eax"},
+	{true, 2, "iret"},
+	{true, 1, "iret"},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "std"},
+	{true, 1, "std"},
+	{true, 2, "in eax, 89"},
+	{true, 1, "pop rcx"},
+	{true, 5, "repne enter 0x6ab7, 0xcc"},
+	{true, 4, "enter 0x6ab7, 0xcc"},
+	{true, 2, "mov bh, 106"},
+	{true, 2, "push 0xcc"},
+	{true, 1, "int3"},
+	{true, 10, "sbb dword ptr [rdx+0x49961fb3], 0xffffffff95612649"},
+	{false, 1, 0},
+	{true, 2, "mov bl, 31"},
+	{false, 1, 0},
+	{true, 1, "xchg esi, eax"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "xchg ebp, eax"},
+	{true, 1, "pop rdi"},
+	{true, 3, "imul edx, ebp, 0x85"},
+	{false, 1, 0},
+	{true, 2, "test dword ptr [rsi], edi"},
+	{true, 3, "fistp dword ptr ds:[rbx]"},
+	{true, 2, "fistp dword ptr [rbx]"},
+	{true, 4, "sbb ebp, dword ptr [rsi+rsi+47]"},
+	{true, 1, "insb"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "sbb al, 127"},
+	{true, 2, "sbb al, 127"},
+	{true, 2, "jnle 0x0000000000001067"},
+	{true, 3, "sub al, 75"},
+	{true, 2, "sub al, 75"},
+	{false, 2, 0},
+	{true, 10, "mov r10, 0x4ca83eeef341dc19"},
+	{true, 5, "mov edx, 0xfffffffff341dc19"},
+	{true, 2, "sbb esp, ebx"},
+	{true, 3, "fadd qword ptr [rcx-13]"},
+	{false, 2, 0},
+	{true, 2, "rep out dx, al"},
+	{true, 1, "out dx, al"},
+	{true, 3, "test al, 76"},
+	{true, 2, "test al, 76"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 4, "test qword ptr [rsi-25], r15"},
+	{true, 3, "test dword ptr [rsi-25], edi"},
+	{true, 2, "jle 0x0000000000000fe9"},
+	{true, 2, "out 104, eax"},
+	{true, 5, "push 0xffffffff90c81313"},
+	{true, 2, "adc edx, dword ptr [rbx]"},
+	{true, 2, "adc ecx, eax"},
+	{true, 4, "enter 0x7490, 0x94"},
+	{true, 1, "nop"},
+	{true, 2, "jz 0x0000000000000f96"},
+	{true, 1, "xchg esp, eax"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 4, "rep adc bl, byte ptr fs:[rdi]"},
+	{true, 3, "rep adc bl, byte ptr [rdi]"},
+	{true, 2, "adc bl, byte ptr [rdi]"},
+	{false, 1, 0},
+	{true, 3, "push 118"},
+	{true, 2, "push 118"},
+	{true, 2, "jbe 0x0000000000000f8d"},
+	{true, 2, "mov eax, dword ptr [rcx]"},
+	{true, 2, "add dword ptr [rcx], esi"},
+	{true, 6, "xor dword ptr [rbx+0x4d487ffc], eax"},
+	{true, 3, "cmp esp, 127"},
+	{true, 1, "cld"},
+	{true, 2, "jnle 0x000000000000104a"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 11, "xor dword ptr [r9+0xfffffffff1f34201], 0xffffffffd0c3e838"},
+	{true, 10, "xor dword ptr [rcx+0xfffffffff1f34201], 0xffffffffd0c3e838"},
+	{true, 2, "mov cl, 1"},
+	{true, 3, "add dword ptr [rdx-13], eax"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "cmp al, ch"},
+	{true, 5, "call 0x000000004440e0c8"},
+	{true, 1, "ret"},
+	{true, 3, "rol byte ptr [rax+68], 1"},
+	{false, 2, 0},
+	{true, 4, "xor byte ptr [rdi-25], r13b"},
+	{true, 3, "xor byte ptr [rdi-25], ch"},
+	{true, 1, "outsd"},
+	{true, 2, "out 77, eax"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 6, "xor dh, byte ptr [rdx+0xfffffffff364058b]"},
+	{true, 2, "mov dl, 0x8b"},
+	{true, 6, "mov eax, dword ptr [rip+0x3e44f364]"},
+	{true, 5, "add eax, 0x3e44f364"},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "jnle 0x0000000000001067"},
+	{true, 2, "jnle 0x0000000000001066"},
+	{true, 5, "lock fidivr word ptr fs:[rdx+108]"},
+	{true, 4, "lock fidivr word ptr [rdx+108]"},
+	{true, 3, "fidivr word ptr [rdx+108]"},
+	{true, 2, "jp 0x000000000000106e"},
+	{true, 1, "insb"},
+	{true, 6, "jnp 0x000000005c3f98dc"},
+	{true, 2, "mov edx, esi"},
+	{false, 1, 0},
+	{true, 2, "mov byte ptr [rdi], bh"},
+	{false, 1, 0},
+	{true, 1, "pop rsp"},
+	{true, 3, "and dword ptr [rcx-87], eax"},
+	{true, 6, "test r8d, 0xfffffffff24415f3"},
+	{true, 5, "test eax, 0xfffffffff24415f3"},
+	{true, 6, "rep adc eax, 0xffffffff80b5f244"},
+	{true, 5, "adc eax, 0xffffffff80b5f244"},
+	{false, 2, 0},
+	{true, 3, "repne mov ch, 0x80"},
+	{true, 2, "mov ch, 0x80"},
+	{true, 5, "and byte ptr [rdx+rdx*2+88], 0xde"},
+	{true, 2, "push rdx"},
+	{true, 1, "push rdx"},
+	{true, 1, "pop rax"},
+	{true, 4, "fimul word ptr [rsp+rax*2+64]"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 3, "test al, 110"},
+	{true, 2, "test al, 110"},
+	{true, 1, "outsb"},
+	{true, 1, "lodsb"},
+	{true, 3, "fmul qword ptr [rbx-49]"},
+	{true, 2, "iretq"},
+	{true, 1, "iret"},
+	{true, 6, "add byte ptr [rdx+0xfffffffff24f2e3e], bl"},
+	{false, 1, 0},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "repne push rsp"},
+	{true, 1, "push rsp"},
+	{true, 6, "adc dh, byte ptr [rdx+0x737bd443]"},
+	{true, 2, "mov dl, 67"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "jnp 0x0000000000001075"},
+	{true, 2, "jnb 0x000000000000101c"},
+	{true, 3, "sbb ah, byte ptr [rsi-126]"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 6, "mov esi, 0x2d47e640"},
+	{true, 5, "mov esi, 0x2d47e640"},
+	{true, 3, "out 71, al"},
+	{true, 2, "out 71, al"},
+	{true, 6, "sub r8d, 0x53ae8c99"},
+	{true, 5, "sub eax, 0x53ae8c99"},
+	{true, 1, "cdq"},
+	{true, 6, "mov dword ptr [rsi+0x5a4f5353], gs"},
+	{true, 1, "scasb"},
+	{true, 1, "push rbx"},
+	{true, 1, "push rbx"},
+	{true, 2, "pop r10"},
+	{true, 1, "pop rdx"},
+	{true, 1, "xchg esp, eax"},
+	{true, 7, "imul eax, dword ptr [rax-95], 0x77e47cc0"},
+	{true, 6, "mov eax, dword ptr [0x77e47cc0]"},
+	{true, 5, "mov eax, dword ptr [0x77e47cc0]"},
+	{true, 5, "sar byte ptr [rsp+119], 125"},
+	{true, 2, "jl 0x0000000000000fe6"},
+	{true, 2, "in al, 119"},
+	{true, 2, "jnbe 0x000000000000107f"},
+	{true, 2, "jnl 0x0000000000001046"},
+	{true, 2, "pop rsp"},
+	{true, 1, "pop rsp"},
+	{true, 3, "sbb r14d, dword ptr [rsi]"},
+	{true, 2, "sbb esi, dword ptr [rsi]"},
+	{true, 6, "fnsave ss:[rbx-42]"},
+	{true, 5, "fnsave ss:[rbx-42]"},
+	{true, 4, "fnsave [rbx-42]"},
+	{true, 3, "fnsave [rbx-42]"},
+	{true, 2, "jnb 0x0000000000000fd8"},
+	{false, 1, 0},
+	{true, 6, "repne push rax"},
+	{true, 5, "repne push rax"},
+	{true, 4, "repne push rax"},
+	{true, 3, "repne push rax"},
+	{true, 2, "repne push rax"},
+	{true, 1, "push rax"},
+	{true, 3, "adc dword ptr [rbx], 7"},
+	{true, 2, "adc eax, dword ptr [rdi]"},
+	{false, 1, 0},
+	{true, 2, "loop 0x000000000000106e"},
+	{true, 1, "insb"},
+	{true, 1, "out dx, al"},
+	{true, 2, "loop 0x0000000000000ffb"},
+	{true, 1, "stc"},
+	{false, 1, 0},
+	{true, 1, "wait"},
+	{true, 6, "or eax, 0x62677d50"},
+	{true, 5, "or eax, 0x62677d50"},
+	{true, 1, "push rax"},
+	{true, 2, "jnl 0x0000000000001069"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "pop rcx"},
+	{true, 2, "xor al, 102"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "iret"},
+	{true, 5, "sub byte ptr [rax+r15*8-60], r11b"},
+	{true, 4, "sub byte ptr [rax+rdi*8-60], bl"},
+	{true, 1, "pop rsp"},
+	{true, 1, "clc"},
+	{false, 1, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "jnz 0x0000000000000fd5"},
+	{true, 3, "ror dword ptr [rdi+rbx*8], cl"},
+	{true, 2, "or al, 0xdf"},
+	{true, 3, "fbld tbyte ptr [rcx+100]"},
+	{false, 1, 0},
+	{true, 7, "xor edi, dword ptr fs:[rdi+0xfffffffff3d99b18]"},
+	{true, 6, "xor edi, dword ptr [rdi+0xfffffffff3d99b18]"},
+	{true, 5, "mov edi, 0xfffffffff3d99b18"},
+	{true, 6, "sbb byte ptr [rbx+0x4fb4f3d9], bl"},
+	{true, 1, "wait"},
+	{true, 2, "fpatan"},
+	{true, 3, "rep mov ah, 79"},
+	{true, 2, "mov ah, 79"},
+	{false, 2, 0},
+	{true, 4, "cmp r14, r12"},
+	{true, 3, "cmp r14, r12"},
+	{true, 2, "cmp esi, esp"},
+	{true, 2, "out 0xf3, al"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "insb"},
+	{true, 5, "push 0xffffffffab63940f"},
+	{true, 4, "setz byte ptr [rbx-85]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 6, "movsxd ebp, dword ptr [rbx+0xffffffffd9bef33f]"},
+	{true, 1, "stosd"},
+	{false, 1, 0},
+	{true, 6, "rep mov esi, 0xffffffff8f4364d9"},
+	{true, 5, "mov esi, 0xffffffff8f4364d9"},
+	{true, 4, "fldenv [rbx+rax*2-113]"},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "xchg edi, eax"},
+	{true, 2, "xchg edi, eax"},
+	{true, 1, "clc"},
+	{true, 1, "cli"},
+	{false, 1, 0},
+	{true, 3, "out 126, eax"},
+	{true, 2, "out 126, eax"},
+	{true, 2, "jle 0x0000000000001025"},
+	{true, 2, "and edx, ebp"},
+	{false, 1, 0},
+	{true, 2, "in eax, dx"},
+	{true, 1, "in eax, dx"},
+	{true, 6, "imul esp, dword ptr [rdi], 0xffffffffda0e1d64"},
+	{false, 1, 0},
+	{true, 6, "sbb eax, 0x3d1bda0e"},
+	{true, 5, "sbb eax, 0x3d1bda0e"},
+	{false, 1, 0},
+	{true, 2, "ficomp dword ptr [rbx]"},
+	{true, 6, "sbb edi, dword ptr [rip+0xffffffffe431e767]"},
+	{true, 5, "cmp eax, 0xffffffffe431e767"},
+	{true, 3, "out 49, eax"},
+	{true, 2, "out 49, eax"},
+	{true, 2, "xor esp, esp"},
+	{true, 2, "in al, 0xa1"},
+	{true, 5, "mov eax, dword ptr [0x2ecb073e]"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "retf"},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 11, "mov r8, 0xe56df0c359da6014"},
+	{true, 10, "mov r8, 0xe56df0c359da6014"},
+	{true, 5, "mov eax, 0x59da6014"},
+	{true, 2, "adc al, 96"},
+	{false, 1, 0},
+	{true, 3, "ficomp dword ptr [rcx-61]"},
+	{true, 1, "pop rcx"},
+	{true, 1, "ret"},
+	{true, 2, "lock insd"},
+	{true, 1, "insd"},
+	{true, 2, "in eax, 0x90"},
+	{true, 1, "nop"},
+	{true, 3, "repne adc al, 74"},
+	{true, 2, "adc al, 74"},
+	{false, 2, 0},
+	{true, 3, "loop 0x0000000000000ffd"},
+	{true, 2, "loop 0x0000000000000ffc"},
+	{true, 1, "cli"},
+	{true, 2, "sub edx, dword ptr [rcx]"},
+	{true, 6, "adc dword ptr [rip+0x26f7b71e], ebx"},
+	{true, 5, "sbb eax, 0x26f7b71e"},
+	{false, 1, 0},
+	{true, 2, "mov bh, 0xf7"},
+	{true, 2, "mul dword ptr [rsi]"},
+	{true, 2, "push rsp"},
+	{true, 1, "push rsp"},
+	{true, 6, "and eax, 0xffffffffd20f7bf0"},
+	{true, 5, "and eax, 0xffffffffd20f7bf0"},
+	{true, 3, "lock jnp 0x0000000000001012"},
+	{true, 2, "jnp 0x0000000000001011"},
+	{true, 3, "psrld mm2, qword ptr [rcx]"},
+	{true, 2, "rcl byte ptr [rcx], cl"},
+	{true, 2, "adc esp, ebx"},
+	{true, 2, "fdivr qword ptr [rdi]"},
+	{false, 1, 0},
+	{true, 3, "adc cl, al"},
+	{true, 2, "adc cl, al"},
+	{true, 3, "rcl dword ptr [rbx], 13"},
+	{true, 6, "adc ecx, dword ptr [rip+0x2340367b]"},
+	{true, 5, "or eax, 0x2340367b"},
+	{true, 2, "jnp 0x0000000000001038"},
+	{true, 8, "and ebp, dword ptr ss:[rbx+0x516d9ffb]"},
+	{true, 7, "and ebp, dword ptr [rbx+0x516d9ffb]"},
+	{true, 6, "and ebp, dword ptr [rbx+0x516d9ffb]"},
+	{true, 1, "stosd"},
+	{true, 1, "sti"},
+	{true, 1, "lahf"},
+	{true, 1, "insd"},
+	{true, 1, "push rcx"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "cmp cl, byte ptr [rcx-92]"},
+	{true, 2, "movsb"},
+	{true, 1, "movsb"},
+	{true, 2, "cld"},
+	{true, 1, "cld"},
+	{true, 2, "jle 0x000000000000100e"},
+	{true, 2, "or al, 79"},
+	{true, 2, "xchg r12, rax"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "jmp 0x0000000000001040"},
+	{true, 5, "enter 0x6248, 0xa9"},
+	{true, 4, "enter 0x6248, 0xa9"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 5, "test eax, 0x12538de2"},
+	{true, 2, "loop 0x0000000000000f8f"},
+	{true, 3, "lea edx, [rbx+18]"},
+	{true, 1, "push rbx"},
+	{true, 6, "adc al, byte ptr [rbx+0x2c44c6a8]"},
+	{true, 7, "sub dword ptr [rax+0x662c44c6], 0xd2"},
+	{true, 2, "test al, 0xc6"},
+	{true, 5, "mov byte ptr [rsp+rbp+102], 0xd2"},
+	{true, 3, "sub al, 102"},
+	{true, 2, "sub al, 102"},
+	{true, 3, "rcl cl, cl"},
+	{true, 2, "rcl cl, cl"},
+	{true, 6, "shl dword ptr [rsi+0xffffffffddc73c48], 1"},
+	{true, 1, "cmpsb"},
+	{true, 3, "cmp al, 0xc7"},
+	{true, 2, "cmp al, 0xc7"},
+	{false, 2, 0},
+	{true, 2, "fucomp st(3)"},
+	{true, 2, "jmp 0x0000000000001051"},
+	{true, 3, "jnz 0x000000000000106f"},
+	{true, 2, "jnz 0x000000000000106e"},
+	{true, 1, "insb"},
+	{true, 7, "fidivr dword ptr cs:[rbx+0x6766f2d9]"},
+	{true, 6, "fidivr dword ptr [rbx+0x6766f2d9]"},
+	{true, 5, "mov ebx, 0x6766f2d9"},
+	{true, 2, "fptan"},
+	{true, 5, "repne jnl 0x0000000000001080"},
+	{true, 4, "jnl 0x000000000000107f"},
+	{true, 3, "jnl 0x000000000000107e"},
+	{true, 2, "jnl 0x000000000000107d"},
+	{true, 2, "jnp 0x0000000000001067"},
+	{true, 6, "adc eax, 0x554d26f3"},
+	{true, 5, "adc eax, 0x554d26f3"},
+	{true, 4, "rep push r13"},
+	{true, 3, "push r13"},
+	{true, 2, "push r13"},
+	{true, 1, "push rbp"},
+	{true, 6, "push 0xffffffffcf3221b4"},
+	{true, 5, "push 0xffffffffcf3221b4"},
+	{true, 2, "mov ah, 33"},
+	{true, 2, "and dword ptr [rdx], esi"},
+	{true, 2, "xor cl, bh"},
+	{true, 1, "iret"},
+	{false, 2, 0},
+	{true, 3, "jb 0x0000000000001047"},
+	{true, 2, "jb 0x0000000000001046"},
+	{true, 4, "or r9b, byte ptr [rcx+96]"},
+	{true, 3, "or cl, byte ptr [rcx+96]"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 6, "push qword ptr [rsi+0x7ec748a9]"},
+	{true, 2, "mov dh, 0xa9"},
+	{true, 5, "test eax, 0x0f7ec748"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "jle 0x0000000000001011"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "add esp, dword ptr [rdx+5]"},
+	{false, 1, 0},
+	{true, 5, "add eax, 0x362e0d2e"},
+	{true, 6, "or eax, 0x28fa362e"},
+	{true, 5, "or eax, 0x28fa362e"},
+	{true, 3, "cli"},
+	{true, 2, "cli"},
+	{true, 1, "cli"},
+	{true, 2, "sub byte ptr [rdi], cl"},
+	{true, 7, "psubusw mm1, qword ptr [rcx+0xffffffffb9f02ee8]"},
+	{false, 2, 0},
+	{true, 2, "mov eax, ebp"},
+	{true, 5, "call 0xffffffff99ba0033"},
+	{true, 7, "lock mov ecx, 0xffffffffb6c52899"},
+	{true, 6, "lock mov ecx, 0xffffffffb6c52899"},
+	{true, 5, "mov ecx, 0xffffffffb6c52899"},
+	{true, 1, "cdq"},
+	{true, 2, "sub ch, al"},
+	{false, 1, 0},
+	{true, 2, "mov dh, 0x88"},
+	{true, 4, "mov byte ptr [rdi+38], al"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "out dx, al"},
+	{true, 2, "out dx, al"},
+	{true, 1, "out dx, al"},
+	{false, 2, 0},
+	{true, 7, "rep or word ptr [rax+10], 0x66f2"},
+	{true, 6, "or word ptr [rax+10], 0x66f2"},
+	{true, 7, "or dword ptr [rax+10], 0xffffffffc0ef66f2"},
+	{true, 3, "or sil, dl"},
+	{true, 2, "or dh, dl"},
+	{true, 3, "repne out dx, ax"},
+	{true, 2, "out dx, ax"},
+	{true, 1, "out dx, eax"},
+	{true, 3, "rcr byte ptr [rbx], 108"},
+	{true, 4, "sbb ebp, dword ptr [rax+rsi*8+49]"},
+	{true, 1, "insb"},
+	{true, 3, "lock xor ecx, esp"},
+	{true, 2, "xor ecx, esp"},
+	{true, 2, "loope 0x0000000000001026"},
+	{true, 2, "and al, 0x9d"},
+	{true, 1, "popfd"},
+	{true, 2, "rep pop rax"},
+	{true, 1, "pop rax"},
+	{true, 2, "xchg esp, eax"},
+	{true, 1, "xchg esp, eax"},
+	{false, 2, 0},
+	{true, 2, "xchg ebx, eax"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 3, "add ebx, dword ptr [rdx-84]"},
+	{true, 1, "pop rdx"},
+	{true, 1, "lodsb"},
+	{true, 1, "scasd"},
+	{true, 2, "sub eax, dword ptr [rax]"},
+	{true, 7, "add byte ptr [rsi+rbp*4+0xfffffffff8724165], al"},
+	{true, 6, "test byte ptr [rsi+0xfffffffff8724165], ch"},
+	{true, 1, "scasb"},
+	{true, 4, "jb 0x0000000000000ffc"},
+	{true, 3, "jb 0x0000000000000ffb"},
+	{true, 2, "jb 0x0000000000000ffa"},
+	{true, 1, "clc"},
+	{true, 2, "loop 0x0000000000001042"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "mov dh, 73"},
+	{true, 3, "sbb qword ptr [r10], rdx"},
+	{true, 2, "sbb dword ptr [rdx], edx"},
+	{true, 6, "adc dh, byte ptr [rsi+0x7c9f8d91]"},
+	{true, 2, "mov dh, 0x91"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 6, "lea ebx, [rdi+0xfffffffff2059f7c]"},
+	{true, 1, "lahf"},
+	{true, 2, "jl 0x0000000000000fa1"},
+	{true, 1, "lahf"},
+	{true, 5, "add eax, 0x671788f2"},
+	{true, 3, "repne mov byte ptr [rdi], dl"},
+	{true, 2, "mov byte ptr [rdi], dl"},
+	{false, 1, 0},
+	{true, 3, "in al, 0xc6"},
+	{true, 2, "in al, 0xc6"},
+	{false, 2, 0},
+	{true, 4, "rep adc dword ptr [rdx], esi"},
+	{true, 3, "adc dword ptr [rdx], esi"},
+	{true, 2, "adc dword ptr [rdx], esi"},
+	{true, 2, "xor bh, byte ptr [rdx]"},
+	{true, 4, "cmp cl, byte ptr [rax+rcx*2-84]"},
+	{false, 2, 0},
+	{true, 2, "lodsb"},
+	{true, 1, "lodsb"},
+	{true, 8, "cmp byte ptr [rsi+rbp*2+0x49e767f9], 0xf9"},
+	{true, 5, "mov esp, 0xffffffffe767f96e"},
+	{true, 1, "outsb"},
+	{true, 1, "stc"},
+	{true, 3, "out 73, eax"},
+	{true, 2, "out 73, eax"},
+	{true, 2, "stc"},
+	{true, 1, "stc"},
+	{true, 4, "retf 0x074c"},
+	{true, 3, "retf 0x074c"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "xor eax, esi"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 7, "fmul qword ptr cs:[rsi+0xffffffff99f4c7bc]"},
+	{true, 6, "fmul qword ptr [rsi+0xffffffff99f4c7bc]"},
+	{true, 7, "mov seg8, word ptr [rdi+rax*8+0xffffffffb74c99f4]"},
+	{true, 5, "mov esp, 0x4c99f4c7"},
+	{false, 2, 0},
+	{true, 1, "hlt"},
+	{true, 1, "cdq"},
+	{true, 3, "mov bh, 0xbb"},
+	{true, 2, "mov bh, 0xbb"},
+	{true, 5, "mov ebx, 0xfffffffff264a555"},
+	{true, 1, "push rbp"},
+	{true, 1, "movsd"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 6, "cmp ebx, dword ptr [rbp+0xffffffff9b2ef84f]"},
+	{true, 1, "popfd"},
+	{true, 2, "clc"},
+	{true, 1, "clc"},
+	{true, 2, "wait"},
+	{true, 1, "wait"},
+	{true, 1, "xchg ebx, eax"},
+	{false, 1, 0},
+	{true, 5, "sbb eax, 0xfffffffff2392b96"},
+	{true, 1, "xchg esi, eax"},
+	{true, 2, "sub edi, dword ptr [rcx]"},
+	{true, 2, "cmp edx, esi"},
+	{true, 7, "repne push 0x538c63cb"},
+	{true, 6, "push 0x538c63cb"},
+	{true, 5, "push 0x538c63cb"},
+	{true, 1, "retf"},
+	{true, 7, "movsxd ecx, dword ptr [rbx+rdx*2+0x08510d67]"},
+	{true, 3, "mov dword ptr [rbx+103], ss"},
+	{true, 1, "push rbx"},
+	{true, 6, "or eax, 0x2a440851"},
+	{true, 5, "or eax, 0x2a440851"},
+	{true, 1, "push rcx"},
+	{true, 4, "or byte ptr [rdx+rbp+92], al"},
+	{true, 5, "sub r11b, byte ptr [rdx+rsi*4+68]"},
+	{true, 4, "sub bl, byte ptr [rdx+rsi*4+68]"},
+	{true, 1, "pop rsp"},
+	{true, 2, "mov dl, 68"},
+	{true, 2, "push rbp"},
+	{true, 1, "push rbp"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 3, "neg byte ptr [r11]"},
+	{true, 2, "neg byte ptr [rbx]"},
+	{true, 2, "sbb esi, ebx"},
+	{true, 7, "rep mov ax, word ptr [0xffffffffcc4401f3]"},
+	{true, 6, "mov ax, word ptr [0xffffffffcc4401f3]"},
+	{true, 5, "mov eax, dword ptr [0xffffffffcc4401f3]"},
+	{true, 5, "rep add dword ptr [rsp+rcx*8-68], eax"},
+	{true, 4, "add dword ptr [rsp+rcx*8-68], eax"},
+	{true, 2, "int3"},
+	{true, 1, "int3"},
+	{true, 5, "mov esp, 0x05655619"},
+	{true, 3, "sbb dword ptr [rsi+101], edx"},
+	{true, 1, "push rsi"},
+	{true, 6, "add eax, 0xfffffffff2f4f340"},
+	{true, 5, "add eax, 0xfffffffff2f4f340"},
+	{false, 2, 0},
+	{true, 2, "rep hlt"},
+	{true, 1, "hlt"},
+	{true, 6, "repne mov esp, 0xfffffffff0ee5232"},
+	{true, 5, "mov esp, 0xfffffffff0ee5232"},
+	{true, 3, "xor dl, byte ptr [rdx-18]"},
+	{true, 1, "push rdx"},
+	{true, 1, "out dx, al"},
+	{true, 6, "lock mov eax, 0xffffffffd4832695"},
+	{true, 5, "mov eax, 0xffffffffd4832695"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 4, "adc esp, 76"},
+	{true, 3, "adc esp, 76"},
+	{false, 1, 0},
+	{true, 2, "xchg rdx, rax"},
+	{true, 1, "xchg edx, eax"},
+	{true, 6, "xor al, byte ptr [rdi+0x5e17275d]"},
+	{true, 3, "xchg ebx, dword ptr [rbp+39]"},
+	{true, 1, "pop rbp"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 1, "pop rsi"},
+	{true, 7, "shr byte ptr [rax+0xffffffffa5e9a6b2], 0x86"},
+	{true, 2, "test al, 0xb2"},
+	{true, 2, "mov dl, 0xa6"},
+	{true, 1, "cmpsb"},
+	{true, 5, "jmp 0xffffffffe31796aa"},
+	{true, 1, "movsd"},
+	{true, 2, "xchg dl, byte ptr [rdi]"},
+	{false, 1, 0},
+	{true, 2, "jcez 0x0000000000000fe6"},
+	{true, 2, "in al, 46"},
+	{true, 3, "out 77, al"},
+	{true, 2, "out 77, al"},
+	{true, 3, "ror qword ptr [r15], 1"},
+	{true, 2, "ror dword ptr [rdi], 1"},
+	{true, 3, "cmovs ebp, dword ptr [rsi]"},
+	{false, 2, 0},
+	{true, 3, "wait"},
+	{true, 2, "wait"},
+	{true, 1, "wait"},
+	{true, 3, "lea rcx, [r15]"},
+	{true, 2, "lea ecx, [rdi]"},
+	{true, 4, "pcmpgtw mm1, qword ptr [rax+79]"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "fnsave [r14]"},
+	{true, 2, "fnsave [rsi]"},
+	{true, 6, "xor eax, 0x404df04f"},
+	{true, 5, "xor eax, 0x404df04f"},
+	{false, 2, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 6, "push 0x4db71d4f"},
+	{true, 5, "push 0x4db71d4f"},
+	{true, 6, "sbb r8, 0x52f34db7"},
+	{true, 5, "sbb eax, 0x52f34db7"},
+	{true, 2, "mov bh, 77"},
+	{false, 2, 0},
+	{true, 2, "rep push rdx"},
+	{true, 1, "push rdx"},
+	{true, 3, "retf 0x4f90"},
+	{true, 1, "nop"},
+	{false, 2, 0},
+	{true, 2, "repne std"},
+	{true, 1, "std"},
+	{true, 4, "enter 0x0ff2, 61"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 5, "cmp eax, 0xffffffffea20fea3"},
+	{true, 5, "mov dword ptr [0x48ea20fe], eax"},
+	{false, 2, 0},
+	{true, 2, "and dl, ch"},
+	{false, 1, 0},
+	{true, 2, "pop rsp"},
+	{true, 1, "pop rsp"},
+	{true, 2, "adc edx, eax"},
+	{true, 3, "ret 0x4858"},
+	{true, 1, "pop rax"},
+	{true, 6, "sbb rax, 0x1c12fc36"},
+	{true, 5, "sbb eax, 0x1c12fc36"},
+	{true, 2, "cld"},
+	{true, 1, "cld"},
+	{true, 3, "adc bl, byte ptr [rdx+rsi]"},
+	{true, 2, "sbb al, 50"},
+	{true, 6, "xor bl, byte ptr [rdi+0x5852ba4f]"},
+	{true, 1, "lahf"},
+	{true, 10, "mov r10, 0x120f068d65265852"},
+	{true, 5, "mov edx, 0x65265852"},
+	{true, 1, "push rdx"},
+	{true, 1, "pop rax"},
+	{true, 4, "lea eax, gs:[rsi]"},
+	{true, 3, "lea eax, gs:[rsi]"},
+	{true, 2, "lea eax, [rsi]"},
+	{false, 1, 0},
+	{true, 3, "movlps xmm7, qword ptr [rsi]"},
+	{true, 2, "adc bh, byte ptr [rsi]"},
+	{true, 3, "pop fs"},
+	{true, 2, "pop fs"},
+	{true, 5, "mov eax, dword ptr [0x66144f22]"},
+	{true, 3, "and cl, byte ptr [rdi+20]"},
+	{true, 3, "adc r8b, 102"},
+	{true, 2, "adc al, 102"},
+	{true, 3, "xchg cx, ax"},
+	{true, 2, "xchg cx, ax"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 1, "lodsb"},
+	{true, 3, "retf 0x080f"},
+	{true, 2, "invd"},
+	{true, 7, "or byte ptr [rax+rdi*4+0x4c80077a], ch"},
+	{true, 1, "lodsb"},
+	{true, 5, "mov eax, 0x4c80077a"},
+	{true, 2, "jp 0x0000000000001009"},
+	{false, 1, 0},
+	{true, 5, "or byte ptr [rsi+rsi-54], 73"},
+	{false, 2, 0},
+	{true, 4, "retf 0xfffffffffffff249"},
+	{true, 3, "retf 0xfffffffffffff249"},
+	{false, 2, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "rep jnbe 0x0000000000001078"},
+	{true, 2, "jnbe 0x0000000000001077"},
+	{true, 2, "jnz 0x0000000000001051"},
+	{true, 3, "jle 0x000000000000100e"},
+	{true, 2, "jle 0x000000000000100d"},
+	{true, 2, "or edi, ebp"},
+	{true, 1, "std"},
+	{false, 2, 0},
+	{true, 3, "cmp al, byte ptr [r9]"},
+	{true, 2, "cmp al, byte ptr [rcx]"},
+	{true, 2, "add esi, ebp"},
+	{true, 1, "out dx, al"},
+	{true, 5, "add eax, 0xfffffffff0c52144"},
+	{true, 3, "and ebp, r8d"},
+	{true, 2, "and ebp, eax"},
+	{false, 1, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 5, "mov dword ptr [0x0ee492ab], eax"},
+	{true, 1, "stosd"},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "in al, 14"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 5, "add eax, 0xffffffffd3ff5b41"},
+	{true, 2, "pop r11"},
+	{true, 1, "pop rbx"},
+	{true, 2, "call rbx"},
+	{true, 2, "shr esp, cl"},
+	{true, 1, "in al, dx"},
+	{true, 1, "pop rsi"},
+	{false, 1, 0},
+	{true, 3, "xor byte ptr [rsi], dil"},
+	{true, 2, "xor byte ptr [rsi], bh"},
+	{true, 7, "call 0x0000000000005d6d"},
+	{true, 6, "call 0x0000000000005d6c"},
+	{true, 5, "call 0x0000000000005d6b"},
+	{true, 4, "call 0x0000000000005d6a"},
+	{true, 5, "call 0xffffffff8aed5d6b"},
+	{true, 3, "in rax, dx"},
+	{true, 2, "in rax, dx"},
+	{true, 1, "in eax, dx"},
+	{true, 7, "mov bl, byte ptr [rbp+0x06b365f2]"},
+	{true, 1, "pushfd"},
+	{true, 5, "and eax, 0x06b365f2"},
+	{true, 4, "repne mov bl, 6"},
+	{true, 3, "mov bl, 6"},
+	{true, 2, "mov bl, 6"},
+	{false, 1, 0},
+	{true, 3, "lock and al, 73"},
+	{true, 2, "and al, 73"},
+	{true, 2, "push r8"},
+	{true, 1, "push rax"},
+	{true, 2, "nop"},
+	{true, 1, "nop"},
+	{true, 2, "adc al, 64"},
+	{true, 3, "mov cl, 15"},
+	{true, 2, "mov cl, 15"},
+	{false, 2, 0},
+	{true, 3, "in eax, dx"},
+	{true, 2, "in eax, dx"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "push rdx"},
+	{true, 1, "int3"},
+	{true, 3, "or byte ptr [rdi], 0xfa"},
+	{true, 4, "psubd mm4, qword ptr [rcx-40]"},
+	{true, 1, "cli"},
+	{false, 1, 0},
+	{true, 6, "fadd dword ptr [rcx+0xffffffff95793855]"},
+	{true, 7, "adc dword ptr [rbp+56], 0x498b9579"},
+	{true, 1, "push rbp"},
+	{true, 3, "cmp byte ptr [rcx-107], bh"},
+	{true, 2, "jns 0x0000000000000f97"},
+	{true, 1, "xchg ebp, eax"},
+	{true, 3, "mov ecx, dword ptr [rcx-48]"},
+	{true, 3, "rol r15b, 1"},
+	{true, 2, "rol bh, 1"},
+	{false, 2, 0},
+	{true, 2, "stosb"},
+	{true, 1, "stosb"},
+	{true, 1, "leave"},
+	{true, 1, "pop rbx"},
+	{true, 5, "call 0x0000000036bf002b"},
+	{true, 7, "lock mov esi, 0x37a74b36"},
+	{true, 6, "lock mov esi, 0x37a74b36"},
+	{true, 5, "mov esi, 0x37a74b36"},
+	{true, 3, "cmpsq"},
+	{true, 2, "cmpsq"},
+	{true, 1, "cmpsd"},
+	{false, 1, 0},
+	{true, 3, "mov dh, 100"},
+	{true, 2, "mov dh, 100"},
+	{true, 4, "test byte ptr fs:[rdi-4], cl"},
+	{true, 3, "test byte ptr [rdi-4], cl"},
+	{true, 2, "cld"},
+	{true, 1, "cld"},
+	{true, 3, "push 48"},
+	{true, 2, "push 48"},
+	{true, 3, "xor byte ptr [rcx+44], cl"},
+	{true, 3, "sub r8b, 77"},
+	{true, 2, "sub al, 77"},
+	{false, 2, 0},
+	{true, 3, "xor r8b, 0xe5"},
+	{true, 2, "xor al, 0xe5"},
+	{true, 2, "in eax, 37"},
+	{true, 5, "and eax, 0xffffffffce466726"},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "loop 0x0000000000001044"},
+	{true, 2, "loop 0x0000000000001043"},
+	{false, 2, 0},
+	{true, 3, "in eax, dx"},
+	{true, 2, "in eax, dx"},
+	{true, 1, "in eax, dx"},
+	{true, 3, "imul ebp, dword ptr [rsi], 65"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "adc r13, rbx"},
+	{true, 2, "adc ebp, ebx"},
+	{true, 6, "frstor [rbp+0xffffffffcb3ff2f4]"},
+	{true, 1, "movsd"},
+	{true, 1, "hlt"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "retf"},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 1, "leave"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 2, "push rdi"},
+	{true, 1, "push rdi"},
+	{true, 2, "mov dh, 0xcd"},
+	{true, 2, "int 21"},
+	{true, 5, "adc eax, 0x5f600c8f"},
+	{false, 2, 0},
+	{true, 2, "or al, 96"},
+	{false, 1, 0},
+	{true, 1, "pop rdi"},
+	{true, 2, "sbb edi, esi"},
+	{true, 2, "imul ebp"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "nop"},
+	{true, 3, "lock stc"},
+	{true, 2, "stc"},
+	{true, 1, "stc"},
+	{true, 1, "ret"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "adc esi, dword ptr [rsi]"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "stosd"},
+	{true, 2, "stosd"},
+	{true, 1, "stosd"},
+	{true, 2, "cmp al, 0xd9"},
+	{true, 6, "fld dword ptr [rip+0x49fc9c33]"},
+	{true, 5, "add eax, 0x49fc9c33"},
+	{true, 7, "xor ebx, dword ptr [rsp+rdi*8+0xffffffffa02b0a49]"},
+	{true, 1, "pushfd"},
+	{true, 1, "cld"},
+	{true, 3, "or bpl, byte ptr [r11]"},
+	{true, 2, "or ch, byte ptr [rbx]"},
+	{true, 6, "sub esp, dword ptr [rax+0x4fcab913]"},
+	{true, 5, "mov al, byte ptr [0x4fcab913]"},
+	{true, 6, "adc edi, dword ptr [rcx+0x0fa84fca]"},
+	{true, 5, "mov ecx, 0x0fa84fca"},
+	{true, 3, "retf 0xffffffffffffa84f"},
+	{true, 3, "test r8b, 15"},
+	{true, 2, "test al, 15"},
+	{true, 7, "movntq qword ptr [rip+0xffffffffe520dc67], mm1"},
+	{true, 2, "out 13, eax"},
+	{true, 5, "or eax, 0xffffffffe520dc67"},
+	{true, 3, "fsub dword ptr [eax]"},
+	{true, 2, "fsub qword ptr [rax]"},
+	{true, 2, "and ch, ah"},
+	{true, 2, "in eax, 44"},
+	{true, 2, "sub al, 94"},
+	{true, 1, "pop rsi"},
+	{false, 1, 0},
+	{true, 1, "pushfd"},
+	{true, 4, "lock jz 0x000000000000100f"},
+	{true, 3, "jz 0x000000000000100e"},
+	{true, 2, "jz 0x000000000000100d"},
+	{true, 2, "or eax, edx"},
+	{true, 3, "ret 0x1857"},
+	{true, 1, "push rdi"},
+	{true, 2, "sbb byte ptr [rbx], al"},
+	{true, 2, "add ebp, ecx"},
+	{true, 5, "jmp 0x000000002a768f24"},
+	{false, 1, 0},
+	{true, 2, "jnle 0x0000000000001078"},
+	{true, 2, "jbe 0x000000000000102c"},
+	{true, 3, "sub cl, byte ptr [rax+86]"},
+	{true, 2, "push rsi"},
+	{true, 1, "push rsi"},
+	{true, 5, "or eax, 0x303cf221"},
+	{true, 2, "and edx, esi"},
+	{true, 3, "repne cmp al, 48"},
+	{true, 2, "cmp al, 48"},
+	{true, 6, "xor byte ptr [rax+0x597cb55c], ah"},
+	{true, 5, "mov al, byte ptr [0x597cb55c]"},
+	{true, 1, "pop rsp"},
+	{true, 2, "mov ch, 124"},
+	{true, 2, "jl 0x000000000000105b"},
+	{true, 1, "pop rcx"},
+	{true, 3, "rep stosq"},
+	{true, 2, "stosq"},
+	{true, 1, "stosd"},
+	{true, 6, "cmp al, byte ptr [rip+0x5c4ceae7]"},
+	{true, 5, "add eax, 0x5c4ceae7"},
+	{true, 2, "out 0xea, eax"},
+	{false, 1, 0},
+	{true, 2, "pop rsp"},
+	{true, 1, "pop rsp"},
+	{true, 6, "mov al, byte ptr [0xffffffffa7d5d14f]"},
+	{true, 5, "mov al, byte ptr [0xffffffffa7d5d14f]"},
+	{true, 3, "rcl r13, 1"},
+	{true, 2, "rcl ebp, 1"},
+	{false, 1, 0},
+	{true, 1, "cmpsd"},
+	{true, 1, "push rbx"},
+	{true, 1, "stc"},
+	{false, 2, 0},
+	{true, 6, "lock mov ebp, 0x3e9bf8cc"},
+	{true, 5, "mov ebp, 0x3e9bf8cc"},
+	{true, 1, "int3"},
+	{true, 1, "clc"},
+	{true, 1, "wait"},
+	{true, 3, "sbb dword ptr ds:[rdx], eax"},
+	{true, 2, "sbb dword ptr [rdx], eax"},
+	{true, 6, "add al, byte ptr [rax+0x2467e27a]"},
+	{true, 4, "cmp byte ptr [rdx-30], 103"},
+	{true, 2, "jp 0x0000000000000fe4"},
+	{true, 2, "loop 0x0000000000001069"},
+	{true, 3, "and al, 92"},
+	{true, 2, "and al, 92"},
+	{true, 1, "pop rsp"},
+	{true, 1, "stosd"},
+	{true, 3, "and ah, al"},
+	{true, 2, "and ah, al"},
+	{false, 1, 0},
+	{true, 5, "mov ebp, 0x4e28f8e8"},
+	{true, 5, "call 0xffffffffe54e38fd"},
+	{true, 1, "clc"},
+	{true, 3, "sub byte ptr [rsi-27], cl"},
+	{true, 3, "in rax, 64"},
+	{true, 2, "in eax, 64"},
+	{true, 2, "cwde"},
+	{true, 1, "cwde"},
+	{true, 1, "cmpsd"},
+	{true, 5, "jmp 0xffffffffcc2eb908"},
+	{true, 6, "add ebp, dword ptr [rcx+0x0f87cc2e]"},
+	{true, 5, "test eax, 0x0f87cc2e"},
+	{true, 2, "int3"},
+	{true, 1, "int3"},
+	{true, 2, "xchg ecx, dword ptr [rdi]"},
+	{true, 4, "punpckhwd mm0, dword ptr [rsi+73]"},
+	{true, 7, "imul eax, dword ptr [rsi+73], 0x4eb165f3"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 4, "rep mov cl, 78"},
+	{true, 3, "mov cl, 78"},
+	{true, 2, "mov cl, 78"},
+	{true, 10, "mov rbp, 0x40e2ca684f64fa4f"},
+	{true, 5, "mov ebp, 0x4f64fa4f"},
+	{true, 2, "cli"},
+	{true, 1, "cli"},
+	{true, 7, "push 0x5240e2ca"},
+	{true, 6, "push 0x5240e2ca"},
+	{true, 5, "push 0x5240e2ca"},
+	{true, 3, "retf 0x40e2"},
+	{true, 2, "loop 0x0000000000001042"},
+	{true, 2, "push rdx"},
+	{true, 1, "push rdx"},
+	{true, 3, "rol dword ptr [rbp+8], 1"},
+	{true, 3, "or r14b, r8b"},
+	{true, 2, "or dh, al"},
+	{false, 2, 0},
+	{true, 3, "mov bl, 0xb1"},
+	{true, 2, "mov bl, 0xb1"},
+	{true, 2, "mov cl, 102"},
+	{true, 4, "retf 0x5155"},
+	{true, 3, "retf 0x5155"},
+	{true, 1, "push rbp"},
+	{true, 1, "push rcx"},
+	{true, 5, "sub eax, 0xffffffffebe65be2"},
+	{true, 2, "loop 0x000000000000105d"},
+	{true, 1, "pop rbx"},
+	{true, 2, "out 0xeb, al"},
+	{true, 2, "jmp 0x0000000000001079"},
+	{true, 2, "jnbe 0x0000000000001016"},
+	{true, 2, "adc al, 0xf0"},
+	{true, 3, "lock mov ch, 0xdf"},
+	{true, 2, "mov ch, 0xdf"},
+	{true, 3, "fbstp tbyte ptr [rdi+77]"},
+	{true, 2, "jnbe 0x000000000000104f"},
+	{false, 2, 0},
+	{true, 2, "pop rsi"},
+	{true, 1, "pop rsi"},
+	{true, 2, "sbb byte ptr [rsi], dh"},
+	{true, 3, "leave"},
+	{true, 2, "leave"},
+	{true, 1, "leave"},
+	{true, 8, "movsxd rdx, qword ptr [rdi+rdx*2+0x3e72be4e]"},
+	{true, 7, "movsxd edx, dword ptr [rdi+rdx*2+0x3e72be4e]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 1, "push rdi"},
+	{true, 10, "mov rsi, 0xb164ee449b4d3e72"},
+	{true, 5, "mov esi, 0xffffffff9b4d3e72"},
+	{true, 2, "jb 0x0000000000001040"},
+	{true, 3, "wait"},
+	{true, 2, "wait"},
+	{true, 1, "wait"},
+	{true, 2, "out dx, al"},
+	{true, 1, "out dx, al"},
+	{true, 3, "mov cl, 73"},
+	{true, 2, "mov cl, 73"},
+	{false, 2, 0},
+	{true, 3, "mov byte ptr cs:[rdi], al"},
+	{true, 2, "mov byte ptr [rdi], al"},
+	{false, 1, 0},
+	{true, 5, "mov al, byte ptr [0xffffffffac26fb41]"},
+	{true, 2, "sti"},
+	{true, 1, "sti"},
+	{true, 2, "lodsb"},
+	{true, 1, "lodsb"},
+	{true, 7, "ficom dword ptr ds:[rdx+0x4049e03c]"},
+	{true, 6, "ficom dword ptr [rdx+0x4049e03c]"},
+	{true, 1, "xchg edx, eax"},
+	{true, 2, "cmp al, 0xe0"},
+	{true, 2, "loopne 0x000000000000104b"},
+	{false, 2, 0},
+	{true, 7, "xor byte ptr [rbx+0x315049c4], dil"},
+	{true, 6, "xor byte ptr [rbx+0x315049c4], bh"},
+	{true, 5, "mov ebx, 0x315049c4"},
+	{false, 1, 0},
+	{true, 2, "push r8"},
+	{true, 1, "push rax"},
+	{true, 6, "xor dword ptr [rdx+0x70fd4cf1], edx"},
+	{true, 1, "xchg edx, eax"},
+	{false, 1, 0},
+	{true, 2, "std"},
+	{true, 1, "std"},
+	{true, 2, "jo 0x000000000000105e"},
+	{true, 1, "pop rsp"},
+	{true, 2, "fcmove st, st(3)"},
+	{true, 1, "retf"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "sbb al, 0xf3"},
+	{true, 4, "rep cmp dword ptr [rdi+88], ecx"},
+	{true, 3, "cmp dword ptr [rdi+88], ecx"},
+	{true, 2, "pop r8"},
+	{true, 1, "pop rax"},
+	{true, 1, "cld"},
+	{true, 3, "jmp qword ptr [rbp+17]"},
+	{true, 5, "adc dword ptr gs:[rcx+rsi+33], edx"},
+	{true, 4, "adc dword ptr [rcx+rsi+33], edx"},
+	{true, 1, "push rsp"},
+	{true, 2, "xor dword ptr [rcx], esp"},
+	{true, 3, "and dword ptr [rsi-40], esi"},
+	{true, 2, "jbe 0x0000000000000fda"},
+	{true, 2, "fmul dword ptr [rdi]"},
+	{false, 2, 0},
+	{true, 3, "div dl"},
+	{true, 2, "div dl"},
+	{true, 4, "repne cmp byte ptr [rbp+76], dl"},
+	{true, 3, "cmp byte ptr [rbp+76], dl"},
+	{true, 1, "push rbp"},
+	{true, 4, "pop qword ptr [rsi+79]"},
+	{true, 3, "pop qword ptr [rsi+79]"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 2, "rep cdq"},
+	{true, 1, "cdq"},
+	{true, 2, "stosd"},
+	{true, 1, "stosd"},
+	{false, 2, 0},
+	{true, 3, "xor byte ptr cs:[rdi], cl"},
+	{true, 2, "xor byte ptr [rdi], cl"},
+	{true, 4, "paddsb mm5, qword ptr [rcx+77]"},
+	{true, 1, "in al, dx"},
+	{true, 7, "imul ecx, dword ptr [rbp-36], 0xffffffffd4f01475"},
+	{true, 4, "fdiv qword ptr [r13+20]"},
+	{true, 3, "fdiv qword ptr [rbp+20]"},
+	{true, 2, "jnz 0x0000000000001016"},
+	{true, 2, "adc al, 0xf0"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "ret"},
+	{true, 1, "ret"},
+	{true, 3, "add dword ptr cs:[rsi], edx"},
+	{true, 2, "add dword ptr [rsi], edx"},
+	{false, 1, 0},
+	{true, 4, "shl byte ptr [rbp-22], 0xd0"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "rol byte ptr [rdx+70], 1"},
+	{false, 2, 0},
+	{true, 2, "outsd"},
+	{true, 1, "outsd"},
+	{true, 4, "ret 0x6749"},
+	{true, 3, "ret 0x6749"},
+	{false, 2, 0},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "jl 0x0000000000000f9f"},
+	{true, 1, "popfd"},
+	{true, 2, "mov dword ptr [rbx], edx"},
+	{true, 3, "adc ebx, dword ptr [rdi+rbx*4]"},
+	{true, 2, "sbb al, 0x9f"},
+	{true, 1, "lahf"},
+	{true, 2, "rep pop rax"},
+	{true, 1, "pop rax"},
+	{true, 2, "out 0xff, eax"},
+	{true, 4, "dec dword ptr [rdx+rax*2-16]"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "jbe 0x0000000000000feb"},
+	{true, 5, "jmp 0xfffffffff28b65bb"},
+	{true, 2, "mov dh, 85"},
+	{true, 1, "push rbp"},
+	{true, 2, "mov esi, edx"},
+	{true, 2, "repne lahf"},
+	{true, 1, "lahf"},
+	{false, 2, 0},
+	{true, 2, "jz 0x0000000000001070"},
+	{true, 1, "outsb"},
+	{true, 6, "shr byte ptr [rdx+0x44dec349], 1"},
+	{true, 1, "stosb"},
+	{true, 2, "ret"},
+	{true, 1, "ret"},
+	{true, 4, "fiadd word ptr [rdi+63]"},
+	{true, 3, "out 63, eax"},
+	{true, 2, "out 63, eax"},
+	{false, 1, 0},
+	{true, 1, "push rbp"},
+	{false, 1, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "out dx, eax"},
+	{true, 1, "out dx, eax"},
+	{true, 7, "rep adc eax, dword ptr [rbx+0xfffffffffabd4055]"},
+	{true, 6, "adc eax, dword ptr [rbx+0xfffffffffabd4055]"},
+	{true, 4, "adc dword ptr [rbp+64], 0xbd"},
+	{true, 1, "push rbp"},
+	{true, 6, "mov ebp, 0x4c4c26fa"},
+	{true, 5, "mov ebp, 0x4c4c26fa"},
+	{true, 1, "cli"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "push rbp"},
+	{true, 1, "push rbp"},
+	{true, 1, "movsd"},
+	{false, 1, 0},
+	{true, 5, "mov eax, 0x141ff04b"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "adc al, 0xc5"},
+	{false, 1, 0},
+	{true, 1, "nop"},
+	{true, 1, "movsd"},
+	{true, 3, "adc dword ptr [rbp+65], ecx"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "mov dl, 103"},
+	{true, 11, "mov r13, 0x504ed601d51fc92e"},
+	{true, 10, "mov r13, 0x504ed601d51fc92e"},
+	{true, 5, "mov ebp, 0xffffffffd51fc92e"},
+	{true, 2, "leave"},
+	{true, 1, "leave"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 2, "add esi, edx"},
+	{false, 1, 0},
+	{true, 2, "push rax"},
+	{true, 1, "push rax"},
+	{true, 5, "xor eax, 0xffffffffcef2eb7d"},
+	{true, 2, "jnl 0x0000000000000fed"},
+	{true, 2, "jmp 0x0000000000000ff4"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "jle 0x0000000000000fca"},
+	{true, 4, "enter 0x7240, 111"},
+	{true, 3, "jb 0x0000000000001072"},
+	{true, 2, "jb 0x0000000000001071"},
+	{true, 1, "outsd"},
+	{false, 2, 0},
+	{true, 7, "repne cmp dl, byte ptr [rax+0x14b3cfeb]"},
+	{true, 6, "cmp dl, byte ptr [rax+0x14b3cfeb]"},
+	{true, 1, "nop"},
+	{true, 2, "jmp 0x0000000000000fd1"},
+	{true, 1, "iret"},
+	{true, 2, "mov bl, 20"},
+	{true, 2, "adc al, 0x90"},
+	{true, 1, "nop"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "push r14"},
+	{true, 1, "push rsi"},
+	{false, 2, 0},
+	{true, 3, "mov byte ptr [rdi], r15b"},
+	{true, 2, "mov byte ptr [rdi], bh"},
+	{false, 1, 0},
+	{true, 6, "lock cmp qword ptr [rdi+rcx+70], r14"},
+	{true, 5, "cmp qword ptr [rdi+rcx+70], r14"},
+	{true, 4, "cmp dword ptr [rdi+rcx+70], esi"},
+	{true, 2, "jz 0x0000000000001011"},
+	{true, 4, "cmovb ebp, dword ptr [rsi+71]"},
+	{true, 2, "outsb"},
+	{true, 1, "outsb"},
+	{true, 3, "movsxd r9d, dword ptr [r15]"},
+	{true, 2, "movsxd ecx, dword ptr [rdi]"},
+	{false, 2, 0},
+	{true, 3, "psubusw mm6, mm4"},
+	{true, 2, "fxtract"},
+	{true, 1, "hlt"},
+	{true, 2, "and edx, eax"},
+	{true, 3, "sar byte ptr [rax-48], 1"},
+	{true, 2, "js 0x0000000000000fd2"},
+	{true, 2, "sal bh, 1"},
+	{true, 2, "div ebx"},
+	{true, 2, "repe cmpsb"},
+	{true, 1, "cmpsb"},
+	{true, 1, "out dx, eax"},
+	{true, 3, "fldenv [rdi-38]"},
+	{true, 3, "fcmovbe st, st(0)"},
+	{true, 2, "fcmovbe st, st(0)"},
+	{true, 2, "sar al, 1"},
+	{true, 1, "clc"},
+	{false, 2, 0},
+	{true, 4, "or word ptr [rbp+114], sp"},
+	{true, 3, "or dword ptr [rbp+114], esp"},
+	{true, 3, "jb 0x0000000000001012"},
+	{true, 2, "jb 0x0000000000001011"},
+	{true, 3, "cmovns ebp, dword ptr [rcx]"},
+	{true, 7, "sub qword ptr [r9+0xffffffffaa8740ee], rbp"},
+	{true, 6, "sub dword ptr [rcx+0xffffffffaa8740ee], ebp"},
+	{true, 5, "test eax, 0xffffffffaa8740ee"},
+	{true, 1, "out dx, al"},
+	{true, 7, "xchg ebp, dword ptr [rdx+0x446f4fc1]"},
+	{true, 6, "xchg ebp, dword ptr [rdx+0x446f4fc1]"},
+	{true, 1, "stosb"},
+	{true, 4, "ror dword ptr [rdi+111], 68"},
+	{false, 2, 0},
+	{true, 1, "outsd"},
+	{true, 4, "shr byte ptr [rsi], 33"},
+	{true, 3, "shr byte ptr [rsi], 33"},
+	{true, 3, "and dword ptr cs:[rbx], ecx"},
+	{true, 2, "and dword ptr [rbx], ecx"},
+	{true, 2, "or esp, eax"},
+	{true, 2, "loopne 0x000000000000106e"},
+	{true, 1, "insb"},
+	{true, 4, "xor byte ptr [r8-77], r13b"},
+	{true, 3, "xor byte ptr [rax-77], ch"},
+	{true, 5, "push 0x66409ab3"},
+	{true, 2, "mov bl, 0x9a"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 4, "mov bp, 0x72cd"},
+	{true, 5, "mov ebp, 0x405d72cd"},
+	{true, 2, "int 114"},
+	{true, 2, "jb 0x000000000000105f"},
+	{true, 1, "pop rbp"},
+	{true, 4, "cmp cl, byte ptr [rax+97]"},
+	{true, 3, "cmp cl, byte ptr [rax+97]"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "iretq"},
+	{true, 1, "iret"},
+	{true, 5, "and eax, 0x0f8d03e1"},
+	{true, 2, "loope 0x0000000000001005"},
+	{true, 6, "add ecx, dword ptr [rbp+0x7965400f]"},
+	{true, 2, "lea ecx, [rdi]"},
+	{true, 4, "cmovo esp, dword ptr [rbp+121]"},
+	{false, 2, 0},
+	{true, 3, "jns 0x000000000000105f"},
+	{true, 2, "jns 0x000000000000105e"},
+	{true, 1, "pop rsp"},
+	{false, 1, 0},
+	{true, 2, "and al, 0xc2"},
+	{true, 3, "ret 0x0fc0"},
+	{true, 3, "ror byte ptr [rdi], 0xf2"},
+	{true, 3, "pslld mm2, qword ptr [rax]"},
+	{true, 3, "repne adc byte ptr [rcx], al"},
+	{true, 2, "adc byte ptr [rcx], al"},
+	{true, 2, "add esi, edx"},
+	{false, 1, 0},
+	{true, 1, "leave"},
+	{true, 5, "sar dword ptr [eax+64], 10"},
+	{true, 4, "sar dword ptr [rax+64], 10"},
+	{true, 2, "js 0x0000000000001042"},
+	{true, 7, "or sil, byte ptr [rbx+0x43fcf322]"},
+	{true, 6, "or dh, byte ptr [rbx+0x43fcf322]"},
+	{true, 2, "mov bl, 34"},
+	{true, 2, "and dh, bl"},
+	{true, 2, "rep cld"},
+	{true, 1, "cld"},
+	{false, 2, 0},
+	{true, 4, "repne jnb 0x000000000000104c"},
+	{true, 3, "jnb 0x000000000000104b"},
+	{true, 2, "jnb 0x000000000000104a"},
+	{false, 2, 0},
+	{true, 2, "xchg ebx, eax"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 1, "out dx, al"},
+	{true, 2, "jl 0x000000000000102a"},
+	{true, 2, "sub al, dh"},
+	{true, 3, "lock xchg esi, eax"},
+	{true, 2, "xchg esi, eax"},
+	{true, 1, "xchg esi, eax"},
+	{false, 2, 0},
+	{true, 2, "pop rbx"},
+	{true, 1, "pop rbx"},
+	{true, 3, "mov esi, dword ptr [rax+48]"},
+	{true, 2, "jo 0x0000000000001032"},
+	{true, 2, "xor byte ptr [rsi], ah"},
+	{true, 3, "jp 0x0000000000000f99"},
+	{true, 2, "jp 0x0000000000000f98"},
+	{true, 1, "xchg esi, eax"},
+	{true, 3, "fisttp word ptr [rbp-14]"},
+	{false, 2, 0},
+	{true, 7, "repne fadd dword ptr [rsi+0xfffffffff69b2e27]"},
+	{true, 6, "fadd dword ptr [rsi+0xfffffffff69b2e27]"},
+	{true, 2, "xchg ah, byte ptr [rdi]"},
+	{false, 1, 0},
+	{true, 2, "wait"},
+	{true, 1, "wait"},
+	{true, 7, "test byte ptr [rdx+0x4c670f65], 56"},
+	{false, 1, 0},
+	{true, 6, "packuswb mm1, qword ptr gs:[rax+rdi+73]"},
+	{true, 5, "packuswb mm1, qword ptr [rax+rdi+73]"},
+	{true, 5, "cmp dword ptr [ecx+26], r9b"},
+	{true, 4, "cmp byte ptr [rcx+26], r9b"},
+	{true, 3, "cmp byte ptr [rcx+26], cl"},
+	{true, 4, "sbb al, byte ptr [r8-50]"},
+	{true, 3, "sbb al, byte ptr [rax-50]"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "rcl r8d, 1"},
+	{true, 2, "rcl eax, 1"},
+	{true, 2, "ror byte ptr [rdi], 1"},
+	{false, 2, 0},
+	{true, 1, "insd"},
+	{true, 5, "or sp, word ptr [r12+r14*8]"},
+	{true, 4, "or esp, dword ptr [r12+r14*8]"},
+	{true, 3, "or esp, dword ptr [rsp+rsi*8]"},
+	{true, 2, "and al, 0xf4"},
+	{true, 1, "hlt"},
+	{true, 4, "cmovnle ecx, dword ptr [rdi-93]"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 5, "mov dword ptr [0x7e48dd55], eax"},
+	{true, 1, "push rbp"},
+	{true, 3, "fisttp qword ptr [rax+126]"},
+	{true, 3, "jle 0x0000000000001068"},
+	{true, 2, "jle 0x0000000000001067"},
+	{true, 2, "push rsp"},
+	{true, 1, "push rsp"},
+	{true, 3, "jmp 0x0000000000000fa5"},
+	{true, 2, "jmp 0x0000000000000fa4"},
+	{true, 5, "mov byte ptr [0xffffffff8fc3e948], al"},
+	{true, 6, "jmp 0x000000000fca9fc9"},
+	{true, 5, "jmp 0x000000000fca9fc8"},
+	{true, 1, "ret"},
+	{false, 2, 0},
+	{true, 3, "retf 0xffffffffffffc60f"},
+	{true, 4, "shufps xmm3, xmmword ptr [rdx], 0xe4"},
+	{false, 2, 0},
+	{true, 2, "sbb ah, ah"},
+	{true, 2, "in al, 79"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 4, "or byte ptr [rbx-20], ah"},
+	{true, 6, "mov dword ptr fs:[0x27ded0ec], eax"},
+	{true, 5, "mov dword ptr [0x27ded0ec], eax"},
+	{true, 1, "in al, dx"},
+	{true, 2, "rcr dh, 1"},
+	{true, 2, "fisub word ptr [rdi]"},
+	{false, 1, 0},
+	{true, 5, "or eax, 0xffffffffc3a75f6c"},
+	{true, 1, "insb"},
+	{true, 1, "pop rdi"},
+	{true, 1, "cmpsd"},
+	{true, 1, "ret"},
+	{true, 3, "mov bh, 0xd7"},
+	{true, 2, "mov bh, 0xd7"},
+	{true, 1, "xlat"},
+	{true, 1, "xchg esi, eax"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "rep mov dl, 72"},
+	{true, 2, "mov dl, 72"},
+	{false, 2, 0},
+	{true, 5, "mov dword ptr [0xfffffffff3646173], eax"},
+	{true, 2, "jnb 0x0000000000001063"},
+	{false, 1, 0},
+	{true, 4, "rep adc dword ptr fs:[rdi], ecx"},
+	{true, 3, "rep adc dword ptr [rdi], ecx"},
+	{true, 2, "adc dword ptr [rdi], ecx"},
+	{false, 3, 0},
+	{true, 7, "cmp ah, byte ptr [rdi+0x58092c75]"},
+	{true, 1, "movsb"},
+	{true, 2, "out 117, eax"},
+	{true, 2, "jnz 0x000000000000102e"},
+	{true, 2, "sub al, 9"},
+	{true, 3, "or dword ptr [rax-94], ebx"},
+	{true, 1, "pop rax"},
+	{true, 5, "mov byte ptr [0x4fa448c0], al"},
+	{true, 4, "ror byte ptr [rax-92], 79"},
+	{true, 2, "movsb"},
+	{true, 1, "movsb"},
+	{false, 2, 0},
+	{true, 2, "in eax, dx"},
+	{true, 1, "in eax, dx"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "pop rsp"},
+	{true, 1, "push rbx"},
+	{true, 4, "cmp ah, byte ptr gs:[rcx+7]"},
+	{true, 3, "cmp ah, byte ptr [rcx+7]"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 3, "sbb al, byte ptr [rcx+76]"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 9, "lock mov ebx, 0x61e667d1"},
+	{true, 8, "lock mov ebx, 0x61e667d1"},
+	{true, 7, "lock mov ebx, 0x61e667d1"},
+	{true, 6, "mov ebx, 0x61e667d1"},
+	{true, 5, "mov ebx, 0x61e667d1"},
+	{true, 3, "shl dword ptr [rdi-26], 1"},
+	{true, 3, "out 97, al"},
+	{true, 2, "out 97, al"},
+	{false, 1, 0},
+	{true, 1, "lahf"},
+	{true, 1, "out dx, al"},
+	{true, 3, "xor r13, rsi"},
+	{true, 2, "xor ebp, esi"},
+	{true, 1, "cmc"},
+	{true, 3, "jnb 0x0000000000001071"},
+	{true, 2, "jnb 0x0000000000001070"},
+	{true, 1, "outsb"},
+	{true, 2, "leave"},
+	{true, 1, "leave"},
+	{true, 4, "repne fisttp dword ptr [edi]"},
+	{true, 3, "repne fisttp dword ptr [rdi]"},
+	{true, 2, "fisttp dword ptr [rdi]"},
+	{true, 7, "minps xmm1, xmmword ptr [rax+0xfffffffff8be4f33]"},
+	{true, 1, "pop rbp"},
+	{true, 2, "mov byte ptr [rbx], dh"},
+	{true, 3, "xor ecx, dword ptr [rdi-66]"},
+	{true, 10, "mov r14, 0x754490412d997ff8"},
+	{true, 5, "mov esi, 0x2d997ff8"},
+	{true, 1, "clc"},
+	{true, 2, "jnle 0x0000000000000f9b"},
+	{true, 1, "cdq"},
+	{true, 5, "sub eax, 0x75449041"},
+	{true, 2, "xchg r8d, eax"},
+	{true, 1, "nop"},
+	{true, 3, "jnz 0x0000000000000fb2"},
+	{true, 2, "jnz 0x0000000000000fb1"},
+	{true, 1, "scasd"},
+	{true, 3, "repne retf"},
+	{true, 2, "retf"},
+	{true, 1, "retf"},
+	{true, 1, "outsb"},
+	{true, 5, "mov al, byte ptr [0x41b09fcf]"},
+	{true, 1, "iret"},
+	{true, 1, "lahf"},
+	{true, 2, "mov al, 65"},
+	{true, 2, "retf"},
+	{true, 1, "retf"},
+	{true, 4, "xor r13b, 0xdf"},
+	{true, 3, "xor ch, 0xdf"},
+	{true, 1, "cmc"},
+	{true, 2, "fisttp word ptr [rdi]"},
+	{true, 4, "pmaddwd mm4, qword ptr [rbp+78]"},
+	{true, 1, "cmc"},
+	{true, 4, "sub dl, r13b"},
+	{true, 3, "sub dl, r13b"},
+	{true, 2, "sub dl, ch"},
+	{false, 1, 0},
+	{true, 1, "xlat"},
+	{true, 2, "jnz 0x0000000000000fc6"},
+	{false, 1, 0},
+	{true, 2, "fld tbyte ptr [rsi]"},
+	{true, 4, "jnb 0x0000000000001002"},
+	{true, 3, "jnb 0x0000000000001001"},
+	{true, 2, "jnb 0x0000000000001000"},
+	{false, 2, 0},
+	{true, 5, "and eax, 0x33828147"},
+	{true, 11, "add dword ptr [r10+0x6760a033], 0x2c64b567"},
+	{true, 10, "add dword ptr [rdx+0x6760a033], 0x2c64b567"},
+	{false, 1, 0},
+	{true, 6, "xor esp, dword ptr [rax+0xffffffffb5676760]"},
+	{true, 5, "mov al, byte ptr [0xffffffffb5676760]"},
+	{false, 1, 0},
+	{true, 4, "mov ch, 100"},
+	{true, 3, "mov ch, 100"},
+	{true, 2, "mov ch, 100"},
+	{true, 3, "sub al, 0xbf"},
+	{true, 2, "sub al, 0xbf"},
+	{true, 5, "mov edi, 0xffffffffb88fd2c9"},
+	{true, 1, "leave"},
+	{true, 6, "ror byte ptr [rdi+0xffffffffa0722cb8], cl"},
+	{false, 2, 0},
+	{true, 5, "mov eax, 0x41a0722c"},
+	{true, 2, "sub al, 114"},
+	{true, 2, "jb 0x0000000000000fa2"},
+	{true, 5, "mov al, byte ptr [0x3e4b7b41]"},
+	{true, 3, "jnp 0x000000000000104e"},
+	{true, 2, "jnp 0x000000000000104d"},
+	{false, 2, 0},
+	{true, 8, "pop qword ptr ds:[rdi+0xffffffffcc4fbc86]"},
+	{true, 7, "pop qword ptr [rdi+0xffffffffcc4fbc86]"},
+	{true, 3, "test byte ptr [rdi-122], ah"},
+	{true, 8, "xchg bh, dword ptr [edi+ecx*2+0x5db680cc]"},
+	{true, 7, "xchg bh, byte ptr [rdi+rcx*2+0x5db680cc]"},
+	{true, 5, "mov esp, 0xffffffffb680cc4f"},
+	{true, 2, "int3"},
+	{true, 1, "int3"},
+	{true, 7, "xor byte ptr [rsi+0x1cca985d], 64"},
+	{true, 2, "mov dh, 93"},
+	{true, 1, "pop rbp"},
+	{true, 1, "cwde"},
+	{true, 3, "retf 0x401c"},
+	{true, 2, "sbb al, 64"},
+	{true, 3, "mov ah, 21"},
+	{true, 2, "mov ah, 21"},
+	{true, 5, "adc eax, 0xfffffffffb378620"},
+	{true, 6, "and byte ptr [rsi+0x7472fb37], al"},
+	{true, 2, "xchg dh, byte ptr [rdi]"},
+	{false, 1, 0},
+	{true, 1, "sti"},
+	{true, 2, "jb 0x0000000000001076"},
+	{true, 2, "jz 0x0000000000000fa4"},
+	{true, 5, "mov byte ptr [0xffffffff905696f3], al"},
+	{true, 2, "rep xchg esi, eax"},
+	{true, 1, "xchg esi, eax"},
+	{true, 1, "push rsi"},
+	{true, 1, "nop"},
+	{true, 1, "stosd"},
+	{true, 5, "test eax, 0xffffffff992e54df"},
+	{true, 4, "fist word ptr [rsi+rbp-103]"},
+	{true, 1, "push rsp"},
+	{true, 2, "cdq"},
+	{true, 1, "cdq"},
+	{true, 6, "adc byte ptr [rsi+0xffffffff8653cf4f], al"},
+	{true, 3, "xchg cl, byte ptr [rdi-49]"},
+	{true, 2, "iretq"},
+	{true, 1, "iret"},
+	{true, 1, "push rbx"},
+	{true, 6, "xchg dh, byte ptr [rcx+0x44e84341]"},
+	{true, 2, "mov cl, 65"},
+	{false, 2, 0},
+	{true, 6, "call 0x00000000412a0b4a"},
+	{true, 5, "call 0x00000000412a0b49"},
+	{true, 2, "sti"},
+	{true, 1, "sti"},
+	{true, 3, "sub dword ptr [rcx-100], eax"},
+	{true, 2, "pushfd"},
+	{true, 1, "pushfd"},
+	{true, 3, "sbb al, byte ptr [rax+86]"},
+	{true, 2, "push rsi"},
+	{true, 1, "push rsi"},
+	{true, 2, "jnb 0x0000000000000ff4"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 4, "add bl, byte ptr cs:[rsi]"},
+	{true, 3, "add bl, byte ptr cs:[rsi]"},
+	{true, 2, "add bl, byte ptr [rsi]"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "adc al, 102"},
+	{true, 3, "shl byte ptr [rsi+64], 1"},
+	{true, 10, "sbb word ptr [rip+0x2667498b], 0xffffffffffffc2c6"},
+	{true, 11, "sbb dword ptr [rip+0x2667498b], 0xffffffff9f48c2c6"},
+	{true, 10, "sbb dword ptr [rip+0x2667498b], 0xffffffff9f48c2c6"},
+	{true, 5, "sbb eax, 0x2667498b"},
+	{true, 3, "mov ecx, dword ptr [rcx+103]"},
+	{false, 2, 0},
+	{true, 5, "mov dl, 72"},
+	{true, 4, "mov dl, 72"},
+	{true, 3, "mov dl, 72"},
+	{true, 3, "ret 0xffffffffffff9f48"},
+	{true, 2, "lahf"},
+	{true, 1, "lahf"},
+	{true, 4, "adc cl, byte ptr [rbx+rdi*2-48]"},
+	{true, 3, "jnp 0x0000000000000fd3"},
+	{true, 2, "jnp 0x0000000000000fd2"},
+	{true, 2, "shr byte ptr [rsi], 1"},
+	{true, 3, "in al, 0x80"},
+	{true, 2, "in al, 0x80"},
+	{true, 4, "add byte ptr [rax+68], 0x8c"},
+	{false, 2, 0},
+	{true, 5, "mov dword ptr [rsi+rbp-55], cr1"},
+	{true, 4, "mov dword ptr [rsi+rbp-55], cs"},
+	{false, 2, 0},
+	{true, 2, "leave"},
+	{true, 1, "leave"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "retf 0xffffffffffff8a3a"},
+	{true, 6, "cmp cl, byte ptr [rdx+0xffffffff9c494e64]"},
+	{true, 4, "mov ah, byte ptr [rsi+rcx*2+73]"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "pushfq"},
+	{true, 1, "pushfd"},
+	{true, 4, "cmp eax, dword ptr [rcx+rdx*4+116]"},
+	{true, 2, "xchg ecx, eax"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "jz 0x000000000000104a"},
+	{true, 2, "push rsi"},
+	{true, 1, "push rsi"},
+	{true, 2, "idiv byte ptr [rdx]"},
+	{true, 6, "cmp dl, byte ptr [rip+0x33194ff0]"},
+	{true, 5, "adc eax, 0x33194ff0"},
+	{true, 4, "lock sbb qword ptr [r11], r14"},
+	{true, 3, "sbb qword ptr [r11], r14"},
+	{true, 2, "sbb dword ptr [rbx], esi"},
+	{true, 7, "xor esi, dword ptr [rbp+rbx*8+0xffffffffb5e3763e]"},
+	{true, 2, "mov ah, 0xdd"},
+	{true, 2, "fnstsw word ptr [rsi]"},
+	{true, 3, "jbe 0x0000000000000fe6"},
+	{true, 2, "jbe 0x0000000000000fe5"},
+	{true, 2, "jcez 0x0000000000000fb7"},
+	{true, 2, "mov ch, 102"},
+	{true, 4, "cmp r9w, word ptr [r15]"},
+	{true, 3, "cmp r9d, dword ptr [r15]"},
+	{true, 2, "cmp ecx, dword ptr [rdi]"},
+	{true, 4, "btc dword ptr [rcx+66], edi"},
+	{true, 5, "mov ebx, 0xfffffffff0ea4279"},
+	{true, 2, "jns 0x0000000000001044"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "lock pop rsp"},
+	{true, 2, "pop rsp"},
+	{true, 1, "pop rsp"},
+	{true, 1, "cdq"},
+	{true, 6, "adc byte ptr [rbp+0xfffffffff943b736], ah"},
+	{true, 1, "movsd"},
+	{true, 3, "mov bh, 67"},
+	{true, 2, "mov bh, 67"},
+	{true, 2, "stc"},
+	{true, 1, "stc"},
+	{true, 3, "or byte ptr [rsi-91], dh"},
+	{true, 2, "jbe 0x0000000000000fa7"},
+	{true, 1, "movsd"},
+	{false, 2, 0},
+	{true, 4, "cmp byte ptr ds:[rdi-40], cl"},
+	{true, 3, "cmp byte ptr [rdi-40], cl"},
+	{true, 7, "fmul dword ptr [r15+0x2cee2e84]"},
+	{true, 6, "fmul dword ptr [rdi+0x2cee2e84]"},
+	{true, 7, "pop qword ptr [rsi+rbp+0xffffffffb02b2cee]"},
+	{true, 2, "test byte ptr [rsi], ch"},
+	{true, 2, "out dx, al"},
+	{true, 1, "out dx, al"},
+	{true, 2, "sub al, 43"},
+	{true, 6, "sub esi, dword ptr [rax+0x64978040]"},
+	{true, 2, "mov al, 64"},
+	{true, 8, "adc byte ptr [rdi+0x48269064], 117"},
+	{true, 7, "adc byte ptr [rdi+0x48269064], 117"},
+	{true, 1, "xchg edi, eax"},
+	{true, 2, "nop"},
+	{true, 1, "nop"},
+	{true, 4, "jnz 0x0000000000001012"},
+	{true, 3, "jnz 0x0000000000001011"},
+	{true, 2, "jnz 0x0000000000001010"},
+	{false, 1, 0},
+	{true, 3, "lock mov bh, 0xcf"},
+	{true, 2, "mov bh, 0xcf"},
+	{true, 1, "iret"},
+	{true, 3, "jcez 0x0000000000000fd6"},
+	{true, 2, "jcez 0x0000000000000fd5"},
+	{true, 3, "shl dword ptr [rsi+65], cl"},
+	{true, 3, "push r11"},
+	{true, 2, "push r11"},
+	{true, 1, "push rbx"},
+	{true, 2, "jnl 0x0000000000001004"},
+	{true, 2, "add ch, ch"},
+	{true, 1, "in eax, dx"},
+	{true, 5, "cmovno edi, dword ptr [rsi+rbp*8+111]"},
+	{true, 3, "jl 0x0000000000000ff1"},
+	{true, 2, "jl 0x0000000000000ff0"},
+	{true, 1, "out dx, al"},
+	{true, 1, "outsd"},
+	{true, 2, "jnbe 0x0000000000000f89"},
+	{true, 2, "xchg edx, eax"},
+	{true, 2, "ror byte ptr [rcx], 1"},
+	{true, 6, "or dword ptr [rdx+0xffffffff862566b2], esp"},
+	{true, 5, "mov byte ptr [0xffffffff862566b2], al"},
+	{true, 2, "mov dl, 102"},
+	{true, 4, "and ax, 0xffffffffffffb486"},
+	{true, 5, "and eax, 0x4d4db486"},
+	{true, 7, "xchg dh, byte ptr [rbp+rcx*2+0xffffffffe0b9894d]"},
+	{true, 2, "mov ah, 77"},
+	{false, 2, 0},
+	{true, 7, "mov qword ptr [r9+0x443c5fe0], r15"},
+	{true, 6, "mov dword ptr [rcx+0x443c5fe0], edi"},
+	{true, 5, "mov ecx, 0x443c5fe0"},
+	{true, 2, "loopne 0x0000000000001061"},
+	{true, 1, "pop rdi"},
+	{true, 2, "cmp al, 68"},
+	{false, 2, 0},
+	{true, 2, "xchg sp, ax"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "movq mm1, qword ptr [rdi]"},
+	{true, 1, "outsb"},
+	{true, 6, "jbe 0xfffffffff31a5e46"},
+	{true, 3, "xchg al, byte ptr [rax+78]"},
+	{false, 2, 0},
+	{true, 3, "sbb r14b, bl"},
+	{true, 2, "sbb dh, bl"},
+	{true, 3, "rdmsr"},
+	{true, 2, "rdmsr"},
+	{true, 2, "xor bh, ch"},
+	{true, 1, "std"},
+	{false, 1, 0},
+	{true, 1, "lodsb"},
+	{true, 1, "stc"},
+	{true, 3, "add byte ptr [rcx+112], ch"},
+	{true, 7, "imul esi, dword ptr [rax+101], 0xffffffff88f0f809"},
+	{true, 2, "jo 0x0000000000001067"},
+	{true, 3, "or eax, edi"},
+	{true, 2, "or eax, edi"},
+	{true, 1, "clc"},
+	{true, 4, "lock mov byte ptr [rax+61], al"},
+	{true, 3, "mov byte ptr [rax+61], al"},
+	{true, 6, "cmp eax, 0x700d5aa4"},
+	{true, 5, "cmp eax, 0x700d5aa4"},
+	{true, 1, "movsb"},
+	{true, 1, "pop rdx"},
+	{true, 5, "or eax, 0x00229e70"},
+	{true, 2, "jo 0x0000000000000fa0"},
+	{true, 1, "sahf"},
+	{true, 2, "and al, byte ptr [rax]"},
+	{true, 2, "add byte ptr [rsi], bh"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "insd"},
+	{true, 1, "in eax, dx"},
+	{false, 2, 0},
+	{true, 3, "mov byte ptr [rax+77], cl"},
+	{false, 2, 0},
+	{true, 4, "rcl byte ptr [r14], 1"},
+	{true, 3, "rcl byte ptr [rsi], 1"},
+	{true, 2, "adc al, 102"},
+	{true, 3, "jz 0x000000000000101c"},
+	{true, 2, "jz 0x000000000000101b"},
+	{true, 2, "sbb eax, esi"},
+	{true, 4, "lock cmp ch, dl"},
+	{true, 3, "cmp ch, dl"},
+	{true, 2, "cmp ch, dl"},
+	{false, 1, 0},
+	{true, 1, "stosb"},
+	{true, 2, "sbb al, 38"},
+	{true, 3, "jmpf (invalid)"},
+	{true, 2, "jmpf (invalid)"},
+	{true, 5, "call 0x0000000065b9c111"},
+	{true, 2, "or al, 0xb1"},
+	{true, 2, "mov cl, 0xb9"},
+	{true, 5, "mov ecx, 0x644c9b65"},
+	{true, 2, "wait"},
+	{true, 1, "wait"},
+	{false, 2, 0},
+	{true, 3, "xor esp, dword ptr fs:[rsi]"},
+	{true, 2, "xor esp, dword ptr [rsi]"},
+	{true, 7, "repne enter 0xffffffffffffd897, 0xd5"},
+	{true, 6, "repne enter 0xffffffffffffd897, 0xd5"},
+	{true, 5, "enter 0xffffffffffffd897, 0xd5"},
+	{true, 4, "enter 0xffffffffffffd897, 0xd5"},
+	{true, 1, "xchg edi, eax"},
+	{true, 2, "fcom st(5)"},
+	{false, 1, 0},
+	{true, 1, "scasb"},
+	{false, 2, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "jmp qword ptr [rdi-74]"},
+	{true, 3, "mov dh, 0xb4"},
+	{true, 2, "mov dh, 0xb4"},
+	{true, 2, "mov ah, 72"},
+	{false, 2, 0},
+	{true, 9, "fmul qword ptr cs:[rip+0x7148f661]"},
+	{true, 8, "fmul qword ptr cs:[rip+0x7148f661]"},
+	{true, 7, "fmul qword ptr [rip+0x7148f661]"},
+	{true, 6, "fmul qword ptr [rip+0x7148f661]"},
+	{true, 5, "or eax, 0x7148f661"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 3, "jno 0x000000000000104b"},
+	{true, 2, "jno 0x000000000000104a"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 3, "repne jnbe 0x0000000000000fd5"},
+	{true, 2, "jnbe 0x0000000000000fd4"},
+	{true, 6, "rol byte ptr [rsi+0xffffffffd294f836], cl"},
+	{true, 2, "xchg dh, byte ptr [rsi]"},
+	{true, 2, "clc"},
+	{true, 1, "clc"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "shl byte ptr [rcx-108], cl"},
+	{false, 1, 0},
+	{true, 1, "xchg esp, eax"},
+	{true, 6, "adc bh, byte ptr [rbp+0xffffffffd2a02e6e]"},
+	{true, 5, "mov ebp, 0xffffffffd2a02e6e"},
+	{true, 1, "outsb"},
+	{true, 6, "mov al, byte ptr cs:[0x733536d2]"},
+	{true, 5, "mov al, byte ptr [0x733536d2]"},
+	{true, 2, "sal byte ptr [rsi], cl"},
+	{true, 6, "xor eax, 0xffffffffe43e6673"},
+	{true, 5, "xor eax, 0xffffffffe43e6673"},
+	{true, 2, "jnb 0x0000000000001068"},
+	{true, 4, "in al, 62"},
+	{true, 3, "in al, 62"},
+	{true, 2, "in al, 62"},
+	{true, 6, "add eax, 0x460f9322"},
+	{true, 5, "add eax, 0x460f9322"},
+	{true, 6, "and dl, byte ptr [rbx+0xffffffffdc88460f]"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 7, "cmovb ecx, dword ptr [rax+0xfffffffff3112adc]"},
+	{true, 3, "mov spl, r11b"},
+	{true, 2, "mov ah, bl"},
+	{true, 2, "fsubr qword ptr [rdx]"},
+	{true, 2, "sub dl, byte ptr [rcx]"},
+	{true, 2, "adc ebx, esi"},
+	{true, 7, "rep mov dword ptr [rdi+0x07a3e159], ecx"},
+	{true, 6, "mov dword ptr [rdi+0x07a3e159], ecx"},
+	{false, 2, 0},
+	{true, 1, "pop rcx"},
+	{true, 2, "loope 0x0000000000000fa5"},
+	{true, 5, "mov dword ptr [0x70444d07], eax"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 3, "jo 0x0000000000000fe6"},
+	{true, 2, "jo 0x0000000000000fe5"},
+	{true, 2, "jcez 0x0000000000000fb6"},
+	{true, 2, "mov ah, 65"},
+	{false, 2, 0},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 4, "dec byte ptr [rax+72]"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "ret"},
+	{true, 1, "ret"},
+	{true, 5, "mov al, byte ptr [0xfffffffff8403e64]"},
+	{true, 4, "clc"},
+	{true, 3, "clc"},
+	{true, 2, "clc"},
+	{true, 1, "clc"},
+	{true, 3, "lock bswap edi"},
+	{true, 2, "bswap edi"},
+	{true, 1, "iret"},
+	{true, 1, "leave"},
+	{true, 5, "or eax, 0x1f434f66"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 6, "xor eax, 0x657fb8ef"},
+	{true, 5, "xor eax, 0x657fb8ef"},
+	{true, 1, "out dx, eax"},
+	{true, 5, "mov eax, 0xfffffffff077657f"},
+	{true, 2, "jnle 0x0000000000001067"},
+	{true, 3, "jnbe 0x0000000000000ff3"},
+	{true, 2, "jnbe 0x0000000000000ff2"},
+	{true, 3, "lock mov dh, 0xa5"},
+	{true, 2, "mov dh, 0xa5"},
+	{true, 1, "movsd"},
+	{true, 4, "and dword ptr [esi-40], ah"},
+	{true, 3, "and byte ptr [rsi-40], ah"},
+	{true, 3, "fsub dword ptr [rsi]"},
+	{true, 2, "fsub dword ptr [rsi]"},
+	{true, 3, "js 0x0000000000001044"},
+	{true, 2, "js 0x0000000000001043"},
+	{true, 3, "mov r12b, 0xce"},
+	{true, 2, "mov ah, 0xce"},
+	{false, 1, 0},
+	{true, 1, "clc"},
+	{true, 10, "mov rsi, 0x789f91f0bf8d4066"},
+	{true, 5, "mov esi, 0xffffffffbf8d4066"},
+	{true, 8, "lea di, [rdi+0x789f91f0]"},
+	{true, 7, "lea edi, [rdi+0x789f91f0]"},
+	{true, 6, "lea edi, [rdi+0x789f91f0]"},
+	{true, 5, "mov edi, 0x789f91f0"},
+	{true, 2, "lock xchg ecx, eax"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 1, "lahf"},
+	{true, 2, "js 0x0000000000000f87"},
+	{true, 2, "test ebx, ebx"},
+	{false, 2, 0},
+	{true, 2, "mov al, 0xcb"},
+	{true, 1, "retf"},
+	{false, 1, 0},
+	{true, 5, "mov esp, 0x3e12411c"},
+	{true, 2, "sbb al, 65"},
+	{true, 3, "adc dil, byte ptr [r14]"},
+	{true, 2, "adc bh, byte ptr [rsi]"},
+	{true, 4, "xor cl, byte ptr ds:[rbp]"},
+	{true, 3, "xor cl, byte ptr [rbp]"},
+	{true, 7, "add byte ptr [r9+0x6d644825], r13b"},
+	{true, 6, "add byte ptr [rcx+0x6d644825], ch"},
+	{true, 5, "test eax, 0x6d644825"},
+	{true, 5, "and eax, 0x316d6448"},
+	{false, 2, 0},
+	{true, 2, "insd"},
+	{true, 1, "insd"},
+	{true, 2, "xor ebx, esi"},
+	{true, 5, "psllq mm7, qword ptr [rdi]"},
+	{true, 4, "psllq mm7, qword ptr [rdi]"},
+	{true, 3, "psllq mm7, qword ptr [rdi]"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 2, 0},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 6, "mov byte ptr [0x4c0c6466], al"},
+	{true, 5, "mov byte ptr [0x4c0c6466], al"},
+	{true, 4, "or al, 76"},
+	{true, 3, "or al, 76"},
+	{true, 2, "or al, 76"},
+	{true, 2, "xchg rdx, rax"},
+	{true, 1, "xchg edx, eax"},
+	{true, 3, "and byte ptr [rax-55], cl"},
+	{true, 2, "leave"},
+	{true, 1, "leave"},
+	{true, 1, "out dx, eax"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 5, "shl qword ptr [r14-128], 103"},
+	{true, 4, "shl dword ptr [rsi-128], 103"},
+	{true, 5, "and byte ptr [rdi+16], 54"},
+	{true, 4, "and byte ptr [rdi+16], 54"},
+	{true, 3, "adc dword ptr [esi], dh"},
+	{true, 2, "adc byte ptr [rsi], dh"},
+	{true, 2, "insb"},
+	{true, 1, "insb"},
+	{true, 8, "shufps xmm4, xmmword ptr [rsi+0x41806651], 0xd5"},
+	{false, 2, 0},
+	{true, 1, "cmpsb"},
+	{true, 1, "push rcx"},
+	{true, 5, "add byte ptr [rcx-43], 75"},
+	{true, 4, "add byte ptr [rcx-43], 75"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 3, "cmp eax, esi"},
+	{true, 2, "cmp eax, esi"},
+	{true, 4, "lock xor edi, dword ptr [rdi+64]"},
+	{true, 3, "xor edi, dword ptr [rdi+64]"},
+	{true, 2, "jnle 0x0000000000001042"},
+	{true, 2, "leave"},
+	{true, 1, "leave"},
+	{true, 2, "lock push rbx"},
+	{true, 1, "push rbx"},
+	{true, 1, "iret"},
+	{true, 5, "sub eax, 0xfffffffffd36f02f"},
+	{false, 1, 0},
+	{true, 3, "lock std"},
+	{true, 2, "std"},
+	{true, 1, "std"},
+	{true, 1, "stc"},
+	{true, 1, "xlat"},
+	{true, 2, "sub byte ptr [rdi], ah"},
+	{false, 1, 0},
+	{true, 1, "in eax, dx"},
+	{true, 1, "cdq"},
+	{true, 1, "insb"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "jcez 0x0000000000001034"},
+	{true, 3, "xor ah, byte ptr [rdi+79]"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 4, "and r12, qword ptr [r11-26]"},
+	{true, 3, "and esp, dword ptr [rbx-26]"},
+	{true, 2, "movsxd esp, esi"},
+	{true, 2, "out 106, al"},
+	{true, 2, "push 23"},
+	{false, 1, 0},
+	{true, 1, "cmpsb"},
+	{true, 3, "jnz 0x0000000000000f88"},
+	{true, 2, "jnz 0x0000000000000f87"},
+	{true, 2, "test eax, ebx"},
+	{true, 6, "fsub dword ptr [rax+0x11379b82]"},
+	{true, 5, "mov al, byte ptr [0x11379b82]"},
+	{false, 1, 0},
+	{true, 1, "wait"},
+	{false, 1, 0},
+	{true, 3, "adc dword ptr [rax+68], ecx"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 3, "jno 0x0000000000001043"},
+	{true, 2, "jno 0x0000000000001042"},
+	{true, 3, "jle 0x000000000000103b"},
+	{true, 2, "jle 0x000000000000103a"},
+	{true, 6, "cmp byte ptr [rbx+0x5b1f2e71], dh"},
+	{true, 2, "mov bl, 113"},
+	{true, 2, "jno 0x0000000000001030"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "pop rbx"},
+	{true, 5, "fisttp dword ptr [rdx+rdx*2-66]"},
+	{true, 4, "fisttp dword ptr [rdx+rdx*2-66]"},
+	{true, 2, "push rdx"},
+	{true, 1, "push rdx"},
+	{true, 5, "mov esi, 0x49e54867"},
+	{true, 4, "in rax, 73"},
+	{true, 3, "in rax, 73"},
+	{true, 2, "in eax, 73"},
+	{false, 2, 0},
+	{true, 3, "mov r13b, 0xfb"},
+	{true, 2, "mov ch, 0xfb"},
+	{true, 1, "sti"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 3, "retf"},
+	{true, 2, "retf"},
+	{true, 1, "retf"},
+	{true, 2, "jb 0x000000000000104b"},
+	{true, 2, "int3"},
+	{true, 1, "int3"},
+	{true, 5, "or eax, 0x66be80e7"},
+	{true, 2, "out 0x80, eax"},
+	{true, 7, "cmp byte ptr [rsi+0x56260966], 124"},
+	{true, 5, "mov esi, 0x56260966"},
+	{true, 3, "or word ptr [rsi], sp"},
+	{true, 2, "or dword ptr [rsi], esp"},
+	{true, 2, "push rsi"},
+	{true, 1, "push rsi"},
+	{true, 2, "jl 0x0000000000000f82"},
+	{true, 3, "xor bl, 7"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "std"},
+	{true, 1, "xchg ecx, eax"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "sbb al, 0xa5"},
+	{true, 1, "movsd"},
+	{true, 7, "lea r9, [r9+0x49de7a5a]"},
+	{true, 6, "lea ecx, [rcx+0x49de7a5a]"},
+	{true, 3, "mov dword ptr [rdx+122], ebx"},
+	{true, 1, "pop rdx"},
+	{true, 2, "jp 0x0000000000000fe0"},
+	{true, 3, "fimul word ptr [rcx+77]"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 4, "rep and dword ptr [rax-48], eax"},
+	{true, 3, "and dword ptr [rax-48], eax"},
+	{true, 4, "sal byte ptr [rsi-1], 1"},
+	{true, 3, "sal byte ptr [rsi-1], 1"},
+	{true, 2, "jbe 0x0000000000001001"},
+	{true, 3, "dec dword ptr [rbp+68]"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 5, "adc dword ptr [r13+rdx-101], esp"},
+	{true, 4, "adc dword ptr [rbp+rdx-101], esp"},
+	{true, 6, "adc eax, 0x2667649b"},
+	{true, 5, "adc eax, 0x2667649b"},
+	{true, 1, "wait"},
+	{true, 6, "sbb r15b, dword ptr es:[ebx]"},
+	{true, 5, "sbb r15b, dword ptr es:[ebx]"},
+	{true, 4, "sbb r15b, byte ptr es:[r11]"},
+	{true, 3, "sbb r15b, byte ptr [r11]"},
+	{true, 2, "sbb bh, byte ptr [rbx]"},
+	{true, 2, "cmp edx, dword ptr [rdx]"},
+	{true, 2, "adc dh, byte ptr [rcx]"},
+	{true, 3, "xor dword ptr [rbp-88], ecx"},
+	{true, 3, "test r8b, 6"},
+	{true, 2, "test al, 6"},
+	{false, 1, 0},
+	{true, 5, "mov ebp, 0x644ff649"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 6, "or eax, 0xfffffffffa496736"},
+	{true, 5, "or eax, 0xfffffffffa496736"},
+	{true, 4, "cli"},
+	{true, 3, "cli"},
+	{true, 2, "cli"},
+	{true, 1, "cli"},
+	{true, 3, "rcr byte ptr [rbx+15], cl"},
+	{true, 1, "pop rbx"},
+	{false, 2, 0},
+	{true, 2, "and al, 88"},
+	{true, 1, "pop rax"},
+	{true, 2, "adc ecx, edi"},
+	{true, 1, "iret"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 6, "or eax, 0x48be1565"},
+	{true, 5, "or eax, 0x48be1565"},
+	{true, 6, "adc eax, 0xffffffffbb7848be"},
+	{true, 5, "adc eax, 0xffffffffbb7848be"},
+	{true, 5, "mov esi, 0x48bb7848"},
+	{true, 3, "js 0x0000000000000fbe"},
+	{true, 2, "js 0x0000000000000fbd"},
+	{true, 5, "mov ebx, 0x08464148"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 4, "or byte ptr [rcx+109], r9b"},
+	{true, 3, "or byte ptr [rcx+109], cl"},
+	{false, 2, 0},
+	{true, 1, "insd"},
+	{true, 6, "repne jmp 0x000000007333de32"},
+	{true, 5, "jmp 0x000000007333de31"},
+	{true, 2, "sub al, 0xce"},
+	{false, 1, 0},
+	{true, 3, "xor esi, dword ptr [rbx+65]"},
+	{true, 2, "jnb 0x0000000000001043"},
+	{true, 7, "mov byte ptr [rip+0x4c3c653b], bl"},
+	{true, 6, "mov byte ptr [rip+0x4c3c653b], bl"},
+	{true, 5, "sbb eax, 0x4c3c653b"},
+	{true, 3, "cmp esp, dword ptr [rbp+60]"},
+	{true, 3, "cmp al, 76"},
+	{true, 2, "cmp al, 76"},
+	{true, 2, "lodsq"},
+	{true, 1, "lodsd"},
+	{true, 1, "xchg edi, eax"},
+	{true, 2, "jno 0x0000000000000fc4"},
+	{true, 3, "ret 0xffffffffffff9144"},
+	{true, 2, "xchg ecx, eax"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 5, "push 0x660fbd6e"},
+	{true, 1, "outsb"},
+	{true, 5, "mov ebp, 0x35f2660f"},
+	{true, 3, "pcmpgtd mm6, mm2"},
+	{true, 5, "repne xor ax, 0x67e8"},
+	{true, 6, "repne xor eax, 0x64df67e8"},
+	{true, 5, "xor eax, 0x64df67e8"},
+	{true, 5, "call 0x000000001c64ef6c"},
+	{true, 5, "fbld dword ptr [esp+ebx-13]"},
+	{true, 4, "fbld tbyte ptr [rsp+rbx-13]"},
+	{true, 3, "sbb al, 0xf3"},
+	{true, 2, "sbb al, 0xf3"},
+	{true, 3, "rep mov al, 0xbf"},
+	{true, 2, "mov al, 0xbf"},
+	{true, 5, "mov edi, 0xfffffffff3b26365"},
+	{true, 7, "movsxd esi, dword ptr gs:[rdx+0xffffffffb4643ef3]"},
+	{true, 6, "movsxd esi, dword ptr [rdx+0xffffffffb4643ef3]"},
+	{true, 2, "mov dl, 0xf3"},
+	{true, 5, "rep mov ah, 0xf2"},
+	{true, 4, "mov ah, 0xf2"},
+	{true, 3, "mov ah, 0xf2"},
+	{true, 2, "mov ah, 0xf2"},
+	{true, 5, "repne enter 0x4980, 0xce"},
+	{true, 4, "enter 0x4980, 0xce"},
+	{true, 4, "or byte ptr [rcx-50], 106"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "push 0xf2"},
+	{true, 5, "repne imul ebx, dword ptr [rdi+rcx*2], 0xb6"},
+	{true, 4, "imul ebx, dword ptr [rdi+rcx*2], 0xb6"},
+	{true, 2, "sbb al, 79"},
+	{true, 3, "mov r14b, 0xfc"},
+	{true, 2, "mov dh, 0xfc"},
+	{true, 1, "cld"},
+	{true, 5, "mov esi, 0xffffffffac08a126"},
+	{true, 6, "mov eax, dword ptr es:[0xffffffffb7c7ac08]"},
+	{true, 5, "mov eax, dword ptr [0xffffffffb7c7ac08]"},
+	{true, 7, "or byte ptr [rdi+rax*8+0x4485eeb7], ch"},
+	{true, 1, "lodsb"},
+	{false, 2, 0},
+	{true, 2, "mov bh, 0xee"},
+	{true, 1, "out dx, al"},
+	{true, 4, "test dword ptr [rsp+rax*2+86], eax"},
+	{false, 2, 0},
+	{true, 2, "push rsi"},
+	{true, 1, "push rsi"},
+	{false, 1, 0},
+	{true, 3, "clc"},
+	{true, 2, "clc"},
+	{true, 1, "clc"},
+	{true, 5, "mov eax, dword ptr [0xffffffff8d1dd640]"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 5, "sbb eax, 0xffffffffc4ac2c8d"},
+	{true, 3, "lea ebp, [rsp+rbp*4]"},
+	{true, 2, "sub al, 0xac"},
+	{true, 1, "lodsb"},
+	{false, 1, 0},
+	{true, 3, "movsxd ecx, dword ptr [rbp-47]"},
+	{true, 7, "rol qword ptr [r8+0x04754435], 1"},
+	{true, 6, "rol dword ptr [rax+0x04754435], 1"},
+	{true, 7, "xor byte ptr [rip+0xffffffffc8047544], 0xab"},
+	{true, 5, "xor eax, 0xffffffffc8047544"},
+	{true, 3, "jnz 0x0000000000001007"},
+	{true, 2, "jnz 0x0000000000001006"},
+	{true, 2, "add al, 0xc8"},
+	{true, 4, "enter 0xffffffffffffbbab, 92"},
+	{true, 1, "stosd"},
+	{true, 5, "mov ebx, 0x496daf5c"},
+	{true, 1, "pop rsp"},
+	{true, 1, "scasd"},
+	{true, 1, "insd"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 3, "xor byte ptr cs:[rdi], cl"},
+	{true, 2, "xor byte ptr [rdi], cl"},
+	{false, 2, 0},
+	{true, 2, "and al, 46"},
+	{true, 4, "add byte ptr cs:[rax], ch"},
+	{true, 3, "add byte ptr [rax], ch"},
+	{true, 2, "sub al, 32"},
+	{true, 2, "and bl, bl"},
+	{false, 2, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 5, "adc byte ptr es:[rbx], 72"},
+	{true, 4, "adc byte ptr [rbx], 72"},
+	{true, 3, "adc byte ptr [rbx], 72"},
+	{true, 3, "adc ecx, dword ptr [rax-120]"},
+	{true, 7, "mov byte ptr [rbp+0x226c5c46], bpl"},
+	{true, 6, "mov byte ptr [rbp+0x226c5c46], ch"},
+	{true, 1, "lodsd"},
+	{true, 2, "pop rsp"},
+	{true, 1, "pop rsp"},
+	{true, 1, "insb"},
+	{true, 6, "and ch, byte ptr [rip+0x6c114864]"},
+	{true, 5, "sub eax, 0x6c114864"},
+	{true, 6, "adc qword ptr fs:[rsp+rcx*8+80], rbp"},
+	{true, 5, "adc qword ptr [rsp+rcx*8+80], rbp"},
+	{true, 4, "adc dword ptr [rsp+rcx*8+80], ebp"},
+	{true, 1, "insb"},
+	{true, 1, "int3"},
+	{true, 1, "push rax"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 2, "xor bh, ch"},
+	{true, 1, "out dx, eax"},
+	{true, 3, "jz 0x0000000000001052"},
+	{true, 2, "jz 0x0000000000001051"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 2, "int3"},
+	{true, 1, "int3"},
+	{true, 4, "fidivr dword ptr gs:[rsi-86]"},
+	{true, 3, "fidivr dword ptr [rsi-86]"},
+	{true, 2, "jle 0x0000000000000fac"},
+	{true, 1, "stosb"},
+	{true, 1, "iret"},
+	{true, 5, "mov ecx, 0x247fa3f7"},
+	{true, 6, "mul dword ptr [rbx+0x642e247f]"},
+	{true, 5, "mov dword ptr [0x642e247f], eax"},
+	{true, 2, "jnle 0x0000000000001026"},
+	{true, 2, "and al, 46"},
+	{true, 5, "cmp r8b, 28"},
+	{true, 4, "cmp r8b, 28"},
+	{true, 3, "cmp r8b, 28"},
+	{true, 2, "cmp al, 28"},
+	{true, 2, "sbb al, 0xab"},
+	{true, 1, "stosd"},
+	{true, 2, "and al, 0xf3"},
+	{true, 6, "rep cmp eax, 0x4811e690"},
+	{true, 5, "cmp eax, 0x4811e690"},
+	{true, 1, "nop"},
+	{true, 2, "out 17, al"},
+	{true, 3, "adc dword ptr [rax+77], ecx"},
+	{false, 2, 0},
+	{true, 6, "sbb r8, 0x3ede78c5"},
+	{true, 5, "sbb eax, 0x3ede78c5"},
+	{false, 1, 0},
+	{true, 2, "js 0x0000000000000fe0"},
+	{true, 2, "fidivr word ptr [rsi]"},
+	{true, 3, "sal esp, cl"},
+	{true, 2, "sal esp, cl"},
+	{true, 1, "hlt"},
+	{true, 3, "jz 0x000000000000104e"},
+	{true, 2, "jz 0x000000000000104d"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "sti"},
+	{true, 1, "sti"},
+	{true, 5, "adc eax, 0xffffffffd4446656"},
+	{true, 1, "push rsi"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 6, "add byte ptr [rip+0x2e784068], cl"},
+	{true, 5, "or eax, 0x2e784068"},
+	{true, 5, "push 0x4f2e7840"},
+	{true, 3, "js 0x0000000000001031"},
+	{true, 2, "js 0x0000000000001030"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 2, "movsd"},
+	{true, 1, "movsd"},
+	{true, 6, "mov ebp, 0x7d3d4179"},
+	{true, 5, "mov ebp, 0x7d3d4179"},
+	{true, 2, "jns 0x0000000000001043"},
+	{true, 6, "cmp r8d, 0x6c3c1e7d"},
+	{true, 5, "cmp eax, 0x6c3c1e7d"},
+	{true, 2, "jnl 0x0000000000001020"},
+	{false, 1, 0},
+	{true, 2, "cmp al, 108"},
+	{true, 1, "insb"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 1, "lahf"},
+	{true, 4, "xor dword ptr [rax+2], 0xab"},
+	{true, 2, "jo 0x0000000000001004"},
+	{true, 6, "add ch, byte ptr [rbx+0xffffffffecdd4452]"},
+	{true, 1, "stosd"},
+	{true, 1, "push rdx"},
+	{true, 3, "fucomp st(4)"},
+	{true, 2, "fucomp st(4)"},
+	{true, 1, "in al, dx"},
+	{true, 1, "pop rbx"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "lodsw"},
+	{true, 1, "lodsd"},
+	{true, 2, "out 0xd6, al"},
+	{false, 1, 0},
+	{true, 1, "pop rdi"},
+	{true, 3, "cmp r14b, dl"},
+	{true, 2, "cmp dh, dl"},
+	{true, 3, "repne add edi, dword ptr [rdx]"},
+	{true, 2, "add edi, dword ptr [rdx]"},
+	{true, 3, "cmp dl, byte ptr [rbx+rcx*8]"},
+	{true, 2, "adc al, 0xcb"},
+	{true, 1, "retf"},
+	{true, 1, "pop rax"},
+	{true, 3, "pop r13"},
+	{true, 2, "pop r13"},
+	{true, 1, "pop rbp"},
+	{true, 8, "test eax, 0xffffffffe7ce617b"},
+	{true, 7, "test eax, 0xffffffffe7ce617b"},
+	{true, 6, "test eax, 0xffffffffe7ce617b"},
+	{true, 5, "test eax, 0xffffffffe7ce617b"},
+	{true, 2, "jnp 0x0000000000001063"},
+	{false, 1, 0},
+	{false, 1, 0},
+	{true, 2, "out 0xd5, eax"},
+	{false, 1, 0},
+	{true, 3, "sbb al, 0xaa"},
+	{true, 2, "sbb al, 0xaa"},
+	{true, 1, "stosb"},
+	{false, 1, 0},
+	{true, 1, "push rdi"},
+	{true, 6, "add qword ptr ds:[rsi+r14], rcx"},
+	{true, 5, "add qword ptr ds:[rsi+r14], rcx"},
+	{true, 4, "add qword ptr [rsi+r14], rcx"},
+	{true, 3, "add dword ptr [rsi+rsi], ecx"},
+	{true, 2, "or al, 54"},
+	{true, 2, "pop rsp"},
+	{true, 1, "pop rsp"},
+	{true, 5, "sbb eax, 0xffffffff9d675873"},
+	{true, 2, "jnb 0x000000000000105a"},
+	{true, 1, "pop rax"},
+	{true, 2, "popfd"},
+	{true, 1, "popfd"},
+	{false, 2, 0},
+	{true, 4, "lock adc dword ptr [rsi+rbp], ebx"},
+	{true, 3, "adc dword ptr [rsi+rbp], ebx"},
+	{true, 2, "sbb al, 46"},
+	{true, 6, "jmp 0xffffffffd51003f6"},
+	{true, 5, "jmp 0xffffffffd51003f5"},
+	{true, 9, "pmullw mm3, qword ptr [rsi+0x6f0522c2]"},
+	{true, 8, "pmullw mm3, qword ptr [rsi+0x6f0522c2]"},
+	{true, 7, "pmullw mm3, qword ptr [rsi+0x6f0522c2]"},
+	{false, 1, 0},
+	{true, 1, "sahf"},
+	{true, 3, "ret 0x0522"},
+	{true, 6, "and al, byte ptr [rip+0xfffffffff250266f]"},
+	{true, 5, "add eax, 0xfffffffff250266f"},
+	{true, 1, "outsd"},
+	{true, 2, "push rax"},
+	{true, 1, "push rax"},
+	{true, 5, "repne and qword ptr gs:[r15], r11"},
+	{true, 4, "and qword ptr gs:[r15], r11"},
+	{true, 3, "and qword ptr [r15], r11"},
+	{true, 2, "and dword ptr [rdi], ebx"},
+	{false, 1, 0},
+	{true, 5, "mov ecx, 0x0bb991b9"},
+	{true, 5, "mov ecx, 0x230bb991"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 5, "mov ecx, 0x4884230b"},
+	{true, 2, "or esp, dword ptr [rbx]"},
+	{true, 7, "and eax, dword ptr [rax+rcx*2+0xfffffffff34c412e]"},
+	{true, 3, "test byte ptr [rax+46], cl"},
+	{false, 2, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 5, "movsx ecx, word ptr [rcx+17]"},
+	{true, 4, "movsx ecx, word ptr [rcx+17]"},
+	{true, 5, "mov edi, 0x65511149"},
+	{true, 4, "adc qword ptr [r9+101], rdx"},
+	{true, 3, "adc dword ptr [rcx+101], edx"},
+	{true, 1, "push rcx"},
+	{true, 6, "sub eax, 0x0f849e49"},
+	{true, 5, "sub eax, 0x0f849e49"},
+	{true, 2, "sahf"},
+	{true, 1, "sahf"},
+	{true, 2, "test byte ptr [rdi], cl"},
+	{true, 4, "punpckhdq mm5, dword ptr [rdi-68]"},
+	{true, 2, "push 111"},
+	{true, 1, "outsd"},
+	{true, 5, "mov esp, 0x25d64d97"},
+	{true, 1, "xchg edi, eax"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 5, "and eax, 0x546781d0"},
+	{true, 6, "rol byte ptr [rcx+0x021a5467], 1"},
+	{true, 7, "and dword ptr [rdi+84], 0x663e021a"},
+	{true, 2, "push rsp"},
+	{true, 1, "push rsp"},
+	{true, 2, "sbb al, byte ptr [rdx]"},
+	{true, 2, "add bh, byte ptr [rsi]"},
+	{true, 4, "jnz 0x0000000000000fa9"},
+	{true, 3, "jnz 0x0000000000000fa8"},
+	{true, 2, "jnz 0x0000000000000fa7"},
+	{true, 1, "movsd"},
+	{true, 2, "jz 0x0000000000001038"},
+	{true, 2, "retf"},
+	{true, 1, "retf"},
+	{true, 1, "movsb"},
+	{true, 5, "jmp 0x000000003df31f07"},
+	{true, 2, "add cl, byte ptr [rdi]"},
+	{true, 7, "psllq mm7, qword ptr [rip+0x12934f88]"},
+	{true, 6, "rep cmp eax, 0x12934f88"},
+	{true, 5, "cmp eax, 0x12934f88"},
+	{true, 3, "mov byte ptr [rdi-109], cl"},
+	{true, 2, "xchg r11, rax"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 6, "adc al, byte ptr [rsi+0x36cb23c5]"},
+	{true, 2, "xchg al, ch"},
+	{false, 1, 0},
+	{true, 2, "and ecx, ebx"},
+	{true, 1, "retf"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 2, "sub byte ptr [rbx], dh"},
+	{true, 2, "xor ebx, dword ptr [rdx]"},
+	{true, 7, "sbb dl, byte ptr [rsi+rbx+0xffffffffd8c44e49]"},
+	{true, 1, "xchg esp, eax"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "fcomp st(6)"},
+	{true, 3, "fimul word ptr [rbx-2]"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "out 0xed, eax"},
+	{true, 1, "in eax, dx"},
+	{true, 1, "push rcx"},
+	{true, 2, "mov ah, 3"},
+	{true, 6, "add esi, dword ptr [rcx+0xfffffffffef3f54d]"},
+	{true, 2, "mov cl, 77"},
+	{true, 2, "cmc"},
+	{true, 1, "cmc"},
+	{true, 7, "rep inc byte ptr [rdx+0x3f20a58f]"},
+	{true, 6, "inc byte ptr [rdx+0x3f20a58f]"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 1, "movsd"},
+	{true, 2, "and byte ptr [rdi], bh"},
+	{false, 1, 0},
+	{true, 2, "jns 0x0000000000000fb0"},
+	{true, 1, "scasb"},
+	{true, 1, "cmc"},
+	{false, 1, 0},
+	{true, 2, "loope 0x0000000000001030"},
+	{true, 7, "and eax, 0xffffffffabd22a81"},
+	{true, 6, "and eax, 0xffffffffabd22a81"},
+	{true, 5, "and eax, 0xffffffffabd22a81"},
+	{true, 6, "sub dword ptr [rdx], 0x4f22abd2"},
+	{true, 2, "sub dl, dl"},
+	{true, 6, "shr byte ptr [rbx+0x4c0c4f22], cl"},
+	{true, 1, "stosd"},
+	{true, 3, "and cl, byte ptr [rdi+12]"},
+	{true, 3, "or r8b, 76"},
+	{true, 2, "or al, 76"},
+	{false, 2, 0},
+	{true, 9, "and qword ptr ss:[r15+65], 0xffffffffb037f8e0"},
+	{true, 8, "and qword ptr [r15+65], 0xffffffffb037f8e0"},
+	{true, 7, "and dword ptr [rdi+65], 0xffffffffb037f8e0"},
+	{true, 4, "loopne 0x0000000000000ffc"},
+	{true, 3, "loopne 0x0000000000000ffb"},
+	{true, 2, "loopne 0x0000000000000ffa"},
+	{true, 1, "clc"},
+	{false, 1, 0},
+	{true, 2, "mov al, 100"},
+	{true, 3, "cmp byte ptr fs:[rsi], dh"},
+	{true, 2, "cmp byte ptr [rsi], dh"},
+	{true, 2, "lodsb"},
+	{true, 1, "lodsb"},
+	{true, 3, "mov r12, rcx"},
+	{true, 2, "mov esp, ecx"},
+	{true, 1, "int3"},
+	{true, 1, "outsd"},
+	{true, 4, "enter 0xffffffffffffc6d8, 79"},
+	{true, 2, "fadd st, st(6)"},
+	{false, 2, 0},
+	{true, 3, "mov r12b, 0x99"},
+	{true, 2, "mov ah, 0x99"},
+	{true, 1, "cdq"},
+	{true, 6, "add ah, byte ptr [rdx+0x0f0f4d65]"},
+	{true, 5, "mov byte ptr [0x0f0f4d65], al"},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 7, "cmovnle edi, dword ptr [rsi+0x364a14db]"},
+	{true, 10, "mov r14, 0x4d673541364a14db"},
+	{true, 5, "mov esi, 0x364a14db"},
+	{true, 3, "fist dword ptr [rdx+rcx*2]"},
+	{true, 2, "adc al, 74"},
+	{false, 2, 0},
+	{true, 7, "xor r8d, 0xffffffffa4d74d67"},
+	{true, 6, "xor r8d, 0xffffffffa4d74d67"},
+	{true, 5, "xor eax, 0xffffffffa4d74d67"},
+	{true, 3, "xlat"},
+	{true, 2, "xlat"},
+	{true, 1, "xlat"},
+	{true, 1, "movsb"},
+	{true, 2, "add ah, bl"},
+	{true, 4, "fsub qword ptr [rsi+rsi+64]"},
+	{true, 5, "xchg dl, dil"},
+	{true, 4, "xchg dl, dil"},
+	{true, 3, "xchg dl, dil"},
+	{true, 2, "xchg dl, bh"},
+	{true, 1, "xlat"},
+	{true, 5, "mov dword ptr [0xffffffffdf4c664c], eax"},
+	{false, 2, 0},
+	{true, 5, "fbld tbyte ptr [rbx+90]"},
+	{true, 4, "fbld tbyte ptr [rbx+90]"},
+	{true, 3, "fbld tbyte ptr [rbx+90]"},
+	{true, 3, "movsxd ebx, dword ptr [rdx-7]"},
+	{true, 1, "pop rdx"},
+	{true, 1, "stc"},
+	{true, 3, "jb 0x0000000000001067"},
+	{true, 2, "jb 0x0000000000001066"},
+	{true, 2, "movsb"},
+	{true, 1, "movsb"},
+	{true, 2, "jmp 0x0000000000001030"},
+	{true, 6, "push 0x64f0b37b"},
+	{true, 5, "push 0x64f0b37b"},
+	{true, 2, "jnp 0x0000000000000fb5"},
+	{true, 2, "mov bl, 0xf0"},
+	{true, 4, "lock xchg r15, rax"},
+	{true, 3, "xchg r15, rax"},
+	{true, 2, "xchg r15, rax"},
+	{true, 1, "xchg edi, eax"},
+	{true, 1, "movsd"},
+	{true, 2, "cdq"},
+	{true, 1, "cdq"},
+	{false, 1, 0},
+	{true, 1, "sahf"},
+	{true, 7, "adc byte ptr [rdi+rcx*2+0x0b649d4f], dh"},
+	{true, 2, "mov ah, 79"},
+	{false, 2, 0},
+	{true, 2, "popfq"},
+	{true, 1, "popfd"},
+	{true, 4, "or ecx, dword ptr fs:[rax+77]"},
+	{true, 3, "or ecx, dword ptr [rax+77]"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{true, 3, "rcr cl, 1"},
+	{true, 2, "rcr cl, 1"},
+	{true, 2, "fxch st(7)"},
+	{true, 1, "iret"},
+	{true, 3, "fld dword ptr [rax-16]"},
+	{false, 2, 0},
+	{true, 6, "lock mov ebp, 0x4f589611"},
+	{true, 5, "mov ebp, 0x4f589611"},
+	{true, 6, "adc dword ptr [rsi+0xffffffffa24f4f58], edx"},
+	{true, 1, "xchg esi, eax"},
+	{true, 1, "pop rax"},
+	{false, 2, 0},
+	{true, 6, "mov byte ptr [0x2d6e44f5], al"},
+	{true, 5, "mov byte ptr [0x2d6e44f5], al"},
+	{true, 1, "cmc"},
+	{true, 2, "outsb"},
+	{true, 1, "outsb"},
+	{true, 5, "sub eax, 0x0dca2e4d"},
+	{false, 2, 0},
+	{true, 4, "retf 0xfffffffffffff30d"},
+	{true, 3, "retf 0xfffffffffffff30d"},
+	{true, 5, "or eax, 0xffffffff992a4cf3"},
+	{true, 8, "rep sub r11b, byte ptr [rcx+0x66674c9f]"},
+	{true, 7, "sub r11b, byte ptr [rcx+0x66674c9f]"},
+	{true, 6, "sub bl, byte ptr [rcx+0x66674c9f]"},
+	{true, 1, "cdq"},
+	{true, 1, "lahf"},
+	{false, 2, 0},
+	{true, 5, "sbb al, 97"},
+	{true, 4, "sbb al, 97"},
+	{true, 3, "sbb al, 97"},
+	{true, 2, "sbb al, 97"},
+	{false, 1, 0},
+	{true, 7, "xor byte ptr [rbx+0x1c910f3d], 0xff"},
+	{true, 2, "mov bl, 61"},
+	{true, 5, "cmp eax, 0xffffffffff1c910f"},
+	{true, 4, "setno byte ptr [rdi+rdi*8]"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "sbb al, 0xff"},
+	{true, 3, "jmp qword ptr [rbp-115]"},
+	{true, 3, "lea esp, gs:[rdi]"},
+	{true, 2, "lea esp, [rdi]"},
+	{false, 1, 0},
+	{true, 5, "mov eax, 0x3d0155e4"},
+	{true, 2, "in al, 85"},
+	{true, 1, "push rbp"},
+	{true, 6, "add dword ptr [rip+0xfffffffffa42cd76], edi"},
+	{true, 5, "cmp eax, 0xfffffffffa42cd76"},
+	{true, 2, "jbe 0x0000000000000fcf"},
+	{true, 2, "int 66"},
+	{true, 2, "cli"},
+	{true, 1, "cli"},
+	{true, 5, "mov eax, 0xfffffffff6bdfeee"},
+	{true, 1, "out dx, al"},
+	{false, 2, 0},
+	{true, 5, "mov ebp, 0x32530ef6"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "push rbx"},
+	{true, 3, "xor bh, byte ptr [rsi+80]"},
+	{true, 2, "jle 0x0000000000001052"},
+	{true, 1, "push rax"},
+	{true, 1, "pop rdx"},
+	{true, 4, "psllq mm0, qword ptr [rbp-111]"},
+	{true, 3, "rep xchg r9d, eax"},
+	{true, 2, "xchg r9d, eax"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "jmp 0x0000000000000f8b"},
+	{true, 2, "mov dword ptr [rsi], esp"},
+	{true, 3, "mov cl, 0xcf"},
+	{true, 2, "mov cl, 0xcf"},
+	{true, 1, "iret"},
+	{true, 2, "xor al, 0xe7"},
+	{true, 2, "out 64, eax"},
+	{true, 5, "imul esp, dword ptr [rsi+68], 0xd9"},
+	{true, 4, "imul esp, dword ptr [rsi+68], 0xd9"},
+	{true, 8, "fld dword ptr [rip+0x122c4c4d]"},
+	{true, 7, "fld dword ptr [rip+0x122c4c4d]"},
+	{true, 6, "fld dword ptr [rip+0x122c4c4d]"},
+	{true, 5, "add eax, 0x122c4c4d"},
+	{false, 2, 0},
+	{true, 3, "sub al, 18"},
+	{true, 2, "sub al, 18"},
+	{true, 6, "adc dh, byte ptr [rdx+0x653ebde0]"},
+	{true, 2, "mov dl, 0xe0"},
+	{true, 2, "loopne 0x0000000000000fbf"},
+	{true, 5, "mov ebp, 0x5811653e"},
+	{true, 5, "adc dword ptr gs:[rax-68], ebx"},
+	{true, 4, "adc dword ptr gs:[rax-68], ebx"},
+	{true, 3, "adc dword ptr [rax-68], ebx"},
+	{true, 1, "pop rax"},
+	{true, 5, "mov esp, 0x453f1865"},
+	{true, 3, "sbb byte ptr gs:[rdi], bh"},
+	{true, 2, "sbb byte ptr [rdi], bh"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 3, "jnz 0x0000000000001012"},
+	{true, 2, "jnz 0x0000000000001011"},
+	{true, 3, "nop ebp"},
+	{false, 1, 0},
+	{true, 1, "cmc"},
+	{true, 3, "sbb esp, edx"},
+	{true, 2, "sbb esp, edx"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 7, "sub qword ptr [rip+0xffffffffa3bb408d], r13"},
+	{true, 6, "sub dword ptr [rip+0xffffffffa3bb408d], ebp"},
+	{true, 5, "sub eax, 0xffffffffa3bb408d"},
+	{true, 3, "lea eax, [rax-69]"},
+	{true, 6, "mov ebx, 0xffffffffa66667a3"},
+	{true, 5, "mov ebx, 0xffffffffa66667a3"},
+	{true, 5, "mov dword ptr [0x73a66667], eax"},
+	{true, 3, "cmpsb"},
+	{true, 2, "cmpsb"},
+	{true, 1, "cmpsb"},
+	{true, 2, "jnb 0x0000000000001006"},
+	{true, 2, "add al, 24"},
+	{true, 6, "sbb byte ptr [rip+0xffffffff8d644470], ch"},
+	{true, 5, "sub eax, 0xffffffff8d644470"},
+	{true, 2, "jo 0x0000000000001046"},
+	{false, 2, 0},
+	{true, 4, "lea edi, fs:[rax+104]"},
+	{true, 3, "lea edi, [rax+104]"},
+	{true, 2, "js 0x000000000000106a"},
+	{true, 5, "push 0xfffffffff2a4f3ed"},
+	{true, 1, "in eax, dx"},
+	{true, 2, "rep movsb"},
+	{true, 1, "movsb"},
+	{true, 3, "repne int3"},
+	{true, 2, "int3"},
+	{true, 1, "int3"},
+	{false, 2, 0},
+	{true, 8, "rep sal qword ptr [r11+0x4c18f248], 1"},
+	{true, 7, "sal qword ptr [r11+0x4c18f248], 1"},
+	{true, 6, "sal dword ptr [rbx+0x4c18f248], 1"},
+	{true, 2, "mov bl, 72"},
+	{false, 2, 0},
+	{true, 5, "repne sbb byte ptr [rax+rax*2-86], cl"},
+	{true, 4, "sbb byte ptr [rax+rax*2-86], cl"},
+	{false, 2, 0},
+	{true, 2, "stosb"},
+	{true, 1, "stosb"},
+	{false, 2, 0},
+	{true, 6, "mov dword ptr cs:[0xfffffffffe0f6667], eax"},
+	{true, 5, "mov dword ptr [0xfffffffffe0f6667], eax"},
+	{true, 5, "paddd xmm1, xmm5"},
+	{true, 4, "paddd xmm1, xmm5"},
+	{true, 3, "paddd mm1, mm5"},
+	{true, 2, "dec ch"},
+	{true, 2, "int 77"},
+	{true, 2, "stosb"},
+	{true, 1, "stosb"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "iret"},
+	{true, 1, "in al, dx"},
+	{true, 2, "ret"},
+	{true, 1, "ret"},
+	{true, 4, "and eax, dword ptr [rax+rcx*8+65]"},
+	{true, 5, "enter 0x6641, 48"},
+	{true, 4, "enter 0x6641, 48"},
+	{false, 2, 0},
+	{true, 3, "xor ah, bh"},
+	{true, 2, "xor ah, bh"},
+	{true, 1, "cld"},
+	{true, 1, "stc"},
+	{true, 1, "pop rax"},
+	{true, 2, "bswap esi"},
+	{false, 1, 0},
+	{true, 5, "sbb eax, 0x0ee4f724"},
+	{true, 2, "and al, 0xf7"},
+	{true, 2, "mul esp"},
+	{true, 2, "in al, 14"},
+	{false, 1, 0},
+	{true, 1, "xchg esi, eax"},
+	{true, 1, "clc"},
+	{true, 2, "jnl 0x0000000000001038"},
+	{true, 4, "shl dword ptr ss:[rdi], 0xed"},
+	{true, 3, "shl dword ptr [rdi], 0xed"},
+	{false, 1, 0},
+	{true, 1, "in eax, dx"},
+	{true, 2, "xor al, 27"},
+	{true, 3, "sbb ebx, dword ptr [rax+14]"},
+	{true, 1, "pop rax"},
+	{false, 1, 0},
+	{true, 2, "cld"},
+	{true, 1, "cld"},
+	{true, 2, "pushfq"},
+	{true, 1, "pushfd"},
+	{false, 2, 0},
+	{true, 3, "jz 0x0000000000000f8b"},
+	{true, 2, "jz 0x0000000000000f8a"},
+	{true, 3, "mov byte ptr [rbp+123], ah"},
+	{true, 3, "jnp 0x0000000000001031"},
+	{true, 2, "jnp 0x0000000000001030"},
+	{true, 7, "xor ebx, dword ptr cs:[rsi+0xffffffffdca1982c]"},
+	{true, 6, "xor ebx, dword ptr [rsi+0xffffffffdca1982c]"},
+	{true, 1, "sahf"},
+	{true, 2, "sub al, 0x98"},
+	{true, 1, "cwde"},
+	{true, 5, "mov eax, dword ptr [0xffffffff940b3edc]"},
+	{true, 2, "fdivr qword ptr [rsi]"},
+	{true, 8, "or edx, dword ptr ds:[rbp+rax*4+0xffffffffc03e260a]"},
+	{true, 7, "or edx, dword ptr [rbp+rax*4+0xffffffffc03e260a]"},
+	{true, 1, "xchg esp, eax"},
+	{true, 2, "test dword ptr [rdx], ecx"},
+	{true, 2, "or ah, byte ptr [rsi]"},
+	{true, 9, "rcr byte ptr ds:[rdi+0xffffffff94842006], 38"},
+	{true, 8, "rcr byte ptr ds:[rdi+0xffffffff94842006], 38"},
+	{true, 7, "rcr byte ptr [rdi+0xffffffff94842006], 38"},
+	{true, 1, "lahf"},
+	{false, 1, 0},
+	{true, 7, "and byte ptr [rsp+rdx*4+0xfffffffff35af226], al"},
+	{true, 7, "test byte ptr [rsi+0x15f35af2], dl"},
+	{true, 1, "xchg esp, eax"},
+	{true, 3, "repne pop rdx"},
+	{true, 2, "repne pop rdx"},
+	{true, 1, "pop rdx"},
+	{true, 6, "rep adc eax, 0xffffffffb21b4ef3"},
+	{true, 5, "adc eax, 0xffffffffb21b4ef3"},
+	{true, 8, "rep sbb r14, qword ptr [rdx+0xffffffff9fa9174f]"},
+	{true, 7, "sbb r14, qword ptr [rdx+0xffffffff9fa9174f]"},
+	{true, 6, "sbb esi, dword ptr [rdx+0xffffffff9fa9174f]"},
+	{true, 2, "mov dl, 79"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 5, "test eax, 0xffffffffca4f419f"},
+	{true, 1, "lahf"},
+	{false, 2, 0},
+	{true, 4, "retf 0x66eb"},
+	{true, 3, "retf 0x66eb"},
+	{true, 2, "jmp 0x0000000000001068"},
+	{true, 4, "imul cx, word ptr [rcx], 54"},
+	{true, 3, "imul ecx, dword ptr [rcx], 54"},
+	{true, 2, "or dword ptr [rsi], esi"},
+	{true, 2, "pop rdx"},
+	{true, 1, "pop rdx"},
+	{true, 8, "sub dword ptr cs:[rbp+54], 0xffffffffe3458429"},
+	{true, 7, "sub dword ptr [rbp+54], 0xffffffffe3458429"},
+	{true, 1, "insd"},
+	{true, 8, "sub dword ptr ss:[rbp+rax*2+0x6767f3e3], eax"},
+	{true, 7, "sub dword ptr [rbp+rax*2+0x6767f3e3], eax"},
+	{true, 3, "test byte ptr [rbp-29], al"},
+	{true, 3, "jcez 0x0000000000000ff6"},
+	{true, 2, "jcez 0x0000000000000ff5"},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 5, "jmp 0xffffffffef8c5d96"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 3, "mov r15, cr5"},
+	{true, 2, "mov edi, gs"},
+	{true, 1, "out dx, eax"},
+	{true, 1, "pop rdx"},
+	{true, 2, "push r9"},
+	{true, 1, "push rcx"},
+	{true, 7, "lea ecx, dword ptr [ecx+0x40b1650e]"},
+	{true, 6, "lea ecx, [rcx+0x40b1650e]"},
+	{true, 2, "mov dword ptr [rsi], ecx"},
+	{false, 1, 0},
+	{true, 3, "mov cl, 64"},
+	{true, 2, "mov cl, 64"},
+	{false, 2, 0},
+	{true, 3, "loopne 0x0000000000000fa1"},
+	{true, 2, "loopne 0x0000000000000fa0"},
+	{true, 1, "sahf"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 3, "xor dh, byte ptr [rax+117]"},
+	{true, 2, "jo 0x0000000000001077"},
+	{true, 2, "jnz 0x0000000000001066"},
+	{true, 8, "xchg sil, byte ptr fs:[rsi+0xffffffff8a4f6781]"},
+	{true, 7, "xchg sil, byte ptr [rsi+0xffffffff8a4f6781]"},
+	{true, 6, "xchg dh, byte ptr [rsi+0xffffffff8a4f6781]"},
+	{true, 2, "mov dh, 0x81"},
+	{true, 7, "and dword ptr [rdi+79], 0x4166b48a"},
+	{true, 9, "mov r14b, dword ptr [esi+0x56186941]"},
+	{true, 8, "mov r14b, byte ptr [r14+r12*2+0x56186941]"},
+	{true, 7, "mov dh, byte ptr [rsi+0x56186941]"},
+	{true, 2, "mov ah, 102"},
+	{true, 6, "imul bx, word ptr [r8], 0x3756"},
+	{true, 7, "imul ebx, dword ptr [r8], 0xffffffffc7363756"},
+	{true, 6, "imul ebx, dword ptr [rax], 0xffffffffc7363756"},
+	{true, 3, "sbb byte ptr [rsi+55], dl"},
+	{true, 1, "push rsi"},
+	{false, 1, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 1, "popfd"},
+	{true, 4, "cmp r11b, byte ptr [rsi-115]"},
+	{true, 3, "cmp bl, byte ptr [rsi-115]"},
+	{true, 1, "pop rsi"},
+	{true, 3, "lea edi, [rdi-13]"},
+	{true, 2, "jnle 0x0000000000000ff5"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 2, "pop r15"},
+	{true, 1, "pop rdi"},
+	{true, 4, "imul dword ptr [rcx+rsi-4]"},
+	{true, 1, "insb"},
+	{true, 2, "xor esp, edi"},
+	{true, 1, "cld"},
+	{true, 2, "jnp 0x0000000000001040"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 1, "push rsi"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "mov dl, dh"},
+	{false, 1, 0},
+	{true, 2, "sar byte ptr [rbx], cl"},
+	{true, 3, "cmp ecx, dword ptr [rbp-90]"},
+	{true, 2, "cmpsb"},
+	{true, 1, "cmpsb"},
+	{true, 2, "mov ah, 19"},
+	{true, 2, "adc ebp, dword ptr [rsi]"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 4, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "mov cl, 80"},
+	{true, 2, "mov cl, 80"},
+	{true, 1, "push rax"},
+	{true, 2, "sub byte ptr [rsi], ch"},
+	{true, 4, "jcez 0x0000000000001021"},
+	{true, 3, "jcez 0x0000000000001020"},
+	{true, 2, "jcez 0x000000000000101f"},
+	{true, 5, "sbb eax, 0x655d563e"},
+	{true, 2, "push rsi"},
+	{true, 1, "push rsi"},
+	{true, 1, "pop rbp"},
+	{true, 3, "xchg edx, dword ptr gs:[rcx]"},
+	{true, 2, "xchg edx, dword ptr [rcx]"},
+	{true, 2, "adc dword ptr [rsi], esp"},
+	{true, 3, "add al, 77"},
+	{true, 2, "add al, 77"},
+	{true, 4, "adc r12b, byte ptr [r13-77]"},
+	{true, 3, "adc ah, byte ptr [rbp-77]"},
+	{true, 3, "mov bl, 101"},
+	{true, 2, "mov bl, 101"},
+	{true, 2, "push rdi"},
+	{true, 1, "push rdi"},
+	{true, 2, "add esi, edx"},
+	{true, 3, "repne out 0xc5, al"},
+	{true, 2, "out 0xc5, al"},
+	{false, 1, 0},
+	{true, 2, "or dword ptr [rsi], ebp"},
+	{true, 6, "test eax, 0x7866b047"},
+	{true, 5, "test eax, 0x7866b047"},
+	{true, 3, "mov r8b, 102"},
+	{true, 2, "mov al, 102"},
+	{true, 3, "js 0x0000000000001027"},
+	{true, 2, "js 0x0000000000001026"},
+	{true, 2, "and al, 5"},
+	{true, 5, "add eax, 0x4f4d8728"},
+	{true, 6, "sub byte ptr [rdi+0x64f24f4d], al"},
+	{true, 3, "xchg ecx, dword ptr [rbp+79]"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 6, "or byte ptr [r8+rax*8-126], 0xb6"},
+	{true, 5, "or byte ptr [rax+rax*8-126], 0xb6"},
+	{true, 8, "rol byte ptr [rdx+0x34f316b6], 0xb4"},
+	{true, 7, "rol byte ptr [rdx+0x34f316b6], 0xb4"},
+	{false, 1, 0},
+	{true, 2, "mov dh, 22"},
+	{false, 1, 0},
+	{true, 3, "rep xor al, 0xb4"},
+	{true, 2, "xor al, 0xb4"},
+	{true, 2, "mov ah, 64"},
+	{true, 3, "jmp 0x0000000000001039"},
+	{true, 2, "jmp 0x0000000000001038"},
+	{true, 6, "sub al, 18"},
+	{true, 5, "sub al, 18"},
+	{true, 4, "sub al, 18"},
+	{true, 3, "sub al, 18"},
+	{true, 2, "sub al, 18"},
+	{true, 3, "adc ah, byte ptr [rsi-100]"},
+	{true, 2, "pushfw"},
+	{true, 1, "pushfd"},
+	{true, 4, "dec byte ptr [r8-6]"},
+	{true, 3, "dec byte ptr [rax-6]"},
+	{true, 2, "cli"},
+	{true, 1, "cli"},
+	{true, 2, "xor edi, dword ptr [rax]"},
+	{true, 4, "cmp byte ptr [rsp+rax*2-119], ch"},
+	{true, 1, "insb"},
+	{true, 3, "mov eax, r13d"},
+	{true, 2, "mov eax, ebp"},
+	{true, 5, "call 0x00000000543e7bb2"},
+	{true, 1, "lodsd"},
+	{true, 3, "imul edi, dword ptr [rsi], 84"},
+	{true, 2, "push rsp"},
+	{true, 1, "push rsp"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "loop 0x0000000000000ff2"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 2, "xor al, byte ptr [rdx]"},
+	{true, 3, "add ah, byte ptr [rsi+64]"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "adc edx, dword ptr [rax]"},
+	{true, 2, "adc edx, dword ptr [rax]"},
+	{true, 2, "adc bh, bl"},
+	{true, 2, "fcomip st, st(3)"},
+	{true, 6, "rep sub eax, 0xffffffffe305552b"},
+	{true, 5, "sub eax, 0xffffffffe305552b"},
+	{true, 3, "sub edx, dword ptr [rbp+5]"},
+	{true, 1, "push rbp"},
+	{true, 5, "add eax, 0xffffffffeeaed4e3"},
+	{true, 2, "jcez 0x0000000000000fd6"},
+	{false, 1, 0},
+	{true, 1, "scasb"},
+	{true, 1, "out dx, al"},
+	{true, 2, "stosq"},
+	{true, 1, "stosd"},
+	{true, 1, "nop"},
+	{true, 5, "sub eax, 0x4d044467"},
+	{true, 4, "add al, 77"},
+	{true, 3, "add al, 77"},
+	{true, 2, "add al, 77"},
+	{true, 3, "jb 0x0000000000000f90"},
+	{true, 2, "jb 0x0000000000000f8f"},
+	{true, 3, "lea ecx, [rbp+1]"},
+	{true, 4, "add qword ptr [r11+64], r14"},
+	{true, 3, "add dword ptr [rbx+64], esi"},
+	{true, 2, "jnb 0x0000000000001042"},
+	{true, 3, "add ebx, edx"},
+	{true, 2, "add ebx, edx"},
+	{true, 2, "sal dword ptr [rsi], cl"},
+	{true, 7, "xor edx, dword ptr ss:[rax+0x3a371cbf]"},
+	{true, 6, "xor edx, dword ptr [rax+0x3a371cbf]"},
+	{true, 1, "nop"},
+	{true, 5, "mov edi, 0x263a371c"},
+	{true, 2, "sbb al, 55"},
+	{false, 1, 0},
+	{true, 2, "cmp ah, byte ptr [rsi]"},
+	{true, 6, "jmp 0xfffffffff403896c"},
+	{true, 5, "jmp 0xfffffffff403896b"},
+	{true, 3, "jns 0x0000000000001006"},
+	{true, 2, "jns 0x0000000000001005"},
+	{true, 2, "add esi, esp"},
+	{true, 1, "hlt"},
+	{true, 2, "jnl 0x0000000000001011"},
+	{false, 2, 0},
+	{true, 2, "dec dword ptr [rdi]"},
+	{true, 5, "andps xmm0, xmmword ptr [rdx+101]"},
+	{true, 1, "push rsp"},
+	{true, 4, "and r12b, byte ptr [rbp+65]"},
+	{true, 3, "and ah, byte ptr [rbp+65]"},
+	{false, 3, 0},
+	{false, 2, 0},
+	{true, 3, "rep test al, dh"},
+	{true, 2, "test al, dh"},
+	{true, 4, "lock jle 0x0000000000000f91"},
+	{true, 3, "jle 0x0000000000000f90"},
+	{true, 2, "jle 0x0000000000000f8f"},
+	{true, 6, "lea esi, [rdi+0x443e8f08]"},
+	{true, 2, "mov bh, 8"},
+	{true, 6, "or byte ptr [rdi+0x0989443e], cl"},
+	{false, 2, 0},
+	{true, 4, "mov dword ptr ds:[rcx], r9d"},
+	{true, 3, "mov dword ptr [rcx], r9d"},
+	{true, 2, "mov dword ptr [rcx], ecx"},
+	{true, 2, "or dword ptr [rdi], ebp"},
+	{false, 1, 0},
+	{true, 3, "cmp esp, 0x89"},
+	{true, 1, "cld"},
+	{true, 2, "mov dword ptr [rsi], ebp"},
+	{true, 7, "xor eax, dword ptr cs:[rbx+0xfffffffffaffcfa5]"},
+	{true, 6, "xor eax, dword ptr [rbx+0xfffffffffaffcfa5]"},
+	{true, 7, "and dword ptr [rbp+0x36faffcf], 13"},
+	{true, 1, "movsd"},
+	{true, 1, "iret"},
+	{false, 2, 0},
+	{true, 1, "cli"},
+	{true, 6, "or eax, 0x6e7b7d28"},
+	{true, 5, "or eax, 0x6e7b7d28"},
+	{true, 3, "sub byte ptr [rbp+123], bh"},
+	{true, 2, "jnl 0x000000000000107d"},
+	{true, 2, "jnp 0x0000000000001070"},
+	{true, 1, "outsb"},
+	{true, 7, "sbb qword ptr [rcx+0xffffffffdaad423d], r10"},
+	{true, 6, "sbb dword ptr [rcx+0xffffffffdaad423d], edx"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 5, "cmp eax, 0xffffffffaadaad42"},
+	{true, 2, "lodsd"},
+	{true, 1, "lodsd"},
+	{true, 6, "fisubr dword ptr [rdx+0xffffffff98b6034c]"},
+	{true, 1, "stosb"},
+	{true, 7, "add r14, qword ptr [rsi+0x1a0b9398]"},
+	{true, 6, "add esi, dword ptr [rsi+0x1a0b9398]"},
+	{true, 2, "mov dh, 0x98"},
+	{true, 1, "cwde"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 2, "or ebx, dword ptr [rdx]"},
+	{true, 2, "sbb bl, byte ptr [rcx]"},
+	{true, 3, "sbb dword ptr [rdi+85], edx"},
+	{true, 1, "push rdi"},
+	{true, 1, "push rbp"},
+	{true, 3, "mov dword ptr [rdi-6], ecx"},
+	{true, 2, "cli"},
+	{true, 1, "cli"},
+	{true, 2, "mov cl, 121"},
+	{true, 2, "jns 0x0000000000001011"},
+	{true, 3, "psrld mm6, mm2"},
+	{true, 2, "sal dl, cl"},
+	{true, 6, "repne sub eax, 0xfffffffffb3d05bd"},
+	{true, 5, "sub eax, 0xfffffffffb3d05bd"},
+	{true, 5, "mov ebp, 0x18fb3d05"},
+	{true, 5, "add eax, 0xffffffffa818fb3d"},
+	{true, 5, "cmp eax, 0xffffffffa8a818fb"},
+	{true, 1, "sti"},
+	{true, 6, "sbb byte ptr [rax+0x4cfa00a8], ch"},
+	{true, 2, "test al, 0xa8"},
+	{true, 2, "test al, 0"},
+	{true, 2, "add dl, bh"},
+	{true, 1, "cli"},
+	{true, 5, "xor byte ptr [rbx+rsi*8-111], r9b"},
+	{true, 4, "xor byte ptr [rbx+rsi*8-111], cl"},
+	{false, 2, 0},
+	{true, 2, "rep xchg ecx, eax"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 2, "add dh, byte ptr [rsi]"},
+	{true, 3, "or dl, ch"},
+	{true, 2, "or dl, ch"},
+	{false, 1, 0},
+	{false, 2, 0},
+	{true, 4, "add esp, dword ptr cs:[rsi+56]"},
+	{true, 3, "add esp, dword ptr [rsi+56]"},
+	{true, 4, "cmp byte ptr [rcx+38], cl"},
+	{true, 3, "cmp byte ptr [rcx+38], cl"},
+	{false, 2, 0},
+	{true, 4, "rep xchg ecx, eax"},
+	{true, 3, "rep xchg ecx, eax"},
+	{true, 2, "rep xchg ecx, eax"},
+	{true, 1, "xchg ecx, eax"},
+	{true, 3, "cmp al, 70"},
+	{true, 2, "cmp al, 70"},
+	{false, 2, 0},
+	{true, 3, "mov ch, 0xa0"},
+	{true, 2, "mov ch, 0xa0"},
+	{true, 5, "mov al, byte ptr [0xffffffffc924ffa9]"},
+	{true, 5, "test eax, 0x5cc924ff"},
+	{true, 3, "jmp qword ptr [rcx+rcx*8]"},
+	{true, 2, "and al, 0xc9"},
+	{true, 1, "leave"},
+	{true, 1, "pop rsp"},
+	{true, 3, "fiadd word ptr [rcx+96]"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 4, 0},
+	{false, 3, 0},
+	{true, 1, "scasb"},
+	{true, 1, "ret"},
+	{true, 2, "cmp al, 79"},
+	{true, 3, "mov r11b, 117"},
+	{true, 2, "mov bl, 117"},
+	{true, 2, "jnz 0x0000000000000fea"},
+	{true, 5, "call 0xffffffff9b7d747f"},
+	{true, 2, "jp 0x0000000000001066"},
+	{true, 3, "jnl 0x0000000000000f9e"},
+	{true, 2, "jnl 0x0000000000000f9d"},
+	{true, 1, "wait"},
+	{true, 1, "xchg ebx, eax"},
+	{true, 5, "mov ebp, 0x418cbfb5"},
+	{true, 2, "mov ch, 0xbf"},
+	{true, 5, "mov edi, 0xffffffff824d418c"},
+	{true, 3, "mov dword ptr [rcx+77], es"},
+	{false, 2, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+	{true, 1, "xchg esi, eax"},
+	{true, 1, "pushfd"},
+	{true, 1, "cmpsd"},
+	{true, 1, "xlat"},
+	{false, 2, 0},
+	{false, 1, 0},
+	{false, 3, 0},
+	{false, 2, 0},
+	{false, 1, 0},
+};
+
+#endif
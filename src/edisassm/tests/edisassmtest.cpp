@@ -1,9 +1,12 @@
 
 #include "Instruction.h"
+#include "edisassm_length.h"
+#include "edisassmgolden.h"
 #include <iostream>
 #include <fstream>
 #include <string>
 #include <cstdio>
+#include <algorithm>
 
 static const int test_count = 4208;
 
@@ -4234,6 +4237,147 @@ struct test_data_t {
 typedef Instruction<edisassm::x86_64> insn64_t;
 typedef Instruction<edisassm::x86>    insn32_t;
 
+// the buffer, iterator and throwing constructors must all agree
+template <class I>
+bool check_modes(const uint8_t *first, const uint8_t *last) {
+	const std::size_t size = last - first;
+
+	I a(first, last, 0x00001000, std::nothrow);
+	I b(first, size, 0x00001000, std::nothrow);
+
+	if(a.valid() != b.valid() || a.size() != b.size() || a.type() != b.type() || a.operand_count() != b.operand_count()) {
+		return false;
+	}
+
+	if(a.valid() && edisassm::to_string(a) != edisassm::to_string(b)) {
+		return false;
+	}
+
+	try {
+		I c(first, last, 0x00001000);
+		if(!a.valid() || c.size() != a.size() || edisassm::to_string(c) != edisassm::to_string(a)) {
+			return false;
+		}
+	} catch(const edisassm::invalid_instruction &e) {
+		if(a.valid() || e.size() != a.size()) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// the length classifier must agree with the full decoder
+template <class I>
+bool check_length(const uint8_t *first, const uint8_t *last) {
+	typedef typename I::operand_t operand_t;
+
+	const I insn(first, last - first, 0x00001000, std::nothrow);
+	edisassm::length_info<typename I::model_t> info;
+	edisassm::decode_length(first, last - first, 0x00001000, info);
+
+	if(info.valid != insn.valid()) {
+		return false;
+	}
+
+	if(info.valid) {
+		const bool relative = insn.operand_count() != 0 && insn.operand(0).general_type() == operand_t::TYPE_REL;
+
+		if(info.size != insn.size() || info.flow != edisassm::flow_of(insn) || info.has_target != relative) {
+			return false;
+		}
+
+		if(relative && info.target != insn.operand(0).relative_target()) {
+			return false;
+		}
+
+		// the first RIP relative memory operand, if any
+		bool has_memory_target = false;
+		typename I::address_t memory_target = 0;
+		for(unsigned int i = 0; i < insn.operand_count(); ++i) {
+			const operand_t &op = insn.operand(i);
+			if(op.general_type() == operand_t::TYPE_EXPRESSION && op.expression().base == operand_t::REG_RIP) {
+				has_memory_target = true;
+				memory_target     = insn.rva() + insn.size() + op.displacement();
+				break;
+			}
+		}
+
+		if(info.has_memory_target != has_memory_target || (has_memory_target && info.memory_target != memory_target)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// the pseudo-random buffer the decode mode comparison runs over
+void fill_random(uint8_t *buffer, std::size_t size) {
+	uint32_t seed = 0x20080414;
+	for(std::size_t i = 0; i < size; ++i) {
+		seed = seed * 1103515245 + 12345;
+		buffer[i] = static_cast<uint8_t>(seed >> 16);
+	}
+}
+
+// like fill_random, but about every fourth byte is a prefix, REX or escape
+void fill_prefixed(uint8_t *buffer, std::size_t size) {
+	static const uint8_t prefixes[] = {
+		0x26, 0x2e, 0x36, 0x3e, 0x64, 0x65, 0x66, 0x67, 0xf0, 0xf2, 0xf3, 0x0f,
+		0x40, 0x41, 0x44, 0x48, 0x49, 0x4c, 0x4d, 0x4f
+	};
+	uint32_t seed = 0x20121017;
+	for(std::size_t i = 0; i < size; ++i) {
+		seed = seed * 1103515245 + 12345;
+		const uint32_t r = seed >> 16;
+		buffer[i] = (r & 3) ? static_cast<uint8_t>(r >> 2) : prefixes[(r >> 2) % sizeof(prefixes)];
+	}
+}
+
+template <class I>
+bool check_random_modes(const char *name, void (*fill)(uint8_t *, std::size_t)) {
+	uint8_t buffer[4096];
+	fill(buffer, sizeof(buffer));
+
+	std::cout << "performing " << name << " decode mode comparison...";
+	for(std::size_t i = 0; i < sizeof(buffer); ++i) {
+		const uint8_t *const first = buffer + i;
+		const uint8_t *const last  = first + std::min<std::size_t>(sizeof(buffer) - i, I::MAX_SIZE + 1);
+		if(!check_modes<I>(first, last) || !check_length<I>(first, last)) {
+			std::cout << "\n----------\n";
+			std::cout << "offset " << i << " decodes differently" << std::endl;
+			std::cout << "FAIL" << std::endl;
+			return false;
+		}
+	}
+	std::cout << "OK" << std::endl;
+	return true;
+}
+
+// every offset must decode exactly like it did with the previous decoder
+template <class I>
+bool check_golden(const char *name, void (*fill)(uint8_t *, std::size_t), const golden_t *golden) {
+	uint8_t buffer[golden_count];
+	fill(buffer, sizeof(buffer));
+
+	std::cout << "performing " << name << " golden comparison...";
+	for(std::size_t i = 0; i < sizeof(buffer); ++i) {
+		const uint8_t *const first = buffer + i;
+		const uint8_t *const last  = first + std::min<std::size_t>(sizeof(buffer) - i, I::MAX_SIZE + 1);
+		const I insn(first, last, 0x00001000, std::nothrow);
+
+		if(insn.valid() != golden[i].valid || insn.size() != golden[i].size || (insn.valid() && edisassm::to_string(insn) != golden[i].text)) {
+			std::cout << "\n----------\n";
+			std::cout << "offset " << i << ": '" << (insn.valid() ? edisassm::to_string(insn) : "(invalid)") << "' (" << insn.size() << ") != '";
+			std::cout << (golden[i].valid ? golden[i].text : "(invalid)") << "' (" << golden[i].size << ")" << std::endl;
+			std::cout << "FAIL" << std::endl;
+			return false;
+		}
+	}
+	std::cout << "OK" << std::endl;
+	return true;
+}
+
 int main() {
 	for(int i = 0; i < test_count; ++i) {
 		test_data_t *p = &test32_data[i];
@@ -4257,6 +4401,24 @@ int main() {
 				
 		std::cout << " " << edisassm::to_byte_string(insn) << " '" << edisassm::to_string(insn) << "' ";
 		
+		const uint8_t *const first = reinterpret_cast<const uint8_t *>(p->bytes);
+		if(!check_modes<insn32_t>(first, first + p->size) || !check_length<insn32_t>(first, first + p->size)) {
+			std::cout << "\n----------\n";
+			std::cout << "decode modes disagree" << std::endl;
+			std::cout << "FAIL" << std::endl;
+			return -1;
+		}
+		
 		std::cout << "OK" << std::endl;
 	}
+	
+	if(!check_random_modes<insn32_t>("32-bit random", fill_random) || !check_random_modes<insn64_t>("64-bit random", fill_random) ||
+		!check_random_modes<insn32_t>("32-bit prefixed", fill_prefixed) || !check_random_modes<insn64_t>("64-bit prefixed", fill_prefixed)) {
+		return -1;
+	}
+
+	if(!check_golden<insn32_t>("32-bit random", fill_random, golden_random32) || !check_golden<insn64_t>("64-bit random", fill_random, golden_random64) ||
+		!check_golden<insn32_t>("32-bit prefixed", fill_prefixed, golden_prefixed32) || !check_golden<insn64_t>("64-bit prefixed", fill_prefixed, golden_prefixed64)) {
+		return -1;
+	}
 }
@@ -20,6 +20,7 @@ HEADERS += \
 	ByteShiftArray.h \
 	CommentServer.h \
 	Configuration.h \
+	ControlFlowGraph.h \
 	DataViewInfo.h \
 	DebugEvent.h \
 	Debugger.h \
@@ -46,6 +47,7 @@ HEADERS += \
 	IRegion.h \
 	ISessionFile.h \
 	IState.h \
+	Job.h \
 	LineEdit.h \
 	MD5.h \
 	MemoryRegion.h \
@@ -59,6 +61,9 @@ HEADERS += \
 	RegionBuffer.h \
 	Register.h \
 	RegisterViewDelegate.h \
+	ResultStore.h \
+	ResultsModel.h \
+	ResultsView.h \
 	ScopedPointer.h \
 	State.h \
 	SymbolManager.h \
@@ -66,6 +71,7 @@ HEADERS += \
 	TabWidget.h \
 	Types.h \
 	Util.h \
+	XrefIndex.h \
 	version.h
 
 FORMS += \
@@ -86,6 +92,7 @@ SOURCES += \
 	ByteShiftArray.cpp \
 	CommentServer.cpp \
 	Configuration.cpp \
+	ControlFlowGraph.cpp \
 	DataViewInfo.cpp \
 	DebugEvent.cpp \
 	Debugger.cpp \
@@ -102,6 +109,7 @@ SOURCES += \
 	DialogThreads.cpp \
 	IBinary.cpp \
 	Instruction.cpp \
+	Job.cpp \
 	LineEdit.cpp \
 	MD5.cpp \
 	MemoryRegion.cpp \
@@ -114,10 +122,14 @@ SOURCES += \
 	RegionBuffer.cpp \
 	Register.cpp \
 	RegisterViewDelegate.cpp \
+	ResultStore.cpp \
+	ResultsModel.cpp \
+	ResultsView.cpp \
 	State.cpp \
 	SymbolManager.cpp \
 	SyntaxHighlighter.cpp \
 	TabWidget.cpp \
+	XrefIndex.cpp \
 	main.cpp
 
 DEPENDPATH  += ./qhexview
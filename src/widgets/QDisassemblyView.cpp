@@ -58,6 +58,18 @@ namespace {
 		painter->restore();
 	}
 
+	//------------------------------------------------------------------------------
+	// Name: category_at(IAnalyzer *analyzer, const QVector<IAnalyzer::AddressCategory> &categories, yad64::address_t base, yad64::address_t address)
+	// Desc: looks in the pre-computed categories first, only asking the analyzer
+	//       when the address falls outside of them
+	//------------------------------------------------------------------------------
+	IAnalyzer::AddressCategory category_at(IAnalyzer *analyzer, const QVector<IAnalyzer::AddressCategory> &categories, yad64::address_t base, yad64::address_t address) {
+		if(address >= base && address - base < static_cast<yad64::address_t>(categories.size())) {
+			return categories[address - base];
+		}
+		return analyzer->category(address);
+	}
+
 	struct show_separator_tag {};
 
 	template <class T, size_t N>
@@ -160,11 +172,12 @@ size_t QDisassemblyView::length_disasm_back(const quint8 *buf, size_t size) cons
 
 	while(offs < yad64::Instruction::MAX_SIZE) {
 	
-		const yad64::Instruction insn(tmp + offs, tmp + sizeof(tmp), 0, std::nothrow);
-		if(!insn.valid()) {
+		// only the sizes matter here, so skip decoding the operands
+		yad64::InstructionLength info;
+		if(!edisassm::decode_length(tmp + offs, sizeof(tmp) - offs, 0, info)) {
 			return 0;
 		}
-		const size_t cmdsize = insn.size();
+		const size_t cmdsize = info.size;
 		offs += cmdsize;
 
 		if(offs == yad64::Instruction::MAX_SIZE) {
@@ -221,9 +234,9 @@ yad64::address_t QDisassemblyView::following_instructions(yad64::address_t curre
 			current_address += 1;
 			break;
 		} else {
-			const yad64::Instruction insn(buf, buf + buf_size, current_address, std::nothrow);
-			if(insn) {
-				current_address += insn.size();
+			yad64::InstructionLength info;
+			if(edisassm::decode_length(buf, buf_size, current_address, info)) {
+				current_address += info.size;
 			} else {
 				current_address += 1;
 				break;
@@ -416,7 +429,9 @@ int QDisassemblyView::draw_instruction(QPainter &painter, const yad64::Instructi
 	const int ret         = insn.size();
 
 	if(insn.valid()) {
-		QString opcode = QString::fromStdString(upper ? edisassm::to_string(insn, edisassm::syntax_intel_ucase()) : edisassm::to_string(insn, edisassm::syntax_intel_lcase()));
+		char buffer[edisassm::FORMAT_BUFFER_SIZE];
+		const std::size_t length = upper ? edisassm::format(insn, buffer, sizeof(buffer), edisassm::syntax_intel_ucase()) : edisassm::format(insn, buffer, sizeof(buffer), edisassm::syntax_intel_lcase());
+		QString opcode = QString::fromLatin1(buffer, length);
 		
 		opcode = painter.fontMetrics().elidedText(opcode, Qt::ElideRight, (l3 - l2) - font_width_ * 2);
 
@@ -515,14 +530,13 @@ QString QDisassemblyView::format_invalid_instruction_bytes(const yad64::Instruct
 }
 
 //------------------------------------------------------------------------------
-// Name: draw_function_markers(QPainter &painter, yad64::address_t address, int l2, int y, int insn_size, IAnalyzer *analyzer)
-// Desc:
+// Name: draw_function_markers(QPainter &painter, int l2, int y, IAnalyzer::AddressCategory cat, IAnalyzer::AddressCategory last_byte_cat)
+// Desc: cat is the category of the first byte of the instruction on this line,
+//       last_byte_cat the one of its last byte
 //------------------------------------------------------------------------------
-void QDisassemblyView::draw_function_markers(QPainter &painter, yad64::address_t address, int l2, int y, int insn_size, IAnalyzer *analyzer) {
-	Q_CHECK_PTR(analyzer);
+void QDisassemblyView::draw_function_markers(QPainter &painter, int l2, int y, IAnalyzer::AddressCategory cat, IAnalyzer::AddressCategory last_byte_cat) {
 	painter.setPen(QPen(palette().shadow().color(), 2));
 
-	const IAnalyzer::AddressCategory cat = analyzer->category(address);
 	const int line_height = this->line_height();
 	const int x = l2 + font_width_;
 
@@ -547,7 +561,7 @@ void QDisassemblyView::draw_function_markers(QPainter &painter, yad64::address_t
 
 		break;
 	case IAnalyzer::ADDRESS_FUNC_BODY:
-		if(analyzer->category(address + insn_size - 1) == IAnalyzer::ADDRESS_FUNC_END) {
+		if(last_byte_cat == IAnalyzer::ADDRESS_FUNC_END) {
 			goto do_end;
 		} else {
 
@@ -622,6 +636,16 @@ void QDisassemblyView::paintEvent(QPaintEvent *) {
 
 	IAnalyzer *const analyzer = yad64::v1::analyzer();
 
+	// classify everything we could possibly draw with a single call, rather
+	// than asking the analyzer about every line a few times over
+	const yad64::address_t first_address = address_offset_ + current_line;
+	const yad64::address_t end_address   = qMin<yad64::address_t>(address_offset_ + region_size, first_address + (viewable_lines + 1) * yad64::Instruction::MAX_SIZE + 1);
+
+	QVector<IAnalyzer::AddressCategory> categories;
+	if(analyzer) {
+		categories = analyzer->categories(first_address, end_address);
+	}
+
 	yad64::address_t last_address = 0;
 
 	while(viewable_lines >= 0 && current_line < region_size) {
@@ -643,7 +667,7 @@ void QDisassemblyView::paintEvent(QPaintEvent *) {
 		// disassemble the instruction, if it happens that the next byte is the start of a known function
 		// then we should treat this like a one byte instruction
 		yad64::Instruction insn(buf, buf + buf_size, address, std::nothrow);
-		if((analyzer) && (analyzer->category(address + 1) == IAnalyzer::ADDRESS_FUNC_START)) {
+		if((analyzer) && (category_at(analyzer, categories, first_address, address + 1) == IAnalyzer::ADDRESS_FUNC_START)) {
 			yad64::Instruction(buf, buf + 1, address, std::nothrow).swap(insn);
 		}
 
@@ -664,7 +688,12 @@ void QDisassemblyView::paintEvent(QPaintEvent *) {
 		}
 
 		if(analyzer) {
-			draw_function_markers(painter, address, l2, y, insn_size, analyzer);
+			draw_function_markers(
+				painter,
+				l2,
+				y,
+				category_at(analyzer, categories, first_address, address),
+				category_at(analyzer, categories, first_address, address + insn_size - 1));
 		}
 
 		// draw breakpoint icon or eip indicator
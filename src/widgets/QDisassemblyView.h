@@ -24,10 +24,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <QPixmap>
 #include <QSet>
 
+#include "IAnalyzer.h"
 #include "MemoryRegion.h"
 #include "Types.h"
 
-class IAnalyzer;
 class QPainter;
 class QTextDocument;
 class SyntaxHighlighter;
@@ -92,7 +92,7 @@ private:
 	int line2() const;
 	int line3() const;
 	int line_height() const;
-	void draw_function_markers(QPainter &painter, yad64::address_t address, int l2, int y, int insn_size, IAnalyzer *analyzer);
+	void draw_function_markers(QPainter &painter, int l2, int y, IAnalyzer::AddressCategory cat, IAnalyzer::AddressCategory last_byte_cat);
 	void updateScrollbars();
 	void updateSelectedAddress(QMouseEvent *event);
 
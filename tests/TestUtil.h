@@ -0,0 +1,113 @@
+/*
+Copyright (C) 2006 - 2011 Evan Teran
+                          eteran@alum.rit.edu
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef TEST_UTIL_20121017_H_
+#define TEST_UTIL_20121017_H_
+
+#include "Types.h"
+#include <iostream>
+#include <vector>
+
+// what the randomized tests share. each of them checks a fast implementation
+// against a brute-force one over many generated rounds, and prints a line for
+// every check:
+//
+//   test::performing() << "round " << round << test::ellipsis;
+//   if(...) {
+//       test::failure() << "expected ..." << std::endl;
+//       return test::fail();
+//   }
+//   test::ok() << std::endl;
+//
+// the generator always starts from the same seed, so a failing round comes
+// out the same on the next run
+namespace test {
+
+typedef std::vector<quint8> bytes_t;
+
+//------------------------------------------------------------------------------
+// Name: seed()
+// Desc:
+//------------------------------------------------------------------------------
+inline quint32 &seed() {
+	static quint32 value = 0x20121017;
+	return value;
+}
+
+//------------------------------------------------------------------------------
+// Name: next_random()
+// Desc: 15 random bits
+//------------------------------------------------------------------------------
+inline quint32 next_random() {
+	seed() = seed() * 1103515245 + 12345;
+	return seed() >> 16;
+}
+
+//------------------------------------------------------------------------------
+// Name: next_random64()
+// Desc: a random address, anywhere
+//------------------------------------------------------------------------------
+inline yad64::address_t next_random64() {
+	return (static_cast<yad64::address_t>(next_random()) << 48) ^ (static_cast<yad64::address_t>(next_random()) << 32) ^ (static_cast<yad64::address_t>(next_random()) << 16) ^ next_random();
+}
+
+//------------------------------------------------------------------------------
+// Name: performing()
+// Desc: starts the line of a check, the caller describes it and ends with
+//       ellipsis
+//------------------------------------------------------------------------------
+inline std::ostream &performing() {
+	return std::cout << "performing ";
+}
+
+//------------------------------------------------------------------------------
+// Name: ellipsis(std::ostream &os)
+// Desc: ends the description of a check, shown while it runs
+//------------------------------------------------------------------------------
+inline std::ostream &ellipsis(std::ostream &os) {
+	return os << "..." << std::flush;
+}
+
+//------------------------------------------------------------------------------
+// Name: ok()
+// Desc: the check passed, the caller may add a note and ends the line
+//------------------------------------------------------------------------------
+inline std::ostream &ok() {
+	return std::cout << "OK";
+}
+
+//------------------------------------------------------------------------------
+// Name: failure()
+// Desc: the check failed, the caller explains why on lines of its own
+//------------------------------------------------------------------------------
+inline std::ostream &failure() {
+	return std::cout << "\n----------\n";
+}
+
+//------------------------------------------------------------------------------
+// Name: fail()
+// Desc: ends a failed check, returns what main returns
+//------------------------------------------------------------------------------
+inline int fail() {
+	std::cout << "FAIL" << std::endl;
+	return -1;
+}
+
+}
+
+#endif